@@ -1,7 +1,7 @@
 #No cross-compiling support for win yet
 message("System processor: " ${CMAKE_SYSTEM_PROCESSOR})
 if (NOT WIN32)
-	if(CMAKE_SYSTEM_PROCESSOR MATCHES "[Aa][Rr][Mm]")
+	if(CMAKE_SYSTEM_PROCESSOR MATCHES "[Aa][Rr][Mm]|^aarch64")
 		set(PIXFC_TARGET_ARCH "ARM" CACHE STRING "Target arch is ARM")
 		message("Target arch is ARM")
 	elseif(CMAKE_SYSTEM_PROCESSOR MATCHES "^x86_64$")
@@ -10,7 +10,7 @@ if (NOT WIN32)
 	elseif(CMAKE_SYSTEM_PROCESSOR MATCHES "^i?.86$")
 		set(PIXFC_TARGET_ARCH "Intel x86")
 		message("Target arch is Intel 32-bit")
-	else(CMAKE_SYSTEM_PROCESSOR MATCHES "[Aa][Rr][Mm]")
+	else(CMAKE_SYSTEM_PROCESSOR MATCHES "[Aa][Rr][Mm]|^aarch64")
 		message(FATAL_ERROR "Unknown arch " ${CMAKE_SYSTEM_PROCESSOR})
-	endif(CMAKE_SYSTEM_PROCESSOR MATCHES "[Aa][Rr][Mm]")
+	endif(CMAKE_SYSTEM_PROCESSOR MATCHES "[Aa][Rr][Mm]|^aarch64")
 endif(NOT WIN32)
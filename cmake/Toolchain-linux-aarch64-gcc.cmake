@@ -0,0 +1,10 @@
+SET(CMAKE_SYSTEM_NAME Linux)
+SET(CMAKE_SYSTEM_PROCESSOR aarch64)
+
+# -mcpu, -march, -mfloat_abi & -mfpu
+# not set: the compiler's defaults (armv8-a, which includes NEON) are fine
+
+# compiler (uncomment/update when cross compiling)
+# The unit tests can then be run with qemu user-mode emulation:
+# qemu-aarch64 -L /usr/aarch64-linux-gnu tools/unit-testing
+#SET(CMAKE_C_COMPILER /usr/bin/aarch64-linux-gnu-gcc)
@@ -13,5 +13,8 @@ SET(PIXFC_ARM_TARGET_FLOAT_ABI hard)
 # -mfpu
 SET(PIXFC_ARM_TARGET_FPU vfpv3-d16)
 
+# -mfpu for the NEON routines
+SET(PIXFC_ARM_TARGET_NEON_FPU neon)
+
 # compiler (uncomment/update when cross compiling)
 #SET(CMAKE_C_COMPILER /usr/bin/arm-linux-gnueabihf-gcc)
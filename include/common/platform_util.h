@@ -27,6 +27,12 @@
 #define __INTEL_CPU__	1
 #endif
 
+// NEON is always available on AArch64, and on 32-bit ARM when the compiler
+// is told the FPU has it (-mfpu=neon)
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define __NEON_CPU__	1
+#endif
+
 #ifdef __INTEL_CPU__
 #include <emmintrin.h>
 #else // __INTEL_CPU__
@@ -56,6 +56,28 @@ typedef enum {
 	// 4 bytes per 2 pixels  - row bytes is 2 * width
 	PixFcYUV420P,
 
+	// Semi-planar YUV420    - 8-bit components
+	// 2 planes (Y, interleaved UV) in a single contiguous memory area
+	// 3 bytes per 2 pixels  - row bytes is width
+	PixFcNV12,
+
+	// Semi-planar YUV420    - 8-bit components
+	// 2 planes (Y, interleaved VU) in a single contiguous memory area
+	// 3 bytes per 2 pixels  - row bytes is width
+	PixFcNV21,
+
+	// Semi-planar YUV420    - 10-bit components stored in the 10 most
+	// significant bits of little-endian 16-bit words
+	// 2 planes (Y, interleaved UV) in a single contiguous memory area
+	// 6 bytes per 2 pixels  - row bytes is 3 * width
+	PixFcP010,
+
+	// Semi-planar YUV422    - 10-bit components stored in the 10 most
+	// significant bits of little-endian 16-bit words
+	// 2 planes (Y, interleaved UV) in a single contiguous memory area
+	// 8 bytes per 2 pixels  - row bytes is 4 * width
+	PixFcP210,
+
 	// Interleaved YUV422    - 10-bit components
 	// 16 bytes per 6 pixels - row bytes is (width + 47) / 48 * 128 bytes long (integer math !!)
 	// see https://developer.apple.com/quicktime/icefloe/dispatch019.html#v210
@@ -117,15 +139,20 @@ typedef enum {
 	// as if PixFcFlag_NoSSE was used.
 	PixFcFlag_NoSSEFloat =			(1 << 1),
 	// Force the use of a SSE2-only conversion routine
-	// (ie. exclude Non-SSE, SSSE3 and SSE41 conversion routines)
+	// (ie. exclude Non-SSE, SSSE3, SSE41 and AVX2 conversion routines)
 	PixFcFlag_SSE2Only =			(1 << 2),
 	// Force the use of a SSE2 and SSSE3-only conversion routine
-	// (ie. exclude Non-SSE, SSE2-only and SSE41 conversion routines)
+	// (ie. exclude Non-SSE, SSE2-only, SSE41 and AVX2 conversion routines)
 	PixFcFlag_SSE2_SSSE3Only =		(1 << 3),
 	// Force the use of a SSE2, SSSE3 and SSE41 conversion routine
-	// (ie. exclude Non-SSE, SSE2-only and SSE2/SSSE3-only conversion routines)
-	// Note this flag is redundant as it is implied by PixFcFlag_Default.
+	// (ie. exclude Non-SSE, SSE2-only, SSE2/SSSE3-only and AVX2 conversion routines)
 	PixFcFlag_SSE2_SSSE3_SSE41Only=	(1 << 4),
+	// Force the use of an AVX2 conversion routine
+	// (ie. exclude Non-SSE and SSE conversion routines)
+	PixFcFlag_AVX2Only =			(1 << 5),
+	// Force the use of an AVX-512 conversion routine (AVX512F, AVX512BW
+	// and AVX512VBMI) (ie. exclude Non-SSE, SSE and AVX2 conversion routines)
+	PixFcFlag_AVX512Only =			(1 << 6),
 
 	//
 	// By default, PixFC performs a full-range conversion, unless one of the
@@ -138,6 +165,11 @@ typedef enum {
 	// as defined in ITU-R Rec. BT.709
 	PixFcFlag_BT709Conversion =		(1 << 8),
 
+	//
+	// Force the use of a NEON conversion routine on ARM CPUs
+	// (ie. exclude Non-SSE conversion routines)
+	PixFcFlag_NEONOnly =			(1 << 9),
+
 	//
 	// Force the use of a conversion routine which uses nearest neighbour
 	// resampling. This means:
@@ -146,8 +178,65 @@ typedef enum {
 	// This is the fastest form of resampling, but converted images can be
 	// of lower quality and prone to conversion artifacts (aliasing).
 	PixFcFlag_NNbResamplingOnly	=	(1 << 14),
+
+	//
+	// Split each image into horizontal bands and convert them concurrently
+	// on a pool of worker threads (one per online CPU). See create_pixfc_mt()
+	// to control the number of threads. Conversions from / to planar formats
+	// are not split yet and run on the calling thread only, in which case
+	// this flag is cleared from the flags returned in struct PixFcSSE.
+	PixFcFlag_MultiThreaded =		(1 << 15),
+
+	//
+	// Write the converted pixels with non-temporal (streaming) stores, which
+	// bypass the CPU caches. Use this flag when the output is not read back
+	// by the CPU (e.g. it goes straight to a DMA buffer), to avoid evicting
+	// useful data from the caches with large images. Streaming stores are only
+	// used by SSE conversion routines, and only if the destination buffer
+	// and its row bytes are 16-byte aligned. AVX2 and AVX-512 conversion
+	// routines are skipped unless PixFcFlag_AVX2Only or PixFcFlag_AVX512Only
+	// is also given, in which case this flag is cleared from the flags returned in struct PixFcSSE (as it is
+	// for non-SSE and NEON routines).
+	PixFcFlag_NonTemporalStores =	(1 << 16),
+
+	//
+	// Time every conversion routine matching the other flags on a synthetic
+	// image of the requested size and use the fastest one, rather than the
+	// first one in PixFC's built-in order, which is not the fastest on every
+	// CPU. Non-SSE float routines are only timed if PixFcFlag_NoSSEFloat is
+	// also given. The result is saved to a cache file and reused by later
+	// calls (from any process) for the same formats, flags, size and CPU
+	// features, so only the first call is slowed down by the measurements.
+	// The cache file is $HOME/.pixfc-sse-autotune (%LOCALAPPDATA%\pixfc-sse-autotune
+	// on Windows), unless the PIXFC_AUTOTUNE_CACHE environment variable gives
+	// its path. Setting PIXFC_AUTOTUNE_CACHE to an empty string disables the
+	// cache. This flag is cleared from the flags returned in struct PixFcSSE.
+	PixFcFlag_Autotune =			(1 << 17),
+
+	//
+	// Downscale the image by an integer factor while converting it, as
+	// needed to generate proxies / thumbnails. Each output pixel is the
+	// average of a block of factor x factor source pixels, computed in YUV
+	// before conversion, so the full-size image is never converted.
+	// The width and height given to create_pixfc() are those of the source
+	// image and must be multiples of the factor. The destination row bytes
+	// must be valid for an image width / factor pixels wide.
+	// Downscaling is supported from YUYV, UYVY and v210 to ARGB, BGRA, RGB24
+	// and BGR24. SSE routines are provided for 2x and 4x and require the
+	// downscaled width to be a multiple of 16 pixels (48 from v210), other
+	// factors are handled by the non-SSE routines. Use PIXFC_DOWNSCALE_FLAG()
+	// to build the flag for other factors (up to 255).
+	// This flag can not be combined with PixFcFlag_NNbResamplingOnly.
+	PixFcFlag_Downscale2x =			(2 << 20),
+	PixFcFlag_Downscale4x =			(4 << 20),
+	PixFcFlag_DownscaleMask =		(0xFF << 20),
 } PixFcFlag;
 
+// Build the downscaling flag for the given factor, and extract the factor
+// from flags (0 if no downscaling flag is present).
+#define PIXFC_DOWNSCALE_FLAG(factor)	((((uint32_t)(factor)) & 0xFF) << 20)
+#define PIXFC_DOWNSCALE_FACTOR(flags)	((((uint32_t)(flags)) & PixFcFlag_DownscaleMask) >> 20)
+
 
 /*
  * A conversion block function converts pixels from an input buffer in a specific
@@ -182,6 +271,23 @@ struct PixFcSSE{
 
 	// PixFC will set this member to reflect the flags actually used by the conversion function
 	PixFcFlag					flags;
+
+	// Number of threads the conversion is spread over (1 unless
+	// PixFcFlag_MultiThreaded was given)
+	uint32_t					thread_count;
+
+	// Number of lines ahead of the current one the conversion function
+	// prefetches the source lines from (0, the default, disables software
+	// prefetching). Use set_pixfc_prefetch_distance() to change it.
+	uint32_t					prefetch_distance;
+
+	// Value written to the alpha channel of ARGB and BGRA output pixels
+	// (0, the default). Conversions between ARGB and BGRA keep the source
+	// alpha instead. Use set_pixfc_alpha() to change it.
+	uint8_t						alpha;
+
+	// Private data - do not touch
+	void *						private_data;
 };
 
 
@@ -201,13 +307,149 @@ uint32_t		create_pixfc(
 						//		 width * number_of_bytes_per_pixel. However some
 						//		 formats have alignment requirements. For instance,
 						//		 v210 requires the size of each line to be multiple
-						//		 of 128 bytes.
-	uint32_t,			// in  - destination buffer row bytes.
+						//		 of 128 bytes. Larger values can be used to skip
+						//		 padding at the end of each line, except with
+						//		 planar formats whose planes must be tightly packed.
+						//		 SSE conversions are faster if row bytes is a
+						//		 multiple of 16.
+	uint32_t,			// in  - destination buffer row bytes (same rules as above).
 	PixFcFlag			// in  - tune the selection of the conversion function. See
 						//		 enum definition above.
 );
 
 
+/*
+ * Same as create_pixfc(), but the conversion is split over 'thread_count'
+ * threads (including the one calling convert()), as if PixFcFlag_MultiThreaded
+ * was given. If 'thread_count' is 0, one thread per online CPU is used.
+ * The worker threads are started here and live until destroy_pixfc() is
+ * called. Calls to convert() on the same struct PixFcSSE are serialised.
+ */
+uint32_t		create_pixfc_mt(
+	struct PixFcSSE**,	// out - returns a struct PixFcSSE
+	PixFcPixelFormat,  	// in  - source format
+	PixFcPixelFormat, 	// in  - destination format
+	uint32_t,			// in  - width
+	uint32_t, 			// in  - height
+	uint32_t,			// in  - source buffer row bytes
+	uint32_t,			// in  - destination buffer row bytes
+	PixFcFlag,			// in  - tune the selection of the conversion function
+	uint32_t			// in  - number of threads (0 for one per online CPU)
+);
+
+
+/*
+ * Same as create_pixfc(), but the conversion reads the 'width' x 'height'
+ * window at ('x', 'y') in a larger source image instead of the whole image,
+ * and writes it to a destination image of the size of the window. The buffer
+ * given to convert() is the whole source image: this saves copying the window
+ * to its own buffer first. The width, height and pixel_count members of the
+ * returned struct PixFcSSE are those of the window.
+ * The source format must be interleaved. If the window does not start and end
+ * on whole pixel groups of the source format (2 pixels for YUYV and UYVY, 6
+ * for v210), the conversion runs over the smallest enclosing window that does,
+ * a few lines at a time, in an internal buffer from which the requested pixels
+ * are copied out. Chroma samples shared with pixels outside of the window are
+ * then used as they are in the source image. In this case, the destination
+ * format must be interleaved, the window must start and end on whole pixel
+ * groups of the destination format, convert() must not be called
+ * concurrently on the same struct PixFcSSE, and the conversion runs on the
+ * calling thread only (PixFcFlag_MultiThreaded is ignored).
+ * The width and height requirements of the conversion routines apply to the
+ * enclosing window. When downscaling, the window dimensions must be multiples
+ * of the downscaling factor.
+ * Returns PixFc_InvalidRegionOfInterest if the window is not within the
+ * source image or can not be converted.
+ */
+uint32_t		create_pixfc_roi(
+	struct PixFcSSE**,	// out - returns a struct PixFcSSE
+	PixFcPixelFormat,  	// in  - source format
+	PixFcPixelFormat, 	// in  - destination format
+	uint32_t,			// in  - source image width
+	uint32_t, 			// in  - source image height
+	uint32_t,			// in  - source buffer row bytes
+	uint32_t,			// in  - window x
+	uint32_t,			// in  - window y
+	uint32_t,			// in  - window width
+	uint32_t,			// in  - window height
+	uint32_t,			// in  - destination buffer row bytes
+	PixFcFlag			// in  - tune the selection of the conversion function
+);
+
+
+/*
+ * Convert 'line_count' lines starting at 'first_line' only, on the calling
+ * thread. 'in' and 'out' point to the start of the whole source and
+ * destination images, as with convert(). This can be used to convert an image
+ * as its lines become available, or to spread the conversion of an image over
+ * the caller's own threads: concurrent calls on the same struct PixFcSSE are
+ * allowed as long as they convert different lines.
+ * 'first_line' and 'line_count' must be multiples of the conversion's height
+ * requirement (1 for all interleaved formats). When downscaling, they are
+ * source lines and must also be multiples of the downscaling factor. The
+ * converted lines are written from line first_line / factor of 'out'.
+ * With create_pixfc_roi(), 'in' is the whole source image and lines are
+ * counted from the top of the window.
+ * Conversions from / to planar formats, and windows which had to be widened
+ * to whole pixel groups, can not be split in bands yet and return
+ * PixFc_UnsupportedConversionError.
+ */
+uint32_t		convert_lines(
+	const struct PixFcSSE*,	// in  - a struct PixFcSSE returned by create_pixfc()
+	void*,					// in  - source image buffer
+	void*,					// out - destination image buffer
+	uint32_t,				// in  - first line to convert
+	uint32_t				// in  - number of lines to convert
+);
+
+
+/*
+ * Convert 'count' images, from in[i] to out[i], with the same struct PixFcSSE.
+ * This is faster than calling convert() for each image when converting many
+ * small images (thumbnails, tiles): the conversion block is looked up once,
+ * and multithreaded conversions (see create_pixfc_mt()) spread whole images
+ * over their threads instead of splitting each image in bands.
+ * Conversions created by create_pixfc_roi() whose window had to be widened
+ * convert the images one after the other on the calling thread.
+ */
+uint32_t		convert_batch(
+	const struct PixFcSSE*,	// in  - a struct PixFcSSE returned by create_pixfc()
+	void**,					// in  - array of 'count' source image buffers
+	void**,					// out - array of 'count' destination image buffers
+	uint32_t				// in  - number of images to convert
+);
+
+
+/*
+ * Set the number of lines ahead of the current one from which the conversion
+ * function prefetches source lines into the cache. Large images read from
+ * memory that is slow to access (another NUMA node for instance) may be
+ * converted faster with a non-zero distance. The best value depends on the
+ * machine and the conversion: time_conversions can sweep a range of
+ * distances to find it. 0 (the default) disables software prefetching.
+ * This must not be called while a conversion is in progress.
+ */
+uint32_t		set_pixfc_prefetch_distance(
+	struct PixFcSSE*,		// in  - a struct PixFcSSE returned by create_pixfc()
+	uint32_t				// in  - prefetch distance, in lines
+);
+
+
+/*
+ * Set the value written to the alpha channel of each pixel by conversions
+ * to ARGB and BGRA, saving a separate pass over the output image when an
+ * opaque image is needed (use 0xFF). The alpha value is set while packing
+ * the pixels, so the conversion speed is unchanged. Conversions between
+ * ARGB and BGRA ignore it and copy the source alpha channel.
+ * The default value is 0.
+ * This must not be called while a conversion is in progress.
+ */
+uint32_t		set_pixfc_alpha(
+	struct PixFcSSE*,		// in  - a struct PixFcSSE returned by create_pixfc()
+	uint8_t					// in  - alpha value
+);
+
+
 /*
  * This function releases the given struct PixFcSSE
  */
@@ -217,6 +459,12 @@ void			destroy_pixfc(struct PixFcSSE*);
  * Error codes
  */
 enum {
+	// The window given to create_pixfc_roi() is invalid.
+	PixFc_InvalidRegionOfInterest = -9,
+
+	// The range of lines given to convert_lines() is invalid.
+	PixFc_InvalidLineRange = -8,
+
 	// The SSE features required are not available on the executing CPU.
 	PixFc_NoCPUSupport = -7,
 
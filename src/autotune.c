@@ -0,0 +1,265 @@
+/*
+ * autotune.c
+ *
+ * Copyright (C) 2011 PixFC Team (pixelfc@gmail.com)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public  License as published by the
+ * Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#include "autotune.h"
+#include "common.h"
+#include "pixfmt_descriptions.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef WIN32
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+// Each candidate converts the synthetic image AUTOTUNE_RUN_COUNT times
+// (after a warm-up conversion), and its fastest run is kept. A run converts
+// the image as many times as needed for the first candidate to take about
+// AUTOTUNE_MIN_RUN_TIME_NS, so small images are timed accurately.
+#define AUTOTUNE_RUN_COUNT				5
+#define AUTOTUNE_MIN_RUN_TIME_NS		1000000ULL
+
+// Alignment of the synthetic image buffers
+#define AUTOTUNE_BUFFER_ALIGNMENT		64
+
+// Name of the cache file in the user's home directory, used unless the
+// PIXFC_AUTOTUNE_CACHE environment variable is set
+#ifdef WIN32
+#define AUTOTUNE_CACHE_HOME_VAR			"LOCALAPPDATA"
+#define AUTOTUNE_CACHE_FILE_NAME		"\\pixfc-sse-autotune"
+#else
+#define AUTOTUNE_CACHE_HOME_VAR			"HOME"
+#define AUTOTUNE_CACHE_FILE_NAME		"/.pixfc-sse-autotune"
+#endif
+
+// Maximum length of a line in the cache file, and of its path
+#define AUTOTUNE_MAX_LINE_LENGTH		(AUTOTUNE_MAX_NAME_LENGTH + 128)
+#define AUTOTUNE_MAX_PATH_LENGTH		1024
+
+
+// Return a monotonic time in nanoseconds
+static uint64_t		get_time_ns() {
+#ifdef WIN32
+	LARGE_INTEGER	counter;
+	LARGE_INTEGER	frequency;
+
+	QueryPerformanceCounter(&counter);
+	QueryPerformanceFrequency(&frequency);
+	return (uint64_t) ((double) counter.QuadPart * 1000000000.0 / (double) frequency.QuadPart);
+#else
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t) ts.tv_sec * 1000000000ULL + (uint64_t) ts.tv_nsec;
+#endif
+}
+
+// Allocate 'size' bytes aligned on AUTOTUNE_BUFFER_ALIGNMENT bytes. The
+// returned pointer must be released with free() on '*allocation'.
+static uint8_t *	allocate_aligned(uint32_t size, void **allocation) {
+	uintptr_t	address;
+
+	*allocation = malloc(size + AUTOTUNE_BUFFER_ALIGNMENT);
+	if (! *allocation)
+		return NULL;
+
+	address = ((uintptr_t) *allocation + AUTOTUNE_BUFFER_ALIGNMENT - 1) & ~((uintptr_t) AUTOTUNE_BUFFER_ALIGNMENT - 1);
+	return (uint8_t *) address;
+}
+
+uint32_t			find_fastest_conversion(const struct PixFcSSE *candidates, uint32_t count) {
+	const struct PixFcSSE *	conv = &candidates[0];
+	uint32_t				factor = PIXFC_DOWNSCALE_FACTOR(conv->flags) ? PIXFC_DOWNSCALE_FACTOR(conv->flags) : 1;
+	uint32_t				in_size = IMG_SIZE(conv->source_fmt, conv->width, conv->height);
+	uint32_t				out_size = IMG_SIZE(conv->dest_fmt, conv->width / factor, conv->height / factor);
+	void *					in_allocation;
+	void *					out_allocation;
+	uint8_t *				in;
+	uint8_t *				out;
+	uint32_t				seed = 0x12345678;
+	uint32_t				index;
+	uint32_t				run;
+	uint32_t				iteration;
+	uint32_t				iteration_count = 1;
+	uint64_t				start;
+	uint64_t				elapsed;
+	uint64_t				candidate_time;
+	uint64_t				fastest_time = ~0ULL;
+	uint32_t				fastest = 0;
+
+	if (count < 2)
+		return 0;
+
+	// Interleaved images may have padding bytes at the end of each line
+	if (in_size < conv->source_row_bytes * conv->height)
+		in_size = conv->source_row_bytes * conv->height;
+	if (out_size < conv->dest_row_bytes * (conv->height / factor))
+		out_size = conv->dest_row_bytes * (conv->height / factor);
+
+	in = allocate_aligned(in_size, &in_allocation);
+	out = allocate_aligned(out_size, &out_allocation);
+	if (! in || ! out) {
+		free(in_allocation);
+		free(out_allocation);
+		return 0;
+	}
+
+	// Fill the source image with pseudo-random bytes
+	for(index = 0; index < in_size; index++) {
+		seed = seed * 1103515245 + 12345;
+		in[index] = (uint8_t) (seed >> 16);
+	}
+
+	// Work out how many conversions make up a run from a warm-up
+	// conversion with the first candidate
+	conv->convert(conv, in, out);
+	start = get_time_ns();
+	conv->convert(conv, in, out);
+	elapsed = get_time_ns() - start;
+	if (elapsed < AUTOTUNE_MIN_RUN_TIME_NS)
+		iteration_count = (uint32_t) (AUTOTUNE_MIN_RUN_TIME_NS / (elapsed + 1)) + 1;
+
+	for(index = 0; index < count; index++) {
+		conv = &candidates[index];
+		conv->convert(conv, in, out);
+
+		candidate_time = ~0ULL;
+		for(run = 0; run < AUTOTUNE_RUN_COUNT; run++) {
+			start = get_time_ns();
+			for(iteration = 0; iteration < iteration_count; iteration++)
+				conv->convert(conv, in, out);
+			elapsed = get_time_ns() - start;
+
+			if (elapsed < candidate_time)
+				candidate_time = elapsed;
+
+			// Do not time candidates much slower than the fastest one again
+			if ((fastest_time != ~0ULL) && (candidate_time > 2 * fastest_time))
+				break;
+		}
+
+		dprint("Autotuning candidate %u: %llu ns\n", index, (long long unsigned int) candidate_time);
+
+		if (candidate_time < fastest_time) {
+			fastest_time = candidate_time;
+			fastest = index;
+		}
+	}
+
+	free(in_allocation);
+	free(out_allocation);
+
+	return fastest;
+}
+
+// Copy the path of the cache file to 'path' (at least 'size' bytes long).
+// Return 0 if OK, -1 if the cache is disabled or the path too long.
+static uint32_t		get_cache_path(char *path, uint32_t size) {
+	const char *	dir = getenv("PIXFC_AUTOTUNE_CACHE");
+	const char *	file_name = "";
+
+	// An empty PIXFC_AUTOTUNE_CACHE disables the cache
+	if (! dir) {
+		dir = getenv(AUTOTUNE_CACHE_HOME_VAR);
+		file_name = AUTOTUNE_CACHE_FILE_NAME;
+	}
+	if (! dir || (*dir == '\0') || (strlen(dir) + strlen(file_name) >= size))
+		return -1;
+
+	strcpy(path, dir);
+	strcat(path, file_name);
+
+	return 0;
+}
+
+// Write the key identifying the conversion of 'conv' requested with 'flags'
+// on this CPU at the start of a cache line to 'key' (at least
+// AUTOTUNE_MAX_LINE_LENGTH bytes long). Multithreading and autotuning do
+// not change the conversion block and are not part of the key.
+static void			get_cache_key(const struct PixFcSSE *conv, uint32_t flags, char *key) {
+	sprintf(key, "%016llx %.24s %.24s %08x %ux%u ", (long long unsigned int) get_cpu_features(),
+			pixfmt_descriptions[conv->source_fmt].name, pixfmt_descriptions[conv->dest_fmt].name,
+			flags & ~(PixFcFlag_MultiThreaded | PixFcFlag_Autotune), conv->width, conv->height);
+}
+
+uint32_t			load_autotuned_block_name(const struct PixFcSSE *conv, uint32_t flags, char *name) {
+	char		path[AUTOTUNE_MAX_PATH_LENGTH];
+	char		key[AUTOTUNE_MAX_LINE_LENGTH];
+	char		line[AUTOTUNE_MAX_LINE_LENGTH];
+	size_t		key_length;
+	size_t		name_length;
+	uint32_t	result = -1;
+	FILE *		file;
+
+	if (get_cache_path(path, sizeof(path)) != 0)
+		return -1;
+
+	file = fopen(path, "r");
+	if (! file)
+		return -1;
+
+	get_cache_key(conv, flags, key);
+	key_length = strlen(key);
+
+	// Keep the last matching line, as a conversion measured again is
+	// appended to the file.
+	while(fgets(line, sizeof(line), file)) {
+		if (strncmp(line, key, key_length) != 0)
+			continue;
+
+		name_length = strcspn(line + key_length, "\r\n");
+		if ((name_length == 0) || (name_length >= AUTOTUNE_MAX_NAME_LENGTH))
+			continue;
+
+		memcpy(name, line + key_length, name_length);
+		name[name_length] = '\0';
+		result = 0;
+	}
+
+	fclose(file);
+
+	return result;
+}
+
+void				save_autotuned_block_name(const struct PixFcSSE *conv, uint32_t flags, const char *name) {
+	char		path[AUTOTUNE_MAX_PATH_LENGTH];
+	char		line[AUTOTUNE_MAX_LINE_LENGTH];
+	FILE *		file;
+
+	if ((get_cache_path(path, sizeof(path)) != 0) || (strlen(name) >= AUTOTUNE_MAX_NAME_LENGTH))
+		return;
+
+	file = fopen(path, "a");
+	if (! file) {
+		dprint("Error opening autotuning cache '%s'\n", path);
+		return;
+	}
+
+	// Write the whole line at once so lines appended by concurrent
+	// processes do not get mixed up.
+	get_cache_key(conv, flags, line);
+	strcat(line, name);
+	strcat(line, "\n");
+	fputs(line, file);
+
+	fclose(file);
+}
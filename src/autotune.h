@@ -0,0 +1,56 @@
+/*
+ * autotune.h
+ *
+ * Copyright (C) 2011 PixFC Team (pixelfc@gmail.com)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public  License as published by the
+ * Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef AUTOTUNE_H_
+#define AUTOTUNE_H_
+
+#include <stdint.h>
+
+#include "pixfc-sse.h"
+
+// Maximum length of a conversion block name in the autotuning cache
+#define AUTOTUNE_MAX_NAME_LENGTH		128
+
+// Maximum number of conversion blocks timed for a conversion
+#define AUTOTUNE_MAX_CANDIDATES			16
+
+/*
+ * Time the conversion of a synthetic image with each of the 'count' struct
+ * PixFcSSE in 'candidates', which must all convert images of the same
+ * formats and size, and return the index of the fastest one. 0 is returned
+ * if the image buffers can not be allocated.
+ */
+uint32_t		find_fastest_conversion(const struct PixFcSSE *candidates, uint32_t count);
+
+/*
+ * Look for the conversion of 'conv' requested with 'flags' in the autotuning
+ * cache file and copy the name of the fastest conversion block measured on
+ * this CPU to 'name' (at least AUTOTUNE_MAX_NAME_LENGTH bytes long).
+ * Return 0 if found, -1 otherwise.
+ */
+uint32_t		load_autotuned_block_name(const struct PixFcSSE *conv, uint32_t flags, char *name);
+
+/*
+ * Append the name of the fastest conversion block measured for the
+ * conversion of 'conv' requested with 'flags' to the autotuning cache file.
+ */
+void			save_autotuned_block_name(const struct PixFcSSE *conv, uint32_t flags, const char *name);
+
+#endif /* AUTOTUNE_H_ */
@@ -22,6 +22,9 @@
 #ifdef WIN32
 	#include <intrin.h>
 #endif
+#if defined(PIXFC_NEON_ROUTINES) && defined(__linux__) && ! defined(__aarch64__)
+	#include <sys/auxv.h>
+#endif
 
 #include "common.h"
 
@@ -393,43 +396,95 @@ uint32_t			does_cpu_support(uint64_t mask) {
 	return ((mask != CPUID_FEATURE_NONE) && ((get_cpu_features() & mask) != mask)) ? -1 : 0;
 }
 
-// Retrieve the features supported by the CPU
-uint64_t		get_cpu_features() {
-	uint32_t	features[4]= {0};	// CPU feature Lo in [3], Hi in [2]
-
 #ifdef __INTEL_CPU__
-	// Return cached value if valid
-	if (cpu_features != 0)
-		return cpu_features;
-
+// Run CPUID for the given leaf and sub-leaf and store eax, ebx, ecx & edx in 'regs'
+static void		cpuid(uint32_t leaf, uint32_t subleaf, uint32_t *regs) {
 #ifdef WIN32
-	__cpuid(features, 1);	// ask for CPU features
+	__cpuidex((int *) regs, leaf, subleaf);
 #else
-	uint32_t 	eax = 1;	// ask for CPU features
-
 	__asm__ __volatile__ (
 			// After a CPUID, eax, ebx, ecx and edx are clobbered.
-			// We only collect the CPU features stored in ecx and edx.
 			// As we may be compiled with -fPIC which uses ebx on
 			// Linux x86, we need to save it before the CPUID and
 			// restore it afterwards.
 #if ! defined(__x86_64__)
-			"pushl %%ebx;\n"
-#endif
+			"movl %%ebx, %%esi;\n"
 			"cpuid;\n"
-#if ! defined(__x86_64__)
-			"popl %%ebx;"
-#endif
-			: "=d" (features[3]), "=c" (features[2])
-			  : "a" (eax)
-#if defined(__x86_64__)
-			    : "%ebx"
+			"xchgl %%ebx, %%esi;\n"
+			: "=a" (regs[0]), "=S" (regs[1]), "=c" (regs[2]), "=d" (regs[3])
+#else
+			"cpuid;\n"
+			: "=a" (regs[0]), "=b" (regs[1]), "=c" (regs[2]), "=d" (regs[3])
 #endif
+			: "a" (leaf), "c" (subleaf)
 	);
 #endif
-	
+}
+
+// Return the register states enabled by the OS (XCR0)
+static uint64_t	get_os_enabled_register_states() {
+#ifdef WIN32
+	return _xgetbv(0);
+#else
+	uint32_t	eax, edx;
+
+	// XGETBV, spelled out for assemblers which do not know it
+	__asm__ __volatile__ (".byte 0x0f, 0x01, 0xd0" : "=a" (eax), "=d" (edx) : "c" (0));
+	return ((uint64_t) edx) << 32 | eax;
+#endif
+}
+#endif	// __INTEL_CPU__
+
+// Retrieve the features supported by the CPU
+uint64_t		get_cpu_features() {
+#ifdef __INTEL_CPU__
+	uint32_t	regs[4] = {0};	// eax, ebx, ecx, edx
+	uint32_t	max_leaf;
+	uint64_t	features;
+
+	// Return cached value if valid
+	if (cpu_features != 0)
+		return cpu_features;
+
+	cpuid(0, 0, regs);	// ask for the highest leaf
+	max_leaf = regs[0];
+
+	cpuid(1, 0, regs);	// ask for CPU features
+	features = (uint64_t) (((uint64_t)regs[2]) << 32 | (uint64_t) regs[3]);
+
+	// AVX2 is usable if the CPU supports it and the OS saves the XMM & YMM
+	// registers (bits 1 & 2 of XCR0), which requires OSXSAVE (ECX bit 27)
+	// and AVX (ECX bit 28).
+	// AVX-512 also requires the OS to save the opmask & ZMM registers
+	// (bits 5, 6 & 7 of XCR0).
+	if (((regs[2] & 0x18000000) == 0x18000000) && (max_leaf >= 7)
+		&& ((get_os_enabled_register_states() & 0x6) == 0x6)) {
+		cpuid(7, 0, regs);	// ask for extended features
+		if (regs[1] & 0x20)	// EBX bit 5
+			features |= CPUID_FEATURE_AVX2;
+
+		// AVX512F (EBX bit 16), AVX512BW (EBX bit 30) & AVX512VBMI (ECX bit 1)
+		if (((regs[1] & 0x40010000) == 0x40010000) && (regs[2] & 0x2)
+			&& ((get_os_enabled_register_states() & 0xE6) == 0xE6))
+			features |= CPUID_FEATURE_AVX512;
+	}
+
 	// Cache value for next time.
-	cpu_features = (uint64_t) (((uint64_t)features[2]) << 32 | (uint64_t)  features[3]);
+	cpu_features = features;
+#elif defined(PIXFC_NEON_ROUTINES)
+	// Return cached value if valid
+	if (cpu_features != 0)
+		return cpu_features;
+
+#if defined(__aarch64__)
+	// NEON is part of the AArch64 baseline
+	cpu_features = CPUID_FEATURE_NEON;
+#elif defined(__linux__)
+	// Not all 32-bit ARM CPUs have NEON (the Raspberry Pi's ARM1176 does not),
+	// ask the kernel (HWCAP_NEON is bit 12 of AT_HWCAP).
+	if (getauxval(AT_HWCAP) & (1 << 12))
+		cpu_features = CPUID_FEATURE_NEON;
+#endif
 #endif	// __INTEL_CPU__
 
 	return cpu_features;
@@ -81,6 +81,36 @@ extern const int32_t      yuv_10bit_to_rgb_10bit_coef_lhs8[][3][3];
 //
 // The variations of the DO_CONVERSION_* macros are there to accept different
 // numbers of pack / unpack routines, as indicated by the _Px_Uy suffix
+//
+// A buffer is only considered aligned if its start address and its row
+// bytes are both multiple of 16, so that every line starts on a 16-byte
+// boundary.
+#define IS_SOURCE_BUFFER_ALIGNED()	(((uintptr_t)source_buffer & 0x0F) == 0 && (pixfc->source_row_bytes & 0x0F) == 0)
+#define IS_DEST_BUFFER_ALIGNED()	(((uintptr_t)dest_buffer & 0x0F) == 0 && (pixfc->dest_row_bytes & 0x0F) == 0)
+
+// When the destination buffer is aligned and PixFcFlag_NonTemporalStores is set,
+// the DO_CONVERSION_* macros use the nt_ pack routines, which write the output
+// with streaming stores, and issue a store fence once the conversion is done.
+#define USE_NON_TEMPORAL_STORES()	((pixfc->flags & PixFcFlag_NonTemporalStores) != 0)
+
+// Outer conversion loops call this macro once per line, with 'line_ptr'
+// pointing to the start of the current line, to prefetch the line located
+// pixfc->prefetch_distance lines further down (nothing is done if
+// the distance is 0). Prefetch instructions never fault, so lines past the
+// end of the buffer do not need to be filtered out.
+#define PREFETCH_CACHE_LINE_SIZE	64
+#define PREFETCH_LINE_AHEAD(line_ptr, row_byte_count)\
+	do {\
+		if (pixfc->prefetch_distance != 0) {\
+			uint8_t *	prefetch_ptr = (uint8_t *)(line_ptr) + pixfc->prefetch_distance * (row_byte_count);\
+			uint8_t *	prefetch_end = prefetch_ptr + (row_byte_count);\
+			while(prefetch_ptr < prefetch_end) {\
+				_mm_prefetch((char *) prefetch_ptr, _MM_HINT_T0);\
+				prefetch_ptr += PREFETCH_CACHE_LINE_SIZE;\
+			}\
+		}\
+	} while(0)
+
 #ifdef WIN32
 
 // Visual Studio's handling of variadic macros is buggy at best.
@@ -113,8 +143,8 @@ extern const int32_t      yuv_10bit_to_rgb_10bit_coef_lhs8[][3][3];
 		uint32_t	line = pixfc->height;\
 		uint8_t		*src = (uint8_t *)source_buffer;\
 		uint8_t		*dst = (uint8_t *)dest_buffer;\
-		uint32_t	src_row_byte_count = ROW_SIZE(pixfc->source_fmt, width);\
-		uint32_t	dst_row_byte_count = ROW_SIZE(pixfc->dest_fmt, width);\
+		uint32_t	src_row_byte_count = pixfc->source_row_bytes;\
+		uint32_t	dst_row_byte_count = pixfc->dest_row_bytes;\
 		uint32_t	pixel;\
 		if ((width % 24) == 0) {\
 			while(line-- > 0) {\
@@ -126,6 +156,7 @@ extern const int32_t      yuv_10bit_to_rgb_10bit_coef_lhs8[][3][3];
 					pixel -= 24;\
 				}\
 				core_last24 LeftParenthesis __VA_ARGS__ RightParenthesis;\
+				PREFETCH_LINE_AHEAD(src, src_row_byte_count);\
 				src += src_row_byte_count;\
 				dst += dst_row_byte_count;\
 			}\
@@ -139,6 +170,7 @@ extern const int32_t      yuv_10bit_to_rgb_10bit_coef_lhs8[][3][3];
 					pixel -= 24;\
 				}\
 				leftover_8 LeftParenthesis __VA_ARGS__ RightParenthesis;\
+				PREFETCH_LINE_AHEAD(src, src_row_byte_count);\
 				src += src_row_byte_count;\
 				dst += dst_row_byte_count;\
 			}\
@@ -152,6 +184,7 @@ extern const int32_t      yuv_10bit_to_rgb_10bit_coef_lhs8[][3][3];
 					pixel -= 24;\
 				}\
 				leftover_16 LeftParenthesis __VA_ARGS__ RightParenthesis;\
+				PREFETCH_LINE_AHEAD(src, src_row_byte_count);\
 				src += src_row_byte_count;\
 				dst += dst_row_byte_count;\
 			}\
@@ -162,13 +195,14 @@ extern const int32_t      yuv_10bit_to_rgb_10bit_coef_lhs8[][3][3];
 		uint32_t	line = pixfc->height;\
 		uint8_t		*src = (uint8_t *)source_buffer;\
 		uint8_t		*dst = (uint8_t *)dest_buffer;\
-		uint32_t	src_row_byte_count = ROW_SIZE(pixfc->source_fmt, width);\
-		uint32_t	dst_row_byte_count = ROW_SIZE(pixfc->dest_fmt, width);\
+		uint32_t	src_row_byte_count = pixfc->source_row_bytes;\
+		uint32_t	dst_row_byte_count = pixfc->dest_row_bytes;\
 		uint32_t	pixel;\
 		if ((width % 24) == 0) {\
 			while(line-- > 0) {\
 				in_ptr = (__m128i *)src;\
 				v210_ptr = (__m128i *)dst;\
+				PREFETCH_LINE_AHEAD(src, src_row_byte_count);\
 				src += src_row_byte_count;\
 				dst += dst_row_byte_count;\
 				pixel = width - 24; /* Handle the first 24 pixels outside the loop*/\
@@ -183,6 +217,7 @@ extern const int32_t      yuv_10bit_to_rgb_10bit_coef_lhs8[][3][3];
 				while(line-- > 0) {\
 					in_ptr = (__m128i *)src;\
 					v210_ptr = (__m128i *)dst;\
+					PREFETCH_LINE_AHEAD(src, src_row_byte_count);\
 					src += src_row_byte_count;\
 					dst += dst_row_byte_count;\
 					first_leftover_8 LeftParenthesis __VA_ARGS__ RightParenthesis;\
@@ -191,6 +226,7 @@ extern const int32_t      yuv_10bit_to_rgb_10bit_coef_lhs8[][3][3];
 				while(line-- > 0) {\
 					in_ptr = (__m128i *)src;\
 					v210_ptr = (__m128i *)dst;\
+					PREFETCH_LINE_AHEAD(src, src_row_byte_count);\
 					src += src_row_byte_count;\
 					dst += dst_row_byte_count;\
 					pixel = width - 24; /* Handle the first 24 pixels outside the loop*/\
@@ -207,6 +243,7 @@ extern const int32_t      yuv_10bit_to_rgb_10bit_coef_lhs8[][3][3];
 				while(line-- > 0) {\
 					in_ptr = (__m128i *)src;\
 					v210_ptr = (__m128i *)dst;\
+					PREFETCH_LINE_AHEAD(src, src_row_byte_count);\
 					src += src_row_byte_count;\
 					dst += dst_row_byte_count;\
 					first_leftover_16 LeftParenthesis __VA_ARGS__ RightParenthesis;\
@@ -216,6 +253,7 @@ extern const int32_t      yuv_10bit_to_rgb_10bit_coef_lhs8[][3][3];
 				while(line-- > 0) {\
 					in_ptr = (__m128i *)src;\
 					v210_ptr = (__m128i *)dst;\
+					PREFETCH_LINE_AHEAD(src, src_row_byte_count);\
 					src += src_row_byte_count;\
 					dst += dst_row_byte_count;\
 					pixel = width - 24; /* Handle the first 24 pixels outside the loop*/\
@@ -251,6 +289,7 @@ extern const int32_t      yuv_10bit_to_rgb_10bit_coef_lhs8[][3][3];
 					pixel -= 48;\
 				}\
 				leftovers LeftParenthesis __VA_ARGS__ RightParenthesis;\
+				PREFETCH_LINE_AHEAD(src, src_row_byte_count);\
 				src += src_row_byte_count;\
 				dst += dst_row_byte_count;\
 				pixel = width;\
@@ -262,8 +301,8 @@ extern const int32_t      yuv_10bit_to_rgb_10bit_coef_lhs8[][3][3];
 		uint32_t	pixel = width;\
 		uint8_t		*src = (uint8_t *)source_buffer;\
 		uint8_t		*dst = (uint8_t *)dest_buffer;\
-		uint32_t	src_row_byte_count = ROW_SIZE(pixfc->source_fmt, width);\
-		uint32_t	dst_row_byte_count = ROW_SIZE(pixfc->dest_fmt, width);\
+		uint32_t	src_row_byte_count = pixfc->source_row_bytes;\
+		uint32_t	dst_row_byte_count = pixfc->dest_row_bytes;\
 		if ((width % 48) == 0) {\
 			FROM_V210_48_PIX_INNER_LOOP LeftParenthesis v210_ptr, out_ptr, core_preamble, core, last_48, __VA_ARGS__ RightParenthesis\
 		} else if ((width % 48) == 8) {\
@@ -278,69 +317,103 @@ extern const int32_t      yuv_10bit_to_rgb_10bit_coef_lhs8[][3][3];
 			FROM_V210_48_PIX_INNER_LOOP LeftParenthesis v210_ptr, out_ptr, core_preamble, core, leftover_40, __VA_ARGS__ RightParenthesis\
 		}
 
-#define TO_V120_48_PIX_OUTER_CONVERSION_LOOP(core_first48, core, first_leftover_16, leftover_16, first_leftover_32, leftover_32, ...)\
+#define TO_V120_48_PIX_OUTER_CONVERSION_LOOP(in_ptr, v210_ptr, core_first48, core, first_leftover_16, leftover_16, first_leftover_32, leftover_32, ...)\
 		uint32_t	width = pixfc->width;\
 		uint32_t	line = pixfc->height;\
 		uint32_t	pixel = width - 48; /* handle the fist 48 pixels outside the loop*/\
+		uint8_t		*src = (uint8_t *)source_buffer;\
+		uint8_t		*dst = (uint8_t *)dest_buffer;\
+		uint32_t	src_row_byte_count = pixfc->source_row_bytes;\
+		uint32_t	dst_row_byte_count = pixfc->dest_row_bytes;\
 		if ((width % 48) == 0) {\
 			while(line-- > 0) {\
+				in_ptr = (__m128i *)src;\
+				v210_ptr = (__m128i *)dst;\
+				PREFETCH_LINE_AHEAD(src, src_row_byte_count);\
+				src += src_row_byte_count;\
+				dst += dst_row_byte_count;\
 				core_first48 LeftParenthesis __VA_ARGS__ RightParenthesis;\
 				while(pixel > 0) {\
 					core LeftParenthesis __VA_ARGS__ RightParenthesis;\
 					pixel -= 48;\
 				}\
-				/* v210_ptr already points to the start of next line */;\
 				pixel = width - 48;\
 			}\
 		} else if ((width % 48) == 16) {\
 			if (width == 16){\
 				while(line-- > 0) {\
+					in_ptr = (__m128i *)src;\
+					v210_ptr = (__m128i *)dst;\
+					PREFETCH_LINE_AHEAD(src, src_row_byte_count);\
+					src += src_row_byte_count;\
+					dst += dst_row_byte_count;\
 					first_leftover_16 LeftParenthesis __VA_ARGS__ RightParenthesis;\
-					/* v210_ptr already points to the start of next line */;\
 					pixel = width - 48;\
 				}\
 			} else {\
 				while(line-- > 0) {\
+					in_ptr = (__m128i *)src;\
+					v210_ptr = (__m128i *)dst;\
+					PREFETCH_LINE_AHEAD(src, src_row_byte_count);\
+					src += src_row_byte_count;\
+					dst += dst_row_byte_count;\
 					core_first48 LeftParenthesis __VA_ARGS__ RightParenthesis;\
 					while(pixel > 48) {\
 						core LeftParenthesis __VA_ARGS__ RightParenthesis;\
 						pixel -= 48;\
 					}\
 					leftover_16 LeftParenthesis __VA_ARGS__ RightParenthesis;\
-					/* v210_ptr already points to the start of next line */;\
 					pixel = width - 48;\
 				}\
 			}\
 		} else { /* width % 48 == 32 */\
 			if (width == 32) {\
 				while(line-- > 0) {\
+					in_ptr = (__m128i *)src;\
+					v210_ptr = (__m128i *)dst;\
+					PREFETCH_LINE_AHEAD(src, src_row_byte_count);\
+					src += src_row_byte_count;\
+					dst += dst_row_byte_count;\
 					first_leftover_32 LeftParenthesis __VA_ARGS__ RightParenthesis;\
-					/* v210_ptr already points to the start of next line */;\
 				}\
 			} else {\
 				while(line-- > 0) {\
+					in_ptr = (__m128i *)src;\
+					v210_ptr = (__m128i *)dst;\
+					PREFETCH_LINE_AHEAD(src, src_row_byte_count);\
+					src += src_row_byte_count;\
+					dst += dst_row_byte_count;\
 					core_first48 LeftParenthesis __VA_ARGS__ RightParenthesis;\
 					while(pixel > 48) {\
 						core LeftParenthesis __VA_ARGS__ RightParenthesis;\
 						pixel -= 48;\
 					}\
 					leftover_32 LeftParenthesis __VA_ARGS__ RightParenthesis;\
-					/* v210_ptr already points to the start of next line */;\
 					pixel = width - 48;\
 				}\
 			}\
 		}
 
 #define DO_CONVERSION_1U_1P(conversion_macro, unpack_fn, pack_fn, ...)\
-	if (((uintptr_t)source_buffer & 0x0F) == 0) {\
-		if (((uintptr_t)dest_buffer & 0x0F) == 0){\
-			conversion_macro LeftParenthesis unpack_fn, pack_fn, __VA_ARGS__ RightParenthesis\
+	if (IS_SOURCE_BUFFER_ALIGNED()) {\
+		if (IS_DEST_BUFFER_ALIGNED()){\
+			if (USE_NON_TEMPORAL_STORES()) {\
+				conversion_macro LeftParenthesis unpack_fn, nt_##pack_fn, __VA_ARGS__ RightParenthesis\
+				_mm_sfence();\
+			} else {\
+				conversion_macro LeftParenthesis unpack_fn, pack_fn, __VA_ARGS__ RightParenthesis\
+			}\
 		} else {\
 			conversion_macro LeftParenthesis unpack_fn, unaligned_##pack_fn, __VA_ARGS__ RightParenthesis\
 		}\
 	} else {\
-		if (((uintptr_t)dest_buffer & 0x0F) == 0){\
-			conversion_macro LeftParenthesis unaligned_##unpack_fn, pack_fn, __VA_ARGS__ RightParenthesis\
+		if (IS_DEST_BUFFER_ALIGNED()){\
+			if (USE_NON_TEMPORAL_STORES()) {\
+				conversion_macro LeftParenthesis unaligned_##unpack_fn, nt_##pack_fn, __VA_ARGS__ RightParenthesis\
+				_mm_sfence();\
+			} else {\
+				conversion_macro LeftParenthesis unaligned_##unpack_fn, pack_fn, __VA_ARGS__ RightParenthesis\
+			}\
 		} else {\
 			conversion_macro LeftParenthesis unaligned_##unpack_fn, unaligned_##pack_fn, __VA_ARGS__ RightParenthesis\
 		}\
@@ -348,44 +421,89 @@ extern const int32_t      yuv_10bit_to_rgb_10bit_coef_lhs8[][3][3];
 
 
 #define DO_CONVERSION_1U_2P(conversion_macro, unpack_fn, pack1_fn, pack2_fn, ...)\
-	if (((uintptr_t)source_buffer & 0x0F) == 0) {\
-		if (((uintptr_t)dest_buffer & 0x0F) == 0){\
-			conversion_macro LeftParenthesis unpack_fn, pack1_fn, pack2_fn, __VA_ARGS__ RightParenthesis\
+	if (IS_SOURCE_BUFFER_ALIGNED()) {\
+		if (IS_DEST_BUFFER_ALIGNED()){\
+			if (USE_NON_TEMPORAL_STORES()) {\
+				conversion_macro LeftParenthesis unpack_fn, nt_##pack1_fn, nt_##pack2_fn, __VA_ARGS__ RightParenthesis\
+				_mm_sfence();\
+			} else {\
+				conversion_macro LeftParenthesis unpack_fn, pack1_fn, pack2_fn, __VA_ARGS__ RightParenthesis\
+			}\
 		} else {\
 			conversion_macro LeftParenthesis unpack_fn, unaligned_##pack1_fn, unaligned_##pack2_fn, __VA_ARGS__ RightParenthesis\
 		}\
 	} else {\
-		if (((uintptr_t)dest_buffer & 0x0F) == 0){\
-			conversion_macro LeftParenthesis unaligned_##unpack_fn, pack1_fn, pack2_fn, __VA_ARGS__ RightParenthesis\
+		if (IS_DEST_BUFFER_ALIGNED()){\
+			if (USE_NON_TEMPORAL_STORES()) {\
+				conversion_macro LeftParenthesis unaligned_##unpack_fn, nt_##pack1_fn, nt_##pack2_fn, __VA_ARGS__ RightParenthesis\
+				_mm_sfence();\
+			} else {\
+				conversion_macro LeftParenthesis unaligned_##unpack_fn, pack1_fn, pack2_fn, __VA_ARGS__ RightParenthesis\
+			}\
 		} else {\
 			conversion_macro LeftParenthesis unaligned_##unpack_fn, unaligned_##pack1_fn, unaligned_##pack2_fn, __VA_ARGS__ RightParenthesis\
 		}\
 	}
 
 #define DO_CONVERSION_3U_1P(conversion_macro, unpack1_fn, unpack2_fn, unpack3_fn, pack_fn, ...)\
-	if (((uintptr_t)source_buffer & 0x0F) == 0) {\
-		if (((uintptr_t)dest_buffer & 0x0F) == 0){\
-			conversion_macro LeftParenthesis unpack1_fn, unpack2_fn, unpack3_fn, pack_fn, __VA_ARGS__ RightParenthesis\
+	if (IS_SOURCE_BUFFER_ALIGNED()) {\
+		if (IS_DEST_BUFFER_ALIGNED()){\
+			if (USE_NON_TEMPORAL_STORES()) {\
+				conversion_macro LeftParenthesis unpack1_fn, unpack2_fn, unpack3_fn, nt_##pack_fn, __VA_ARGS__ RightParenthesis\
+				_mm_sfence();\
+			} else {\
+				conversion_macro LeftParenthesis unpack1_fn, unpack2_fn, unpack3_fn, pack_fn, __VA_ARGS__ RightParenthesis\
+			}\
 		} else {\
 			conversion_macro LeftParenthesis unpack1_fn, unpack2_fn, unpack3_fn, unaligned_##pack_fn, __VA_ARGS__ RightParenthesis\
 		}\
 	} else {\
-		if (((uintptr_t)dest_buffer & 0x0F) == 0){\
-			conversion_macro LeftParenthesis unaligned_##unpack1_fn, unaligned_##unpack2_fn, unaligned_##unpack3_fn, pack_fn, __VA_ARGS__ RightParenthesis\
+		if (IS_DEST_BUFFER_ALIGNED()){\
+			if (USE_NON_TEMPORAL_STORES()) {\
+				conversion_macro LeftParenthesis unaligned_##unpack1_fn, unaligned_##unpack2_fn, unaligned_##unpack3_fn, nt_##pack_fn, __VA_ARGS__ RightParenthesis\
+				_mm_sfence();\
+			} else {\
+				conversion_macro LeftParenthesis unaligned_##unpack1_fn, unaligned_##unpack2_fn, unaligned_##unpack3_fn, pack_fn, __VA_ARGS__ RightParenthesis\
+			}\
 		} else {\
 			conversion_macro LeftParenthesis unaligned_##unpack1_fn, unaligned_##unpack2_fn, unaligned_##unpack3_fn, unaligned_##pack_fn, __VA_ARGS__ RightParenthesis\
 		}\
 	}
 
+#define DO_CONVERSION_2U_1P(conversion_macro, unpack1_fn, unpack2_fn, pack_fn, ...)\
+	if (IS_SOURCE_BUFFER_ALIGNED()) {\
+		if (IS_DEST_BUFFER_ALIGNED()){\
+			if (USE_NON_TEMPORAL_STORES()) {\
+				conversion_macro LeftParenthesis unpack1_fn, unpack2_fn, nt_##pack_fn, __VA_ARGS__ RightParenthesis\
+				_mm_sfence();\
+			} else {\
+				conversion_macro LeftParenthesis unpack1_fn, unpack2_fn, pack_fn, __VA_ARGS__ RightParenthesis\
+			}\
+		} else {\
+			conversion_macro LeftParenthesis unpack1_fn, unpack2_fn, unaligned_##pack_fn, __VA_ARGS__ RightParenthesis\
+		}\
+	} else {\
+		if (IS_DEST_BUFFER_ALIGNED()){\
+			if (USE_NON_TEMPORAL_STORES()) {\
+				conversion_macro LeftParenthesis unaligned_##unpack1_fn, unaligned_##unpack2_fn, nt_##pack_fn, __VA_ARGS__ RightParenthesis\
+				_mm_sfence();\
+			} else {\
+				conversion_macro LeftParenthesis unaligned_##unpack1_fn, unaligned_##unpack2_fn, pack_fn, __VA_ARGS__ RightParenthesis\
+			}\
+		} else {\
+			conversion_macro LeftParenthesis unaligned_##unpack1_fn, unaligned_##unpack2_fn, unaligned_##pack_fn, __VA_ARGS__ RightParenthesis\
+		}\
+	}
+
 #define DO_REPACK(repack_macro, repack_fn_suffix, ...) \
-	if (((uintptr_t)source_buffer & 0x0F) == 0) {\
-		if (((uintptr_t)dest_buffer & 0x0F) == 0){\
+	if (IS_SOURCE_BUFFER_ALIGNED()) {\
+		if (IS_DEST_BUFFER_ALIGNED()){\
 			repack_macro LeftParenthesis repack_fn_suffix, __VA_ARGS__ RightParenthesis\
 		} else {\
 			repack_macro LeftParenthesis unaligned_dst_##repack_fn_suffix, __VA_ARGS__ RightParenthesis\
 		}\
 	} else {\
-		if (((uintptr_t)dest_buffer & 0x0F) == 0){\
+		if (IS_DEST_BUFFER_ALIGNED()){\
 			repack_macro LeftParenthesis unaligned_src_##repack_fn_suffix, __VA_ARGS__ RightParenthesis\
 		} else {\
 			repack_macro LeftParenthesis unaligned_src_unaligned_dst_##repack_fn_suffix, __VA_ARGS__ RightParenthesis\
@@ -393,14 +511,14 @@ extern const int32_t      yuv_10bit_to_rgb_10bit_coef_lhs8[][3][3];
 	}
 
 #define DO_REPACK2(repack_macro, unpack_fn_prefix, pack_fn, ...) \
-	if (((uintptr_t)source_buffer & 0x0F) == 0) {\
-		if (((uintptr_t)dest_buffer & 0x0F) == 0){\
+	if (IS_SOURCE_BUFFER_ALIGNED()) {\
+		if (IS_DEST_BUFFER_ALIGNED()){\
 			repack_macro LeftParenthesis unpack_fn_prefix, pack_fn, ##__VA_ARGS__ RightParenthesis\
 		} else {\
 			repack_macro LeftParenthesis unpack_fn_prefix, unaligned_##pack_fn, ##__VA_ARGS__ RightParenthesis\
 		}\
 	} else {\
-		if (((uintptr_t)dest_buffer & 0x0F) == 0){\
+		if (IS_DEST_BUFFER_ALIGNED()){\
 			repack_macro LeftParenthesis unaligned_##unpack_fn_prefix, pack_fn, ##__VA_ARGS__ RightParenthesis\
 		} else {\
 			repack_macro LeftParenthesis unaligned_##unpack_fn_prefix, unaligned_##pack_fn, ##__VA_ARGS__ RightParenthesis\
@@ -433,8 +551,8 @@ extern const int32_t      yuv_10bit_to_rgb_10bit_coef_lhs8[][3][3];
 		uint32_t	line = pixfc->height;\
 		uint8_t		*src = (uint8_t *)source_buffer;\
 		uint8_t		*dst = (uint8_t *)dest_buffer;\
-		uint32_t	src_row_byte_count = ROW_SIZE(pixfc->source_fmt, width);\
-		uint32_t	dst_row_byte_count = ROW_SIZE(pixfc->dest_fmt, width);\
+		uint32_t	src_row_byte_count = pixfc->source_row_bytes;\
+		uint32_t	dst_row_byte_count = pixfc->dest_row_bytes;\
 		uint32_t	pixel;\
 		if ((width % 24) == 0) {\
 			while(line-- > 0) {\
@@ -446,6 +564,7 @@ extern const int32_t      yuv_10bit_to_rgb_10bit_coef_lhs8[][3][3];
 					pixel -= 24;\
 				}\
 				core_last24(__VA_ARGS__);\
+				PREFETCH_LINE_AHEAD(src, src_row_byte_count);\
 				src += src_row_byte_count;\
 				dst += dst_row_byte_count;\
 			}\
@@ -459,6 +578,7 @@ extern const int32_t      yuv_10bit_to_rgb_10bit_coef_lhs8[][3][3];
 					pixel -= 24;\
 				}\
 				leftover_8(__VA_ARGS__);\
+				PREFETCH_LINE_AHEAD(src, src_row_byte_count);\
 				src += src_row_byte_count;\
 				dst += dst_row_byte_count;\
 			}\
@@ -472,6 +592,7 @@ extern const int32_t      yuv_10bit_to_rgb_10bit_coef_lhs8[][3][3];
 					pixel -= 24;\
 				}\
 				leftover_16(__VA_ARGS__);\
+				PREFETCH_LINE_AHEAD(src, src_row_byte_count);\
 				src += src_row_byte_count;\
 				dst += dst_row_byte_count;\
 			}\
@@ -482,13 +603,14 @@ extern const int32_t      yuv_10bit_to_rgb_10bit_coef_lhs8[][3][3];
 		uint32_t	line = pixfc->height;\
 		uint8_t		*src = (uint8_t *)source_buffer;\
 		uint8_t		*dst = (uint8_t *)dest_buffer;\
-		uint32_t	src_row_byte_count = ROW_SIZE(pixfc->source_fmt, width);\
-		uint32_t	dst_row_byte_count = ROW_SIZE(pixfc->dest_fmt, width);\
+		uint32_t	src_row_byte_count = pixfc->source_row_bytes;\
+		uint32_t	dst_row_byte_count = pixfc->dest_row_bytes;\
 		uint32_t	pixel;\
 		if ((width % 24) == 0) {\
 			while(line-- > 0) {\
 				in_ptr = (__m128i *)src;\
 				v210_ptr = (__m128i *)dst;\
+				PREFETCH_LINE_AHEAD(src, src_row_byte_count);\
 				src += src_row_byte_count;\
 				dst += dst_row_byte_count;\
 				pixel = width - 24; /* Handle the first 24 pixels outside the loop*/\
@@ -503,6 +625,7 @@ extern const int32_t      yuv_10bit_to_rgb_10bit_coef_lhs8[][3][3];
 				while(line-- > 0) {\
 					in_ptr = (__m128i *)src;\
 					v210_ptr = (__m128i *)dst;\
+					PREFETCH_LINE_AHEAD(src, src_row_byte_count);\
 					src += src_row_byte_count;\
 					dst += dst_row_byte_count;\
 					first_leftover_8(__VA_ARGS__);\
@@ -511,6 +634,7 @@ extern const int32_t      yuv_10bit_to_rgb_10bit_coef_lhs8[][3][3];
 				while(line-- > 0) {\
 					in_ptr = (__m128i *)src;\
 					v210_ptr = (__m128i *)dst;\
+					PREFETCH_LINE_AHEAD(src, src_row_byte_count);\
 					src += src_row_byte_count;\
 					dst += dst_row_byte_count;\
 					pixel = width - 24; /* Handle the first 24 pixels outside the loop*/\
@@ -527,6 +651,7 @@ extern const int32_t      yuv_10bit_to_rgb_10bit_coef_lhs8[][3][3];
 				while(line-- > 0) {\
 					in_ptr = (__m128i *)src;\
 					v210_ptr = (__m128i *)dst;\
+					PREFETCH_LINE_AHEAD(src, src_row_byte_count);\
 					src += src_row_byte_count;\
 					dst += dst_row_byte_count;\
 					first_leftover_16(__VA_ARGS__);\
@@ -536,6 +661,7 @@ extern const int32_t      yuv_10bit_to_rgb_10bit_coef_lhs8[][3][3];
 				while(line-- > 0) {\
 					in_ptr = (__m128i *)src;\
 					v210_ptr = (__m128i *)dst;\
+					PREFETCH_LINE_AHEAD(src, src_row_byte_count);\
 					src += src_row_byte_count;\
 					dst += dst_row_byte_count;\
 					pixel = width - 24; /* Handle the first 24 pixels outside the loop*/\
@@ -571,6 +697,7 @@ extern const int32_t      yuv_10bit_to_rgb_10bit_coef_lhs8[][3][3];
 					pixel -= 48;\
 				}\
 				leftovers(__VA_ARGS__);\
+				PREFETCH_LINE_AHEAD(src, src_row_byte_count);\
 				src += src_row_byte_count;\
 				dst += dst_row_byte_count;\
 				pixel = width;\
@@ -582,8 +709,8 @@ extern const int32_t      yuv_10bit_to_rgb_10bit_coef_lhs8[][3][3];
 		uint32_t	pixel = width;\
 		uint8_t		*src = (uint8_t *)source_buffer;\
 		uint8_t		*dst = (uint8_t *)dest_buffer;\
-		uint32_t	src_row_byte_count = ROW_SIZE(pixfc->source_fmt, width);\
-		uint32_t	dst_row_byte_count = ROW_SIZE(pixfc->dest_fmt, width);\
+		uint32_t	src_row_byte_count = pixfc->source_row_bytes;\
+		uint32_t	dst_row_byte_count = pixfc->dest_row_bytes;\
 		if ((width % 48) == 0) {\
 			FROM_V210_48_PIX_INNER_LOOP(v210_ptr, out_ptr, core_preamble, core, last_48, __VA_ARGS__)\
 		} else if ((width % 48) == 8) {\
@@ -598,113 +725,192 @@ extern const int32_t      yuv_10bit_to_rgb_10bit_coef_lhs8[][3][3];
 			FROM_V210_48_PIX_INNER_LOOP(v210_ptr, out_ptr, core_preamble, core, leftover_40, __VA_ARGS__)\
 		}
 
-#define TO_V120_48_PIX_OUTER_CONVERSION_LOOP(core_first48, core, first_leftover_16, leftover_16, first_leftover_32, leftover_32, ...)\
+#define TO_V120_48_PIX_OUTER_CONVERSION_LOOP(in_ptr, v210_ptr, core_first48, core, first_leftover_16, leftover_16, first_leftover_32, leftover_32, ...)\
 		uint32_t	width = pixfc->width;\
 		uint32_t	line = pixfc->height;\
 		uint32_t	pixel = width - 48; /* handle the fist 48 pixels outside the loop*/\
+		uint8_t		*src = (uint8_t *)source_buffer;\
+		uint8_t		*dst = (uint8_t *)dest_buffer;\
+		uint32_t	src_row_byte_count = pixfc->source_row_bytes;\
+		uint32_t	dst_row_byte_count = pixfc->dest_row_bytes;\
 		if ((width % 48) == 0) {\
 			while(line-- > 0) {\
+				in_ptr = (__m128i *)src;\
+				v210_ptr = (__m128i *)dst;\
+				PREFETCH_LINE_AHEAD(src, src_row_byte_count);\
+				src += src_row_byte_count;\
+				dst += dst_row_byte_count;\
 				core_first48(__VA_ARGS__);\
 				while(pixel > 0) {\
 					core(__VA_ARGS__);\
 					pixel -= 48;\
 				}\
-				/* v210_ptr already points to the start of next line */;\
 				pixel = width - 48;\
 			}\
 		} else if ((width % 48) == 16) {\
 			if (width == 16){\
 				while(line-- > 0) {\
+					in_ptr = (__m128i *)src;\
+					v210_ptr = (__m128i *)dst;\
+					PREFETCH_LINE_AHEAD(src, src_row_byte_count);\
+					src += src_row_byte_count;\
+					dst += dst_row_byte_count;\
 					first_leftover_16(__VA_ARGS__);\
-					/* v210_ptr already points to the start of next line */;\
 					pixel = width - 48;\
 				}\
 			} else {\
 				while(line-- > 0) {\
+					in_ptr = (__m128i *)src;\
+					v210_ptr = (__m128i *)dst;\
+					PREFETCH_LINE_AHEAD(src, src_row_byte_count);\
+					src += src_row_byte_count;\
+					dst += dst_row_byte_count;\
 					core_first48(__VA_ARGS__);\
 					while(pixel > 48) {\
 						core(__VA_ARGS__);\
 						pixel -= 48;\
 					}\
 					leftover_16(__VA_ARGS__);\
-					/* v210_ptr already points to the start of next line */;\
 					pixel = width - 48;\
 				}\
 			}\
 		} else { /* width % 48 == 32 */\
 			if (width == 32) {\
 				while(line-- > 0) {\
+					in_ptr = (__m128i *)src;\
+					v210_ptr = (__m128i *)dst;\
+					PREFETCH_LINE_AHEAD(src, src_row_byte_count);\
+					src += src_row_byte_count;\
+					dst += dst_row_byte_count;\
 					first_leftover_32(__VA_ARGS__);\
-					/* v210_ptr already points to the start of next line */;\
 				}\
 			} else {\
 				while(line-- > 0) {\
+					in_ptr = (__m128i *)src;\
+					v210_ptr = (__m128i *)dst;\
+					PREFETCH_LINE_AHEAD(src, src_row_byte_count);\
+					src += src_row_byte_count;\
+					dst += dst_row_byte_count;\
 					core_first48(__VA_ARGS__);\
 					while(pixel > 48) {\
 						core(__VA_ARGS__);\
 						pixel -= 48;\
 					}\
 					leftover_32(__VA_ARGS__);\
-					/* v210_ptr already points to the start of next line */;\
 					pixel = width - 48;\
 				}\
 			}\
 		}
 
 #define DO_CONVERSION_1U_1P(conversion_macro, unpack_fn, pack_fn, ...)\
-	if (((uintptr_t)source_buffer & 0x0F) == 0) {\
-		if (((uintptr_t)dest_buffer & 0x0F) == 0){\
-			conversion_macro(unpack_fn, pack_fn, __VA_ARGS__)\
+	if (IS_SOURCE_BUFFER_ALIGNED()) {\
+		if (IS_DEST_BUFFER_ALIGNED()){\
+			if (USE_NON_TEMPORAL_STORES()) {\
+				conversion_macro(unpack_fn, nt_##pack_fn, __VA_ARGS__)\
+				_mm_sfence();\
+			} else {\
+				conversion_macro(unpack_fn, pack_fn, __VA_ARGS__)\
+			}\
 		} else {\
 			conversion_macro(unpack_fn, unaligned_##pack_fn, __VA_ARGS__)\
 		}\
 	} else {\
-		if (((uintptr_t)dest_buffer & 0x0F) == 0){\
-			conversion_macro(unaligned_##unpack_fn, pack_fn, __VA_ARGS__)\
+		if (IS_DEST_BUFFER_ALIGNED()){\
+			if (USE_NON_TEMPORAL_STORES()) {\
+				conversion_macro(unaligned_##unpack_fn, nt_##pack_fn, __VA_ARGS__)\
+				_mm_sfence();\
+			} else {\
+				conversion_macro(unaligned_##unpack_fn, pack_fn, __VA_ARGS__)\
+			}\
 		} else {\
 			conversion_macro(unaligned_##unpack_fn, unaligned_##pack_fn, __VA_ARGS__)\
 		}\
 	}
 
 #define DO_CONVERSION_1U_2P(conversion_macro, unpack_fn, pack1_fn, pack2_fn, ...)\
-	if (((uintptr_t)source_buffer & 0x0F) == 0) {\
-		if (((uintptr_t)dest_buffer & 0x0F) == 0){\
-			conversion_macro(unpack_fn, pack1_fn, pack2_fn, __VA_ARGS__)\
+	if (IS_SOURCE_BUFFER_ALIGNED()) {\
+		if (IS_DEST_BUFFER_ALIGNED()){\
+			if (USE_NON_TEMPORAL_STORES()) {\
+				conversion_macro(unpack_fn, nt_##pack1_fn, nt_##pack2_fn, __VA_ARGS__)\
+				_mm_sfence();\
+			} else {\
+				conversion_macro(unpack_fn, pack1_fn, pack2_fn, __VA_ARGS__)\
+			}\
 		} else {\
 			conversion_macro(unpack_fn, unaligned_##pack1_fn, unaligned_##pack2_fn, __VA_ARGS__)\
 		}\
 	} else {\
-		if (((uintptr_t)dest_buffer & 0x0F) == 0){\
-			conversion_macro(unaligned_##unpack_fn, pack1_fn, pack2_fn, __VA_ARGS__)\
+		if (IS_DEST_BUFFER_ALIGNED()){\
+			if (USE_NON_TEMPORAL_STORES()) {\
+				conversion_macro(unaligned_##unpack_fn, nt_##pack1_fn, nt_##pack2_fn, __VA_ARGS__)\
+				_mm_sfence();\
+			} else {\
+				conversion_macro(unaligned_##unpack_fn, pack1_fn, pack2_fn, __VA_ARGS__)\
+			}\
 		} else {\
 			conversion_macro(unaligned_##unpack_fn, unaligned_##pack1_fn, unaligned_##pack2_fn, __VA_ARGS__)\
 		}\
 	}
 
 #define DO_CONVERSION_3U_1P(conversion_macro, unpack1_fn, unpack2_fn, unpack3_fn, pack_fn, ...)\
-	if (((uintptr_t)source_buffer & 0x0F) == 0) {\
-		if (((uintptr_t)dest_buffer & 0x0F) == 0){\
-			conversion_macro(unpack1_fn, unpack2_fn, unpack3_fn, pack_fn, __VA_ARGS__)\
+	if (IS_SOURCE_BUFFER_ALIGNED()) {\
+		if (IS_DEST_BUFFER_ALIGNED()){\
+			if (USE_NON_TEMPORAL_STORES()) {\
+				conversion_macro(unpack1_fn, unpack2_fn, unpack3_fn, nt_##pack_fn, __VA_ARGS__)\
+				_mm_sfence();\
+			} else {\
+				conversion_macro(unpack1_fn, unpack2_fn, unpack3_fn, pack_fn, __VA_ARGS__)\
+			}\
 		} else {\
 			conversion_macro(unpack1_fn, unpack2_fn, unpack3_fn, unaligned_##pack_fn, __VA_ARGS__)\
 		}\
 	} else {\
-		if (((uintptr_t)dest_buffer & 0x0F) == 0){\
-			conversion_macro(unaligned_##unpack1_fn, unaligned_##unpack2_fn, unaligned_##unpack3_fn, pack_fn, __VA_ARGS__)\
+		if (IS_DEST_BUFFER_ALIGNED()){\
+			if (USE_NON_TEMPORAL_STORES()) {\
+				conversion_macro(unaligned_##unpack1_fn, unaligned_##unpack2_fn, unaligned_##unpack3_fn, nt_##pack_fn, __VA_ARGS__)\
+				_mm_sfence();\
+			} else {\
+				conversion_macro(unaligned_##unpack1_fn, unaligned_##unpack2_fn, unaligned_##unpack3_fn, pack_fn, __VA_ARGS__)\
+			}\
 		} else {\
 			conversion_macro(unaligned_##unpack1_fn, unaligned_##unpack2_fn, unaligned_##unpack3_fn, unaligned_##pack_fn, __VA_ARGS__)\
 		}\
 	}
 
+#define DO_CONVERSION_2U_1P(conversion_macro, unpack1_fn, unpack2_fn, pack_fn, ...)\
+	if (IS_SOURCE_BUFFER_ALIGNED()) {\
+		if (IS_DEST_BUFFER_ALIGNED()){\
+			if (USE_NON_TEMPORAL_STORES()) {\
+				conversion_macro(unpack1_fn, unpack2_fn, nt_##pack_fn, __VA_ARGS__)\
+				_mm_sfence();\
+			} else {\
+				conversion_macro(unpack1_fn, unpack2_fn, pack_fn, __VA_ARGS__)\
+			}\
+		} else {\
+			conversion_macro(unpack1_fn, unpack2_fn, unaligned_##pack_fn, __VA_ARGS__)\
+		}\
+	} else {\
+		if (IS_DEST_BUFFER_ALIGNED()){\
+			if (USE_NON_TEMPORAL_STORES()) {\
+				conversion_macro(unaligned_##unpack1_fn, unaligned_##unpack2_fn, nt_##pack_fn, __VA_ARGS__)\
+				_mm_sfence();\
+			} else {\
+				conversion_macro(unaligned_##unpack1_fn, unaligned_##unpack2_fn, pack_fn, __VA_ARGS__)\
+			}\
+		} else {\
+			conversion_macro(unaligned_##unpack1_fn, unaligned_##unpack2_fn, unaligned_##pack_fn, __VA_ARGS__)\
+		}\
+	}
+
 #define DO_REPACK(repack_macro, repack_fn_suffix, ...) \
-	if (((uintptr_t)source_buffer & 0x0F) == 0) {\
-		if (((uintptr_t)dest_buffer & 0x0F) == 0){\
+	if (IS_SOURCE_BUFFER_ALIGNED()) {\
+		if (IS_DEST_BUFFER_ALIGNED()){\
 			repack_macro(repack_fn_suffix, __VA_ARGS__)\
 		} else {\
 			repack_macro(unaligned_dst_##repack_fn_suffix, __VA_ARGS__)\
 		}\
 	} else {\
-		if (((uintptr_t)dest_buffer & 0x0F) == 0){\
+		if (IS_DEST_BUFFER_ALIGNED()){\
 			repack_macro(unaligned_src_##repack_fn_suffix, __VA_ARGS__)\
 		} else {\
 			repack_macro(unaligned_src_unaligned_dst_##repack_fn_suffix, __VA_ARGS__)\
@@ -712,14 +918,14 @@ extern const int32_t      yuv_10bit_to_rgb_10bit_coef_lhs8[][3][3];
 	}
 
 #define DO_REPACK2(repack_macro, unpack_fn_prefix, pack_fn, ...) \
-	if (((uintptr_t)source_buffer & 0x0F) == 0) {\
-		if (((uintptr_t)dest_buffer & 0x0F) == 0){\
+	if (IS_SOURCE_BUFFER_ALIGNED()) {\
+		if (IS_DEST_BUFFER_ALIGNED()){\
 			repack_macro(unpack_fn_prefix, pack_fn, ##__VA_ARGS__)\
 		} else {\
 			repack_macro(unpack_fn_prefix, unaligned_##pack_fn, ##__VA_ARGS__)\
 		}\
 	} else {\
-		if (((uintptr_t)dest_buffer & 0x0F) == 0){\
+		if (IS_DEST_BUFFER_ALIGNED()){\
 			repack_macro(unaligned_##unpack_fn_prefix, pack_fn, ##__VA_ARGS__)\
 		} else {\
 			repack_macro(unaligned_##unpack_fn_prefix, unaligned_##pack_fn, ##__VA_ARGS__)\
@@ -749,6 +955,7 @@ extern const int32_t      yuv_10bit_to_rgb_10bit_coef_lhs8[][3][3];
 #define DO_CONVERSION_1U_1P(conversion_macro, unpack_fn, pack_fn, ...)
 #define DO_CONVERSION_1U_2P(conversion_macro, unpack_fn, pack1_fn, pack2_fn, ...)
 #define DO_CONVERSION_3U_1P(conversion_macro, unpack1_fn, unpack2_fn, unpack3_fn, pack_fn, ...)
+#define DO_CONVERSION_2U_1P(conversion_macro, unpack1_fn, unpack2_fn, pack_fn, ...)
 #define DO_REPACK(repack_macro, repack_fn_suffix, ...) 
 #define DO_REPACK2(...)
 
@@ -759,17 +966,67 @@ extern const int32_t      yuv_10bit_to_rgb_10bit_coef_lhs8[][3][3];
 #define EMPTY(...)
 
 
+/*
+ * Non-SSE conversion routines are written once for all the source and
+ * destination formats they handle, and test the formats for every pixel.
+ * Such a routine is written as a FORCE_INLINE function taking the formats
+ * as extra arguments, and its entry point uses the macros below to call it
+ * once for each supported pair of formats. Each call passes the formats as
+ * constants, so the compiler generates one routine per pair of formats, in
+ * which the per-pixel format tests are folded away.
+ */
+// Call impl_fn() and return if the conversion is from 'src' to 'dst'
+#define CALL_FOR_FORMATS(impl_fn, conv, in, out, src, dst)\
+		if (((conv)->source_fmt == (src)) && ((conv)->dest_fmt == (dst))) {\
+			impl_fn(conv, in, out, src, dst);\
+			return;\
+		}
+
+// Same as above for each 8-bit / 10-bit RGB destination format
+#define CALL_FOR_8BIT_RGB_DEST_FORMATS(impl_fn, conv, in, out, src)\
+		CALL_FOR_FORMATS(impl_fn, conv, in, out, src, PixFcARGB)\
+		CALL_FOR_FORMATS(impl_fn, conv, in, out, src, PixFcBGRA)\
+		CALL_FOR_FORMATS(impl_fn, conv, in, out, src, PixFcRGB24)\
+		CALL_FOR_FORMATS(impl_fn, conv, in, out, src, PixFcBGR24)
+
+#define CALL_FOR_10BIT_RGB_DEST_FORMATS(impl_fn, conv, in, out, src)\
+		CALL_FOR_FORMATS(impl_fn, conv, in, out, src, PixFcR210)\
+		CALL_FOR_FORMATS(impl_fn, conv, in, out, src, PixFcR10k)
+
+// Same as above for each 8-bit / 10-bit RGB source format
+#define CALL_FOR_8BIT_RGB_SRC_FORMATS(impl_fn, conv, in, out, dst)\
+		CALL_FOR_FORMATS(impl_fn, conv, in, out, PixFcARGB, dst)\
+		CALL_FOR_FORMATS(impl_fn, conv, in, out, PixFcBGRA, dst)\
+		CALL_FOR_FORMATS(impl_fn, conv, in, out, PixFcRGB24, dst)\
+		CALL_FOR_FORMATS(impl_fn, conv, in, out, PixFcBGR24, dst)
+
+#define CALL_FOR_10BIT_RGB_SRC_FORMATS(impl_fn, conv, in, out, dst)\
+		CALL_FOR_FORMATS(impl_fn, conv, in, out, PixFcR210, dst)\
+		CALL_FOR_FORMATS(impl_fn, conv, in, out, PixFcR10k, dst)
+
+
 /*
  * This function returns the features supported by the cpu
  * as returned by the CPUID instructions. (ECX is in the higher
  * 32 bits, EDX in the lowest ones). Use the following macros to
  * determine which features are supported.
+ * Features reported by other CPUID leaves are stored in bits which are
+ * reserved in leaf 1 EDX:
+ * - CPUID_FEATURE_AVX2 is set if leaf 7 reports AVX2 and the OS saves
+ *   the YMM registers on context switches (OSXSAVE & XGETBV).
+ * - CPUID_FEATURE_AVX512 is set if leaf 7 reports AVX512F, AVX512BW and
+ *   AVX512VBMI, and the OS also saves the opmask & ZMM registers.
+ * On ARM CPUs, only CPUID_FEATURE_NEON (a bit reserved in leaf 1 ECX) can
+ * be set, if the CPU supports NEON and the NEON routines were built.
  */
 uint64_t		get_cpu_features();
 #define CPUID_FEATURE_SSE2	0x0000000004000000LL
 #define CPUID_FEATURE_SSE3	0x0000000100000000LL
 #define CPUID_FEATURE_SSSE3	0x0000020000000000LL
 #define CPUID_FEATURE_SSE41	0x0008000000000000LL
+#define CPUID_FEATURE_AVX2	0x0000000000000400LL	// leaf 1 EDX bit 10 (reserved)
+#define CPUID_FEATURE_AVX512	0x0000000000100000LL	// leaf 1 EDX bit 20 (reserved)
+#define CPUID_FEATURE_NEON	0x0001000000000000LL	// leaf 1 ECX bit 16 (reserved)
 #define CPUID_FEATURE_NONE	0xFFFFFFFFFFFFFFFFLL	// matches all CPUs
 
 /*
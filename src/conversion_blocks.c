@@ -25,6 +25,8 @@
 #include "conversion_routines_from_yuyv.h"
 #include "conversion_routines_from_uyvy.h"
 #include "conversion_routines_from_yuv420p.h"
+#include "conversion_routines_from_nv12.h"
+#include "conversion_routines_from_p210.h"
 #include "conversion_routines_from_yuv422p.h"
 #include "conversion_routines_from_argb.h"
 #include "conversion_routines_from_bgra.h"
@@ -125,6 +127,112 @@ DECLARE_CONV_BLOCK(bt601_convert_fn_prefix##_sse2_ssse3_sse41, 	src_fmt, dst_fmt
 #define		DECLARE_AVG_BT709_SSE2_SSSE3_SSE41_CONV_BLOCK(bt709_convert_fn_prefix, src_fmt, dst_fmt, width_mult_count, height_mult_count, desc_str_prefix)\
 DECLARE_CONV_BLOCK(bt709_convert_fn_prefix##_sse2_ssse3_sse41, 	src_fmt, dst_fmt, 		CPUID_FEATURE_SSE2 | CPUID_FEATURE_SSSE3 | CPUID_FEATURE_SSE41, 	BT709_CONVERSION,  width_mult_count, height_mult_count, desc_str_prefix " - bt.709 - SSE2/SSSE3/SSE41 - avg resampling")
 
+//
+
+// NNB resampling AVX2 {FR, bt.601, bt.709) macros
+#define		DECLARE_NNB_AVX2_CONV_BLOCK(convert_fn_prefix, src_fmt, dst_fmt, width_mult_count, height_mult_count, desc_str_prefix)\
+DECLARE_CONV_BLOCK(convert_fn_prefix##_avx2, 				src_fmt, dst_fmt, 		CPUID_FEATURE_AVX2, 		NNB_RESAMPLING, width_mult_count, height_mult_count, desc_str_prefix " - FR - AVX2 - fast resampling")
+#define		DECLARE_NNB_BT601_AVX2_CONV_BLOCK(bt601_convert_fn_prefix, src_fmt, dst_fmt, width_mult_count, height_mult_count, desc_str_prefix)\
+DECLARE_CONV_BLOCK(bt601_convert_fn_prefix##_avx2, 			src_fmt, dst_fmt, 		CPUID_FEATURE_AVX2, 		BT601_CONVERSION | NNB_RESAMPLING, width_mult_count, height_mult_count, desc_str_prefix " - bt.601 - AVX2 - fast resampling")
+#define		DECLARE_NNB_BT709_AVX2_CONV_BLOCK(bt709_convert_fn_prefix, src_fmt, dst_fmt, width_mult_count, height_mult_count, desc_str_prefix)\
+DECLARE_CONV_BLOCK(bt709_convert_fn_prefix##_avx2, 			src_fmt, dst_fmt, 		CPUID_FEATURE_AVX2, 		BT709_CONVERSION | NNB_RESAMPLING, width_mult_count, height_mult_count, desc_str_prefix " - bt.709 - AVX2 - fast resampling")
+
+// AVG resampling AVX2 {FR, bt.601, bt.709) macros
+#define		DECLARE_AVG_AVX2_CONV_BLOCK(convert_fn_prefix, src_fmt, dst_fmt, width_mult_count, height_mult_count, desc_str_prefix)\
+DECLARE_CONV_BLOCK(convert_fn_prefix##_avx2, 				src_fmt, dst_fmt, 		CPUID_FEATURE_AVX2, 		DEFAULT_ATTRIBUTE, width_mult_count, height_mult_count, desc_str_prefix " - FR - AVX2 - avg resampling")
+#define		DECLARE_AVG_BT601_AVX2_CONV_BLOCK(bt601_convert_fn_prefix, src_fmt, dst_fmt, width_mult_count, height_mult_count, desc_str_prefix)\
+DECLARE_CONV_BLOCK(bt601_convert_fn_prefix##_avx2, 			src_fmt, dst_fmt, 		CPUID_FEATURE_AVX2, 		BT601_CONVERSION, width_mult_count, height_mult_count, desc_str_prefix " - bt.601 - AVX2 - avg resampling")
+#define		DECLARE_AVG_BT709_AVX2_CONV_BLOCK(bt709_convert_fn_prefix, src_fmt, dst_fmt, width_mult_count, height_mult_count, desc_str_prefix)\
+DECLARE_CONV_BLOCK(bt709_convert_fn_prefix##_avx2, 			src_fmt, dst_fmt, 		CPUID_FEATURE_AVX2, 		BT709_CONVERSION, width_mult_count, height_mult_count, desc_str_prefix " - bt.709 - AVX2 - avg resampling")
+
+
+/*
+ * The following macro declares the following AVX2 conversion blocks:
+ * - Fast Nearest NeighBour resampling AVX2 full range
+ * - Fast Nearest NeighBour resampling AVX2 bt.601
+ * - Fast Nearest NeighBour resampling AVX2 bt.709
+ *
+ * - Average resampling AVX2 full range
+ * - Average resampling AVX2 bt.601
+ * - Average resampling AVX2 bt.709
+ *
+ * They must appear before the SSE & non-SSE blocks for the same conversion
+ * so they are picked first on CPUs supporting AVX2.
+ */
+#define		DECLARE_AVX2_CONV_BLOCKS(convert_fn_prefix, resample_n_convert_fn_prefix, src_fmt, dst_fmt, width_mult_count, height_mult_count, desc_str_prefix)\
+DECLARE_NNB_AVX2_CONV_BLOCK				(convert_fn_prefix, src_fmt, dst_fmt, width_mult_count, height_mult_count, desc_str_prefix),\
+DECLARE_NNB_BT601_AVX2_CONV_BLOCK		(convert_fn_prefix##_bt601, src_fmt, dst_fmt, width_mult_count, height_mult_count, desc_str_prefix),\
+DECLARE_NNB_BT709_AVX2_CONV_BLOCK		(convert_fn_prefix##_bt709, src_fmt, dst_fmt, width_mult_count, height_mult_count, desc_str_prefix),\
+DECLARE_AVG_AVX2_CONV_BLOCK				(resample_n_convert_fn_prefix, src_fmt, dst_fmt, width_mult_count, height_mult_count, desc_str_prefix),\
+DECLARE_AVG_BT601_AVX2_CONV_BLOCK		(resample_n_convert_fn_prefix##_bt601, src_fmt, dst_fmt, width_mult_count, height_mult_count, desc_str_prefix),\
+DECLARE_AVG_BT709_AVX2_CONV_BLOCK		(resample_n_convert_fn_prefix##_bt709, src_fmt, dst_fmt, width_mult_count, height_mult_count, desc_str_prefix)
+
+// NNB resampling AVX-512 {FR, bt.601, bt.709) macros
+#define		DECLARE_NNB_AVX512_CONV_BLOCK(convert_fn_prefix, src_fmt, dst_fmt, width_mult_count, height_mult_count, desc_str_prefix)\
+DECLARE_CONV_BLOCK(convert_fn_prefix##_avx512, 				src_fmt, dst_fmt, 		CPUID_FEATURE_AVX512, 		NNB_RESAMPLING, width_mult_count, height_mult_count, desc_str_prefix " - FR - AVX-512 - fast resampling")
+#define		DECLARE_NNB_BT601_AVX512_CONV_BLOCK(bt601_convert_fn_prefix, src_fmt, dst_fmt, width_mult_count, height_mult_count, desc_str_prefix)\
+DECLARE_CONV_BLOCK(bt601_convert_fn_prefix##_avx512, 		src_fmt, dst_fmt, 		CPUID_FEATURE_AVX512, 		BT601_CONVERSION | NNB_RESAMPLING, width_mult_count, height_mult_count, desc_str_prefix " - bt.601 - AVX-512 - fast resampling")
+#define		DECLARE_NNB_BT709_AVX512_CONV_BLOCK(bt709_convert_fn_prefix, src_fmt, dst_fmt, width_mult_count, height_mult_count, desc_str_prefix)\
+DECLARE_CONV_BLOCK(bt709_convert_fn_prefix##_avx512, 		src_fmt, dst_fmt, 		CPUID_FEATURE_AVX512, 		BT709_CONVERSION | NNB_RESAMPLING, width_mult_count, height_mult_count, desc_str_prefix " - bt.709 - AVX-512 - fast resampling")
+
+// AVG resampling AVX-512 {FR, bt.601, bt.709) macros
+#define		DECLARE_AVG_AVX512_CONV_BLOCK(convert_fn_prefix, src_fmt, dst_fmt, width_mult_count, height_mult_count, desc_str_prefix)\
+DECLARE_CONV_BLOCK(convert_fn_prefix##_avx512, 				src_fmt, dst_fmt, 		CPUID_FEATURE_AVX512, 		DEFAULT_ATTRIBUTE, width_mult_count, height_mult_count, desc_str_prefix " - FR - AVX-512 - avg resampling")
+#define		DECLARE_AVG_BT601_AVX512_CONV_BLOCK(bt601_convert_fn_prefix, src_fmt, dst_fmt, width_mult_count, height_mult_count, desc_str_prefix)\
+DECLARE_CONV_BLOCK(bt601_convert_fn_prefix##_avx512, 		src_fmt, dst_fmt, 		CPUID_FEATURE_AVX512, 		BT601_CONVERSION, width_mult_count, height_mult_count, desc_str_prefix " - bt.601 - AVX-512 - avg resampling")
+#define		DECLARE_AVG_BT709_AVX512_CONV_BLOCK(bt709_convert_fn_prefix, src_fmt, dst_fmt, width_mult_count, height_mult_count, desc_str_prefix)\
+DECLARE_CONV_BLOCK(bt709_convert_fn_prefix##_avx512, 		src_fmt, dst_fmt, 		CPUID_FEATURE_AVX512, 		BT709_CONVERSION, width_mult_count, height_mult_count, desc_str_prefix " - bt.709 - AVX-512 - avg resampling")
+
+/*
+ * Same as DECLARE_AVX2_CONV_BLOCKS, for AVX-512 conversion blocks. These are
+ * placed first so they are picked first on CPUs supporting AVX-512.
+ */
+#define		DECLARE_AVX512_CONV_BLOCKS(convert_fn_prefix, resample_n_convert_fn_prefix, src_fmt, dst_fmt, width_mult_count, height_mult_count, desc_str_prefix)\
+DECLARE_NNB_AVX512_CONV_BLOCK			(convert_fn_prefix, src_fmt, dst_fmt, width_mult_count, height_mult_count, desc_str_prefix),\
+DECLARE_NNB_BT601_AVX512_CONV_BLOCK		(convert_fn_prefix##_bt601, src_fmt, dst_fmt, width_mult_count, height_mult_count, desc_str_prefix),\
+DECLARE_NNB_BT709_AVX512_CONV_BLOCK		(convert_fn_prefix##_bt709, src_fmt, dst_fmt, width_mult_count, height_mult_count, desc_str_prefix),\
+DECLARE_AVG_AVX512_CONV_BLOCK			(resample_n_convert_fn_prefix, src_fmt, dst_fmt, width_mult_count, height_mult_count, desc_str_prefix),\
+DECLARE_AVG_BT601_AVX512_CONV_BLOCK		(resample_n_convert_fn_prefix##_bt601, src_fmt, dst_fmt, width_mult_count, height_mult_count, desc_str_prefix),\
+DECLARE_AVG_BT709_AVX512_CONV_BLOCK		(resample_n_convert_fn_prefix##_bt709, src_fmt, dst_fmt, width_mult_count, height_mult_count, desc_str_prefix)
+
+// NNB resampling NEON {FR, bt.601, bt.709) macros
+#define		DECLARE_NNB_NEON_CONV_BLOCK(convert_fn_prefix, src_fmt, dst_fmt, width_mult_count, height_mult_count, desc_str_prefix)\
+DECLARE_CONV_BLOCK(convert_fn_prefix##_neon, 				src_fmt, dst_fmt, 		CPUID_FEATURE_NEON, 		NNB_RESAMPLING, width_mult_count, height_mult_count, desc_str_prefix " - FR - NEON - fast resampling")
+#define		DECLARE_NNB_BT601_NEON_CONV_BLOCK(bt601_convert_fn_prefix, src_fmt, dst_fmt, width_mult_count, height_mult_count, desc_str_prefix)\
+DECLARE_CONV_BLOCK(bt601_convert_fn_prefix##_neon, 			src_fmt, dst_fmt, 		CPUID_FEATURE_NEON, 		BT601_CONVERSION | NNB_RESAMPLING, width_mult_count, height_mult_count, desc_str_prefix " - bt.601 - NEON - fast resampling")
+#define		DECLARE_NNB_BT709_NEON_CONV_BLOCK(bt709_convert_fn_prefix, src_fmt, dst_fmt, width_mult_count, height_mult_count, desc_str_prefix)\
+DECLARE_CONV_BLOCK(bt709_convert_fn_prefix##_neon, 			src_fmt, dst_fmt, 		CPUID_FEATURE_NEON, 		BT709_CONVERSION | NNB_RESAMPLING, width_mult_count, height_mult_count, desc_str_prefix " - bt.709 - NEON - fast resampling")
+
+// AVG resampling NEON {FR, bt.601, bt.709) macros
+#define		DECLARE_AVG_NEON_CONV_BLOCK(convert_fn_prefix, src_fmt, dst_fmt, width_mult_count, height_mult_count, desc_str_prefix)\
+DECLARE_CONV_BLOCK(convert_fn_prefix##_neon, 				src_fmt, dst_fmt, 		CPUID_FEATURE_NEON, 		DEFAULT_ATTRIBUTE, width_mult_count, height_mult_count, desc_str_prefix " - FR - NEON - avg resampling")
+#define		DECLARE_AVG_BT601_NEON_CONV_BLOCK(bt601_convert_fn_prefix, src_fmt, dst_fmt, width_mult_count, height_mult_count, desc_str_prefix)\
+DECLARE_CONV_BLOCK(bt601_convert_fn_prefix##_neon, 			src_fmt, dst_fmt, 		CPUID_FEATURE_NEON, 		BT601_CONVERSION, width_mult_count, height_mult_count, desc_str_prefix " - bt.601 - NEON - avg resampling")
+#define		DECLARE_AVG_BT709_NEON_CONV_BLOCK(bt709_convert_fn_prefix, src_fmt, dst_fmt, width_mult_count, height_mult_count, desc_str_prefix)\
+DECLARE_CONV_BLOCK(bt709_convert_fn_prefix##_neon, 			src_fmt, dst_fmt, 		CPUID_FEATURE_NEON, 		BT709_CONVERSION, width_mult_count, height_mult_count, desc_str_prefix " - bt.709 - NEON - avg resampling")
+
+/*
+ * Same as DECLARE_AVX2_CONV_BLOCKS, for NEON conversion blocks. These are
+ * placed first so they are picked first on ARM CPUs supporting NEON (and
+ * never on Intel CPUs).
+ */
+#define		DECLARE_NEON_CONV_BLOCKS(convert_fn_prefix, resample_n_convert_fn_prefix, src_fmt, dst_fmt, width_mult_count, height_mult_count, desc_str_prefix)\
+DECLARE_NNB_NEON_CONV_BLOCK				(convert_fn_prefix, src_fmt, dst_fmt, width_mult_count, height_mult_count, desc_str_prefix),\
+DECLARE_NNB_BT601_NEON_CONV_BLOCK		(convert_fn_prefix##_bt601, src_fmt, dst_fmt, width_mult_count, height_mult_count, desc_str_prefix),\
+DECLARE_NNB_BT709_NEON_CONV_BLOCK		(convert_fn_prefix##_bt709, src_fmt, dst_fmt, width_mult_count, height_mult_count, desc_str_prefix),\
+DECLARE_AVG_NEON_CONV_BLOCK				(resample_n_convert_fn_prefix, src_fmt, dst_fmt, width_mult_count, height_mult_count, desc_str_prefix),\
+DECLARE_AVG_BT601_NEON_CONV_BLOCK		(resample_n_convert_fn_prefix##_bt601, src_fmt, dst_fmt, width_mult_count, height_mult_count, desc_str_prefix),\
+DECLARE_AVG_BT709_NEON_CONV_BLOCK		(resample_n_convert_fn_prefix##_bt709, src_fmt, dst_fmt, width_mult_count, height_mult_count, desc_str_prefix)
+
+
+/*
+ * Same as above, with the Fast Nearest NeighBour resampling blocks only.
+ */
+#define		DECLARE_NNB_ONLY_AVX2_CONV_BLOCKS(convert_fn_prefix, src_fmt, dst_fmt, width_mult_count, height_mult_count, desc_str_prefix)\
+DECLARE_NNB_AVX2_CONV_BLOCK				(convert_fn_prefix, src_fmt, dst_fmt, width_mult_count, height_mult_count, desc_str_prefix),\
+DECLARE_NNB_BT601_AVX2_CONV_BLOCK		(convert_fn_prefix##_bt601, src_fmt, dst_fmt, width_mult_count, height_mult_count, desc_str_prefix),\
+DECLARE_NNB_BT709_AVX2_CONV_BLOCK		(convert_fn_prefix##_bt709, src_fmt, dst_fmt, width_mult_count, height_mult_count, desc_str_prefix)
+
 
 /*
  * The following macro declares the following conversion blocks:
@@ -213,6 +321,25 @@ DECLARE_NNB_BT601_FLOAT_CONV_BLOCK		(non_sse_convert_fn_prefix##_bt601, src_fmt,
 DECLARE_NNB_BT709_FLOAT_CONV_BLOCK		(non_sse_convert_fn_prefix##_bt709, src_fmt, dst_fmt, nonsse_width_mult_count, nonsse_height_mult_count, desc_str_prefix)
 
 
+/*
+ * Same as above, without the SSE2-only blocks.
+ */
+#define		DECLARE_NNB_ONLY_SSE2_SSSE3_CONV_BLOCKS(convert_fn_prefix, non_sse_convert_fn_prefix, src_fmt, dst_fmt, width_mult_count, height_mult_count, nonsse_width_mult_count, nonsse_height_mult_count, desc_str_prefix)\
+DECLARE_NNB_SSE2_SSSE3_CONV_BLOCK		(convert_fn_prefix, src_fmt, dst_fmt, width_mult_count, height_mult_count, desc_str_prefix),\
+DECLARE_NNB_BT601_SSE2_SSSE3_CONV_BLOCK	(convert_fn_prefix##_bt601, src_fmt, dst_fmt, width_mult_count, height_mult_count, desc_str_prefix),\
+DECLARE_NNB_BT709_SSE2_SSSE3_CONV_BLOCK	(convert_fn_prefix##_bt709, src_fmt, dst_fmt, width_mult_count, height_mult_count, desc_str_prefix),\
+DECLARE_NNB_ONLY_NONSSE_CONV_BLOCKS		(non_sse_convert_fn_prefix, src_fmt, dst_fmt, nonsse_width_mult_count, nonsse_height_mult_count, desc_str_prefix)
+
+/*
+ * Same as above, with the NON-SSE blocks only.
+ */
+#define		DECLARE_NNB_ONLY_NONSSE_CONV_BLOCKS(non_sse_convert_fn_prefix, src_fmt, dst_fmt, nonsse_width_mult_count, nonsse_height_mult_count, desc_str_prefix)\
+DECLARE_NNB_CONV_BLOCK					(non_sse_convert_fn_prefix, src_fmt, dst_fmt, nonsse_width_mult_count, nonsse_height_mult_count, desc_str_prefix),\
+DECLARE_NNB_BT601_CONV_BLOCK			(non_sse_convert_fn_prefix##_bt601, src_fmt, dst_fmt, nonsse_width_mult_count, nonsse_height_mult_count, desc_str_prefix),\
+DECLARE_NNB_BT709_CONV_BLOCK			(non_sse_convert_fn_prefix##_bt709, src_fmt, dst_fmt, nonsse_width_mult_count, nonsse_height_mult_count, desc_str_prefix),\
+DECLARE_NNB_FLOAT_CONV_BLOCK			(non_sse_convert_fn_prefix, src_fmt, dst_fmt, nonsse_width_mult_count, nonsse_height_mult_count, desc_str_prefix),\
+DECLARE_NNB_BT601_FLOAT_CONV_BLOCK		(non_sse_convert_fn_prefix##_bt601, src_fmt, dst_fmt, nonsse_width_mult_count, nonsse_height_mult_count, desc_str_prefix),\
+DECLARE_NNB_BT709_FLOAT_CONV_BLOCK		(non_sse_convert_fn_prefix##_bt709, src_fmt, dst_fmt, nonsse_width_mult_count, nonsse_height_mult_count, desc_str_prefix)
 
 
 
@@ -221,6 +348,10 @@ DECLARE_NNB_BT709_FLOAT_CONV_BLOCK		(non_sse_convert_fn_prefix##_bt709, src_fmt,
 /*
  * Repacking conversion blocks
  */
+#define		DECLARE_REPACK_AVX512_CONV_BLOCK(convert_fn_prefix, src_fmt, dst_fmt, width_mult_count, height_mult_count, desc_str_prefix)\
+DECLARE_CONV_BLOCK(convert_fn_prefix##_avx512,		src_fmt, dst_fmt, 		CPUID_FEATURE_AVX512, 	DEFAULT_ATTRIBUTE, width_mult_count, height_mult_count, desc_str_prefix " - FR - AVX-512 - no resampling")
+#define		DECLARE_REPACK_AVX2_CONV_BLOCK(convert_fn_prefix, src_fmt, dst_fmt, width_mult_count, height_mult_count, desc_str_prefix)\
+DECLARE_CONV_BLOCK(convert_fn_prefix##_avx2,		src_fmt, dst_fmt, 		CPUID_FEATURE_AVX2, 	DEFAULT_ATTRIBUTE, width_mult_count, height_mult_count, desc_str_prefix " - FR - AVX2 - no resampling")
 #define		DECLARE_REPACK_SSE2_SSSE3_SSE41_CONV_BLOCK(convert_fn_prefix, src_fmt, dst_fmt, width_mult_count, height_mult_count, desc_str_prefix)\
 DECLARE_CONV_BLOCK(convert_fn_prefix##_sse2_ssse3_sse41,src_fmt, dst_fmt, 		CPUID_FEATURE_SSE2 | CPUID_FEATURE_SSSE3 | CPUID_FEATURE_SSE41, 	DEFAULT_ATTRIBUTE, width_mult_count, height_mult_count, desc_str_prefix " - FR - SSE2/SSSE3/SSE41 - no resampling")
 #define		DECLARE_REPACK_SSE2_SSSE3_CONV_BLOCK(convert_fn_prefix, src_fmt, dst_fmt, width_mult_count, height_mult_count, desc_str_prefix)\
@@ -262,6 +393,23 @@ DECLARE_REPACK_NONSSE_CONV_BLOCK(non_sse_convert_fn_prefix, src_fmt, dst_fmt, no
 DECLARE_REPACK_NONSSE_FLOAT_CONV_BLOCK(non_sse_convert_fn_prefix, src_fmt, dst_fmt, nonsse_width_mult_count, nonsse_height_mult_count, desc_str_prefix)
 
 
+// The following macro defines NEON repacking conversion blocks between YUV422 and YUV420 formats,
+// with either fast (NNB) or averaged vertical chroma resampling
+#define		DECLARE_YUV420_REPACK_NEON_CONV_BLOCKS(convert_fn_prefix, resample_convert_fn_prefix, src_fmt, dst_fmt, width_mult_count, height_mult_count, desc_str_prefix)\
+DECLARE_CONV_BLOCK(resample_convert_fn_prefix##_neon,	src_fmt, dst_fmt, 		CPUID_FEATURE_NEON, 	DEFAULT_ATTRIBUTE, width_mult_count, height_mult_count, desc_str_prefix " - FR - NEON - avg resampling"),\
+DECLARE_CONV_BLOCK(convert_fn_prefix##_neon, 			src_fmt, dst_fmt, 		CPUID_FEATURE_NEON, 	NNB_RESAMPLING, width_mult_count, height_mult_count, desc_str_prefix " - FR - NEON - fast resampling")
+
+// The following macro defines non-sse and sse2 repacking conversion blocks between YUV422 and YUV420
+// formats, with either fast (NNB) or averaged vertical chroma resampling
+#define		DECLARE_YUV420_REPACK_CONV_BLOCKS(convert_fn_prefix, resample_convert_fn_prefix, non_sse_convert_fn_prefix, non_sse_resample_convert_fn_prefix, src_fmt, dst_fmt, width_mult_count, height_mult_count, nonsse_width_mult_count, nonsse_height_mult_count, desc_str_prefix)\
+DECLARE_CONV_BLOCK(resample_convert_fn_prefix##_sse2,	src_fmt, dst_fmt, 		CPUID_FEATURE_SSE2, 	DEFAULT_ATTRIBUTE, width_mult_count, height_mult_count, desc_str_prefix " - FR - SSE2 - avg resampling"),\
+DECLARE_CONV_BLOCK(convert_fn_prefix##_sse2, 			src_fmt, dst_fmt, 		CPUID_FEATURE_SSE2, 	NNB_RESAMPLING, width_mult_count, height_mult_count, desc_str_prefix " - FR - SSE2 - fast resampling"),\
+DECLARE_CONV_BLOCK(non_sse_resample_convert_fn_prefix##_nonsse,	src_fmt, dst_fmt, 		CPUID_FEATURE_NONE, 	DEFAULT_ATTRIBUTE, nonsse_width_mult_count, nonsse_height_mult_count, desc_str_prefix " - FR - NON-SSE - avg resampling"),\
+DECLARE_CONV_BLOCK(non_sse_convert_fn_prefix##_nonsse, 	src_fmt, dst_fmt, 		CPUID_FEATURE_NONE, 	NNB_RESAMPLING, nonsse_width_mult_count, nonsse_height_mult_count, desc_str_prefix " - FR - NON-SSE - fast resampling"),\
+DECLARE_CONV_BLOCK(non_sse_resample_convert_fn_prefix##_nonsse,	src_fmt, dst_fmt, 		CPUID_FEATURE_NONE, 	NONSSE_FLOAT_CONVERSION, nonsse_width_mult_count, nonsse_height_mult_count, desc_str_prefix " - FR - NON-SSEFloat - avg resampling"),\
+DECLARE_CONV_BLOCK(non_sse_convert_fn_prefix##_nonsse, 	src_fmt, dst_fmt, 		CPUID_FEATURE_NONE, 	NNB_RESAMPLING | NONSSE_FLOAT_CONVERSION, nonsse_width_mult_count, nonsse_height_mult_count, desc_str_prefix " - FR - NON-SSEFloat - fast resampling")
+
+
 
 
 /*
@@ -319,6 +467,41 @@ DECLARE_AVG_BT601_FLOAT_CONV_BLOCK		(non_sse_resample_n_convert_fn_prefix##_bt60
 DECLARE_AVG_BT709_FLOAT_CONV_BLOCK		(non_sse_resample_n_convert_fn_prefix##_bt709, src_fmt, dst_fmt, nonsse_width_mult_count, nonsse_height_mult_count, desc_str_prefix)
 
 
+/*
+ * Downscaling conversion blocks
+ *
+ * The width and height multiples of these blocks apply to the downscaled
+ * image. The SSE blocks only downscale by 2 or 4, the NON-SSE ones by any
+ * factor. There are no NNB variants: pixels are always averaged.
+ */
+#define		DECLARE_DOWNSCALE_CONV_BLOCK_TRIPLET(convert_fn_prefix, fn_suffix, src_fmt, dst_fmt, cpuid_flags, attributes, width_mult_count, height_mult_count, desc_str_prefix, desc_str_suffix)\
+DECLARE_CONV_BLOCK(convert_fn_prefix##fn_suffix, 			src_fmt, dst_fmt, 		cpuid_flags, 		attributes, width_mult_count, height_mult_count, desc_str_prefix " - FR - " desc_str_suffix),\
+DECLARE_CONV_BLOCK(convert_fn_prefix##_bt601##fn_suffix, 	src_fmt, dst_fmt, 		cpuid_flags, 		BT601_CONVERSION | attributes, width_mult_count, height_mult_count, desc_str_prefix " - bt.601 - " desc_str_suffix),\
+DECLARE_CONV_BLOCK(convert_fn_prefix##_bt709##fn_suffix, 	src_fmt, dst_fmt, 		cpuid_flags, 		BT709_CONVERSION | attributes, width_mult_count, height_mult_count, desc_str_prefix " - bt.709 - " desc_str_suffix)
+
+/*
+ * The following macro declares the following conversion blocks:
+ * - 2x / 4x downscaling SSE2/SSSE3 {full range, bt.601, bt.709}
+ * - 2x / 4x downscaling SSE2 {full range, bt.601, bt.709}
+ * - Any factor downscaling NON-SSE {full range, bt.601, bt.709}
+ * - Any factor downscaling NON-SSE float {full range, bt.601, bt.709}
+ */
+#define		DECLARE_DOWNSCALE_CONV_BLOCKS(convert_fn_prefix, non_sse_convert_fn_prefix, src_fmt, dst_fmt, width_mult_count, height_mult_count, nonsse_width_mult_count, nonsse_height_mult_count, desc_str_prefix)\
+DECLARE_DOWNSCALE_CONV_BLOCK_TRIPLET	(convert_fn_prefix, _sse2_ssse3, src_fmt, dst_fmt, CPUID_FEATURE_SSE2 | CPUID_FEATURE_SSSE3, DOWNSCALE_2X | DOWNSCALE_4X, width_mult_count, height_mult_count, desc_str_prefix, "SSE2/SSSE3 - 2x/4x downscaling"),\
+DECLARE_DOWNSCALE_CONV_BLOCK_TRIPLET	(convert_fn_prefix, _sse2, src_fmt, dst_fmt, CPUID_FEATURE_SSE2, DOWNSCALE_2X | DOWNSCALE_4X, width_mult_count, height_mult_count, desc_str_prefix, "SSE2 - 2x/4x downscaling"),\
+DECLARE_DOWNSCALE_CONV_BLOCK_TRIPLET	(non_sse_convert_fn_prefix, _nonsse, src_fmt, dst_fmt, CPUID_FEATURE_NONE, DOWNSCALE_NX, nonsse_width_mult_count, nonsse_height_mult_count, desc_str_prefix, "NON-SSE - downscaling"),\
+DECLARE_DOWNSCALE_CONV_BLOCK_TRIPLET	(non_sse_convert_fn_prefix, _nonsse_float, src_fmt, dst_fmt, CPUID_FEATURE_NONE, DOWNSCALE_NX | NONSSE_FLOAT_CONVERSION, nonsse_width_mult_count, nonsse_height_mult_count, desc_str_prefix, "NON-SSEFloat - downscaling")
+
+/*
+ * Same as above for v210, with SSE2/SSSE3/SSE41 and SSE2/SSSE3 blocks.
+ */
+#define		DECLARE_V210_DOWNSCALE_CONV_BLOCKS(convert_fn_prefix, non_sse_convert_fn_prefix, src_fmt, dst_fmt, width_mult_count, height_mult_count, nonsse_width_mult_count, nonsse_height_mult_count, desc_str_prefix)\
+DECLARE_DOWNSCALE_CONV_BLOCK_TRIPLET	(convert_fn_prefix, _sse2_ssse3_sse41, src_fmt, dst_fmt, CPUID_FEATURE_SSE2 | CPUID_FEATURE_SSSE3 | CPUID_FEATURE_SSE41, DOWNSCALE_2X | DOWNSCALE_4X, width_mult_count, height_mult_count, desc_str_prefix, "SSE2/SSSE3/SSE41 - 2x/4x downscaling"),\
+DECLARE_DOWNSCALE_CONV_BLOCK_TRIPLET	(convert_fn_prefix, _sse2_ssse3, src_fmt, dst_fmt, CPUID_FEATURE_SSE2 | CPUID_FEATURE_SSSE3, DOWNSCALE_2X | DOWNSCALE_4X, width_mult_count, height_mult_count, desc_str_prefix, "SSE2/SSSE3 - 2x/4x downscaling"),\
+DECLARE_DOWNSCALE_CONV_BLOCK_TRIPLET	(non_sse_convert_fn_prefix, _nonsse, src_fmt, dst_fmt, CPUID_FEATURE_NONE, DOWNSCALE_NX, nonsse_width_mult_count, nonsse_height_mult_count, desc_str_prefix, "NON-SSE - downscaling"),\
+DECLARE_DOWNSCALE_CONV_BLOCK_TRIPLET	(non_sse_convert_fn_prefix, _nonsse_float, src_fmt, dst_fmt, CPUID_FEATURE_NONE, DOWNSCALE_NX | NONSSE_FLOAT_CONVERSION, nonsse_width_mult_count, nonsse_height_mult_count, desc_str_prefix, "NON-SSEFloat - downscaling")
+
+
 
 
 
@@ -396,6 +579,12 @@ const struct  ConversionBlock		conversion_blocks[] = {
 	// r210 to BGR24
 	DECLARE_R210_REPACK_CONV_BLOCK(convert_r210_to_bgr24, convert_10bit_rgb_to_any_rgb, PixFcR210, PixFcBGR24, 16, 1, 1, 1, "r210 to BGR24"),
 
+	// r210 to P210
+	DECLARE_NNB_ONLY_NONSSE_CONV_BLOCKS(convert_10bit_rgb_to_p210, PixFcR210, PixFcP210, 2, 1, "r210 to P210"),
+
+	// r210 to P010
+	DECLARE_NNB_ONLY_NONSSE_CONV_BLOCKS(convert_10bit_rgb_to_p210, PixFcR210, PixFcP010, 2, 2, "r210 to P010"),
+
 	
 	//
 	// r10k to YUYV
@@ -422,99 +611,249 @@ const struct  ConversionBlock		conversion_blocks[] = {
 	// r10k to BGR24
 	DECLARE_R210_REPACK_CONV_BLOCK(convert_r10k_to_bgr24, convert_10bit_rgb_to_any_rgb, PixFcR10k, PixFcBGR24, 16, 1, 1, 1, "r10k to BGR24"),
 
+	// r10k to P210
+	DECLARE_NNB_ONLY_NONSSE_CONV_BLOCKS(convert_10bit_rgb_to_p210, PixFcR10k, PixFcP210, 2, 1, "r10k to P210"),
+
+	// r10k to P010
+	DECLARE_NNB_ONLY_NONSSE_CONV_BLOCKS(convert_10bit_rgb_to_p210, PixFcR10k, PixFcP010, 2, 2, "r10k to P010"),
+
 
 	//
 	// ARGB to YUYV
+	DECLARE_NEON_CONV_BLOCKS(convert_argb_to_yuyv, downsample_n_convert_argb_to_yuyv, PixFcARGB, PixFcYUYV, 16, 1, "ARGB to YUYV"),
+	DECLARE_AVX2_CONV_BLOCKS(convert_argb_to_yuyv, downsample_n_convert_argb_to_yuyv, PixFcARGB, PixFcYUYV, 16, 1, "ARGB to YUYV"),
 	DECLARE_CONV_BLOCKS(convert_argb_to_yuyv, downsample_n_convert_argb_to_yuyv, convert_rgb_to_yuv422, downsample_n_convert_rgb_to_yuv422, PixFcARGB, PixFcYUYV, 16, 1, 2, 1, "ARGB to YUYV"),
 
 	// ARGB to UYVY
+	DECLARE_NEON_CONV_BLOCKS(convert_argb_to_uyvy, downsample_n_convert_argb_to_uyvy, PixFcARGB, PixFcUYVY, 16, 1, "ARGB to UYVY"),
+	DECLARE_AVX2_CONV_BLOCKS(convert_argb_to_uyvy, downsample_n_convert_argb_to_uyvy, PixFcARGB, PixFcUYVY, 16, 1, "ARGB to UYVY"),
 	DECLARE_CONV_BLOCKS(convert_argb_to_uyvy, downsample_n_convert_argb_to_uyvy, convert_rgb_to_yuv422, downsample_n_convert_rgb_to_yuv422, PixFcARGB, PixFcUYVY, 16, 1, 2, 1, "ARGB to UYVY"),
 
 	// ARGB to YUV422P
+	DECLARE_NEON_CONV_BLOCKS(convert_argb_to_yuv422p, downsample_n_convert_argb_to_yuv422p, PixFcARGB, PixFcYUV422P, 16, 1, "ARGB to YUV422P"),
+	DECLARE_AVX2_CONV_BLOCKS(convert_argb_to_yuv422p, downsample_n_convert_argb_to_yuv422p, PixFcARGB, PixFcYUV422P, 32, 1, "ARGB to YUV422P"),
 	DECLARE_CONV_BLOCKS(convert_argb_to_yuv422p, downsample_n_convert_argb_to_yuv422p, convert_rgb_to_yuv422, downsample_n_convert_rgb_to_yuv422, PixFcARGB, PixFcYUV422P, 32, 1, 2, 1, "ARGB to YUV422P"),
 
-	// ARGB to YUV420P (NNB only for now)
-	DECLARE_NNB_ONLY_CONV_BLOCKS(convert_argb_to_yuv420p, convert_rgb_to_yuv420, PixFcARGB, PixFcYUV420P, 32, 2, 2, 2, "ARGB to YUV420P"),
+	// ARGB to YUV420P
+	DECLARE_NEON_CONV_BLOCKS(convert_argb_to_yuv420p, downsample_n_convert_argb_to_yuv420p, PixFcARGB, PixFcYUV420P, 16, 2, "ARGB to YUV420P"),
+	DECLARE_CONV_BLOCKS(convert_argb_to_yuv420p, downsample_n_convert_argb_to_yuv420p, convert_rgb_to_yuv420, downsample_n_convert_rgb_to_yuv420, PixFcARGB, PixFcYUV420P, 32, 2, 2, 2, "ARGB to YUV420P"),
+
+	// ARGB to NV12
+	DECLARE_NEON_CONV_BLOCKS(convert_argb_to_nv12, downsample_n_convert_argb_to_nv12, PixFcARGB, PixFcNV12, 16, 2, "ARGB to NV12"),
+	DECLARE_CONV_BLOCKS(convert_argb_to_nv12, downsample_n_convert_argb_to_nv12, convert_rgb_to_yuv420, downsample_n_convert_rgb_to_yuv420, PixFcARGB, PixFcNV12, 32, 2, 2, 2, "ARGB to NV12"),
+
+	// ARGB to NV21
+	DECLARE_NEON_CONV_BLOCKS(convert_argb_to_nv21, downsample_n_convert_argb_to_nv21, PixFcARGB, PixFcNV21, 16, 2, "ARGB to NV21"),
+	DECLARE_CONV_BLOCKS(convert_argb_to_nv21, downsample_n_convert_argb_to_nv21, convert_rgb_to_yuv420, downsample_n_convert_rgb_to_yuv420, PixFcARGB, PixFcNV21, 32, 2, 2, 2, "ARGB to NV21"),
+
+	// ARGB to P210
+	DECLARE_NNB_ONLY_NONSSE_CONV_BLOCKS(convert_rgb_to_p210, PixFcARGB, PixFcP210, 2, 1, "ARGB to P210"),
+
+	// ARGB to P010
+	DECLARE_NNB_ONLY_NONSSE_CONV_BLOCKS(convert_rgb_to_p210, PixFcARGB, PixFcP010, 2, 2, "ARGB to P010"),
 
 	// ARGB to v210
+	DECLARE_AVX2_CONV_BLOCKS(convert_argb_to_v210, downsample_n_convert_argb_to_v210, PixFcARGB, PixFcV210, 16, 1, "ARGB to v210"),
 	DECLARE_V210_CONV_BLOCKS(convert_argb_to_v210, downsample_n_convert_argb_to_v210, convert_rgb_to_v210, downsample_n_convert_rgb_to_v210, PixFcARGB, PixFcV210, 16, 1, 2, 1, "ARGB to v210"),
 
 	// ARGB to r210
 	DECLARE_R210_REPACK_CONV_BLOCK(convert_argb_to_r210, convert_rgb_to_10bit_rgb, PixFcARGB, PixFcR210, 8, 1, 2, 1, "ARGB to r210"),
 
+	// ARGB to BGRA
+	DECLARE_REPACK_AVX2_CONV_BLOCK(convert_argb_to_bgra, PixFcARGB, PixFcBGRA, 16, 1, "ARGB to BGRA"),
+	DECLARE_REPACK_CONV_BLOCK(convert_argb_to_bgra, convert_rgb_to_any_rgb, PixFcARGB, PixFcBGRA, 16, 1, 2, 1, "ARGB to BGRA"),
+
+	// ARGB to RGB24
+	DECLARE_REPACK_AVX2_CONV_BLOCK(convert_argb_to_rgb24, PixFcARGB, PixFcRGB24, 16, 1, "ARGB to RGB24"),
+	DECLARE_REPACK_CONV_BLOCK(convert_argb_to_rgb24, convert_rgb_to_any_rgb, PixFcARGB, PixFcRGB24, 16, 1, 2, 1, "ARGB to RGB24"),
+
+	// ARGB to BGR24
+	DECLARE_REPACK_AVX2_CONV_BLOCK(convert_argb_to_bgr24, PixFcARGB, PixFcBGR24, 16, 1, "ARGB to BGR24"),
+	DECLARE_REPACK_CONV_BLOCK(convert_argb_to_bgr24, convert_rgb_to_any_rgb, PixFcARGB, PixFcBGR24, 16, 1, 2, 1, "ARGB to BGR24"),
+
 
 	//
 	// BGRA to YUYV
+	DECLARE_NEON_CONV_BLOCKS(convert_bgra_to_yuyv, downsample_n_convert_bgra_to_yuyv, PixFcBGRA, PixFcYUYV, 16, 1, "BGRA to YUYV"),
+	DECLARE_AVX2_CONV_BLOCKS(convert_bgra_to_yuyv, downsample_n_convert_bgra_to_yuyv, PixFcBGRA, PixFcYUYV, 16, 1, "BGRA to YUYV"),
 	DECLARE_CONV_BLOCKS(convert_bgra_to_yuyv, downsample_n_convert_bgra_to_yuyv, convert_rgb_to_yuv422, downsample_n_convert_rgb_to_yuv422, PixFcBGRA, PixFcYUYV, 16, 1, 2, 1, "BGRA to YUYV"),
 
 	// BGRA to UYVY
+	DECLARE_NEON_CONV_BLOCKS(convert_bgra_to_uyvy, downsample_n_convert_bgra_to_uyvy, PixFcBGRA, PixFcUYVY, 16, 1, "BGRA to UYVY"),
+	DECLARE_AVX2_CONV_BLOCKS(convert_bgra_to_uyvy, downsample_n_convert_bgra_to_uyvy, PixFcBGRA, PixFcUYVY, 16, 1, "BGRA to UYVY"),
 	DECLARE_CONV_BLOCKS(convert_bgra_to_uyvy, downsample_n_convert_bgra_to_uyvy, convert_rgb_to_yuv422, downsample_n_convert_rgb_to_yuv422, PixFcBGRA, PixFcUYVY, 16, 1, 2, 1, "BGRA to UYVY"),
 
 	// BGRA to YUV422P
+	DECLARE_NEON_CONV_BLOCKS(convert_bgra_to_yuv422p, downsample_n_convert_bgra_to_yuv422p, PixFcBGRA, PixFcYUV422P, 16, 1, "BGRA to YUV422P"),
+	DECLARE_AVX2_CONV_BLOCKS(convert_bgra_to_yuv422p, downsample_n_convert_bgra_to_yuv422p, PixFcBGRA, PixFcYUV422P, 32, 1, "BGRA to YUV422P"),
 	DECLARE_CONV_BLOCKS(convert_bgra_to_yuv422p, downsample_n_convert_bgra_to_yuv422p, convert_rgb_to_yuv422, downsample_n_convert_rgb_to_yuv422, PixFcBGRA, PixFcYUV422P, 32, 1, 2, 1, "BGRA to YUV422P"),
 
-	// BGRA to YUV420P (NNB only for now)
-	DECLARE_NNB_ONLY_CONV_BLOCKS(convert_bgra_to_yuv420p, convert_rgb_to_yuv420, PixFcBGRA, PixFcYUV420P, 32, 2, 2, 2, "BGRA to YUV420P"),
+	// BGRA to YUV420P
+	DECLARE_NEON_CONV_BLOCKS(convert_bgra_to_yuv420p, downsample_n_convert_bgra_to_yuv420p, PixFcBGRA, PixFcYUV420P, 16, 2, "BGRA to YUV420P"),
+	DECLARE_CONV_BLOCKS(convert_bgra_to_yuv420p, downsample_n_convert_bgra_to_yuv420p, convert_rgb_to_yuv420, downsample_n_convert_rgb_to_yuv420, PixFcBGRA, PixFcYUV420P, 32, 2, 2, 2, "BGRA to YUV420P"),
+
+	// BGRA to NV12
+	DECLARE_NEON_CONV_BLOCKS(convert_bgra_to_nv12, downsample_n_convert_bgra_to_nv12, PixFcBGRA, PixFcNV12, 16, 2, "BGRA to NV12"),
+	DECLARE_CONV_BLOCKS(convert_bgra_to_nv12, downsample_n_convert_bgra_to_nv12, convert_rgb_to_yuv420, downsample_n_convert_rgb_to_yuv420, PixFcBGRA, PixFcNV12, 32, 2, 2, 2, "BGRA to NV12"),
+
+	// BGRA to NV21
+	DECLARE_NEON_CONV_BLOCKS(convert_bgra_to_nv21, downsample_n_convert_bgra_to_nv21, PixFcBGRA, PixFcNV21, 16, 2, "BGRA to NV21"),
+	DECLARE_CONV_BLOCKS(convert_bgra_to_nv21, downsample_n_convert_bgra_to_nv21, convert_rgb_to_yuv420, downsample_n_convert_rgb_to_yuv420, PixFcBGRA, PixFcNV21, 32, 2, 2, 2, "BGRA to NV21"),
+
+	// BGRA to P210
+	DECLARE_NNB_ONLY_NONSSE_CONV_BLOCKS(convert_rgb_to_p210, PixFcBGRA, PixFcP210, 2, 1, "BGRA to P210"),
+
+	// BGRA to P010
+	DECLARE_NNB_ONLY_NONSSE_CONV_BLOCKS(convert_rgb_to_p210, PixFcBGRA, PixFcP010, 2, 2, "BGRA to P010"),
 
 	// BGRA to v210
+	DECLARE_AVX2_CONV_BLOCKS(convert_bgra_to_v210, downsample_n_convert_bgra_to_v210, PixFcBGRA, PixFcV210, 16, 1, "BGRA to v210"),
 	DECLARE_V210_CONV_BLOCKS(convert_bgra_to_v210, downsample_n_convert_bgra_to_v210, convert_rgb_to_v210, downsample_n_convert_rgb_to_v210, PixFcBGRA, PixFcV210, 16, 1, 2, 1, "BGRA to v210"),
 
 	// BGRA to r210
 	DECLARE_R210_REPACK_CONV_BLOCK(convert_bgra_to_r210, convert_rgb_to_10bit_rgb, PixFcBGRA, PixFcR210, 8, 1, 2, 1, "BGRA to r210"),
 
+	// BGRA to ARGB
+	DECLARE_REPACK_AVX2_CONV_BLOCK(convert_bgra_to_argb, PixFcBGRA, PixFcARGB, 16, 1, "BGRA to ARGB"),
+	DECLARE_REPACK_CONV_BLOCK(convert_bgra_to_argb, convert_rgb_to_any_rgb, PixFcBGRA, PixFcARGB, 16, 1, 2, 1, "BGRA to ARGB"),
+
+	// BGRA to RGB24
+	DECLARE_REPACK_AVX2_CONV_BLOCK(convert_bgra_to_rgb24, PixFcBGRA, PixFcRGB24, 16, 1, "BGRA to RGB24"),
+	DECLARE_REPACK_CONV_BLOCK(convert_bgra_to_rgb24, convert_rgb_to_any_rgb, PixFcBGRA, PixFcRGB24, 16, 1, 2, 1, "BGRA to RGB24"),
+
+	// BGRA to BGR24
+	DECLARE_REPACK_AVX2_CONV_BLOCK(convert_bgra_to_bgr24, PixFcBGRA, PixFcBGR24, 16, 1, "BGRA to BGR24"),
+	DECLARE_REPACK_CONV_BLOCK(convert_bgra_to_bgr24, convert_rgb_to_any_rgb, PixFcBGRA, PixFcBGR24, 16, 1, 2, 1, "BGRA to BGR24"),
+
 
 	//
 	// RGB24 to YUYV
+	DECLARE_NEON_CONV_BLOCKS(convert_rgb24_to_yuyv, downsample_n_convert_rgb24_to_yuyv, PixFcRGB24, PixFcYUYV, 16, 1, "RGB24 to YUYV"),
+	DECLARE_AVX2_CONV_BLOCKS(convert_rgb24_to_yuyv, downsample_n_convert_rgb24_to_yuyv, PixFcRGB24, PixFcYUYV, 16, 1, "RGB24 to YUYV"),
 	DECLARE_CONV_BLOCKS(convert_rgb24_to_yuyv, downsample_n_convert_rgb24_to_yuyv, convert_rgb_to_yuv422, downsample_n_convert_rgb_to_yuv422, PixFcRGB24, PixFcYUYV, 16, 1, 2, 1, "RGB24 to YUYV"),
 
 	// RGB24 to UYVY
+	DECLARE_NEON_CONV_BLOCKS(convert_rgb24_to_uyvy, downsample_n_convert_rgb24_to_uyvy, PixFcRGB24, PixFcUYVY, 16, 1, "RGB24 to UYVY"),
+	DECLARE_AVX2_CONV_BLOCKS(convert_rgb24_to_uyvy, downsample_n_convert_rgb24_to_uyvy, PixFcRGB24, PixFcUYVY, 16, 1, "RGB24 to UYVY"),
 	DECLARE_CONV_BLOCKS(convert_rgb24_to_uyvy, downsample_n_convert_rgb24_to_uyvy, convert_rgb_to_yuv422, downsample_n_convert_rgb_to_yuv422, PixFcRGB24, PixFcUYVY, 16, 1, 2, 1, "RGB24 to UYVY"),
 
 	// RGB24 to YUV422P
+	DECLARE_NEON_CONV_BLOCKS(convert_rgb24_to_yuv422p, downsample_n_convert_rgb24_to_yuv422p, PixFcRGB24, PixFcYUV422P, 16, 1, "RGB24 to YUV422P"),
+	DECLARE_AVX2_CONV_BLOCKS(convert_rgb24_to_yuv422p, downsample_n_convert_rgb24_to_yuv422p, PixFcRGB24, PixFcYUV422P, 32, 1, "RGB24 to YUV422P"),
 	DECLARE_CONV_BLOCKS(convert_rgb24_to_yuv422p, downsample_n_convert_rgb24_to_yuv422p, convert_rgb_to_yuv422, downsample_n_convert_rgb_to_yuv422, PixFcRGB24, PixFcYUV422P, 32, 1, 2, 1, "RGB24 to YUV422P"),
 
-	// RGB24 to YUV420P (NNB only for now)
-	DECLARE_NNB_ONLY_CONV_BLOCKS(convert_rgb24_to_yuv420p, convert_rgb_to_yuv420, PixFcRGB24, PixFcYUV420P, 32, 2, 2, 2, "RGB24 to YUV420P"),
+	// RGB24 to YUV420P
+	DECLARE_NEON_CONV_BLOCKS(convert_rgb24_to_yuv420p, downsample_n_convert_rgb24_to_yuv420p, PixFcRGB24, PixFcYUV420P, 16, 2, "RGB24 to YUV420P"),
+	DECLARE_CONV_BLOCKS(convert_rgb24_to_yuv420p, downsample_n_convert_rgb24_to_yuv420p, convert_rgb_to_yuv420, downsample_n_convert_rgb_to_yuv420, PixFcRGB24, PixFcYUV420P, 32, 2, 2, 2, "RGB24 to YUV420P"),
+
+	// RGB24 to NV12
+	DECLARE_NEON_CONV_BLOCKS(convert_rgb24_to_nv12, downsample_n_convert_rgb24_to_nv12, PixFcRGB24, PixFcNV12, 16, 2, "RGB24 to NV12"),
+	DECLARE_CONV_BLOCKS(convert_rgb24_to_nv12, downsample_n_convert_rgb24_to_nv12, convert_rgb_to_yuv420, downsample_n_convert_rgb_to_yuv420, PixFcRGB24, PixFcNV12, 32, 2, 2, 2, "RGB24 to NV12"),
+
+	// RGB24 to NV21
+	DECLARE_NEON_CONV_BLOCKS(convert_rgb24_to_nv21, downsample_n_convert_rgb24_to_nv21, PixFcRGB24, PixFcNV21, 16, 2, "RGB24 to NV21"),
+	DECLARE_CONV_BLOCKS(convert_rgb24_to_nv21, downsample_n_convert_rgb24_to_nv21, convert_rgb_to_yuv420, downsample_n_convert_rgb_to_yuv420, PixFcRGB24, PixFcNV21, 32, 2, 2, 2, "RGB24 to NV21"),
+
+	// RGB24 to P210
+	DECLARE_NNB_ONLY_NONSSE_CONV_BLOCKS(convert_rgb_to_p210, PixFcRGB24, PixFcP210, 2, 1, "RGB24 to P210"),
+
+	// RGB24 to P010
+	DECLARE_NNB_ONLY_NONSSE_CONV_BLOCKS(convert_rgb_to_p210, PixFcRGB24, PixFcP010, 2, 2, "RGB24 to P010"),
 
 	// RGB24 to v210
+	DECLARE_AVX2_CONV_BLOCKS(convert_rgb24_to_v210, downsample_n_convert_rgb24_to_v210, PixFcRGB24, PixFcV210, 16, 1, "RGB24 to v210"),
 	DECLARE_V210_CONV_BLOCKS(convert_rgb24_to_v210, downsample_n_convert_rgb24_to_v210, convert_rgb_to_v210, downsample_n_convert_rgb_to_v210, PixFcRGB24, PixFcV210, 16, 1, 2, 1, "RGB24 to v210"),
 
 	// BGR24 to r210
 	DECLARE_R210_REPACK_CONV_BLOCK(convert_rgb24_to_r210, convert_rgb_to_10bit_rgb, PixFcRGB24, PixFcR210, 16, 1, 2, 1, "RGB24 to r210"),
 
+	// RGB24 to ARGB
+	DECLARE_REPACK_AVX2_CONV_BLOCK(convert_rgb24_to_argb, PixFcRGB24, PixFcARGB, 16, 1, "RGB24 to ARGB"),
+	DECLARE_REPACK_CONV_BLOCK(convert_rgb24_to_argb, convert_rgb_to_any_rgb, PixFcRGB24, PixFcARGB, 16, 1, 2, 1, "RGB24 to ARGB"),
+
+	// RGB24 to BGRA
+	DECLARE_REPACK_AVX2_CONV_BLOCK(convert_rgb24_to_bgra, PixFcRGB24, PixFcBGRA, 16, 1, "RGB24 to BGRA"),
+	DECLARE_REPACK_CONV_BLOCK(convert_rgb24_to_bgra, convert_rgb_to_any_rgb, PixFcRGB24, PixFcBGRA, 16, 1, 2, 1, "RGB24 to BGRA"),
+
+	// RGB24 to BGR24
+	DECLARE_REPACK_AVX2_CONV_BLOCK(convert_rgb24_to_bgr24, PixFcRGB24, PixFcBGR24, 16, 1, "RGB24 to BGR24"),
+	DECLARE_REPACK_CONV_BLOCK(convert_rgb24_to_bgr24, convert_rgb_to_any_rgb, PixFcRGB24, PixFcBGR24, 16, 1, 2, 1, "RGB24 to BGR24"),
+
 
 	//
 	// BGR24 to YUYV
+	DECLARE_NEON_CONV_BLOCKS(convert_bgr24_to_yuyv, downsample_n_convert_bgr24_to_yuyv, PixFcBGR24, PixFcYUYV, 16, 1, "BGR24 to YUYV"),
+	DECLARE_AVX2_CONV_BLOCKS(convert_bgr24_to_yuyv, downsample_n_convert_bgr24_to_yuyv, PixFcBGR24, PixFcYUYV, 16, 1, "BGR24 to YUYV"),
 	DECLARE_CONV_BLOCKS(convert_bgr24_to_yuyv, downsample_n_convert_bgr24_to_yuyv, convert_rgb_to_yuv422, downsample_n_convert_rgb_to_yuv422, PixFcBGR24, PixFcYUYV, 16, 1, 2, 1, "BGR24 to YUYV"),
 
 	// BGR24 to UYVY
+	DECLARE_NEON_CONV_BLOCKS(convert_bgr24_to_uyvy, downsample_n_convert_bgr24_to_uyvy, PixFcBGR24, PixFcUYVY, 16, 1, "BGR24 to UYVY"),
+	DECLARE_AVX2_CONV_BLOCKS(convert_bgr24_to_uyvy, downsample_n_convert_bgr24_to_uyvy, PixFcBGR24, PixFcUYVY, 16, 1, "BGR24 to UYVY"),
 	DECLARE_CONV_BLOCKS(convert_bgr24_to_uyvy, downsample_n_convert_bgr24_to_uyvy, convert_rgb_to_yuv422, downsample_n_convert_rgb_to_yuv422, PixFcBGR24, PixFcUYVY, 16, 1, 2, 1, "BGR24 to UYVY"),
 
 	// BGR24 to YUV422P
+	DECLARE_NEON_CONV_BLOCKS(convert_bgr24_to_yuv422p, downsample_n_convert_bgr24_to_yuv422p, PixFcBGR24, PixFcYUV422P, 16, 1, "BGR24 to YUV422P"),
+	DECLARE_AVX2_CONV_BLOCKS(convert_bgr24_to_yuv422p, downsample_n_convert_bgr24_to_yuv422p, PixFcBGR24, PixFcYUV422P, 32, 1, "BGR24 to YUV422P"),
 	DECLARE_CONV_BLOCKS(convert_bgr24_to_yuv422p, downsample_n_convert_bgr24_to_yuv422p, convert_rgb_to_yuv422, downsample_n_convert_rgb_to_yuv422, PixFcBGR24, PixFcYUV422P, 32, 1, 2, 1, "BGR24 to YUV422P"),
 
-	// BGR24 to YUV420P (NNB only for now)
-	DECLARE_NNB_ONLY_CONV_BLOCKS(convert_bgr24_to_yuv420p, convert_rgb_to_yuv420, PixFcBGR24, PixFcYUV420P, 32, 2, 2, 2, "BGR24 to YUV420P"),
+	// BGR24 to YUV420P
+	DECLARE_NEON_CONV_BLOCKS(convert_bgr24_to_yuv420p, downsample_n_convert_bgr24_to_yuv420p, PixFcBGR24, PixFcYUV420P, 16, 2, "BGR24 to YUV420P"),
+	DECLARE_CONV_BLOCKS(convert_bgr24_to_yuv420p, downsample_n_convert_bgr24_to_yuv420p, convert_rgb_to_yuv420, downsample_n_convert_rgb_to_yuv420, PixFcBGR24, PixFcYUV420P, 32, 2, 2, 2, "BGR24 to YUV420P"),
+
+	// BGR24 to NV12
+	DECLARE_NEON_CONV_BLOCKS(convert_bgr24_to_nv12, downsample_n_convert_bgr24_to_nv12, PixFcBGR24, PixFcNV12, 16, 2, "BGR24 to NV12"),
+	DECLARE_CONV_BLOCKS(convert_bgr24_to_nv12, downsample_n_convert_bgr24_to_nv12, convert_rgb_to_yuv420, downsample_n_convert_rgb_to_yuv420, PixFcBGR24, PixFcNV12, 32, 2, 2, 2, "BGR24 to NV12"),
+
+	// BGR24 to NV21
+	DECLARE_NEON_CONV_BLOCKS(convert_bgr24_to_nv21, downsample_n_convert_bgr24_to_nv21, PixFcBGR24, PixFcNV21, 16, 2, "BGR24 to NV21"),
+	DECLARE_CONV_BLOCKS(convert_bgr24_to_nv21, downsample_n_convert_bgr24_to_nv21, convert_rgb_to_yuv420, downsample_n_convert_rgb_to_yuv420, PixFcBGR24, PixFcNV21, 32, 2, 2, 2, "BGR24 to NV21"),
+
+	// BGR24 to P210
+	DECLARE_NNB_ONLY_NONSSE_CONV_BLOCKS(convert_rgb_to_p210, PixFcBGR24, PixFcP210, 2, 1, "BGR24 to P210"),
+
+	// BGR24 to P010
+	DECLARE_NNB_ONLY_NONSSE_CONV_BLOCKS(convert_rgb_to_p210, PixFcBGR24, PixFcP010, 2, 2, "BGR24 to P010"),
 
 	// BGR24 to v210
+	DECLARE_AVX2_CONV_BLOCKS(convert_bgr24_to_v210, downsample_n_convert_bgr24_to_v210, PixFcBGR24, PixFcV210, 16, 1, "BGR24 to v210"),
 	DECLARE_V210_CONV_BLOCKS(convert_bgr24_to_v210, downsample_n_convert_bgr24_to_v210, convert_rgb_to_v210, downsample_n_convert_rgb_to_v210, PixFcBGR24, PixFcV210, 16, 1, 2, 1, "BGR24 to v210"),
 
 	// BGR24 to r210
 	DECLARE_R210_REPACK_CONV_BLOCK(convert_bgr24_to_r210, convert_rgb_to_10bit_rgb, PixFcBGR24, PixFcR210, 16, 1, 2, 1, "BGR24 to r210"),
 
+	// BGR24 to ARGB
+	DECLARE_REPACK_AVX2_CONV_BLOCK(convert_bgr24_to_argb, PixFcBGR24, PixFcARGB, 16, 1, "BGR24 to ARGB"),
+	DECLARE_REPACK_CONV_BLOCK(convert_bgr24_to_argb, convert_rgb_to_any_rgb, PixFcBGR24, PixFcARGB, 16, 1, 2, 1, "BGR24 to ARGB"),
+
+	// BGR24 to BGRA
+	DECLARE_REPACK_AVX2_CONV_BLOCK(convert_bgr24_to_bgra, PixFcBGR24, PixFcBGRA, 16, 1, "BGR24 to BGRA"),
+	DECLARE_REPACK_CONV_BLOCK(convert_bgr24_to_bgra, convert_rgb_to_any_rgb, PixFcBGR24, PixFcBGRA, 16, 1, 2, 1, "BGR24 to BGRA"),
+
+	// BGR24 to RGB24
+	DECLARE_REPACK_AVX2_CONV_BLOCK(convert_bgr24_to_rgb24, PixFcBGR24, PixFcRGB24, 16, 1, "BGR24 to RGB24"),
+	DECLARE_REPACK_CONV_BLOCK(convert_bgr24_to_rgb24, convert_rgb_to_any_rgb, PixFcBGR24, PixFcRGB24, 16, 1, 2, 1, "BGR24 to RGB24"),
+
 	
 	//
 	// YUYV to ARGB
+	DECLARE_AVX2_CONV_BLOCKS(convert_yuyv_to_argb, upsample_n_convert_yuyv_to_argb, PixFcYUYV, PixFcARGB, 16, 1, "YUYV to ARGB"),
 	DECLARE_CONV_BLOCKS(convert_yuyv_to_argb, upsample_n_convert_yuyv_to_argb, convert_yuv422i_to_any_rgb, upsample_n_convert_yuv422i_to_any_rgb, PixFcYUYV, PixFcARGB, 16, 1, 2, 1, "YUYV to ARGB"),
+	DECLARE_DOWNSCALE_CONV_BLOCKS(downscale_n_convert_yuyv_to_argb, downscale_n_convert_yuv422i_to_any_rgb, PixFcYUYV, PixFcARGB, 16, 1, 2, 1, "YUYV to ARGB"),
 
 	// YUYV to BGRA
+	DECLARE_AVX2_CONV_BLOCKS(convert_yuyv_to_bgra, upsample_n_convert_yuyv_to_bgra, PixFcYUYV, PixFcBGRA, 16, 1, "YUYV to BGRA"),
 	DECLARE_CONV_BLOCKS(convert_yuyv_to_bgra, upsample_n_convert_yuyv_to_bgra, convert_yuv422i_to_any_rgb, upsample_n_convert_yuv422i_to_any_rgb, PixFcYUYV, PixFcBGRA, 16, 1, 2, 1, "YUYV to BGRA"),
+	DECLARE_DOWNSCALE_CONV_BLOCKS(downscale_n_convert_yuyv_to_bgra, downscale_n_convert_yuv422i_to_any_rgb, PixFcYUYV, PixFcBGRA, 16, 1, 2, 1, "YUYV to BGRA"),
 
 	// YUYV to RGB24
+	DECLARE_AVX2_CONV_BLOCKS(convert_yuyv_to_rgb24, upsample_n_convert_yuyv_to_rgb24, PixFcYUYV, PixFcRGB24, 16, 1, "YUYV to RGB24"),
 	DECLARE_CONV_BLOCKS(convert_yuyv_to_rgb24, upsample_n_convert_yuyv_to_rgb24, convert_yuv422i_to_any_rgb, upsample_n_convert_yuv422i_to_any_rgb, PixFcYUYV, PixFcRGB24, 16, 1, 2, 1, "YUYV to RGB24"),
+	DECLARE_DOWNSCALE_CONV_BLOCKS(downscale_n_convert_yuyv_to_rgb24, downscale_n_convert_yuv422i_to_any_rgb, PixFcYUYV, PixFcRGB24, 16, 1, 2, 1, "YUYV to RGB24"),
 
 	// YUYV to BGR24
+	DECLARE_AVX2_CONV_BLOCKS(convert_yuyv_to_bgr24, upsample_n_convert_yuyv_to_bgr24, PixFcYUYV, PixFcBGR24, 16, 1, "YUYV to BGR24"),
 	DECLARE_CONV_BLOCKS(convert_yuyv_to_bgr24, upsample_n_convert_yuyv_to_bgr24, convert_yuv422i_to_any_rgb, upsample_n_convert_yuv422i_to_any_rgb, PixFcYUYV, PixFcBGR24, 16, 1, 2, 1, "YUYV to BGR24"),
+	DECLARE_DOWNSCALE_CONV_BLOCKS(downscale_n_convert_yuyv_to_bgr24, downscale_n_convert_yuv422i_to_any_rgb, PixFcYUYV, PixFcBGR24, 16, 1, 2, 1, "YUYV to BGR24"),
 
 	// YUYV to r210
 	DECLARE_R210_CONV_BLOCKS(convert_yuyv_to_r210, upsample_n_convert_yuyv_to_r210, convert_yuv422i_to_any_10bit_rgb, upsample_n_convert_yuv422i_to_any_10bit_rgb, PixFcYUYV, PixFcR210, 16, 1, 2, 1, "YUYV to r210"),
@@ -526,21 +865,44 @@ const struct  ConversionBlock		conversion_blocks[] = {
 	DECLARE_REPACK_CONV_BLOCK(convert_yuyv_to_yuv422p, convert_yuv422i_to_yuv422p, PixFcYUYV, PixFcYUV422P, 32, 1, 2, 1, "YUYV to YUV422P"),
 
 	// YUYV to V210
+	DECLARE_REPACK_AVX512_CONV_BLOCK(convert_yuyv_to_v210, PixFcYUYV, PixFcV210, 2, 1, "YUYV to v210"),
 	DECLARE_V210_REPACK_CONV_BLOCK(convert_yuyv_to_v210, convert_yuv422i_to_v210, PixFcYUYV, PixFcV210, 16, 1, 2, 1, "YUYV to v210"),
 
+	// YUYV to NV12
+	DECLARE_YUV422P_REPACK_CONV_BLOCK(convert_yuyv_to_nv12, convert_yuv422i_to_nv12, PixFcYUYV, PixFcNV12, 32, 2, 2, 2, "YUYV to NV12"),
+
+	// YUYV to NV21
+	DECLARE_YUV422P_REPACK_CONV_BLOCK(convert_yuyv_to_nv21, convert_yuv422i_to_nv12, PixFcYUYV, PixFcNV21, 32, 2, 2, 2, "YUYV to NV21"),
+
+	// YUYV to YUV420P
+	DECLARE_YUV420_REPACK_NEON_CONV_BLOCKS(convert_yuyv_to_yuv420p, downsample_n_convert_yuyv_to_yuv420p, PixFcYUYV, PixFcYUV420P, 32, 2, "YUYV to YUV420P"),
+	DECLARE_YUV420_REPACK_CONV_BLOCKS(convert_yuyv_to_yuv420p, downsample_n_convert_yuyv_to_yuv420p, convert_yuv422i_to_yuv420p, downsample_n_convert_yuv422i_to_yuv420p, PixFcYUYV, PixFcYUV420P, 32, 2, 2, 2, "YUYV to YUV420P"),
+
+	// YUYV to UYVY
+	DECLARE_REPACK_AVX2_CONV_BLOCK(convert_yuyv_to_uyvy, PixFcYUYV, PixFcUYVY, 16, 1, "YUYV to UYVY"),
+	DECLARE_REPACK_CONV_BLOCK(convert_yuyv_to_uyvy, convert_yuv422i_to_yuv422i, PixFcYUYV, PixFcUYVY, 32, 1, 2, 1, "YUYV to UYVY"),
+
 
 	//
 	// UYVY to ARGB
+	DECLARE_AVX2_CONV_BLOCKS(convert_uyvy_to_argb, upsample_n_convert_uyvy_to_argb, PixFcUYVY, PixFcARGB, 16, 1, "UYVY to ARGB"),
 	DECLARE_CONV_BLOCKS(convert_uyvy_to_argb, upsample_n_convert_uyvy_to_argb, convert_yuv422i_to_any_rgb, upsample_n_convert_yuv422i_to_any_rgb, PixFcUYVY, PixFcARGB, 16, 1, 2, 1, "UYVY to ARGB"),
+	DECLARE_DOWNSCALE_CONV_BLOCKS(downscale_n_convert_uyvy_to_argb, downscale_n_convert_yuv422i_to_any_rgb, PixFcUYVY, PixFcARGB, 16, 1, 2, 1, "UYVY to ARGB"),
 
 	// UYVY to BGRA
+	DECLARE_AVX2_CONV_BLOCKS(convert_uyvy_to_bgra, upsample_n_convert_uyvy_to_bgra, PixFcUYVY, PixFcBGRA, 16, 1, "UYVY to BGRA"),
 	DECLARE_CONV_BLOCKS(convert_uyvy_to_bgra, upsample_n_convert_uyvy_to_bgra, convert_yuv422i_to_any_rgb, upsample_n_convert_yuv422i_to_any_rgb, PixFcUYVY, PixFcBGRA, 16, 1, 2, 1, "UYVY to BGRA"),
+	DECLARE_DOWNSCALE_CONV_BLOCKS(downscale_n_convert_uyvy_to_bgra, downscale_n_convert_yuv422i_to_any_rgb, PixFcUYVY, PixFcBGRA, 16, 1, 2, 1, "UYVY to BGRA"),
 
 	// UYVY to RGB24
+	DECLARE_AVX2_CONV_BLOCKS(convert_uyvy_to_rgb24, upsample_n_convert_uyvy_to_rgb24, PixFcUYVY, PixFcRGB24, 16, 1, "UYVY to RGB24"),
 	DECLARE_CONV_BLOCKS(convert_uyvy_to_rgb24, upsample_n_convert_uyvy_to_rgb24, convert_yuv422i_to_any_rgb, upsample_n_convert_yuv422i_to_any_rgb, PixFcUYVY, PixFcRGB24, 16, 1, 2, 1, "UYVY to RGB24"),
+	DECLARE_DOWNSCALE_CONV_BLOCKS(downscale_n_convert_uyvy_to_rgb24, downscale_n_convert_yuv422i_to_any_rgb, PixFcUYVY, PixFcRGB24, 16, 1, 2, 1, "UYVY to RGB24"),
 
 	// UYVY to BGR24
+	DECLARE_AVX2_CONV_BLOCKS(convert_uyvy_to_bgr24, upsample_n_convert_uyvy_to_bgr24, PixFcUYVY, PixFcBGR24, 16, 1, "UYVY to BGR24"),
 	DECLARE_CONV_BLOCKS(convert_uyvy_to_bgr24, upsample_n_convert_uyvy_to_bgr24, convert_yuv422i_to_any_rgb, upsample_n_convert_yuv422i_to_any_rgb, PixFcUYVY, PixFcBGR24, 16, 1, 2, 1, "UYVY to BGR24"),
+	DECLARE_DOWNSCALE_CONV_BLOCKS(downscale_n_convert_uyvy_to_bgr24, downscale_n_convert_yuv422i_to_any_rgb, PixFcUYVY, PixFcBGR24, 16, 1, 2, 1, "UYVY to BGR24"),
 
 	// UYVY to r210
 	DECLARE_R210_CONV_BLOCKS(convert_uyvy_to_r210, upsample_n_convert_uyvy_to_r210, convert_yuv422i_to_any_10bit_rgb, upsample_n_convert_yuv422i_to_any_10bit_rgb, PixFcUYVY, PixFcR210, 16, 1, 2, 1, "UYVY to r210"),
@@ -552,20 +914,39 @@ const struct  ConversionBlock		conversion_blocks[] = {
 	DECLARE_REPACK_CONV_BLOCK(convert_uyvy_to_yuv422p, convert_yuv422i_to_yuv422p, PixFcUYVY, PixFcYUV422P, 32, 1, 2, 1, "UYVY to YUV422P"),
 
 	// UYVY to V210
+	DECLARE_REPACK_AVX512_CONV_BLOCK(convert_uyvy_to_v210, PixFcUYVY, PixFcV210, 2, 1, "UYVY to v210"),
 	DECLARE_V210_REPACK_CONV_BLOCK(convert_uyvy_to_v210, convert_yuv422i_to_v210, PixFcUYVY, PixFcV210, 16, 1, 2, 1, "UYVY to v210"),
 
+	// UYVY to NV12
+	DECLARE_YUV422P_REPACK_CONV_BLOCK(convert_uyvy_to_nv12, convert_yuv422i_to_nv12, PixFcUYVY, PixFcNV12, 32, 2, 2, 2, "UYVY to NV12"),
+
+	// UYVY to NV21
+	DECLARE_YUV422P_REPACK_CONV_BLOCK(convert_uyvy_to_nv21, convert_yuv422i_to_nv12, PixFcUYVY, PixFcNV21, 32, 2, 2, 2, "UYVY to NV21"),
+
+	// UYVY to YUV420P
+	DECLARE_YUV420_REPACK_NEON_CONV_BLOCKS(convert_uyvy_to_yuv420p, downsample_n_convert_uyvy_to_yuv420p, PixFcUYVY, PixFcYUV420P, 32, 2, "UYVY to YUV420P"),
+	DECLARE_YUV420_REPACK_CONV_BLOCKS(convert_uyvy_to_yuv420p, downsample_n_convert_uyvy_to_yuv420p, convert_yuv422i_to_yuv420p, downsample_n_convert_yuv422i_to_yuv420p, PixFcUYVY, PixFcYUV420P, 32, 2, 2, 2, "UYVY to YUV420P"),
+
+	// UYVY to YUYV
+	DECLARE_REPACK_AVX2_CONV_BLOCK(convert_uyvy_to_yuyv, PixFcUYVY, PixFcYUYV, 16, 1, "UYVY to YUYV"),
+	DECLARE_REPACK_CONV_BLOCK(convert_uyvy_to_yuyv, convert_yuv422i_to_yuv422i, PixFcUYVY, PixFcYUYV, 32, 1, 2, 1, "UYVY to YUYV"),
+
 
 	//
 	// YUV422P to ARGB
+	DECLARE_AVX2_CONV_BLOCKS(convert_yuv422p_to_argb, upsample_n_convert_yuv422p_to_argb, PixFcYUV422P, PixFcARGB, 32, 1, "YUV422P to ARGB"),
 	DECLARE_CONV_BLOCKS(convert_yuv422p_to_argb, upsample_n_convert_yuv422p_to_argb, convert_yuv422p_to_any_rgb, upsample_n_convert_yuv422p_to_any_rgb, PixFcYUV422P, PixFcARGB, 32, 1, 2, 1, "YUV422P to ARGB"),
 
 	// YUV422P to BGRA
+	DECLARE_AVX2_CONV_BLOCKS(convert_yuv422p_to_bgra, upsample_n_convert_yuv422p_to_bgra, PixFcYUV422P, PixFcBGRA, 32, 1, "YUV422P to BGRA"),
 	DECLARE_CONV_BLOCKS(convert_yuv422p_to_bgra, upsample_n_convert_yuv422p_to_bgra, convert_yuv422p_to_any_rgb, upsample_n_convert_yuv422p_to_any_rgb, PixFcYUV422P, PixFcBGRA, 32, 1, 2, 1, "YUV422P to BGRA"),
 
 	// YUV422P to RGB24
+	DECLARE_AVX2_CONV_BLOCKS(convert_yuv422p_to_rgb24, upsample_n_convert_yuv422p_to_rgb24, PixFcYUV422P, PixFcRGB24, 32, 1, "YUV422P to RGB24"),
 	DECLARE_CONV_BLOCKS(convert_yuv422p_to_rgb24, upsample_n_convert_yuv422p_to_rgb24, convert_yuv422p_to_any_rgb, upsample_n_convert_yuv422p_to_any_rgb, PixFcYUV422P, PixFcRGB24, 32, 1, 2, 1, "YUV422P to RGB24"),
 
 	// YUV422P to BGR24
+	DECLARE_AVX2_CONV_BLOCKS(convert_yuv422p_to_bgr24, upsample_n_convert_yuv422p_to_bgr24, PixFcYUV422P, PixFcBGR24, 32, 1, "YUV422P to BGR24"),
 	DECLARE_CONV_BLOCKS(convert_yuv422p_to_bgr24, upsample_n_convert_yuv422p_to_bgr24, convert_yuv422p_to_any_rgb, upsample_n_convert_yuv422p_to_any_rgb, PixFcYUV422P, PixFcBGR24, 32, 1, 2, 1, "YUV422P to BGR24"),
 
 	// YUV422P to r210
@@ -580,33 +961,155 @@ const struct  ConversionBlock		conversion_blocks[] = {
 	// YUV422P to UYVY
 	DECLARE_YUV422P_REPACK_CONV_BLOCK(convert_yuv422p_to_uyvy, convert_yuv422p_to_uyvy, PixFcYUV422P, PixFcUYVY, 32, 1, 2, 1, "YUV422P to UYVY"),
 
+	// YUV422P to v210
+	DECLARE_V210_REPACK_CONV_BLOCK(convert_yuv422p_to_v210, convert_yuv42Xp_to_v210, PixFcYUV422P, PixFcV210, 32, 1, 2, 1, "YUV422P to v210"),
+
 	
 	//
 	// YUV420P to ARGB
-	DECLARE_NNB_ONLY_CONV_BLOCKS(convert_yuv420p_to_argb, convert_yuv420p_to_any_rgb, PixFcYUV420P, PixFcARGB, 32, 2, 1, 2, "YUV420P to ARGB"),
+	DECLARE_AVX2_CONV_BLOCKS(convert_yuv420p_to_argb, upsample_n_convert_yuv420p_to_argb, PixFcYUV420P, PixFcARGB, 32, 2, "YUV420P to ARGB"),
+	DECLARE_CONV_BLOCKS(convert_yuv420p_to_argb, upsample_n_convert_yuv420p_to_argb, convert_yuv420p_to_any_rgb, upsample_n_convert_yuv420p_to_any_rgb, PixFcYUV420P, PixFcARGB, 32, 2, 2, 2, "YUV420P to ARGB"),
 	
 	// YUV420P to BGRA
-	DECLARE_NNB_ONLY_CONV_BLOCKS(convert_yuv420p_to_bgra, convert_yuv420p_to_any_rgb, PixFcYUV420P, PixFcBGRA, 32, 2, 1, 2, "YUV420P to BGRA"),
+	DECLARE_AVX2_CONV_BLOCKS(convert_yuv420p_to_bgra, upsample_n_convert_yuv420p_to_bgra, PixFcYUV420P, PixFcBGRA, 32, 2, "YUV420P to BGRA"),
+	DECLARE_CONV_BLOCKS(convert_yuv420p_to_bgra, upsample_n_convert_yuv420p_to_bgra, convert_yuv420p_to_any_rgb, upsample_n_convert_yuv420p_to_any_rgb, PixFcYUV420P, PixFcBGRA, 32, 2, 2, 2, "YUV420P to BGRA"),
 	
 	// YUV420P to RGB24
-	DECLARE_NNB_ONLY_CONV_BLOCKS(convert_yuv420p_to_rgb24, convert_yuv420p_to_any_rgb, PixFcYUV420P, PixFcRGB24, 32, 2, 1, 2, "YUV420P to RGB24"),
+	DECLARE_AVX2_CONV_BLOCKS(convert_yuv420p_to_rgb24, upsample_n_convert_yuv420p_to_rgb24, PixFcYUV420P, PixFcRGB24, 32, 2, "YUV420P to RGB24"),
+	DECLARE_CONV_BLOCKS(convert_yuv420p_to_rgb24, upsample_n_convert_yuv420p_to_rgb24, convert_yuv420p_to_any_rgb, upsample_n_convert_yuv420p_to_any_rgb, PixFcYUV420P, PixFcRGB24, 32, 2, 2, 2, "YUV420P to RGB24"),
 
 	// YUV420P to BGR24
-	DECLARE_NNB_ONLY_CONV_BLOCKS(convert_yuv420p_to_bgr24, convert_yuv420p_to_any_rgb, PixFcYUV420P, PixFcBGR24, 32, 2, 1, 2, "YUV420P to BGR24"),
+	DECLARE_AVX2_CONV_BLOCKS(convert_yuv420p_to_bgr24, upsample_n_convert_yuv420p_to_bgr24, PixFcYUV420P, PixFcBGR24, 32, 2, "YUV420P to BGR24"),
+	DECLARE_CONV_BLOCKS(convert_yuv420p_to_bgr24, upsample_n_convert_yuv420p_to_bgr24, convert_yuv420p_to_any_rgb, upsample_n_convert_yuv420p_to_any_rgb, PixFcYUV420P, PixFcBGR24, 32, 2, 2, 2, "YUV420P to BGR24"),
+
+	// YUV420P to NV12
+	DECLARE_YUV422P_REPACK_CONV_BLOCK(convert_yuv420p_to_nv12, convert_yuv420p_to_nv12, PixFcYUV420P, PixFcNV12, 32, 2, 2, 2, "YUV420P to NV12"),
+
+	// YUV420P to NV21
+	DECLARE_YUV422P_REPACK_CONV_BLOCK(convert_yuv420p_to_nv21, convert_yuv420p_to_nv12, PixFcYUV420P, PixFcNV21, 32, 2, 2, 2, "YUV420P to NV21"),
+
+	// YUV420P to YUYV
+	DECLARE_YUV420_REPACK_CONV_BLOCKS(convert_yuv420p_to_yuyv, upsample_n_convert_yuv420p_to_yuyv, convert_yuv420p_to_yuv422i, upsample_n_convert_yuv420p_to_yuv422i, PixFcYUV420P, PixFcYUYV, 32, 2, 2, 2, "YUV420P to YUYV"),
+
+	// YUV420P to UYVY
+	DECLARE_YUV420_REPACK_CONV_BLOCKS(convert_yuv420p_to_uyvy, upsample_n_convert_yuv420p_to_uyvy, convert_yuv420p_to_yuv422i, upsample_n_convert_yuv420p_to_yuv422i, PixFcYUV420P, PixFcUYVY, 32, 2, 2, 2, "YUV420P to UYVY"),
+
+	// YUV420P to v210
+	DECLARE_V210_REPACK_CONV_BLOCK(convert_yuv420p_to_v210, convert_yuv42Xp_to_v210, PixFcYUV420P, PixFcV210, 32, 2, 2, 2, "YUV420P to v210"),
+
+
+	//
+	// NV12 to ARGB
+	DECLARE_NNB_ONLY_CONV_BLOCKS(convert_nv12_to_argb, convert_nv12_to_any_rgb, PixFcNV12, PixFcARGB, 32, 2, 2, 2, "NV12 to ARGB"),
+
+	// NV12 to BGRA
+	DECLARE_NNB_ONLY_CONV_BLOCKS(convert_nv12_to_bgra, convert_nv12_to_any_rgb, PixFcNV12, PixFcBGRA, 32, 2, 2, 2, "NV12 to BGRA"),
+
+	// NV12 to RGB24
+	DECLARE_NNB_ONLY_CONV_BLOCKS(convert_nv12_to_rgb24, convert_nv12_to_any_rgb, PixFcNV12, PixFcRGB24, 32, 2, 2, 2, "NV12 to RGB24"),
+
+	// NV12 to BGR24
+	DECLARE_NNB_ONLY_CONV_BLOCKS(convert_nv12_to_bgr24, convert_nv12_to_any_rgb, PixFcNV12, PixFcBGR24, 32, 2, 2, 2, "NV12 to BGR24"),
+
+	// NV12 to YUYV
+	DECLARE_YUV422P_REPACK_CONV_BLOCK(convert_nv12_to_yuyv, convert_nv12_to_yuv422i, PixFcNV12, PixFcYUYV, 32, 2, 2, 2, "NV12 to YUYV"),
+
+	// NV12 to UYVY
+	DECLARE_YUV422P_REPACK_CONV_BLOCK(convert_nv12_to_uyvy, convert_nv12_to_yuv422i, PixFcNV12, PixFcUYVY, 32, 2, 2, 2, "NV12 to UYVY"),
+
+	// NV12 to YUV420P
+	DECLARE_YUV422P_REPACK_CONV_BLOCK(convert_nv12_to_yuv420p, convert_nv12_to_yuv420p, PixFcNV12, PixFcYUV420P, 32, 2, 2, 2, "NV12 to YUV420P"),
+
+
+	//
+	// NV21 to ARGB
+	DECLARE_NNB_ONLY_CONV_BLOCKS(convert_nv21_to_argb, convert_nv12_to_any_rgb, PixFcNV21, PixFcARGB, 32, 2, 2, 2, "NV21 to ARGB"),
+
+	// NV21 to BGRA
+	DECLARE_NNB_ONLY_CONV_BLOCKS(convert_nv21_to_bgra, convert_nv12_to_any_rgb, PixFcNV21, PixFcBGRA, 32, 2, 2, 2, "NV21 to BGRA"),
+
+	// NV21 to RGB24
+	DECLARE_NNB_ONLY_CONV_BLOCKS(convert_nv21_to_rgb24, convert_nv12_to_any_rgb, PixFcNV21, PixFcRGB24, 32, 2, 2, 2, "NV21 to RGB24"),
+
+	// NV21 to BGR24
+	DECLARE_NNB_ONLY_CONV_BLOCKS(convert_nv21_to_bgr24, convert_nv12_to_any_rgb, PixFcNV21, PixFcBGR24, 32, 2, 2, 2, "NV21 to BGR24"),
+
+	// NV21 to YUYV
+	DECLARE_YUV422P_REPACK_CONV_BLOCK(convert_nv21_to_yuyv, convert_nv12_to_yuv422i, PixFcNV21, PixFcYUYV, 32, 2, 2, 2, "NV21 to YUYV"),
+
+	// NV21 to UYVY
+	DECLARE_YUV422P_REPACK_CONV_BLOCK(convert_nv21_to_uyvy, convert_nv12_to_yuv422i, PixFcNV21, PixFcUYVY, 32, 2, 2, 2, "NV21 to UYVY"),
+
+	// NV21 to YUV420P
+	DECLARE_YUV422P_REPACK_CONV_BLOCK(convert_nv21_to_yuv420p, convert_nv12_to_yuv420p, PixFcNV21, PixFcYUV420P, 32, 2, 2, 2, "NV21 to YUV420P"),
+
+
+	//
+	// P210 to ARGB
+	DECLARE_NNB_ONLY_SSE2_SSSE3_CONV_BLOCKS(convert_p210_to_argb, convert_p210_to_any_rgb, PixFcP210, PixFcARGB, 16, 1, 2, 1, "P210 to ARGB"),
+
+	// P210 to BGRA
+	DECLARE_NNB_ONLY_SSE2_SSSE3_CONV_BLOCKS(convert_p210_to_bgra, convert_p210_to_any_rgb, PixFcP210, PixFcBGRA, 16, 1, 2, 1, "P210 to BGRA"),
+
+	// P210 to RGB24
+	DECLARE_NNB_ONLY_SSE2_SSSE3_CONV_BLOCKS(convert_p210_to_rgb24, convert_p210_to_any_rgb, PixFcP210, PixFcRGB24, 16, 1, 2, 1, "P210 to RGB24"),
+
+	// P210 to BGR24
+	DECLARE_NNB_ONLY_SSE2_SSSE3_CONV_BLOCKS(convert_p210_to_bgr24, convert_p210_to_any_rgb, PixFcP210, PixFcBGR24, 16, 1, 2, 1, "P210 to BGR24"),
+
+	// P210 to r210
+	DECLARE_NNB_ONLY_SSE2_SSSE3_CONV_BLOCKS(convert_p210_to_r210, convert_p210_to_any_10bit_rgb, PixFcP210, PixFcR210, 16, 1, 2, 1, "P210 to r210"),
+
+	// P210 to r10k
+	DECLARE_NNB_ONLY_SSE2_SSSE3_CONV_BLOCKS(convert_p210_to_r10k, convert_p210_to_any_10bit_rgb, PixFcP210, PixFcR10k, 16, 1, 2, 1, "P210 to r10k"),
+
+	// P210 to v210
+	DECLARE_V210_REPACK_CONV_BLOCK(convert_p210_to_v210, convert_p210_to_v210, PixFcP210, PixFcV210, 16, 1, 2, 1, "P210 to v210"),
+
+
+	//
+	// P010 to ARGB
+	DECLARE_NNB_ONLY_SSE2_SSSE3_CONV_BLOCKS(convert_p010_to_argb, convert_p210_to_any_rgb, PixFcP010, PixFcARGB, 32, 2, 2, 2, "P010 to ARGB"),
+
+	// P010 to BGRA
+	DECLARE_NNB_ONLY_SSE2_SSSE3_CONV_BLOCKS(convert_p010_to_bgra, convert_p210_to_any_rgb, PixFcP010, PixFcBGRA, 32, 2, 2, 2, "P010 to BGRA"),
+
+	// P010 to RGB24
+	DECLARE_NNB_ONLY_SSE2_SSSE3_CONV_BLOCKS(convert_p010_to_rgb24, convert_p210_to_any_rgb, PixFcP010, PixFcRGB24, 32, 2, 2, 2, "P010 to RGB24"),
+
+	// P010 to BGR24
+	DECLARE_NNB_ONLY_SSE2_SSSE3_CONV_BLOCKS(convert_p010_to_bgr24, convert_p210_to_any_rgb, PixFcP010, PixFcBGR24, 32, 2, 2, 2, "P010 to BGR24"),
+
+	// P010 to r210
+	DECLARE_NNB_ONLY_SSE2_SSSE3_CONV_BLOCKS(convert_p010_to_r210, convert_p210_to_any_10bit_rgb, PixFcP010, PixFcR210, 32, 2, 2, 2, "P010 to r210"),
+
+	// P010 to r10k
+	DECLARE_NNB_ONLY_SSE2_SSSE3_CONV_BLOCKS(convert_p010_to_r10k, convert_p210_to_any_10bit_rgb, PixFcP010, PixFcR10k, 32, 2, 2, 2, "P010 to r10k"),
+
+	// P010 to v210
+	DECLARE_V210_REPACK_CONV_BLOCK(convert_p010_to_v210, convert_p210_to_v210, PixFcP010, PixFcV210, 32, 2, 2, 2, "P010 to v210"),
 
 
 	//
 	// v210 to ARGB
+	DECLARE_AVX512_CONV_BLOCKS(convert_v210_to_argb, upsample_n_convert_v210_to_argb, PixFcV210, PixFcARGB, 16, 1, "v210 to ARGB"),
 	DECLARE_V210_CONV_BLOCKS(convert_v210_to_argb, upsample_n_convert_v210_to_argb, convert_v210_to_any_rgb, upsample_n_convert_v210_to_any_rgb, PixFcV210, PixFcARGB, 16, 1, 2, 1, "v210 to ARGB"),
+	DECLARE_V210_DOWNSCALE_CONV_BLOCKS(downscale_n_convert_v210_to_argb, downscale_n_convert_v210_to_any_rgb, PixFcV210, PixFcARGB, 48, 1, 2, 1, "v210 to ARGB"),
 
 	// v210 to BGRA
+	DECLARE_AVX512_CONV_BLOCKS(convert_v210_to_bgra, upsample_n_convert_v210_to_bgra, PixFcV210, PixFcBGRA, 16, 1, "v210 to BGRA"),
 	DECLARE_V210_CONV_BLOCKS(convert_v210_to_bgra, upsample_n_convert_v210_to_bgra, convert_v210_to_any_rgb, upsample_n_convert_v210_to_any_rgb, PixFcV210, PixFcBGRA, 16, 1, 2, 1, "v210 to BGRA"),
+	DECLARE_V210_DOWNSCALE_CONV_BLOCKS(downscale_n_convert_v210_to_bgra, downscale_n_convert_v210_to_any_rgb, PixFcV210, PixFcBGRA, 48, 1, 2, 1, "v210 to BGRA"),
 
 	// v210 to RGB24
+	DECLARE_AVX512_CONV_BLOCKS(convert_v210_to_rgb24, upsample_n_convert_v210_to_rgb24, PixFcV210, PixFcRGB24, 16, 1, "v210 to RGB24"),
 	DECLARE_V210_CONV_BLOCKS(convert_v210_to_rgb24, upsample_n_convert_v210_to_rgb24, convert_v210_to_any_rgb, upsample_n_convert_v210_to_any_rgb, PixFcV210, PixFcRGB24, 16, 1, 2, 1, "v210 to RGB24"),
+	DECLARE_V210_DOWNSCALE_CONV_BLOCKS(downscale_n_convert_v210_to_rgb24, downscale_n_convert_v210_to_any_rgb, PixFcV210, PixFcRGB24, 48, 1, 2, 1, "v210 to RGB24"),
 
 	// v210 to BGR24
+	DECLARE_AVX512_CONV_BLOCKS(convert_v210_to_bgr24, upsample_n_convert_v210_to_bgr24, PixFcV210, PixFcBGR24, 16, 1, "v210 to BGR24"),
 	DECLARE_V210_CONV_BLOCKS(convert_v210_to_bgr24, upsample_n_convert_v210_to_bgr24, convert_v210_to_any_rgb, upsample_n_convert_v210_to_any_rgb, PixFcV210, PixFcBGR24, 16, 1, 2, 1, "v210 to BGR24"),
+	DECLARE_V210_DOWNSCALE_CONV_BLOCKS(downscale_n_convert_v210_to_bgr24, downscale_n_convert_v210_to_any_rgb, PixFcV210, PixFcBGR24, 48, 1, 2, 1, "v210 to BGR24"),
 
 	// v210 to r210
 	DECLARE_R210_CONV_BLOCKS(convert_v210_to_r210, upsample_n_convert_v210_to_r210, convert_v210_to_any_10bit_rgb, upsample_n_convert_v210_to_any_10bit_rgb, PixFcV210, PixFcR210, 8, 1, 2, 1, "v210 to r210"),
@@ -615,13 +1118,84 @@ const struct  ConversionBlock		conversion_blocks[] = {
 	DECLARE_R210_CONV_BLOCKS(convert_v210_to_r10k, upsample_n_convert_v210_to_r10k, convert_v210_to_any_10bit_rgb, upsample_n_convert_v210_to_any_10bit_rgb, PixFcV210, PixFcR10k, 8, 1, 2, 1, "v210 to r10k"),
 
 	// v210 to YUYV
+	DECLARE_REPACK_AVX512_CONV_BLOCK(convert_v210_to_yuyv, PixFcV210, PixFcYUYV, 2, 1, "v210 to YUYV"),
 	DECLARE_V210_REPACK_CONV_BLOCK(convert_v210_to_yuyv, convert_v210_to_yuv422i, PixFcV210, PixFcYUYV, 16, 1, 2, 1, "v210 to YUYV"),
 
 	// v210 to UYVY
+	DECLARE_REPACK_AVX512_CONV_BLOCK(convert_v210_to_uyvy, PixFcV210, PixFcUYVY, 2, 1, "v210 to UYVY"),
 	DECLARE_V210_REPACK_CONV_BLOCK(convert_v210_to_uyvy, convert_v210_to_yuv422i, PixFcV210, PixFcUYVY, 16, 1, 2, 1, "v210 to UYVY"),
+
+	// v210 to YUV422P
+	DECLARE_V210_REPACK_CONV_BLOCK(convert_v210_to_yuv422p, convert_v210_to_yuv422p, PixFcV210, PixFcYUV422P, 32, 1, 2, 1, "v210 to YUV422P"),
+
+	// v210 to P210
+	DECLARE_V210_REPACK_CONV_BLOCK(convert_v210_to_p210, convert_v210_to_p210, PixFcV210, PixFcP210, 16, 1, 2, 1, "v210 to P210"),
+
+	// v210 to P010
+	DECLARE_V210_REPACK_CONV_BLOCK(convert_v210_to_p010, convert_v210_to_p210, PixFcV210, PixFcP010, 32, 2, 2, 2, "v210 to P010"),
 };
 
 
 const uint32_t		conversion_blocks_count = sizeof(conversion_blocks) / sizeof(conversion_blocks[0]);
 
 
+
+
+/*
+ * Index of the conversion blocks, built on first use by
+ * build_conversion_block_index():
+ * - conversion_block_ranges[src][dst] is the range of consecutive blocks
+ *   converting from src to dst in conversion_blocks[],
+ * - conversion_block_cpu_support[i] is 0 if the CPU supports the features
+ *   required by conversion_blocks[i], -1 otherwise.
+ * Building the index is idempotent, so concurrent first uses only end up
+ * writing the same values twice.
+ */
+struct ConversionBlockRange {
+	uint16_t	first;
+	uint16_t	count;
+};
+
+static struct ConversionBlockRange	conversion_block_ranges[PixFcFormatCount][PixFcFormatCount];
+static uint32_t						conversion_block_cpu_support[sizeof(conversion_blocks) / sizeof(conversion_blocks[0])];
+static volatile uint32_t			conversion_block_index_ready = 0;
+
+static void		build_conversion_block_index() {
+	uint32_t						index;
+	const struct ConversionBlock *	block;
+	struct ConversionBlockRange *	range;
+
+	for(index = 0; index < conversion_blocks_count; index++) {
+		block = &conversion_blocks[index];
+		range = &conversion_block_ranges[block->source_fmt][block->dest_fmt];
+
+		// Blocks for the same conversion are declared next to each other
+		if (range->count == 0)
+			range->first = (uint16_t) index;
+		range->count = (uint16_t) (index + 1 - range->first);
+
+		conversion_block_cpu_support[index] = does_cpu_support(block->required_cpu_features);
+	}
+
+	conversion_block_index_ready = 1;
+}
+
+uint32_t		get_conversion_block_range(PixFcPixelFormat source_fmt, PixFcPixelFormat dest_fmt, uint32_t *count) {
+	if (conversion_block_index_ready == 0)
+		build_conversion_block_index();
+
+	if ((source_fmt >= PixFcFormatCount) || (dest_fmt >= PixFcFormatCount)) {
+		*count = 0;
+		return 0;
+	}
+
+	*count = conversion_block_ranges[source_fmt][dest_fmt].count;
+	return conversion_block_ranges[source_fmt][dest_fmt].first;
+}
+
+uint32_t		is_conversion_block_supported(uint32_t index) {
+	if (conversion_block_index_ready == 0)
+		build_conversion_block_index();
+
+	return conversion_block_cpu_support[index];
+}
@@ -36,6 +36,13 @@
 #define BT709_CONVERSION			(1 << 3)
 // Set if a conversion routine uses non-SSE float math (implies required_cpu_features == CPUID_FEATURE_NONE)
 #define NONSSE_FLOAT_CONVERSION		(1 << 4)
+// Set if a conversion routine downscales the image by 2, by 4 or by any
+// integer factor (see PixFcFlag_Downscale2x). The width & height multiples
+// of these conversion blocks apply to the downscaled (output) image.
+#define DOWNSCALE_2X				(1 << 5)
+#define DOWNSCALE_4X				(1 << 6)
+#define DOWNSCALE_NX				(1 << 7)
+#define DOWNSCALE_CONVERSION		(DOWNSCALE_2X | DOWNSCALE_4X | DOWNSCALE_NX)
 
 /*
  * A ConversionBlock is a structure grouping together 
@@ -75,6 +82,24 @@ struct ConversionBlock{
 extern const struct ConversionBlock		conversion_blocks[];
 extern const uint32_t					conversion_blocks_count;
 
+/*
+ * Return the index of the first conversion block converting from 'source_fmt'
+ * to 'dest_fmt' in conversion_blocks[], and set 'count' to the number of such
+ * blocks ('count' is set to 0 if there are none). This relies on all
+ * conversion blocks for a given pair of formats being declared next to each
+ * other in conversion_blocks[].
+ * (Implemented in conversion_blocks.c)
+ */
+uint32_t		get_conversion_block_range(PixFcPixelFormat source_fmt, PixFcPixelFormat dest_fmt, uint32_t *count);
+
+/*
+ * Return 0 if the CPU has the features required by the conversion block
+ * at 'index' in conversion_blocks[], -1 otherwise. The result of
+ * does_cpu_support() is computed once for every block and cached.
+ * (Implemented in conversion_blocks.c)
+ */
+uint32_t		is_conversion_block_supported(uint32_t index);
+
 
 #endif /* CONVERSION_BLOCK_H_ */
 
@@ -22,16 +22,6 @@
 #include "pixfc-sse.h"
 #include "rgb_conversion_recipes.h"
 
-#define CONVERT_TO_YUV422I(pack_fn, instr_set)\
-		DO_CONVERSION_1U_1P(\
-				RGB32_TO_YUV422I_RECIPE,\
-				unpack_argb_to_r_g_b_vectors_,\
-				pack_fn,\
-				convert_r_g_b_vectors_to_y_vector_sse2,\
-				convert_downsampled_422_r_g_b_vectors_to_uv_vector_sse2,\
-				instr_set\
-		)
-
 #define CONVERT2_TO_YUV422I(pack_fn, instr_set)\
 		DO_CONVERSION_1U_1P(\
 				RGB32_TO_YUV422I_RECIPE2,\
@@ -42,16 +32,6 @@
 				instr_set\
 		)
 
-#define DOWNSAMPLE_N_CONVERT_TO_YUV422I(pack_fn, instr_set)\
-		DO_CONVERSION_1U_1P(\
-				AVG_DOWNSAMPLE_RGB32_TO_YUV422I_RECIPE,\
-				unpack_argb_to_r_g_b_vectors_,\
-				pack_fn,\
-				convert_r_g_b_vectors_to_y_vector_sse2,\
-				convert_downsampled_422_r_g_b_vectors_to_uv_vector_sse2,\
-				instr_set\
-		)
-
 #define DOWNSAMPLE_N_CONVERT2_TO_YUV422I(pack_fn, instr_set)\
 		DO_CONVERSION_1U_1P(\
 				AVG_DOWNSAMPLE_RGB32_TO_YUV422I_RECIPE2,\
@@ -62,17 +42,6 @@
 				instr_set\
 		)
 
-#define CONVERT_TO_YUV422P(instr_set)\
-		DO_CONVERSION_1U_2P(\
-				RGB32_TO_YUV422P_RECIPE,\
-				unpack_argb_to_r_g_b_vectors_,\
-				pack_4_y_uv_422_vectors_to_yuvp_lo_vectors_sse2,\
-				pack_4_y_uv_422_vectors_to_yuvp_hi_vectors_sse2,\
-				convert_r_g_b_vectors_to_y_vector_sse2,\
-				convert_downsampled_422_r_g_b_vectors_to_uv_vector_sse2,\
-				instr_set\
-		)
-
 #define CONVERT2_TO_YUV422P(instr_set)\
 		DO_CONVERSION_1U_2P(\
 				RGB32_TO_YUV422P_RECIPE2,\
@@ -84,17 +53,6 @@
 				instr_set\
 		)
 
-#define DOWNSAMPLE_N_CONVERT_TO_YUV422P(instr_set)\
-		DO_CONVERSION_1U_2P(\
-				AVG_DOWNSAMPLE_RGB32_TO_YUV422P_RECIPE,\
-				unpack_argb_to_r_g_b_vectors_,\
-				pack_4_y_uv_422_vectors_to_yuvp_lo_vectors_sse2,\
-				pack_4_y_uv_422_vectors_to_yuvp_hi_vectors_sse2,\
-				convert_r_g_b_vectors_to_y_vector_sse2,\
-				convert_downsampled_422_r_g_b_vectors_to_uv_vector_sse2,\
-				instr_set\
-		)
-
 #define DOWNSAMPLE_N_CONVERT2_TO_YUV422P(instr_set)\
 		DO_CONVERSION_1U_2P(\
 				AVG_DOWNSAMPLE_RGB32_TO_YUV422P_RECIPE2,\
@@ -106,9 +64,9 @@
 				instr_set\
 		)
 
-#define CONVERT_TO_YUV420P(instr_set)\
+#define DOWNSAMPLE_N_CONVERT_TO_YUV420P(instr_set)\
 		DO_CONVERSION_1U_2P(\
-				RGB32_TO_YUV420P_RECIPE,\
+				AVG_DOWNSAMPLE_RGB32_TO_YUV420P_RECIPE,\
 				unpack_argb_to_r_g_b_vectors_,\
 				pack_2_y_vectors_to_1_y_vector_sse2,\
 				pack_4_uv_vectors_to_yup_vectors_sse2,\
@@ -128,25 +86,28 @@
 				instr_set\
 		)
 
-#define CONVERT_TO_V210(instr_set)\
-		DO_CONVERSION_1U_1P(\
-				RGB32_TO_V210_RECIPE,\
-				unpack_argb_to_r_g_b_vectors_sse2_ssse3,\
-				pack_6_y_uv_vectors_to_4_v210_vectors_ ## instr_set,\
-				convert_8bit_r_g_b_vectors_to_10bit_y_vector_sse2,\
-				convert_downsampled_422_8bit_r_g_b_vectors_to_10bit_uv_vector_sse2,\
+#define DOWNSAMPLE_N_CONVERT_TO_NV12(uv_pack_fn, instr_set)\
+		DO_CONVERSION_1U_2P(\
+				AVG_DOWNSAMPLE_RGB32_TO_NV12_RECIPE,\
+				unpack_argb_to_r_g_b_vectors_,\
+				pack_2_y_vectors_to_1_y_vector_sse2,\
+				uv_pack_fn,\
+				convert_r_g_b_vectors_to_y_vector_sse2,\
+				convert_downsampled_422_r_g_b_vectors_to_uv_vector_sse2,\
 				instr_set\
 		)
 
-#define DOWNSAMPLE_N_CONVERT_TO_V210(instr_set)\
-		DO_CONVERSION_1U_1P(\
-				AVG_DOWNSAMPLE_RGB32_TO_V210_RECIPE,\
-				unpack_argb_to_r_g_b_vectors_sse2_ssse3,\
-				pack_6_y_uv_vectors_to_4_v210_vectors_ ## instr_set,\
-				convert_8bit_r_g_b_vectors_to_10bit_y_vector_sse2,\
-				convert_downsampled_422_8bit_r_g_b_vectors_to_10bit_uv_vector_sse2,\
+#define CONVERT2_TO_NV12(uv_pack_fn, instr_set)\
+		DO_CONVERSION_1U_2P(\
+				RGB32_TO_NV12_RECIPE2,\
+				unpack_argb_to_ag_rb_vectors_,\
+				pack_2_y_vectors_to_1_y_vector_sse2,\
+				uv_pack_fn,\
+				convert_ag_rb_vectors_to_y_vector_sse2,\
+				convert_downsampled_422_ag_rb_vectors_to_uv_vector_sse2,\
 				instr_set\
 		)
+
 /*
  * We have 2 RGB to YUV422 conversion implementations:
  * - The first one unpacks 8 pixels into 3 16bit vectors R,G & B.
@@ -182,16 +143,6 @@
  * The second implementation is used for SSE2-only routines
  */
 
-// ARGB to YUYV			SSE2 SSSE3
-void		convert_argb_to_yuyv_sse2_ssse3(const struct PixFcSSE *pixfc, void* source_buffer, void* dest_buffer) {
-	CONVERT_TO_YUV422I(pack_4_y_uv_422_vectors_in_2_yuyv_vectors_sse2, sse2_ssse3);
-}
-
-void		downsample_n_convert_argb_to_yuyv_sse2_ssse3(const struct PixFcSSE *pixfc, void* source_buffer, void* dest_buffer) {
-	DOWNSAMPLE_N_CONVERT_TO_YUV422I(pack_4_y_uv_422_vectors_in_2_yuyv_vectors_sse2, sse2_ssse3);
-}
-
-
 // ARGB to YUYV			SSE2
 void		convert_argb_to_yuyv_sse2(const struct PixFcSSE *pixfc, void* source_buffer, void* dest_buffer) {
 	CONVERT2_TO_YUV422I(pack_4_y_uv_422_vectors_in_2_yuyv_vectors_sse2, sse2);
@@ -202,16 +153,6 @@ void		downsample_n_convert_argb_to_yuyv_sse2(const struct PixFcSSE *pixfc, void*
 }
 
 
-// ARGB to UYVY			SSE2 SSSE3
-void		convert_argb_to_uyvy_sse2_ssse3(const struct PixFcSSE *pixfc, void* source_buffer, void* dest_buffer) {
-	CONVERT_TO_YUV422I(pack_4_y_uv_422_vectors_in_2_uyvy_vectors_sse2, sse2_ssse3);
-}
-
-void		downsample_n_convert_argb_to_uyvy_sse2_ssse3(const struct PixFcSSE *pixfc, void* source_buffer, void* dest_buffer) {
-	DOWNSAMPLE_N_CONVERT_TO_YUV422I(pack_4_y_uv_422_vectors_in_2_uyvy_vectors_sse2, sse2_ssse3);
-}
-
-
 // ARGB to UYVY			SSE2
 void		convert_argb_to_uyvy_sse2(const struct PixFcSSE *pixfc, void* source_buffer, void* dest_buffer) {
 	CONVERT2_TO_YUV422I(pack_4_y_uv_422_vectors_in_2_uyvy_vectors_sse2, sse2);
@@ -222,16 +163,6 @@ void		downsample_n_convert_argb_to_uyvy_sse2(const struct PixFcSSE *pixfc, void*
 }
 
 
-// ARGB to YUV422P			SSE2 SSSE3
-void		convert_argb_to_yuv422p_sse2_ssse3(const struct PixFcSSE *pixfc, void* source_buffer, void* dest_buffer) {
-	CONVERT_TO_YUV422P(sse2_ssse3);
-}
-
-void		downsample_n_convert_argb_to_yuv422p_sse2_ssse3(const struct PixFcSSE *pixfc, void* source_buffer, void* dest_buffer) {
-	DOWNSAMPLE_N_CONVERT_TO_YUV422P(sse2_ssse3);
-}
-
-
 // ARGB to YUV422P			SSE2
 void		convert_argb_to_yuv422p_sse2(const struct PixFcSSE *pixfc, void* source_buffer, void* dest_buffer) {
 	CONVERT2_TO_YUV422P(sse2);
@@ -242,33 +173,74 @@ void		downsample_n_convert_argb_to_yuv422p_sse2(const struct PixFcSSE *pixfc, vo
 }
 
 
-// ARGB to YUV420P			SSE2 SSSE3
-void		convert_argb_to_yuv420p_sse2_ssse3(const struct PixFcSSE *pixfc, void* source_buffer, void* dest_buffer) {
-	CONVERT_TO_YUV420P(sse2_ssse3);
-}
-
 // ARGB to YUV420P			SSE2
 void		convert_argb_to_yuv420p_sse2(const struct PixFcSSE *pixfc, void* source_buffer, void* dest_buffer) {
 	CONVERT2_TO_YUV420P(sse2);
 }
 
+void		downsample_n_convert_argb_to_yuv420p_sse2(const struct PixFcSSE *pixfc, void* source_buffer, void* dest_buffer) {
+	DOWNSAMPLE_N_CONVERT_TO_YUV420P(sse2);
+}
+
+// ARGB to NV12			SSE2
+void		convert_argb_to_nv12_sse2(const struct PixFcSSE *pixfc, void* source_buffer, void* dest_buffer) {
+	CONVERT2_TO_NV12(pack_4_uv_vectors_to_nv12_vectors_sse2, sse2);
+}
 
-// ARGB to V210				SSE2 SSSE3 SSE41
-void		convert_argb_to_v210_sse2_ssse3_sse41(const struct PixFcSSE *pixfc, void* source_buffer, void* dest_buffer) {
-	CONVERT_TO_V210(sse2_ssse3_sse41);
+void		downsample_n_convert_argb_to_nv12_sse2(const struct PixFcSSE *pixfc, void* source_buffer, void* dest_buffer) {
+	DOWNSAMPLE_N_CONVERT_TO_NV12(pack_4_uv_vectors_to_nv12_vectors_sse2, sse2);
 }
 
-void		downsample_n_convert_argb_to_v210_sse2_ssse3_sse41(const struct PixFcSSE *pixfc, void* source_buffer, void* dest_buffer) {
-	DOWNSAMPLE_N_CONVERT_TO_V210(sse2_ssse3_sse41);
+// ARGB to NV21			SSE2
+void		convert_argb_to_nv21_sse2(const struct PixFcSSE *pixfc, void* source_buffer, void* dest_buffer) {
+	CONVERT2_TO_NV12(pack_4_uv_vectors_to_nv21_vectors_sse2, sse2);
 }
 
-// ARGB to V210				SSE2 SSSE3
-void		convert_argb_to_v210_sse2_ssse3(const struct PixFcSSE *pixfc, void* source_buffer, void* dest_buffer) {
-	CONVERT_TO_V210(sse2_ssse3);
+void		downsample_n_convert_argb_to_nv21_sse2(const struct PixFcSSE *pixfc, void* source_buffer, void* dest_buffer) {
+	DOWNSAMPLE_N_CONVERT_TO_NV12(pack_4_uv_vectors_to_nv21_vectors_sse2, sse2);
 }
 
-void		downsample_n_convert_argb_to_v210_sse2_ssse3(const struct PixFcSSE *pixfc, void* source_buffer, void* dest_buffer) {
-	DOWNSAMPLE_N_CONVERT_TO_V210(sse2_ssse3);
+
+/*
+ * Unpack 16 ARGB pixels to R, G & B vectors and pack them in the
+ * destination format (see RGB_TO_RGB_RECIPE).
+ */
+#define CONVERT_TO_RGB(pack_fn, output_stride, instr_set)\
+		DO_CONVERSION_1U_1P(\
+				RGB_TO_RGB_RECIPE,\
+				unpack_argb_to_r_g_b_vectors_##instr_set,\
+				pack_fn,\
+				UNPACK_16_RGB32_PIXELS,\
+				4,\
+				output_stride\
+		)
+
+
+/*
+ *
+ * 		A R G B
+ *
+ * 		T O
+ *
+ * 		B G R A
+ *
+ */
+void		convert_argb_to_bgra_sse2(const struct PixFcSSE *pixfc, void *source_buffer, void *dest_buffer) {
+	DO_CONVERSION_1U_1P(RGB32_TO_RGB32_RECIPE, reverse_rgb32_byte_order_sse2, store_4_rgb32_vectors_sse2, 4);
+}
+
+
+/*
+ *
+ * 		A R G B
+ *
+ * 		T O
+ *
+ * 		R G B 2 4
+ *
+ */
+void		convert_argb_to_rgb24_sse2(const struct PixFcSSE *pixfc, void *source_buffer, void *dest_buffer) {
+	CONVERT_TO_RGB(pack_6_rgb_vectors_to_3_rgb24_vectors_sse2_slowpacking, 3, sse2);
 }
 
 
@@ -278,9 +250,9 @@ void		downsample_n_convert_argb_to_v210_sse2_ssse3(const struct PixFcSSE *pixfc,
  *
  * 		T O
  *
- * 		R 2 1 0
+ * 		B G R 2 4
  *
  */
-void		convert_argb_to_r210_sse2_ssse3(const struct PixFcSSE *pixfc, void *source_buffer, void *dest_buffer) {
-	DO_REPACK2(RGB32_TO_R210_RECIPE, unpack_argb_to_r_g_b_vectors_sse2_ssse3, pack_3_r_g_b_vectors_to_2_r210_sse2_ssse3);
+void		convert_argb_to_bgr24_sse2(const struct PixFcSSE *pixfc, void *source_buffer, void *dest_buffer) {
+	CONVERT_TO_RGB(pack_6_rgb_vectors_to_3_bgr24_vectors_sse2_slowpacking, 3, sse2);
 }
@@ -60,8 +60,22 @@ void		downsample_n_convert_argb_to_yuv422p_sse2(const struct PixFcSSE *, void*,
 
 // ARGB to YUV420P			SSE2 SSSE3
 void		convert_argb_to_yuv420p_sse2_ssse3(const struct PixFcSSE *, void*, void*);
+void		downsample_n_convert_argb_to_yuv420p_sse2_ssse3(const struct PixFcSSE *, void*, void*);
 // ARGB to YUV420P			SSE2
 void		convert_argb_to_yuv420p_sse2(const struct PixFcSSE *, void*, void*);
+void		downsample_n_convert_argb_to_yuv420p_sse2(const struct PixFcSSE *, void*, void*);
+// ARGB to NV12			SSE2 SSSE3
+void		convert_argb_to_nv12_sse2_ssse3(const struct PixFcSSE *, void*, void*);
+void		downsample_n_convert_argb_to_nv12_sse2_ssse3(const struct PixFcSSE *, void*, void*);
+// ARGB to NV12			SSE2
+void		convert_argb_to_nv12_sse2(const struct PixFcSSE *, void*, void*);
+void		downsample_n_convert_argb_to_nv12_sse2(const struct PixFcSSE *, void*, void*);
+// ARGB to NV21			SSE2 SSSE3
+void		convert_argb_to_nv21_sse2_ssse3(const struct PixFcSSE *, void*, void*);
+void		downsample_n_convert_argb_to_nv21_sse2_ssse3(const struct PixFcSSE *, void*, void*);
+// ARGB to NV21			SSE2
+void		convert_argb_to_nv21_sse2(const struct PixFcSSE *, void*, void*);
+void		downsample_n_convert_argb_to_nv21_sse2(const struct PixFcSSE *, void*, void*);
 
 
 // ARGB to V210			SSE2 SSSE3
@@ -113,8 +127,22 @@ void		downsample_n_convert_argb_to_yuv422p_bt601_sse2(const struct PixFcSSE *, v
 
 // ARGB to YUV420P			SSE2 SSSE3
 void		convert_argb_to_yuv420p_bt601_sse2_ssse3(const struct PixFcSSE *, void*, void*);
+void		downsample_n_convert_argb_to_yuv420p_bt601_sse2_ssse3(const struct PixFcSSE *, void*, void*);
 // ARGB to YUV420P			SSE2
 void		convert_argb_to_yuv420p_bt601_sse2(const struct PixFcSSE *, void*, void*);
+void		downsample_n_convert_argb_to_yuv420p_bt601_sse2(const struct PixFcSSE *, void*, void*);
+// ARGB to NV12			SSE2 SSSE3
+void		convert_argb_to_nv12_bt601_sse2_ssse3(const struct PixFcSSE *, void*, void*);
+void		downsample_n_convert_argb_to_nv12_bt601_sse2_ssse3(const struct PixFcSSE *, void*, void*);
+// ARGB to NV12			SSE2
+void		convert_argb_to_nv12_bt601_sse2(const struct PixFcSSE *, void*, void*);
+void		downsample_n_convert_argb_to_nv12_bt601_sse2(const struct PixFcSSE *, void*, void*);
+// ARGB to NV21			SSE2 SSSE3
+void		convert_argb_to_nv21_bt601_sse2_ssse3(const struct PixFcSSE *, void*, void*);
+void		downsample_n_convert_argb_to_nv21_bt601_sse2_ssse3(const struct PixFcSSE *, void*, void*);
+// ARGB to NV21			SSE2
+void		convert_argb_to_nv21_bt601_sse2(const struct PixFcSSE *, void*, void*);
+void		downsample_n_convert_argb_to_nv21_bt601_sse2(const struct PixFcSSE *, void*, void*);
 
 
 // ARGB to V210			SSE2 SSSE3
@@ -167,8 +195,22 @@ void		downsample_n_convert_argb_to_yuv422p_bt709_sse2(const struct PixFcSSE *, v
 
 // ARGB to YUV420P			SSE2 SSSE3
 void		convert_argb_to_yuv420p_bt709_sse2_ssse3(const struct PixFcSSE *, void*, void*);
+void		downsample_n_convert_argb_to_yuv420p_bt709_sse2_ssse3(const struct PixFcSSE *, void*, void*);
 // ARGB to YUV420P			SSE2
 void		convert_argb_to_yuv420p_bt709_sse2(const struct PixFcSSE *, void*, void*);
+void		downsample_n_convert_argb_to_yuv420p_bt709_sse2(const struct PixFcSSE *, void*, void*);
+// ARGB to NV12			SSE2 SSSE3
+void		convert_argb_to_nv12_bt709_sse2_ssse3(const struct PixFcSSE *, void*, void*);
+void		downsample_n_convert_argb_to_nv12_bt709_sse2_ssse3(const struct PixFcSSE *, void*, void*);
+// ARGB to NV12			SSE2
+void		convert_argb_to_nv12_bt709_sse2(const struct PixFcSSE *, void*, void*);
+void		downsample_n_convert_argb_to_nv12_bt709_sse2(const struct PixFcSSE *, void*, void*);
+// ARGB to NV21			SSE2 SSSE3
+void		convert_argb_to_nv21_bt709_sse2_ssse3(const struct PixFcSSE *, void*, void*);
+void		downsample_n_convert_argb_to_nv21_bt709_sse2_ssse3(const struct PixFcSSE *, void*, void*);
+// ARGB to NV21			SSE2
+void		convert_argb_to_nv21_bt709_sse2(const struct PixFcSSE *, void*, void*);
+void		downsample_n_convert_argb_to_nv21_bt709_sse2(const struct PixFcSSE *, void*, void*);
 
 
 // ARGB to V210			SSE2 SSSE3
@@ -221,13 +263,31 @@ void 		downsample_n_convert_rgb_to_v210_bt709_nonsse_float(const struct PixFcSSE
 
 // RGB to YUV420		NON SSE integer
 void 		convert_rgb_to_yuv420_nonsse(const struct PixFcSSE* conv, void* in, void* out);
+void 		downsample_n_convert_rgb_to_yuv420_nonsse(const struct PixFcSSE* conv, void* in, void* out);
 void 		convert_rgb_to_yuv420_bt601_nonsse(const struct PixFcSSE* conv, void* in, void* out);
+void 		downsample_n_convert_rgb_to_yuv420_bt601_nonsse(const struct PixFcSSE* conv, void* in, void* out);
 void 		convert_rgb_to_yuv420_bt709_nonsse(const struct PixFcSSE* conv, void* in, void* out);
+void 		downsample_n_convert_rgb_to_yuv420_bt709_nonsse(const struct PixFcSSE* conv, void* in, void* out);
 
 // RGB to YUV420		NON SSE float
 void 		convert_rgb_to_yuv420_nonsse_float(const struct PixFcSSE* conv, void* in, void* out);
+void 		downsample_n_convert_rgb_to_yuv420_nonsse_float(const struct PixFcSSE* conv, void* in, void* out);
 void 		convert_rgb_to_yuv420_bt601_nonsse_float(const struct PixFcSSE* conv, void* in, void* out);
+void 		downsample_n_convert_rgb_to_yuv420_bt601_nonsse_float(const struct PixFcSSE* conv, void* in, void* out);
 void 		convert_rgb_to_yuv420_bt709_nonsse_float(const struct PixFcSSE* conv, void* in, void* out);
+void 		downsample_n_convert_rgb_to_yuv420_bt709_nonsse_float(const struct PixFcSSE* conv, void* in, void* out);
+
+
+
+// RGB to P210 / P010		NON SSE integer
+void 		convert_rgb_to_p210_nonsse(const struct PixFcSSE* conv, void* in, void* out);
+void 		convert_rgb_to_p210_bt601_nonsse(const struct PixFcSSE* conv, void* in, void* out);
+void 		convert_rgb_to_p210_bt709_nonsse(const struct PixFcSSE* conv, void* in, void* out);
+
+// RGB to P210 / P010		NON SSE float
+void 		convert_rgb_to_p210_nonsse_float(const struct PixFcSSE* conv, void* in, void* out);
+void 		convert_rgb_to_p210_bt601_nonsse_float(const struct PixFcSSE* conv, void* in, void* out);
+void 		convert_rgb_to_p210_bt709_nonsse_float(const struct PixFcSSE* conv, void* in, void* out);
 
 
 
@@ -243,6 +303,123 @@ void 		convert_rgb_to_yuv420_bt709_nonsse_float(const struct PixFcSSE* conv, voi
 void		convert_argb_to_r210_sse2_ssse3(const struct PixFcSSE *, void *, void *);
 void		convert_rgb_to_10bit_rgb_nonsse(const struct PixFcSSE *, void *, void *);
 
+/*
+ *
+ * 		A R G B
+ *
+ * 		T O
+ *
+ * 		8 B I T    R G B
+ *
+ */
+// ARGB to BGRA
+void		convert_argb_to_bgra_sse2_ssse3(const struct PixFcSSE *, void *, void *);
+void		convert_argb_to_bgra_sse2(const struct PixFcSSE *, void *, void *);
+// ARGB to RGB24
+void		convert_argb_to_rgb24_sse2_ssse3(const struct PixFcSSE *, void *, void *);
+void		convert_argb_to_rgb24_sse2(const struct PixFcSSE *, void *, void *);
+// ARGB to BGR24
+void		convert_argb_to_bgr24_sse2_ssse3(const struct PixFcSSE *, void *, void *);
+void		convert_argb_to_bgr24_sse2(const struct PixFcSSE *, void *, void *);
+void		convert_rgb_to_any_rgb_nonsse(const struct PixFcSSE *, void *, void *);
+
+/*
+ *
+ *
+ *	A V X 2
+ *
+ *  C O N V E R S I O N S
+ *
+ *
+ */
+// ARGB to YUYV		AVX2
+void		downsample_n_convert_argb_to_yuyv_avx2(const struct PixFcSSE *, void *, void *);
+void		convert_argb_to_yuyv_avx2(const struct PixFcSSE *, void *, void *);
+void		downsample_n_convert_argb_to_yuyv_bt601_avx2(const struct PixFcSSE *, void *, void *);
+void		convert_argb_to_yuyv_bt601_avx2(const struct PixFcSSE *, void *, void *);
+void		downsample_n_convert_argb_to_yuyv_bt709_avx2(const struct PixFcSSE *, void *, void *);
+void		convert_argb_to_yuyv_bt709_avx2(const struct PixFcSSE *, void *, void *);
+
+// ARGB to UYVY		AVX2
+void		downsample_n_convert_argb_to_uyvy_avx2(const struct PixFcSSE *, void *, void *);
+void		convert_argb_to_uyvy_avx2(const struct PixFcSSE *, void *, void *);
+void		downsample_n_convert_argb_to_uyvy_bt601_avx2(const struct PixFcSSE *, void *, void *);
+void		convert_argb_to_uyvy_bt601_avx2(const struct PixFcSSE *, void *, void *);
+void		downsample_n_convert_argb_to_uyvy_bt709_avx2(const struct PixFcSSE *, void *, void *);
+void		convert_argb_to_uyvy_bt709_avx2(const struct PixFcSSE *, void *, void *);
+
+// ARGB to YUV422P		AVX2
+void		downsample_n_convert_argb_to_yuv422p_avx2(const struct PixFcSSE *, void *, void *);
+void		convert_argb_to_yuv422p_avx2(const struct PixFcSSE *, void *, void *);
+void		downsample_n_convert_argb_to_yuv422p_bt601_avx2(const struct PixFcSSE *, void *, void *);
+void		convert_argb_to_yuv422p_bt601_avx2(const struct PixFcSSE *, void *, void *);
+void		downsample_n_convert_argb_to_yuv422p_bt709_avx2(const struct PixFcSSE *, void *, void *);
+void		convert_argb_to_yuv422p_bt709_avx2(const struct PixFcSSE *, void *, void *);
+
+// ARGB to v210		AVX2
+void		downsample_n_convert_argb_to_v210_avx2(const struct PixFcSSE *, void *, void *);
+void		convert_argb_to_v210_avx2(const struct PixFcSSE *, void *, void *);
+void		downsample_n_convert_argb_to_v210_bt601_avx2(const struct PixFcSSE *, void *, void *);
+void		convert_argb_to_v210_bt601_avx2(const struct PixFcSSE *, void *, void *);
+void		downsample_n_convert_argb_to_v210_bt709_avx2(const struct PixFcSSE *, void *, void *);
+void		convert_argb_to_v210_bt709_avx2(const struct PixFcSSE *, void *, void *);
+
+// ARGB to BGRA		AVX2
+void		convert_argb_to_bgra_avx2(const struct PixFcSSE *, void *, void *);
+
+// ARGB to RGB24		AVX2
+void		convert_argb_to_rgb24_avx2(const struct PixFcSSE *, void *, void *);
+
+// ARGB to BGR24		AVX2
+void		convert_argb_to_bgr24_avx2(const struct PixFcSSE *, void *, void *);
+
+// ARGB to YUYV		NEON
+void		downsample_n_convert_argb_to_yuyv_neon(const struct PixFcSSE *, void *, void *);
+void		convert_argb_to_yuyv_neon(const struct PixFcSSE *, void *, void *);
+void		downsample_n_convert_argb_to_yuyv_bt601_neon(const struct PixFcSSE *, void *, void *);
+void		convert_argb_to_yuyv_bt601_neon(const struct PixFcSSE *, void *, void *);
+void		downsample_n_convert_argb_to_yuyv_bt709_neon(const struct PixFcSSE *, void *, void *);
+void		convert_argb_to_yuyv_bt709_neon(const struct PixFcSSE *, void *, void *);
+
+// ARGB to UYVY		NEON
+void		downsample_n_convert_argb_to_uyvy_neon(const struct PixFcSSE *, void *, void *);
+void		convert_argb_to_uyvy_neon(const struct PixFcSSE *, void *, void *);
+void		downsample_n_convert_argb_to_uyvy_bt601_neon(const struct PixFcSSE *, void *, void *);
+void		convert_argb_to_uyvy_bt601_neon(const struct PixFcSSE *, void *, void *);
+void		downsample_n_convert_argb_to_uyvy_bt709_neon(const struct PixFcSSE *, void *, void *);
+void		convert_argb_to_uyvy_bt709_neon(const struct PixFcSSE *, void *, void *);
+
+// ARGB to YUV422P		NEON
+void		downsample_n_convert_argb_to_yuv422p_neon(const struct PixFcSSE *, void *, void *);
+void		convert_argb_to_yuv422p_neon(const struct PixFcSSE *, void *, void *);
+void		downsample_n_convert_argb_to_yuv422p_bt601_neon(const struct PixFcSSE *, void *, void *);
+void		convert_argb_to_yuv422p_bt601_neon(const struct PixFcSSE *, void *, void *);
+void		downsample_n_convert_argb_to_yuv422p_bt709_neon(const struct PixFcSSE *, void *, void *);
+void		convert_argb_to_yuv422p_bt709_neon(const struct PixFcSSE *, void *, void *);
+
+// ARGB to YUV420P		NEON
+void		downsample_n_convert_argb_to_yuv420p_neon(const struct PixFcSSE *, void *, void *);
+void		convert_argb_to_yuv420p_neon(const struct PixFcSSE *, void *, void *);
+void		downsample_n_convert_argb_to_yuv420p_bt601_neon(const struct PixFcSSE *, void *, void *);
+void		convert_argb_to_yuv420p_bt601_neon(const struct PixFcSSE *, void *, void *);
+void		downsample_n_convert_argb_to_yuv420p_bt709_neon(const struct PixFcSSE *, void *, void *);
+void		convert_argb_to_yuv420p_bt709_neon(const struct PixFcSSE *, void *, void *);
+
+// ARGB to NV12		NEON
+void		downsample_n_convert_argb_to_nv12_neon(const struct PixFcSSE *, void *, void *);
+void		convert_argb_to_nv12_neon(const struct PixFcSSE *, void *, void *);
+void		downsample_n_convert_argb_to_nv12_bt601_neon(const struct PixFcSSE *, void *, void *);
+void		convert_argb_to_nv12_bt601_neon(const struct PixFcSSE *, void *, void *);
+void		downsample_n_convert_argb_to_nv12_bt709_neon(const struct PixFcSSE *, void *, void *);
+void		convert_argb_to_nv12_bt709_neon(const struct PixFcSSE *, void *, void *);
+
+// ARGB to NV21		NEON
+void		downsample_n_convert_argb_to_nv21_neon(const struct PixFcSSE *, void *, void *);
+void		convert_argb_to_nv21_neon(const struct PixFcSSE *, void *, void *);
+void		downsample_n_convert_argb_to_nv21_bt601_neon(const struct PixFcSSE *, void *, void *);
+void		convert_argb_to_nv21_bt601_neon(const struct PixFcSSE *, void *, void *);
+void		downsample_n_convert_argb_to_nv21_bt709_neon(const struct PixFcSSE *, void *, void *);
+void		convert_argb_to_nv21_bt709_neon(const struct PixFcSSE *, void *, void *);
 
 
 #endif /* CONVERSION_ROUTINES_FROM_ARGB_H_ */
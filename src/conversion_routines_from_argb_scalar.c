@@ -110,6 +110,30 @@
 		printf("unknown rgb destination format\n");\
 	}
 
+// Alpha is set to 0, as in the SSE routines
+#define PACK_RGB(a, r, g, b, dst, dest_fmt) \
+	if (dest_fmt == PixFcARGB) {\
+		*(dst++) = (uint8_t) a;\
+		*(dst++) = (uint8_t) r;\
+		*(dst++) = (uint8_t) g;\
+		*(dst++) = (uint8_t) b;\
+	} else if (dest_fmt == PixFcBGRA) {\
+		*(dst++) = (uint8_t) b;\
+		*(dst++) = (uint8_t) g;\
+		*(dst++) = (uint8_t) r;\
+		*(dst++) = (uint8_t) a;\
+	} else  if (dest_fmt == PixFcRGB24) {\
+		*(dst++) = (uint8_t) r;\
+		*(dst++) = (uint8_t) g;\
+		*(dst++) = (uint8_t) b;\
+	} else if (dest_fmt == PixFcBGR24) {\
+		*(dst++) = (uint8_t) b;\
+		*(dst++) = (uint8_t) g;\
+		*(dst++) = (uint8_t) r;\
+	} else {\
+		printf("unknown rgb destination format\n");\
+	}
+
 #define PACK_YUV422(dst, y1, u, y2, v, dest_fmt) do {\
 			if (dest_fmt == PixFcYUYV) {\
 				*(dst++) = CLIP_PIXEL(y1);\
@@ -131,6 +155,16 @@
 			}\
 		} while(0)
 
+// Define fn_name() to call fn_name##_fmt() (see CALL_FOR_FORMATS) with each
+// of the given RGB source formats and each YUYV / UYVY / YUV422P destination format.
+#define DEFINE_RGB_TO_YUV422_ENTRY_POINT(fn_name, rgb_src_formats)\
+	void 		fn_name(const struct PixFcSSE* conv, void* in, void* out) {\
+		rgb_src_formats(fn_name##_fmt, conv, in, out, PixFcYUYV)\
+		rgb_src_formats(fn_name##_fmt, conv, in, out, PixFcUYVY)\
+		rgb_src_formats(fn_name##_fmt, conv, in, out, PixFcYUV422P)\
+		printf("Unknown pixel format in non-SSE conversion from RGB\n");\
+	}
+
 #define NNB_CONVERT_RGB_TO_YUV422(r1, g1, b1, r2, g2, b2, y1, u, v, y2, coef_shift, coeffs, offsets) \
 		y1 = (((coeffs[0][0]) * r1 + (coeffs[0][1]) * g1 + (coeffs[0][2]) * b1) >> coef_shift) + offsets[0];\
 		u =  (((coeffs[1][0]) * r1 + (coeffs[1][1]) * g1 + (coeffs[1][2]) * b1) >> coef_shift) + offsets[1];\
@@ -147,11 +181,10 @@
 //
 // NNB Integer
 //
-#define 	DEFINE_ANY_RGB_TO_YUV422(fn_name, coeffs, coef_shift, offsets) \
-	void 		fn_name(const struct PixFcSSE* conv, void* in, void* out) {\
-		PixFcPixelFormat 	dest_fmt = conv->dest_fmt;\
-		PixFcPixelFormat 	src_fmt = conv->source_fmt;\
-		uint32_t			src_padding_bytes = PADDING_BYTE_COUNT(src_fmt, conv->width);\
+#define 	DEFINE_ANY_RGB_TO_YUV422(fn_name, rgb_src_formats, coeffs, coef_shift, offsets) \
+	static FORCE_INLINE void fn_name##_fmt(const struct PixFcSSE* conv, void* in, void* out, const PixFcPixelFormat src_fmt, const PixFcPixelFormat dest_fmt){\
+		uint32_t			padding_bytes = ROW_PADDING_BYTE_COUNT(dest_fmt, conv->width, conv->dest_row_bytes);\
+		uint32_t			src_padding_bytes = ROW_PADDING_BYTE_COUNT(src_fmt, conv->width, conv->source_row_bytes);\
 		uint32_t 			line = conv->height;\
 		uint32_t			pixel;\
 		uint8_t*			src = (uint8_t *) in;\
@@ -170,28 +203,29 @@
 				pixel -= 2;\
 			}\
 			src += src_padding_bytes;\
+			dst += padding_bytes;\
 		}\
 	}\
+	DEFINE_RGB_TO_YUV422_ENTRY_POINT(fn_name, rgb_src_formats)
 
 // these functions assume an even number of pixels
-DEFINE_ANY_RGB_TO_YUV422(convert_rgb_to_yuv422_nonsse, rgb_8bit_to_yuv_8bit_coef_lhs8[0], 8, rgb_8bit_to_yuv_8bit_off[0])
-DEFINE_ANY_RGB_TO_YUV422(convert_rgb_to_yuv422_bt601_nonsse, rgb_8bit_to_yuv_8bit_coef_lhs8[1], 8, rgb_8bit_to_yuv_8bit_off[1])
-DEFINE_ANY_RGB_TO_YUV422(convert_rgb_to_yuv422_bt709_nonsse, rgb_8bit_to_yuv_8bit_coef_lhs8[2], 8, rgb_8bit_to_yuv_8bit_off[2])
+DEFINE_ANY_RGB_TO_YUV422(convert_rgb_to_yuv422_nonsse, CALL_FOR_8BIT_RGB_SRC_FORMATS, rgb_8bit_to_yuv_8bit_coef_lhs8[0], 8, rgb_8bit_to_yuv_8bit_off[0])
+DEFINE_ANY_RGB_TO_YUV422(convert_rgb_to_yuv422_bt601_nonsse, CALL_FOR_8BIT_RGB_SRC_FORMATS, rgb_8bit_to_yuv_8bit_coef_lhs8[1], 8, rgb_8bit_to_yuv_8bit_off[1])
+DEFINE_ANY_RGB_TO_YUV422(convert_rgb_to_yuv422_bt709_nonsse, CALL_FOR_8BIT_RGB_SRC_FORMATS, rgb_8bit_to_yuv_8bit_coef_lhs8[2], 8, rgb_8bit_to_yuv_8bit_off[2])
 //
-DEFINE_ANY_RGB_TO_YUV422(convert_10bit_rgb_to_yuv422_nonsse, rgb_10bit_to_yuv_8bit_coef_lhs8[0], 8, rgb_10bit_to_yuv_8bit_off[0])
-DEFINE_ANY_RGB_TO_YUV422(convert_10bit_rgb_to_yuv422_bt601_nonsse, rgb_10bit_to_yuv_8bit_coef_lhs8[1], 8, rgb_10bit_to_yuv_8bit_off[1])
-DEFINE_ANY_RGB_TO_YUV422(convert_10bit_rgb_to_yuv422_bt709_nonsse, rgb_10bit_to_yuv_8bit_coef_lhs8[2], 8, rgb_10bit_to_yuv_8bit_off[2])
+DEFINE_ANY_RGB_TO_YUV422(convert_10bit_rgb_to_yuv422_nonsse, CALL_FOR_10BIT_RGB_SRC_FORMATS, rgb_10bit_to_yuv_8bit_coef_lhs8[0], 8, rgb_10bit_to_yuv_8bit_off[0])
+DEFINE_ANY_RGB_TO_YUV422(convert_10bit_rgb_to_yuv422_bt601_nonsse, CALL_FOR_10BIT_RGB_SRC_FORMATS, rgb_10bit_to_yuv_8bit_coef_lhs8[1], 8, rgb_10bit_to_yuv_8bit_off[1])
+DEFINE_ANY_RGB_TO_YUV422(convert_10bit_rgb_to_yuv422_bt709_nonsse, CALL_FOR_10BIT_RGB_SRC_FORMATS, rgb_10bit_to_yuv_8bit_coef_lhs8[2], 8, rgb_10bit_to_yuv_8bit_off[2])
 
 
 
 //
 // 	NNB Float
 //
-#define 	DEFINE_ANY_RGB_TO_YUV422_FLOAT(fn_name, coeffs, offsets) \
-	void 		fn_name(const struct PixFcSSE* conv, void* in, void* out) {\
-		PixFcPixelFormat 	dest_fmt = conv->dest_fmt;\
-		PixFcPixelFormat 	src_fmt = conv->source_fmt;\
-		uint32_t			src_padding_bytes = PADDING_BYTE_COUNT(src_fmt, conv->width);\
+#define 	DEFINE_ANY_RGB_TO_YUV422_FLOAT(fn_name, rgb_src_formats, coeffs, offsets) \
+	static FORCE_INLINE void fn_name##_fmt(const struct PixFcSSE* conv, void* in, void* out, const PixFcPixelFormat src_fmt, const PixFcPixelFormat dest_fmt){\
+		uint32_t			padding_bytes = ROW_PADDING_BYTE_COUNT(dest_fmt, conv->width, conv->dest_row_bytes);\
+		uint32_t			src_padding_bytes = ROW_PADDING_BYTE_COUNT(src_fmt, conv->width, conv->source_row_bytes);\
 		uint32_t 			line = conv->height;\
 		uint32_t 			pixel_num = 0;\
 		uint8_t*			src = (uint8_t *) in;\
@@ -210,17 +244,19 @@ DEFINE_ANY_RGB_TO_YUV422(convert_10bit_rgb_to_yuv422_bt709_nonsse, rgb_10bit_to_
 				pixel_num -= 2;\
 			}\
 			src += src_padding_bytes;\
+			dst += padding_bytes;\
 		}\
 	}\
+	DEFINE_RGB_TO_YUV422_ENTRY_POINT(fn_name, rgb_src_formats)
 
 // these functions assume an even number of pixels
-DEFINE_ANY_RGB_TO_YUV422_FLOAT(convert_rgb_to_yuv422_nonsse_float, rgb_8bit_to_yuv_8bit_coef[0], rgb_8bit_to_yuv_8bit_off[0])
-DEFINE_ANY_RGB_TO_YUV422_FLOAT(convert_rgb_to_yuv422_bt601_nonsse_float, rgb_8bit_to_yuv_8bit_coef[1], rgb_8bit_to_yuv_8bit_off[1])
-DEFINE_ANY_RGB_TO_YUV422_FLOAT(convert_rgb_to_yuv422_bt709_nonsse_float, rgb_8bit_to_yuv_8bit_coef[2], rgb_8bit_to_yuv_8bit_off[2])
+DEFINE_ANY_RGB_TO_YUV422_FLOAT(convert_rgb_to_yuv422_nonsse_float, CALL_FOR_8BIT_RGB_SRC_FORMATS, rgb_8bit_to_yuv_8bit_coef[0], rgb_8bit_to_yuv_8bit_off[0])
+DEFINE_ANY_RGB_TO_YUV422_FLOAT(convert_rgb_to_yuv422_bt601_nonsse_float, CALL_FOR_8BIT_RGB_SRC_FORMATS, rgb_8bit_to_yuv_8bit_coef[1], rgb_8bit_to_yuv_8bit_off[1])
+DEFINE_ANY_RGB_TO_YUV422_FLOAT(convert_rgb_to_yuv422_bt709_nonsse_float, CALL_FOR_8BIT_RGB_SRC_FORMATS, rgb_8bit_to_yuv_8bit_coef[2], rgb_8bit_to_yuv_8bit_off[2])
 //
-DEFINE_ANY_RGB_TO_YUV422_FLOAT(convert_10bit_rgb_to_yuv422_nonsse_float, rgb_10bit_to_yuv_8bit_coef[0], rgb_10bit_to_yuv_8bit_off[0])
-DEFINE_ANY_RGB_TO_YUV422_FLOAT(convert_10bit_rgb_to_yuv422_bt601_nonsse_float, rgb_10bit_to_yuv_8bit_coef[1], rgb_10bit_to_yuv_8bit_off[1])
-DEFINE_ANY_RGB_TO_YUV422_FLOAT(convert_10bit_rgb_to_yuv422_bt709_nonsse_float, rgb_10bit_to_yuv_8bit_coef[2], rgb_10bit_to_yuv_8bit_off[2])
+DEFINE_ANY_RGB_TO_YUV422_FLOAT(convert_10bit_rgb_to_yuv422_nonsse_float, CALL_FOR_10BIT_RGB_SRC_FORMATS, rgb_10bit_to_yuv_8bit_coef[0], rgb_10bit_to_yuv_8bit_off[0])
+DEFINE_ANY_RGB_TO_YUV422_FLOAT(convert_10bit_rgb_to_yuv422_bt601_nonsse_float, CALL_FOR_10BIT_RGB_SRC_FORMATS, rgb_10bit_to_yuv_8bit_coef[1], rgb_10bit_to_yuv_8bit_off[1])
+DEFINE_ANY_RGB_TO_YUV422_FLOAT(convert_10bit_rgb_to_yuv422_bt709_nonsse_float, CALL_FOR_10BIT_RGB_SRC_FORMATS, rgb_10bit_to_yuv_8bit_coef[2], rgb_10bit_to_yuv_8bit_off[2])
 
 
 
@@ -241,11 +277,10 @@ DEFINE_ANY_RGB_TO_YUV422_FLOAT(convert_10bit_rgb_to_yuv422_bt709_nonsse_float, r
 //
 // AVG Integer
 //
-#define 	DEFINE_DOWNSAMPLE_N_CONVERT_ANY_RGB_TO_YUV422(fn_name, coeffs, coef_shift, offsets) \
-	void 		fn_name(const struct PixFcSSE* conv, void* in, void* out) {\
-		PixFcPixelFormat 	dest_fmt = conv->dest_fmt;\
-		PixFcPixelFormat 	src_fmt = conv->source_fmt;\
-		uint32_t			src_padding_bytes = PADDING_BYTE_COUNT(src_fmt, conv->width);\
+#define 	DEFINE_DOWNSAMPLE_N_CONVERT_ANY_RGB_TO_YUV422(fn_name, rgb_src_formats, coeffs, coef_shift, offsets) \
+	static FORCE_INLINE void fn_name##_fmt(const struct PixFcSSE* conv, void* in, void* out, const PixFcPixelFormat src_fmt, const PixFcPixelFormat dest_fmt){\
+		uint32_t			padding_bytes = ROW_PADDING_BYTE_COUNT(dest_fmt, conv->width, conv->dest_row_bytes);\
+		uint32_t			src_padding_bytes = ROW_PADDING_BYTE_COUNT(src_fmt, conv->width, conv->source_row_bytes);\
 		uint32_t			line = conv->height;\
 		uint32_t 			pixel_num;\
 		uint8_t*			src = (uint8_t *) in;\
@@ -269,17 +304,19 @@ DEFINE_ANY_RGB_TO_YUV422_FLOAT(convert_10bit_rgb_to_yuv422_bt709_nonsse_float, r
 				pixel_num -= 2;\
 			}\
 			src += src_padding_bytes;\
+			dst += padding_bytes;\
 		}\
 	}\
+	DEFINE_RGB_TO_YUV422_ENTRY_POINT(fn_name, rgb_src_formats)
 
 // these functions assume an even number of pixels
-DEFINE_DOWNSAMPLE_N_CONVERT_ANY_RGB_TO_YUV422(downsample_n_convert_rgb_to_yuv422_nonsse, rgb_8bit_to_yuv_8bit_coef_lhs8[0], 8, rgb_8bit_to_yuv_8bit_off[0])
-DEFINE_DOWNSAMPLE_N_CONVERT_ANY_RGB_TO_YUV422(downsample_n_convert_rgb_to_yuv422_bt601_nonsse, rgb_8bit_to_yuv_8bit_coef_lhs8[1], 8, rgb_8bit_to_yuv_8bit_off[1])
-DEFINE_DOWNSAMPLE_N_CONVERT_ANY_RGB_TO_YUV422(downsample_n_convert_rgb_to_yuv422_bt709_nonsse, rgb_8bit_to_yuv_8bit_coef_lhs8[2], 8, rgb_8bit_to_yuv_8bit_off[2])
+DEFINE_DOWNSAMPLE_N_CONVERT_ANY_RGB_TO_YUV422(downsample_n_convert_rgb_to_yuv422_nonsse, CALL_FOR_8BIT_RGB_SRC_FORMATS, rgb_8bit_to_yuv_8bit_coef_lhs8[0], 8, rgb_8bit_to_yuv_8bit_off[0])
+DEFINE_DOWNSAMPLE_N_CONVERT_ANY_RGB_TO_YUV422(downsample_n_convert_rgb_to_yuv422_bt601_nonsse, CALL_FOR_8BIT_RGB_SRC_FORMATS, rgb_8bit_to_yuv_8bit_coef_lhs8[1], 8, rgb_8bit_to_yuv_8bit_off[1])
+DEFINE_DOWNSAMPLE_N_CONVERT_ANY_RGB_TO_YUV422(downsample_n_convert_rgb_to_yuv422_bt709_nonsse, CALL_FOR_8BIT_RGB_SRC_FORMATS, rgb_8bit_to_yuv_8bit_coef_lhs8[2], 8, rgb_8bit_to_yuv_8bit_off[2])
 //
-DEFINE_DOWNSAMPLE_N_CONVERT_ANY_RGB_TO_YUV422(downsample_n_convert_10bit_rgb_to_yuv422_nonsse, rgb_10bit_to_yuv_8bit_coef_lhs8[0], 8, rgb_10bit_to_yuv_8bit_off[0])
-DEFINE_DOWNSAMPLE_N_CONVERT_ANY_RGB_TO_YUV422(downsample_n_convert_10bit_rgb_to_yuv422_bt601_nonsse, rgb_10bit_to_yuv_8bit_coef_lhs8[1], 8, rgb_10bit_to_yuv_8bit_off[1])
-DEFINE_DOWNSAMPLE_N_CONVERT_ANY_RGB_TO_YUV422(downsample_n_convert_10bit_rgb_to_yuv422_bt709_nonsse, rgb_10bit_to_yuv_8bit_coef_lhs8[2], 8, rgb_10bit_to_yuv_8bit_off[2])
+DEFINE_DOWNSAMPLE_N_CONVERT_ANY_RGB_TO_YUV422(downsample_n_convert_10bit_rgb_to_yuv422_nonsse, CALL_FOR_10BIT_RGB_SRC_FORMATS, rgb_10bit_to_yuv_8bit_coef_lhs8[0], 8, rgb_10bit_to_yuv_8bit_off[0])
+DEFINE_DOWNSAMPLE_N_CONVERT_ANY_RGB_TO_YUV422(downsample_n_convert_10bit_rgb_to_yuv422_bt601_nonsse, CALL_FOR_10BIT_RGB_SRC_FORMATS, rgb_10bit_to_yuv_8bit_coef_lhs8[1], 8, rgb_10bit_to_yuv_8bit_off[1])
+DEFINE_DOWNSAMPLE_N_CONVERT_ANY_RGB_TO_YUV422(downsample_n_convert_10bit_rgb_to_yuv422_bt709_nonsse, CALL_FOR_10BIT_RGB_SRC_FORMATS, rgb_10bit_to_yuv_8bit_coef_lhs8[2], 8, rgb_10bit_to_yuv_8bit_off[2])
 
 
 
@@ -287,11 +324,10 @@ DEFINE_DOWNSAMPLE_N_CONVERT_ANY_RGB_TO_YUV422(downsample_n_convert_10bit_rgb_to_
 //
 // AVG Float
 //
-#define 	DEFINE_DOWNSAMPLE_N_CONVERT_ANY_RGB_TO_YUV422_FLOAT(fn_name, coeffs, offsets) \
-	void 		fn_name(const struct PixFcSSE* conv, void* in, void* out) {\
-		PixFcPixelFormat 	dest_fmt = conv->dest_fmt;\
-		PixFcPixelFormat 	src_fmt = conv->source_fmt;\
-		uint32_t			src_padding_bytes = PADDING_BYTE_COUNT(src_fmt, conv->width);\
+#define 	DEFINE_DOWNSAMPLE_N_CONVERT_ANY_RGB_TO_YUV422_FLOAT(fn_name, rgb_src_formats, coeffs, offsets) \
+	static FORCE_INLINE void fn_name##_fmt(const struct PixFcSSE* conv, void* in, void* out, const PixFcPixelFormat src_fmt, const PixFcPixelFormat dest_fmt){\
+		uint32_t			padding_bytes = ROW_PADDING_BYTE_COUNT(dest_fmt, conv->width, conv->dest_row_bytes);\
+		uint32_t			src_padding_bytes = ROW_PADDING_BYTE_COUNT(src_fmt, conv->width, conv->source_row_bytes);\
 		uint32_t			line = conv->height;\
 		uint32_t 			pixel_num;\
 		uint8_t*			src = (uint8_t *) in;\
@@ -315,17 +351,19 @@ DEFINE_DOWNSAMPLE_N_CONVERT_ANY_RGB_TO_YUV422(downsample_n_convert_10bit_rgb_to_
 				pixel_num -= 2;\
 			}\
 			src += src_padding_bytes;\
+			dst += padding_bytes;\
 		}\
 	}\
+	DEFINE_RGB_TO_YUV422_ENTRY_POINT(fn_name, rgb_src_formats)
 
 // these functions assume an even number of pixels
-DEFINE_DOWNSAMPLE_N_CONVERT_ANY_RGB_TO_YUV422_FLOAT(downsample_n_convert_rgb_to_yuv422_nonsse_float, rgb_8bit_to_yuv_8bit_coef[0], rgb_8bit_to_yuv_8bit_off[0])
-DEFINE_DOWNSAMPLE_N_CONVERT_ANY_RGB_TO_YUV422_FLOAT(downsample_n_convert_rgb_to_yuv422_bt601_nonsse_float, rgb_8bit_to_yuv_8bit_coef[1], rgb_8bit_to_yuv_8bit_off[1])
-DEFINE_DOWNSAMPLE_N_CONVERT_ANY_RGB_TO_YUV422_FLOAT(downsample_n_convert_rgb_to_yuv422_bt709_nonsse_float, rgb_8bit_to_yuv_8bit_coef[2], rgb_8bit_to_yuv_8bit_off[2])
+DEFINE_DOWNSAMPLE_N_CONVERT_ANY_RGB_TO_YUV422_FLOAT(downsample_n_convert_rgb_to_yuv422_nonsse_float, CALL_FOR_8BIT_RGB_SRC_FORMATS, rgb_8bit_to_yuv_8bit_coef[0], rgb_8bit_to_yuv_8bit_off[0])
+DEFINE_DOWNSAMPLE_N_CONVERT_ANY_RGB_TO_YUV422_FLOAT(downsample_n_convert_rgb_to_yuv422_bt601_nonsse_float, CALL_FOR_8BIT_RGB_SRC_FORMATS, rgb_8bit_to_yuv_8bit_coef[1], rgb_8bit_to_yuv_8bit_off[1])
+DEFINE_DOWNSAMPLE_N_CONVERT_ANY_RGB_TO_YUV422_FLOAT(downsample_n_convert_rgb_to_yuv422_bt709_nonsse_float, CALL_FOR_8BIT_RGB_SRC_FORMATS, rgb_8bit_to_yuv_8bit_coef[2], rgb_8bit_to_yuv_8bit_off[2])
 //
-DEFINE_DOWNSAMPLE_N_CONVERT_ANY_RGB_TO_YUV422_FLOAT(downsample_n_convert_10bit_rgb_to_yuv422_nonsse_float, rgb_10bit_to_yuv_8bit_coef[0], rgb_10bit_to_yuv_8bit_off[0])
-DEFINE_DOWNSAMPLE_N_CONVERT_ANY_RGB_TO_YUV422_FLOAT(downsample_n_convert_10bit_rgb_to_yuv422_bt601_nonsse_float, rgb_10bit_to_yuv_8bit_coef[1], rgb_10bit_to_yuv_8bit_off[1])
-DEFINE_DOWNSAMPLE_N_CONVERT_ANY_RGB_TO_YUV422_FLOAT(downsample_n_convert_10bit_rgb_to_yuv422_bt709_nonsse_float, rgb_10bit_to_yuv_8bit_coef[2], rgb_10bit_to_yuv_8bit_off[2])
+DEFINE_DOWNSAMPLE_N_CONVERT_ANY_RGB_TO_YUV422_FLOAT(downsample_n_convert_10bit_rgb_to_yuv422_nonsse_float, CALL_FOR_10BIT_RGB_SRC_FORMATS, rgb_10bit_to_yuv_8bit_coef[0], rgb_10bit_to_yuv_8bit_off[0])
+DEFINE_DOWNSAMPLE_N_CONVERT_ANY_RGB_TO_YUV422_FLOAT(downsample_n_convert_10bit_rgb_to_yuv422_bt601_nonsse_float, CALL_FOR_10BIT_RGB_SRC_FORMATS, rgb_10bit_to_yuv_8bit_coef[1], rgb_10bit_to_yuv_8bit_off[1])
+DEFINE_DOWNSAMPLE_N_CONVERT_ANY_RGB_TO_YUV422_FLOAT(downsample_n_convert_10bit_rgb_to_yuv422_bt709_nonsse_float, CALL_FOR_10BIT_RGB_SRC_FORMATS, rgb_10bit_to_yuv_8bit_coef[2], rgb_10bit_to_yuv_8bit_off[2])
 
 
 
@@ -339,18 +377,25 @@ DEFINE_DOWNSAMPLE_N_CONVERT_ANY_RGB_TO_YUV422_FLOAT(downsample_n_convert_10bit_r
  * 		V 2 1 0
  */
 
+// Define fn_name() to call fn_name##_fmt() (see CALL_FOR_FORMATS) with each
+// of the given RGB source formats.
+#define DEFINE_RGB_TO_V210_ENTRY_POINT(fn_name, rgb_src_formats)\
+	void 		fn_name(const struct PixFcSSE* pixfc, void* in, void* out) {\
+		rgb_src_formats(fn_name##_fmt, pixfc, in, out, PixFcV210)\
+		printf("Unknown source pixel format in non-SSE conversion from RGB\n");\
+	}
+
 //
 // NNB Integer
 //
-#define 	DEFINE_ANY_RGB_TO_V210_FN(fn_name, coeffs, coef_shift, offsets) \
-	void 		fn_name(const struct PixFcSSE* pixfc, void* in, void* out)\
+#define 	DEFINE_ANY_RGB_TO_V210_FN(fn_name, rgb_src_formats, coeffs, coef_shift, offsets) \
+	static FORCE_INLINE void fn_name##_fmt(const struct PixFcSSE* pixfc, void* in, void* out, const PixFcPixelFormat src_fmt, const PixFcPixelFormat dest_fmt)\
 	{\
-		PixFcPixelFormat 	src_fmt = pixfc->source_fmt;\
 		uint32_t 			pixel = 0;\
 		uint32_t			line = 0;\
 		uint8_t*			src = (uint8_t *) in;\
 		uint32_t*			dst = (uint32_t *) out;\
-		uint32_t			src_padding_bytes = PADDING_BYTE_COUNT(src_fmt, pixfc->width);\
+		uint32_t			src_padding_bytes = ROW_PADDING_BYTE_COUNT(src_fmt, pixfc->width, pixfc->source_row_bytes);\
 		int32_t				r1 = 0, g1 = 0, b1 = 0, r2 = 0, g2 = 0, b2 = 0;\
 		int32_t				y1, y2, u, v;\
 		while(line++ < pixfc->height){\
@@ -399,34 +444,34 @@ DEFINE_DOWNSAMPLE_N_CONVERT_ANY_RGB_TO_YUV422_FLOAT(downsample_n_convert_10bit_r
 				*dst |= (CLIP_10BIT_PIXEL(y2) & 0x3FF) << 10;\
 			}\
 			src += src_padding_bytes;\
-			dst = (uint32_t*) ((uint8_t*)out + line * ROW_SIZE(PixFcV210, pixfc->width));\
+			dst = (uint32_t*) ((uint8_t*)out + line * pixfc->dest_row_bytes);\
 			pixel = 0;\
 		}\
 	}\
+	DEFINE_RGB_TO_V210_ENTRY_POINT(fn_name, rgb_src_formats)
 
 /* This conversion function only assumes an even number of pixels */
-DEFINE_ANY_RGB_TO_V210_FN(convert_rgb_to_v210_nonsse, rgb_8bit_to_yuv_10bit_coef_lhs8[0], 8, rgb_8bit_to_yuv_10bit_off[0]);
-DEFINE_ANY_RGB_TO_V210_FN(convert_rgb_to_v210_bt601_nonsse, rgb_8bit_to_yuv_10bit_coef_lhs8[1], 8, rgb_8bit_to_yuv_10bit_off[1]);
-DEFINE_ANY_RGB_TO_V210_FN(convert_rgb_to_v210_bt709_nonsse,	rgb_8bit_to_yuv_10bit_coef_lhs8[2], 8, rgb_8bit_to_yuv_10bit_off[2]);
+DEFINE_ANY_RGB_TO_V210_FN(convert_rgb_to_v210_nonsse, CALL_FOR_8BIT_RGB_SRC_FORMATS, rgb_8bit_to_yuv_10bit_coef_lhs8[0], 8, rgb_8bit_to_yuv_10bit_off[0]);
+DEFINE_ANY_RGB_TO_V210_FN(convert_rgb_to_v210_bt601_nonsse, CALL_FOR_8BIT_RGB_SRC_FORMATS, rgb_8bit_to_yuv_10bit_coef_lhs8[1], 8, rgb_8bit_to_yuv_10bit_off[1]);
+DEFINE_ANY_RGB_TO_V210_FN(convert_rgb_to_v210_bt709_nonsse, CALL_FOR_8BIT_RGB_SRC_FORMATS, rgb_8bit_to_yuv_10bit_coef_lhs8[2], 8, rgb_8bit_to_yuv_10bit_off[2]);
 //
-DEFINE_ANY_RGB_TO_V210_FN(convert_10bit_rgb_to_v210_nonsse, rgb_10bit_to_yuv_10bit_coef_lhs8[0], 8, rgb_10bit_to_yuv_10bit_off[0]);
-DEFINE_ANY_RGB_TO_V210_FN(convert_10bit_rgb_to_v210_bt601_nonsse, rgb_10bit_to_yuv_10bit_coef_lhs8[1], 8, rgb_10bit_to_yuv_10bit_off[1]);
-DEFINE_ANY_RGB_TO_V210_FN(convert_10bit_rgb_to_v210_bt709_nonsse, rgb_10bit_to_yuv_10bit_coef_lhs8[2], 8, rgb_10bit_to_yuv_10bit_off[2]);
+DEFINE_ANY_RGB_TO_V210_FN(convert_10bit_rgb_to_v210_nonsse, CALL_FOR_10BIT_RGB_SRC_FORMATS, rgb_10bit_to_yuv_10bit_coef_lhs8[0], 8, rgb_10bit_to_yuv_10bit_off[0]);
+DEFINE_ANY_RGB_TO_V210_FN(convert_10bit_rgb_to_v210_bt601_nonsse, CALL_FOR_10BIT_RGB_SRC_FORMATS, rgb_10bit_to_yuv_10bit_coef_lhs8[1], 8, rgb_10bit_to_yuv_10bit_off[1]);
+DEFINE_ANY_RGB_TO_V210_FN(convert_10bit_rgb_to_v210_bt709_nonsse, CALL_FOR_10BIT_RGB_SRC_FORMATS, rgb_10bit_to_yuv_10bit_coef_lhs8[2], 8, rgb_10bit_to_yuv_10bit_off[2]);
 
 
 
 //
 // NNB Float
 //
-#define 	DEFINE_ANY_RGB_TO_V210_FLOAT_FN(fn_name, coeffs, offsets) \
-	void 		fn_name(const struct PixFcSSE* pixfc, void* in, void* out)\
+#define 	DEFINE_ANY_RGB_TO_V210_FLOAT_FN(fn_name, rgb_src_formats, coeffs, offsets) \
+	static FORCE_INLINE void fn_name##_fmt(const struct PixFcSSE* pixfc, void* in, void* out, const PixFcPixelFormat src_fmt, const PixFcPixelFormat dest_fmt)\
 	{\
-		PixFcPixelFormat 	src_fmt = pixfc->source_fmt;\
 		uint32_t 			pixel = 0;\
 		uint32_t			line = 0;\
 		uint8_t*			src = (uint8_t *) in;\
 		uint32_t*			dst = (uint32_t *) out;\
-		uint32_t			src_padding_bytes = PADDING_BYTE_COUNT(src_fmt, pixfc->width);\
+		uint32_t			src_padding_bytes = ROW_PADDING_BYTE_COUNT(src_fmt, pixfc->width, pixfc->source_row_bytes);\
 		int32_t				r1 = 0, g1 = 0, b1 = 0, r2 = 0, g2 = 0, b2 = 0;\
 		int32_t				y1, y2, u, v;\
 		while(line++ < pixfc->height){\
@@ -475,34 +520,34 @@ DEFINE_ANY_RGB_TO_V210_FN(convert_10bit_rgb_to_v210_bt709_nonsse, rgb_10bit_to_y
 				*dst |= (CLIP_10BIT_PIXEL(y2) & 0x3FF) << 10;\
 			}\
 			src += src_padding_bytes;\
-			dst = (uint32_t*) ((uint8_t*)out + line * ROW_SIZE(PixFcV210, pixfc->width));\
+			dst = (uint32_t*) ((uint8_t*)out + line * pixfc->dest_row_bytes);\
 			pixel = 0;\
 		}\
 	}\
+	DEFINE_RGB_TO_V210_ENTRY_POINT(fn_name, rgb_src_formats)
 
 /* This conversion function only assumes an even number of pixels */
-DEFINE_ANY_RGB_TO_V210_FLOAT_FN(convert_rgb_to_v210_nonsse_float, rgb_8bit_to_yuv_10bit_coef[0], rgb_8bit_to_yuv_10bit_off[0]);
-DEFINE_ANY_RGB_TO_V210_FLOAT_FN(convert_rgb_to_v210_bt601_nonsse_float, rgb_8bit_to_yuv_10bit_coef[1], rgb_8bit_to_yuv_10bit_off[1]);
-DEFINE_ANY_RGB_TO_V210_FLOAT_FN(convert_rgb_to_v210_bt709_nonsse_float,	rgb_8bit_to_yuv_10bit_coef[2], rgb_8bit_to_yuv_10bit_off[2]);
+DEFINE_ANY_RGB_TO_V210_FLOAT_FN(convert_rgb_to_v210_nonsse_float, CALL_FOR_8BIT_RGB_SRC_FORMATS, rgb_8bit_to_yuv_10bit_coef[0], rgb_8bit_to_yuv_10bit_off[0]);
+DEFINE_ANY_RGB_TO_V210_FLOAT_FN(convert_rgb_to_v210_bt601_nonsse_float, CALL_FOR_8BIT_RGB_SRC_FORMATS, rgb_8bit_to_yuv_10bit_coef[1], rgb_8bit_to_yuv_10bit_off[1]);
+DEFINE_ANY_RGB_TO_V210_FLOAT_FN(convert_rgb_to_v210_bt709_nonsse_float, CALL_FOR_8BIT_RGB_SRC_FORMATS, rgb_8bit_to_yuv_10bit_coef[2], rgb_8bit_to_yuv_10bit_off[2]);
 //
-DEFINE_ANY_RGB_TO_V210_FLOAT_FN(convert_10bit_rgb_to_v210_nonsse_float, rgb_10bit_to_yuv_10bit_coef[0], rgb_10bit_to_yuv_10bit_off[0]);
-DEFINE_ANY_RGB_TO_V210_FLOAT_FN(convert_10bit_rgb_to_v210_bt601_nonsse_float, rgb_10bit_to_yuv_10bit_coef[1], rgb_10bit_to_yuv_10bit_off[1]);
-DEFINE_ANY_RGB_TO_V210_FLOAT_FN(convert_10bit_rgb_to_v210_bt709_nonsse_float,	rgb_10bit_to_yuv_10bit_coef[2], rgb_10bit_to_yuv_10bit_off[2]);
+DEFINE_ANY_RGB_TO_V210_FLOAT_FN(convert_10bit_rgb_to_v210_nonsse_float, CALL_FOR_10BIT_RGB_SRC_FORMATS, rgb_10bit_to_yuv_10bit_coef[0], rgb_10bit_to_yuv_10bit_off[0]);
+DEFINE_ANY_RGB_TO_V210_FLOAT_FN(convert_10bit_rgb_to_v210_bt601_nonsse_float, CALL_FOR_10BIT_RGB_SRC_FORMATS, rgb_10bit_to_yuv_10bit_coef[1], rgb_10bit_to_yuv_10bit_off[1]);
+DEFINE_ANY_RGB_TO_V210_FLOAT_FN(convert_10bit_rgb_to_v210_bt709_nonsse_float, CALL_FOR_10BIT_RGB_SRC_FORMATS, rgb_10bit_to_yuv_10bit_coef[2], rgb_10bit_to_yuv_10bit_off[2]);
 
 
 
 //
 // AVG Integer
 //
-#define 	DEFINE_DOWNSAMPLE_N_CONVERT_ANY_RGB_TO_V210_FN(fn_name, coeffs, coef_shift, offsets) \
-	void 		fn_name(const struct PixFcSSE* pixfc, void* in, void* out)\
+#define 	DEFINE_DOWNSAMPLE_N_CONVERT_ANY_RGB_TO_V210_FN(fn_name, rgb_src_formats, coeffs, coef_shift, offsets) \
+	static FORCE_INLINE void fn_name##_fmt(const struct PixFcSSE* pixfc, void* in, void* out, const PixFcPixelFormat src_fmt, const PixFcPixelFormat dest_fmt)\
 	{\
-		PixFcPixelFormat 	src_fmt = pixfc->source_fmt;\
 		uint32_t 			pixel = 0;\
 		uint32_t			line = 0;\
 		uint8_t*			src = (uint8_t *) in;\
 		uint32_t*			dst = (uint32_t *) out;\
-		uint32_t			src_padding_bytes = PADDING_BYTE_COUNT(src_fmt, pixfc->width);\
+		uint32_t			src_padding_bytes = ROW_PADDING_BYTE_COUNT(src_fmt, pixfc->width, pixfc->source_row_bytes);\
 		int32_t				r1 = 0, g1 = 0, b1 = 0, r2 = 0, g2 = 0, b2 = 0, prev_r = 0, prev_g = 0, prev_b = 0;\
 		int32_t				y1, y2, u, v;\
 		while(line++ < pixfc->height){\
@@ -558,19 +603,20 @@ DEFINE_ANY_RGB_TO_V210_FLOAT_FN(convert_10bit_rgb_to_v210_bt709_nonsse_float,	rg
 				*dst |= (CLIP_10BIT_PIXEL(y2) & 0x3FF) << 10;\
 			}\
 			src += src_padding_bytes;\
-			dst = (uint32_t*) ((uint8_t*)out + line * ROW_SIZE(PixFcV210, pixfc->width));\
+			dst = (uint32_t*) ((uint8_t*)out + line * pixfc->dest_row_bytes);\
 			pixel = 0;\
 		}\
 	}\
+	DEFINE_RGB_TO_V210_ENTRY_POINT(fn_name, rgb_src_formats)
 
 /* This conversion function only assumes an even number of pixels */
-DEFINE_DOWNSAMPLE_N_CONVERT_ANY_RGB_TO_V210_FN(downsample_n_convert_rgb_to_v210_nonsse, rgb_8bit_to_yuv_10bit_coef_lhs8[0], 8, rgb_8bit_to_yuv_10bit_off[0]);
-DEFINE_DOWNSAMPLE_N_CONVERT_ANY_RGB_TO_V210_FN(downsample_n_convert_rgb_to_v210_bt601_nonsse, rgb_8bit_to_yuv_10bit_coef_lhs8[1], 8, rgb_8bit_to_yuv_10bit_off[1]);
-DEFINE_DOWNSAMPLE_N_CONVERT_ANY_RGB_TO_V210_FN(downsample_n_convert_rgb_to_v210_bt709_nonsse,	rgb_8bit_to_yuv_10bit_coef_lhs8[2], 8, rgb_8bit_to_yuv_10bit_off[2]);
+DEFINE_DOWNSAMPLE_N_CONVERT_ANY_RGB_TO_V210_FN(downsample_n_convert_rgb_to_v210_nonsse, CALL_FOR_8BIT_RGB_SRC_FORMATS, rgb_8bit_to_yuv_10bit_coef_lhs8[0], 8, rgb_8bit_to_yuv_10bit_off[0]);
+DEFINE_DOWNSAMPLE_N_CONVERT_ANY_RGB_TO_V210_FN(downsample_n_convert_rgb_to_v210_bt601_nonsse, CALL_FOR_8BIT_RGB_SRC_FORMATS, rgb_8bit_to_yuv_10bit_coef_lhs8[1], 8, rgb_8bit_to_yuv_10bit_off[1]);
+DEFINE_DOWNSAMPLE_N_CONVERT_ANY_RGB_TO_V210_FN(downsample_n_convert_rgb_to_v210_bt709_nonsse, CALL_FOR_8BIT_RGB_SRC_FORMATS, rgb_8bit_to_yuv_10bit_coef_lhs8[2], 8, rgb_8bit_to_yuv_10bit_off[2]);
 //
-DEFINE_DOWNSAMPLE_N_CONVERT_ANY_RGB_TO_V210_FN(downsample_n_convert_10bit_rgb_to_v210_nonsse, rgb_10bit_to_yuv_10bit_coef_lhs8[0], 8, rgb_10bit_to_yuv_10bit_off[0]);
-DEFINE_DOWNSAMPLE_N_CONVERT_ANY_RGB_TO_V210_FN(downsample_n_convert_10bit_rgb_to_v210_bt601_nonsse, rgb_10bit_to_yuv_10bit_coef_lhs8[1], 8, rgb_10bit_to_yuv_10bit_off[1]);
-DEFINE_DOWNSAMPLE_N_CONVERT_ANY_RGB_TO_V210_FN(downsample_n_convert_10bit_rgb_to_v210_bt709_nonsse,	rgb_10bit_to_yuv_10bit_coef_lhs8[2], 8, rgb_10bit_to_yuv_10bit_off[2]);
+DEFINE_DOWNSAMPLE_N_CONVERT_ANY_RGB_TO_V210_FN(downsample_n_convert_10bit_rgb_to_v210_nonsse, CALL_FOR_10BIT_RGB_SRC_FORMATS, rgb_10bit_to_yuv_10bit_coef_lhs8[0], 8, rgb_10bit_to_yuv_10bit_off[0]);
+DEFINE_DOWNSAMPLE_N_CONVERT_ANY_RGB_TO_V210_FN(downsample_n_convert_10bit_rgb_to_v210_bt601_nonsse, CALL_FOR_10BIT_RGB_SRC_FORMATS, rgb_10bit_to_yuv_10bit_coef_lhs8[1], 8, rgb_10bit_to_yuv_10bit_off[1]);
+DEFINE_DOWNSAMPLE_N_CONVERT_ANY_RGB_TO_V210_FN(downsample_n_convert_10bit_rgb_to_v210_bt709_nonsse, CALL_FOR_10BIT_RGB_SRC_FORMATS, rgb_10bit_to_yuv_10bit_coef_lhs8[2], 8, rgb_10bit_to_yuv_10bit_off[2]);
 
 
 
@@ -578,15 +624,14 @@ DEFINE_DOWNSAMPLE_N_CONVERT_ANY_RGB_TO_V210_FN(downsample_n_convert_10bit_rgb_to
 //
 // AVG Float
 //
-#define 	DEFINE_DOWNSAMPLE_N_CONVERT_ANY_RGB_TO_V210_FLOAT_FN(fn_name, coeffs, offsets) \
-	void 		fn_name(const struct PixFcSSE* pixfc, void* in, void* out)\
+#define 	DEFINE_DOWNSAMPLE_N_CONVERT_ANY_RGB_TO_V210_FLOAT_FN(fn_name, rgb_src_formats, coeffs, offsets) \
+	static FORCE_INLINE void fn_name##_fmt(const struct PixFcSSE* pixfc, void* in, void* out, const PixFcPixelFormat src_fmt, const PixFcPixelFormat dest_fmt)\
 	{\
-		PixFcPixelFormat 	src_fmt = pixfc->source_fmt;\
 		uint32_t 			pixel = 0;\
 		uint32_t			line = 0;\
 		uint8_t*			src = (uint8_t *) in;\
 		uint32_t*			dst = (uint32_t *) out;\
-		uint32_t			src_padding_bytes = PADDING_BYTE_COUNT(src_fmt, pixfc->width);\
+		uint32_t			src_padding_bytes = ROW_PADDING_BYTE_COUNT(src_fmt, pixfc->width, pixfc->source_row_bytes);\
 		int32_t				r1 = 0, g1 = 0, b1 = 0, r2 = 0, g2 = 0, b2 = 0, prev_r = 0, prev_g = 0, prev_b = 0;\
 		int32_t				y1 = 0, y2 = 0, u = 0, v = 0;\
 		while(line++ < pixfc->height){\
@@ -642,19 +687,20 @@ DEFINE_DOWNSAMPLE_N_CONVERT_ANY_RGB_TO_V210_FN(downsample_n_convert_10bit_rgb_to
 				*dst |= (CLIP_10BIT_PIXEL(y2) & 0x3FF) << 10;\
 			}\
 			src += src_padding_bytes;\
-			dst = (uint32_t*) ((uint8_t*)out + line * ROW_SIZE(PixFcV210, pixfc->width));\
+			dst = (uint32_t*) ((uint8_t*)out + line * pixfc->dest_row_bytes);\
 			pixel = 0;\
 		}\
 	}\
+	DEFINE_RGB_TO_V210_ENTRY_POINT(fn_name, rgb_src_formats)
 
 /* This conversion function only assumes an even number of pixels */
-DEFINE_DOWNSAMPLE_N_CONVERT_ANY_RGB_TO_V210_FLOAT_FN(downsample_n_convert_rgb_to_v210_nonsse_float, rgb_8bit_to_yuv_10bit_coef[0], rgb_8bit_to_yuv_10bit_off[0]);
-DEFINE_DOWNSAMPLE_N_CONVERT_ANY_RGB_TO_V210_FLOAT_FN(downsample_n_convert_rgb_to_v210_bt601_nonsse_float, rgb_8bit_to_yuv_10bit_coef[1], rgb_8bit_to_yuv_10bit_off[1]);
-DEFINE_DOWNSAMPLE_N_CONVERT_ANY_RGB_TO_V210_FLOAT_FN(downsample_n_convert_rgb_to_v210_bt709_nonsse_float,	rgb_8bit_to_yuv_10bit_coef[2], rgb_8bit_to_yuv_10bit_off[2]);
+DEFINE_DOWNSAMPLE_N_CONVERT_ANY_RGB_TO_V210_FLOAT_FN(downsample_n_convert_rgb_to_v210_nonsse_float, CALL_FOR_8BIT_RGB_SRC_FORMATS, rgb_8bit_to_yuv_10bit_coef[0], rgb_8bit_to_yuv_10bit_off[0]);
+DEFINE_DOWNSAMPLE_N_CONVERT_ANY_RGB_TO_V210_FLOAT_FN(downsample_n_convert_rgb_to_v210_bt601_nonsse_float, CALL_FOR_8BIT_RGB_SRC_FORMATS, rgb_8bit_to_yuv_10bit_coef[1], rgb_8bit_to_yuv_10bit_off[1]);
+DEFINE_DOWNSAMPLE_N_CONVERT_ANY_RGB_TO_V210_FLOAT_FN(downsample_n_convert_rgb_to_v210_bt709_nonsse_float, CALL_FOR_8BIT_RGB_SRC_FORMATS, rgb_8bit_to_yuv_10bit_coef[2], rgb_8bit_to_yuv_10bit_off[2]);
 //
-DEFINE_DOWNSAMPLE_N_CONVERT_ANY_RGB_TO_V210_FLOAT_FN(downsample_n_convert_10bit_rgb_to_v210_nonsse_float, rgb_10bit_to_yuv_10bit_coef[0], rgb_10bit_to_yuv_10bit_off[0]);
-DEFINE_DOWNSAMPLE_N_CONVERT_ANY_RGB_TO_V210_FLOAT_FN(downsample_n_convert_10bit_rgb_to_v210_bt601_nonsse_float, rgb_10bit_to_yuv_10bit_coef[1], rgb_10bit_to_yuv_10bit_off[1]);
-DEFINE_DOWNSAMPLE_N_CONVERT_ANY_RGB_TO_V210_FLOAT_FN(downsample_n_convert_10bit_rgb_to_v210_bt709_nonsse_float,	rgb_10bit_to_yuv_10bit_coef[2], rgb_10bit_to_yuv_10bit_off[2]);
+DEFINE_DOWNSAMPLE_N_CONVERT_ANY_RGB_TO_V210_FLOAT_FN(downsample_n_convert_10bit_rgb_to_v210_nonsse_float, CALL_FOR_10BIT_RGB_SRC_FORMATS, rgb_10bit_to_yuv_10bit_coef[0], rgb_10bit_to_yuv_10bit_off[0]);
+DEFINE_DOWNSAMPLE_N_CONVERT_ANY_RGB_TO_V210_FLOAT_FN(downsample_n_convert_10bit_rgb_to_v210_bt601_nonsse_float, CALL_FOR_10BIT_RGB_SRC_FORMATS, rgb_10bit_to_yuv_10bit_coef[1], rgb_10bit_to_yuv_10bit_off[1]);
+DEFINE_DOWNSAMPLE_N_CONVERT_ANY_RGB_TO_V210_FLOAT_FN(downsample_n_convert_10bit_rgb_to_v210_bt709_nonsse_float, CALL_FOR_10BIT_RGB_SRC_FORMATS, rgb_10bit_to_yuv_10bit_coef[2], rgb_10bit_to_yuv_10bit_off[2]);
 
 
 
@@ -669,6 +715,17 @@ DEFINE_DOWNSAMPLE_N_CONVERT_ANY_RGB_TO_V210_FLOAT_FN(downsample_n_convert_10bit_
  * 		Y U V 4 2 0
  */
 
+// Define fn_name() to call fn_name##_fmt() (see CALL_FOR_FORMATS) with each
+// 8-bit RGB source format and each YUV420P / NV12 / NV21 destination format.
+#define DEFINE_RGB_TO_YUV420_ENTRY_POINT(fn_name)\
+void fn_name(const struct PixFcSSE* conv, void* in, void* out)\
+{\
+	CALL_FOR_8BIT_RGB_SRC_FORMATS(fn_name##_fmt, conv, in, out, PixFcYUV420P)\
+	CALL_FOR_8BIT_RGB_SRC_FORMATS(fn_name##_fmt, conv, in, out, PixFcNV12)\
+	CALL_FOR_8BIT_RGB_SRC_FORMATS(fn_name##_fmt, conv, in, out, PixFcNV21)\
+	printf("Unknown pixel format in non-SSE conversion from RGB\n");\
+}
+
 //
 // NNB Integer
 //
@@ -697,19 +754,18 @@ DEFINE_DOWNSAMPLE_N_CONVERT_ANY_RGB_TO_V210_FLOAT_FN(downsample_n_convert_10bit_
 
 
 #define 	DEFINE_ANY_RGB_TO_YUV420_FN(fn_name, coeffs, coef_shift, offsets) \
-void fn_name(const struct PixFcSSE* conv, void* in, void* out)\
+static FORCE_INLINE void fn_name##_fmt(const struct PixFcSSE* conv, void* in, void* out, const PixFcPixelFormat src_fmt, const PixFcPixelFormat dest_fmt)\
 {\
-	PixFcPixelFormat 	dest_fmt = conv->dest_fmt;\
-	PixFcPixelFormat 	src_fmt = conv->source_fmt;\
 	uint8_t				input_stride = ((src_fmt == PixFcARGB) || (src_fmt == PixFcBGRA)) ? 4 : 3;\
 	uint32_t			pixel_count = conv->pixel_count;\
 	uint8_t*			src_line1 = (uint8_t *) in;\
-	uint8_t*			src_line2 = src_line1 + conv->width * input_stride;\
+	uint8_t*			src_line2 = src_line1 + conv->source_row_bytes;\
 	uint8_t*			dst = (uint8_t *) out;\
 	uint8_t*			y_line1 = dst;\
 	uint8_t*			y_line2 = y_line1 + conv->width;\
-	uint8_t*			u_plane = dst + pixel_count;\
-	uint8_t*			v_plane = u_plane + pixel_count / 4;\
+	uint8_t*			u_plane = dst + pixel_count + ((dest_fmt == PixFcNV21) ? 1 : 0);\
+	uint8_t*			v_plane = (dest_fmt == PixFcYUV420P) ? u_plane + pixel_count / 4 : dst + pixel_count + ((dest_fmt == PixFcNV21) ? 0 : 1);\
+	uint32_t			uv_step = (dest_fmt == PixFcYUV420P) ? 1 : 2;\
 	int32_t				r1_line1 = 0, g1_line1 = 0, b1_line1 = 0, r2_line1 = 0, g2_line1 = 0, b2_line1 = 0;\
 	int32_t				r1_line2 = 0, g1_line2 = 0, b1_line2 = 0, r2_line2 = 0, g2_line2 = 0, b2_line2 = 0;\
 	int32_t				y1_line1, y2_line1, y1_line2, y2_line2, u, v;\
@@ -780,26 +836,29 @@ void fn_name(const struct PixFcSSE* conv, void* in, void* out)\
 			} else\
 				printf("Unknown source pixel format in non-SSE conversion from RGB\n");\
 			NNB_CONVERT_RGB_TO_YUV420(r1_line1, g1_line1, b1_line1, r2_line1, g2_line1, b2_line1, r1_line2, g1_line2, b1_line2, r2_line2, g2_line2, b2_line2, y1_line1, y2_line1, y1_line2, y2_line2 , u, v, coef_shift, coeffs, offsets); \
-			if (dest_fmt == PixFcYUV420P) {\
+			if ((dest_fmt == PixFcYUV420P) || (dest_fmt == PixFcNV12) || (dest_fmt == PixFcNV21)) {\
 				*(y_line1++) = CLIP_PIXEL(y1_line1);\
 				*(y_line1++) = CLIP_PIXEL(y2_line1);\
 				*(y_line2++) = CLIP_PIXEL(y1_line2);\
 				*(y_line2++) = CLIP_PIXEL(y2_line2);\
-				*(u_plane++) = CLIP_PIXEL(u);\
-				*(v_plane++) = CLIP_PIXEL(v);\
+				*u_plane = CLIP_PIXEL(u);\
+				*v_plane = CLIP_PIXEL(v);\
+				u_plane += uv_step;\
+				v_plane += uv_step;\
 			} else {\
 				printf("Unknown output format in non-SSE conversion from RGB\n");\
 			}\
 			col -= 2;\
 		}\
-		src_line1 += conv->width * input_stride;\
-		src_line2 += conv->width * input_stride;\
+		src_line1 += 2 * conv->source_row_bytes - conv->width * input_stride;\
+		src_line2 += 2 * conv->source_row_bytes - conv->width * input_stride;\
 		y_line1 += conv->width;\
 		y_line2 += conv->width;\
 		line -= 2;\
 		col = conv->width;\
 	}\
-}
+}\
+DEFINE_RGB_TO_YUV420_ENTRY_POINT(fn_name)
 
 // These functions assume an even number of pixels and lines
 DEFINE_ANY_RGB_TO_YUV420_FN(convert_rgb_to_yuv420_nonsse, rgb_8bit_to_yuv_8bit_coef_lhs8[0], 8, rgb_8bit_to_yuv_8bit_off[0]);
@@ -811,19 +870,18 @@ DEFINE_ANY_RGB_TO_YUV420_FN(convert_rgb_to_yuv420_bt709_nonsse, rgb_8bit_to_yuv_
 // NNB Float
 //
 #define 	DEFINE_ANY_RGB_TO_YUV420_FLOAT_FN(fn_name, coeffs, offsets) \
-void fn_name(const struct PixFcSSE* conv, void* in, void* out)\
+static FORCE_INLINE void fn_name##_fmt(const struct PixFcSSE* conv, void* in, void* out, const PixFcPixelFormat src_fmt, const PixFcPixelFormat dest_fmt)\
 {\
-	PixFcPixelFormat 	dest_fmt = conv->dest_fmt;\
-	PixFcPixelFormat 	src_fmt = conv->source_fmt;\
 	uint8_t				input_stride = ((src_fmt == PixFcARGB) || (src_fmt == PixFcBGRA)) ? 4 : 3;\
 	uint32_t			pixel_count = conv->pixel_count;\
 	uint8_t*			src_line1 = (uint8_t *) in;\
-	uint8_t*			src_line2 = src_line1 + conv->width * input_stride;\
+	uint8_t*			src_line2 = src_line1 + conv->source_row_bytes;\
 	uint8_t*			dst = (uint8_t *) out;\
 	uint8_t*			y_line1 = dst;\
 	uint8_t*			y_line2 = y_line1 + conv->width;\
-	uint8_t*			u_plane = dst + pixel_count;\
-	uint8_t*			v_plane = u_plane + pixel_count / 4;\
+	uint8_t*			u_plane = dst + pixel_count + ((dest_fmt == PixFcNV21) ? 1 : 0);\
+	uint8_t*			v_plane = (dest_fmt == PixFcYUV420P) ? u_plane + pixel_count / 4 : dst + pixel_count + ((dest_fmt == PixFcNV21) ? 0 : 1);\
+	uint32_t			uv_step = (dest_fmt == PixFcYUV420P) ? 1 : 2;\
 	int32_t				r1_line1 = 0, g1_line1 = 0, b1_line1 = 0, r2_line1 = 0, g2_line1 = 0, b2_line1 = 0;\
 	int32_t				r1_line2 = 0, g1_line2 = 0, b1_line2 = 0, r2_line2 = 0, g2_line2 = 0, b2_line2 = 0;\
 	int32_t				y1_line1, y2_line1, y1_line2, y2_line2, u, v;\
@@ -894,26 +952,29 @@ void fn_name(const struct PixFcSSE* conv, void* in, void* out)\
 			} else\
 				printf("Unknown source pixel format in non-SSE conversion from RGB\n");\
 			NNB_CONVERT_RGB_TO_YUV420_FLOAT(r1_line1, g1_line1, b1_line1, r2_line1, g2_line1, b2_line1, r1_line2, g1_line2, b1_line2, r2_line2, g2_line2, b2_line2, y1_line1, y2_line1, y1_line2, y2_line2 , u, v, coeffs, offsets); \
-			if (dest_fmt == PixFcYUV420P) {\
+			if ((dest_fmt == PixFcYUV420P) || (dest_fmt == PixFcNV12) || (dest_fmt == PixFcNV21)) {\
 				*(y_line1++) = CLIP_PIXEL(y1_line1);\
 				*(y_line1++) = CLIP_PIXEL(y2_line1);\
 				*(y_line2++) = CLIP_PIXEL(y1_line2);\
 				*(y_line2++) = CLIP_PIXEL(y2_line2);\
-				*(u_plane++) = CLIP_PIXEL(u);\
-				*(v_plane++) = CLIP_PIXEL(v);\
+				*u_plane = CLIP_PIXEL(u);\
+				*v_plane = CLIP_PIXEL(v);\
+				u_plane += uv_step;\
+				v_plane += uv_step;\
 			} else {\
 				printf("Unknown output format in non-SSE conversion from RGB\n");\
 			}\
 			col -= 2;\
 		}\
-		src_line1 += conv->width * input_stride;\
-		src_line2 += conv->width * input_stride;\
+		src_line1 += 2 * conv->source_row_bytes - conv->width * input_stride;\
+		src_line2 += 2 * conv->source_row_bytes - conv->width * input_stride;\
 		y_line1 += conv->width;\
 		y_line2 += conv->width;\
 		line -= 2;\
 		col = conv->width;\
 	}\
-}
+}\
+DEFINE_RGB_TO_YUV420_ENTRY_POINT(fn_name)
 
 // These functions assume an even number of pixels and lines
 DEFINE_ANY_RGB_TO_YUV420_FLOAT_FN(convert_rgb_to_yuv420_nonsse_float, rgb_8bit_to_yuv_8bit_coef[0], rgb_8bit_to_yuv_8bit_off[0]);
@@ -922,6 +983,196 @@ DEFINE_ANY_RGB_TO_YUV420_FLOAT_FN(convert_rgb_to_yuv420_bt709_nonsse_float, rgb_
 
 
 
+//
+// AVG Integer
+//
+// Both lines are first averaged vertically, then the chroma samples are
+// produced with the same 3-tap [1 2 1] filter as the 422 AVG conversions.
+#define AVG_CONVERT_RGB_TO_YUV420(prev_r, prev_g, prev_b, r1_line1, g1_line1, b1_line1, r2_line1, g2_line1, b2_line1, r1_line2, g1_line2, b1_line2, r2_line2, g2_line2, b2_line2, y1_line1, y2_line1, y1_line2, y2_line2 , u, v, coef_shift, coeffs, offsets) \
+		y1_line1 = ((coeffs[0][0] * r1_line1 + coeffs[0][1] * g1_line1 + coeffs[0][2] * b1_line1) >> coef_shift) + offsets[0];\
+		y2_line1 = ((coeffs[0][0] * r2_line1 + coeffs[0][1] * g2_line1 + coeffs[0][2] * b2_line1) >> coef_shift) + offsets[0];\
+		y1_line2 = ((coeffs[0][0] * r1_line2 + coeffs[0][1] * g1_line2 + coeffs[0][2] * b1_line2) >> coef_shift) + offsets[0];\
+		y2_line2 = ((coeffs[0][0] * r2_line2 + coeffs[0][1] * g2_line2 + coeffs[0][2] * b2_line2) >> coef_shift) + offsets[0];\
+		r1_line1 = (r1_line1 + r1_line2) / 2;\
+		g1_line1 = (g1_line1 + g1_line2) / 2;\
+		b1_line1 = (b1_line1 + b1_line2) / 2;\
+		r2_line1 = (r2_line1 + r2_line2) / 2;\
+		g2_line1 = (g2_line1 + g2_line2) / 2;\
+		b2_line1 = (b2_line1 + b2_line2) / 2;\
+		u = ((coeffs[1][0] * (((prev_r + r2_line1) / 2 + r1_line1) / 2) + coeffs[1][1] * (((prev_g + g2_line1) / 2 + g1_line1) / 2) + coeffs[1][2] * (((prev_b + b2_line1) / 2 + b1_line1) / 2)) >> coef_shift) + offsets[1];\
+		v = ((coeffs[2][0] * (((prev_r + r2_line1) / 2 + r1_line1) / 2) + coeffs[2][1] * (((prev_g + g2_line1) / 2 + g1_line1) / 2) + coeffs[2][2] * (((prev_b + b2_line1) / 2 + b1_line1) / 2)) >> coef_shift) + offsets[2];\
+
+
+#define AVG_CONVERT_RGB_TO_YUV420_FLOAT(prev_r, prev_g, prev_b, r1_line1, g1_line1, b1_line1, r2_line1, g2_line1, b2_line1, r1_line2, g1_line2, b1_line2, r2_line2, g2_line2, b2_line2, y1_line1, y2_line1, y1_line2, y2_line2 , u, v, coeffs, offsets) \
+		y1_line1 = (coeffs[0][0] * r1_line1 + coeffs[0][1] * g1_line1 + coeffs[0][2] * b1_line1) + offsets[0];\
+		y2_line1 = (coeffs[0][0] * r2_line1 + coeffs[0][1] * g2_line1 + coeffs[0][2] * b2_line1) + offsets[0];\
+		y1_line2 = (coeffs[0][0] * r1_line2 + coeffs[0][1] * g1_line2 + coeffs[0][2] * b1_line2) + offsets[0];\
+		y2_line2 = (coeffs[0][0] * r2_line2 + coeffs[0][1] * g2_line2 + coeffs[0][2] * b2_line2) + offsets[0];\
+		r1_line1 = (r1_line1 + r1_line2) / 2.0f;\
+		g1_line1 = (g1_line1 + g1_line2) / 2.0f;\
+		b1_line1 = (b1_line1 + b1_line2) / 2.0f;\
+		r2_line1 = (r2_line1 + r2_line2) / 2.0f;\
+		g2_line1 = (g2_line1 + g2_line2) / 2.0f;\
+		b2_line1 = (b2_line1 + b2_line2) / 2.0f;\
+		u = coeffs[1][0] * (((prev_r + r2_line1) / 2.0f + r1_line1) / 2.0f) + coeffs[1][1] * (((prev_g + g2_line1) / 2.0f + g1_line1) / 2.0f) + coeffs[1][2] * (((prev_b + b2_line1) / 2.0f + b1_line1) / 2.0f) + offsets[1];\
+		v = coeffs[2][0] * (((prev_r + r2_line1) / 2.0f + r1_line1) / 2.0f) + coeffs[2][1] * (((prev_g + g2_line1) / 2.0f + g1_line1) / 2.0f) + coeffs[2][2] * (((prev_b + b2_line1) / 2.0f + b1_line1) / 2.0f) + offsets[2];\
+
+
+// The first 2 pixels on a line pair use the first (vertically averaged) pixel
+// as their previous pixel.
+#define 	DEFINE_DOWNSAMPLE_N_CONVERT_ANY_RGB_TO_YUV420_FN(fn_name, convert_macro, ...) \
+static FORCE_INLINE void fn_name##_fmt(const struct PixFcSSE* conv, void* in, void* out, const PixFcPixelFormat src_fmt, const PixFcPixelFormat dest_fmt)\
+{\
+	uint8_t				input_stride = ((src_fmt == PixFcARGB) || (src_fmt == PixFcBGRA)) ? 4 : 3;\
+	uint32_t			pixel_count = conv->pixel_count;\
+	uint8_t*			src_line1 = (uint8_t *) in;\
+	uint8_t*			src_line2 = src_line1 + conv->source_row_bytes;\
+	uint8_t*			dst = (uint8_t *) out;\
+	uint8_t*			y_line1 = dst;\
+	uint8_t*			y_line2 = y_line1 + conv->width;\
+	uint8_t*			u_plane = dst + pixel_count + ((dest_fmt == PixFcNV21) ? 1 : 0);\
+	uint8_t*			v_plane = (dest_fmt == PixFcYUV420P) ? u_plane + pixel_count / 4 : dst + pixel_count + ((dest_fmt == PixFcNV21) ? 0 : 1);\
+	uint32_t			uv_step = (dest_fmt == PixFcYUV420P) ? 1 : 2;\
+	int32_t				r1_line1 = 0, g1_line1 = 0, b1_line1 = 0, r2_line1 = 0, g2_line1 = 0, b2_line1 = 0;\
+	int32_t				r1_line2 = 0, g1_line2 = 0, b1_line2 = 0, r2_line2 = 0, g2_line2 = 0, b2_line2 = 0;\
+	int32_t				prev_r = 0, prev_g = 0, prev_b = 0;\
+	int32_t				y1_line1, y2_line1, y1_line2, y2_line2, u, v;\
+	uint32_t			line = conv->height;\
+	uint32_t			col;\
+	while(line > 0){\
+		col = conv->width - 2; /* first 2 pixels handled outside main loop */\
+		UNPACK_RGB(src_line1, r1_line1, g1_line1, b1_line1, r2_line1, g2_line1, b2_line1, src_fmt);\
+		UNPACK_RGB(src_line2, r1_line2, g1_line2, b1_line2, r2_line2, g2_line2, b2_line2, src_fmt);\
+		convert_macro(r1_line1, g1_line1, b1_line1, r1_line1, g1_line1, b1_line1, r2_line1, g2_line1, b2_line1, r1_line2, g1_line2, b1_line2, r2_line2, g2_line2, b2_line2, y1_line1, y2_line1, y1_line2, y2_line2 , u, v, __VA_ARGS__); \
+		prev_r = r2_line1; prev_g = g2_line1; prev_b = b2_line1;\
+		*(y_line1++) = CLIP_PIXEL(y1_line1);\
+		*(y_line1++) = CLIP_PIXEL(y2_line1);\
+		*(y_line2++) = CLIP_PIXEL(y1_line2);\
+		*(y_line2++) = CLIP_PIXEL(y2_line2);\
+		*u_plane = CLIP_PIXEL(u);\
+		*v_plane = CLIP_PIXEL(v);\
+		u_plane += uv_step;\
+		v_plane += uv_step;\
+		while(col > 0){\
+			UNPACK_RGB(src_line1, r1_line1, g1_line1, b1_line1, r2_line1, g2_line1, b2_line1, src_fmt);\
+			UNPACK_RGB(src_line2, r1_line2, g1_line2, b1_line2, r2_line2, g2_line2, b2_line2, src_fmt);\
+			convert_macro(prev_r, prev_g, prev_b, r1_line1, g1_line1, b1_line1, r2_line1, g2_line1, b2_line1, r1_line2, g1_line2, b1_line2, r2_line2, g2_line2, b2_line2, y1_line1, y2_line1, y1_line2, y2_line2 , u, v, __VA_ARGS__); \
+			prev_r = r2_line1; prev_g = g2_line1; prev_b = b2_line1;\
+			*(y_line1++) = CLIP_PIXEL(y1_line1);\
+			*(y_line1++) = CLIP_PIXEL(y2_line1);\
+			*(y_line2++) = CLIP_PIXEL(y1_line2);\
+			*(y_line2++) = CLIP_PIXEL(y2_line2);\
+			*u_plane = CLIP_PIXEL(u);\
+			*v_plane = CLIP_PIXEL(v);\
+			u_plane += uv_step;\
+			v_plane += uv_step;\
+			col -= 2;\
+		}\
+		src_line1 += 2 * conv->source_row_bytes - conv->width * input_stride;\
+		src_line2 += 2 * conv->source_row_bytes - conv->width * input_stride;\
+		y_line1 += conv->width;\
+		y_line2 += conv->width;\
+		line -= 2;\
+	}\
+}\
+DEFINE_RGB_TO_YUV420_ENTRY_POINT(fn_name)
+
+// These functions assume an even number of pixels and lines
+DEFINE_DOWNSAMPLE_N_CONVERT_ANY_RGB_TO_YUV420_FN(downsample_n_convert_rgb_to_yuv420_nonsse, AVG_CONVERT_RGB_TO_YUV420, 8, rgb_8bit_to_yuv_8bit_coef_lhs8[0], rgb_8bit_to_yuv_8bit_off[0]);
+DEFINE_DOWNSAMPLE_N_CONVERT_ANY_RGB_TO_YUV420_FN(downsample_n_convert_rgb_to_yuv420_bt601_nonsse, AVG_CONVERT_RGB_TO_YUV420, 8, rgb_8bit_to_yuv_8bit_coef_lhs8[1], rgb_8bit_to_yuv_8bit_off[1]);
+DEFINE_DOWNSAMPLE_N_CONVERT_ANY_RGB_TO_YUV420_FN(downsample_n_convert_rgb_to_yuv420_bt709_nonsse, AVG_CONVERT_RGB_TO_YUV420, 8, rgb_8bit_to_yuv_8bit_coef_lhs8[2], rgb_8bit_to_yuv_8bit_off[2]);
+
+
+//
+// AVG Float
+//
+DEFINE_DOWNSAMPLE_N_CONVERT_ANY_RGB_TO_YUV420_FN(downsample_n_convert_rgb_to_yuv420_nonsse_float, AVG_CONVERT_RGB_TO_YUV420_FLOAT, rgb_8bit_to_yuv_8bit_coef[0], rgb_8bit_to_yuv_8bit_off[0]);
+DEFINE_DOWNSAMPLE_N_CONVERT_ANY_RGB_TO_YUV420_FN(downsample_n_convert_rgb_to_yuv420_bt601_nonsse_float, AVG_CONVERT_RGB_TO_YUV420_FLOAT, rgb_8bit_to_yuv_8bit_coef[1], rgb_8bit_to_yuv_8bit_off[1]);
+DEFINE_DOWNSAMPLE_N_CONVERT_ANY_RGB_TO_YUV420_FN(downsample_n_convert_rgb_to_yuv420_bt709_nonsse_float, AVG_CONVERT_RGB_TO_YUV420_FLOAT, rgb_8bit_to_yuv_8bit_coef[2], rgb_8bit_to_yuv_8bit_off[2]);
+
+
+
+/*
+ *
+ * 		R G B
+ *
+ * 		T O
+ *
+ * 		P 2 1 0  /  P 0 1 0
+ */
+// Define fn_name() to call fn_name##_fmt() (see CALL_FOR_FORMATS) with each
+// of the given RGB source formats and each P210 / P010 destination format.
+#define DEFINE_RGB_TO_P210_ENTRY_POINT(fn_name, rgb_src_formats)\
+void fn_name(const struct PixFcSSE* conv, void* in, void* out)\
+{\
+	rgb_src_formats(fn_name##_fmt, conv, in, out, PixFcP210)\
+	rgb_src_formats(fn_name##_fmt, conv, in, out, PixFcP010)\
+	printf("Unknown pixel format in non-SSE conversion from RGB\n");\
+}
+
+// For P010, the chroma samples of the second line in each pair are averaged
+// with the ones already stored for the first line.
+#define 	DEFINE_ANY_RGB_TO_P210_FN(fn_name, rgb_src_formats, convert_macro, ...) \
+static FORCE_INLINE void fn_name##_fmt(const struct PixFcSSE* conv, void* in, void* out, const PixFcPixelFormat src_fmt, const PixFcPixelFormat dest_fmt)\
+{\
+	uint32_t			src_padding_bytes = ROW_PADDING_BYTE_COUNT(src_fmt, conv->width, conv->source_row_bytes);\
+	uint32_t			chroma_line_shift = (dest_fmt == PixFcP010) ? 1 : 0;\
+	uint32_t			average_chroma;\
+	uint8_t*			src = (uint8_t *) in;\
+	uint16_t*			y_plane = (uint16_t *) out;\
+	uint16_t*			uv_plane;\
+	int32_t				r1 = 0, g1 = 0, b1 = 0, r2 = 0, g2 = 0, b2 = 0;\
+	int32_t				y1, y2, u, v;\
+	uint32_t			line = 0;\
+	uint32_t			pixel;\
+	while(line < conv->height){\
+		uv_plane = (uint16_t *) out + conv->pixel_count + (line >> chroma_line_shift) * conv->width;\
+		average_chroma = chroma_line_shift && (line & 1);\
+		pixel = conv->width;\
+		while(pixel > 0){\
+			UNPACK_RGB(src, r1, g1, b1, r2, g2, b2, src_fmt);\
+			convert_macro(r1, g1, b1, r2, g2, b2, y1, u, v, y2, __VA_ARGS__);\
+			u = CLIP_10BIT_PIXEL(u);\
+			v = CLIP_10BIT_PIXEL(v);\
+			*(y_plane++) = (uint16_t) (CLIP_10BIT_PIXEL(y1) << 6);\
+			*(y_plane++) = (uint16_t) (CLIP_10BIT_PIXEL(y2) << 6);\
+			if (average_chroma) {\
+				u = ((uv_plane[0] >> 6) + u + 1) >> 1;\
+				v = ((uv_plane[1] >> 6) + v + 1) >> 1;\
+			}\
+			*(uv_plane++) = (uint16_t) (u << 6);\
+			*(uv_plane++) = (uint16_t) (v << 6);\
+			pixel -= 2;\
+		}\
+		src += src_padding_bytes;\
+		line++;\
+	}\
+}\
+DEFINE_RGB_TO_P210_ENTRY_POINT(fn_name, rgb_src_formats)
+
+// These functions assume an even number of pixels (and lines for P010)
+DEFINE_ANY_RGB_TO_P210_FN(convert_rgb_to_p210_nonsse, CALL_FOR_8BIT_RGB_SRC_FORMATS, NNB_CONVERT_RGB_TO_YUV422, 8, rgb_8bit_to_yuv_10bit_coef_lhs8[0], rgb_8bit_to_yuv_10bit_off[0]);
+DEFINE_ANY_RGB_TO_P210_FN(convert_rgb_to_p210_bt601_nonsse, CALL_FOR_8BIT_RGB_SRC_FORMATS, NNB_CONVERT_RGB_TO_YUV422, 8, rgb_8bit_to_yuv_10bit_coef_lhs8[1], rgb_8bit_to_yuv_10bit_off[1]);
+DEFINE_ANY_RGB_TO_P210_FN(convert_rgb_to_p210_bt709_nonsse, CALL_FOR_8BIT_RGB_SRC_FORMATS, NNB_CONVERT_RGB_TO_YUV422, 8, rgb_8bit_to_yuv_10bit_coef_lhs8[2], rgb_8bit_to_yuv_10bit_off[2]);
+//
+DEFINE_ANY_RGB_TO_P210_FN(convert_10bit_rgb_to_p210_nonsse, CALL_FOR_10BIT_RGB_SRC_FORMATS, NNB_CONVERT_RGB_TO_YUV422, 8, rgb_10bit_to_yuv_10bit_coef_lhs8[0], rgb_10bit_to_yuv_10bit_off[0]);
+DEFINE_ANY_RGB_TO_P210_FN(convert_10bit_rgb_to_p210_bt601_nonsse, CALL_FOR_10BIT_RGB_SRC_FORMATS, NNB_CONVERT_RGB_TO_YUV422, 8, rgb_10bit_to_yuv_10bit_coef_lhs8[1], rgb_10bit_to_yuv_10bit_off[1]);
+DEFINE_ANY_RGB_TO_P210_FN(convert_10bit_rgb_to_p210_bt709_nonsse, CALL_FOR_10BIT_RGB_SRC_FORMATS, NNB_CONVERT_RGB_TO_YUV422, 8, rgb_10bit_to_yuv_10bit_coef_lhs8[2], rgb_10bit_to_yuv_10bit_off[2]);
+
+
+//
+// NNB Float
+//
+DEFINE_ANY_RGB_TO_P210_FN(convert_rgb_to_p210_nonsse_float, CALL_FOR_8BIT_RGB_SRC_FORMATS, NNB_CONVERT_RGB_TO_YUV422_FLOAT, rgb_8bit_to_yuv_10bit_coef[0], rgb_8bit_to_yuv_10bit_off[0]);
+DEFINE_ANY_RGB_TO_P210_FN(convert_rgb_to_p210_bt601_nonsse_float, CALL_FOR_8BIT_RGB_SRC_FORMATS, NNB_CONVERT_RGB_TO_YUV422_FLOAT, rgb_8bit_to_yuv_10bit_coef[1], rgb_8bit_to_yuv_10bit_off[1]);
+DEFINE_ANY_RGB_TO_P210_FN(convert_rgb_to_p210_bt709_nonsse_float, CALL_FOR_8BIT_RGB_SRC_FORMATS, NNB_CONVERT_RGB_TO_YUV422_FLOAT, rgb_8bit_to_yuv_10bit_coef[2], rgb_8bit_to_yuv_10bit_off[2]);
+//
+DEFINE_ANY_RGB_TO_P210_FN(convert_10bit_rgb_to_p210_nonsse_float, CALL_FOR_10BIT_RGB_SRC_FORMATS, NNB_CONVERT_RGB_TO_YUV422_FLOAT, rgb_10bit_to_yuv_10bit_coef[0], rgb_10bit_to_yuv_10bit_off[0]);
+DEFINE_ANY_RGB_TO_P210_FN(convert_10bit_rgb_to_p210_bt601_nonsse_float, CALL_FOR_10BIT_RGB_SRC_FORMATS, NNB_CONVERT_RGB_TO_YUV422_FLOAT, rgb_10bit_to_yuv_10bit_coef[1], rgb_10bit_to_yuv_10bit_off[1]);
+DEFINE_ANY_RGB_TO_P210_FN(convert_10bit_rgb_to_p210_bt709_nonsse_float, CALL_FOR_10BIT_RGB_SRC_FORMATS, NNB_CONVERT_RGB_TO_YUV422_FLOAT, rgb_10bit_to_yuv_10bit_coef[2], rgb_10bit_to_yuv_10bit_off[2]);
+
+
+
 /*
  *
  * 		any R G B
@@ -932,14 +1183,13 @@ DEFINE_ANY_RGB_TO_YUV420_FLOAT_FN(convert_rgb_to_yuv420_bt709_nonsse_float, rgb_
  *
  */
 // This conversion assumes an even number of pixels
-void		convert_rgb_to_10bit_rgb_nonsse(const struct PixFcSSE* pixfc, void* in, void* out) {
-	PixFcPixelFormat 	src_fmt = pixfc->source_fmt;
-	PixFcPixelFormat 	dst_fmt = pixfc->dest_fmt;
+static FORCE_INLINE void convert_rgb_to_10bit_rgb_nonsse_fmt(const struct PixFcSSE* pixfc, void* in, void* out, const PixFcPixelFormat src_fmt, const PixFcPixelFormat dst_fmt) {
 	uint32_t 			pixel = 0;
 	uint32_t			line = 0;
 	uint8_t*			src = (uint8_t *) in;
 	uint8_t*			dst = (uint8_t *) out;
-	uint32_t			dst_row_byte_count = ROW_SIZE(dst_fmt, pixfc->width);
+	uint32_t			src_row_byte_count = pixfc->source_row_bytes;
+	uint32_t			dst_row_byte_count = pixfc->dest_row_bytes;
 	int32_t				r1 = 0, g1 = 0, b1 = 0, r2 = 0, g2 = 0, b2 = 0;
 	while(line++ < pixfc->height){
 		while(pixel < pixfc->width) {
@@ -954,7 +1204,64 @@ void		convert_rgb_to_10bit_rgb_nonsse(const struct PixFcSSE* pixfc, void* in, vo
 			PACK_R210(r2, g2, b2, dst, dst_fmt);
 			pixel += 2;
 		}
+		src = (uint8_t*)in + line * src_row_byte_count;
 		dst = (uint8_t*)out + line * dst_row_byte_count;
 		pixel = 0;
 	}
 }
+
+void		convert_rgb_to_10bit_rgb_nonsse(const struct PixFcSSE* pixfc, void* in, void* out) {
+	CALL_FOR_8BIT_RGB_SRC_FORMATS(convert_rgb_to_10bit_rgb_nonsse_fmt, pixfc, in, out, PixFcR210);
+	CALL_FOR_8BIT_RGB_SRC_FORMATS(convert_rgb_to_10bit_rgb_nonsse_fmt, pixfc, in, out, PixFcR10k);
+	printf("unknown rgb destination format\n");
+}
+
+
+
+/*
+ *
+ * 		any R G B
+ *
+ * 		T O
+ *
+ * 		any R G B
+ *
+ */
+// This conversion assumes an even number of pixels
+static FORCE_INLINE void convert_rgb_to_any_rgb_nonsse_fmt(const struct PixFcSSE* pixfc, void* in, void* out, const PixFcPixelFormat src_fmt, const PixFcPixelFormat dst_fmt) {
+	uint32_t 			pixel = 0;
+	uint32_t			line = 0;
+	uint8_t*			src = (uint8_t *) in;
+	uint8_t*			dst = (uint8_t *) out;
+	uint32_t			src_row_byte_count = pixfc->source_row_bytes;
+	uint32_t			dst_row_byte_count = pixfc->dest_row_bytes;
+	int32_t				r1 = 0, g1 = 0, b1 = 0, r2 = 0, g2 = 0, b2 = 0;
+	uint8_t				a1 = pixfc->alpha, a2 = pixfc->alpha;
+	while(line++ < pixfc->height){
+		while(pixel < pixfc->width) {
+			// Keep the alpha values of 32-bit source pixels
+			if (src_fmt == PixFcARGB) {
+				a1 = src[0];
+				a2 = src[4];
+			} else if (src_fmt == PixFcBGRA) {
+				a1 = src[3];
+				a2 = src[7];
+			}
+			UNPACK_RGB(src, r1, g1, b1, r2, g2, b2, src_fmt);
+			PACK_RGB(a1, r1, g1, b1, dst, dst_fmt);
+			PACK_RGB(a2, r2, g2, b2, dst, dst_fmt);
+			pixel += 2;
+		}
+		src = (uint8_t*)in + line * src_row_byte_count;
+		dst = (uint8_t*)out + line * dst_row_byte_count;
+		pixel = 0;
+	}
+}
+
+void		convert_rgb_to_any_rgb_nonsse(const struct PixFcSSE* pixfc, void* in, void* out) {
+	CALL_FOR_8BIT_RGB_SRC_FORMATS(convert_rgb_to_any_rgb_nonsse_fmt, pixfc, in, out, PixFcARGB);
+	CALL_FOR_8BIT_RGB_SRC_FORMATS(convert_rgb_to_any_rgb_nonsse_fmt, pixfc, in, out, PixFcBGRA);
+	CALL_FOR_8BIT_RGB_SRC_FORMATS(convert_rgb_to_any_rgb_nonsse_fmt, pixfc, in, out, PixFcRGB24);
+	CALL_FOR_8BIT_RGB_SRC_FORMATS(convert_rgb_to_any_rgb_nonsse_fmt, pixfc, in, out, PixFcBGR24);
+	printf("unknown rgb destination format\n");
+}
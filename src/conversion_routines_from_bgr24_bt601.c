@@ -22,16 +22,6 @@
 #include "pixfc-sse.h"
 #include "rgb_conversion_recipes.h"
 
-#define CONVERT_TO_YUV422I(pack_fn, instr_set)\
-			DO_CONVERSION_1U_1P(\
-						RGB24_TO_YUV422I_RECIPE,\
-						unpack_bgr24_to_r_g_b_vectors_,\
-						pack_fn,\
-						convert_r_g_b_vectors_to_y_vector_bt601_sse2,\
-						convert_downsampled_422_r_g_b_vectors_to_uv_vector_bt601_sse2,\
-						instr_set\
-			)
-
 #define CONVERT2_TO_YUV422I(pack_fn, instr_set)\
 			DO_CONVERSION_1U_1P(\
 						RGB24_TO_YUV422I_RECIPE2,\
@@ -42,16 +32,6 @@
 						instr_set\
 			)
 
-#define DOWNSAMPLE_N_CONVERT_TO_YUV422I(pack_fn, instr_set)\
-			DO_CONVERSION_1U_1P(\
-						AVG_DOWNSAMPLE_RGB24_TO_YUV422I_RECIPE,\
-						unpack_bgr24_to_r_g_b_vectors_,\
-						pack_fn,\
-						convert_r_g_b_vectors_to_y_vector_bt601_sse2,\
-						convert_downsampled_422_r_g_b_vectors_to_uv_vector_bt601_sse2,\
-						instr_set\
-			)
-
 #define DOWNSAMPLE_N_CONVERT2_TO_YUV422I(pack_fn, instr_set)\
 			DO_CONVERSION_1U_1P(\
 						AVG_DOWNSAMPLE_RGB24_TO_YUV422I_RECIPE2,\
@@ -62,20 +42,20 @@
 						instr_set\
 			)
 
-#define CONVERT_TO_YUV422P(instr_set)\
+#define CONVERT2_TO_YUV422P(instr_set)\
 			DO_CONVERSION_1U_2P(\
-						RGB24_TO_YUV422P_RECIPE,\
-						unpack_bgr24_to_r_g_b_vectors_,\
+						RGB24_TO_YUV422P_RECIPE2,\
+						unpack_bgr24_to_ga_br_vectors_,\
 						pack_4_y_uv_422_vectors_to_yuvp_lo_vectors_sse2,\
 						pack_4_y_uv_422_vectors_to_yuvp_hi_vectors_sse2,\
-						convert_r_g_b_vectors_to_y_vector_bt601_sse2,\
-						convert_downsampled_422_r_g_b_vectors_to_uv_vector_bt601_sse2,\
+						convert_ga_br_vectors_to_y_vector_bt601_sse2,\
+						convert_downsampled_422_ga_br_vectors_to_uv_vector_bt601_sse2,\
 						instr_set\
 			)
 
-#define CONVERT2_TO_YUV422P(instr_set)\
+#define DOWNSAMPLE_N_CONVERT2_TO_YUV422P(instr_set)\
 			DO_CONVERSION_1U_2P(\
-						RGB24_TO_YUV422P_RECIPE2,\
+						AVG_DOWNSAMPLE_RGB24_TO_YUV422P_RECIPE2,\
 						unpack_bgr24_to_ga_br_vectors_,\
 						pack_4_y_uv_422_vectors_to_yuvp_lo_vectors_sse2,\
 						pack_4_y_uv_422_vectors_to_yuvp_hi_vectors_sse2,\
@@ -84,82 +64,51 @@
 						instr_set\
 			)
 
-#define DOWNSAMPLE_N_CONVERT_TO_YUV422P(instr_set)\
+#define DOWNSAMPLE_N_CONVERT_TO_YUV420P(instr_set)\
 			DO_CONVERSION_1U_2P(\
-						AVG_DOWNSAMPLE_RGB24_TO_YUV422P_RECIPE,\
+						AVG_DOWNSAMPLE_RGB24_TO_YUV420P_RECIPE,\
 						unpack_bgr24_to_r_g_b_vectors_,\
-						pack_4_y_uv_422_vectors_to_yuvp_lo_vectors_sse2,\
-						pack_4_y_uv_422_vectors_to_yuvp_hi_vectors_sse2,\
+						pack_2_y_vectors_to_1_y_vector_sse2,\
+						pack_4_uv_vectors_to_yup_vectors_sse2,\
 						convert_r_g_b_vectors_to_y_vector_bt601_sse2,\
 						convert_downsampled_422_r_g_b_vectors_to_uv_vector_bt601_sse2,\
 						instr_set\
 			)
 
-#define DOWNSAMPLE_N_CONVERT2_TO_YUV422P(instr_set)\
+#define CONVERT2_TO_YUV420P(instr_set)\
 			DO_CONVERSION_1U_2P(\
-						AVG_DOWNSAMPLE_RGB24_TO_YUV422P_RECIPE2,\
+						RGB24_TO_YUV420P_RECIPE2,\
 						unpack_bgr24_to_ga_br_vectors_,\
-						pack_4_y_uv_422_vectors_to_yuvp_lo_vectors_sse2,\
-						pack_4_y_uv_422_vectors_to_yuvp_hi_vectors_sse2,\
+						pack_2_y_vectors_to_1_y_vector_sse2,\
+						pack_4_uv_vectors_to_yup_vectors_sse2,\
 						convert_ga_br_vectors_to_y_vector_bt601_sse2,\
 						convert_downsampled_422_ga_br_vectors_to_uv_vector_bt601_sse2,\
 						instr_set\
 			)
 
-#define CONVERT_TO_YUV420P(instr_set)\
+#define DOWNSAMPLE_N_CONVERT_TO_NV12(uv_pack_fn, instr_set)\
 			DO_CONVERSION_1U_2P(\
-						RGB24_TO_YUV420P_RECIPE,\
+						AVG_DOWNSAMPLE_RGB24_TO_NV12_RECIPE,\
 						unpack_bgr24_to_r_g_b_vectors_,\
 						pack_2_y_vectors_to_1_y_vector_sse2,\
-						pack_4_uv_vectors_to_yup_vectors_sse2,\
+						uv_pack_fn,\
 						convert_r_g_b_vectors_to_y_vector_bt601_sse2,\
 						convert_downsampled_422_r_g_b_vectors_to_uv_vector_bt601_sse2,\
 						instr_set\
 			)
 
-#define CONVERT2_TO_YUV420P(instr_set)\
+#define CONVERT2_TO_NV12(uv_pack_fn, instr_set)\
 			DO_CONVERSION_1U_2P(\
-						RGB24_TO_YUV420P_RECIPE2,\
+						RGB24_TO_NV12_RECIPE2,\
 						unpack_bgr24_to_ga_br_vectors_,\
 						pack_2_y_vectors_to_1_y_vector_sse2,\
-						pack_4_uv_vectors_to_yup_vectors_sse2,\
+						uv_pack_fn,\
 						convert_ga_br_vectors_to_y_vector_bt601_sse2,\
 						convert_downsampled_422_ga_br_vectors_to_uv_vector_bt601_sse2,\
 						instr_set\
 			)
 
 
-#define CONVERT_TO_V210(instr_set)\
-		DO_CONVERSION_1U_1P(\
-				RGB24_TO_V210_RECIPE,\
-				unpack_bgr24_to_r_g_b_vectors_sse2_ssse3,\
-				pack_6_y_uv_vectors_to_4_v210_vectors_ ## instr_set,\
-				convert_8bit_r_g_b_vectors_to_10bit_y_vector_bt601_sse2,\
-				convert_downsampled_422_8bit_r_g_b_vectors_to_10bit_uv_vector_bt601_sse2,\
-				instr_set\
-		)
-
-#define DOWNSAMPLE_N_CONVERT_TO_V210(instr_set)\
-		DO_CONVERSION_1U_1P(\
-				AVG_DOWNSAMPLE_RGB24_TO_V210_RECIPE,\
-				unpack_bgr24_to_r_g_b_vectors_sse2_ssse3,\
-				pack_6_y_uv_vectors_to_4_v210_vectors_ ## instr_set,\
-				convert_8bit_r_g_b_vectors_to_10bit_y_vector_bt601_sse2,\
-				convert_downsampled_422_8bit_r_g_b_vectors_to_10bit_uv_vector_bt601_sse2,\
-				instr_set\
-		)
-
-
-// BGR24 to YUYV			SSE2 SSSE3
-void		convert_bgr24_to_yuyv_bt601_sse2_ssse3(const struct PixFcSSE *pixfc, void* source_buffer, void* dest_buffer) {
-	CONVERT_TO_YUV422I(pack_4_y_uv_422_vectors_in_2_yuyv_vectors_sse2, sse2_ssse3);
-}
-
-void		downsample_n_convert_bgr24_to_yuyv_bt601_sse2_ssse3(const struct PixFcSSE *pixfc, void* source_buffer, void* dest_buffer) {
-	DOWNSAMPLE_N_CONVERT_TO_YUV422I(pack_4_y_uv_422_vectors_in_2_yuyv_vectors_sse2, sse2_ssse3);
-}
-
-
 // BGR24 to YUYV			SSE2
 void		convert_bgr24_to_yuyv_bt601_sse2(const struct PixFcSSE *pixfc, void* source_buffer, void* dest_buffer) {
 	CONVERT2_TO_YUV422I(pack_4_y_uv_422_vectors_in_2_yuyv_vectors_sse2, sse2);
@@ -171,17 +120,6 @@ void		downsample_n_convert_bgr24_to_yuyv_bt601_sse2(const struct PixFcSSE *pixfc
 
 
 
-
-// BGR24 to UYVV			SSE2 SSSE3
-void		convert_bgr24_to_uyvy_bt601_sse2_ssse3(const struct PixFcSSE *pixfc, void* source_buffer, void* dest_buffer) {
-	CONVERT_TO_YUV422I(pack_4_y_uv_422_vectors_in_2_uyvy_vectors_sse2, sse2_ssse3);
-}
-
-void		downsample_n_convert_bgr24_to_uyvy_bt601_sse2_ssse3(const struct PixFcSSE *pixfc, void* source_buffer, void* dest_buffer) {
-	DOWNSAMPLE_N_CONVERT_TO_YUV422I(pack_4_y_uv_422_vectors_in_2_uyvy_vectors_sse2, sse2_ssse3);
-}
-
-
 // BGR24 to UYVY			SSE2
 void		convert_bgr24_to_uyvy_bt601_sse2(const struct PixFcSSE *pixfc, void* source_buffer, void* dest_buffer) {
 	CONVERT2_TO_YUV422I(pack_4_y_uv_422_vectors_in_2_uyvy_vectors_sse2, sse2);
@@ -193,18 +131,6 @@ void		downsample_n_convert_bgr24_to_uyvy_bt601_sse2(const struct PixFcSSE *pixfc
 
 
 
-
-
-// BGR24 to YUV422P			SSE2 SSSE3
-void		convert_bgr24_to_yuv422p_bt601_sse2_ssse3(const struct PixFcSSE *pixfc, void* source_buffer, void* dest_buffer) {
-	CONVERT_TO_YUV422P(sse2_ssse3);
-}
-
-void		downsample_n_convert_bgr24_to_yuv422p_bt601_sse2_ssse3(const struct PixFcSSE *pixfc, void* source_buffer, void* dest_buffer) {
-	DOWNSAMPLE_N_CONVERT_TO_YUV422P(sse2_ssse3);
-}
-
-
 // BGR24 to YUV422P			SSE2
 void		convert_bgr24_to_yuv422p_bt601_sse2(const struct PixFcSSE *pixfc, void* source_buffer, void* dest_buffer) {
 	CONVERT2_TO_YUV422P(sse2);
@@ -216,34 +142,29 @@ void		downsample_n_convert_bgr24_to_yuv422p_bt601_sse2(const struct PixFcSSE *pi
 
 
 
-// BGR24 to YUV420P			SSE2 SSSE3
-void		convert_bgr24_to_yuv420p_bt601_sse2_ssse3(const struct PixFcSSE *pixfc, void* source_buffer, void* dest_buffer) {
-	CONVERT_TO_YUV420P(sse2_ssse3);
-}
-
 // BGR24 to YUV420P			SSE2
 void		convert_bgr24_to_yuv420p_bt601_sse2(const struct PixFcSSE *pixfc, void* source_buffer, void* dest_buffer) {
 	CONVERT2_TO_YUV420P(sse2);
 }
 
-
-
-
-// BGR24 to V210			SSE2 SSSE3 SSE41
-void		convert_bgr24_to_v210_bt601_sse2_ssse3_sse41(const struct PixFcSSE *pixfc, void* source_buffer, void* dest_buffer) {
-	CONVERT_TO_V210(sse2_ssse3_sse41);
+void		downsample_n_convert_bgr24_to_yuv420p_bt601_sse2(const struct PixFcSSE *pixfc, void* source_buffer, void* dest_buffer) {
+	DOWNSAMPLE_N_CONVERT_TO_YUV420P(sse2);
 }
 
-void		downsample_n_convert_bgr24_to_v210_bt601_sse2_ssse3_sse41(const struct PixFcSSE *pixfc, void* source_buffer, void* dest_buffer) {
-	DOWNSAMPLE_N_CONVERT_TO_V210(sse2_ssse3_sse41);
+// BGR24 to NV12			SSE2
+void		convert_bgr24_to_nv12_bt601_sse2(const struct PixFcSSE *pixfc, void* source_buffer, void* dest_buffer) {
+	CONVERT2_TO_NV12(pack_4_uv_vectors_to_nv12_vectors_sse2, sse2);
 }
 
+void		downsample_n_convert_bgr24_to_nv12_bt601_sse2(const struct PixFcSSE *pixfc, void* source_buffer, void* dest_buffer) {
+	DOWNSAMPLE_N_CONVERT_TO_NV12(pack_4_uv_vectors_to_nv12_vectors_sse2, sse2);
+}
 
-// BGR24 to V210			SSE2 SSSE3
-void		convert_bgr24_to_v210_bt601_sse2_ssse3(const struct PixFcSSE *pixfc, void* source_buffer, void* dest_buffer) {
-	CONVERT_TO_V210(sse2_ssse3);
+// BGR24 to NV21			SSE2
+void		convert_bgr24_to_nv21_bt601_sse2(const struct PixFcSSE *pixfc, void* source_buffer, void* dest_buffer) {
+	CONVERT2_TO_NV12(pack_4_uv_vectors_to_nv21_vectors_sse2, sse2);
 }
 
-void		downsample_n_convert_bgr24_to_v210_bt601_sse2_ssse3(const struct PixFcSSE *pixfc, void* source_buffer, void* dest_buffer) {
-	DOWNSAMPLE_N_CONVERT_TO_V210(sse2_ssse3);
+void		downsample_n_convert_bgr24_to_nv21_bt601_sse2(const struct PixFcSSE *pixfc, void* source_buffer, void* dest_buffer) {
+	DOWNSAMPLE_N_CONVERT_TO_NV12(pack_4_uv_vectors_to_nv21_vectors_sse2, sse2);
 }
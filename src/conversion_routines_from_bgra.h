@@ -61,8 +61,22 @@ void		downsample_n_convert_bgra_to_yuv422p_sse2(const struct PixFcSSE *, void*,
 
 // BGRA to YUV420P			SSE2 SSSE3
 void		convert_bgra_to_yuv420p_sse2_ssse3(const struct PixFcSSE *, void*, void*);
+void		downsample_n_convert_bgra_to_yuv420p_sse2_ssse3(const struct PixFcSSE *, void*, void*);
 // BGRA to YUV420P			SSE2
 void		convert_bgra_to_yuv420p_sse2(const struct PixFcSSE *, void*, void*);
+void		downsample_n_convert_bgra_to_yuv420p_sse2(const struct PixFcSSE *, void*, void*);
+// BGRA to NV12			SSE2 SSSE3
+void		convert_bgra_to_nv12_sse2_ssse3(const struct PixFcSSE *, void*, void*);
+void		downsample_n_convert_bgra_to_nv12_sse2_ssse3(const struct PixFcSSE *, void*, void*);
+// BGRA to NV12			SSE2
+void		convert_bgra_to_nv12_sse2(const struct PixFcSSE *, void*, void*);
+void		downsample_n_convert_bgra_to_nv12_sse2(const struct PixFcSSE *, void*, void*);
+// BGRA to NV21			SSE2 SSSE3
+void		convert_bgra_to_nv21_sse2_ssse3(const struct PixFcSSE *, void*, void*);
+void		downsample_n_convert_bgra_to_nv21_sse2_ssse3(const struct PixFcSSE *, void*, void*);
+// BGRA to NV21			SSE2
+void		convert_bgra_to_nv21_sse2(const struct PixFcSSE *, void*, void*);
+void		downsample_n_convert_bgra_to_nv21_sse2(const struct PixFcSSE *, void*, void*);
 
 
 // BGRA to V210			SSE2 SSSE3 SSE41
@@ -116,8 +130,22 @@ void		downsample_n_convert_bgra_to_yuv422p_bt601_sse2(const struct PixFcSSE *, v
 
 // BGRA to YUV420P			SSE2 SSSE3
 void		convert_bgra_to_yuv420p_bt601_sse2_ssse3(const struct PixFcSSE *, void*, void*);
+void		downsample_n_convert_bgra_to_yuv420p_bt601_sse2_ssse3(const struct PixFcSSE *, void*, void*);
 // BGRA to YUV420P			SSE2
 void		convert_bgra_to_yuv420p_bt601_sse2(const struct PixFcSSE *, void*, void*);
+void		downsample_n_convert_bgra_to_yuv420p_bt601_sse2(const struct PixFcSSE *, void*, void*);
+// BGRA to NV12			SSE2 SSSE3
+void		convert_bgra_to_nv12_bt601_sse2_ssse3(const struct PixFcSSE *, void*, void*);
+void		downsample_n_convert_bgra_to_nv12_bt601_sse2_ssse3(const struct PixFcSSE *, void*, void*);
+// BGRA to NV12			SSE2
+void		convert_bgra_to_nv12_bt601_sse2(const struct PixFcSSE *, void*, void*);
+void		downsample_n_convert_bgra_to_nv12_bt601_sse2(const struct PixFcSSE *, void*, void*);
+// BGRA to NV21			SSE2 SSSE3
+void		convert_bgra_to_nv21_bt601_sse2_ssse3(const struct PixFcSSE *, void*, void*);
+void		downsample_n_convert_bgra_to_nv21_bt601_sse2_ssse3(const struct PixFcSSE *, void*, void*);
+// BGRA to NV21			SSE2
+void		convert_bgra_to_nv21_bt601_sse2(const struct PixFcSSE *, void*, void*);
+void		downsample_n_convert_bgra_to_nv21_bt601_sse2(const struct PixFcSSE *, void*, void*);
 
 
 // BGRA to V210		SSE2 SSSE3 SSE41
@@ -173,8 +201,22 @@ void		downsample_n_convert_bgra_to_yuv422p_bt709_sse2(const struct PixFcSSE *, v
 
 // BGRA to YUV420P			SSE2 SSSE3
 void		convert_bgra_to_yuv420p_bt709_sse2_ssse3(const struct PixFcSSE *, void*, void*);
+void		downsample_n_convert_bgra_to_yuv420p_bt709_sse2_ssse3(const struct PixFcSSE *, void*, void*);
 // BGRA to YUV420P			SSE2
 void		convert_bgra_to_yuv420p_bt709_sse2(const struct PixFcSSE *, void*, void*);
+void		downsample_n_convert_bgra_to_yuv420p_bt709_sse2(const struct PixFcSSE *, void*, void*);
+// BGRA to NV12			SSE2 SSSE3
+void		convert_bgra_to_nv12_bt709_sse2_ssse3(const struct PixFcSSE *, void*, void*);
+void		downsample_n_convert_bgra_to_nv12_bt709_sse2_ssse3(const struct PixFcSSE *, void*, void*);
+// BGRA to NV12			SSE2
+void		convert_bgra_to_nv12_bt709_sse2(const struct PixFcSSE *, void*, void*);
+void		downsample_n_convert_bgra_to_nv12_bt709_sse2(const struct PixFcSSE *, void*, void*);
+// BGRA to NV21			SSE2 SSSE3
+void		convert_bgra_to_nv21_bt709_sse2_ssse3(const struct PixFcSSE *, void*, void*);
+void		downsample_n_convert_bgra_to_nv21_bt709_sse2_ssse3(const struct PixFcSSE *, void*, void*);
+// BGRA to NV21			SSE2
+void		convert_bgra_to_nv21_bt709_sse2(const struct PixFcSSE *, void*, void*);
+void		downsample_n_convert_bgra_to_nv21_bt709_sse2(const struct PixFcSSE *, void*, void*);
 
 
 // BGRA to V210			SSE2 SSSE3 SSE41
@@ -206,5 +248,123 @@ void 		convert_rgb_to_yuv422_bt709_nonsse(const struct PixFcSSE* conv, void* in,
 void		convert_bgra_to_r210_sse2_ssse3(const struct PixFcSSE *, void *, void *);
 void		convert_rgb_to_10bit_rgb_nonsse(const struct PixFcSSE *, void *, void *);
 
+/*
+ *
+ * 		B G R A
+ *
+ * 		T O
+ *
+ * 		8 B I T    R G B
+ *
+ */
+// BGRA to ARGB
+void		convert_bgra_to_argb_sse2_ssse3(const struct PixFcSSE *, void *, void *);
+void		convert_bgra_to_argb_sse2(const struct PixFcSSE *, void *, void *);
+// BGRA to RGB24
+void		convert_bgra_to_rgb24_sse2_ssse3(const struct PixFcSSE *, void *, void *);
+void		convert_bgra_to_rgb24_sse2(const struct PixFcSSE *, void *, void *);
+// BGRA to BGR24
+void		convert_bgra_to_bgr24_sse2_ssse3(const struct PixFcSSE *, void *, void *);
+void		convert_bgra_to_bgr24_sse2(const struct PixFcSSE *, void *, void *);
+void		convert_rgb_to_any_rgb_nonsse(const struct PixFcSSE *, void *, void *);
+
+/*
+ *
+ *
+ *	A V X 2
+ *
+ *  C O N V E R S I O N S
+ *
+ *
+ */
+// BGRA to YUYV		AVX2
+void		downsample_n_convert_bgra_to_yuyv_avx2(const struct PixFcSSE *, void *, void *);
+void		convert_bgra_to_yuyv_avx2(const struct PixFcSSE *, void *, void *);
+void		downsample_n_convert_bgra_to_yuyv_bt601_avx2(const struct PixFcSSE *, void *, void *);
+void		convert_bgra_to_yuyv_bt601_avx2(const struct PixFcSSE *, void *, void *);
+void		downsample_n_convert_bgra_to_yuyv_bt709_avx2(const struct PixFcSSE *, void *, void *);
+void		convert_bgra_to_yuyv_bt709_avx2(const struct PixFcSSE *, void *, void *);
+
+// BGRA to UYVY		AVX2
+void		downsample_n_convert_bgra_to_uyvy_avx2(const struct PixFcSSE *, void *, void *);
+void		convert_bgra_to_uyvy_avx2(const struct PixFcSSE *, void *, void *);
+void		downsample_n_convert_bgra_to_uyvy_bt601_avx2(const struct PixFcSSE *, void *, void *);
+void		convert_bgra_to_uyvy_bt601_avx2(const struct PixFcSSE *, void *, void *);
+void		downsample_n_convert_bgra_to_uyvy_bt709_avx2(const struct PixFcSSE *, void *, void *);
+void		convert_bgra_to_uyvy_bt709_avx2(const struct PixFcSSE *, void *, void *);
+
+// BGRA to YUV422P		AVX2
+void		downsample_n_convert_bgra_to_yuv422p_avx2(const struct PixFcSSE *, void *, void *);
+void		convert_bgra_to_yuv422p_avx2(const struct PixFcSSE *, void *, void *);
+void		downsample_n_convert_bgra_to_yuv422p_bt601_avx2(const struct PixFcSSE *, void *, void *);
+void		convert_bgra_to_yuv422p_bt601_avx2(const struct PixFcSSE *, void *, void *);
+void		downsample_n_convert_bgra_to_yuv422p_bt709_avx2(const struct PixFcSSE *, void *, void *);
+void		convert_bgra_to_yuv422p_bt709_avx2(const struct PixFcSSE *, void *, void *);
+
+// BGRA to v210		AVX2
+void		downsample_n_convert_bgra_to_v210_avx2(const struct PixFcSSE *, void *, void *);
+void		convert_bgra_to_v210_avx2(const struct PixFcSSE *, void *, void *);
+void		downsample_n_convert_bgra_to_v210_bt601_avx2(const struct PixFcSSE *, void *, void *);
+void		convert_bgra_to_v210_bt601_avx2(const struct PixFcSSE *, void *, void *);
+void		downsample_n_convert_bgra_to_v210_bt709_avx2(const struct PixFcSSE *, void *, void *);
+void		convert_bgra_to_v210_bt709_avx2(const struct PixFcSSE *, void *, void *);
+
+// BGRA to ARGB		AVX2
+void		convert_bgra_to_argb_avx2(const struct PixFcSSE *, void *, void *);
+
+// BGRA to RGB24		AVX2
+void		convert_bgra_to_rgb24_avx2(const struct PixFcSSE *, void *, void *);
+
+// BGRA to BGR24		AVX2
+void		convert_bgra_to_bgr24_avx2(const struct PixFcSSE *, void *, void *);
+
+// BGRA to YUYV		NEON
+void		downsample_n_convert_bgra_to_yuyv_neon(const struct PixFcSSE *, void *, void *);
+void		convert_bgra_to_yuyv_neon(const struct PixFcSSE *, void *, void *);
+void		downsample_n_convert_bgra_to_yuyv_bt601_neon(const struct PixFcSSE *, void *, void *);
+void		convert_bgra_to_yuyv_bt601_neon(const struct PixFcSSE *, void *, void *);
+void		downsample_n_convert_bgra_to_yuyv_bt709_neon(const struct PixFcSSE *, void *, void *);
+void		convert_bgra_to_yuyv_bt709_neon(const struct PixFcSSE *, void *, void *);
+
+// BGRA to UYVY		NEON
+void		downsample_n_convert_bgra_to_uyvy_neon(const struct PixFcSSE *, void *, void *);
+void		convert_bgra_to_uyvy_neon(const struct PixFcSSE *, void *, void *);
+void		downsample_n_convert_bgra_to_uyvy_bt601_neon(const struct PixFcSSE *, void *, void *);
+void		convert_bgra_to_uyvy_bt601_neon(const struct PixFcSSE *, void *, void *);
+void		downsample_n_convert_bgra_to_uyvy_bt709_neon(const struct PixFcSSE *, void *, void *);
+void		convert_bgra_to_uyvy_bt709_neon(const struct PixFcSSE *, void *, void *);
+
+// BGRA to YUV422P		NEON
+void		downsample_n_convert_bgra_to_yuv422p_neon(const struct PixFcSSE *, void *, void *);
+void		convert_bgra_to_yuv422p_neon(const struct PixFcSSE *, void *, void *);
+void		downsample_n_convert_bgra_to_yuv422p_bt601_neon(const struct PixFcSSE *, void *, void *);
+void		convert_bgra_to_yuv422p_bt601_neon(const struct PixFcSSE *, void *, void *);
+void		downsample_n_convert_bgra_to_yuv422p_bt709_neon(const struct PixFcSSE *, void *, void *);
+void		convert_bgra_to_yuv422p_bt709_neon(const struct PixFcSSE *, void *, void *);
+
+// BGRA to YUV420P		NEON
+void		downsample_n_convert_bgra_to_yuv420p_neon(const struct PixFcSSE *, void *, void *);
+void		convert_bgra_to_yuv420p_neon(const struct PixFcSSE *, void *, void *);
+void		downsample_n_convert_bgra_to_yuv420p_bt601_neon(const struct PixFcSSE *, void *, void *);
+void		convert_bgra_to_yuv420p_bt601_neon(const struct PixFcSSE *, void *, void *);
+void		downsample_n_convert_bgra_to_yuv420p_bt709_neon(const struct PixFcSSE *, void *, void *);
+void		convert_bgra_to_yuv420p_bt709_neon(const struct PixFcSSE *, void *, void *);
+
+// BGRA to NV12		NEON
+void		downsample_n_convert_bgra_to_nv12_neon(const struct PixFcSSE *, void *, void *);
+void		convert_bgra_to_nv12_neon(const struct PixFcSSE *, void *, void *);
+void		downsample_n_convert_bgra_to_nv12_bt601_neon(const struct PixFcSSE *, void *, void *);
+void		convert_bgra_to_nv12_bt601_neon(const struct PixFcSSE *, void *, void *);
+void		downsample_n_convert_bgra_to_nv12_bt709_neon(const struct PixFcSSE *, void *, void *);
+void		convert_bgra_to_nv12_bt709_neon(const struct PixFcSSE *, void *, void *);
+
+// BGRA to NV21		NEON
+void		downsample_n_convert_bgra_to_nv21_neon(const struct PixFcSSE *, void *, void *);
+void		convert_bgra_to_nv21_neon(const struct PixFcSSE *, void *, void *);
+void		downsample_n_convert_bgra_to_nv21_bt601_neon(const struct PixFcSSE *, void *, void *);
+void		convert_bgra_to_nv21_bt601_neon(const struct PixFcSSE *, void *, void *);
+void		downsample_n_convert_bgra_to_nv21_bt709_neon(const struct PixFcSSE *, void *, void *);
+void		convert_bgra_to_nv21_bt709_neon(const struct PixFcSSE *, void *, void *);
+
 
 #endif /* CONVERSION_ROUTINES_FROM_BGRA_H_ */
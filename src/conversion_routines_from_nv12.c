@@ -0,0 +1,438 @@
+/*
+ * conversion_routines_from_nv12.c
+ *
+ * Copyright (C) 2011 PixFC Team (pixelfc@gmail.com)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public  License as published by the
+ * Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <string.h>
+
+#include "common.h"
+#include "pixfc-sse.h"
+#include "yuv_conversion_recipes.h"
+
+#define CONVERT_TO_RGB32(convert_fn_prefix, unpack_uv_fn, pack_fn, instr_set)\
+		DO_CONVERSION_2U_1P(\
+				NV12_TO_RGB_RECIPE,\
+				unpack_yuv42Xp_to_2_y_vectors_sse2,\
+				unpack_uv_fn,\
+				pack_fn,\
+				convert_fn_prefix,\
+				4,\
+				instr_set\
+		)
+
+#define CONVERT_TO_RGB24(convert_fn_prefix, unpack_uv_fn, pack_fn, instr_set)\
+		DO_CONVERSION_2U_1P(\
+				NV12_TO_RGB_RECIPE,\
+				unpack_yuv42Xp_to_2_y_vectors_sse2,\
+				unpack_uv_fn,\
+				pack_fn,\
+				convert_fn_prefix,\
+				3,\
+				instr_set\
+		)
+
+
+/*
+ *
+ * 		N V 1 2
+ *
+ * 		to
+ *
+ * 		A R G B
+ */
+void		convert_nv12_to_argb_sse2(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
+	CONVERT_TO_RGB32(nnb_upsample_n_convert_y_uv_vectors_to_rgb_vectors_, unpack_nv12_uv_to_2_uv_vectors_sse2, pack_6_rgb_vectors_in_4_argb_vectors_sse2, sse2);
+}
+
+
+void		convert_nv12_to_argb_bt601_sse2(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
+	CONVERT_TO_RGB32(nnb_upsample_n_convert_y_uv_vectors_to_rgb_vectors_bt601_, unpack_nv12_uv_to_2_uv_vectors_sse2, pack_6_rgb_vectors_in_4_argb_vectors_sse2, sse2);
+}
+
+
+void		convert_nv12_to_argb_bt709_sse2(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
+	CONVERT_TO_RGB32(nnb_upsample_n_convert_y_uv_vectors_to_rgb_vectors_bt709_, unpack_nv12_uv_to_2_uv_vectors_sse2, pack_6_rgb_vectors_in_4_argb_vectors_sse2, sse2);
+}
+
+
+
+/*
+ *
+ * 		N V 1 2
+ *
+ * 		to
+ *
+ * 		B G R A
+ */
+void		convert_nv12_to_bgra_sse2(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
+	CONVERT_TO_RGB32(nnb_upsample_n_convert_y_uv_vectors_to_rgb_vectors_, unpack_nv12_uv_to_2_uv_vectors_sse2, pack_6_rgb_vectors_in_4_bgra_vectors_sse2, sse2);
+}
+
+
+void		convert_nv12_to_bgra_bt601_sse2(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
+	CONVERT_TO_RGB32(nnb_upsample_n_convert_y_uv_vectors_to_rgb_vectors_bt601_, unpack_nv12_uv_to_2_uv_vectors_sse2, pack_6_rgb_vectors_in_4_bgra_vectors_sse2, sse2);
+}
+
+
+void		convert_nv12_to_bgra_bt709_sse2(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
+	CONVERT_TO_RGB32(nnb_upsample_n_convert_y_uv_vectors_to_rgb_vectors_bt709_, unpack_nv12_uv_to_2_uv_vectors_sse2, pack_6_rgb_vectors_in_4_bgra_vectors_sse2, sse2);
+}
+
+
+
+/*
+ *
+ * 		N V 1 2
+ *
+ * 		to
+ *
+ * 		R G B   2 4
+ */
+void		convert_nv12_to_rgb24_sse2(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
+	CONVERT_TO_RGB24(nnb_upsample_n_convert_y_uv_vectors_to_rgb_vectors_, unpack_nv12_uv_to_2_uv_vectors_sse2, pack_6_rgb_vectors_to_3_rgb24_vectors_sse2_slowpacking, sse2);
+}
+
+
+void		convert_nv12_to_rgb24_bt601_sse2(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
+	CONVERT_TO_RGB24(nnb_upsample_n_convert_y_uv_vectors_to_rgb_vectors_bt601_, unpack_nv12_uv_to_2_uv_vectors_sse2, pack_6_rgb_vectors_to_3_rgb24_vectors_sse2_slowpacking, sse2);
+}
+
+
+void		convert_nv12_to_rgb24_bt709_sse2(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
+	CONVERT_TO_RGB24(nnb_upsample_n_convert_y_uv_vectors_to_rgb_vectors_bt709_, unpack_nv12_uv_to_2_uv_vectors_sse2, pack_6_rgb_vectors_to_3_rgb24_vectors_sse2_slowpacking, sse2);
+}
+
+
+
+/*
+ *
+ * 		N V 1 2
+ *
+ * 		to
+ *
+ * 		B G R   2 4
+ */
+void		convert_nv12_to_bgr24_sse2(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
+	CONVERT_TO_RGB24(nnb_upsample_n_convert_y_uv_vectors_to_rgb_vectors_, unpack_nv12_uv_to_2_uv_vectors_sse2, pack_6_rgb_vectors_to_3_bgr24_vectors_sse2_slowpacking, sse2);
+}
+
+
+void		convert_nv12_to_bgr24_bt601_sse2(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
+	CONVERT_TO_RGB24(nnb_upsample_n_convert_y_uv_vectors_to_rgb_vectors_bt601_, unpack_nv12_uv_to_2_uv_vectors_sse2, pack_6_rgb_vectors_to_3_bgr24_vectors_sse2_slowpacking, sse2);
+}
+
+
+void		convert_nv12_to_bgr24_bt709_sse2(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
+	CONVERT_TO_RGB24(nnb_upsample_n_convert_y_uv_vectors_to_rgb_vectors_bt709_, unpack_nv12_uv_to_2_uv_vectors_sse2, pack_6_rgb_vectors_to_3_bgr24_vectors_sse2_slowpacking, sse2);
+}
+
+
+
+/*
+ *
+ * 		N V 2 1
+ *
+ * 		to
+ *
+ * 		A R G B
+ */
+void		convert_nv21_to_argb_sse2(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
+	CONVERT_TO_RGB32(nnb_upsample_n_convert_y_uv_vectors_to_rgb_vectors_, unpack_nv21_vu_to_2_uv_vectors_sse2, pack_6_rgb_vectors_in_4_argb_vectors_sse2, sse2);
+}
+
+
+void		convert_nv21_to_argb_bt601_sse2(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
+	CONVERT_TO_RGB32(nnb_upsample_n_convert_y_uv_vectors_to_rgb_vectors_bt601_, unpack_nv21_vu_to_2_uv_vectors_sse2, pack_6_rgb_vectors_in_4_argb_vectors_sse2, sse2);
+}
+
+
+void		convert_nv21_to_argb_bt709_sse2(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
+	CONVERT_TO_RGB32(nnb_upsample_n_convert_y_uv_vectors_to_rgb_vectors_bt709_, unpack_nv21_vu_to_2_uv_vectors_sse2, pack_6_rgb_vectors_in_4_argb_vectors_sse2, sse2);
+}
+
+
+
+/*
+ *
+ * 		N V 2 1
+ *
+ * 		to
+ *
+ * 		B G R A
+ */
+void		convert_nv21_to_bgra_sse2(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
+	CONVERT_TO_RGB32(nnb_upsample_n_convert_y_uv_vectors_to_rgb_vectors_, unpack_nv21_vu_to_2_uv_vectors_sse2, pack_6_rgb_vectors_in_4_bgra_vectors_sse2, sse2);
+}
+
+
+void		convert_nv21_to_bgra_bt601_sse2(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
+	CONVERT_TO_RGB32(nnb_upsample_n_convert_y_uv_vectors_to_rgb_vectors_bt601_, unpack_nv21_vu_to_2_uv_vectors_sse2, pack_6_rgb_vectors_in_4_bgra_vectors_sse2, sse2);
+}
+
+
+void		convert_nv21_to_bgra_bt709_sse2(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
+	CONVERT_TO_RGB32(nnb_upsample_n_convert_y_uv_vectors_to_rgb_vectors_bt709_, unpack_nv21_vu_to_2_uv_vectors_sse2, pack_6_rgb_vectors_in_4_bgra_vectors_sse2, sse2);
+}
+
+
+
+/*
+ *
+ * 		N V 2 1
+ *
+ * 		to
+ *
+ * 		R G B   2 4
+ */
+void		convert_nv21_to_rgb24_sse2(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
+	CONVERT_TO_RGB24(nnb_upsample_n_convert_y_uv_vectors_to_rgb_vectors_, unpack_nv21_vu_to_2_uv_vectors_sse2, pack_6_rgb_vectors_to_3_rgb24_vectors_sse2_slowpacking, sse2);
+}
+
+
+void		convert_nv21_to_rgb24_bt601_sse2(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
+	CONVERT_TO_RGB24(nnb_upsample_n_convert_y_uv_vectors_to_rgb_vectors_bt601_, unpack_nv21_vu_to_2_uv_vectors_sse2, pack_6_rgb_vectors_to_3_rgb24_vectors_sse2_slowpacking, sse2);
+}
+
+
+void		convert_nv21_to_rgb24_bt709_sse2(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
+	CONVERT_TO_RGB24(nnb_upsample_n_convert_y_uv_vectors_to_rgb_vectors_bt709_, unpack_nv21_vu_to_2_uv_vectors_sse2, pack_6_rgb_vectors_to_3_rgb24_vectors_sse2_slowpacking, sse2);
+}
+
+
+
+/*
+ *
+ * 		N V 2 1
+ *
+ * 		to
+ *
+ * 		B G R   2 4
+ */
+void		convert_nv21_to_bgr24_sse2(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
+	CONVERT_TO_RGB24(nnb_upsample_n_convert_y_uv_vectors_to_rgb_vectors_, unpack_nv21_vu_to_2_uv_vectors_sse2, pack_6_rgb_vectors_to_3_bgr24_vectors_sse2_slowpacking, sse2);
+}
+
+
+void		convert_nv21_to_bgr24_bt601_sse2(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
+	CONVERT_TO_RGB24(nnb_upsample_n_convert_y_uv_vectors_to_rgb_vectors_bt601_, unpack_nv21_vu_to_2_uv_vectors_sse2, pack_6_rgb_vectors_to_3_bgr24_vectors_sse2_slowpacking, sse2);
+}
+
+
+void		convert_nv21_to_bgr24_bt709_sse2(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
+	CONVERT_TO_RGB24(nnb_upsample_n_convert_y_uv_vectors_to_rgb_vectors_bt709_, unpack_nv21_vu_to_2_uv_vectors_sse2, pack_6_rgb_vectors_to_3_bgr24_vectors_sse2_slowpacking, sse2);
+}
+
+
+/*
+ *
+ * Non SSE conversion block (nearest neighbour upsampling)
+ *
+ */
+#define 	CONVERT_YUV_TO_RGB(y, u, v, r, g, b, coef_shift, coeffs, offsets) \
+		r = (((y + offsets[0]) * coeffs[0][0]) + ((u + offsets[1]) * coeffs[0][1]) + ((v + offsets[2]) * coeffs[0][2])) >> coef_shift;\
+		g = (((y + offsets[0]) * coeffs[1][0]) + ((u + offsets[1]) * coeffs[1][1]) + ((v + offsets[2]) * coeffs[1][2])) >> coef_shift;\
+		b = (((y + offsets[0]) * coeffs[2][0]) + ((u + offsets[1]) * coeffs[2][1]) + ((v + offsets[2]) * coeffs[2][2])) >> coef_shift;\
+
+#define 	CONVERT_YUV_TO_RGB_FLOAT(y, u, v, r, g, b, coef_shift, coeffs, offsets) \
+		r = ((y + offsets[0]) * coeffs[0][0]) + ((u + offsets[1]) * coeffs[0][1]) + ((v + offsets[2]) * coeffs[0][2]);\
+		g = ((y + offsets[0]) * coeffs[1][0]) + ((u + offsets[1]) * coeffs[1][1]) + ((v + offsets[2]) * coeffs[1][2]);\
+		b = ((y + offsets[0]) * coeffs[2][0]) + ((u + offsets[1]) * coeffs[2][1]) + ((v + offsets[2]) * coeffs[2][2]);\
+
+/*
+ * The same routines handle NV12 and NV21: only the position of U and V
+ * in each chroma pair differs.
+ */
+#define 	DEFINE_NV12_TO_ANY_RGB_NONSSE_FN(fn_name, convert_macro, coeffs, coef_shift, offsets) \
+void 		fn_name(const struct PixFcSSE* conv, void* in, void* out){\
+	PixFcPixelFormat 	dest_fmt = conv->dest_fmt;\
+	uint32_t			output_stride = ((dest_fmt == PixFcARGB) || (dest_fmt == PixFcBGRA)) ? 4 : 3;\
+	uint32_t 			pixels_remaining_on_line = conv->width;\
+	uint32_t			lines_remaining = conv->height;\
+	uint8_t*			y_src_line1 = (uint8_t *) in;\
+	uint8_t*			y_src_line2 = y_src_line1 + conv->width;\
+	uint8_t*			uv_src = y_src_line1 + conv->pixel_count;\
+	uint32_t			u_index = (conv->source_fmt == PixFcNV12) ? 0 : 1;\
+	uint8_t*			dst_line1 = (uint8_t *) out;\
+	uint8_t*			dst_line2 = dst_line1 + conv->dest_row_bytes;\
+	int32_t				r_line1, g_line1, b_line1;\
+	int32_t				r_line2, g_line2, b_line2;\
+	int32_t				y, u, v;\
+	while(lines_remaining > 0){\
+		while(pixels_remaining_on_line-- > 0) {\
+			y = *y_src_line1++;\
+			u = uv_src[u_index];\
+			v = uv_src[1 - u_index];\
+			convert_macro(y, u, v, r_line1, g_line1, b_line1, coef_shift, coeffs, offsets);\
+			y = *y_src_line2++;\
+			convert_macro(y, u, v, r_line2, g_line2, b_line2, coef_shift, coeffs, offsets);\
+			if ((pixels_remaining_on_line & 0x1) == 0)\
+				uv_src += 2;\
+			if (dest_fmt == PixFcARGB) {\
+				*(dst_line1++) = conv->alpha;\
+				*(dst_line1++) = CLIP_PIXEL(r_line1);\
+				*(dst_line1++) = CLIP_PIXEL(g_line1);\
+				*(dst_line1++) = CLIP_PIXEL(b_line1);\
+				*(dst_line2++) = conv->alpha;\
+				*(dst_line2++) = CLIP_PIXEL(r_line2);\
+				*(dst_line2++) = CLIP_PIXEL(g_line2);\
+				*(dst_line2++) = CLIP_PIXEL(b_line2);\
+			} else if (dest_fmt == PixFcBGRA) {\
+				*(dst_line1++) = CLIP_PIXEL(b_line1);\
+				*(dst_line1++) = CLIP_PIXEL(g_line1);\
+				*(dst_line1++) = CLIP_PIXEL(r_line1);\
+				*(dst_line1++) = conv->alpha;\
+				*(dst_line2++) = CLIP_PIXEL(b_line2);\
+				*(dst_line2++) = CLIP_PIXEL(g_line2);\
+				*(dst_line2++) = CLIP_PIXEL(r_line2);\
+				*(dst_line2++) = conv->alpha;\
+			} else  if (dest_fmt == PixFcRGB24) {\
+				*(dst_line1++) = CLIP_PIXEL(r_line1);\
+				*(dst_line1++) = CLIP_PIXEL(g_line1);\
+				*(dst_line1++) = CLIP_PIXEL(b_line1);\
+				*(dst_line2++) = CLIP_PIXEL(r_line2);\
+				*(dst_line2++) = CLIP_PIXEL(g_line2);\
+				*(dst_line2++) = CLIP_PIXEL(b_line2);\
+			} else {\
+				*(dst_line1++) = CLIP_PIXEL(b_line1);\
+				*(dst_line1++) = CLIP_PIXEL(g_line1);\
+				*(dst_line1++) = CLIP_PIXEL(r_line1);\
+				*(dst_line2++) = CLIP_PIXEL(b_line2);\
+				*(dst_line2++) = CLIP_PIXEL(g_line2);\
+				*(dst_line2++) = CLIP_PIXEL(r_line2);\
+			}\
+		}\
+		pixels_remaining_on_line = conv->width;\
+		lines_remaining -= 2;\
+		y_src_line1 += conv->width;\
+		y_src_line2 += conv->width;\
+		dst_line1 += 2 * conv->dest_row_bytes - conv->width * output_stride;\
+		dst_line2 += 2 * conv->dest_row_bytes - conv->width * output_stride;\
+	}\
+}
+
+DEFINE_NV12_TO_ANY_RGB_NONSSE_FN(convert_nv12_to_any_rgb_nonsse, CONVERT_YUV_TO_RGB, yuv_8bit_to_rgb_8bit_coef_lhs8[0], 8, yuv_8bit_to_rgb_8bit_off[0]);
+DEFINE_NV12_TO_ANY_RGB_NONSSE_FN(convert_nv12_to_any_rgb_bt601_nonsse, CONVERT_YUV_TO_RGB, yuv_8bit_to_rgb_8bit_coef_lhs8[1], 8, yuv_8bit_to_rgb_8bit_off[1]);
+DEFINE_NV12_TO_ANY_RGB_NONSSE_FN(convert_nv12_to_any_rgb_bt709_nonsse, CONVERT_YUV_TO_RGB, yuv_8bit_to_rgb_8bit_coef_lhs8[2], 8, yuv_8bit_to_rgb_8bit_off[2]);
+
+DEFINE_NV12_TO_ANY_RGB_NONSSE_FN(convert_nv12_to_any_rgb_nonsse_float, CONVERT_YUV_TO_RGB_FLOAT, yuv_8bit_to_rgb_8bit_coef[0], 0, yuv_8bit_to_rgb_8bit_off[0]);
+DEFINE_NV12_TO_ANY_RGB_NONSSE_FN(convert_nv12_to_any_rgb_bt601_nonsse_float, CONVERT_YUV_TO_RGB_FLOAT, yuv_8bit_to_rgb_8bit_coef[1], 0, yuv_8bit_to_rgb_8bit_off[1]);
+DEFINE_NV12_TO_ANY_RGB_NONSSE_FN(convert_nv12_to_any_rgb_bt709_nonsse_float, CONVERT_YUV_TO_RGB_FLOAT, yuv_8bit_to_rgb_8bit_coef[2], 0, yuv_8bit_to_rgb_8bit_off[2]);
+
+
+
+/*
+ * 		N V 1 2  /  N V 2 1
+ *
+ * 		T O
+ *
+ * 		Y U Y V  /  U Y V Y
+ *
+ */
+void		convert_nv12_to_yuyv_sse2(const struct PixFcSSE* pixfc, void* source_buffer, void* dest_buffer){
+	DO_REPACK(NV12_TO_YUV422I_RECIPE, repack_nv12_to_yuyv_, sse2);
+}
+
+void		convert_nv21_to_yuyv_sse2(const struct PixFcSSE* pixfc, void* source_buffer, void* dest_buffer){
+	DO_REPACK(NV12_TO_YUV422I_RECIPE, repack_nv21_to_yuyv_, sse2);
+}
+
+void		convert_nv12_to_uyvy_sse2(const struct PixFcSSE* pixfc, void* source_buffer, void* dest_buffer){
+	DO_REPACK(NV12_TO_YUV422I_RECIPE, repack_nv12_to_uyvy_, sse2);
+}
+
+void		convert_nv21_to_uyvy_sse2(const struct PixFcSSE* pixfc, void* source_buffer, void* dest_buffer){
+	DO_REPACK(NV12_TO_YUV422I_RECIPE, repack_nv21_to_uyvy_, sse2);
+}
+
+void		convert_nv12_to_yuv422i_nonsse(const struct PixFcSSE* pixfc, void* source_buffer, void* dest_buffer){
+	uint32_t	padding_bytes = ROW_PADDING_BYTE_COUNT(pixfc->dest_fmt, pixfc->width, pixfc->dest_row_bytes);
+	uint32_t	lines_remaining = pixfc->height;
+	uint32_t 	pixel_count;
+	uint8_t *	y_plane = (uint8_t *) source_buffer;
+	uint8_t *	uv_line = y_plane + pixfc->pixel_count;
+	uint8_t *	uv_plane;
+	uint32_t	u_index = (pixfc->source_fmt == PixFcNV12) ? 0 : 1;
+	uint8_t *	dst = (uint8_t *) dest_buffer;
+
+	// Do conversion
+	while(lines_remaining-- > 0) {
+		uv_plane = uv_line;
+		pixel_count = pixfc->width;
+		if (pixfc->dest_fmt == PixFcYUYV)
+			while(pixel_count > 0) {
+				*dst++ = *y_plane++;
+				*dst++ = uv_plane[u_index];
+				*dst++ = *y_plane++;
+				*dst++ = uv_plane[1 - u_index];
+				uv_plane += 2;
+
+				pixel_count -= 2;
+			}
+		else
+			while(pixel_count > 0) {
+				*dst++ = uv_plane[u_index];
+				*dst++ = *y_plane++;
+				*dst++ = uv_plane[1 - u_index];
+				*dst++ = *y_plane++;
+				uv_plane += 2;
+
+				pixel_count -= 2;
+			}
+		// Move on to the next chroma line every other line
+		if ((lines_remaining & 1) == 0)
+			uv_line = uv_plane;
+		dst += padding_bytes;
+	}
+}
+
+
+
+/*
+ * 		N V 1 2  /  N V 2 1
+ *
+ * 		T O
+ *
+ * 		Y U V 4 2 0 P
+ *
+ */
+void		convert_nv12_to_yuv420p_sse2(const struct PixFcSSE* pixfc, void* source_buffer, void* dest_buffer){
+	DO_REPACK(NV12_TO_YUV420P_RECIPE, repack_nv12_to_yuv420p_, u_plane, v_plane, sse2);
+}
+
+void		convert_nv21_to_yuv420p_sse2(const struct PixFcSSE* pixfc, void* source_buffer, void* dest_buffer){
+	DO_REPACK(NV12_TO_YUV420P_RECIPE, repack_nv12_to_yuv420p_, v_plane, u_plane, sse2);
+}
+
+void		convert_nv12_to_yuv420p_nonsse(const struct PixFcSSE* pixfc, void* source_buffer, void* dest_buffer){
+	uint32_t	chroma_count = pixfc->pixel_count / 4;
+	uint8_t *	uv_plane = (uint8_t *) source_buffer + pixfc->pixel_count;
+	uint8_t *	u_plane = (uint8_t *) dest_buffer + pixfc->pixel_count;
+	uint8_t *	v_plane = u_plane + chroma_count;
+
+	if (pixfc->source_fmt == PixFcNV21) {
+		v_plane = u_plane;
+		u_plane = v_plane + chroma_count;
+	}
+
+	// Do conversion
+	memcpy(dest_buffer, source_buffer, pixfc->pixel_count);
+	while(chroma_count-- > 0) {
+		*u_plane++ = *uv_plane++;
+		*v_plane++ = *uv_plane++;
+	}
+}
@@ -0,0 +1,172 @@
+/*
+ * conversion_routines_from_p210.c
+ *
+ * Copyright (C) 2012 PixFC Team (pixelfc@gmail.com)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public  License as published by the
+ * Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "common.h"
+#include "pixfc-sse.h"
+#include "yuv_conversion_recipes.h"
+
+/*
+ *
+ * Non SSE conversion block (nearest neighbour upsampling)
+ *
+ */
+#define PACK_RGB(r, g, b) \
+		if (dest_fmt == PixFcARGB) {\
+			*(dst++) = conv->alpha;\
+			*(dst++) = CLIP_PIXEL(r);\
+			*(dst++) = CLIP_PIXEL(g);\
+			*(dst++) = CLIP_PIXEL(b);\
+		} else if (dest_fmt == PixFcBGRA) {\
+			*(dst++) = CLIP_PIXEL(b);\
+			*(dst++) = CLIP_PIXEL(g);\
+			*(dst++) = CLIP_PIXEL(r);\
+			*(dst++) = conv->alpha;\
+		} else if (dest_fmt == PixFcRGB24) {\
+			*(dst++) = CLIP_PIXEL(r);\
+			*(dst++) = CLIP_PIXEL(g);\
+			*(dst++) = CLIP_PIXEL(b);\
+		} else if (dest_fmt == PixFcBGR24) {\
+			*(dst++) = CLIP_PIXEL(b);\
+			*(dst++) = CLIP_PIXEL(g);\
+			*(dst++) = CLIP_PIXEL(r);\
+		} else if (dest_fmt == PixFcR210) {\
+			uint32_t temp;\
+			uint8_t *tmp8 = (uint8_t *) &temp;\
+			temp = ((uint32_t)CLIP_10BIT_PIXEL(b) & 0x3FF);\
+			temp |= (((uint32_t)CLIP_10BIT_PIXEL(g) & 0x3FF) << 10);\
+			temp |= (((uint32_t)CLIP_10BIT_PIXEL(r) & 0x3FF) << 20);\
+			*dst++ = tmp8[3];\
+			*dst++ = tmp8[2];\
+			*dst++ = tmp8[1];\
+			*dst++ = tmp8[0];\
+		} else if (dest_fmt == PixFcR10k) {\
+			uint32_t temp;\
+			uint8_t *tmp8 = (uint8_t *) &temp;\
+			temp = (((uint32_t)CLIP_10BIT_PIXEL(b) & 0x3FF) << 2);\
+			temp |= (((uint32_t)CLIP_10BIT_PIXEL(g) & 0x3FF) << 12);\
+			temp |= (((uint32_t)CLIP_10BIT_PIXEL(r) & 0x3FF) << 22);\
+			*dst++ = tmp8[3];\
+			*dst++ = tmp8[2];\
+			*dst++ = tmp8[1];\
+			*dst++ = tmp8[0];\
+		} else {\
+			printf("Unknown RGB pixel format\n");\
+		}
+
+#define 	CONVERT_YUV_TO_RGB(y, u, v, r, g, b, coef_shift, coeffs, offsets) \
+		r = (((y + offsets[0]) * coeffs[0][0]) + ((u + offsets[1]) * coeffs[0][1]) + ((v + offsets[2]) * coeffs[0][2])) >> coef_shift;\
+		g = (((y + offsets[0]) * coeffs[1][0]) + ((u + offsets[1]) * coeffs[1][1]) + ((v + offsets[2]) * coeffs[1][2])) >> coef_shift;\
+		b = (((y + offsets[0]) * coeffs[2][0]) + ((u + offsets[1]) * coeffs[2][1]) + ((v + offsets[2]) * coeffs[2][2])) >> coef_shift;\
+
+#define 	CONVERT_YUV_TO_RGB_FLOAT(y, u, v, r, g, b, coef_shift, coeffs, offsets) \
+		r = ((y + offsets[0]) * coeffs[0][0]) + ((u + offsets[1]) * coeffs[0][1]) + ((v + offsets[2]) * coeffs[0][2]);\
+		g = ((y + offsets[0]) * coeffs[1][0]) + ((u + offsets[1]) * coeffs[1][1]) + ((v + offsets[2]) * coeffs[1][2]);\
+		b = ((y + offsets[0]) * coeffs[2][0]) + ((u + offsets[1]) * coeffs[2][1]) + ((v + offsets[2]) * coeffs[2][2]);\
+
+/*
+ * The same routines handle P010 and P210 as well as 8-bit and 10-bit RGB
+ * destinations. Samples are stored in the 10 MSBs of each 16-bit word.
+ */
+#define 	DEFINE_P210_TO_ANY_RGB_NONSSE_FN(fn_name, convert_macro, coeffs, coef_shift, offsets) \
+void 		fn_name(const struct PixFcSSE* conv, void* in, void* out){\
+	PixFcPixelFormat 	dest_fmt = conv->dest_fmt;\
+	uint32_t			chroma_line_shift = (conv->source_fmt == PixFcP010) ? 1 : 0;\
+	uint32_t 			pixel;\
+	uint32_t			line = 0;\
+	uint16_t*			y_src = (uint16_t *) in;\
+	uint16_t*			uv_plane = y_src + conv->pixel_count;\
+	uint16_t*			uv_src;\
+	uint8_t*			dst;\
+	int32_t				r, g, b;\
+	int32_t				y, u, v;\
+	while(line < conv->height){\
+		uv_src = uv_plane + (line >> chroma_line_shift) * conv->width;\
+		dst = (uint8_t *) out + line * conv->dest_row_bytes;\
+		pixel = conv->width;\
+		while(pixel > 0) {\
+			u = uv_src[0] >> 6;\
+			v = uv_src[1] >> 6;\
+			y = *(y_src++) >> 6;\
+			convert_macro(y, u, v, r, g, b, coef_shift, coeffs, offsets);\
+			PACK_RGB(r, g, b);\
+			y = *(y_src++) >> 6;\
+			convert_macro(y, u, v, r, g, b, coef_shift, coeffs, offsets);\
+			PACK_RGB(r, g, b);\
+			uv_src += 2;\
+			pixel -= 2;\
+		}\
+		line++;\
+	}\
+}
+
+DEFINE_P210_TO_ANY_RGB_NONSSE_FN(convert_p210_to_any_rgb_nonsse, CONVERT_YUV_TO_RGB, yuv_10bit_to_rgb_8bit_coef_lhs8[0], 8, yuv_10bit_to_rgb_8bit_off[0]);
+DEFINE_P210_TO_ANY_RGB_NONSSE_FN(convert_p210_to_any_rgb_bt601_nonsse, CONVERT_YUV_TO_RGB, yuv_10bit_to_rgb_8bit_coef_lhs8[1], 8, yuv_10bit_to_rgb_8bit_off[1]);
+DEFINE_P210_TO_ANY_RGB_NONSSE_FN(convert_p210_to_any_rgb_bt709_nonsse, CONVERT_YUV_TO_RGB, yuv_10bit_to_rgb_8bit_coef_lhs8[2], 8, yuv_10bit_to_rgb_8bit_off[2]);
+DEFINE_P210_TO_ANY_RGB_NONSSE_FN(convert_p210_to_any_10bit_rgb_nonsse, CONVERT_YUV_TO_RGB, yuv_10bit_to_rgb_10bit_coef_lhs8[0], 8, yuv_10bit_to_rgb_10bit_off[0]);
+DEFINE_P210_TO_ANY_RGB_NONSSE_FN(convert_p210_to_any_10bit_rgb_bt601_nonsse, CONVERT_YUV_TO_RGB, yuv_10bit_to_rgb_10bit_coef_lhs8[1], 8, yuv_10bit_to_rgb_10bit_off[1]);
+DEFINE_P210_TO_ANY_RGB_NONSSE_FN(convert_p210_to_any_10bit_rgb_bt709_nonsse, CONVERT_YUV_TO_RGB, yuv_10bit_to_rgb_10bit_coef_lhs8[2], 8, yuv_10bit_to_rgb_10bit_off[2]);
+
+DEFINE_P210_TO_ANY_RGB_NONSSE_FN(convert_p210_to_any_rgb_nonsse_float, CONVERT_YUV_TO_RGB_FLOAT, yuv_10bit_to_rgb_8bit_coef[0], 0, yuv_10bit_to_rgb_8bit_off[0]);
+DEFINE_P210_TO_ANY_RGB_NONSSE_FN(convert_p210_to_any_rgb_bt601_nonsse_float, CONVERT_YUV_TO_RGB_FLOAT, yuv_10bit_to_rgb_8bit_coef[1], 0, yuv_10bit_to_rgb_8bit_off[1]);
+DEFINE_P210_TO_ANY_RGB_NONSSE_FN(convert_p210_to_any_rgb_bt709_nonsse_float, CONVERT_YUV_TO_RGB_FLOAT, yuv_10bit_to_rgb_8bit_coef[2], 0, yuv_10bit_to_rgb_8bit_off[2]);
+DEFINE_P210_TO_ANY_RGB_NONSSE_FN(convert_p210_to_any_10bit_rgb_nonsse_float, CONVERT_YUV_TO_RGB_FLOAT, yuv_10bit_to_rgb_10bit_coef[0], 0, yuv_10bit_to_rgb_10bit_off[0]);
+DEFINE_P210_TO_ANY_RGB_NONSSE_FN(convert_p210_to_any_10bit_rgb_bt601_nonsse_float, CONVERT_YUV_TO_RGB_FLOAT, yuv_10bit_to_rgb_10bit_coef[1], 0, yuv_10bit_to_rgb_10bit_off[1]);
+DEFINE_P210_TO_ANY_RGB_NONSSE_FN(convert_p210_to_any_10bit_rgb_bt709_nonsse_float, CONVERT_YUV_TO_RGB_FLOAT, yuv_10bit_to_rgb_10bit_coef[2], 0, yuv_10bit_to_rgb_10bit_off[2]);
+
+
+
+/*
+ *
+ * 		P 0 1 0  /  P 2 1 0
+ *
+ * 		T O
+ *
+ * 		V 2 1 0
+ *
+ */
+// Return the 10-bit sample at 'index' or 0 past the end of the line, so the
+// last v210 block of a line is padded with zeros.
+#define P210_SAMPLE(plane, index, count)	(((index) < (count)) ? (uint32_t)((plane)[(index)] >> 6) : 0)
+
+void		convert_p210_to_v210_nonsse(const struct PixFcSSE* conv, void* in, void* out) {
+	uint32_t			chroma_line_shift = (conv->source_fmt == PixFcP010) ? 1 : 0;
+	uint32_t 			pixel;
+	uint32_t			line = 0;
+	uint16_t*			y_src;
+	uint16_t*			uv_src;
+	uint32_t*			dst;
+	uint32_t			w = conv->width;
+
+	// This conversion routine only assumes an even number of pixels.
+	while(line < conv->height) {
+		y_src = (uint16_t *) in + line * w;
+		uv_src = (uint16_t *) in + conv->pixel_count + (line >> chroma_line_shift) * w;
+		dst = (uint32_t *) ((uint8_t *) out + line * conv->dest_row_bytes);
+
+		for(pixel = 0; pixel < w; pixel += 6) {
+			*dst++ = P210_SAMPLE(uv_src, pixel, w) | (P210_SAMPLE(y_src, pixel, w) << 10) | (P210_SAMPLE(uv_src, pixel + 1, w) << 20);
+			*dst++ = P210_SAMPLE(y_src, pixel + 1, w) | (P210_SAMPLE(uv_src, pixel + 2, w) << 10) | (P210_SAMPLE(y_src, pixel + 2, w) << 20);
+			*dst++ = P210_SAMPLE(uv_src, pixel + 3, w) | (P210_SAMPLE(y_src, pixel + 3, w) << 10) | (P210_SAMPLE(uv_src, pixel + 4, w) << 20);
+			*dst++ = P210_SAMPLE(y_src, pixel + 4, w) | (P210_SAMPLE(uv_src, pixel + 5, w) << 10) | (P210_SAMPLE(y_src, pixel + 5, w) << 20);
+		}
+
+		line++;
+	}
+}
@@ -0,0 +1,62 @@
+/*
+ * conversion_routines_from_p210_sse41.c
+ *
+ * Copyright (C) 2012 PixFC Team (pixelfc@gmail.com)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public  License as published by the
+ * Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "common.h"
+#include "pixfc-sse.h"
+#include "yuv_conversion_recipes.h"
+
+/*
+ * P010 and P210 share the same unpacking code: the only difference is the
+ * number of lines each chroma line applies to (chroma_line_shift).
+ */
+#define CONVERT_TO_V210(pack_fn, chroma_line_shift)\
+		DO_CONVERSION_1U_1P(\
+				P210_TO_V210_RECIPE,\
+				unpack_p210_to_y_uv_vectors_sse2,\
+				pack_fn,\
+				chroma_line_shift\
+		)
+
+/*
+ *
+ * 		P 2 1 0
+ *
+ * 		to
+ *
+ * 		V 2 1 0
+ */
+void		convert_p210_to_v210_sse2_ssse3_sse41(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
+	CONVERT_TO_V210(pack_6_y_uv_vectors_to_4_v210_vectors_sse2_ssse3_sse41, 0);
+}
+
+/*
+ *
+ * 		P 0 1 0
+ *
+ * 		to
+ *
+ * 		V 2 1 0
+ */
+void		convert_p010_to_v210_sse2_ssse3_sse41(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
+	CONVERT_TO_V210(pack_6_y_uv_vectors_to_4_v210_vectors_sse2_ssse3_sse41, 1);
+}
+
+// Return the 10-bit sample at 'index' or 0 past the end of the line, so the
+// last v210 block of a line is padded with zeros.
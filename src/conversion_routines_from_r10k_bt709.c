@@ -114,15 +114,6 @@ void		downsample_n_convert_r10k_to_yuv422p_bt709_sse2_ssse3(const struct PixFcSS
 	DOWNSAMPLE_N_CONVERT_TO_YUV422P(sse2_ssse3);
 }
 
-// r10k to v210			SSE2 SSSE3 SSE41
-void		convert_r10k_to_v210_bt709_sse2_ssse3_sse41(const struct PixFcSSE *pixfc, void* source_buffer, void* dest_buffer) {
-	CONVERT_TO_V210(sse2_ssse3_sse41);
-}
-
-void		downsample_n_convert_r10k_to_v210_bt709_sse2_ssse3_sse41(const struct PixFcSSE *pixfc, void* source_buffer, void* dest_buffer) {
-	DOWNSAMPLE_N_CONVERT_TO_V210(sse2_ssse3_sse41);
-}
-
 // r10k to v210			SSE2 SSSE3
 void		convert_r10k_to_v210_bt709_sse2_ssse3(const struct PixFcSSE *pixfc, void* source_buffer, void* dest_buffer) {
 	CONVERT_TO_V210(sse2_ssse3);
@@ -131,5 +122,3 @@ void		convert_r10k_to_v210_bt709_sse2_ssse3(const struct PixFcSSE *pixfc, void*
 void		downsample_n_convert_r10k_to_v210_bt709_sse2_ssse3(const struct PixFcSSE *pixfc, void* source_buffer, void* dest_buffer) {
 	DOWNSAMPLE_N_CONVERT_TO_V210(sse2_ssse3);
 }
-
-
@@ -0,0 +1,54 @@
+/*
+ * conversion_routines_from_r10k_bt709_sse41.c
+ *
+ * Copyright (C) 2012 PixFC Team (pixelfc@gmail.com)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public  License as published by the
+ * Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "common.h"
+#include "pixfc-sse.h"
+#include "rgb_conversion_recipes.h"
+
+
+#define CONVERT_TO_V210(instr_set)\
+	DO_CONVERSION_1U_1P(\
+		RGB32_TO_V210_RECIPE,\
+		unpack_2_r10k_to_r_g_b_vectors_sse2_ssse3,\
+		pack_6_y_uv_vectors_to_4_v210_vectors_ ## instr_set,\
+		convert_10bit_r_g_b_vectors_to_10bit_y_vector_bt709_sse2,\
+		convert_downsampled_422_10bit_r_g_b_vectors_to_10bit_uv_vector_bt709_sse2,\
+		instr_set\
+	)
+
+#define DOWNSAMPLE_N_CONVERT_TO_V210(instr_set)\
+	DO_CONVERSION_1U_1P(\
+		AVG_DOWNSAMPLE_RGB32_TO_V210_RECIPE,\
+		unpack_2_r10k_to_r_g_b_vectors_sse2_ssse3,\
+		pack_6_y_uv_vectors_to_4_v210_vectors_ ## instr_set,\
+		convert_10bit_r_g_b_vectors_to_10bit_y_vector_bt709_sse2,\
+		convert_downsampled_422_10bit_r_g_b_vectors_to_10bit_uv_vector_bt709_sse2,\
+		instr_set\
+	)
+
+
+// r10k to v210			SSE2 SSSE3 SSE41
+void		convert_r10k_to_v210_bt709_sse2_ssse3_sse41(const struct PixFcSSE *pixfc, void* source_buffer, void* dest_buffer) {
+	CONVERT_TO_V210(sse2_ssse3_sse41);
+}
+
+void		downsample_n_convert_r10k_to_v210_bt709_sse2_ssse3_sse41(const struct PixFcSSE *pixfc, void* source_buffer, void* dest_buffer) {
+	DOWNSAMPLE_N_CONVERT_TO_V210(sse2_ssse3_sse41);
+}
@@ -114,15 +114,6 @@ void		downsample_n_convert_r210_to_yuv422p_sse2_ssse3(const struct PixFcSSE *pix
 	DOWNSAMPLE_N_CONVERT_TO_YUV422P(sse2_ssse3);
 }
 
-// r210 to v210			SSE2 SSSE3 SSE41
-void		convert_r210_to_v210_sse2_ssse3_sse41(const struct PixFcSSE *pixfc, void* source_buffer, void* dest_buffer) {
-	CONVERT_TO_V210(sse2_ssse3_sse41);
-}
-
-void		downsample_n_convert_r210_to_v210_sse2_ssse3_sse41(const struct PixFcSSE *pixfc, void* source_buffer, void* dest_buffer) {
-	DOWNSAMPLE_N_CONVERT_TO_V210(sse2_ssse3_sse41);
-}
-
 // r210 to v210			SSE2 SSSE3
 void		convert_r210_to_v210_sse2_ssse3(const struct PixFcSSE *pixfc, void* source_buffer, void* dest_buffer) {
 	CONVERT_TO_V210(sse2_ssse3);
@@ -156,4 +147,3 @@ void		convert_r210_to_rgb24_sse2_ssse3(const struct PixFcSSE *pixfc, void* sourc
 void		convert_r210_to_bgr24_sse2_ssse3(const struct PixFcSSE *pixfc, void* source_buffer, void* dest_buffer) {
 	DO_REPACK2(R210_TO_RGB_RECIPE, unpack_4_r210_to_r_g_b_vectors_sse2_ssse3, pack_6_rgb_vectors_in_3_bgr24_vectors_sse2_ssse3, 3);
 }
-
@@ -61,12 +61,14 @@ void 		convert_10bit_rgb_to_yuv422_nonsse(const struct PixFcSSE *, void *, void
 void 		downsample_n_convert_10bit_rgb_to_yuv422_nonsse(const struct PixFcSSE *, void *, void *);
 void		convert_10bit_rgb_to_v210_nonsse(const struct PixFcSSE *, void *, void *);
 void		downsample_n_convert_10bit_rgb_to_v210_nonsse(const struct PixFcSSE *, void *, void *);
+void		convert_10bit_rgb_to_p210_nonsse(const struct PixFcSSE *, void *, void *);
 
 // RGB to YUV422		NON SSE float (declared in conversions_from_argc_scalar.c)
 void 		convert_10bit_rgb_to_yuv422_nonsse_float(const struct PixFcSSE* conv, void* in, void* out);
 void 		downsample_n_convert_10bit_rgb_to_yuv422_nonsse_float(const struct PixFcSSE* conv, void* in, void* out);
 void		convert_10bit_rgb_to_v210_nonsse_float(const struct PixFcSSE *, void *, void *);
 void		downsample_n_convert_10bit_rgb_to_v210_nonsse_float(const struct PixFcSSE *, void *, void *);
+void		convert_10bit_rgb_to_p210_nonsse_float(const struct PixFcSSE *, void *, void *);
 
 
 /*
@@ -106,12 +108,14 @@ void 		convert_10bit_rgb_to_yuv422_bt601_nonsse(const struct PixFcSSE* conv, voi
 void 		downsample_n_convert_10bit_rgb_to_yuv422_bt601_nonsse(const struct PixFcSSE* conv, void* in, void* out);
 void		convert_10bit_rgb_to_v210_bt601_nonsse(const struct PixFcSSE *, void *, void *);
 void		downsample_n_convert_10bit_rgb_to_v210_bt601_nonsse(const struct PixFcSSE *, void *, void *);
+void		convert_10bit_rgb_to_p210_bt601_nonsse(const struct PixFcSSE *, void *, void *);
 
 // RGB to YUV422		NON SSE float (declared in conversions_from_argc_scalar.c)
 void 		convert_10bit_rgb_to_yuv422_bt601_nonsse_float(const struct PixFcSSE* conv, void* in, void* out);
 void 		downsample_n_convert_10bit_rgb_to_yuv422_bt601_nonsse_float(const struct PixFcSSE* conv, void* in, void* out);
 void		convert_10bit_rgb_to_v210_bt601_nonsse_float(const struct PixFcSSE *, void *, void *);
 void		downsample_n_convert_10bit_rgb_to_v210_bt601_nonsse_float(const struct PixFcSSE *, void *, void *);
+void		convert_10bit_rgb_to_p210_bt601_nonsse_float(const struct PixFcSSE *, void *, void *);
 
 
 
@@ -152,12 +156,14 @@ void 		convert_10bit_rgb_to_yuv422_bt709_nonsse(const struct PixFcSSE* conv, voi
 void 		downsample_n_convert_10bit_rgb_to_yuv422_bt709_nonsse(const struct PixFcSSE* conv, void* in, void* out);
 void		convert_10bit_rgb_to_v210_bt709_nonsse(const struct PixFcSSE *, void *, void *);
 void		downsample_n_convert_10bit_rgb_to_v210_bt709_nonsse(const struct PixFcSSE *, void *, void *);
+void		convert_10bit_rgb_to_p210_bt709_nonsse(const struct PixFcSSE *, void *, void *);
 
 // RGB to YUV422		NON SSE float (declared in conversions_from_argc_scalar.c)
 void 		convert_10bit_rgb_to_yuv422_bt709_nonsse_float(const struct PixFcSSE* conv, void* in, void* out);
 void 		downsample_n_convert_10bit_rgb_to_yuv422_bt709_nonsse_float(const struct PixFcSSE* conv, void* in, void* out);
 void		convert_10bit_rgb_to_v210_bt709_nonsse_float(const struct PixFcSSE *, void *, void *);
 void		downsample_n_convert_10bit_rgb_to_v210_bt709_nonsse_float(const struct PixFcSSE *, void *, void *);
+void		convert_10bit_rgb_to_p210_bt709_nonsse_float(const struct PixFcSSE *, void *, void *);
 
 
 
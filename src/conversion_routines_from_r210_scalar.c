@@ -54,7 +54,7 @@
 #define PACK_RGB(r, g, b, dst, dest_fmt) \
 	if (dest_fmt == PixFcARGB) {\
 		/* dprint("R: %d G: %d B: %d\n", CLIP_PIXEL(r), CLIP_PIXEL(g), CLIP_PIXEL(b)); */\
-		*(dst++) = 0;\
+		*(dst++) = pixfc->alpha;\
 		*(dst++) = CLIP_PIXEL(r);\
 		*(dst++) = CLIP_PIXEL(g);\
 		*(dst++) = CLIP_PIXEL(b);\
@@ -62,7 +62,7 @@
 		*(dst++) = CLIP_PIXEL(b);\
 		*(dst++) = CLIP_PIXEL(g);\
 		*(dst++) = CLIP_PIXEL(r);\
-		*(dst++) = 0;\
+		*(dst++) = pixfc->alpha;\
 	} else  if (dest_fmt == PixFcRGB24) {\
 		*(dst++) = CLIP_PIXEL(r);\
 		*(dst++) = CLIP_PIXEL(g);\
@@ -106,14 +106,13 @@
  *
  */
 // This conversion makes no assumption on the number of pixels
-void		convert_10bit_rgb_to_any_rgb_nonsse(const struct PixFcSSE* pixfc, void* in, void* out) {
-	PixFcPixelFormat 	src_fmt = pixfc->source_fmt;
-	PixFcPixelFormat 	dst_fmt = pixfc->dest_fmt;
+static FORCE_INLINE void convert_10bit_rgb_to_any_rgb_nonsse_fmt(const struct PixFcSSE* pixfc, void* in, void* out, const PixFcPixelFormat src_fmt, const PixFcPixelFormat dst_fmt) {
 	uint32_t 			pixel = 0;
 	uint32_t			line = 0;
 	uint8_t*			src = (uint8_t *) in;
 	uint8_t*			dst = (uint8_t *) out;
-	uint32_t			src_row_byte_count = ROW_SIZE(src_fmt, pixfc->width);
+	uint32_t			src_row_byte_count = pixfc->source_row_bytes;
+	uint32_t			dst_row_byte_count = pixfc->dest_row_bytes;
 	int32_t				r = 0, g = 0, b = 0;
 	while(line++ < pixfc->height){
 		while(pixel < pixfc->width) {
@@ -125,7 +124,13 @@ void		convert_10bit_rgb_to_any_rgb_nonsse(const struct PixFcSSE* pixfc, void* in
 			pixel += 1;
 		}
 		src = (uint8_t*)in + line * src_row_byte_count;
+		dst = (uint8_t*)out + line * dst_row_byte_count;
 		pixel = 0;
 	}
 }
 
+void		convert_10bit_rgb_to_any_rgb_nonsse(const struct PixFcSSE* pixfc, void* in, void* out) {
+	CALL_FOR_8BIT_RGB_DEST_FORMATS(convert_10bit_rgb_to_any_rgb_nonsse_fmt, pixfc, in, out, PixFcR210);
+	CALL_FOR_8BIT_RGB_DEST_FORMATS(convert_10bit_rgb_to_any_rgb_nonsse_fmt, pixfc, in, out, PixFcR10k);
+	printf("unknown rgb source format\n");
+}
@@ -60,7 +60,21 @@ void		downsample_n_convert_rgb24_to_yuv422p_sse2(const struct PixFcSSE *, void*,
 
 // RGB24 to YUV420P			SSE2 / SSSE3
 void		convert_rgb24_to_yuv420p_sse2_ssse3(const struct PixFcSSE *, void*, void*);
+void		downsample_n_convert_rgb24_to_yuv420p_sse2_ssse3(const struct PixFcSSE *, void*, void*);
 void		convert_rgb24_to_yuv420p_sse2(const struct PixFcSSE *, void*, void*);
+void		downsample_n_convert_rgb24_to_yuv420p_sse2(const struct PixFcSSE *, void*, void*);
+
+// RGB24 to NV12			SSE2 / SSSE3
+void		convert_rgb24_to_nv12_sse2_ssse3(const struct PixFcSSE *, void*, void*);
+void		downsample_n_convert_rgb24_to_nv12_sse2_ssse3(const struct PixFcSSE *, void*, void*);
+void		convert_rgb24_to_nv12_sse2(const struct PixFcSSE *, void*, void*);
+void		downsample_n_convert_rgb24_to_nv12_sse2(const struct PixFcSSE *, void*, void*);
+
+// RGB24 to NV21			SSE2 / SSSE3
+void		convert_rgb24_to_nv21_sse2_ssse3(const struct PixFcSSE *, void*, void*);
+void		downsample_n_convert_rgb24_to_nv21_sse2_ssse3(const struct PixFcSSE *, void*, void*);
+void		convert_rgb24_to_nv21_sse2(const struct PixFcSSE *, void*, void*);
+void		downsample_n_convert_rgb24_to_nv21_sse2(const struct PixFcSSE *, void*, void*);
 
 // RGB24 to V210			SSE2 SSSE3 SSE41
 void		convert_rgb24_to_v210_sse2_ssse3_sse41(const struct PixFcSSE *, void*, void*);
@@ -112,7 +126,21 @@ void		downsample_n_convert_rgb24_to_yuv422p_bt601_sse2(const struct PixFcSSE *,
 
 // RGB24 to YUV420P			SSE2 / SSSE3
 void		convert_rgb24_to_yuv420p_bt601_sse2_ssse3(const struct PixFcSSE *, void*, void*);
+void		downsample_n_convert_rgb24_to_yuv420p_bt601_sse2_ssse3(const struct PixFcSSE *, void*, void*);
 void		convert_rgb24_to_yuv420p_bt601_sse2(const struct PixFcSSE *, void*, void*);
+void		downsample_n_convert_rgb24_to_yuv420p_bt601_sse2(const struct PixFcSSE *, void*, void*);
+
+// RGB24 to NV12			SSE2 / SSSE3
+void		convert_rgb24_to_nv12_bt601_sse2_ssse3(const struct PixFcSSE *, void*, void*);
+void		downsample_n_convert_rgb24_to_nv12_bt601_sse2_ssse3(const struct PixFcSSE *, void*, void*);
+void		convert_rgb24_to_nv12_bt601_sse2(const struct PixFcSSE *, void*, void*);
+void		downsample_n_convert_rgb24_to_nv12_bt601_sse2(const struct PixFcSSE *, void*, void*);
+
+// RGB24 to NV21			SSE2 / SSSE3
+void		convert_rgb24_to_nv21_bt601_sse2_ssse3(const struct PixFcSSE *, void*, void*);
+void		downsample_n_convert_rgb24_to_nv21_bt601_sse2_ssse3(const struct PixFcSSE *, void*, void*);
+void		convert_rgb24_to_nv21_bt601_sse2(const struct PixFcSSE *, void*, void*);
+void		downsample_n_convert_rgb24_to_nv21_bt601_sse2(const struct PixFcSSE *, void*, void*);
 
 // RGB24 to V210			SSE2 SSSE3 SSE41
 void		convert_rgb24_to_v210_bt601_sse2_ssse3_sse41(const struct PixFcSSE *, void*, void*);
@@ -164,7 +192,21 @@ void		downsample_n_convert_rgb24_to_yuv422p_bt709_sse2(const struct PixFcSSE *,
 
 // RGB24 to YUV420P			SSE2 / SSSE3
 void		convert_rgb24_to_yuv420p_bt709_sse2_ssse3(const struct PixFcSSE *, void*, void*);
+void		downsample_n_convert_rgb24_to_yuv420p_bt709_sse2_ssse3(const struct PixFcSSE *, void*, void*);
 void		convert_rgb24_to_yuv420p_bt709_sse2(const struct PixFcSSE *, void*, void*);
+void		downsample_n_convert_rgb24_to_yuv420p_bt709_sse2(const struct PixFcSSE *, void*, void*);
+
+// RGB24 to NV12			SSE2 / SSSE3
+void		convert_rgb24_to_nv12_bt709_sse2_ssse3(const struct PixFcSSE *, void*, void*);
+void		downsample_n_convert_rgb24_to_nv12_bt709_sse2_ssse3(const struct PixFcSSE *, void*, void*);
+void		convert_rgb24_to_nv12_bt709_sse2(const struct PixFcSSE *, void*, void*);
+void		downsample_n_convert_rgb24_to_nv12_bt709_sse2(const struct PixFcSSE *, void*, void*);
+
+// RGB24 to NV21			SSE2 / SSSE3
+void		convert_rgb24_to_nv21_bt709_sse2_ssse3(const struct PixFcSSE *, void*, void*);
+void		downsample_n_convert_rgb24_to_nv21_bt709_sse2_ssse3(const struct PixFcSSE *, void*, void*);
+void		convert_rgb24_to_nv21_bt709_sse2(const struct PixFcSSE *, void*, void*);
+void		downsample_n_convert_rgb24_to_nv21_bt709_sse2(const struct PixFcSSE *, void*, void*);
 
 // RGB24 to V210			SSE2 SSSE3 SSE41
 void		convert_rgb24_to_v210_bt709_sse2_ssse3_sse41(const struct PixFcSSE *, void*, void*);
@@ -194,4 +236,123 @@ void 		convert_rgb_to_yuv422_bt709_nonsse(const struct PixFcSSE* conv, void* in,
 void		convert_rgb24_to_r210_sse2_ssse3(const struct PixFcSSE *, void *, void *);
 void		convert_rgb_to_10bit_rgb_nonsse(const struct PixFcSSE *, void *, void *);
 
+/*
+ *
+ * 		R G B 2 4
+ *
+ * 		T O
+ *
+ * 		8 B I T    R G B
+ *
+ */
+// RGB24 to ARGB
+void		convert_rgb24_to_argb_sse2_ssse3(const struct PixFcSSE *, void *, void *);
+void		convert_rgb24_to_argb_sse2(const struct PixFcSSE *, void *, void *);
+// RGB24 to BGRA
+void		convert_rgb24_to_bgra_sse2_ssse3(const struct PixFcSSE *, void *, void *);
+void		convert_rgb24_to_bgra_sse2(const struct PixFcSSE *, void *, void *);
+// RGB24 to BGR24
+void		convert_rgb24_to_bgr24_sse2_ssse3(const struct PixFcSSE *, void *, void *);
+void		convert_rgb24_to_bgr24_sse2(const struct PixFcSSE *, void *, void *);
+void		convert_rgb_to_any_rgb_nonsse(const struct PixFcSSE *, void *, void *);
+
+/*
+ *
+ *
+ *	A V X 2
+ *
+ *  C O N V E R S I O N S
+ *
+ *
+ */
+// RGB24 to YUYV		AVX2
+void		downsample_n_convert_rgb24_to_yuyv_avx2(const struct PixFcSSE *, void *, void *);
+void		convert_rgb24_to_yuyv_avx2(const struct PixFcSSE *, void *, void *);
+void		downsample_n_convert_rgb24_to_yuyv_bt601_avx2(const struct PixFcSSE *, void *, void *);
+void		convert_rgb24_to_yuyv_bt601_avx2(const struct PixFcSSE *, void *, void *);
+void		downsample_n_convert_rgb24_to_yuyv_bt709_avx2(const struct PixFcSSE *, void *, void *);
+void		convert_rgb24_to_yuyv_bt709_avx2(const struct PixFcSSE *, void *, void *);
+
+// RGB24 to UYVY		AVX2
+void		downsample_n_convert_rgb24_to_uyvy_avx2(const struct PixFcSSE *, void *, void *);
+void		convert_rgb24_to_uyvy_avx2(const struct PixFcSSE *, void *, void *);
+void		downsample_n_convert_rgb24_to_uyvy_bt601_avx2(const struct PixFcSSE *, void *, void *);
+void		convert_rgb24_to_uyvy_bt601_avx2(const struct PixFcSSE *, void *, void *);
+void		downsample_n_convert_rgb24_to_uyvy_bt709_avx2(const struct PixFcSSE *, void *, void *);
+void		convert_rgb24_to_uyvy_bt709_avx2(const struct PixFcSSE *, void *, void *);
+
+// RGB24 to YUV422P		AVX2
+void		downsample_n_convert_rgb24_to_yuv422p_avx2(const struct PixFcSSE *, void *, void *);
+void		convert_rgb24_to_yuv422p_avx2(const struct PixFcSSE *, void *, void *);
+void		downsample_n_convert_rgb24_to_yuv422p_bt601_avx2(const struct PixFcSSE *, void *, void *);
+void		convert_rgb24_to_yuv422p_bt601_avx2(const struct PixFcSSE *, void *, void *);
+void		downsample_n_convert_rgb24_to_yuv422p_bt709_avx2(const struct PixFcSSE *, void *, void *);
+void		convert_rgb24_to_yuv422p_bt709_avx2(const struct PixFcSSE *, void *, void *);
+
+// RGB24 to v210		AVX2
+void		downsample_n_convert_rgb24_to_v210_avx2(const struct PixFcSSE *, void *, void *);
+void		convert_rgb24_to_v210_avx2(const struct PixFcSSE *, void *, void *);
+void		downsample_n_convert_rgb24_to_v210_bt601_avx2(const struct PixFcSSE *, void *, void *);
+void		convert_rgb24_to_v210_bt601_avx2(const struct PixFcSSE *, void *, void *);
+void		downsample_n_convert_rgb24_to_v210_bt709_avx2(const struct PixFcSSE *, void *, void *);
+void		convert_rgb24_to_v210_bt709_avx2(const struct PixFcSSE *, void *, void *);
+
+// RGB24 to ARGB		AVX2
+void		convert_rgb24_to_argb_avx2(const struct PixFcSSE *, void *, void *);
+
+// RGB24 to BGRA		AVX2
+void		convert_rgb24_to_bgra_avx2(const struct PixFcSSE *, void *, void *);
+
+// RGB24 to BGR24		AVX2
+void		convert_rgb24_to_bgr24_avx2(const struct PixFcSSE *, void *, void *);
+
+// RGB24 to YUYV		NEON
+void		downsample_n_convert_rgb24_to_yuyv_neon(const struct PixFcSSE *, void *, void *);
+void		convert_rgb24_to_yuyv_neon(const struct PixFcSSE *, void *, void *);
+void		downsample_n_convert_rgb24_to_yuyv_bt601_neon(const struct PixFcSSE *, void *, void *);
+void		convert_rgb24_to_yuyv_bt601_neon(const struct PixFcSSE *, void *, void *);
+void		downsample_n_convert_rgb24_to_yuyv_bt709_neon(const struct PixFcSSE *, void *, void *);
+void		convert_rgb24_to_yuyv_bt709_neon(const struct PixFcSSE *, void *, void *);
+
+// RGB24 to UYVY		NEON
+void		downsample_n_convert_rgb24_to_uyvy_neon(const struct PixFcSSE *, void *, void *);
+void		convert_rgb24_to_uyvy_neon(const struct PixFcSSE *, void *, void *);
+void		downsample_n_convert_rgb24_to_uyvy_bt601_neon(const struct PixFcSSE *, void *, void *);
+void		convert_rgb24_to_uyvy_bt601_neon(const struct PixFcSSE *, void *, void *);
+void		downsample_n_convert_rgb24_to_uyvy_bt709_neon(const struct PixFcSSE *, void *, void *);
+void		convert_rgb24_to_uyvy_bt709_neon(const struct PixFcSSE *, void *, void *);
+
+// RGB24 to YUV422P		NEON
+void		downsample_n_convert_rgb24_to_yuv422p_neon(const struct PixFcSSE *, void *, void *);
+void		convert_rgb24_to_yuv422p_neon(const struct PixFcSSE *, void *, void *);
+void		downsample_n_convert_rgb24_to_yuv422p_bt601_neon(const struct PixFcSSE *, void *, void *);
+void		convert_rgb24_to_yuv422p_bt601_neon(const struct PixFcSSE *, void *, void *);
+void		downsample_n_convert_rgb24_to_yuv422p_bt709_neon(const struct PixFcSSE *, void *, void *);
+void		convert_rgb24_to_yuv422p_bt709_neon(const struct PixFcSSE *, void *, void *);
+
+// RGB24 to YUV420P		NEON
+void		downsample_n_convert_rgb24_to_yuv420p_neon(const struct PixFcSSE *, void *, void *);
+void		convert_rgb24_to_yuv420p_neon(const struct PixFcSSE *, void *, void *);
+void		downsample_n_convert_rgb24_to_yuv420p_bt601_neon(const struct PixFcSSE *, void *, void *);
+void		convert_rgb24_to_yuv420p_bt601_neon(const struct PixFcSSE *, void *, void *);
+void		downsample_n_convert_rgb24_to_yuv420p_bt709_neon(const struct PixFcSSE *, void *, void *);
+void		convert_rgb24_to_yuv420p_bt709_neon(const struct PixFcSSE *, void *, void *);
+
+// RGB24 to NV12		NEON
+void		downsample_n_convert_rgb24_to_nv12_neon(const struct PixFcSSE *, void *, void *);
+void		convert_rgb24_to_nv12_neon(const struct PixFcSSE *, void *, void *);
+void		downsample_n_convert_rgb24_to_nv12_bt601_neon(const struct PixFcSSE *, void *, void *);
+void		convert_rgb24_to_nv12_bt601_neon(const struct PixFcSSE *, void *, void *);
+void		downsample_n_convert_rgb24_to_nv12_bt709_neon(const struct PixFcSSE *, void *, void *);
+void		convert_rgb24_to_nv12_bt709_neon(const struct PixFcSSE *, void *, void *);
+
+// RGB24 to NV21		NEON
+void		downsample_n_convert_rgb24_to_nv21_neon(const struct PixFcSSE *, void *, void *);
+void		convert_rgb24_to_nv21_neon(const struct PixFcSSE *, void *, void *);
+void		downsample_n_convert_rgb24_to_nv21_bt601_neon(const struct PixFcSSE *, void *, void *);
+void		convert_rgb24_to_nv21_bt601_neon(const struct PixFcSSE *, void *, void *);
+void		downsample_n_convert_rgb24_to_nv21_bt709_neon(const struct PixFcSSE *, void *, void *);
+void		convert_rgb24_to_nv21_bt709_neon(const struct PixFcSSE *, void *, void *);
+
+
 #endif /* CONVERSION_ROUTINES_FROM_RGB24_H_ */
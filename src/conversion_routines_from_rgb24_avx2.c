@@ -0,0 +1,130 @@
+/*
+ * conversion_routines_from_rgb24_avx2.c
+ *
+ * Copyright (C) 2011 PixFC Team (pixelfc@gmail.com)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public  License as published by the
+ * Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "common.h"
+#include "pixfc-sse.h"
+#include "rgb_conversion_recipes_avx2.h"
+
+/*
+ * Each macro below defines the full range, bt.601 and bt.709 versions of
+ * a conversion routine.
+ */
+#define DEFINE_RGB_TO_YUV_AVX2(fn_name_prefix, recipe, downsample_first_fn, downsample_fn, y_conv_fn_prefix, uv_conv_fn_prefix, ...)\
+	void		fn_name_prefix##_avx2(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {\
+		recipe(unpack_rgb24_to_rgb_pixel_vectors_avx2, downsample_first_fn, downsample_fn, y_conv_fn_prefix##avx2, uv_conv_fn_prefix##avx2, __VA_ARGS__);\
+	}\
+	void		fn_name_prefix##_bt601_avx2(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {\
+		recipe(unpack_rgb24_to_rgb_pixel_vectors_avx2, downsample_first_fn, downsample_fn, y_conv_fn_prefix##bt601_avx2, uv_conv_fn_prefix##bt601_avx2, __VA_ARGS__);\
+	}\
+	void		fn_name_prefix##_bt709_avx2(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {\
+		recipe(unpack_rgb24_to_rgb_pixel_vectors_avx2, downsample_first_fn, downsample_fn, y_conv_fn_prefix##bt709_avx2, uv_conv_fn_prefix##bt709_avx2, __VA_ARGS__);\
+	}
+
+#define DEFINE_CONVERT_TO_YUV422_AVX2(fn_name_prefix, recipe, ...)\
+	DEFINE_RGB_TO_YUV_AVX2(fn_name_prefix, recipe, NNB_422_DOWNSAMPLE_AVX2, NNB_422_DOWNSAMPLE_AVX2, convert_rgb_pixel_vectors_to_y_vector_, convert_downsampled_422_rgb_pixel_vectors_to_uv_vector_, __VA_ARGS__)
+
+#define DEFINE_DOWNSAMPLE_N_CONVERT_TO_YUV422_AVX2(fn_name_prefix, recipe, ...)\
+	DEFINE_RGB_TO_YUV_AVX2(fn_name_prefix, recipe, AVG_422_DOWNSAMPLE_FIRST_AVX2, AVG_422_DOWNSAMPLE_AVX2, convert_rgb_pixel_vectors_to_y_vector_, convert_downsampled_422_rgb_pixel_vectors_to_uv_vector_, __VA_ARGS__)
+
+#define DEFINE_CONVERT_TO_V210_AVX2(fn_name_prefix)\
+	DEFINE_RGB_TO_YUV_AVX2(fn_name_prefix, RGB_TO_V210_RECIPE_AVX2, NNB_422_DOWNSAMPLE_AVX2, NNB_422_DOWNSAMPLE_AVX2, convert_rgb_pixel_vectors_to_10bit_y_vector_, convert_downsampled_422_rgb_pixel_vectors_to_10bit_uv_vector_, 3)
+
+#define DEFINE_DOWNSAMPLE_N_CONVERT_TO_V210_AVX2(fn_name_prefix)\
+	DEFINE_RGB_TO_YUV_AVX2(fn_name_prefix, RGB_TO_V210_RECIPE_AVX2, AVG_422_DOWNSAMPLE_FIRST_AVX2, AVG_422_DOWNSAMPLE_AVX2, convert_rgb_pixel_vectors_to_10bit_y_vector_, convert_downsampled_422_rgb_pixel_vectors_to_10bit_uv_vector_, 3)
+
+/*
+ *
+ * 		R G B   2 4
+ *
+ * 		to
+ *
+ * 		Y U Y V
+ */
+DEFINE_DOWNSAMPLE_N_CONVERT_TO_YUV422_AVX2(downsample_n_convert_rgb24_to_yuyv, RGB_TO_YUV422I_RECIPE_AVX2, pack_y_uv_vectors_to_yuyv_avx2, 3)
+DEFINE_CONVERT_TO_YUV422_AVX2(convert_rgb24_to_yuyv, RGB_TO_YUV422I_RECIPE_AVX2, pack_y_uv_vectors_to_yuyv_avx2, 3)
+
+/*
+ *
+ * 		R G B   2 4
+ *
+ * 		to
+ *
+ * 		U Y V Y
+ */
+DEFINE_DOWNSAMPLE_N_CONVERT_TO_YUV422_AVX2(downsample_n_convert_rgb24_to_uyvy, RGB_TO_YUV422I_RECIPE_AVX2, pack_y_uv_vectors_to_uyvy_avx2, 3)
+DEFINE_CONVERT_TO_YUV422_AVX2(convert_rgb24_to_uyvy, RGB_TO_YUV422I_RECIPE_AVX2, pack_y_uv_vectors_to_uyvy_avx2, 3)
+
+/*
+ *
+ * 		R G B   2 4
+ *
+ * 		to
+ *
+ * 		Y U V 4 2 2 P
+ */
+DEFINE_DOWNSAMPLE_N_CONVERT_TO_YUV422_AVX2(downsample_n_convert_rgb24_to_yuv422p, RGB_TO_YUV422P_RECIPE_AVX2, 3)
+DEFINE_CONVERT_TO_YUV422_AVX2(convert_rgb24_to_yuv422p, RGB_TO_YUV422P_RECIPE_AVX2, 3)
+
+/*
+ *
+ * 		R G B   2 4
+ *
+ * 		to
+ *
+ * 		V 2 1 0
+ */
+DEFINE_DOWNSAMPLE_N_CONVERT_TO_V210_AVX2(downsample_n_convert_rgb24_to_v210)
+DEFINE_CONVERT_TO_V210_AVX2(convert_rgb24_to_v210)
+
+/*
+ *
+ * 		R G B   2 4
+ *
+ * 		to
+ *
+ * 		A R G B
+ */
+void		convert_rgb24_to_argb_avx2(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
+	RGB_TO_ARGB_RECIPE_AVX2(load_16_rgb24_pixels_avx2, 3, -1, 0, 1, 2);
+}
+
+/*
+ *
+ * 		R G B   2 4
+ *
+ * 		to
+ *
+ * 		B G R A
+ */
+void		convert_rgb24_to_bgra_avx2(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
+	RGB_TO_BGRA_RECIPE_AVX2(load_16_rgb24_pixels_avx2, 3, -1, 0, 1, 2);
+}
+
+/*
+ *
+ * 		R G B   2 4
+ *
+ * 		to
+ *
+ * 		B G R   2 4
+ */
+void		convert_rgb24_to_bgr24_avx2(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
+	RGB_TO_BGR24_RECIPE_AVX2(load_16_rgb24_pixels_avx2, 3, 0, 1, 2);
+}
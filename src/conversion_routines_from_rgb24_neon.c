@@ -0,0 +1,116 @@
+/*
+ * conversion_routines_from_rgb24_neon.c
+ *
+ * Copyright (C) 2011 PixFC Team (pixelfc@gmail.com)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public  License as published by the
+ * Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "common.h"
+#include "pixfc-sse.h"
+#include "rgb_conversion_recipes_neon.h"
+
+/*
+ * Each macro below defines the full range, bt.601 and bt.709 versions of
+ * a conversion routine.
+ */
+#define DEFINE_RGB_TO_YUV_NEON(fn_name_prefix, recipe, downsample_first_fn, downsample_fn, ...)\
+	void		fn_name_prefix##_neon(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {\
+		recipe(unpack_rgb24_to_rgb_vectors_neon, downsample_first_fn, downsample_fn, convert_rgb_vectors_to_y_vector_neon, convert_downsampled_rgb_vectors_to_uv_vectors_neon, __VA_ARGS__);\
+	}\
+	void		fn_name_prefix##_bt601_neon(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {\
+		recipe(unpack_rgb24_to_rgb_vectors_neon, downsample_first_fn, downsample_fn, convert_rgb_vectors_to_y_vector_bt601_neon, convert_downsampled_rgb_vectors_to_uv_vectors_bt601_neon, __VA_ARGS__);\
+	}\
+	void		fn_name_prefix##_bt709_neon(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {\
+		recipe(unpack_rgb24_to_rgb_vectors_neon, downsample_first_fn, downsample_fn, convert_rgb_vectors_to_y_vector_bt709_neon, convert_downsampled_rgb_vectors_to_uv_vectors_bt709_neon, __VA_ARGS__);\
+	}
+
+#define DEFINE_CONVERT_TO_YUV422_NEON(fn_name_prefix, recipe, ...)\
+	DEFINE_RGB_TO_YUV_NEON(fn_name_prefix, recipe, NNB_422_DOWNSAMPLE_NEON, NNB_422_DOWNSAMPLE_NEON, __VA_ARGS__)
+
+#define DEFINE_DOWNSAMPLE_N_CONVERT_TO_YUV422_NEON(fn_name_prefix, recipe, ...)\
+	DEFINE_RGB_TO_YUV_NEON(fn_name_prefix, recipe, AVG_422_DOWNSAMPLE_FIRST_NEON, AVG_422_DOWNSAMPLE_NEON, __VA_ARGS__)
+
+#define DEFINE_CONVERT_TO_YUV420_NEON(fn_name_prefix, pack_uv_fn)\
+	DEFINE_RGB_TO_YUV_NEON(fn_name_prefix, RGB_TO_YUV420_RECIPE_NEON, NNB_420_DOWNSAMPLE_NEON, NNB_420_DOWNSAMPLE_NEON, pack_uv_fn, 3)
+
+#define DEFINE_DOWNSAMPLE_N_CONVERT_TO_YUV420_NEON(fn_name_prefix, pack_uv_fn)\
+	DEFINE_RGB_TO_YUV_NEON(fn_name_prefix, RGB_TO_YUV420_RECIPE_NEON, AVG_420_DOWNSAMPLE_FIRST_NEON, AVG_420_DOWNSAMPLE_NEON, pack_uv_fn, 3)
+
+/*
+ *
+ * 		R G B   2 4
+ *
+ * 		to
+ *
+ * 		Y U Y V
+ */
+DEFINE_DOWNSAMPLE_N_CONVERT_TO_YUV422_NEON(downsample_n_convert_rgb24_to_yuyv, RGB_TO_YUV422I_RECIPE_NEON, pack_y_uv_vectors_to_yuyv_neon, 3)
+DEFINE_CONVERT_TO_YUV422_NEON(convert_rgb24_to_yuyv, RGB_TO_YUV422I_RECIPE_NEON, pack_y_uv_vectors_to_yuyv_neon, 3)
+
+/*
+ *
+ * 		R G B   2 4
+ *
+ * 		to
+ *
+ * 		U Y V Y
+ */
+DEFINE_DOWNSAMPLE_N_CONVERT_TO_YUV422_NEON(downsample_n_convert_rgb24_to_uyvy, RGB_TO_YUV422I_RECIPE_NEON, pack_y_uv_vectors_to_uyvy_neon, 3)
+DEFINE_CONVERT_TO_YUV422_NEON(convert_rgb24_to_uyvy, RGB_TO_YUV422I_RECIPE_NEON, pack_y_uv_vectors_to_uyvy_neon, 3)
+
+/*
+ *
+ * 		R G B   2 4
+ *
+ * 		to
+ *
+ * 		Y U V 4 2 2 P
+ */
+DEFINE_DOWNSAMPLE_N_CONVERT_TO_YUV422_NEON(downsample_n_convert_rgb24_to_yuv422p, RGB_TO_YUV422P_RECIPE_NEON, 3)
+DEFINE_CONVERT_TO_YUV422_NEON(convert_rgb24_to_yuv422p, RGB_TO_YUV422P_RECIPE_NEON, 3)
+
+/*
+ *
+ * 		R G B   2 4
+ *
+ * 		to
+ *
+ * 		Y U V 4 2 0 P
+ */
+DEFINE_DOWNSAMPLE_N_CONVERT_TO_YUV420_NEON(downsample_n_convert_rgb24_to_yuv420p, PACK_UV_VECTORS_TO_YUV420P_NEON)
+DEFINE_CONVERT_TO_YUV420_NEON(convert_rgb24_to_yuv420p, PACK_UV_VECTORS_TO_YUV420P_NEON)
+
+/*
+ *
+ * 		R G B   2 4
+ *
+ * 		to
+ *
+ * 		N V 1 2
+ */
+DEFINE_DOWNSAMPLE_N_CONVERT_TO_YUV420_NEON(downsample_n_convert_rgb24_to_nv12, PACK_UV_VECTORS_TO_NV12_NEON)
+DEFINE_CONVERT_TO_YUV420_NEON(convert_rgb24_to_nv12, PACK_UV_VECTORS_TO_NV12_NEON)
+
+/*
+ *
+ * 		R G B   2 4
+ *
+ * 		to
+ *
+ * 		N V 2 1
+ */
+DEFINE_DOWNSAMPLE_N_CONVERT_TO_YUV420_NEON(downsample_n_convert_rgb24_to_nv21, PACK_UV_VECTORS_TO_NV21_NEON)
+DEFINE_CONVERT_TO_YUV420_NEON(convert_rgb24_to_nv21, PACK_UV_VECTORS_TO_NV21_NEON)
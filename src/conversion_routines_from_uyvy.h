@@ -26,30 +26,38 @@
 // UYVY to ARGB			SSE2 SSSE3
 void		upsample_n_convert_uyvy_to_argb_sse2_ssse3(const struct PixFcSSE *, void*, void*);
 void		convert_uyvy_to_argb_sse2_ssse3(const struct PixFcSSE *, void*, void*);
+void		downscale_n_convert_uyvy_to_argb_sse2_ssse3(const struct PixFcSSE *, void *, void *);
 // UYVY to ARGB			SSE2
 void		upsample_n_convert_uyvy_to_argb_sse2(const struct PixFcSSE *, void*, void*);
 void		convert_uyvy_to_argb_sse2(const struct PixFcSSE *, void*, void*);
+void		downscale_n_convert_uyvy_to_argb_sse2(const struct PixFcSSE *, void *, void *);
 
 // UYVY to BGRA			SSE2 SSSE3
 void		upsample_n_convert_uyvy_to_bgra_sse2_ssse3(const struct PixFcSSE *, void*, void*);
 void		convert_uyvy_to_bgra_sse2_ssse3(const struct PixFcSSE *, void*, void*);
+void		downscale_n_convert_uyvy_to_bgra_sse2_ssse3(const struct PixFcSSE *, void *, void *);
 // UYVY to BGRA			SSE2
 void		upsample_n_convert_uyvy_to_bgra_sse2(const struct PixFcSSE *, void*, void*);
 void		convert_uyvy_to_bgra_sse2(const struct PixFcSSE *, void*, void*);
+void		downscale_n_convert_uyvy_to_bgra_sse2(const struct PixFcSSE *, void *, void *);
 
 // UYVY to RGB24		SSE2 SSSE3
 void		upsample_n_convert_uyvy_to_rgb24_sse2_ssse3(const struct PixFcSSE *, void *, void *);
 void		convert_uyvy_to_rgb24_sse2_ssse3(const struct PixFcSSE *, void *, void *);
+void		downscale_n_convert_uyvy_to_rgb24_sse2_ssse3(const struct PixFcSSE *, void *, void *);
 // UYVY to RGB24		SSE2 slow repacking
 void		upsample_n_convert_uyvy_to_rgb24_sse2(const struct PixFcSSE *, void *, void *);
 void		convert_uyvy_to_rgb24_sse2(const struct PixFcSSE *, void *, void *);
+void		downscale_n_convert_uyvy_to_rgb24_sse2(const struct PixFcSSE *, void *, void *);
 
 // UYVY to BGR24		SSE2 SSSE3
 void		upsample_n_convert_uyvy_to_bgr24_sse2_ssse3(const struct PixFcSSE *, void *, void *);
 void		convert_uyvy_to_bgr24_sse2_ssse3(const struct PixFcSSE *, void *, void *);
+void		downscale_n_convert_uyvy_to_bgr24_sse2_ssse3(const struct PixFcSSE *, void *, void *);
 // UYVY to BGR24		SSE2 slow repacking
 void		upsample_n_convert_uyvy_to_bgr24_sse2(const struct PixFcSSE *, void *, void *);
 void		convert_uyvy_to_bgr24_sse2(const struct PixFcSSE *, void *, void *);
+void		downscale_n_convert_uyvy_to_bgr24_sse2(const struct PixFcSSE *, void *, void *);
 
 // UYVY to r210			SSE2 SSSE3
 void		upsample_n_convert_uyvy_to_r210_sse2_ssse3(const struct PixFcSSE *, void *, void *);
@@ -63,6 +71,7 @@ void		convert_uyvy_to_r10k_sse2_ssse3(const struct PixFcSSE *, void *, void *);
 // YUV422i to anyRGB		NON SSE
 void 		convert_yuv422i_to_any_rgb_nonsse(const struct PixFcSSE* conv, void* in, void* out);
 void		upsample_n_convert_yuv422i_to_any_rgb_nonsse(const struct PixFcSSE*, void*, void*);
+void		downscale_n_convert_yuv422i_to_any_rgb_nonsse(const struct PixFcSSE*, void*, void*);
 void 		convert_yuv422i_to_any_10bit_rgb_nonsse(const struct PixFcSSE*, void*, void*);
 void		upsample_n_convert_yuv422i_to_any_10bit_rgb_nonsse(const struct PixFcSSE*, void*, void*);
 
@@ -83,30 +92,38 @@ void		upsample_n_convert_yuv422i_to_any_10bit_rgb_nonsse(const struct PixFcSSE*,
 // UYVY to ARGB			SSE2 SSSE3
 void		upsample_n_convert_uyvy_to_argb_bt601_sse2_ssse3(const struct PixFcSSE *, void*, void*);
 void		convert_uyvy_to_argb_bt601_sse2_ssse3(const struct PixFcSSE *, void*, void*);
+void		downscale_n_convert_uyvy_to_argb_bt601_sse2_ssse3(const struct PixFcSSE *, void *, void *);
 // UYVY to ARGB			SSE2
 void		upsample_n_convert_uyvy_to_argb_bt601_sse2(const struct PixFcSSE *, void*, void*);
 void		convert_uyvy_to_argb_bt601_sse2(const struct PixFcSSE *, void*, void*);
+void		downscale_n_convert_uyvy_to_argb_bt601_sse2(const struct PixFcSSE *, void *, void *);
 
 // UYVY to BGRA			SSE2 SSSE3
 void		upsample_n_convert_uyvy_to_bgra_bt601_sse2_ssse3(const struct PixFcSSE *, void*, void*);
 void		convert_uyvy_to_bgra_bt601_sse2_ssse3(const struct PixFcSSE *, void*, void*);
+void		downscale_n_convert_uyvy_to_bgra_bt601_sse2_ssse3(const struct PixFcSSE *, void *, void *);
 // UYVY to BGRA			SSE2
 void		upsample_n_convert_uyvy_to_bgra_bt601_sse2(const struct PixFcSSE *, void*, void*);
 void		convert_uyvy_to_bgra_bt601_sse2(const struct PixFcSSE *, void*, void*);
+void		downscale_n_convert_uyvy_to_bgra_bt601_sse2(const struct PixFcSSE *, void *, void *);
 
 // UYVY to RGB24		SSE2 SSSE3
 void		upsample_n_convert_uyvy_to_rgb24_bt601_sse2_ssse3(const struct PixFcSSE *, void *, void *);
 void		convert_uyvy_to_rgb24_bt601_sse2_ssse3(const struct PixFcSSE *, void *, void *);
+void		downscale_n_convert_uyvy_to_rgb24_bt601_sse2_ssse3(const struct PixFcSSE *, void *, void *);
 // UYVY to RGB24		SSE2 slow repacking
 void		upsample_n_convert_uyvy_to_rgb24_bt601_sse2(const struct PixFcSSE *, void *, void *);
 void		convert_uyvy_to_rgb24_bt601_sse2(const struct PixFcSSE *, void *, void *);
+void		downscale_n_convert_uyvy_to_rgb24_bt601_sse2(const struct PixFcSSE *, void *, void *);
 
 // UYVY to BGR24		SSE2 SSSE3
 void		upsample_n_convert_uyvy_to_bgr24_bt601_sse2_ssse3(const struct PixFcSSE *, void *, void *);
 void		convert_uyvy_to_bgr24_bt601_sse2_ssse3(const struct PixFcSSE *, void *, void *);
+void		downscale_n_convert_uyvy_to_bgr24_bt601_sse2_ssse3(const struct PixFcSSE *, void *, void *);
 // UYVY to BGR24		SSE2 slow repacking
 void		upsample_n_convert_uyvy_to_bgr24_bt601_sse2(const struct PixFcSSE *, void *, void *);
 void		convert_uyvy_to_bgr24_bt601_sse2(const struct PixFcSSE *, void *, void *);
+void		downscale_n_convert_uyvy_to_bgr24_bt601_sse2(const struct PixFcSSE *, void *, void *);
 
 // YUYV to r210			SSE2 SSSE3
 void		upsample_n_convert_uyvy_to_r210_bt601_sse2_ssse3(const struct PixFcSSE *, void *, void *);
@@ -120,6 +137,7 @@ void		convert_uyvy_to_r10k_bt601_sse2_ssse3(const struct PixFcSSE *, void *, voi
 // YUV422i to anyRGB		NON SSE
 void 		convert_yuv422i_to_any_rgb_bt601_nonsse(const struct PixFcSSE* conv, void* in, void* out);
 void		upsample_n_convert_yuv422i_to_any_rgb_bt601_nonsse(const struct PixFcSSE*, void*, void*);
+void		downscale_n_convert_yuv422i_to_any_rgb_bt601_nonsse(const struct PixFcSSE*, void*, void*);
 void 		convert_yuv422i_to_any_10bit_rgb_bt601_nonsse(const struct PixFcSSE*, void*, void*);
 void		upsample_n_convert_yuv422i_to_any_10bit_rgb_bt601_nonsse(const struct PixFcSSE*, void*, void*);
 
@@ -140,30 +158,38 @@ void		upsample_n_convert_yuv422i_to_any_10bit_rgb_bt601_nonsse(const struct PixF
 // UYVY to ARGB			SSE2 SSSE3
 void		upsample_n_convert_uyvy_to_argb_bt709_sse2_ssse3(const struct PixFcSSE *, void*, void*);
 void		convert_uyvy_to_argb_bt709_sse2_ssse3(const struct PixFcSSE *, void*, void*);
+void		downscale_n_convert_uyvy_to_argb_bt709_sse2_ssse3(const struct PixFcSSE *, void *, void *);
 // UYVY to ARGB			SSE2
 void		upsample_n_convert_uyvy_to_argb_bt709_sse2(const struct PixFcSSE *, void*, void*);
 void		convert_uyvy_to_argb_bt709_sse2(const struct PixFcSSE *, void*, void*);
+void		downscale_n_convert_uyvy_to_argb_bt709_sse2(const struct PixFcSSE *, void *, void *);
 
 // UYVY to BGRA			SSE2 SSSE3
 void		upsample_n_convert_uyvy_to_bgra_bt709_sse2_ssse3(const struct PixFcSSE *, void*, void*);
 void		convert_uyvy_to_bgra_bt709_sse2_ssse3(const struct PixFcSSE *, void*, void*);
+void		downscale_n_convert_uyvy_to_bgra_bt709_sse2_ssse3(const struct PixFcSSE *, void *, void *);
 // UYVY to BGRA			SSE2
 void		upsample_n_convert_uyvy_to_bgra_bt709_sse2(const struct PixFcSSE *, void*, void*);
 void		convert_uyvy_to_bgra_bt709_sse2(const struct PixFcSSE *, void*, void*);
+void		downscale_n_convert_uyvy_to_bgra_bt709_sse2(const struct PixFcSSE *, void *, void *);
 
 // UYVY to RGB24		SSE2 SSSE3
 void		upsample_n_convert_uyvy_to_rgb24_bt709_sse2_ssse3(const struct PixFcSSE *, void *, void *);
 void		convert_uyvy_to_rgb24_bt709_sse2_ssse3(const struct PixFcSSE *, void *, void *);
+void		downscale_n_convert_uyvy_to_rgb24_bt709_sse2_ssse3(const struct PixFcSSE *, void *, void *);
 // UYVY to RGB24		SSE2 slow repacking
 void		upsample_n_convert_uyvy_to_rgb24_bt709_sse2(const struct PixFcSSE *, void *, void *);
 void		convert_uyvy_to_rgb24_bt709_sse2(const struct PixFcSSE *, void *, void *);
+void		downscale_n_convert_uyvy_to_rgb24_bt709_sse2(const struct PixFcSSE *, void *, void *);
 
 // UYVY to BGR24		SSE2 SSSE3
 void		upsample_n_convert_uyvy_to_bgr24_bt709_sse2_ssse3(const struct PixFcSSE *, void *, void *);
 void		convert_uyvy_to_bgr24_bt709_sse2_ssse3(const struct PixFcSSE *, void *, void *);
+void		downscale_n_convert_uyvy_to_bgr24_bt709_sse2_ssse3(const struct PixFcSSE *, void *, void *);
 // UYVY to BGR24		SSE2 slow repacking
 void		upsample_n_convert_uyvy_to_bgr24_bt709_sse2(const struct PixFcSSE *, void *, void *);
 void		convert_uyvy_to_bgr24_bt709_sse2(const struct PixFcSSE *, void *, void *);
+void		downscale_n_convert_uyvy_to_bgr24_bt709_sse2(const struct PixFcSSE *, void *, void *);
 
 // YUYV to r210			SSE2 SSSE3
 void		upsample_n_convert_uyvy_to_r210_bt709_sse2_ssse3(const struct PixFcSSE *, void *, void *);
@@ -176,6 +202,7 @@ void		convert_uyvy_to_r10k_bt709_sse2_ssse3(const struct PixFcSSE *, void *, voi
 // YUV422i to anyRGB		NON SSE
 void 		convert_yuv422i_to_any_rgb_bt709_nonsse(const struct PixFcSSE* conv, void* in, void* out);
 void		upsample_n_convert_yuv422i_to_any_rgb_bt709_nonsse(const struct PixFcSSE*, void*, void*);
+void		downscale_n_convert_yuv422i_to_any_rgb_bt709_nonsse(const struct PixFcSSE*, void*, void*);
 void 		convert_yuv422i_to_any_10bit_rgb_bt709_nonsse(const struct PixFcSSE*, void*, void*);
 void		upsample_n_convert_yuv422i_to_any_10bit_rgb_bt709_nonsse(const struct PixFcSSE*, void*, void*);
 
@@ -192,6 +219,43 @@ void		convert_uyvy_to_yuv422p_sse2_ssse3(const struct PixFcSSE*, void*, void*);
 void		convert_yuv422i_to_yuv422p_nonsse(const struct PixFcSSE*, void*, void*);
 
 
+/*
+ *  	U Y V Y
+ *
+ * 		T O
+ *
+ * 		N V 1 2  /  N V 2 1
+ */
+void		convert_uyvy_to_nv12_sse2(const struct PixFcSSE*, void*, void*);
+void		convert_uyvy_to_nv21_sse2(const struct PixFcSSE*, void*, void*);
+void		convert_yuv422i_to_nv12_nonsse(const struct PixFcSSE*, void*, void*);
+
+
+/*
+ *  	U Y V Y
+ *
+ * 		T O
+ *
+ * 		Y U V 4 2 0 P
+ */
+void		convert_uyvy_to_yuv420p_sse2(const struct PixFcSSE*, void*, void*);
+void		downsample_n_convert_uyvy_to_yuv420p_sse2(const struct PixFcSSE*, void*, void*);
+void		convert_yuv422i_to_yuv420p_nonsse(const struct PixFcSSE*, void*, void*);
+void		downsample_n_convert_yuv422i_to_yuv420p_nonsse(const struct PixFcSSE*, void*, void*);
+
+
+/*
+ *  	U Y V Y
+ *
+ * 		T O
+ *
+ * 		Y U Y V
+ */
+void		convert_uyvy_to_yuyv_sse2(const struct PixFcSSE*, void*, void*);
+void		convert_uyvy_to_yuyv_sse2_ssse3(const struct PixFcSSE*, void*, void*);
+void		convert_yuv422i_to_yuv422i_nonsse(const struct PixFcSSE*, void*, void*);
+
+
 /*
  *
  *		U Y V Y
@@ -208,5 +272,67 @@ void		convert_uyvy_to_v210_sse2_ssse3(const struct PixFcSSE* , void* , void*);
 
 void		convert_yuv422i_to_v210_nonsse(const struct PixFcSSE* , void* , void*);
 
+/*
+ *
+ *
+ *	A V X 2
+ *
+ *  C O N V E R S I O N S
+ *
+ *
+ */
+// UYVY to ARGB		AVX2
+void		upsample_n_convert_uyvy_to_argb_avx2(const struct PixFcSSE *, void *, void *);
+void		convert_uyvy_to_argb_avx2(const struct PixFcSSE *, void *, void *);
+void		upsample_n_convert_uyvy_to_argb_bt601_avx2(const struct PixFcSSE *, void *, void *);
+void		convert_uyvy_to_argb_bt601_avx2(const struct PixFcSSE *, void *, void *);
+void		upsample_n_convert_uyvy_to_argb_bt709_avx2(const struct PixFcSSE *, void *, void *);
+void		convert_uyvy_to_argb_bt709_avx2(const struct PixFcSSE *, void *, void *);
+
+// UYVY to BGRA		AVX2
+void		upsample_n_convert_uyvy_to_bgra_avx2(const struct PixFcSSE *, void *, void *);
+void		convert_uyvy_to_bgra_avx2(const struct PixFcSSE *, void *, void *);
+void		upsample_n_convert_uyvy_to_bgra_bt601_avx2(const struct PixFcSSE *, void *, void *);
+void		convert_uyvy_to_bgra_bt601_avx2(const struct PixFcSSE *, void *, void *);
+void		upsample_n_convert_uyvy_to_bgra_bt709_avx2(const struct PixFcSSE *, void *, void *);
+void		convert_uyvy_to_bgra_bt709_avx2(const struct PixFcSSE *, void *, void *);
+
+// UYVY to RGB24		AVX2
+void		upsample_n_convert_uyvy_to_rgb24_avx2(const struct PixFcSSE *, void *, void *);
+void		convert_uyvy_to_rgb24_avx2(const struct PixFcSSE *, void *, void *);
+void		upsample_n_convert_uyvy_to_rgb24_bt601_avx2(const struct PixFcSSE *, void *, void *);
+void		convert_uyvy_to_rgb24_bt601_avx2(const struct PixFcSSE *, void *, void *);
+void		upsample_n_convert_uyvy_to_rgb24_bt709_avx2(const struct PixFcSSE *, void *, void *);
+void		convert_uyvy_to_rgb24_bt709_avx2(const struct PixFcSSE *, void *, void *);
+
+// UYVY to BGR24		AVX2
+void		upsample_n_convert_uyvy_to_bgr24_avx2(const struct PixFcSSE *, void *, void *);
+void		convert_uyvy_to_bgr24_avx2(const struct PixFcSSE *, void *, void *);
+void		upsample_n_convert_uyvy_to_bgr24_bt601_avx2(const struct PixFcSSE *, void *, void *);
+void		convert_uyvy_to_bgr24_bt601_avx2(const struct PixFcSSE *, void *, void *);
+void		upsample_n_convert_uyvy_to_bgr24_bt709_avx2(const struct PixFcSSE *, void *, void *);
+void		convert_uyvy_to_bgr24_bt709_avx2(const struct PixFcSSE *, void *, void *);
+
+// UYVY to YUYV		AVX2
+void		convert_uyvy_to_yuyv_avx2(const struct PixFcSSE *, void *, void *);
+
+
+/*
+ *
+ *
+ *	A V X - 5 1 2
+ *
+ *  C O N V E R S I O N S
+ *
+ *
+ */
+// UYVY to v210		AVX-512
+void		convert_uyvy_to_v210_avx512(const struct PixFcSSE *, void *, void *);
+
+// UYVY to YUV420P		NEON
+void		downsample_n_convert_uyvy_to_yuv420p_neon(const struct PixFcSSE *, void *, void *);
+void		convert_uyvy_to_yuv420p_neon(const struct PixFcSSE *, void *, void *);
+
+
 #endif 		// CONVERSION_ROUTINES_FROM_UYVY_H_
 
@@ -0,0 +1,105 @@
+/*
+ * conversion_routines_from_uyvy_avx2.c
+ *
+ * Copyright (C) 2011 PixFC Team (pixelfc@gmail.com)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public  License as published by the
+ * Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "common.h"
+#include "pixfc-sse.h"
+#include "yuv_conversion_recipes_avx2.h"
+
+/*
+ * Each macro below defines the full range, bt.601 and bt.709 versions of
+ * a conversion routine.
+ */
+#define DEFINE_CONVERT_TO_RGB_AVX2(fn_name_prefix, pack_fn, output_stride)\
+	void		fn_name_prefix##_avx2(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {\
+		YUV422I_TO_RGB_RECIPE_AVX2(unpack_uyvy_to_y_u_v_vectors_, convert_y_u_v_vectors_to_rgb_vectors_, pack_fn, output_stride);\
+	}\
+	void		fn_name_prefix##_bt601_avx2(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {\
+		YUV422I_TO_RGB_RECIPE_AVX2(unpack_uyvy_to_y_u_v_vectors_, convert_y_u_v_vectors_to_rgb_vectors_bt601_, pack_fn, output_stride);\
+	}\
+	void		fn_name_prefix##_bt709_avx2(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {\
+		YUV422I_TO_RGB_RECIPE_AVX2(unpack_uyvy_to_y_u_v_vectors_, convert_y_u_v_vectors_to_rgb_vectors_bt709_, pack_fn, output_stride);\
+	}
+
+#define DEFINE_UPSAMPLE_N_CONVERT_TO_RGB_AVX2(fn_name_prefix, pack_fn, output_stride)\
+	void		fn_name_prefix##_avx2(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {\
+		UPSAMPLE_YUV422I_TO_RGB_RECIPE_AVX2(unpack_uyvy_to_y_uv_vectors_, convert_y_u_v_vectors_to_rgb_vectors_, pack_fn, output_stride);\
+	}\
+	void		fn_name_prefix##_bt601_avx2(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {\
+		UPSAMPLE_YUV422I_TO_RGB_RECIPE_AVX2(unpack_uyvy_to_y_uv_vectors_, convert_y_u_v_vectors_to_rgb_vectors_bt601_, pack_fn, output_stride);\
+	}\
+	void		fn_name_prefix##_bt709_avx2(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {\
+		UPSAMPLE_YUV422I_TO_RGB_RECIPE_AVX2(unpack_uyvy_to_y_uv_vectors_, convert_y_u_v_vectors_to_rgb_vectors_bt709_, pack_fn, output_stride);\
+	}
+
+/*
+ *
+ * 		U Y V Y
+ *
+ * 		to
+ *
+ * 		A R G B
+ */
+DEFINE_UPSAMPLE_N_CONVERT_TO_RGB_AVX2(upsample_n_convert_uyvy_to_argb, pack_3_rgb_vectors_to_argb_avx2, 4)
+DEFINE_CONVERT_TO_RGB_AVX2(convert_uyvy_to_argb, pack_3_rgb_vectors_to_argb_avx2, 4)
+
+/*
+ *
+ * 		U Y V Y
+ *
+ * 		to
+ *
+ * 		B G R A
+ */
+DEFINE_UPSAMPLE_N_CONVERT_TO_RGB_AVX2(upsample_n_convert_uyvy_to_bgra, pack_3_rgb_vectors_to_bgra_avx2, 4)
+DEFINE_CONVERT_TO_RGB_AVX2(convert_uyvy_to_bgra, pack_3_rgb_vectors_to_bgra_avx2, 4)
+
+/*
+ *
+ * 		U Y V Y
+ *
+ * 		to
+ *
+ * 		R G B   2 4
+ */
+DEFINE_UPSAMPLE_N_CONVERT_TO_RGB_AVX2(upsample_n_convert_uyvy_to_rgb24, pack_3_rgb_vectors_to_rgb24_avx2, 3)
+DEFINE_CONVERT_TO_RGB_AVX2(convert_uyvy_to_rgb24, pack_3_rgb_vectors_to_rgb24_avx2, 3)
+
+/*
+ *
+ * 		U Y V Y
+ *
+ * 		to
+ *
+ * 		B G R   2 4
+ */
+DEFINE_UPSAMPLE_N_CONVERT_TO_RGB_AVX2(upsample_n_convert_uyvy_to_bgr24, pack_3_rgb_vectors_to_bgr24_avx2, 3)
+DEFINE_CONVERT_TO_RGB_AVX2(convert_uyvy_to_bgr24, pack_3_rgb_vectors_to_bgr24_avx2, 3)
+
+/*
+ *
+ * 		U Y V Y
+ *
+ * 		to
+ *
+ * 		Y U Y V
+ */
+void		convert_uyvy_to_yuyv_avx2(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
+	YUV422I_TO_YUV422I_RECIPE_AVX2(repack_yuv422i_to_yuv422i_avx2);
+}
@@ -42,6 +42,29 @@
 				instr_set\
 		)
 
+#define DOWNSCALE_AND_CONVERT_TO_RGB(pack_fn, output_stride, instr_set)\
+		if (PIXFC_DOWNSCALE_FACTOR(pixfc->flags) == 2) {\
+			DO_CONVERSION_1U_1P(\
+					DOWNSCALE_YUV422I_TO_RGB_RECIPE,\
+					unpack_uyvy_to_y_uv_vectors_,\
+					pack_fn,\
+					convert_y_uv_vectors_to_rgb_vectors_bt601_,\
+					output_stride,\
+					2,\
+					instr_set\
+			)\
+		} else {\
+			DO_CONVERSION_1U_1P(\
+					DOWNSCALE_YUV422I_TO_RGB_RECIPE,\
+					unpack_uyvy_to_y_uv_vectors_,\
+					pack_fn,\
+					convert_y_uv_vectors_to_rgb_vectors_bt601_,\
+					output_stride,\
+					4,\
+					instr_set\
+			)\
+		}
+
 
 #define CONVERT_TO_RGB32(pack_fn, instr_set)\
 		DO_CONVERSION_1U_1P(\
@@ -63,34 +86,6 @@
 				instr_set\
 		)
 
-#define UPSAMPLE_AND_CONVERT_TO_RGB10(pack_fn, instr_set) \
-		DO_CONVERSION_1U_1P(\
-				UPSAMPLE_YUV422I_TO_RGB_RECIPE,\
-				unpack_uyvy_to_y_uv_vectors_,\
-				pack_fn,\
-				convert_8bit_y_uv_vectors_to_10bit_rgb_vectors_bt601_,\
-				4,\
-				instr_set\
-		)
-
-#define CONVERT_TO_RGB10(pack_fn, instr_set)\
-		DO_CONVERSION_1U_1P(\
-				YUV422I_TO_RGB_RECIPE,\
-				unpack_uyvy_to_y_uv_vectors_,\
-				pack_fn,\
-				nnb_upsample_n_convert_8bit_y_uv_vectors_to_10bit_rgb_vectors_bt601_,\
-				4,\
-				instr_set\
-		)
-
-void		upsample_n_convert_uyvy_to_argb_bt601_sse2_ssse3(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
-	UPSAMPLE_AND_CONVERT_TO_RGB32(pack_6_rgb_vectors_in_4_argb_vectors_sse2, sse2_ssse3);
-}
-
-void		convert_uyvy_to_argb_bt601_sse2_ssse3(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
-	CONVERT_TO_RGB32(pack_6_rgb_vectors_in_4_argb_vectors_sse2, sse2_ssse3);
-}
-
 void		upsample_n_convert_uyvy_to_argb_bt601_sse2(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
 	UPSAMPLE_AND_CONVERT_TO_RGB32(pack_6_rgb_vectors_in_4_argb_vectors_sse2, sse2);
 }
@@ -99,16 +94,11 @@ void		convert_uyvy_to_argb_bt601_sse2(const struct PixFcSSE * pixfc, void* sourc
 	CONVERT_TO_RGB32(pack_6_rgb_vectors_in_4_argb_vectors_sse2, sse2);
 }
 
-
-
-
-void		upsample_n_convert_uyvy_to_bgra_bt601_sse2_ssse3(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
-	UPSAMPLE_AND_CONVERT_TO_RGB32(pack_6_rgb_vectors_in_4_bgra_vectors_sse2, sse2_ssse3);
+void		downscale_n_convert_uyvy_to_argb_bt601_sse2(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
+	DOWNSCALE_AND_CONVERT_TO_RGB(pack_6_rgb_vectors_in_4_argb_vectors_sse2, 4, sse2);
 }
 
-void		convert_uyvy_to_bgra_bt601_sse2_ssse3(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
-	CONVERT_TO_RGB32(pack_6_rgb_vectors_in_4_bgra_vectors_sse2, sse2_ssse3);
-}
+
 
 void		upsample_n_convert_uyvy_to_bgra_bt601_sse2(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
 	UPSAMPLE_AND_CONVERT_TO_RGB32(pack_6_rgb_vectors_in_4_bgra_vectors_sse2, sse2);
@@ -118,16 +108,11 @@ void		convert_uyvy_to_bgra_bt601_sse2(const struct PixFcSSE * pixfc, void* sourc
 	CONVERT_TO_RGB32(pack_6_rgb_vectors_in_4_bgra_vectors_sse2, sse2);
 }
 
-
-
-
-void		upsample_n_convert_uyvy_to_rgb24_bt601_sse2_ssse3(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
-	UPSAMPLE_AND_CONVERT_TO_RGB24(pack_6_rgb_vectors_in_3_rgb24_vectors_sse2_ssse3, sse2_ssse3);
+void		downscale_n_convert_uyvy_to_bgra_bt601_sse2(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
+	DOWNSCALE_AND_CONVERT_TO_RGB(pack_6_rgb_vectors_in_4_bgra_vectors_sse2, 4, sse2);
 }
 
-void		convert_uyvy_to_rgb24_bt601_sse2_ssse3(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
-	CONVERT_TO_RGB24(pack_6_rgb_vectors_in_3_rgb24_vectors_sse2_ssse3, sse2_ssse3);
-}
+
 
 void		upsample_n_convert_uyvy_to_rgb24_bt601_sse2(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
 	UPSAMPLE_AND_CONVERT_TO_RGB24(pack_6_rgb_vectors_to_3_rgb24_vectors_sse2_slowpacking, sse2);
@@ -137,15 +122,11 @@ void		convert_uyvy_to_rgb24_bt601_sse2(const struct PixFcSSE * pixfc, void* sour
 	CONVERT_TO_RGB24(pack_6_rgb_vectors_to_3_rgb24_vectors_sse2_slowpacking, sse2);
 }
 
-
-
-void		upsample_n_convert_uyvy_to_bgr24_bt601_sse2_ssse3(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
-	UPSAMPLE_AND_CONVERT_TO_RGB24(pack_6_rgb_vectors_in_3_bgr24_vectors_sse2_ssse3, sse2_ssse3);
+void		downscale_n_convert_uyvy_to_rgb24_bt601_sse2(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
+	DOWNSCALE_AND_CONVERT_TO_RGB(pack_6_rgb_vectors_to_3_rgb24_vectors_sse2_slowpacking, 3, sse2);
 }
 
-void		convert_uyvy_to_bgr24_bt601_sse2_ssse3(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
-	CONVERT_TO_RGB24(pack_6_rgb_vectors_in_3_bgr24_vectors_sse2_ssse3, sse2_ssse3);
-}
+
 
 void		upsample_n_convert_uyvy_to_bgr24_bt601_sse2(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
 	UPSAMPLE_AND_CONVERT_TO_RGB24(pack_6_rgb_vectors_to_3_bgr24_vectors_sse2_slowpacking, sse2);
@@ -155,20 +136,6 @@ void		convert_uyvy_to_bgr24_bt601_sse2(const struct PixFcSSE * pixfc, void* sour
 	CONVERT_TO_RGB24(pack_6_rgb_vectors_to_3_bgr24_vectors_sse2_slowpacking, sse2);
 }
 
-
-
-void		upsample_n_convert_uyvy_to_r210_bt601_sse2_ssse3(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
-	UPSAMPLE_AND_CONVERT_TO_RGB10(pack_6_r_g_b_vectors_to_4_r210_sse2_ssse3, sse2_ssse3);
-}
-
-void		convert_uyvy_to_r210_bt601_sse2_ssse3(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
-	CONVERT_TO_RGB10(pack_6_r_g_b_vectors_to_4_r210_sse2_ssse3, sse2_ssse3);
-}
-
-void		upsample_n_convert_uyvy_to_r10k_bt601_sse2_ssse3(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
-	UPSAMPLE_AND_CONVERT_TO_RGB10(pack_6_r_g_b_vectors_to_4_r10k_sse2_ssse3, sse2_ssse3);
-}
-
-void		convert_uyvy_to_r10k_bt601_sse2_ssse3(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
-	CONVERT_TO_RGB10(pack_6_r_g_b_vectors_to_4_r10k_sse2_ssse3, sse2_ssse3);
+void		downscale_n_convert_uyvy_to_bgr24_bt601_sse2(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
+	DOWNSCALE_AND_CONVERT_TO_RGB(pack_6_rgb_vectors_to_3_bgr24_vectors_sse2_slowpacking, 3, sse2);
 }
@@ -0,0 +1,39 @@
+/*
+ * conversion_routines_from_uyvy_neon.c
+ *
+ * Copyright (C) 2011 PixFC Team (pixelfc@gmail.com)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public  License as published by the
+ * Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "common.h"
+#include "pixfc-sse.h"
+#include "yuv_conversion_recipes_neon.h"
+
+/*
+ *
+ * 		U Y V Y
+ *
+ * 		to
+ *
+ * 		Y U V 4 2 0 P
+ */
+void		downsample_n_convert_uyvy_to_yuv420p_neon(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
+	YUV422I_TO_YUV420P_RECIPE_NEON(unpack_uyvy_to_y_uv_vectors_neon, avg_downsample_uv_vectors_neon);
+}
+
+void		convert_uyvy_to_yuv420p_neon(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
+	YUV422I_TO_YUV420P_RECIPE_NEON(unpack_uyvy_to_y_uv_vectors_neon, nnb_downsample_uv_vectors_neon);
+}
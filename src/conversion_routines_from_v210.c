@@ -42,6 +42,29 @@
 				instr_set\
 		)
 
+#define DOWNSCALE_AND_CONVERT_TO_RGB(pack_fn, output_stride, instr_set)\
+		if (PIXFC_DOWNSCALE_FACTOR(pixfc->flags) == 2) {\
+			DO_CONVERSION_1U_1P(\
+					DOWNSCALE_V210_TO_RGB_RECIPE,\
+					unpack_4v_v210_to_y_uv_vectors_,\
+					pack_fn,\
+					convert_10bit_y_uv_vectors_to_8bit_rgb_vectors_,\
+					output_stride,\
+					2,\
+					instr_set\
+			)\
+		} else {\
+			DO_CONVERSION_1U_1P(\
+					DOWNSCALE_V210_TO_RGB_RECIPE,\
+					unpack_4v_v210_to_y_uv_vectors_,\
+					pack_fn,\
+					convert_10bit_y_uv_vectors_to_8bit_rgb_vectors_,\
+					output_stride,\
+					4,\
+					instr_set\
+			)\
+		}
+
 
 #define UPSAMPLE_AND_CONVERT_TO_R210(pack16_fn, pack8_fn, instr_set)\
 		DO_CONVERSION_1U_2P(\
@@ -95,19 +118,18 @@
  * 		A R G B
  */
 
-void		upsample_n_convert_v210_to_argb_sse2_ssse3_sse41(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
-	 UPSAMPLE_AND_CONVERT_TO_RGB32(pack_6_rgb_vectors_in_4_argb_vectors_sse2, sse2_ssse3_sse41);
-}
-void		convert_v210_to_argb_sse2_ssse3_sse41(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
-	CONVERT_TO_RGB32(pack_6_rgb_vectors_in_4_argb_vectors_sse2,	sse2_ssse3_sse41);
-}
 void		upsample_n_convert_v210_to_argb_sse2_ssse3(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
 	UPSAMPLE_AND_CONVERT_TO_RGB32(pack_6_rgb_vectors_in_4_argb_vectors_sse2, sse2_ssse3);
 }
+
 void		convert_v210_to_argb_sse2_ssse3(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
 	CONVERT_TO_RGB32(pack_6_rgb_vectors_in_4_argb_vectors_sse2, sse2_ssse3);
 }
 
+void		downscale_n_convert_v210_to_argb_sse2_ssse3(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
+	DOWNSCALE_AND_CONVERT_TO_RGB(pack_6_rgb_vectors_in_4_argb_vectors_sse2, 4, sse2_ssse3);
+}
+
 
 /*
  * 		V 2 1 0
@@ -117,14 +139,6 @@ void		convert_v210_to_argb_sse2_ssse3(const struct PixFcSSE * pixfc, void* sourc
  * 		B G R A
  *
  */
-void		upsample_n_convert_v210_to_bgra_sse2_ssse3_sse41(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
-	UPSAMPLE_AND_CONVERT_TO_RGB32(pack_6_rgb_vectors_in_4_bgra_vectors_sse2, sse2_ssse3_sse41);
-}
-
-void		convert_v210_to_bgra_sse2_ssse3_sse41(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
-	CONVERT_TO_RGB32(pack_6_rgb_vectors_in_4_bgra_vectors_sse2,	sse2_ssse3_sse41);
-}
-
 void		upsample_n_convert_v210_to_bgra_sse2_ssse3(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
 	UPSAMPLE_AND_CONVERT_TO_RGB32(pack_6_rgb_vectors_in_4_bgra_vectors_sse2, sse2_ssse3);
 }
@@ -133,6 +147,10 @@ void		convert_v210_to_bgra_sse2_ssse3(const struct PixFcSSE * pixfc, void* sourc
 	CONVERT_TO_RGB32(pack_6_rgb_vectors_in_4_bgra_vectors_sse2,	sse2_ssse3);
 }
 
+void		downscale_n_convert_v210_to_bgra_sse2_ssse3(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
+	DOWNSCALE_AND_CONVERT_TO_RGB(pack_6_rgb_vectors_in_4_bgra_vectors_sse2, 4, sse2_ssse3);
+}
+
 
 /*
  *
@@ -142,14 +160,6 @@ void		convert_v210_to_bgra_sse2_ssse3(const struct PixFcSSE * pixfc, void* sourc
  *
  * 		R G B   2 4
  */
-void		upsample_n_convert_v210_to_rgb24_sse2_ssse3_sse41(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
-	UPSAMPLE_AND_CONVERT_TO_RGB24(pack_6_rgb_vectors_in_3_rgb24_vectors_sse2_ssse3, sse2_ssse3_sse41);
-}
-
-void		convert_v210_to_rgb24_sse2_ssse3_sse41(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
-	CONVERT_TO_RGB24(pack_6_rgb_vectors_in_3_rgb24_vectors_sse2_ssse3, sse2_ssse3_sse41);
-}
-
 void		upsample_n_convert_v210_to_rgb24_sse2_ssse3(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
 	UPSAMPLE_AND_CONVERT_TO_RGB24(pack_6_rgb_vectors_in_3_rgb24_vectors_sse2_ssse3, sse2_ssse3);
 }
@@ -158,6 +168,10 @@ void		convert_v210_to_rgb24_sse2_ssse3(const struct PixFcSSE * pixfc, void* sour
 	CONVERT_TO_RGB24(pack_6_rgb_vectors_in_3_rgb24_vectors_sse2_ssse3, sse2_ssse3);
 }
 
+void		downscale_n_convert_v210_to_rgb24_sse2_ssse3(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
+	DOWNSCALE_AND_CONVERT_TO_RGB(pack_6_rgb_vectors_in_3_rgb24_vectors_sse2_ssse3, 3, sse2_ssse3);
+}
+
 
 /*
  *
@@ -168,14 +182,6 @@ void		convert_v210_to_rgb24_sse2_ssse3(const struct PixFcSSE * pixfc, void* sour
  * 		B G R 2 4
  *
  */
-void		upsample_n_convert_v210_to_bgr24_sse2_ssse3_sse41(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
-	UPSAMPLE_AND_CONVERT_TO_RGB24(pack_6_rgb_vectors_in_3_bgr24_vectors_sse2_ssse3, sse2_ssse3_sse41);
-}
-
-void		convert_v210_to_bgr24_sse2_ssse3_sse41(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
-	CONVERT_TO_RGB24(pack_6_rgb_vectors_in_3_bgr24_vectors_sse2_ssse3, sse2_ssse3_sse41);
-}
-
 void		upsample_n_convert_v210_to_bgr24_sse2_ssse3(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
 	UPSAMPLE_AND_CONVERT_TO_RGB24(pack_6_rgb_vectors_in_3_bgr24_vectors_sse2_ssse3, sse2_ssse3);
 }
@@ -184,6 +190,9 @@ void		convert_v210_to_bgr24_sse2_ssse3(const struct PixFcSSE * pixfc, void* sour
 	CONVERT_TO_RGB24(pack_6_rgb_vectors_in_3_bgr24_vectors_sse2_ssse3, sse2_ssse3);
 }
 
+void		downscale_n_convert_v210_to_bgr24_sse2_ssse3(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
+	DOWNSCALE_AND_CONVERT_TO_RGB(pack_6_rgb_vectors_in_3_bgr24_vectors_sse2_ssse3, 3, sse2_ssse3);
+}
 
 
 
@@ -214,7 +223,6 @@ void		convert_v210_to_r10k_sse2_ssse3(const struct PixFcSSE * pixfc, void* sourc
 
 
 
-
 /*
  *
  *	V 2 1 0
@@ -225,21 +233,45 @@ void		convert_v210_to_r10k_sse2_ssse3(const struct PixFcSSE * pixfc, void* sourc
  *
  *
  */
-// V210 to YUYU
-void		convert_v210_to_yuyv_sse2_ssse3_sse41(const struct PixFcSSE* pixfc, void* source_buffer, void* dest_buffer) {
-	DO_REPACK2(V210_TO_YUV422I_RECIPE, unpack_4v_v210_to_y_uv_vectors_, pack_4_y_uv_422_vectors_in_2_yuyv_vectors_sse2, sse2_ssse3_sse41);
-}
-
 void		convert_v210_to_yuyv_sse2_ssse3(const struct PixFcSSE* pixfc, void* source_buffer, void* dest_buffer) {
 	DO_REPACK2(V210_TO_YUV422I_RECIPE, unpack_4v_v210_to_y_uv_vectors_, pack_4_y_uv_422_vectors_in_2_yuyv_vectors_sse2, sse2_ssse3);
 }
 
-// V210 to UYVY
-void		convert_v210_to_uyvy_sse2_ssse3_sse41(const struct PixFcSSE* pixfc, void* source_buffer, void* dest_buffer) {
-	DO_REPACK2(V210_TO_YUV422I_RECIPE, unpack_4v_v210_to_y_uv_vectors_, pack_4_y_uv_422_vectors_in_2_uyvy_vectors_sse2, sse2_ssse3_sse41);
-}
-
 void		convert_v210_to_uyvy_sse2_ssse3(const struct PixFcSSE* pixfc, void* source_buffer, void* dest_buffer) {
 	DO_REPACK2(V210_TO_YUV422I_RECIPE, unpack_4v_v210_to_y_uv_vectors_, pack_4_y_uv_422_vectors_in_2_uyvy_vectors_sse2, sse2_ssse3);
 }
 
+
+/*
+ *
+ *	V 2 1 0
+ *
+ *	T O
+ *
+ *	Y U V 4 2 2 P
+ *
+ *
+ */
+void		convert_v210_to_yuv422p_sse2_ssse3(const struct PixFcSSE* pixfc, void* source_buffer, void* dest_buffer) {
+	DO_CONVERSION_1U_1P(V210_TO_YUV422P_RECIPE, unpack_4v_v210_to_y_uv_vectors_, pack_4_y_uv_422_vectors_to_yuvp_sse2, sse2_ssse3);
+}
+
+
+
+/*
+ *
+ *	V 2 1 0
+ *
+ *	T O
+ *
+ *	P 2 1 0  /  P 0 1 0
+ *
+ *
+ */
+void		convert_v210_to_p210_sse2_ssse3(const struct PixFcSSE* pixfc, void* source_buffer, void* dest_buffer) {
+	DO_CONVERSION_1U_1P(V210_TO_P210_RECIPE, unpack_4v_v210_to_y_uv_vectors_, pack_y_uv_vectors_to_p210_vectors_sse2, sse2_ssse3);
+}
+
+void		convert_v210_to_p010_sse2_ssse3(const struct PixFcSSE* pixfc, void* source_buffer, void* dest_buffer) {
+	DO_CONVERSION_1U_1P(V210_TO_P010_RECIPE, unpack_4v_v210_to_y_uv_vectors_, pack_2_y_uv_vectors_to_p010_vectors_sse2, sse2_ssse3);
+}
@@ -36,33 +36,41 @@
 // V210 to ARGB			SSE2 SSSE3 SSE41
 void		upsample_n_convert_v210_to_argb_sse2_ssse3_sse41(const struct PixFcSSE *, void *, void *);
 void		convert_v210_to_argb_sse2_ssse3_sse41(const struct PixFcSSE *, void *, void *);
+void		downscale_n_convert_v210_to_argb_sse2_ssse3_sse41(const struct PixFcSSE *, void *, void *);
 // V210 to ARGB  		SSE2 SSSE3
 void		upsample_n_convert_v210_to_argb_sse2_ssse3(const struct PixFcSSE *, void *, void *);
 void		convert_v210_to_argb_sse2_ssse3(const struct PixFcSSE *, void *, void *);
+void		downscale_n_convert_v210_to_argb_sse2_ssse3(const struct PixFcSSE *, void *, void *);
 
 
 // V210 to BGRA 		SSE2 SSSE3 SSE41
 void		upsample_n_convert_v210_to_bgra_sse2_ssse3_sse41(const struct PixFcSSE *, void* , void*);
 void		convert_v210_to_bgra_sse2_ssse3_sse41(const struct PixFcSSE *, void *, void *);
+void		downscale_n_convert_v210_to_bgra_sse2_ssse3_sse41(const struct PixFcSSE *, void *, void *);
 // V210 to BGRA 		SSE2 SSSE3
 void		upsample_n_convert_v210_to_bgra_sse2_ssse3(const struct PixFcSSE *, void*, void*);
 void		convert_v210_to_bgra_sse2_ssse3(const struct PixFcSSE *, void *, void *);
+void		downscale_n_convert_v210_to_bgra_sse2_ssse3(const struct PixFcSSE *, void *, void *);
 
 
 // V210 to RGB24		SSE2 SSSE3 SSE41
 void		upsample_n_convert_v210_to_rgb24_sse2_ssse3_sse41(const struct PixFcSSE *, void*, void*);
 void		convert_v210_to_rgb24_sse2_ssse3_sse41(const struct PixFcSSE *, void *, void *);
+void		downscale_n_convert_v210_to_rgb24_sse2_ssse3_sse41(const struct PixFcSSE *, void *, void *);
 // V210 to RGB24		SSE2 SSSE3
 void		upsample_n_convert_v210_to_rgb24_sse2_ssse3(const struct PixFcSSE *, void *, void *);
 void		convert_v210_to_rgb24_sse2_ssse3(const struct PixFcSSE *, void *, void *);
+void		downscale_n_convert_v210_to_rgb24_sse2_ssse3(const struct PixFcSSE *, void *, void *);
 
 
 // V210 to BGR24		SSE2 SSSE3 SSE41
 void		upsample_n_convert_v210_to_bgr24_sse2_ssse3_sse41(const struct PixFcSSE *, void *, void *);
 void		convert_v210_to_bgr24_sse2_ssse3_sse41(const struct PixFcSSE *, void*, void*);
+void		downscale_n_convert_v210_to_bgr24_sse2_ssse3_sse41(const struct PixFcSSE *, void *, void *);
 // V210 to BGR24		SSE2 SSSE3
 void		upsample_n_convert_v210_to_bgr24_sse2_ssse3(const struct PixFcSSE *, void *, void *);
 void		convert_v210_to_bgr24_sse2_ssse3(const struct PixFcSSE *, void *, void *);
+void		downscale_n_convert_v210_to_bgr24_sse2_ssse3(const struct PixFcSSE *, void *, void *);
 
 
 // V210 to r210			SSE2 SSSE3
@@ -78,12 +86,14 @@ void		upsample_n_convert_v210_to_r10k_sse2_ssse3(const struct PixFcSSE *, void *
 // V210 to anyRGB		NON SSE integer
 void 		convert_v210_to_any_rgb_nonsse(const struct PixFcSSE* , void* , void*);
 void 		upsample_n_convert_v210_to_any_rgb_nonsse(const struct PixFcSSE* , void* , void*);
+void 		downscale_n_convert_v210_to_any_rgb_nonsse(const struct PixFcSSE* , void* , void*);
 void 		convert_v210_to_any_10bit_rgb_nonsse(const struct PixFcSSE* , void* , void*);
 void 		upsample_n_convert_v210_to_any_10bit_rgb_nonsse(const struct PixFcSSE* , void* , void*);
 
 // V210 to anyRGB		NON SSE float
 void 		convert_v210_to_any_rgb_nonsse_float(const struct PixFcSSE* , void* , void*);
 void 		upsample_n_convert_v210_to_any_rgb_nonsse_float(const struct PixFcSSE* , void* , void*);
+void 		downscale_n_convert_v210_to_any_rgb_nonsse_float(const struct PixFcSSE* , void* , void*);
 void 		convert_v210_to_any_10bit_rgb_nonsse_float(const struct PixFcSSE* , void* , void*);
 void 		upsample_n_convert_v210_to_any_10bit_rgb_nonsse_float(const struct PixFcSSE* , void* , void*);
 
@@ -106,33 +116,41 @@ void 		upsample_n_convert_v210_to_any_10bit_rgb_nonsse_float(const struct PixFcS
 // V210 to ARGB			SSE2 SSS3 SSE41
 void		upsample_n_convert_v210_to_argb_bt601_sse2_ssse3_sse41(const struct PixFcSSE *, void *, void *);
 void		convert_v210_to_argb_bt601_sse2_ssse3_sse41(const struct PixFcSSE *, void *, void *);
+void		downscale_n_convert_v210_to_argb_bt601_sse2_ssse3_sse41(const struct PixFcSSE *, void *, void *);
 // V210 to ARGB  		SSE2 SSSE3
 void		upsample_n_convert_v210_to_argb_bt601_sse2_ssse3(const struct PixFcSSE *, void *, void *);
 void		convert_v210_to_argb_bt601_sse2_ssse3(const struct PixFcSSE *, void *, void *);
+void		downscale_n_convert_v210_to_argb_bt601_sse2_ssse3(const struct PixFcSSE *, void *, void *);
 
 
 // V210 to BGRA 		SSE2 SSSE3 SSE41
 void		upsample_n_convert_v210_to_bgra_bt601_sse2_ssse3_sse41(const struct PixFcSSE *, void* , void*);
 void		convert_v210_to_bgra_bt601_sse2_ssse3_sse41(const struct PixFcSSE *, void *, void *);
+void		downscale_n_convert_v210_to_bgra_bt601_sse2_ssse3_sse41(const struct PixFcSSE *, void *, void *);
 // V210 to BGRA 		SSE2 SSSE3
 void		upsample_n_convert_v210_to_bgra_bt601_sse2_ssse3(const struct PixFcSSE *, void*, void*);
 void		convert_v210_to_bgra_bt601_sse2_ssse3(const struct PixFcSSE *, void *, void *);
+void		downscale_n_convert_v210_to_bgra_bt601_sse2_ssse3(const struct PixFcSSE *, void *, void *);
 
 
 // V210 to RGB24		SSE2 SSSE3 SSE41
 void		upsample_n_convert_v210_to_rgb24_bt601_sse2_ssse3_sse41(const struct PixFcSSE *, void*, void*);
 void		convert_v210_to_rgb24_bt601_sse2_ssse3_sse41(const struct PixFcSSE *, void *, void *);
+void		downscale_n_convert_v210_to_rgb24_bt601_sse2_ssse3_sse41(const struct PixFcSSE *, void *, void *);
 // V210 to RGB24		SSE2 SSSE3
 void		upsample_n_convert_v210_to_rgb24_bt601_sse2_ssse3(const struct PixFcSSE *, void *, void *);
 void		convert_v210_to_rgb24_bt601_sse2_ssse3(const struct PixFcSSE *, void *, void *);
+void		downscale_n_convert_v210_to_rgb24_bt601_sse2_ssse3(const struct PixFcSSE *, void *, void *);
 
 
 // V210 to BGR24		SSE2 SSSE3 SSE41
 void		upsample_n_convert_v210_to_bgr24_bt601_sse2_ssse3_sse41(const struct PixFcSSE *, void *, void *);
 void		convert_v210_to_bgr24_bt601_sse2_ssse3_sse41(const struct PixFcSSE *, void*, void*);
+void		downscale_n_convert_v210_to_bgr24_bt601_sse2_ssse3_sse41(const struct PixFcSSE *, void *, void *);
 // V210 to BGR24		SSE2 SSSE3
 void		upsample_n_convert_v210_to_bgr24_bt601_sse2_ssse3(const struct PixFcSSE *, void *, void *);
 void		convert_v210_to_bgr24_bt601_sse2_ssse3(const struct PixFcSSE *, void *, void *);
+void		downscale_n_convert_v210_to_bgr24_bt601_sse2_ssse3(const struct PixFcSSE *, void *, void *);
 
 
 // V210 to r210			SSE2 SSSE3
@@ -148,12 +166,14 @@ void		upsample_n_convert_v210_to_r10k_bt601_sse2_ssse3(const struct PixFcSSE *,
 // V210 to anyRGB		NON SSE integer
 void 		convert_v210_to_any_rgb_bt601_nonsse(const struct PixFcSSE* , void* , void*);
 void 		upsample_n_convert_v210_to_any_rgb_bt601_nonsse(const struct PixFcSSE* , void* , void*);
+void 		downscale_n_convert_v210_to_any_rgb_bt601_nonsse(const struct PixFcSSE* , void* , void*);
 void 		convert_v210_to_any_10bit_rgb_bt601_nonsse(const struct PixFcSSE* , void* , void*);
 void 		upsample_n_convert_v210_to_any_10bit_rgb_bt601_nonsse(const struct PixFcSSE* , void* , void*);
 
 // V210 to anyRGB		NON SSE float
 void 		convert_v210_to_any_rgb_bt601_nonsse_float(const struct PixFcSSE* , void* , void*);
 void 		upsample_n_convert_v210_to_any_rgb_bt601_nonsse_float(const struct PixFcSSE* , void* , void*);
+void 		downscale_n_convert_v210_to_any_rgb_bt601_nonsse_float(const struct PixFcSSE* , void* , void*);
 void 		convert_v210_to_any_10bit_rgb_bt601_nonsse_float(const struct PixFcSSE* , void* , void*);
 void 		upsample_n_convert_v210_to_any_10bit_rgb_bt601_nonsse_float(const struct PixFcSSE* , void* , void*);
 
@@ -174,33 +194,41 @@ void 		upsample_n_convert_v210_to_any_10bit_rgb_bt601_nonsse_float(const struct
 // V210 to ARGB			SSE2 SSS3 SSE41
 void		upsample_n_convert_v210_to_argb_bt709_sse2_ssse3_sse41(const struct PixFcSSE *, void *, void *);
 void		convert_v210_to_argb_bt709_sse2_ssse3_sse41(const struct PixFcSSE *, void *, void *);
+void		downscale_n_convert_v210_to_argb_bt709_sse2_ssse3_sse41(const struct PixFcSSE *, void *, void *);
 // V210 to ARGB  		SSE2 SSSE3
 void		upsample_n_convert_v210_to_argb_bt709_sse2_ssse3(const struct PixFcSSE *, void *, void *);
 void		convert_v210_to_argb_bt709_sse2_ssse3(const struct PixFcSSE *, void *, void *);
+void		downscale_n_convert_v210_to_argb_bt709_sse2_ssse3(const struct PixFcSSE *, void *, void *);
 
 
 // V210 to BGRA 		SSE2 SSSE3 SSE41
 void		upsample_n_convert_v210_to_bgra_bt709_sse2_ssse3_sse41(const struct PixFcSSE *, void* , void*);
 void		convert_v210_to_bgra_bt709_sse2_ssse3_sse41(const struct PixFcSSE *, void *, void *);
+void		downscale_n_convert_v210_to_bgra_bt709_sse2_ssse3_sse41(const struct PixFcSSE *, void *, void *);
 // V210 to BGRA 		SSE2 SSSE3
 void		upsample_n_convert_v210_to_bgra_bt709_sse2_ssse3(const struct PixFcSSE *, void*, void*);
 void		convert_v210_to_bgra_bt709_sse2_ssse3(const struct PixFcSSE *, void *, void *);
+void		downscale_n_convert_v210_to_bgra_bt709_sse2_ssse3(const struct PixFcSSE *, void *, void *);
 
 
 // V210 to RGB24		SSE2 SSSE3 SSE41
 void		upsample_n_convert_v210_to_rgb24_bt709_sse2_ssse3_sse41(const struct PixFcSSE *, void*, void*);
 void		convert_v210_to_rgb24_bt709_sse2_ssse3_sse41(const struct PixFcSSE *, void *, void *);
+void		downscale_n_convert_v210_to_rgb24_bt709_sse2_ssse3_sse41(const struct PixFcSSE *, void *, void *);
 // V210 to RGB24		SSE2 SSSE3
 void		upsample_n_convert_v210_to_rgb24_bt709_sse2_ssse3(const struct PixFcSSE *, void *, void *);
 void		convert_v210_to_rgb24_bt709_sse2_ssse3(const struct PixFcSSE *, void *, void *);
+void		downscale_n_convert_v210_to_rgb24_bt709_sse2_ssse3(const struct PixFcSSE *, void *, void *);
 
 
 // V210 to BGR24		SSE2 SSSE3 SSE41
 void		upsample_n_convert_v210_to_bgr24_bt709_sse2_ssse3_sse41(const struct PixFcSSE *, void *, void *);
 void		convert_v210_to_bgr24_bt709_sse2_ssse3_sse41(const struct PixFcSSE *, void*, void*);
+void		downscale_n_convert_v210_to_bgr24_bt709_sse2_ssse3_sse41(const struct PixFcSSE *, void *, void *);
 // V210 to BGR24		SSE2 SSSE3
 void		upsample_n_convert_v210_to_bgr24_bt709_sse2_ssse3(const struct PixFcSSE *, void *, void *);
 void		convert_v210_to_bgr24_bt709_sse2_ssse3(const struct PixFcSSE *, void *, void *);
+void		downscale_n_convert_v210_to_bgr24_bt709_sse2_ssse3(const struct PixFcSSE *, void *, void *);
 
 
 // V210 to r210			SSE2 SSSE3
@@ -216,12 +244,14 @@ void		upsample_n_convert_v210_to_r10k_bt709_sse2_ssse3(const struct PixFcSSE *,
 // V210 to anyRGB		NON SSE integer
 void 		convert_v210_to_any_rgb_bt709_nonsse(const struct PixFcSSE* , void* , void*);
 void 		upsample_n_convert_v210_to_any_rgb_bt709_nonsse(const struct PixFcSSE* , void* , void*);
+void 		downscale_n_convert_v210_to_any_rgb_bt709_nonsse(const struct PixFcSSE* , void* , void*);
 void 		convert_v210_to_any_10bit_rgb_bt709_nonsse(const struct PixFcSSE* , void* , void*);
 void 		upsample_n_convert_v210_to_any_10bit_rgb_bt709_nonsse(const struct PixFcSSE* , void* , void*);
 
 // V210 to anyRGB		NON SSE float
 void 		convert_v210_to_any_rgb_bt709_nonsse_float(const struct PixFcSSE* , void* , void*);
 void 		upsample_n_convert_v210_to_any_rgb_bt709_nonsse_float(const struct PixFcSSE* , void* , void*);
+void 		downscale_n_convert_v210_to_any_rgb_bt709_nonsse_float(const struct PixFcSSE* , void* , void*);
 void 		convert_v210_to_any_10bit_rgb_bt709_nonsse_float(const struct PixFcSSE* , void* , void*);
 void 		upsample_n_convert_v210_to_any_10bit_rgb_bt709_nonsse_float(const struct PixFcSSE* , void* , void*);
 
@@ -248,6 +278,91 @@ void		convert_v210_to_uyvy_sse2_ssse3(const struct PixFcSSE* , void* , void*);
 void		convert_v210_to_yuv422i_nonsse(const struct PixFcSSE* , void* , void*);
 
 
+/*
+ *
+ *	V 2 1 0
+ *
+ *	T O
+ *
+ *	Y U V 4 2 2 P
+ *
+ *
+ */
+void		convert_v210_to_yuv422p_sse2_ssse3_sse41(const struct PixFcSSE* , void* , void*);
+void		convert_v210_to_yuv422p_sse2_ssse3(const struct PixFcSSE* , void* , void*);
+
+void		convert_v210_to_yuv422p_nonsse(const struct PixFcSSE* , void* , void*);
+
+
+/*
+ *
+ *	V 2 1 0
+ *
+ *	T O
+ *
+ *	P 2 1 0  /  P 0 1 0
+ *
+ *
+ */
+// V210 to P210
+void		convert_v210_to_p210_sse2_ssse3_sse41(const struct PixFcSSE* , void* , void*);
+void		convert_v210_to_p210_sse2_ssse3(const struct PixFcSSE* , void* , void*);
+
+// V210 to P010
+void		convert_v210_to_p010_sse2_ssse3_sse41(const struct PixFcSSE* , void* , void*);
+void		convert_v210_to_p010_sse2_ssse3(const struct PixFcSSE* , void* , void*);
+
+void		convert_v210_to_p210_nonsse(const struct PixFcSSE* , void* , void*);
+
+
+
+/*
+ *
+ *
+ *	A V X - 5 1 2
+ *
+ *  C O N V E R S I O N S
+ *
+ *
+ */
+// V210 to ARGB		AVX-512
+void		upsample_n_convert_v210_to_argb_avx512(const struct PixFcSSE *, void *, void *);
+void		convert_v210_to_argb_avx512(const struct PixFcSSE *, void *, void *);
+void		upsample_n_convert_v210_to_argb_bt601_avx512(const struct PixFcSSE *, void *, void *);
+void		convert_v210_to_argb_bt601_avx512(const struct PixFcSSE *, void *, void *);
+void		upsample_n_convert_v210_to_argb_bt709_avx512(const struct PixFcSSE *, void *, void *);
+void		convert_v210_to_argb_bt709_avx512(const struct PixFcSSE *, void *, void *);
+
+// V210 to BGRA		AVX-512
+void		upsample_n_convert_v210_to_bgra_avx512(const struct PixFcSSE *, void *, void *);
+void		convert_v210_to_bgra_avx512(const struct PixFcSSE *, void *, void *);
+void		upsample_n_convert_v210_to_bgra_bt601_avx512(const struct PixFcSSE *, void *, void *);
+void		convert_v210_to_bgra_bt601_avx512(const struct PixFcSSE *, void *, void *);
+void		upsample_n_convert_v210_to_bgra_bt709_avx512(const struct PixFcSSE *, void *, void *);
+void		convert_v210_to_bgra_bt709_avx512(const struct PixFcSSE *, void *, void *);
+
+// V210 to RGB24		AVX-512
+void		upsample_n_convert_v210_to_rgb24_avx512(const struct PixFcSSE *, void *, void *);
+void		convert_v210_to_rgb24_avx512(const struct PixFcSSE *, void *, void *);
+void		upsample_n_convert_v210_to_rgb24_bt601_avx512(const struct PixFcSSE *, void *, void *);
+void		convert_v210_to_rgb24_bt601_avx512(const struct PixFcSSE *, void *, void *);
+void		upsample_n_convert_v210_to_rgb24_bt709_avx512(const struct PixFcSSE *, void *, void *);
+void		convert_v210_to_rgb24_bt709_avx512(const struct PixFcSSE *, void *, void *);
+
+// V210 to BGR24		AVX-512
+void		upsample_n_convert_v210_to_bgr24_avx512(const struct PixFcSSE *, void *, void *);
+void		convert_v210_to_bgr24_avx512(const struct PixFcSSE *, void *, void *);
+void		upsample_n_convert_v210_to_bgr24_bt601_avx512(const struct PixFcSSE *, void *, void *);
+void		convert_v210_to_bgr24_bt601_avx512(const struct PixFcSSE *, void *, void *);
+void		upsample_n_convert_v210_to_bgr24_bt709_avx512(const struct PixFcSSE *, void *, void *);
+void		convert_v210_to_bgr24_bt709_avx512(const struct PixFcSSE *, void *, void *);
+
+// V210 to YUYV		AVX-512
+void		convert_v210_to_yuyv_avx512(const struct PixFcSSE *, void *, void *);
+
+// V210 to UYVY		AVX-512
+void		convert_v210_to_uyvy_avx512(const struct PixFcSSE *, void *, void *);
+
 
 #endif 		// CONVERSION_ROUTINES_FROM_V210_H_
 
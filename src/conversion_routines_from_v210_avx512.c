@@ -0,0 +1,128 @@
+/*
+ * conversion_routines_from_v210_avx512.c
+ *
+ * Copyright (C) 2012 PixFC Team (pixelfc@gmail.com)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public  License as published by the
+ * Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "common.h"
+#include "pixfc-sse.h"
+#include "yuv_conversion_recipes.h"
+#include "yuv_conversion_recipes_avx512.h"
+
+/*
+ * The v210 to RGB routines below reuse the SSE recipes and only replace
+ * the v210 unpacking inline: chroma upsampling, YUV to RGB conversion and
+ * RGB packing are done by the SSE4.1 inlines.
+ */
+#define reconstruct_missing_uv_avx512													reconstruct_missing_uv_sse2_ssse3_sse41
+#define reconstruct_last_missing_uv_avx512												reconstruct_last_missing_uv_sse2_ssse3_sse41
+#define convert_10bit_y_uv_vectors_to_8bit_rgb_vectors_avx512							convert_10bit_y_uv_vectors_to_8bit_rgb_vectors_sse2_ssse3_sse41
+#define convert_10bit_y_uv_vectors_to_8bit_rgb_vectors_bt601_avx512						convert_10bit_y_uv_vectors_to_8bit_rgb_vectors_bt601_sse2_ssse3_sse41
+#define convert_10bit_y_uv_vectors_to_8bit_rgb_vectors_bt709_avx512						convert_10bit_y_uv_vectors_to_8bit_rgb_vectors_bt709_sse2_ssse3_sse41
+#define nnb_upsample_n_convert_10bit_y_uv_vectors_to_8bit_rgb_vectors_avx512			nnb_upsample_n_convert_10bit_y_uv_vectors_to_8bit_rgb_vectors_sse2_ssse3_sse41
+#define nnb_upsample_n_convert_10bit_y_uv_vectors_to_8bit_rgb_vectors_bt601_avx512		nnb_upsample_n_convert_10bit_y_uv_vectors_to_8bit_rgb_vectors_bt601_sse2_ssse3_sse41
+#define nnb_upsample_n_convert_10bit_y_uv_vectors_to_8bit_rgb_vectors_bt709_avx512		nnb_upsample_n_convert_10bit_y_uv_vectors_to_8bit_rgb_vectors_bt709_sse2_ssse3_sse41
+
+/*
+ * Each macro below defines the full range, bt.601 and bt.709 versions of
+ * a conversion routine.
+ */
+#define DEFINE_CONVERT_TO_RGB_AVX512(fn_name_prefix, pack_fn, output_stride)\
+	void		fn_name_prefix##_avx512(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {\
+		DO_CONVERSION_1U_1P(V210_TO_RGB_RECIPE, unpack_4v_v210_to_y_uv_vectors_, pack_fn, nnb_upsample_n_convert_10bit_y_uv_vectors_to_8bit_rgb_vectors_, output_stride, avx512);\
+	}\
+	void		fn_name_prefix##_bt601_avx512(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {\
+		DO_CONVERSION_1U_1P(V210_TO_RGB_RECIPE, unpack_4v_v210_to_y_uv_vectors_, pack_fn, nnb_upsample_n_convert_10bit_y_uv_vectors_to_8bit_rgb_vectors_bt601_, output_stride, avx512);\
+	}\
+	void		fn_name_prefix##_bt709_avx512(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {\
+		DO_CONVERSION_1U_1P(V210_TO_RGB_RECIPE, unpack_4v_v210_to_y_uv_vectors_, pack_fn, nnb_upsample_n_convert_10bit_y_uv_vectors_to_8bit_rgb_vectors_bt709_, output_stride, avx512);\
+	}
+
+#define DEFINE_UPSAMPLE_N_CONVERT_TO_RGB_AVX512(fn_name_prefix, pack_fn, output_stride)\
+	void		fn_name_prefix##_avx512(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {\
+		DO_CONVERSION_1U_1P(UPSAMPLE_V210_TO_RGB_RECIPE, unpack_4v_v210_to_y_uv_vectors_, pack_fn, convert_10bit_y_uv_vectors_to_8bit_rgb_vectors_, output_stride, avx512);\
+	}\
+	void		fn_name_prefix##_bt601_avx512(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {\
+		DO_CONVERSION_1U_1P(UPSAMPLE_V210_TO_RGB_RECIPE, unpack_4v_v210_to_y_uv_vectors_, pack_fn, convert_10bit_y_uv_vectors_to_8bit_rgb_vectors_bt601_, output_stride, avx512);\
+	}\
+	void		fn_name_prefix##_bt709_avx512(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {\
+		DO_CONVERSION_1U_1P(UPSAMPLE_V210_TO_RGB_RECIPE, unpack_4v_v210_to_y_uv_vectors_, pack_fn, convert_10bit_y_uv_vectors_to_8bit_rgb_vectors_bt709_, output_stride, avx512);\
+	}
+
+/*
+ *
+ * 		V 2 1 0
+ *
+ * 		to
+ *
+ * 		A R G B
+ */
+DEFINE_UPSAMPLE_N_CONVERT_TO_RGB_AVX512(upsample_n_convert_v210_to_argb, pack_6_rgb_vectors_in_4_argb_vectors_sse2, 4)
+DEFINE_CONVERT_TO_RGB_AVX512(convert_v210_to_argb, pack_6_rgb_vectors_in_4_argb_vectors_sse2, 4)
+
+/*
+ *
+ * 		V 2 1 0
+ *
+ * 		to
+ *
+ * 		B G R A
+ */
+DEFINE_UPSAMPLE_N_CONVERT_TO_RGB_AVX512(upsample_n_convert_v210_to_bgra, pack_6_rgb_vectors_in_4_bgra_vectors_sse2, 4)
+DEFINE_CONVERT_TO_RGB_AVX512(convert_v210_to_bgra, pack_6_rgb_vectors_in_4_bgra_vectors_sse2, 4)
+
+/*
+ *
+ * 		V 2 1 0
+ *
+ * 		to
+ *
+ * 		R G B   2 4
+ */
+DEFINE_UPSAMPLE_N_CONVERT_TO_RGB_AVX512(upsample_n_convert_v210_to_rgb24, pack_6_rgb_vectors_in_3_rgb24_vectors_sse2_ssse3, 3)
+DEFINE_CONVERT_TO_RGB_AVX512(convert_v210_to_rgb24, pack_6_rgb_vectors_in_3_rgb24_vectors_sse2_ssse3, 3)
+
+/*
+ *
+ * 		V 2 1 0
+ *
+ * 		to
+ *
+ * 		B G R   2 4
+ */
+DEFINE_UPSAMPLE_N_CONVERT_TO_RGB_AVX512(upsample_n_convert_v210_to_bgr24, pack_6_rgb_vectors_in_3_bgr24_vectors_sse2_ssse3, 3)
+DEFINE_CONVERT_TO_RGB_AVX512(convert_v210_to_bgr24, pack_6_rgb_vectors_in_3_bgr24_vectors_sse2_ssse3, 3)
+
+/*
+ *
+ *	V 2 1 0
+ *
+ *	T O
+ *
+ *	Y U V 4 2 2 I
+ *
+ *
+ */
+// V210 to YUYV
+void		convert_v210_to_yuyv_avx512(const struct PixFcSSE* pixfc, void* source_buffer, void* dest_buffer) {
+	V210_TO_YUV422I_RECIPE_AVX512(repack_24_v210_pixels_to_yuyv_avx512);
+}
+
+// V210 to UYVY
+void		convert_v210_to_uyvy_avx512(const struct PixFcSSE* pixfc, void* source_buffer, void* dest_buffer) {
+	V210_TO_YUV422I_RECIPE_AVX512(repack_24_v210_pixels_to_uyvy_avx512);
+}
@@ -42,6 +42,29 @@
 				instr_set\
 		)
 
+#define DOWNSCALE_AND_CONVERT_TO_RGB(pack_fn, output_stride, instr_set)\
+		if (PIXFC_DOWNSCALE_FACTOR(pixfc->flags) == 2) {\
+			DO_CONVERSION_1U_1P(\
+					DOWNSCALE_V210_TO_RGB_RECIPE,\
+					unpack_4v_v210_to_y_uv_vectors_,\
+					pack_fn,\
+					convert_10bit_y_uv_vectors_to_8bit_rgb_vectors_bt601_,\
+					output_stride,\
+					2,\
+					instr_set\
+			)\
+		} else {\
+			DO_CONVERSION_1U_1P(\
+					DOWNSCALE_V210_TO_RGB_RECIPE,\
+					unpack_4v_v210_to_y_uv_vectors_,\
+					pack_fn,\
+					convert_10bit_y_uv_vectors_to_8bit_rgb_vectors_bt601_,\
+					output_stride,\
+					4,\
+					instr_set\
+			)\
+		}
+
 
 #define UPSAMPLE_AND_CONVERT_TO_R210(pack16_fn, pack8_fn, instr_set)\
 		DO_CONVERSION_1U_2P(\
@@ -85,20 +108,6 @@
 		)
 
 
-/*
- *
- * 		V 2 1 0
- *
- * 		to
- *
- * 		A R G B
- */
-void		upsample_n_convert_v210_to_argb_bt601_sse2_ssse3_sse41(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
-	 UPSAMPLE_AND_CONVERT_TO_RGB32(pack_6_rgb_vectors_in_4_argb_vectors_sse2, sse2_ssse3_sse41);
-}
-void		convert_v210_to_argb_bt601_sse2_ssse3_sse41(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
-	CONVERT_TO_RGB32(pack_6_rgb_vectors_in_4_argb_vectors_sse2, sse2_ssse3_sse41);
-}
  void		upsample_n_convert_v210_to_argb_bt601_sse2_ssse3(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
 	UPSAMPLE_AND_CONVERT_TO_RGB32(pack_6_rgb_vectors_in_4_argb_vectors_sse2, sse2_ssse3);
  }
@@ -115,12 +124,8 @@ void		convert_v210_to_argb_bt601_sse2_ssse3_sse41(const struct PixFcSSE * pixfc,
  * 		B G R A
  *
  */
-void		upsample_n_convert_v210_to_bgra_bt601_sse2_ssse3_sse41(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
-	UPSAMPLE_AND_CONVERT_TO_RGB32(pack_6_rgb_vectors_in_4_bgra_vectors_sse2, sse2_ssse3_sse41);
-}
-
-void		convert_v210_to_bgra_bt601_sse2_ssse3_sse41(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
-	CONVERT_TO_RGB32(pack_6_rgb_vectors_in_4_bgra_vectors_sse2, sse2_ssse3_sse41);
+void		downscale_n_convert_v210_to_argb_bt601_sse2_ssse3(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
+	DOWNSCALE_AND_CONVERT_TO_RGB(pack_6_rgb_vectors_in_4_argb_vectors_sse2, 4, sse2_ssse3);
 }
 
 void		upsample_n_convert_v210_to_bgra_bt601_sse2_ssse3(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
@@ -131,6 +136,10 @@ void		convert_v210_to_bgra_bt601_sse2_ssse3(const struct PixFcSSE * pixfc, void*
 	CONVERT_TO_RGB32(pack_6_rgb_vectors_in_4_bgra_vectors_sse2, sse2_ssse3);
 }
 
+void		downscale_n_convert_v210_to_bgra_bt601_sse2_ssse3(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
+	DOWNSCALE_AND_CONVERT_TO_RGB(pack_6_rgb_vectors_in_4_bgra_vectors_sse2, 4, sse2_ssse3);
+}
+
 
 /*
  *
@@ -140,14 +149,6 @@ void		convert_v210_to_bgra_bt601_sse2_ssse3(const struct PixFcSSE * pixfc, void*
  *
  * 		R G B   2 4
  */
-void		upsample_n_convert_v210_to_rgb24_bt601_sse2_ssse3_sse41(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
-	UPSAMPLE_AND_CONVERT_TO_RGB24(pack_6_rgb_vectors_in_3_rgb24_vectors_sse2_ssse3,	sse2_ssse3_sse41);
-}
-
-void		convert_v210_to_rgb24_bt601_sse2_ssse3_sse41(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
-	CONVERT_TO_RGB24(pack_6_rgb_vectors_in_3_rgb24_vectors_sse2_ssse3, sse2_ssse3_sse41);
-}
-
 void		upsample_n_convert_v210_to_rgb24_bt601_sse2_ssse3(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
 	UPSAMPLE_AND_CONVERT_TO_RGB24(pack_6_rgb_vectors_in_3_rgb24_vectors_sse2_ssse3,	sse2_ssse3);
 }
@@ -156,6 +157,10 @@ void		convert_v210_to_rgb24_bt601_sse2_ssse3(const struct PixFcSSE * pixfc, void
 	CONVERT_TO_RGB24(pack_6_rgb_vectors_in_3_rgb24_vectors_sse2_ssse3, sse2_ssse3);
 }
 
+void		downscale_n_convert_v210_to_rgb24_bt601_sse2_ssse3(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
+	DOWNSCALE_AND_CONVERT_TO_RGB(pack_6_rgb_vectors_in_3_rgb24_vectors_sse2_ssse3, 3, sse2_ssse3);
+}
+
 
 /*
  *
@@ -166,14 +171,6 @@ void		convert_v210_to_rgb24_bt601_sse2_ssse3(const struct PixFcSSE * pixfc, void
  * 		B G R 2 4
  *
  */
-void		upsample_n_convert_v210_to_bgr24_bt601_sse2_ssse3_sse41(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
-	UPSAMPLE_AND_CONVERT_TO_RGB24(pack_6_rgb_vectors_in_3_bgr24_vectors_sse2_ssse3,	sse2_ssse3_sse41);
-}
-
-void		convert_v210_to_bgr24_bt601_sse2_ssse3_sse41(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
-	CONVERT_TO_RGB24(pack_6_rgb_vectors_in_3_bgr24_vectors_sse2_ssse3, sse2_ssse3_sse41);
-}
-
 void		upsample_n_convert_v210_to_bgr24_bt601_sse2_ssse3(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
 	UPSAMPLE_AND_CONVERT_TO_RGB24(pack_6_rgb_vectors_in_3_bgr24_vectors_sse2_ssse3,	sse2_ssse3);
 }
@@ -182,6 +179,10 @@ void		convert_v210_to_bgr24_bt601_sse2_ssse3(const struct PixFcSSE * pixfc, void
 	CONVERT_TO_RGB24(pack_6_rgb_vectors_in_3_bgr24_vectors_sse2_ssse3, sse2_ssse3);
 }
 
+void		downscale_n_convert_v210_to_bgr24_bt601_sse2_ssse3(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
+	DOWNSCALE_AND_CONVERT_TO_RGB(pack_6_rgb_vectors_in_3_bgr24_vectors_sse2_ssse3, 3, sse2_ssse3);
+}
+
 
 /*
  *
@@ -207,4 +208,3 @@ void		upsample_n_convert_v210_to_r10k_bt601_sse2_ssse3(const struct PixFcSSE * p
 void		convert_v210_to_r10k_bt601_sse2_ssse3(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
 	CONVERT_TO_R210(pack_3_r_g_b_vectors_to_2_r10k_sse2_ssse3, sse2_ssse3);
 }
-
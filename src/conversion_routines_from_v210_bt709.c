@@ -42,6 +42,29 @@
 				instr_set\
 		)
 
+#define DOWNSCALE_AND_CONVERT_TO_RGB(pack_fn, output_stride, instr_set)\
+		if (PIXFC_DOWNSCALE_FACTOR(pixfc->flags) == 2) {\
+			DO_CONVERSION_1U_1P(\
+					DOWNSCALE_V210_TO_RGB_RECIPE,\
+					unpack_4v_v210_to_y_uv_vectors_,\
+					pack_fn,\
+					convert_10bit_y_uv_vectors_to_8bit_rgb_vectors_bt709_,\
+					output_stride,\
+					2,\
+					instr_set\
+			)\
+		} else {\
+			DO_CONVERSION_1U_1P(\
+					DOWNSCALE_V210_TO_RGB_RECIPE,\
+					unpack_4v_v210_to_y_uv_vectors_,\
+					pack_fn,\
+					convert_10bit_y_uv_vectors_to_8bit_rgb_vectors_bt709_,\
+					output_stride,\
+					4,\
+					instr_set\
+			)\
+		}
+
 
 #define UPSAMPLE_AND_CONVERT_TO_R210(pack16_fn, pack8_fn, instr_set)\
 		DO_CONVERSION_1U_2P(\
@@ -94,19 +117,18 @@
  *
  * 		A R G B
  */
-void		upsample_n_convert_v210_to_argb_bt709_sse2_ssse3_sse41(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
-	 UPSAMPLE_AND_CONVERT_TO_RGB32(pack_6_rgb_vectors_in_4_argb_vectors_sse2, sse2_ssse3_sse41);
-}
-void		convert_v210_to_argb_bt709_sse2_ssse3_sse41(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
-	CONVERT_TO_RGB32(pack_6_rgb_vectors_in_4_argb_vectors_sse2, sse2_ssse3_sse41);
-}
 void		upsample_n_convert_v210_to_argb_bt709_sse2_ssse3(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
 	UPSAMPLE_AND_CONVERT_TO_RGB32(pack_6_rgb_vectors_in_4_argb_vectors_sse2, sse2_ssse3);
 }
+
 void		convert_v210_to_argb_bt709_sse2_ssse3(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
 	CONVERT_TO_RGB32(pack_6_rgb_vectors_in_4_argb_vectors_sse2, sse2_ssse3);
 }
 
+void		downscale_n_convert_v210_to_argb_bt709_sse2_ssse3(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
+	DOWNSCALE_AND_CONVERT_TO_RGB(pack_6_rgb_vectors_in_4_argb_vectors_sse2, 4, sse2_ssse3);
+}
+
  
 /*
  * 		V 2 1 0
@@ -116,14 +138,6 @@ void		convert_v210_to_argb_bt709_sse2_ssse3(const struct PixFcSSE * pixfc, void*
  * 		B G R A
  *
  */
-void		upsample_n_convert_v210_to_bgra_bt709_sse2_ssse3_sse41(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
-	UPSAMPLE_AND_CONVERT_TO_RGB32(pack_6_rgb_vectors_in_4_bgra_vectors_sse2,	sse2_ssse3_sse41);
-}
-
-void		convert_v210_to_bgra_bt709_sse2_ssse3_sse41(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
-	CONVERT_TO_RGB32(pack_6_rgb_vectors_in_4_bgra_vectors_sse2, sse2_ssse3_sse41);
-}
-
 void		upsample_n_convert_v210_to_bgra_bt709_sse2_ssse3(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
 	UPSAMPLE_AND_CONVERT_TO_RGB32(pack_6_rgb_vectors_in_4_bgra_vectors_sse2,	sse2_ssse3);
 }
@@ -132,6 +146,10 @@ void		convert_v210_to_bgra_bt709_sse2_ssse3(const struct PixFcSSE * pixfc, void*
 	CONVERT_TO_RGB32(pack_6_rgb_vectors_in_4_bgra_vectors_sse2, sse2_ssse3);
 }
 
+void		downscale_n_convert_v210_to_bgra_bt709_sse2_ssse3(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
+	DOWNSCALE_AND_CONVERT_TO_RGB(pack_6_rgb_vectors_in_4_bgra_vectors_sse2, 4, sse2_ssse3);
+}
+
 
 /*
  *
@@ -141,14 +159,6 @@ void		convert_v210_to_bgra_bt709_sse2_ssse3(const struct PixFcSSE * pixfc, void*
  *
  * 		R G B   2 4
  */
-void		upsample_n_convert_v210_to_rgb24_bt709_sse2_ssse3_sse41(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
-	UPSAMPLE_AND_CONVERT_TO_RGB24(pack_6_rgb_vectors_in_3_rgb24_vectors_sse2_ssse3, sse2_ssse3_sse41);
-}
-
-void		convert_v210_to_rgb24_bt709_sse2_ssse3_sse41(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
-	CONVERT_TO_RGB24(pack_6_rgb_vectors_in_3_rgb24_vectors_sse2_ssse3,	sse2_ssse3_sse41);
-}
-
 void		upsample_n_convert_v210_to_rgb24_bt709_sse2_ssse3(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
 	UPSAMPLE_AND_CONVERT_TO_RGB24(pack_6_rgb_vectors_in_3_rgb24_vectors_sse2_ssse3, sse2_ssse3);
 }
@@ -157,6 +167,10 @@ void		convert_v210_to_rgb24_bt709_sse2_ssse3(const struct PixFcSSE * pixfc, void
 	CONVERT_TO_RGB24(pack_6_rgb_vectors_in_3_rgb24_vectors_sse2_ssse3,	sse2_ssse3);
 }
 
+void		downscale_n_convert_v210_to_rgb24_bt709_sse2_ssse3(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
+	DOWNSCALE_AND_CONVERT_TO_RGB(pack_6_rgb_vectors_in_3_rgb24_vectors_sse2_ssse3, 3, sse2_ssse3);
+}
+
 
 /*
  *
@@ -167,14 +181,6 @@ void		convert_v210_to_rgb24_bt709_sse2_ssse3(const struct PixFcSSE * pixfc, void
  * 		B G R 2 4
  *
  */
-void		upsample_n_convert_v210_to_bgr24_bt709_sse2_ssse3_sse41(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
-	UPSAMPLE_AND_CONVERT_TO_RGB24(pack_6_rgb_vectors_in_3_bgr24_vectors_sse2_ssse3, sse2_ssse3_sse41);
-}
-
-void		convert_v210_to_bgr24_bt709_sse2_ssse3_sse41(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
-	CONVERT_TO_RGB24(pack_6_rgb_vectors_in_3_bgr24_vectors_sse2_ssse3,	sse2_ssse3_sse41);
-}
-
 void		upsample_n_convert_v210_to_bgr24_bt709_sse2_ssse3(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
 	UPSAMPLE_AND_CONVERT_TO_RGB24(pack_6_rgb_vectors_in_3_bgr24_vectors_sse2_ssse3, sse2_ssse3);
 }
@@ -183,6 +189,10 @@ void		convert_v210_to_bgr24_bt709_sse2_ssse3(const struct PixFcSSE * pixfc, void
 	CONVERT_TO_RGB24(pack_6_rgb_vectors_in_3_bgr24_vectors_sse2_ssse3,	sse2_ssse3);
 }
 
+void		downscale_n_convert_v210_to_bgr24_bt709_sse2_ssse3(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
+	DOWNSCALE_AND_CONVERT_TO_RGB(pack_6_rgb_vectors_in_3_bgr24_vectors_sse2_ssse3, 3, sse2_ssse3);
+}
+
 
 /*
  *
@@ -208,4 +218,3 @@ void		upsample_n_convert_v210_to_r10k_bt709_sse2_ssse3(const struct PixFcSSE * p
 void		convert_v210_to_r10k_bt709_sse2_ssse3(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
 	CONVERT_TO_R210(pack_3_r_g_b_vectors_to_2_r10k_sse2_ssse3, sse2_ssse3);
 }
-
@@ -29,7 +29,7 @@
  */
 #define PACK_RGB() \
 		if (dest_fmt == PixFcARGB) {\
-			*(dst++) = 0;\
+			*(dst++) = conv->alpha;\
 			*(dst++) = CLIP_PIXEL(r);\
 			*(dst++) = CLIP_PIXEL(g);\
 			*(dst++) = CLIP_PIXEL(b);\
@@ -37,7 +37,7 @@
 			*(dst++) = CLIP_PIXEL(b);\
 			*(dst++) = CLIP_PIXEL(g);\
 			*(dst++) = CLIP_PIXEL(r);\
-			*(dst++) = 0;\
+			*(dst++) = conv->alpha;\
 		} else if (dest_fmt == PixFcRGB24) {\
 			*(dst++) = CLIP_PIXEL(r);\
 			*(dst++) = CLIP_PIXEL(g);\
@@ -84,6 +84,14 @@
 	b = (coeffs[2][0] * ((y) + offsets[0])) + (coeffs[2][1] * ((u) + offsets[1])) + (coeffs[2][2] * ((v) + offsets[2]));\
 	PACK_RGB()
 
+// Define fn_name() to call fn_name##_fmt() (see CALL_FOR_FORMATS) with each
+// of the given RGB destination formats.
+#define DEFINE_V210_TO_RGB_ENTRY_POINT(fn_name, rgb_dest_formats)\
+	void 		fn_name(const struct PixFcSSE* conv, void* in, void* out){\
+		rgb_dest_formats(fn_name##_fmt, conv, in, out, PixFcV210)\
+		printf("Unknown RGB pixel format\n");\
+	}
+
 
 /*
  * 		V 2 1 0
@@ -97,16 +105,15 @@
 //
 // NNB Integer
 //
-#define DEFINE_V210_TO_ANY_RGB_NONSSE_CONVERSION(fn_name, coeffs, coef_shift, offsets) \
-	void 		fn_name(const struct PixFcSSE* conv, void* in, void* out){\
-		PixFcPixelFormat 	dest_fmt = conv->dest_fmt;\
+#define DEFINE_V210_TO_ANY_RGB_NONSSE_CONVERSION(fn_name, rgb_dest_formats, coeffs, coef_shift, offsets) \
+	static FORCE_INLINE void fn_name##_fmt(const struct PixFcSSE* conv, void* in, void* out, const PixFcPixelFormat src_fmt, const PixFcPixelFormat dest_fmt){\
 		uint32_t 			pixel = 0;\
 		uint32_t			line = 0;\
 		uint32_t*			src = (uint32_t *) in;\
 		uint8_t*			dst = (uint8_t *) out;\
 		int32_t				r, g, b;\
 		int32_t				y, u, v;\
-		uint32_t			padding_bytes = PADDING_BYTE_COUNT(dest_fmt, conv->width);\
+		uint32_t			padding_bytes = ROW_PADDING_BYTE_COUNT(dest_fmt, conv->width, conv->dest_row_bytes);\
 		\
 		while(line++ < conv->height) {\
 			/* Convert as many chunks of 6 pixels as possible,
@@ -161,34 +168,34 @@
 				y = ((src[2] >> 10) & 0x3FF);\
 				CONVERT_N_STORE(coeffs, coef_shift, offsets, y, u, v);\
 			}\
-			src = (uint32_t*) ((uint8_t*)in + line * ROW_SIZE(PixFcV210, conv->width));\
+			src = (uint32_t*) ((uint8_t*)in + line * conv->source_row_bytes);\
 			dst += padding_bytes;\
 			pixel = 0;\
 		}\
-	}
+	}\
+	DEFINE_V210_TO_RGB_ENTRY_POINT(fn_name, rgb_dest_formats)
 
 // These conversion routines only assume an even number of pixels.
-DEFINE_V210_TO_ANY_RGB_NONSSE_CONVERSION(convert_v210_to_any_rgb_nonsse, yuv_10bit_to_rgb_8bit_coef_lhs8[0], 8, yuv_10bit_to_rgb_8bit_off[0])
-DEFINE_V210_TO_ANY_RGB_NONSSE_CONVERSION(convert_v210_to_any_rgb_bt601_nonsse, yuv_10bit_to_rgb_8bit_coef_lhs8[1], 8, yuv_10bit_to_rgb_8bit_off[1])
-DEFINE_V210_TO_ANY_RGB_NONSSE_CONVERSION(convert_v210_to_any_rgb_bt709_nonsse, yuv_10bit_to_rgb_8bit_coef_lhs8[2], 8, yuv_10bit_to_rgb_8bit_off[2])
-DEFINE_V210_TO_ANY_RGB_NONSSE_CONVERSION(convert_v210_to_any_10bit_rgb_nonsse, yuv_10bit_to_rgb_10bit_coef_lhs8[0], 8, yuv_10bit_to_rgb_10bit_off[0])
-DEFINE_V210_TO_ANY_RGB_NONSSE_CONVERSION(convert_v210_to_any_10bit_rgb_bt601_nonsse, yuv_10bit_to_rgb_10bit_coef_lhs8[1], 8, yuv_10bit_to_rgb_10bit_off[1])
-DEFINE_V210_TO_ANY_RGB_NONSSE_CONVERSION(convert_v210_to_any_10bit_rgb_bt709_nonsse, yuv_10bit_to_rgb_10bit_coef_lhs8[2], 8, yuv_10bit_to_rgb_10bit_off[2])
+DEFINE_V210_TO_ANY_RGB_NONSSE_CONVERSION(convert_v210_to_any_rgb_nonsse, CALL_FOR_8BIT_RGB_DEST_FORMATS, yuv_10bit_to_rgb_8bit_coef_lhs8[0], 8, yuv_10bit_to_rgb_8bit_off[0])
+DEFINE_V210_TO_ANY_RGB_NONSSE_CONVERSION(convert_v210_to_any_rgb_bt601_nonsse, CALL_FOR_8BIT_RGB_DEST_FORMATS, yuv_10bit_to_rgb_8bit_coef_lhs8[1], 8, yuv_10bit_to_rgb_8bit_off[1])
+DEFINE_V210_TO_ANY_RGB_NONSSE_CONVERSION(convert_v210_to_any_rgb_bt709_nonsse, CALL_FOR_8BIT_RGB_DEST_FORMATS, yuv_10bit_to_rgb_8bit_coef_lhs8[2], 8, yuv_10bit_to_rgb_8bit_off[2])
+DEFINE_V210_TO_ANY_RGB_NONSSE_CONVERSION(convert_v210_to_any_10bit_rgb_nonsse, CALL_FOR_10BIT_RGB_DEST_FORMATS, yuv_10bit_to_rgb_10bit_coef_lhs8[0], 8, yuv_10bit_to_rgb_10bit_off[0])
+DEFINE_V210_TO_ANY_RGB_NONSSE_CONVERSION(convert_v210_to_any_10bit_rgb_bt601_nonsse, CALL_FOR_10BIT_RGB_DEST_FORMATS, yuv_10bit_to_rgb_10bit_coef_lhs8[1], 8, yuv_10bit_to_rgb_10bit_off[1])
+DEFINE_V210_TO_ANY_RGB_NONSSE_CONVERSION(convert_v210_to_any_10bit_rgb_bt709_nonsse, CALL_FOR_10BIT_RGB_DEST_FORMATS, yuv_10bit_to_rgb_10bit_coef_lhs8[2], 8, yuv_10bit_to_rgb_10bit_off[2])
 
 
 //
 // NNB Float
 //
-#define DEFINE_V210_TO_ANY_RGB_NONSSE_FLOAT_CONVERSION(fn_name, coeffs, offsets) \
-	void 		fn_name(const struct PixFcSSE* conv, void* in, void* out){\
-		PixFcPixelFormat 	dest_fmt = conv->dest_fmt;\
+#define DEFINE_V210_TO_ANY_RGB_NONSSE_FLOAT_CONVERSION(fn_name, rgb_dest_formats, coeffs, offsets) \
+	static FORCE_INLINE void fn_name##_fmt(const struct PixFcSSE* conv, void* in, void* out, const PixFcPixelFormat src_fmt, const PixFcPixelFormat dest_fmt){\
 		uint32_t 			pixel = 0;\
 		uint32_t			line = 0;\
 		uint32_t*			src = (uint32_t *) in;\
 		uint8_t*			dst = (uint8_t *) out;\
 		int32_t				r, g, b;\
 		int32_t				y, u, v;\
-		uint32_t			padding_bytes = PADDING_BYTE_COUNT(dest_fmt, conv->width);\
+		uint32_t			padding_bytes = ROW_PADDING_BYTE_COUNT(dest_fmt, conv->width, conv->dest_row_bytes);\
 		\
 		while(line++ < conv->height) {\
 			/* Convert as many chunks of 6 pixels as possible,
@@ -243,35 +250,35 @@ DEFINE_V210_TO_ANY_RGB_NONSSE_CONVERSION(convert_v210_to_any_10bit_rgb_bt709_non
 				y = ((src[2] >> 10) & 0x3FF);\
 				CONVERT_N_STORE_FLOAT(coeffs, offsets, y, u, v);\
 			}\
-			src = (uint32_t*) ((uint8_t*)in + line * ROW_SIZE(PixFcV210, conv->width));\
+			src = (uint32_t*) ((uint8_t*)in + line * conv->source_row_bytes);\
 			dst += padding_bytes;\
 			pixel = 0;\
 		}\
-	}
+	}\
+	DEFINE_V210_TO_RGB_ENTRY_POINT(fn_name, rgb_dest_formats)
 
 // These conversion routines only assume an even number of pixels.
-DEFINE_V210_TO_ANY_RGB_NONSSE_FLOAT_CONVERSION(convert_v210_to_any_rgb_nonsse_float, yuv_10bit_to_rgb_8bit_coef[0], yuv_10bit_to_rgb_8bit_off[0])
-DEFINE_V210_TO_ANY_RGB_NONSSE_FLOAT_CONVERSION(convert_v210_to_any_rgb_bt601_nonsse_float, yuv_10bit_to_rgb_8bit_coef[1], yuv_10bit_to_rgb_8bit_off[1])
-DEFINE_V210_TO_ANY_RGB_NONSSE_FLOAT_CONVERSION(convert_v210_to_any_rgb_bt709_nonsse_float, yuv_10bit_to_rgb_8bit_coef[2], yuv_10bit_to_rgb_8bit_off[2])
-DEFINE_V210_TO_ANY_RGB_NONSSE_FLOAT_CONVERSION(convert_v210_to_any_10bit_rgb_nonsse_float, yuv_10bit_to_rgb_10bit_coef[0], yuv_10bit_to_rgb_10bit_off[0])
-DEFINE_V210_TO_ANY_RGB_NONSSE_FLOAT_CONVERSION(convert_v210_to_any_10bit_rgb_bt601_nonsse_float, yuv_10bit_to_rgb_10bit_coef[1], yuv_10bit_to_rgb_10bit_off[1])
-DEFINE_V210_TO_ANY_RGB_NONSSE_FLOAT_CONVERSION(convert_v210_to_any_10bit_rgb_bt709_nonsse_float, yuv_10bit_to_rgb_10bit_coef[2], yuv_10bit_to_rgb_10bit_off[2])
+DEFINE_V210_TO_ANY_RGB_NONSSE_FLOAT_CONVERSION(convert_v210_to_any_rgb_nonsse_float, CALL_FOR_8BIT_RGB_DEST_FORMATS, yuv_10bit_to_rgb_8bit_coef[0], yuv_10bit_to_rgb_8bit_off[0])
+DEFINE_V210_TO_ANY_RGB_NONSSE_FLOAT_CONVERSION(convert_v210_to_any_rgb_bt601_nonsse_float, CALL_FOR_8BIT_RGB_DEST_FORMATS, yuv_10bit_to_rgb_8bit_coef[1], yuv_10bit_to_rgb_8bit_off[1])
+DEFINE_V210_TO_ANY_RGB_NONSSE_FLOAT_CONVERSION(convert_v210_to_any_rgb_bt709_nonsse_float, CALL_FOR_8BIT_RGB_DEST_FORMATS, yuv_10bit_to_rgb_8bit_coef[2], yuv_10bit_to_rgb_8bit_off[2])
+DEFINE_V210_TO_ANY_RGB_NONSSE_FLOAT_CONVERSION(convert_v210_to_any_10bit_rgb_nonsse_float, CALL_FOR_10BIT_RGB_DEST_FORMATS, yuv_10bit_to_rgb_10bit_coef[0], yuv_10bit_to_rgb_10bit_off[0])
+DEFINE_V210_TO_ANY_RGB_NONSSE_FLOAT_CONVERSION(convert_v210_to_any_10bit_rgb_bt601_nonsse_float, CALL_FOR_10BIT_RGB_DEST_FORMATS, yuv_10bit_to_rgb_10bit_coef[1], yuv_10bit_to_rgb_10bit_off[1])
+DEFINE_V210_TO_ANY_RGB_NONSSE_FLOAT_CONVERSION(convert_v210_to_any_10bit_rgb_bt709_nonsse_float, CALL_FOR_10BIT_RGB_DEST_FORMATS, yuv_10bit_to_rgb_10bit_coef[2], yuv_10bit_to_rgb_10bit_off[2])
 
 
 
 //
 // AVG Integer
 //
-#define DEFINE_UPSAMPLE_V210_TO_ANY_RGB_NONSSE_CONVERSION(fn_name, coeffs, coef_shift, offsets) \
-	void 		fn_name(const struct PixFcSSE* conv, void* in, void* out){\
-		PixFcPixelFormat 	dest_fmt = conv->dest_fmt;\
+#define DEFINE_UPSAMPLE_V210_TO_ANY_RGB_NONSSE_CONVERSION(fn_name, rgb_dest_formats, coeffs, coef_shift, offsets) \
+	static FORCE_INLINE void fn_name##_fmt(const struct PixFcSSE* conv, void* in, void* out, const PixFcPixelFormat src_fmt, const PixFcPixelFormat dest_fmt){\
 		uint32_t 			pixel = 0;\
 		uint32_t			line = 0;\
 		uint32_t*			src = (uint32_t *) in;\
 		uint8_t*			dst = (uint8_t *) out;\
 		int32_t				r, g, b;\
 		int32_t				y, u, v, next_u, next_v;\
-		uint32_t			padding_bytes = PADDING_BYTE_COUNT(dest_fmt, conv->width);\
+		uint32_t			padding_bytes = ROW_PADDING_BYTE_COUNT(dest_fmt, conv->width, conv->dest_row_bytes);\
 		\
 		while(line++ < conv->height) {\
 			u = (*src & 0x3FF);\
@@ -350,35 +357,35 @@ DEFINE_V210_TO_ANY_RGB_NONSSE_FLOAT_CONVERSION(convert_v210_to_any_10bit_rgb_bt7
 				y = ((src[3] >> 20) & 0x3FF);\
 				CONVERT_N_STORE(coeffs, coef_shift, offsets, y, u, v);\
 			}\
-			src = (uint32_t*) ((uint8_t*)in + line * ROW_SIZE(PixFcV210, conv->width));\
+			src = (uint32_t*) ((uint8_t*)in + line * conv->source_row_bytes);\
 			dst += padding_bytes;\
 			pixel = 0;\
 		}\
-	}
+	}\
+	DEFINE_V210_TO_RGB_ENTRY_POINT(fn_name, rgb_dest_formats)
 
 // These conversion routines only assume an even number of pixels.
-DEFINE_UPSAMPLE_V210_TO_ANY_RGB_NONSSE_CONVERSION(upsample_n_convert_v210_to_any_rgb_nonsse, yuv_10bit_to_rgb_8bit_coef_lhs8[0], 8, yuv_10bit_to_rgb_8bit_off[0])
-DEFINE_UPSAMPLE_V210_TO_ANY_RGB_NONSSE_CONVERSION(upsample_n_convert_v210_to_any_rgb_bt601_nonsse, yuv_10bit_to_rgb_8bit_coef_lhs8[1], 8, yuv_10bit_to_rgb_8bit_off[1])
-DEFINE_UPSAMPLE_V210_TO_ANY_RGB_NONSSE_CONVERSION(upsample_n_convert_v210_to_any_rgb_bt709_nonsse, yuv_10bit_to_rgb_8bit_coef_lhs8[2], 8, yuv_10bit_to_rgb_8bit_off[2])
-DEFINE_UPSAMPLE_V210_TO_ANY_RGB_NONSSE_CONVERSION(upsample_n_convert_v210_to_any_10bit_rgb_nonsse, yuv_10bit_to_rgb_10bit_coef_lhs8[0], 8, yuv_10bit_to_rgb_10bit_off[0])
-DEFINE_UPSAMPLE_V210_TO_ANY_RGB_NONSSE_CONVERSION(upsample_n_convert_v210_to_any_10bit_rgb_bt601_nonsse, yuv_10bit_to_rgb_10bit_coef_lhs8[1], 8, yuv_10bit_to_rgb_10bit_off[1])
-DEFINE_UPSAMPLE_V210_TO_ANY_RGB_NONSSE_CONVERSION(upsample_n_convert_v210_to_any_10bit_rgb_bt709_nonsse, yuv_10bit_to_rgb_10bit_coef_lhs8[2], 8, yuv_10bit_to_rgb_10bit_off[2])
+DEFINE_UPSAMPLE_V210_TO_ANY_RGB_NONSSE_CONVERSION(upsample_n_convert_v210_to_any_rgb_nonsse, CALL_FOR_8BIT_RGB_DEST_FORMATS, yuv_10bit_to_rgb_8bit_coef_lhs8[0], 8, yuv_10bit_to_rgb_8bit_off[0])
+DEFINE_UPSAMPLE_V210_TO_ANY_RGB_NONSSE_CONVERSION(upsample_n_convert_v210_to_any_rgb_bt601_nonsse, CALL_FOR_8BIT_RGB_DEST_FORMATS, yuv_10bit_to_rgb_8bit_coef_lhs8[1], 8, yuv_10bit_to_rgb_8bit_off[1])
+DEFINE_UPSAMPLE_V210_TO_ANY_RGB_NONSSE_CONVERSION(upsample_n_convert_v210_to_any_rgb_bt709_nonsse, CALL_FOR_8BIT_RGB_DEST_FORMATS, yuv_10bit_to_rgb_8bit_coef_lhs8[2], 8, yuv_10bit_to_rgb_8bit_off[2])
+DEFINE_UPSAMPLE_V210_TO_ANY_RGB_NONSSE_CONVERSION(upsample_n_convert_v210_to_any_10bit_rgb_nonsse, CALL_FOR_10BIT_RGB_DEST_FORMATS, yuv_10bit_to_rgb_10bit_coef_lhs8[0], 8, yuv_10bit_to_rgb_10bit_off[0])
+DEFINE_UPSAMPLE_V210_TO_ANY_RGB_NONSSE_CONVERSION(upsample_n_convert_v210_to_any_10bit_rgb_bt601_nonsse, CALL_FOR_10BIT_RGB_DEST_FORMATS, yuv_10bit_to_rgb_10bit_coef_lhs8[1], 8, yuv_10bit_to_rgb_10bit_off[1])
+DEFINE_UPSAMPLE_V210_TO_ANY_RGB_NONSSE_CONVERSION(upsample_n_convert_v210_to_any_10bit_rgb_bt709_nonsse, CALL_FOR_10BIT_RGB_DEST_FORMATS, yuv_10bit_to_rgb_10bit_coef_lhs8[2], 8, yuv_10bit_to_rgb_10bit_off[2])
 
 
 
 //
 // AVG Float
 //
-#define DEFINE_UPSAMPLE_V210_TO_ANY_RGB_NONSSE_CONVERSION_FLOAT(fn_name, coeffs, offsets) \
-	void 		fn_name(const struct PixFcSSE* conv, void* in, void* out){\
-		PixFcPixelFormat 	dest_fmt = conv->dest_fmt;\
+#define DEFINE_UPSAMPLE_V210_TO_ANY_RGB_NONSSE_CONVERSION_FLOAT(fn_name, rgb_dest_formats, coeffs, offsets) \
+	static FORCE_INLINE void fn_name##_fmt(const struct PixFcSSE* conv, void* in, void* out, const PixFcPixelFormat src_fmt, const PixFcPixelFormat dest_fmt){\
 		uint32_t 			pixel = 0;\
 		uint32_t			line = 0;\
 		uint32_t*			src = (uint32_t *) in;\
 		uint8_t*			dst = (uint8_t *) out;\
 		int32_t				r, g, b;\
 		int32_t				y, u, v, next_u, next_v;\
-		uint32_t			padding_bytes = PADDING_BYTE_COUNT(dest_fmt, conv->width);\
+		uint32_t			padding_bytes = ROW_PADDING_BYTE_COUNT(dest_fmt, conv->width, conv->dest_row_bytes);\
 		\
 		while(line++ < conv->height) {\
 			u = (*src & 0x3FF);\
@@ -457,19 +464,129 @@ DEFINE_UPSAMPLE_V210_TO_ANY_RGB_NONSSE_CONVERSION(upsample_n_convert_v210_to_any
 				y = ((src[3] >> 20) & 0x3FF);\
 				CONVERT_N_STORE_FLOAT(coeffs, offsets, y, u, v);\
 			}\
-			src = (uint32_t*) ((uint8_t*)in + line * ROW_SIZE(PixFcV210, conv->width));\
+			src = (uint32_t*) ((uint8_t*)in + line * conv->source_row_bytes);\
 			dst += padding_bytes;\
 			pixel = 0;\
 		}\
-	}
+	}\
+	DEFINE_V210_TO_RGB_ENTRY_POINT(fn_name, rgb_dest_formats)
 
 // These conversion routines only assume an even number of pixels.
-DEFINE_UPSAMPLE_V210_TO_ANY_RGB_NONSSE_CONVERSION_FLOAT(upsample_n_convert_v210_to_any_rgb_nonsse_float, yuv_10bit_to_rgb_8bit_coef[0], yuv_10bit_to_rgb_8bit_off[0])
-DEFINE_UPSAMPLE_V210_TO_ANY_RGB_NONSSE_CONVERSION_FLOAT(upsample_n_convert_v210_to_any_rgb_bt601_nonsse_float, yuv_10bit_to_rgb_8bit_coef[1], yuv_10bit_to_rgb_8bit_off[1])
-DEFINE_UPSAMPLE_V210_TO_ANY_RGB_NONSSE_CONVERSION_FLOAT(upsample_n_convert_v210_to_any_rgb_bt709_nonsse_float, yuv_10bit_to_rgb_8bit_coef[2], yuv_10bit_to_rgb_8bit_off[2])
-DEFINE_UPSAMPLE_V210_TO_ANY_RGB_NONSSE_CONVERSION_FLOAT(upsample_n_convert_v210_to_any_10bit_rgb_nonsse_float, yuv_10bit_to_rgb_10bit_coef[0], yuv_10bit_to_rgb_10bit_off[0])
-DEFINE_UPSAMPLE_V210_TO_ANY_RGB_NONSSE_CONVERSION_FLOAT(upsample_n_convert_v210_to_any_10bit_rgb_bt601_nonsse_float, yuv_10bit_to_rgb_10bit_coef[1], yuv_10bit_to_rgb_10bit_off[1])
-DEFINE_UPSAMPLE_V210_TO_ANY_RGB_NONSSE_CONVERSION_FLOAT(upsample_n_convert_v210_to_any_10bit_rgb_bt709_nonsse_float, yuv_10bit_to_rgb_10bit_coef[2], yuv_10bit_to_rgb_10bit_off[2])
+DEFINE_UPSAMPLE_V210_TO_ANY_RGB_NONSSE_CONVERSION_FLOAT(upsample_n_convert_v210_to_any_rgb_nonsse_float, CALL_FOR_8BIT_RGB_DEST_FORMATS, yuv_10bit_to_rgb_8bit_coef[0], yuv_10bit_to_rgb_8bit_off[0])
+DEFINE_UPSAMPLE_V210_TO_ANY_RGB_NONSSE_CONVERSION_FLOAT(upsample_n_convert_v210_to_any_rgb_bt601_nonsse_float, CALL_FOR_8BIT_RGB_DEST_FORMATS, yuv_10bit_to_rgb_8bit_coef[1], yuv_10bit_to_rgb_8bit_off[1])
+DEFINE_UPSAMPLE_V210_TO_ANY_RGB_NONSSE_CONVERSION_FLOAT(upsample_n_convert_v210_to_any_rgb_bt709_nonsse_float, CALL_FOR_8BIT_RGB_DEST_FORMATS, yuv_10bit_to_rgb_8bit_coef[2], yuv_10bit_to_rgb_8bit_off[2])
+DEFINE_UPSAMPLE_V210_TO_ANY_RGB_NONSSE_CONVERSION_FLOAT(upsample_n_convert_v210_to_any_10bit_rgb_nonsse_float, CALL_FOR_10BIT_RGB_DEST_FORMATS, yuv_10bit_to_rgb_10bit_coef[0], yuv_10bit_to_rgb_10bit_off[0])
+DEFINE_UPSAMPLE_V210_TO_ANY_RGB_NONSSE_CONVERSION_FLOAT(upsample_n_convert_v210_to_any_10bit_rgb_bt601_nonsse_float, CALL_FOR_10BIT_RGB_DEST_FORMATS, yuv_10bit_to_rgb_10bit_coef[1], yuv_10bit_to_rgb_10bit_off[1])
+DEFINE_UPSAMPLE_V210_TO_ANY_RGB_NONSSE_CONVERSION_FLOAT(upsample_n_convert_v210_to_any_10bit_rgb_bt709_nonsse_float, CALL_FOR_10BIT_RGB_DEST_FORMATS, yuv_10bit_to_rgb_10bit_coef[2], yuv_10bit_to_rgb_10bit_off[2])
+
+
+
+/*
+ * 		V 2 1 0
+ *
+ * 		T O
+ *
+ * 		A N Y   R G B   ( D O W N S C A L I N G )
+ *
+ */
+
+// Location of the components of each of the 6 pixels in a group of 4 v210 words:
+// index of the 32-bit word and shift of the 10-bit value in that word. U and V
+// are indexed by pixel pair.
+static const uint32_t	v210_y_word[6] = { 0, 1, 1, 2, 3, 3 };
+static const uint32_t	v210_y_shift[6] = { 10, 0, 20, 10, 0, 20 };
+static const uint32_t	v210_u_word[3] = { 0, 1, 2 };
+static const uint32_t	v210_u_shift[3] = { 0, 10, 20 };
+static const uint32_t	v210_v_word[3] = { 0, 2, 3 };
+static const uint32_t	v210_v_shift[3] = { 20, 0, 10 };
+
+// Add up the Y values and the (nearest neighbour upsampled) U & V values of
+// the factor x factor block of pixels whose top left pixel is at 'column' on
+// the current line.
+#define SUM_V210_BLOCK(y, u, v, column)\
+		y = u = v = 0;\
+		for(line = 0; line < factor; line++) {\
+			line_src = (uint32_t *) ((uint8_t *) src + line * conv->source_row_bytes);\
+			for(pixel = (column); pixel < (column) + factor; pixel++) {\
+				group = &line_src[(pixel / 6) * 4];\
+				y += (group[v210_y_word[pixel % 6]] >> v210_y_shift[pixel % 6]) & 0x3FF;\
+				u += (group[v210_u_word[(pixel % 6) / 2]] >> v210_u_shift[(pixel % 6) / 2]) & 0x3FF;\
+				v += (group[v210_v_word[(pixel % 6) / 2]] >> v210_v_shift[(pixel % 6) / 2]) & 0x3FF;\
+			}\
+		}
+
+//
+// Downscaling Integer
+//
+#define DEFINE_DOWNSCALE_V210_TO_ANY_RGB_NONSSE_CONVERSION(fn_name, rgb_dest_formats, coeffs, coef_shift, offsets) \
+	static FORCE_INLINE void fn_name##_fmt(const struct PixFcSSE* conv, void* in, void* out, const PixFcPixelFormat src_fmt, const PixFcPixelFormat dest_fmt){\
+		uint32_t			factor = PIXFC_DOWNSCALE_FACTOR(conv->flags);\
+		int32_t				area = factor * factor;\
+		uint32_t			out_width = conv->width / factor;\
+		uint32_t			padding_bytes = ROW_PADDING_BYTE_COUNT(dest_fmt, out_width, conv->dest_row_bytes);\
+		uint32_t 			lines_remaining = conv->height / factor;\
+		uint32_t			out_pixel;\
+		uint32_t 			pixel;\
+		uint32_t			line;\
+		uint8_t*			src = (uint8_t *) in;\
+		uint32_t*			line_src;\
+		uint32_t*			group;\
+		uint8_t*			dst = (uint8_t *) out;\
+		int32_t				r, g, b;\
+		int32_t				y, u, v;\
+		\
+		while(lines_remaining-- > 0) {\
+			for(out_pixel = 0; out_pixel < out_width; out_pixel++) {\
+				SUM_V210_BLOCK(y, u, v, out_pixel * factor);\
+				CONVERT_N_STORE(coeffs, coef_shift, offsets, (y + area / 2) / area, (u + area / 2) / area, (v + area / 2) / area);\
+			}\
+			src += factor * conv->source_row_bytes;\
+			dst += padding_bytes;\
+		}\
+	}\
+	DEFINE_V210_TO_RGB_ENTRY_POINT(fn_name, rgb_dest_formats)
+
+// These conversion routines assume the width and height are multiples of the downscaling factor.
+DEFINE_DOWNSCALE_V210_TO_ANY_RGB_NONSSE_CONVERSION(downscale_n_convert_v210_to_any_rgb_nonsse, CALL_FOR_8BIT_RGB_DEST_FORMATS, yuv_10bit_to_rgb_8bit_coef_lhs8[0], 8, yuv_10bit_to_rgb_8bit_off[0])
+DEFINE_DOWNSCALE_V210_TO_ANY_RGB_NONSSE_CONVERSION(downscale_n_convert_v210_to_any_rgb_bt601_nonsse, CALL_FOR_8BIT_RGB_DEST_FORMATS, yuv_10bit_to_rgb_8bit_coef_lhs8[1], 8, yuv_10bit_to_rgb_8bit_off[1])
+DEFINE_DOWNSCALE_V210_TO_ANY_RGB_NONSSE_CONVERSION(downscale_n_convert_v210_to_any_rgb_bt709_nonsse, CALL_FOR_8BIT_RGB_DEST_FORMATS, yuv_10bit_to_rgb_8bit_coef_lhs8[2], 8, yuv_10bit_to_rgb_8bit_off[2])
+
+
+//
+// Downscaling Float
+//
+#define DEFINE_DOWNSCALE_V210_TO_ANY_RGB_NONSSE_FLOAT_CONVERSION(fn_name, rgb_dest_formats, coeffs, offsets) \
+	static FORCE_INLINE void fn_name##_fmt(const struct PixFcSSE* conv, void* in, void* out, const PixFcPixelFormat src_fmt, const PixFcPixelFormat dest_fmt){\
+		uint32_t			factor = PIXFC_DOWNSCALE_FACTOR(conv->flags);\
+		float				area = (float) (factor * factor);\
+		uint32_t			out_width = conv->width / factor;\
+		uint32_t			padding_bytes = ROW_PADDING_BYTE_COUNT(dest_fmt, out_width, conv->dest_row_bytes);\
+		uint32_t 			lines_remaining = conv->height / factor;\
+		uint32_t			out_pixel;\
+		uint32_t 			pixel;\
+		uint32_t			line;\
+		uint8_t*			src = (uint8_t *) in;\
+		uint32_t*			line_src;\
+		uint32_t*			group;\
+		uint8_t*			dst = (uint8_t *) out;\
+		int32_t				r, g, b;\
+		int32_t				y, u, v;\
+		\
+		while(lines_remaining-- > 0) {\
+			for(out_pixel = 0; out_pixel < out_width; out_pixel++) {\
+				SUM_V210_BLOCK(y, u, v, out_pixel * factor);\
+				CONVERT_N_STORE_FLOAT(coeffs, offsets, y / area, u / area, v / area);\
+			}\
+			src += factor * conv->source_row_bytes;\
+			dst += padding_bytes;\
+		}\
+	}\
+	DEFINE_V210_TO_RGB_ENTRY_POINT(fn_name, rgb_dest_formats)
+
+// These conversion routines assume the width and height are multiples of the downscaling factor.
+DEFINE_DOWNSCALE_V210_TO_ANY_RGB_NONSSE_FLOAT_CONVERSION(downscale_n_convert_v210_to_any_rgb_nonsse_float, CALL_FOR_8BIT_RGB_DEST_FORMATS, yuv_10bit_to_rgb_8bit_coef[0], yuv_10bit_to_rgb_8bit_off[0])
+DEFINE_DOWNSCALE_V210_TO_ANY_RGB_NONSSE_FLOAT_CONVERSION(downscale_n_convert_v210_to_any_rgb_bt601_nonsse_float, CALL_FOR_8BIT_RGB_DEST_FORMATS, yuv_10bit_to_rgb_8bit_coef[1], yuv_10bit_to_rgb_8bit_off[1])
+DEFINE_DOWNSCALE_V210_TO_ANY_RGB_NONSSE_FLOAT_CONVERSION(downscale_n_convert_v210_to_any_rgb_bt709_nonsse_float, CALL_FOR_8BIT_RGB_DEST_FORMATS, yuv_10bit_to_rgb_8bit_coef[2], yuv_10bit_to_rgb_8bit_off[2])
 
 
 
@@ -498,8 +615,7 @@ DEFINE_UPSAMPLE_V210_TO_ANY_RGB_NONSSE_CONVERSION_FLOAT(upsample_n_convert_v210_
 		dprint("Unknown destination pixel format\n");\
 	}
 
-void		convert_v210_to_yuv422i_nonsse(const struct PixFcSSE* conv, void* srcBuffer, void* dstBuffer) {
-	PixFcPixelFormat 	dest_fmt = conv->dest_fmt;
+static FORCE_INLINE void convert_v210_to_yuv422i_nonsse_fmt(const struct PixFcSSE* conv, void* srcBuffer, void* dstBuffer, const PixFcPixelFormat src_fmt, const PixFcPixelFormat dest_fmt) {
 	uint32_t 			pixel = 0;
 	uint32_t			line = 0;
 	uint32_t*			src = (uint32_t *) srcBuffer;
@@ -557,7 +673,187 @@ void		convert_v210_to_yuv422i_nonsse(const struct PixFcSSE* conv, void* srcBuffe
 			PACK_TO_YUV422P(y1, u, v, y2, dst);
 		}
 
-		src = (uint32_t*) ((uint8_t*)srcBuffer + line * ROW_SIZE(PixFcV210, conv->width));
+		src = (uint32_t*) ((uint8_t*)srcBuffer + line * conv->source_row_bytes);
+		dst = (uint8_t*)dstBuffer + line * conv->dest_row_bytes;
+		pixel = 0;
+	}
+
+}
+
+void		convert_v210_to_yuv422i_nonsse(const struct PixFcSSE* conv, void* srcBuffer, void* dstBuffer) {
+	CALL_FOR_FORMATS(convert_v210_to_yuv422i_nonsse_fmt, conv, srcBuffer, dstBuffer, PixFcV210, PixFcYUYV);
+	CALL_FOR_FORMATS(convert_v210_to_yuv422i_nonsse_fmt, conv, srcBuffer, dstBuffer, PixFcV210, PixFcUYVY);
+	dprint("Unknown destination pixel format\n");
+}
+
+
+/*
+ *
+ *	V 2 1 0
+ *
+ *	T O
+ *
+ *	Y U V 4 2 2 P
+ *
+ *
+ */
+#define PACK_TO_YUV422_PLANES(y1, u, v, y2) \
+	*y_dst++ = (uint8_t) (y1);\
+	*y_dst++ = (uint8_t) (y2);\
+	*u_dst++ = (uint8_t) (u);\
+	*v_dst++ = (uint8_t) (v);
+
+void		convert_v210_to_yuv422p_nonsse(const struct PixFcSSE* conv, void* srcBuffer, void* dstBuffer) {
+	uint32_t 			pixel = 0;
+	uint32_t			line = 0;
+	uint32_t*			src = (uint32_t *) srcBuffer;
+	uint8_t*			y_dst = (uint8_t *) dstBuffer;
+	uint8_t*			u_dst = y_dst + conv->pixel_count;
+	uint8_t*			v_dst = u_dst + conv->pixel_count / 2;
+	int32_t				y1, y2, u, v;
+
+	// This conversion routines only assumes there is an even number of pixels.
+
+	while(line++ < conv->height) {
+		// Convert as many chunks of 6 pixels as possible,
+		// until less than 6 pixels remain.
+		while(pixel < (conv->width - 5)) {
+			u = (*src >> 2) & 0xFF;
+			y1 = (*src >> 12) & 0xFF;
+			v = (*src >> 22) & 0xFF;
+			y2 = (src[1] >> 2) & 0xFF;
+			PACK_TO_YUV422_PLANES(y1, u, v, y2);
+
+			u = (src[1] >> 12) & 0xFF;
+			y1 = (src[1] >> 22) & 0xFF;
+			v = (src[2] >> 2) & 0xFF;
+			y2 = (src[2] >> 12) & 0xFF;
+			PACK_TO_YUV422_PLANES(y1, u, v, y2);
+
+			u = (src[2] >> 22) & 0xFF;
+			y1 = (src[3] >> 2) & 0xFF;
+			v = (src[3] >> 12) & 0xFF;
+			y2 = (src[3] >> 22) & 0xFF;
+			PACK_TO_YUV422_PLANES(y1, u, v, y2);
+
+			pixel += 6;
+			src += 4;
+		}
+
+		// There can only be 2 or 4 pixels left since yuv422
+		// formats (inc v210) carry at the very least an even
+		// number of pixels.
+		if ((conv->width - pixel) >= 2) {
+			u = (*src >> 2) & 0xFF;
+			y1 = (*src >> 12) & 0xFF;
+			v = (*src >> 22) & 0xFF;
+			y2 = (src[1] >> 2) & 0xFF;
+			PACK_TO_YUV422_PLANES(y1, u, v, y2);
+		}
+		if ((conv->width - pixel) == 4) {
+			u = (src[1] >> 12) & 0xFF;
+			y1 = (src[1] >> 22) & 0xFF;
+			v = (src[2] >> 2) & 0xFF;
+			y2 = (src[2] >> 12) & 0xFF;
+			PACK_TO_YUV422_PLANES(y1, u, v, y2);
+		}
+
+		src = (uint32_t*) ((uint8_t*)srcBuffer + line * conv->source_row_bytes);
+		pixel = 0;
+	}
+}
+
+
+/*
+ *
+ *	V 2 1 0
+ *
+ *	T O
+ *
+ *	P 2 1 0  /  P 0 1 0
+ *
+ *
+ */
+// For P010, the chroma samples of the second line in each pair are averaged
+// with the ones already stored for the first line.
+#define PACK_TO_P210(y1, u, v, y2) \
+	*y_dst++ = (uint16_t) ((y1) << 6);\
+	*y_dst++ = (uint16_t) ((y2) << 6);\
+	if (average_chroma) {\
+		uv_dst[0] = (uint16_t) ((((uv_dst[0] >> 6) + (u) + 1) >> 1) << 6);\
+		uv_dst[1] = (uint16_t) ((((uv_dst[1] >> 6) + (v) + 1) >> 1) << 6);\
+	} else {\
+		uv_dst[0] = (uint16_t) ((u) << 6);\
+		uv_dst[1] = (uint16_t) ((v) << 6);\
+	}\
+	uv_dst += 2;
+
+void		convert_v210_to_p210_nonsse(const struct PixFcSSE* conv, void* srcBuffer, void* dstBuffer) {
+	uint32_t			chroma_line_shift = (conv->dest_fmt == PixFcP010) ? 1 : 0;
+	uint32_t 			pixel = 0;
+	uint32_t			line = 0;
+	uint32_t			average_chroma;
+	uint32_t*			src = (uint32_t *) srcBuffer;
+	uint16_t*			y_dst = (uint16_t *) dstBuffer;
+	uint16_t*			uv_dst;
+	int32_t				y1, y2, u, v;
+
+	// This conversion routines only assumes there is an even number of pixels.
+
+	while(line < conv->height) {
+		uv_dst = (uint16_t *) dstBuffer + conv->pixel_count + (line >> chroma_line_shift) * conv->width;
+		average_chroma = chroma_line_shift && (line & 1);
+
+		// Convert as many chunks of 6 pixels as possible,
+		// until less than 6 pixels remain.
+		while(pixel < (conv->width - 5)) {
+			u = *src & 0x3FF;
+			y1 = (*src >> 10) & 0x3FF;
+			v = (*src >> 20) & 0x3FF;
+			y2 = src[1] & 0x3FF;
+			PACK_TO_P210(y1, u, v, y2);
+
+			u = (src[1] >> 10) & 0x3FF;
+			y1 = (src[1] >> 20) & 0x3FF;
+			v = src[2] & 0x3FF;
+			y2 = (src[2] >> 10) & 0x3FF;
+			PACK_TO_P210(y1, u, v, y2);
+
+			u = (src[2] >> 20) & 0x3FF;
+			y1 = src[3] & 0x3FF;
+			v = (src[3] >> 10) & 0x3FF;
+			y2 = (src[3] >> 20) & 0x3FF;
+			PACK_TO_P210(y1, u, v, y2);
+
+			pixel += 6;
+			src += 4;
+		}
+
+		// There can only be 2 or 4 pixels left since yuv422
+		// formats (inc v210) carry at the very least an even
+		// number of pixels.
+		if ((conv->width - pixel) == 2) {
+			u = *src & 0x3FF;
+			y1 = (*src >> 10) & 0x3FF;
+			v = (*src >> 20) & 0x3FF;
+			y2 = src[1] & 0x3FF;
+			PACK_TO_P210(y1, u, v, y2);
+		} else if ((conv->width - pixel) == 4) {
+			u = *src & 0x3FF;
+			y1 = (*src >> 10) & 0x3FF;
+			v = (*src >> 20) & 0x3FF;
+			y2 = src[1] & 0x3FF;
+			PACK_TO_P210(y1, u, v, y2);
+
+			u = (src[1] >> 10) & 0x3FF;
+			y1 = (src[1] >> 20) & 0x3FF;
+			v = src[2] & 0x3FF;
+			y2 = (src[2] >> 10) & 0x3FF;
+			PACK_TO_P210(y1, u, v, y2);
+		}
+
+		line++;
+		src = (uint32_t*) ((uint8_t*)srcBuffer + line * conv->source_row_bytes);
 		pixel = 0;
 	}
 
@@ -18,9 +18,12 @@
  *
  */
 
+#include <string.h>
+
 #include "common.h"
 #include "pixfc-sse.h"
 #include "yuv_conversion_recipes.h"
+
 #define CONVERT_TO_RGB32(convert_fn_prefix, pack_fn, instr_set)\
 		DO_CONVERSION_3U_1P(\
 				YUV420P_TO_RGB_RECIPE,\
@@ -45,6 +48,30 @@
 				instr_set\
 		)
 
+#define UPSAMPLE_AND_CONVERT_TO_RGB32(convert_fn_prefix, pack_fn, instr_set)\
+		DO_CONVERSION_3U_1P(\
+				UPSAMPLE_YUV420P_TO_RGB_RECIPE,\
+				unpack_yuv42Xp_to_2_y_vectors_sse2,\
+				unpack_low_yuv42Xp_to_uv_vector_sse2,\
+				unpack_high_yuv42Xp_to_uv_vector_sse2,\
+				pack_fn,\
+				convert_fn_prefix,\
+				4,\
+				instr_set\
+		)
+
+#define UPSAMPLE_AND_CONVERT_TO_RGB24(convert_fn_prefix, pack_fn, instr_set)\
+		DO_CONVERSION_3U_1P(\
+				UPSAMPLE_YUV420P_TO_RGB_RECIPE,\
+				unpack_yuv42Xp_to_2_y_vectors_sse2,\
+				unpack_low_yuv42Xp_to_uv_vector_sse2,\
+				unpack_high_yuv42Xp_to_uv_vector_sse2,\
+				pack_fn,\
+				convert_fn_prefix,\
+				3,\
+				instr_set\
+		)
+
 
 /*
  *
@@ -55,33 +82,36 @@
  * 		A R G B
  */
 
-void		convert_yuv420p_to_argb_sse2_ssse3(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
-	CONVERT_TO_RGB32(nnb_upsample_n_convert_y_uv_vectors_to_rgb_vectors_, pack_6_rgb_vectors_in_4_argb_vectors_sse2, sse2_ssse3);
-}
-
 void		convert_yuv420p_to_argb_sse2(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
 	CONVERT_TO_RGB32(nnb_upsample_n_convert_y_uv_vectors_to_rgb_vectors_, pack_6_rgb_vectors_in_4_argb_vectors_sse2, sse2);
 }
 
 
-void		convert_yuv420p_to_argb_bt601_sse2_ssse3(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
-	CONVERT_TO_RGB32(nnb_upsample_n_convert_y_uv_vectors_to_rgb_vectors_bt601_, pack_6_rgb_vectors_in_4_argb_vectors_sse2, sse2_ssse3);
-}
-
 void		convert_yuv420p_to_argb_bt601_sse2(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
 	CONVERT_TO_RGB32(nnb_upsample_n_convert_y_uv_vectors_to_rgb_vectors_bt601_, pack_6_rgb_vectors_in_4_argb_vectors_sse2, sse2);
 }
 
 
-void		convert_yuv420p_to_argb_bt709_sse2_ssse3(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
-	CONVERT_TO_RGB32(nnb_upsample_n_convert_y_uv_vectors_to_rgb_vectors_bt709_, pack_6_rgb_vectors_in_4_argb_vectors_sse2, sse2_ssse3);
-}
-
 void		convert_yuv420p_to_argb_bt709_sse2(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
 	CONVERT_TO_RGB32(nnb_upsample_n_convert_y_uv_vectors_to_rgb_vectors_bt709_, pack_6_rgb_vectors_in_4_argb_vectors_sse2, sse2);
 }
 
 
+void		upsample_n_convert_yuv420p_to_argb_sse2(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
+	UPSAMPLE_AND_CONVERT_TO_RGB32(convert_y_uv_vectors_to_rgb_vectors_, pack_6_rgb_vectors_in_4_argb_vectors_sse2, sse2);
+}
+
+
+void		upsample_n_convert_yuv420p_to_argb_bt601_sse2(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
+	UPSAMPLE_AND_CONVERT_TO_RGB32(convert_y_uv_vectors_to_rgb_vectors_bt601_, pack_6_rgb_vectors_in_4_argb_vectors_sse2, sse2);
+}
+
+
+void		upsample_n_convert_yuv420p_to_argb_bt709_sse2(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
+	UPSAMPLE_AND_CONVERT_TO_RGB32(convert_y_uv_vectors_to_rgb_vectors_bt709_, pack_6_rgb_vectors_in_4_argb_vectors_sse2, sse2);
+}
+
+
 /*
  * 		Y U V 4 2 0 P
  *
@@ -91,33 +121,36 @@ void		convert_yuv420p_to_argb_bt709_sse2(const struct PixFcSSE * pixfc, void* so
  *
  */
 
-void		convert_yuv420p_to_bgra_sse2_ssse3(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
-	CONVERT_TO_RGB32(nnb_upsample_n_convert_y_uv_vectors_to_rgb_vectors_, pack_6_rgb_vectors_in_4_bgra_vectors_sse2,	sse2_ssse3);
-}
-
 void		convert_yuv420p_to_bgra_sse2(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
 	CONVERT_TO_RGB32(nnb_upsample_n_convert_y_uv_vectors_to_rgb_vectors_, pack_6_rgb_vectors_in_4_bgra_vectors_sse2, sse2);
 }
 
 
-void		convert_yuv420p_to_bgra_bt601_sse2_ssse3(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
-	CONVERT_TO_RGB32(nnb_upsample_n_convert_y_uv_vectors_to_rgb_vectors_bt601_, pack_6_rgb_vectors_in_4_bgra_vectors_sse2,	sse2_ssse3);
-}
-
 void		convert_yuv420p_to_bgra_bt601_sse2(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
 	CONVERT_TO_RGB32(nnb_upsample_n_convert_y_uv_vectors_to_rgb_vectors_bt601_, pack_6_rgb_vectors_in_4_bgra_vectors_sse2, sse2);
 }
 
 
-void		convert_yuv420p_to_bgra_bt709_sse2_ssse3(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
-	CONVERT_TO_RGB32(nnb_upsample_n_convert_y_uv_vectors_to_rgb_vectors_bt709_, pack_6_rgb_vectors_in_4_bgra_vectors_sse2,	sse2_ssse3);
-}
-
 void		convert_yuv420p_to_bgra_bt709_sse2(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
 	CONVERT_TO_RGB32(nnb_upsample_n_convert_y_uv_vectors_to_rgb_vectors_bt709_, pack_6_rgb_vectors_in_4_bgra_vectors_sse2, sse2);
 }
 
 
+void		upsample_n_convert_yuv420p_to_bgra_sse2(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
+	UPSAMPLE_AND_CONVERT_TO_RGB32(convert_y_uv_vectors_to_rgb_vectors_, pack_6_rgb_vectors_in_4_bgra_vectors_sse2, sse2);
+}
+
+
+void		upsample_n_convert_yuv420p_to_bgra_bt601_sse2(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
+	UPSAMPLE_AND_CONVERT_TO_RGB32(convert_y_uv_vectors_to_rgb_vectors_bt601_, pack_6_rgb_vectors_in_4_bgra_vectors_sse2, sse2);
+}
+
+
+void		upsample_n_convert_yuv420p_to_bgra_bt709_sse2(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
+	UPSAMPLE_AND_CONVERT_TO_RGB32(convert_y_uv_vectors_to_rgb_vectors_bt709_, pack_6_rgb_vectors_in_4_bgra_vectors_sse2, sse2);
+}
+
+
 /*
  *
  * 		Y U V 4 2 0 P
@@ -126,33 +159,36 @@ void		convert_yuv420p_to_bgra_bt709_sse2(const struct PixFcSSE * pixfc, void* so
  *
  * 		R G B   2 4
  */
-void		convert_yuv420p_to_rgb24_sse2_ssse3(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
-	CONVERT_TO_RGB24(nnb_upsample_n_convert_y_uv_vectors_to_rgb_vectors_, pack_6_rgb_vectors_in_3_rgb24_vectors_sse2_ssse3, sse2_ssse3);
-}
-
 void		convert_yuv420p_to_rgb24_sse2(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
 	CONVERT_TO_RGB24(nnb_upsample_n_convert_y_uv_vectors_to_rgb_vectors_, pack_6_rgb_vectors_to_3_rgb24_vectors_sse2_slowpacking, sse2);
 }
 
 
-void		convert_yuv420p_to_rgb24_bt601_sse2_ssse3(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
-	CONVERT_TO_RGB24(nnb_upsample_n_convert_y_uv_vectors_to_rgb_vectors_bt601_, pack_6_rgb_vectors_in_3_rgb24_vectors_sse2_ssse3, sse2_ssse3);
-}
-
 void		convert_yuv420p_to_rgb24_bt601_sse2(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
 	CONVERT_TO_RGB24(nnb_upsample_n_convert_y_uv_vectors_to_rgb_vectors_bt601_, pack_6_rgb_vectors_to_3_rgb24_vectors_sse2_slowpacking, sse2);
 }
 
 
-void		convert_yuv420p_to_rgb24_bt709_sse2_ssse3(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
-	CONVERT_TO_RGB24(nnb_upsample_n_convert_y_uv_vectors_to_rgb_vectors_bt709_, pack_6_rgb_vectors_in_3_rgb24_vectors_sse2_ssse3, sse2_ssse3);
-}
-
 void		convert_yuv420p_to_rgb24_bt709_sse2(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
 	CONVERT_TO_RGB24(nnb_upsample_n_convert_y_uv_vectors_to_rgb_vectors_bt709_, pack_6_rgb_vectors_to_3_rgb24_vectors_sse2_slowpacking, sse2);
 }
 
 
+void		upsample_n_convert_yuv420p_to_rgb24_sse2(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
+	UPSAMPLE_AND_CONVERT_TO_RGB24(convert_y_uv_vectors_to_rgb_vectors_, pack_6_rgb_vectors_to_3_rgb24_vectors_sse2_slowpacking, sse2);
+}
+
+
+void		upsample_n_convert_yuv420p_to_rgb24_bt601_sse2(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
+	UPSAMPLE_AND_CONVERT_TO_RGB24(convert_y_uv_vectors_to_rgb_vectors_bt601_, pack_6_rgb_vectors_to_3_rgb24_vectors_sse2_slowpacking, sse2);
+}
+
+
+void		upsample_n_convert_yuv420p_to_rgb24_bt709_sse2(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
+	UPSAMPLE_AND_CONVERT_TO_RGB24(convert_y_uv_vectors_to_rgb_vectors_bt709_, pack_6_rgb_vectors_to_3_rgb24_vectors_sse2_slowpacking, sse2);
+}
+
+
 /*
  *
  * 		Y U V 4 2 0 P
@@ -162,32 +198,35 @@ void		convert_yuv420p_to_rgb24_bt709_sse2(const struct PixFcSSE * pixfc, void* s
  * 		B G R 2 4
  *
  */
-void		convert_yuv420p_to_bgr24_sse2_ssse3(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
-	CONVERT_TO_RGB24(nnb_upsample_n_convert_y_uv_vectors_to_rgb_vectors_, pack_6_rgb_vectors_in_3_bgr24_vectors_sse2_ssse3, sse2_ssse3);
-}
-
 void		convert_yuv420p_to_bgr24_sse2(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
 	CONVERT_TO_RGB24(nnb_upsample_n_convert_y_uv_vectors_to_rgb_vectors_, pack_6_rgb_vectors_to_3_bgr24_vectors_sse2_slowpacking, sse2);
 }
 
 
-void		convert_yuv420p_to_bgr24_bt601_sse2_ssse3(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
-	CONVERT_TO_RGB24(nnb_upsample_n_convert_y_uv_vectors_to_rgb_vectors_bt601_, pack_6_rgb_vectors_in_3_bgr24_vectors_sse2_ssse3, sse2_ssse3);
-}
-
 void		convert_yuv420p_to_bgr24_bt601_sse2(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
 	CONVERT_TO_RGB24(nnb_upsample_n_convert_y_uv_vectors_to_rgb_vectors_bt601_, pack_6_rgb_vectors_to_3_bgr24_vectors_sse2_slowpacking, sse2);
 }
 
 
-void		convert_yuv420p_to_bgr24_bt709_sse2_ssse3(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
-	CONVERT_TO_RGB24(nnb_upsample_n_convert_y_uv_vectors_to_rgb_vectors_bt709_, pack_6_rgb_vectors_in_3_bgr24_vectors_sse2_ssse3, sse2_ssse3);
-}
-
 void		convert_yuv420p_to_bgr24_bt709_sse2(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
 	CONVERT_TO_RGB24(nnb_upsample_n_convert_y_uv_vectors_to_rgb_vectors_bt709_, pack_6_rgb_vectors_to_3_bgr24_vectors_sse2_slowpacking, sse2);
 }
 
+
+void		upsample_n_convert_yuv420p_to_bgr24_sse2(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
+	UPSAMPLE_AND_CONVERT_TO_RGB24(convert_y_uv_vectors_to_rgb_vectors_, pack_6_rgb_vectors_to_3_bgr24_vectors_sse2_slowpacking, sse2);
+}
+
+
+void		upsample_n_convert_yuv420p_to_bgr24_bt601_sse2(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
+	UPSAMPLE_AND_CONVERT_TO_RGB24(convert_y_uv_vectors_to_rgb_vectors_bt601_, pack_6_rgb_vectors_to_3_bgr24_vectors_sse2_slowpacking, sse2);
+}
+
+
+void		upsample_n_convert_yuv420p_to_bgr24_bt709_sse2(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
+	UPSAMPLE_AND_CONVERT_TO_RGB24(convert_y_uv_vectors_to_rgb_vectors_bt709_, pack_6_rgb_vectors_to_3_bgr24_vectors_sse2_slowpacking, sse2);
+}
+
 /*
  *
  * Non SSE conversion block (nearest neighbour upsampling)
@@ -210,7 +249,7 @@ void 		fn_name(const struct PixFcSSE* conv, void* in, void* out){\
 	uint8_t*			u_src = y_src_line1 + pixel_count;\
 	uint8_t*			v_src = u_src + pixel_count / 4;\
 	uint8_t*			dst_line1 = (uint8_t *) out;\
-	uint8_t*			dst_line2 = dst_line1 + conv->width * output_stride;\
+	uint8_t*			dst_line2 = dst_line1 + conv->dest_row_bytes;\
 	int32_t				r_line1, g_line1, b_line1;\
 	int32_t				r_line2, g_line2, b_line2;\
 	int32_t				y, u, v;\
@@ -227,11 +266,11 @@ void 		fn_name(const struct PixFcSSE* conv, void* in, void* out){\
 				v_src++;\
 			}\
 			if (dest_fmt == PixFcARGB) {\
-				*(dst_line1++) = 0;\
+				*(dst_line1++) = conv->alpha;\
 				*(dst_line1++) = CLIP_PIXEL(r_line1);\
 				*(dst_line1++) = CLIP_PIXEL(g_line1);\
 				*(dst_line1++) = CLIP_PIXEL(b_line1);\
-				*(dst_line2++) = 0;\
+				*(dst_line2++) = conv->alpha;\
 				*(dst_line2++) = CLIP_PIXEL(r_line2);\
 				*(dst_line2++) = CLIP_PIXEL(g_line2);\
 				*(dst_line2++) = CLIP_PIXEL(b_line2);\
@@ -239,11 +278,11 @@ void 		fn_name(const struct PixFcSSE* conv, void* in, void* out){\
 				*(dst_line1++) = CLIP_PIXEL(b_line1);\
 				*(dst_line1++) = CLIP_PIXEL(g_line1);\
 				*(dst_line1++) = CLIP_PIXEL(r_line1);\
-				*(dst_line1++) = 0;\
+				*(dst_line1++) = conv->alpha;\
 				*(dst_line2++) = CLIP_PIXEL(b_line2);\
 				*(dst_line2++) = CLIP_PIXEL(g_line2);\
 				*(dst_line2++) = CLIP_PIXEL(r_line2);\
-				*(dst_line2++) = 0;\
+				*(dst_line2++) = conv->alpha;\
 			} else  if (dest_fmt == PixFcRGB24) {\
 				*(dst_line1++) = CLIP_PIXEL(r_line1);\
 				*(dst_line1++) = CLIP_PIXEL(g_line1);\
@@ -264,8 +303,8 @@ void 		fn_name(const struct PixFcSSE* conv, void* in, void* out){\
 		lines_remaining -= 2;\
 		y_src_line1 += conv->width;\
 		y_src_line2 += conv->width;\
-		dst_line1 += conv->width * output_stride;\
-		dst_line2 += conv->width * output_stride;\
+		dst_line1 += 2 * conv->dest_row_bytes - conv->width * output_stride;\
+		dst_line2 += 2 * conv->dest_row_bytes - conv->width * output_stride;\
 	}\
 }
 
@@ -292,7 +331,7 @@ void 		fn_name(const struct PixFcSSE* conv, void* in, void* out){\
 	uint8_t*			u_src = y_src_line1 + pixel_count;\
 	uint8_t*			v_src = u_src + pixel_count / 4;\
 	uint8_t*			dst_line1 = (uint8_t *) out;\
-	uint8_t*			dst_line2 = dst_line1 + conv->width * output_stride;\
+	uint8_t*			dst_line2 = dst_line1 + conv->dest_row_bytes;\
 	int32_t				r_line1, g_line1, b_line1;\
 	int32_t				r_line2, g_line2, b_line2;\
 	int32_t				y, u, v;\
@@ -309,11 +348,11 @@ void 		fn_name(const struct PixFcSSE* conv, void* in, void* out){\
 				v_src++;\
 			}\
 			if (dest_fmt == PixFcARGB) {\
-				*(dst_line1++) = 0;\
+				*(dst_line1++) = conv->alpha;\
 				*(dst_line1++) = CLIP_PIXEL(r_line1);\
 				*(dst_line1++) = CLIP_PIXEL(g_line1);\
 				*(dst_line1++) = CLIP_PIXEL(b_line1);\
-				*(dst_line2++) = 0;\
+				*(dst_line2++) = conv->alpha;\
 				*(dst_line2++) = CLIP_PIXEL(r_line2);\
 				*(dst_line2++) = CLIP_PIXEL(g_line2);\
 				*(dst_line2++) = CLIP_PIXEL(b_line2);\
@@ -321,11 +360,11 @@ void 		fn_name(const struct PixFcSSE* conv, void* in, void* out){\
 				*(dst_line1++) = CLIP_PIXEL(b_line1);\
 				*(dst_line1++) = CLIP_PIXEL(g_line1);\
 				*(dst_line1++) = CLIP_PIXEL(r_line1);\
-				*(dst_line1++) = 0;\
+				*(dst_line1++) = conv->alpha;\
 				*(dst_line2++) = CLIP_PIXEL(b_line2);\
 				*(dst_line2++) = CLIP_PIXEL(g_line2);\
 				*(dst_line2++) = CLIP_PIXEL(r_line2);\
-				*(dst_line2++) = 0;\
+				*(dst_line2++) = conv->alpha;\
 			} else  if (dest_fmt == PixFcRGB24) {\
 				*(dst_line1++) = CLIP_PIXEL(r_line1);\
 				*(dst_line1++) = CLIP_PIXEL(g_line1);\
@@ -346,8 +385,8 @@ void 		fn_name(const struct PixFcSSE* conv, void* in, void* out){\
 		lines_remaining -= 2;\
 		y_src_line1 += conv->width;\
 		y_src_line2 += conv->width;\
-		dst_line1 += conv->width * output_stride;\
-		dst_line2 += conv->width * output_stride;\
+		dst_line1 += 2 * conv->dest_row_bytes - conv->width * output_stride;\
+		dst_line2 += 2 * conv->dest_row_bytes - conv->width * output_stride;\
 	}\
 }
 
@@ -355,3 +394,201 @@ DEFINE_YUV420P_TO_ANY_RGB_NONSSE_FLOAT_FN(convert_yuv420p_to_any_rgb_nonsse_floa
 DEFINE_YUV420P_TO_ANY_RGB_NONSSE_FLOAT_FN(convert_yuv420p_to_any_rgb_bt601_nonsse_float,  yuv_8bit_to_rgb_8bit_coef[1], yuv_8bit_to_rgb_8bit_off[1]);
 DEFINE_YUV420P_TO_ANY_RGB_NONSSE_FLOAT_FN(convert_yuv420p_to_any_rgb_bt709_nonsse_float,  yuv_8bit_to_rgb_8bit_coef[2], yuv_8bit_to_rgb_8bit_off[2]);
 
+
+
+/*
+ *
+ * Non SSE conversion blocks (chroma interpolation)
+ *
+ * Chroma samples on odd lines are the rounded average of the chroma lines
+ * above and below (the last line reuses the last chroma line), as in the
+ * SSE routines. Missing chroma samples on a line are then the truncated average
+ * of the previous and next ones, as in the YUV422P non-SSE routines.
+ */
+#define PACK_RGB(r, g, b, dst) \
+	if (dest_fmt == PixFcARGB) {\
+		*(dst++) = conv->alpha;\
+		*(dst++) = CLIP_PIXEL(r);\
+		*(dst++) = CLIP_PIXEL(g);\
+		*(dst++) = CLIP_PIXEL(b);\
+	} else if (dest_fmt == PixFcBGRA) {\
+		*(dst++) = CLIP_PIXEL(b);\
+		*(dst++) = CLIP_PIXEL(g);\
+		*(dst++) = CLIP_PIXEL(r);\
+		*(dst++) = conv->alpha;\
+	} else  if (dest_fmt == PixFcRGB24) {\
+		*(dst++) = CLIP_PIXEL(r);\
+		*(dst++) = CLIP_PIXEL(g);\
+		*(dst++) = CLIP_PIXEL(b);\
+	} else {\
+		*(dst++) = CLIP_PIXEL(b);\
+		*(dst++) = CLIP_PIXEL(g);\
+		*(dst++) = CLIP_PIXEL(r);\
+	}
+
+#define AVERAGE_CHROMA_LINES(chroma_src, next_line_offset) \
+		((*(chroma_src) + (chroma_src)[next_line_offset] + 1) / 2)
+
+#define DEFINE_UPSAMPLE_N_YUV420P_TO_ANY_RGB_NONSSE_FN(fn_name, convert_macro, half, ...) \
+void 		fn_name(const struct PixFcSSE* conv, void* in, void* out){\
+	PixFcPixelFormat 	dest_fmt = conv->dest_fmt;\
+	uint32_t			padding_bytes = ROW_PADDING_BYTE_COUNT(dest_fmt, conv->width, conv->dest_row_bytes);\
+	uint32_t			chroma_row_bytes = conv->width / 2;\
+	uint32_t			next_line_offset;\
+	uint32_t			line;\
+	uint32_t			pixels_remaining;\
+	uint8_t*			y_src = (uint8_t *) in;\
+	uint8_t*			u_lines = y_src + conv->pixel_count;\
+	uint8_t*			v_lines = u_lines + conv->pixel_count / 4;\
+	uint8_t*			u_src;\
+	uint8_t*			v_src;\
+	uint8_t*			dst = (uint8_t *) out;\
+	int32_t				r, g, b;\
+	int32_t				y1, y2, u, v, next_u, next_v;\
+	for(line = 0; line < conv->height; line++) {\
+		u_src = u_lines + (line / 2) * chroma_row_bytes;\
+		v_src = v_lines + (line / 2) * chroma_row_bytes;\
+		next_line_offset = (((line & 1) != 0) && (line + 1 < conv->height)) ? chroma_row_bytes : 0;\
+		pixels_remaining = conv->width - 2; /* handle the last 2 pixels outside the loop*/\
+		u = AVERAGE_CHROMA_LINES(u_src, next_line_offset);\
+		v = AVERAGE_CHROMA_LINES(v_src, next_line_offset);\
+		u_src++;\
+		v_src++;\
+		while(pixels_remaining > 0){\
+			y1 = *y_src++;\
+			y2 = *y_src++;\
+			\
+			convert_macro(y1, u, v, r, g, b, __VA_ARGS__);\
+			PACK_RGB(r, g, b, dst);\
+			\
+			next_u = AVERAGE_CHROMA_LINES(u_src, next_line_offset);\
+			next_v = AVERAGE_CHROMA_LINES(v_src, next_line_offset);\
+			u_src++;\
+			v_src++;\
+			convert_macro(y2, ((u + next_u) / half), ((v + next_v) / half), r, g, b, __VA_ARGS__);\
+			PACK_RGB(r, g, b, dst);\
+			\
+			u = next_u;\
+			v = next_v;\
+			pixels_remaining -= 2;\
+		}\
+		y1 = *y_src++;\
+		y2 = *y_src++;\
+		convert_macro(y1, u, v, r, g, b, __VA_ARGS__);\
+		PACK_RGB(r, g, b, dst);\
+		\
+		convert_macro(y2, u, v, r, g, b, __VA_ARGS__);\
+		PACK_RGB(r, g, b, dst);\
+		dst += padding_bytes;\
+	}\
+}
+
+DEFINE_UPSAMPLE_N_YUV420P_TO_ANY_RGB_NONSSE_FN(upsample_n_convert_yuv420p_to_any_rgb_nonsse, CONVERT_YUV_TO_RGB, 2, 8, yuv_8bit_to_rgb_8bit_coef_lhs8[0], yuv_8bit_to_rgb_8bit_off[0]);
+DEFINE_UPSAMPLE_N_YUV420P_TO_ANY_RGB_NONSSE_FN(upsample_n_convert_yuv420p_to_any_rgb_bt601_nonsse, CONVERT_YUV_TO_RGB, 2, 8, yuv_8bit_to_rgb_8bit_coef_lhs8[1], yuv_8bit_to_rgb_8bit_off[1]);
+DEFINE_UPSAMPLE_N_YUV420P_TO_ANY_RGB_NONSSE_FN(upsample_n_convert_yuv420p_to_any_rgb_bt709_nonsse, CONVERT_YUV_TO_RGB, 2, 8, yuv_8bit_to_rgb_8bit_coef_lhs8[2], yuv_8bit_to_rgb_8bit_off[2]);
+DEFINE_UPSAMPLE_N_YUV420P_TO_ANY_RGB_NONSSE_FN(upsample_n_convert_yuv420p_to_any_rgb_nonsse_float, CONVERT_YUV_TO_RGB_FLOAT, 2.0f, yuv_8bit_to_rgb_8bit_coef[0], yuv_8bit_to_rgb_8bit_off[0]);
+DEFINE_UPSAMPLE_N_YUV420P_TO_ANY_RGB_NONSSE_FN(upsample_n_convert_yuv420p_to_any_rgb_bt601_nonsse_float, CONVERT_YUV_TO_RGB_FLOAT, 2.0f, yuv_8bit_to_rgb_8bit_coef[1], yuv_8bit_to_rgb_8bit_off[1]);
+DEFINE_UPSAMPLE_N_YUV420P_TO_ANY_RGB_NONSSE_FN(upsample_n_convert_yuv420p_to_any_rgb_bt709_nonsse_float, CONVERT_YUV_TO_RGB_FLOAT, 2.0f, yuv_8bit_to_rgb_8bit_coef[2], yuv_8bit_to_rgb_8bit_off[2]);
+
+
+
+/*
+ * 		Y U V 4 2 0 P
+ *
+ * 		T O
+ *
+ * 		N V 1 2  /  N V 2 1
+ *
+ */
+void		convert_yuv420p_to_nv12_sse2(const struct PixFcSSE* pixfc, void* source_buffer, void* dest_buffer){
+	DO_REPACK(YUV420P_TO_NV12_RECIPE, repack_yuv420p_to_nv12_, u_plane, v_plane, sse2);
+}
+
+void		convert_yuv420p_to_nv21_sse2(const struct PixFcSSE* pixfc, void* source_buffer, void* dest_buffer){
+	DO_REPACK(YUV420P_TO_NV12_RECIPE, repack_yuv420p_to_nv12_, v_plane, u_plane, sse2);
+}
+
+void		convert_yuv420p_to_nv12_nonsse(const struct PixFcSSE* pixfc, void* source_buffer, void* dest_buffer){
+	uint32_t	chroma_count = pixfc->pixel_count / 4;
+	uint8_t *	u_plane = (uint8_t *) source_buffer + pixfc->pixel_count;
+	uint8_t *	v_plane = u_plane + chroma_count;
+	uint8_t *	uv_plane = (uint8_t *) dest_buffer + pixfc->pixel_count;
+
+	if (pixfc->dest_fmt == PixFcNV21) {
+		v_plane = u_plane;
+		u_plane = v_plane + chroma_count;
+	}
+
+	// Do conversion
+	memcpy(dest_buffer, source_buffer, pixfc->pixel_count);
+	while(chroma_count-- > 0) {
+		*uv_plane++ = *u_plane++;
+		*uv_plane++ = *v_plane++;
+	}
+}
+
+
+
+/*
+ * 		Y U V 4 2 0 P
+ *
+ * 		T O
+ *
+ * 		Y U Y V  /  U Y V Y
+ *
+ * The upsample_n_ variants interpolate chroma samples on odd lines, the
+ * others use each chroma line for 2 output lines.
+ */
+void		convert_yuv420p_to_yuyv_sse2(const struct PixFcSSE* pixfc, void* source_buffer, void* dest_buffer){
+	DO_REPACK(YUV420P_TO_YUV422I_RECIPE, repack_yuv422p_to_yuyv_, 0, sse2);
+}
+
+void		upsample_n_convert_yuv420p_to_yuyv_sse2(const struct PixFcSSE* pixfc, void* source_buffer, void* dest_buffer){
+	DO_REPACK(YUV420P_TO_YUV422I_RECIPE, repack_yuv422p_to_yuyv_, 1, sse2);
+}
+
+void		convert_yuv420p_to_uyvy_sse2(const struct PixFcSSE* pixfc, void* source_buffer, void* dest_buffer){
+	DO_REPACK(YUV420P_TO_YUV422I_RECIPE, repack_yuv422p_to_uyvy_, 0, sse2);
+}
+
+void		upsample_n_convert_yuv420p_to_uyvy_sse2(const struct PixFcSSE* pixfc, void* source_buffer, void* dest_buffer){
+	DO_REPACK(YUV420P_TO_YUV422I_RECIPE, repack_yuv422p_to_uyvy_, 1, sse2);
+}
+
+#define DEFINE_YUV420P_TO_YUV422I_FN(fn_name, interpolate) \
+void		fn_name(const struct PixFcSSE* pixfc, void* source_buffer, void* dest_buffer){\
+	uint32_t	padding_bytes = ROW_PADDING_BYTE_COUNT(pixfc->dest_fmt, pixfc->width, pixfc->dest_row_bytes);\
+	uint32_t	chroma_row_bytes = pixfc->width / 2;\
+	uint32_t	line = 0;\
+	uint32_t 	pixel_count;\
+	uint8_t *	y_plane = (uint8_t *) source_buffer;\
+	uint8_t *	u_lines = y_plane + pixfc->pixel_count;\
+	uint8_t *	v_lines = u_lines + pixfc->pixel_count / 4;\
+	uint8_t *	u_plane;\
+	uint8_t *	v_plane;\
+	uint32_t	next_line_offset;\
+	uint8_t *	dst = (uint8_t *) dest_buffer;\
+	uint32_t	y_index = (pixfc->dest_fmt == PixFcYUYV) ? 0 : 1;\
+	uint32_t	u_index = (pixfc->dest_fmt == PixFcYUYV) ? 1 : 0;\
+	while(line < pixfc->height) {\
+		u_plane = u_lines + (line / 2) * chroma_row_bytes;\
+		v_plane = v_lines + (line / 2) * chroma_row_bytes;\
+		next_line_offset = ((interpolate) && ((line & 1) != 0) && (line + 1 < pixfc->height)) ? chroma_row_bytes : 0;\
+		pixel_count = pixfc->width;\
+		while(pixel_count > 0) {\
+			dst[y_index] = *y_plane++;\
+			dst[y_index + 2] = *y_plane++;\
+			dst[u_index] = (*u_plane + u_plane[next_line_offset] + 1) / 2;\
+			dst[u_index + 2] = (*v_plane + v_plane[next_line_offset] + 1) / 2;\
+			u_plane++;\
+			v_plane++;\
+			dst += 4;\
+			pixel_count -= 2;\
+		}\
+		dst += padding_bytes;\
+		line++;\
+	}\
+}
+
+DEFINE_YUV420P_TO_YUV422I_FN(convert_yuv420p_to_yuv422i_nonsse, 0);
+DEFINE_YUV420P_TO_YUV422I_FN(upsample_n_convert_yuv420p_to_yuv422i_nonsse, 1);
@@ -36,28 +36,38 @@
 // YUV420P to ARGB
 void		convert_yuv420p_to_argb_sse2_ssse3(const struct PixFcSSE *, void *, void *);
 void		convert_yuv420p_to_argb_sse2(const struct PixFcSSE *, void *, void *);
+void		upsample_n_convert_yuv420p_to_argb_sse2_ssse3(const struct PixFcSSE *, void *, void *);
+void		upsample_n_convert_yuv420p_to_argb_sse2(const struct PixFcSSE *, void *, void *);
 
 
 // YUV420P to BGRA
 void		convert_yuv420p_to_bgra_sse2_ssse3(const struct PixFcSSE *, void *, void *);
 void		convert_yuv420p_to_bgra_sse2(const struct PixFcSSE *, void *, void *);
+void		upsample_n_convert_yuv420p_to_bgra_sse2_ssse3(const struct PixFcSSE *, void *, void *);
+void		upsample_n_convert_yuv420p_to_bgra_sse2(const struct PixFcSSE *, void *, void *);
 
 
 // YUV420P to RGB24
 void		convert_yuv420p_to_rgb24_sse2_ssse3(const struct PixFcSSE *, void *, void *);
 void		convert_yuv420p_to_rgb24_sse2(const struct PixFcSSE *, void *, void *);
+void		upsample_n_convert_yuv420p_to_rgb24_sse2_ssse3(const struct PixFcSSE *, void *, void *);
+void		upsample_n_convert_yuv420p_to_rgb24_sse2(const struct PixFcSSE *, void *, void *);
 
 
 // YUV420P to BGR24
 void		convert_yuv420p_to_bgr24_sse2_ssse3(const struct PixFcSSE *, void*, void*);
 void		convert_yuv420p_to_bgr24_sse2(const struct PixFcSSE *, void *, void *);
+void		upsample_n_convert_yuv420p_to_bgr24_sse2_ssse3(const struct PixFcSSE *, void *, void *);
+void		upsample_n_convert_yuv420p_to_bgr24_sse2(const struct PixFcSSE *, void *, void *);
 
 
 // YUV420P to anyRGB		NON SSE integer
 void 		convert_yuv420p_to_any_rgb_nonsse(const struct PixFcSSE* conv, void* srcBuffer, void* dstBuffer);
+void 		upsample_n_convert_yuv420p_to_any_rgb_nonsse(const struct PixFcSSE* conv, void* srcBuffer, void* dstBuffer);
 
 // YUV420P to anyRGB		NON SSE float
 void 		convert_yuv420p_to_any_rgb_nonsse_float(const struct PixFcSSE* conv, void* srcBuffer, void* dstBuffer);
+void 		upsample_n_convert_yuv420p_to_any_rgb_nonsse_float(const struct PixFcSSE* conv, void* srcBuffer, void* dstBuffer);
 
 
 
@@ -79,28 +89,38 @@ void 		convert_yuv420p_to_any_rgb_nonsse_float(const struct PixFcSSE* conv, void
 // YUV420P to ARGB
 void		convert_yuv420p_to_argb_bt601_sse2_ssse3(const struct PixFcSSE *, void *, void *);
 void		convert_yuv420p_to_argb_bt601_sse2(const struct PixFcSSE *, void *, void *);
+void		upsample_n_convert_yuv420p_to_argb_bt601_sse2_ssse3(const struct PixFcSSE *, void *, void *);
+void		upsample_n_convert_yuv420p_to_argb_bt601_sse2(const struct PixFcSSE *, void *, void *);
 
 
 // YUV420P to BGRA
 void		convert_yuv420p_to_bgra_bt601_sse2_ssse3(const struct PixFcSSE *, void *, void *);
 void		convert_yuv420p_to_bgra_bt601_sse2(const struct PixFcSSE *, void *, void *);
+void		upsample_n_convert_yuv420p_to_bgra_bt601_sse2_ssse3(const struct PixFcSSE *, void *, void *);
+void		upsample_n_convert_yuv420p_to_bgra_bt601_sse2(const struct PixFcSSE *, void *, void *);
 
 
 // YUV420P to RGB24
 void		convert_yuv420p_to_rgb24_bt601_sse2_ssse3(const struct PixFcSSE *, void *, void *);
 void		convert_yuv420p_to_rgb24_bt601_sse2(const struct PixFcSSE *, void *, void *);
+void		upsample_n_convert_yuv420p_to_rgb24_bt601_sse2_ssse3(const struct PixFcSSE *, void *, void *);
+void		upsample_n_convert_yuv420p_to_rgb24_bt601_sse2(const struct PixFcSSE *, void *, void *);
 
 
 // YUV420P to BGR24
 void		convert_yuv420p_to_bgr24_bt601_sse2_ssse3(const struct PixFcSSE *, void*, void*);
 void		convert_yuv420p_to_bgr24_bt601_sse2(const struct PixFcSSE *, void *, void *);
+void		upsample_n_convert_yuv420p_to_bgr24_bt601_sse2_ssse3(const struct PixFcSSE *, void *, void *);
+void		upsample_n_convert_yuv420p_to_bgr24_bt601_sse2(const struct PixFcSSE *, void *, void *);
 
 
 // YUV420P to anyRGB		NON SSE integer
 void 		convert_yuv420p_to_any_rgb_bt601_nonsse(const struct PixFcSSE* conv, void* srcBuffer, void* dstBuffer);
+void 		upsample_n_convert_yuv420p_to_any_rgb_bt601_nonsse(const struct PixFcSSE* conv, void* srcBuffer, void* dstBuffer);
 
 // YUV420P to anyRGB		NON SSE float
 void 		convert_yuv420p_to_any_rgb_bt601_nonsse_float(const struct PixFcSSE* conv, void* srcBuffer, void* dstBuffer);
+void 		upsample_n_convert_yuv420p_to_any_rgb_bt601_nonsse_float(const struct PixFcSSE* conv, void* srcBuffer, void* dstBuffer);
 
 
 
@@ -119,27 +139,117 @@ void 		convert_yuv420p_to_any_rgb_bt601_nonsse_float(const struct PixFcSSE* conv
 // YUV420P to ARGB
 void		convert_yuv420p_to_argb_bt709_sse2_ssse3(const struct PixFcSSE *, void *, void *);
 void		convert_yuv420p_to_argb_bt709_sse2(const struct PixFcSSE *, void *, void *);
+void		upsample_n_convert_yuv420p_to_argb_bt709_sse2_ssse3(const struct PixFcSSE *, void *, void *);
+void		upsample_n_convert_yuv420p_to_argb_bt709_sse2(const struct PixFcSSE *, void *, void *);
 
 
 // YUV420P to BGRA
 void		convert_yuv420p_to_bgra_bt709_sse2_ssse3(const struct PixFcSSE *, void *, void *);
 void		convert_yuv420p_to_bgra_bt709_sse2(const struct PixFcSSE *, void *, void *);
+void		upsample_n_convert_yuv420p_to_bgra_bt709_sse2_ssse3(const struct PixFcSSE *, void *, void *);
+void		upsample_n_convert_yuv420p_to_bgra_bt709_sse2(const struct PixFcSSE *, void *, void *);
 
 
 // YUV420P to RGB24
 void		convert_yuv420p_to_rgb24_bt709_sse2_ssse3(const struct PixFcSSE *, void *, void *);
 void		convert_yuv420p_to_rgb24_bt709_sse2(const struct PixFcSSE *, void *, void *);
+void		upsample_n_convert_yuv420p_to_rgb24_bt709_sse2_ssse3(const struct PixFcSSE *, void *, void *);
+void		upsample_n_convert_yuv420p_to_rgb24_bt709_sse2(const struct PixFcSSE *, void *, void *);
 
 
 // YUV420P to BGR24
 void		convert_yuv420p_to_bgr24_bt709_sse2_ssse3(const struct PixFcSSE *, void*, void*);
 void		convert_yuv420p_to_bgr24_bt709_sse2(const struct PixFcSSE *, void *, void *);
+void		upsample_n_convert_yuv420p_to_bgr24_bt709_sse2_ssse3(const struct PixFcSSE *, void *, void *);
+void		upsample_n_convert_yuv420p_to_bgr24_bt709_sse2(const struct PixFcSSE *, void *, void *);
 
 
 // YUV420P to anyRGB		NON SSE integer
 void 		convert_yuv420p_to_any_rgb_bt709_nonsse(const struct PixFcSSE* conv, void* srcBuffer, void* dstBuffer);
+void 		upsample_n_convert_yuv420p_to_any_rgb_bt709_nonsse(const struct PixFcSSE* conv, void* srcBuffer, void* dstBuffer);
 
 // YUV420P to anyRGB		NON SSE float
 void 		convert_yuv420p_to_any_rgb_bt709_nonsse_float(const struct PixFcSSE* conv, void* srcBuffer, void* dstBuffer);
+void 		upsample_n_convert_yuv420p_to_any_rgb_bt709_nonsse_float(const struct PixFcSSE* conv, void* srcBuffer, void* dstBuffer);
+
+
+
+/*
+ *  	Y U V 4 2 0 P
+ *
+ * 		T O
+ *
+ * 		N V 1 2  /  N V 2 1
+ */
+void		convert_yuv420p_to_nv12_sse2(const struct PixFcSSE*, void*, void*);
+void		convert_yuv420p_to_nv21_sse2(const struct PixFcSSE*, void*, void*);
+void		convert_yuv420p_to_nv12_nonsse(const struct PixFcSSE*, void*, void*);
+
+/*
+ *  	Y U V 4 2 0 P
+ *
+ * 		T O
+ *
+ * 		Y U Y V  /  U Y V Y
+ */
+void		convert_yuv420p_to_yuyv_sse2(const struct PixFcSSE*, void*, void*);
+void		upsample_n_convert_yuv420p_to_yuyv_sse2(const struct PixFcSSE*, void*, void*);
+void		convert_yuv420p_to_uyvy_sse2(const struct PixFcSSE*, void*, void*);
+void		upsample_n_convert_yuv420p_to_uyvy_sse2(const struct PixFcSSE*, void*, void*);
+void		convert_yuv420p_to_yuv422i_nonsse(const struct PixFcSSE*, void*, void*);
+void		upsample_n_convert_yuv420p_to_yuv422i_nonsse(const struct PixFcSSE*, void*, void*);
+
+/*
+ *  	Y U V 4 2 0 P
+ *
+ * 		T O
+ *
+ * 		V 2 1 0
+ */
+void		convert_yuv420p_to_v210_sse2_ssse3_sse41(const struct PixFcSSE*, void*, void*);
+void		convert_yuv420p_to_v210_sse2_ssse3(const struct PixFcSSE*, void*, void*);
+void		convert_yuv42Xp_to_v210_nonsse(const struct PixFcSSE*, void*, void*);
+
+/*
+ *
+ *
+ *	A V X 2
+ *
+ *  C O N V E R S I O N S
+ *
+ *
+ */
+// YUV420P to ARGB		AVX2
+void		convert_yuv420p_to_argb_avx2(const struct PixFcSSE *, void *, void *);
+void		convert_yuv420p_to_argb_bt601_avx2(const struct PixFcSSE *, void *, void *);
+void		convert_yuv420p_to_argb_bt709_avx2(const struct PixFcSSE *, void *, void *);
+void		upsample_n_convert_yuv420p_to_argb_avx2(const struct PixFcSSE *, void *, void *);
+void		upsample_n_convert_yuv420p_to_argb_bt601_avx2(const struct PixFcSSE *, void *, void *);
+void		upsample_n_convert_yuv420p_to_argb_bt709_avx2(const struct PixFcSSE *, void *, void *);
+
+// YUV420P to BGRA		AVX2
+void		convert_yuv420p_to_bgra_avx2(const struct PixFcSSE *, void *, void *);
+void		convert_yuv420p_to_bgra_bt601_avx2(const struct PixFcSSE *, void *, void *);
+void		convert_yuv420p_to_bgra_bt709_avx2(const struct PixFcSSE *, void *, void *);
+void		upsample_n_convert_yuv420p_to_bgra_avx2(const struct PixFcSSE *, void *, void *);
+void		upsample_n_convert_yuv420p_to_bgra_bt601_avx2(const struct PixFcSSE *, void *, void *);
+void		upsample_n_convert_yuv420p_to_bgra_bt709_avx2(const struct PixFcSSE *, void *, void *);
+
+// YUV420P to RGB24		AVX2
+void		convert_yuv420p_to_rgb24_avx2(const struct PixFcSSE *, void *, void *);
+void		convert_yuv420p_to_rgb24_bt601_avx2(const struct PixFcSSE *, void *, void *);
+void		convert_yuv420p_to_rgb24_bt709_avx2(const struct PixFcSSE *, void *, void *);
+void		upsample_n_convert_yuv420p_to_rgb24_avx2(const struct PixFcSSE *, void *, void *);
+void		upsample_n_convert_yuv420p_to_rgb24_bt601_avx2(const struct PixFcSSE *, void *, void *);
+void		upsample_n_convert_yuv420p_to_rgb24_bt709_avx2(const struct PixFcSSE *, void *, void *);
+
+// YUV420P to BGR24		AVX2
+void		convert_yuv420p_to_bgr24_avx2(const struct PixFcSSE *, void *, void *);
+void		convert_yuv420p_to_bgr24_bt601_avx2(const struct PixFcSSE *, void *, void *);
+void		convert_yuv420p_to_bgr24_bt709_avx2(const struct PixFcSSE *, void *, void *);
+void		upsample_n_convert_yuv420p_to_bgr24_avx2(const struct PixFcSSE *, void *, void *);
+void		upsample_n_convert_yuv420p_to_bgr24_bt601_avx2(const struct PixFcSSE *, void *, void *);
+void		upsample_n_convert_yuv420p_to_bgr24_bt709_avx2(const struct PixFcSSE *, void *, void *);
+
 
 #endif /* CONVERSION_ROUTINES_FROM_YUV420_H_ */
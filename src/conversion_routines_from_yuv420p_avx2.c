@@ -0,0 +1,97 @@
+/*
+ * conversion_routines_from_yuv420p_avx2.c
+ *
+ * Copyright (C) 2011 PixFC Team (pixelfc@gmail.com)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public  License as published by the
+ * Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "common.h"
+#include "pixfc-sse.h"
+#include "yuv_conversion_recipes_avx2.h"
+
+/*
+ * The macro below defines the full range, bt.601 and bt.709 versions of
+ * a conversion routine. Chroma values are shared by each pair of lines
+ * (nearest neighbour upsampling).
+ */
+#define DEFINE_CONVERT_TO_RGB_AVX2(fn_name_prefix, pack_fn, output_stride)\
+	void		fn_name_prefix##_avx2(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {\
+		YUV42XP_TO_RGB_RECIPE_AVX2(unpack_yuv42Xp_to_y_u_v_vectors_avx2, unpack_yuv42Xp_to_y_u_v_vectors_avx2, convert_y_u_v_vectors_to_rgb_vectors_, pack_fn, output_stride, 1);\
+	}\
+	void		fn_name_prefix##_bt601_avx2(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {\
+		YUV42XP_TO_RGB_RECIPE_AVX2(unpack_yuv42Xp_to_y_u_v_vectors_avx2, unpack_yuv42Xp_to_y_u_v_vectors_avx2, convert_y_u_v_vectors_to_rgb_vectors_bt601_, pack_fn, output_stride, 1);\
+	}\
+	void		fn_name_prefix##_bt709_avx2(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {\
+		YUV42XP_TO_RGB_RECIPE_AVX2(unpack_yuv42Xp_to_y_u_v_vectors_avx2, unpack_yuv42Xp_to_y_u_v_vectors_avx2, convert_y_u_v_vectors_to_rgb_vectors_bt709_, pack_fn, output_stride, 1);\
+	}
+
+/*
+ * Same as above, with chroma averaging.
+ */
+#define DEFINE_UPSAMPLE_N_CONVERT_TO_RGB_AVX2(fn_name_prefix, pack_fn, output_stride)\
+	void		fn_name_prefix##_avx2(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {\
+		UPSAMPLE_YUV420P_TO_RGB_RECIPE_AVX2(unpack_n_upsample_yuv420p_to_y_u_v_vectors_avx2, unpack_n_upsample_last_yuv420p_to_y_u_v_vectors_avx2, convert_y_u_v_vectors_to_rgb_vectors_, pack_fn, output_stride);\
+	}\
+	void		fn_name_prefix##_bt601_avx2(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {\
+		UPSAMPLE_YUV420P_TO_RGB_RECIPE_AVX2(unpack_n_upsample_yuv420p_to_y_u_v_vectors_avx2, unpack_n_upsample_last_yuv420p_to_y_u_v_vectors_avx2, convert_y_u_v_vectors_to_rgb_vectors_bt601_, pack_fn, output_stride);\
+	}\
+	void		fn_name_prefix##_bt709_avx2(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {\
+		UPSAMPLE_YUV420P_TO_RGB_RECIPE_AVX2(unpack_n_upsample_yuv420p_to_y_u_v_vectors_avx2, unpack_n_upsample_last_yuv420p_to_y_u_v_vectors_avx2, convert_y_u_v_vectors_to_rgb_vectors_bt709_, pack_fn, output_stride);\
+	}
+
+/*
+ *
+ * 		Y U V 4 2 0 P
+ *
+ * 		to
+ *
+ * 		A R G B
+ */
+DEFINE_UPSAMPLE_N_CONVERT_TO_RGB_AVX2(upsample_n_convert_yuv420p_to_argb, pack_3_rgb_vectors_to_argb_avx2, 4)
+DEFINE_CONVERT_TO_RGB_AVX2(convert_yuv420p_to_argb, pack_3_rgb_vectors_to_argb_avx2, 4)
+
+/*
+ *
+ * 		Y U V 4 2 0 P
+ *
+ * 		to
+ *
+ * 		B G R A
+ */
+DEFINE_UPSAMPLE_N_CONVERT_TO_RGB_AVX2(upsample_n_convert_yuv420p_to_bgra, pack_3_rgb_vectors_to_bgra_avx2, 4)
+DEFINE_CONVERT_TO_RGB_AVX2(convert_yuv420p_to_bgra, pack_3_rgb_vectors_to_bgra_avx2, 4)
+
+/*
+ *
+ * 		Y U V 4 2 0 P
+ *
+ * 		to
+ *
+ * 		R G B   2 4
+ */
+DEFINE_UPSAMPLE_N_CONVERT_TO_RGB_AVX2(upsample_n_convert_yuv420p_to_rgb24, pack_3_rgb_vectors_to_rgb24_avx2, 3)
+DEFINE_CONVERT_TO_RGB_AVX2(convert_yuv420p_to_rgb24, pack_3_rgb_vectors_to_rgb24_avx2, 3)
+
+/*
+ *
+ * 		Y U V 4 2 0 P
+ *
+ * 		to
+ *
+ * 		B G R   2 4
+ */
+DEFINE_UPSAMPLE_N_CONVERT_TO_RGB_AVX2(upsample_n_convert_yuv420p_to_bgr24, pack_3_rgb_vectors_to_bgr24_avx2, 3)
+DEFINE_CONVERT_TO_RGB_AVX2(convert_yuv420p_to_bgr24, pack_3_rgb_vectors_to_bgr24_avx2, 3)
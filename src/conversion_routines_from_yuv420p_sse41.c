@@ -0,0 +1,38 @@
+/*
+ * conversion_routines_from_yuv420p_sse41.c
+ *
+ * Copyright (C) 2011 PixFC Team (pixelfc@gmail.com)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public  License as published by the
+ * Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <string.h>
+
+#include "common.h"
+#include "pixfc-sse.h"
+#include "yuv_conversion_recipes.h"
+
+/*
+ * 		Y U V 4 2 0 P
+ *
+ * 		T O
+ *
+ * 		V 2 1 0
+ *
+ * Each chroma line is used for 2 output lines.
+ */
+void		convert_yuv420p_to_v210_sse2_ssse3_sse41(const struct PixFcSSE* pixfc, void* source_buffer, void* dest_buffer){
+	DO_REPACK2(YUV42XP_TO_V210_RECIPE, unpack_8_yuv42Xp_pixels_to_y_uv_vectors_sse2, pack_6_y_uv_vectors_to_4_v210_vectors_sse2_ssse3_sse41, 1);
+}
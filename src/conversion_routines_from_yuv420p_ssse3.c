@@ -0,0 +1,218 @@
+/*
+ * conversion_routines_from_yuv420p_ssse3.c
+ *
+ * Copyright (C) 2011 PixFC Team (pixelfc@gmail.com)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public  License as published by the
+ * Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <string.h>
+
+#include "common.h"
+#include "pixfc-sse.h"
+#include "yuv_conversion_recipes.h"
+
+#define CONVERT_TO_RGB32(convert_fn_prefix, pack_fn, instr_set)\
+		DO_CONVERSION_3U_1P(\
+				YUV420P_TO_RGB_RECIPE,\
+				unpack_yuv42Xp_to_2_y_vectors_sse2,\
+				unpack_low_yuv42Xp_to_uv_vector_sse2,\
+				unpack_high_yuv42Xp_to_uv_vector_sse2,\
+				pack_fn,\
+				convert_fn_prefix,\
+				4,\
+				instr_set\
+		)
+
+#define CONVERT_TO_RGB24(convert_fn_prefix, pack_fn, instr_set)\
+		DO_CONVERSION_3U_1P(\
+				YUV420P_TO_RGB_RECIPE,\
+				unpack_yuv42Xp_to_2_y_vectors_sse2,\
+				unpack_low_yuv42Xp_to_uv_vector_sse2,\
+				unpack_high_yuv42Xp_to_uv_vector_sse2,\
+				pack_fn,\
+				convert_fn_prefix,\
+				3,\
+				instr_set\
+		)
+
+#define UPSAMPLE_AND_CONVERT_TO_RGB32(convert_fn_prefix, pack_fn, instr_set)\
+		DO_CONVERSION_3U_1P(\
+				UPSAMPLE_YUV420P_TO_RGB_RECIPE,\
+				unpack_yuv42Xp_to_2_y_vectors_sse2,\
+				unpack_low_yuv42Xp_to_uv_vector_sse2,\
+				unpack_high_yuv42Xp_to_uv_vector_sse2,\
+				pack_fn,\
+				convert_fn_prefix,\
+				4,\
+				instr_set\
+		)
+
+#define UPSAMPLE_AND_CONVERT_TO_RGB24(convert_fn_prefix, pack_fn, instr_set)\
+		DO_CONVERSION_3U_1P(\
+				UPSAMPLE_YUV420P_TO_RGB_RECIPE,\
+				unpack_yuv42Xp_to_2_y_vectors_sse2,\
+				unpack_low_yuv42Xp_to_uv_vector_sse2,\
+				unpack_high_yuv42Xp_to_uv_vector_sse2,\
+				pack_fn,\
+				convert_fn_prefix,\
+				3,\
+				instr_set\
+		)
+
+
+/*
+ *
+ * 		Y U V 4 2 0 P
+ *
+ * 		to
+ *
+ * 		A R G B
+ */
+
+void		convert_yuv420p_to_argb_sse2_ssse3(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
+	CONVERT_TO_RGB32(nnb_upsample_n_convert_y_uv_vectors_to_rgb_vectors_, pack_6_rgb_vectors_in_4_argb_vectors_sse2, sse2_ssse3);
+}
+
+void		convert_yuv420p_to_argb_bt601_sse2_ssse3(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
+	CONVERT_TO_RGB32(nnb_upsample_n_convert_y_uv_vectors_to_rgb_vectors_bt601_, pack_6_rgb_vectors_in_4_argb_vectors_sse2, sse2_ssse3);
+}
+
+void		convert_yuv420p_to_argb_bt709_sse2_ssse3(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
+	CONVERT_TO_RGB32(nnb_upsample_n_convert_y_uv_vectors_to_rgb_vectors_bt709_, pack_6_rgb_vectors_in_4_argb_vectors_sse2, sse2_ssse3);
+}
+
+void		upsample_n_convert_yuv420p_to_argb_sse2_ssse3(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
+	UPSAMPLE_AND_CONVERT_TO_RGB32(convert_y_uv_vectors_to_rgb_vectors_, pack_6_rgb_vectors_in_4_argb_vectors_sse2, sse2_ssse3);
+}
+
+void		upsample_n_convert_yuv420p_to_argb_bt601_sse2_ssse3(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
+	UPSAMPLE_AND_CONVERT_TO_RGB32(convert_y_uv_vectors_to_rgb_vectors_bt601_, pack_6_rgb_vectors_in_4_argb_vectors_sse2, sse2_ssse3);
+}
+
+void		upsample_n_convert_yuv420p_to_argb_bt709_sse2_ssse3(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
+	UPSAMPLE_AND_CONVERT_TO_RGB32(convert_y_uv_vectors_to_rgb_vectors_bt709_, pack_6_rgb_vectors_in_4_argb_vectors_sse2, sse2_ssse3);
+}
+
+/*
+ * 		Y U V 4 2 0 P
+ *
+ * 		to
+ *
+ * 		B G R A
+ *
+ */
+
+void		convert_yuv420p_to_bgra_sse2_ssse3(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
+	CONVERT_TO_RGB32(nnb_upsample_n_convert_y_uv_vectors_to_rgb_vectors_, pack_6_rgb_vectors_in_4_bgra_vectors_sse2,	sse2_ssse3);
+}
+
+void		convert_yuv420p_to_bgra_bt601_sse2_ssse3(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
+	CONVERT_TO_RGB32(nnb_upsample_n_convert_y_uv_vectors_to_rgb_vectors_bt601_, pack_6_rgb_vectors_in_4_bgra_vectors_sse2,	sse2_ssse3);
+}
+
+void		convert_yuv420p_to_bgra_bt709_sse2_ssse3(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
+	CONVERT_TO_RGB32(nnb_upsample_n_convert_y_uv_vectors_to_rgb_vectors_bt709_, pack_6_rgb_vectors_in_4_bgra_vectors_sse2,	sse2_ssse3);
+}
+
+void		upsample_n_convert_yuv420p_to_bgra_sse2_ssse3(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
+	UPSAMPLE_AND_CONVERT_TO_RGB32(convert_y_uv_vectors_to_rgb_vectors_, pack_6_rgb_vectors_in_4_bgra_vectors_sse2, sse2_ssse3);
+}
+
+void		upsample_n_convert_yuv420p_to_bgra_bt601_sse2_ssse3(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
+	UPSAMPLE_AND_CONVERT_TO_RGB32(convert_y_uv_vectors_to_rgb_vectors_bt601_, pack_6_rgb_vectors_in_4_bgra_vectors_sse2, sse2_ssse3);
+}
+
+void		upsample_n_convert_yuv420p_to_bgra_bt709_sse2_ssse3(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
+	UPSAMPLE_AND_CONVERT_TO_RGB32(convert_y_uv_vectors_to_rgb_vectors_bt709_, pack_6_rgb_vectors_in_4_bgra_vectors_sse2, sse2_ssse3);
+}
+
+/*
+ *
+ * 		Y U V 4 2 0 P
+ *
+ * 		to
+ *
+ * 		R G B   2 4
+ */
+void		convert_yuv420p_to_rgb24_sse2_ssse3(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
+	CONVERT_TO_RGB24(nnb_upsample_n_convert_y_uv_vectors_to_rgb_vectors_, pack_6_rgb_vectors_in_3_rgb24_vectors_sse2_ssse3, sse2_ssse3);
+}
+
+void		convert_yuv420p_to_rgb24_bt601_sse2_ssse3(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
+	CONVERT_TO_RGB24(nnb_upsample_n_convert_y_uv_vectors_to_rgb_vectors_bt601_, pack_6_rgb_vectors_in_3_rgb24_vectors_sse2_ssse3, sse2_ssse3);
+}
+
+void		convert_yuv420p_to_rgb24_bt709_sse2_ssse3(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
+	CONVERT_TO_RGB24(nnb_upsample_n_convert_y_uv_vectors_to_rgb_vectors_bt709_, pack_6_rgb_vectors_in_3_rgb24_vectors_sse2_ssse3, sse2_ssse3);
+}
+
+void		upsample_n_convert_yuv420p_to_rgb24_sse2_ssse3(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
+	UPSAMPLE_AND_CONVERT_TO_RGB24(convert_y_uv_vectors_to_rgb_vectors_, pack_6_rgb_vectors_in_3_rgb24_vectors_sse2_ssse3, sse2_ssse3);
+}
+
+void		upsample_n_convert_yuv420p_to_rgb24_bt601_sse2_ssse3(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
+	UPSAMPLE_AND_CONVERT_TO_RGB24(convert_y_uv_vectors_to_rgb_vectors_bt601_, pack_6_rgb_vectors_in_3_rgb24_vectors_sse2_ssse3, sse2_ssse3);
+}
+
+void		upsample_n_convert_yuv420p_to_rgb24_bt709_sse2_ssse3(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
+	UPSAMPLE_AND_CONVERT_TO_RGB24(convert_y_uv_vectors_to_rgb_vectors_bt709_, pack_6_rgb_vectors_in_3_rgb24_vectors_sse2_ssse3, sse2_ssse3);
+}
+
+/*
+ *
+ * 		Y U V 4 2 0 P
+ *
+ * 		to
+ *
+ * 		B G R 2 4
+ *
+ */
+void		convert_yuv420p_to_bgr24_sse2_ssse3(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
+	CONVERT_TO_RGB24(nnb_upsample_n_convert_y_uv_vectors_to_rgb_vectors_, pack_6_rgb_vectors_in_3_bgr24_vectors_sse2_ssse3, sse2_ssse3);
+}
+
+void		convert_yuv420p_to_bgr24_bt601_sse2_ssse3(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
+	CONVERT_TO_RGB24(nnb_upsample_n_convert_y_uv_vectors_to_rgb_vectors_bt601_, pack_6_rgb_vectors_in_3_bgr24_vectors_sse2_ssse3, sse2_ssse3);
+}
+
+void		convert_yuv420p_to_bgr24_bt709_sse2_ssse3(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
+	CONVERT_TO_RGB24(nnb_upsample_n_convert_y_uv_vectors_to_rgb_vectors_bt709_, pack_6_rgb_vectors_in_3_bgr24_vectors_sse2_ssse3, sse2_ssse3);
+}
+
+void		upsample_n_convert_yuv420p_to_bgr24_sse2_ssse3(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
+	UPSAMPLE_AND_CONVERT_TO_RGB24(convert_y_uv_vectors_to_rgb_vectors_, pack_6_rgb_vectors_in_3_bgr24_vectors_sse2_ssse3, sse2_ssse3);
+}
+
+void		upsample_n_convert_yuv420p_to_bgr24_bt601_sse2_ssse3(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
+	UPSAMPLE_AND_CONVERT_TO_RGB24(convert_y_uv_vectors_to_rgb_vectors_bt601_, pack_6_rgb_vectors_in_3_bgr24_vectors_sse2_ssse3, sse2_ssse3);
+}
+
+void		upsample_n_convert_yuv420p_to_bgr24_bt709_sse2_ssse3(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
+	UPSAMPLE_AND_CONVERT_TO_RGB24(convert_y_uv_vectors_to_rgb_vectors_bt709_, pack_6_rgb_vectors_in_3_bgr24_vectors_sse2_ssse3, sse2_ssse3);
+}
+
+/*
+ * 		Y U V 4 2 0 P
+ *
+ * 		T O
+ *
+ * 		V 2 1 0
+ *
+ * Each chroma line is used for 2 output lines.
+ */
+void		convert_yuv420p_to_v210_sse2_ssse3(const struct PixFcSSE* pixfc, void* source_buffer, void* dest_buffer){
+	DO_REPACK2(YUV42XP_TO_V210_RECIPE, unpack_8_yuv42Xp_pixels_to_y_uv_vectors_sse2, pack_6_y_uv_vectors_to_4_v210_vectors_sse2_ssse3, 1);
+}
@@ -72,30 +72,6 @@
 				instr_set\
 		)
 
-#define UPSAMPLE_AND_CONVERT_TO_RGB10(pack_fn, instr_set)\
-		DO_CONVERSION_3U_1P(\
-				UPSAMPLE_YUV422P_TO_RGB_RECIPE,\
-				unpack_yuv42Xp_to_2_y_vectors_sse2,\
-				unpack_low_yuv42Xp_to_uv_vector_sse2,\
-				unpack_high_yuv42Xp_to_uv_vector_sse2,\
-				pack_fn,\
-				convert_8bit_y_uv_vectors_to_10bit_rgb_vectors_,\
-				4,\
-				instr_set\
-		)
-
-#define CONVERT_TO_RGB10(pack_fn, instr_set)\
-		DO_CONVERSION_3U_1P(\
-				YUV422P_TO_RGB_RECIPE,\
-				unpack_yuv42Xp_to_2_y_vectors_sse2,\
-				unpack_low_yuv42Xp_to_uv_vector_sse2,\
-				unpack_high_yuv42Xp_to_uv_vector_sse2,\
-				pack_fn,\
-				nnb_upsample_n_convert_8bit_y_uv_vectors_to_10bit_rgb_vectors_,\
-				4,\
-				instr_set\
-		)
-
 /*
  *
  * 		Y U V 4 2 2 P
@@ -104,14 +80,6 @@
  *
  * 		A R G B
  */
-void		upsample_n_convert_yuv422p_to_argb_sse2_ssse3(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
-	 UPSAMPLE_AND_CONVERT_TO_RGB32(pack_6_rgb_vectors_in_4_argb_vectors_sse2, sse2_ssse3);
-}
-
-void		convert_yuv422p_to_argb_sse2_ssse3(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
-	CONVERT_TO_RGB32(pack_6_rgb_vectors_in_4_argb_vectors_sse2,	sse2_ssse3);
-}
-
 void		upsample_n_convert_yuv422p_to_argb_sse2(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
 	UPSAMPLE_AND_CONVERT_TO_RGB32(pack_6_rgb_vectors_in_4_argb_vectors_sse2, sse2);
 }
@@ -128,14 +96,6 @@ void		convert_yuv422p_to_argb_sse2(const struct PixFcSSE * pixfc, void* source_b
  * 		B G R A
  *
  */
-void		upsample_n_convert_yuv422p_to_bgra_sse2_ssse3(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
-	UPSAMPLE_AND_CONVERT_TO_RGB32(pack_6_rgb_vectors_in_4_bgra_vectors_sse2, sse2_ssse3);
-}
-
-void		convert_yuv422p_to_bgra_sse2_ssse3(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
-	CONVERT_TO_RGB32(pack_6_rgb_vectors_in_4_bgra_vectors_sse2,	sse2_ssse3);
-}
-
 void		upsample_n_convert_yuv422p_to_bgra_sse2(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
 	UPSAMPLE_AND_CONVERT_TO_RGB32(pack_6_rgb_vectors_in_4_bgra_vectors_sse2, sse2);
 }
@@ -153,14 +113,6 @@ void		convert_yuv422p_to_bgra_sse2(const struct PixFcSSE * pixfc, void* source_b
  *
  * 		R G B   2 4
  */
-void		upsample_n_convert_yuv422p_to_rgb24_sse2_ssse3(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
-	UPSAMPLE_AND_CONVERT_TO_RGB24(pack_6_rgb_vectors_in_3_rgb24_vectors_sse2_ssse3, sse2_ssse3);
-}
-
-void		convert_yuv422p_to_rgb24_sse2_ssse3(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
-	CONVERT_TO_RGB24(pack_6_rgb_vectors_in_3_rgb24_vectors_sse2_ssse3, sse2_ssse3);
-}
-
 void		upsample_n_convert_yuv422p_to_rgb24_sse2(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
 	UPSAMPLE_AND_CONVERT_TO_RGB24(pack_6_rgb_vectors_to_3_rgb24_vectors_sse2_slowpacking, sse2);
 }
@@ -178,14 +130,6 @@ void		convert_yuv422p_to_rgb24_sse2(const struct PixFcSSE * pixfc, void* source_
  * 		B G R 2 4
  *
  */
-void		upsample_n_convert_yuv422p_to_bgr24_sse2_ssse3(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
-	UPSAMPLE_AND_CONVERT_TO_RGB24(pack_6_rgb_vectors_in_3_bgr24_vectors_sse2_ssse3, sse2_ssse3);
-}
-
-void		convert_yuv422p_to_bgr24_sse2_ssse3(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
-	CONVERT_TO_RGB24(pack_6_rgb_vectors_in_3_bgr24_vectors_sse2_ssse3, sse2_ssse3);
-}
-
 void		upsample_n_convert_yuv422p_to_bgr24_sse2(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
 	UPSAMPLE_AND_CONVERT_TO_RGB24(pack_6_rgb_vectors_to_3_bgr24_vectors_sse2_slowpacking, sse2);
 }
@@ -194,32 +138,6 @@ void		convert_yuv422p_to_bgr24_sse2(const struct PixFcSSE * pixfc, void* source_
 	CONVERT_TO_RGB24(pack_6_rgb_vectors_to_3_bgr24_vectors_sse2_slowpacking, sse2);
 }
 
-/*
- *
- * 		Y U V Y
- *
- * 		to
- *
- * 		1 0 B I T    R G B
- *
- */
-void		upsample_n_convert_yuv422p_to_r210_sse2_ssse3(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
-	UPSAMPLE_AND_CONVERT_TO_RGB10(pack_6_r_g_b_vectors_to_4_r210_sse2_ssse3, sse2_ssse3);
-}
-
-void		convert_yuv422p_to_r210_sse2_ssse3(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
-	CONVERT_TO_RGB10(pack_6_r_g_b_vectors_to_4_r210_sse2_ssse3, sse2_ssse3);
-}
-
-void		upsample_n_convert_yuv422p_to_r10k_sse2_ssse3(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
-	UPSAMPLE_AND_CONVERT_TO_RGB10(pack_6_r_g_b_vectors_to_4_r10k_sse2_ssse3, sse2_ssse3);
-}
-
-void		convert_yuv422p_to_r10k_sse2_ssse3(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
-	CONVERT_TO_RGB10(pack_6_r_g_b_vectors_to_4_r10k_sse2_ssse3, sse2_ssse3);
-}
-
-
 /*
  *
  * Non SSE conversion blocks (nearest neighbour upsampling)
@@ -227,7 +145,7 @@ void		convert_yuv422p_to_r10k_sse2_ssse3(const struct PixFcSSE * pixfc, void* so
  */
 #define PACK_RGB(r, g, b, dst) \
 	if (dest_fmt == PixFcARGB) {\
-		*(dst++) = 0;\
+		*(dst++) = conv->alpha;\
 		*(dst++) = CLIP_PIXEL(r);\
 		*(dst++) = CLIP_PIXEL(g);\
 		*(dst++) = CLIP_PIXEL(b);\
@@ -235,7 +153,7 @@ void		convert_yuv422p_to_r10k_sse2_ssse3(const struct PixFcSSE * pixfc, void* so
 		*(dst++) = CLIP_PIXEL(b);\
 		*(dst++) = CLIP_PIXEL(g);\
 		*(dst++) = CLIP_PIXEL(r);\
-		*(dst++) = 0;\
+		*(dst++) = conv->alpha;\
 	} else  if (dest_fmt == PixFcRGB24) {\
 		*(dst++) = CLIP_PIXEL(r);\
 		*(dst++) = CLIP_PIXEL(g);\
@@ -286,7 +204,7 @@ void		convert_yuv422p_to_r10k_sse2_ssse3(const struct PixFcSSE * pixfc, void* so
 		PixFcPixelFormat 	dest_fmt = conv->dest_fmt;\
 		uint32_t            pixels_remaining;\
 		uint32_t            lines_remaining = conv->height;\
-		uint32_t			padding_bytes = PADDING_BYTE_COUNT(dest_fmt, conv->width);\
+		uint32_t			padding_bytes = ROW_PADDING_BYTE_COUNT(dest_fmt, conv->width, conv->dest_row_bytes);\
 		uint8_t*			y_src = (uint8_t *) in;\
 		uint8_t*			u_src = y_src + conv->pixel_count;\
 		uint8_t*			v_src = u_src + conv->pixel_count / 2;\
@@ -326,7 +244,7 @@ DEFINE_YUV422P_TO_ANY_RGB(convert_yuv422p_to_any_10bit_rgb_bt709_nonsse, yuv_8bi
 		PixFcPixelFormat 	dest_fmt = conv->dest_fmt;\
 		uint32_t            pixels_remaining;\
 		uint32_t            lines_remaining = conv->height;\
-		uint32_t			padding_bytes = PADDING_BYTE_COUNT(dest_fmt, conv->width);\
+		uint32_t			padding_bytes = ROW_PADDING_BYTE_COUNT(dest_fmt, conv->width, conv->dest_row_bytes);\
 		uint8_t*			y_src = (uint8_t *) in;\
 		uint8_t*			u_src = y_src + conv->pixel_count;\
 		uint8_t*			v_src = u_src + conv->pixel_count / 2;\
@@ -365,7 +283,7 @@ DEFINE_YUV422P_TO_ANY_RGB_FLOAT(convert_yuv422p_to_any_10bit_rgb_bt709_nonsse_fl
 #define DEFINE_UPSAMPLE_N_YUV422P_TO_ANY_RGB(fn_name, coeffs, coef_shift, offsets)\
 	void	fn_name(const struct PixFcSSE* conv, void* in, void* out) {\
 		PixFcPixelFormat 	dest_fmt = conv->dest_fmt;\
-		uint32_t			padding_bytes = PADDING_BYTE_COUNT(dest_fmt, conv->width);\
+		uint32_t			padding_bytes = ROW_PADDING_BYTE_COUNT(dest_fmt, conv->width, conv->dest_row_bytes);\
 		uint32_t 			lines_remaining = conv->height;\
 		uint32_t			pixels_remaining;\
 		uint8_t*			y_src = (uint8_t *) in;\
@@ -417,7 +335,7 @@ DEFINE_UPSAMPLE_N_YUV422P_TO_ANY_RGB(upsample_n_convert_yuv422p_to_any_10bit_rgb
 #define DEFINE_UPSAMPLE_N_YUV422P_TO_ANY_RGB_FLOAT(fn_name, coeffs, offsets)\
 	void	fn_name(const struct PixFcSSE* conv, void* in, void* out) {\
 		PixFcPixelFormat 	dest_fmt = conv->dest_fmt;\
-		uint32_t			padding_bytes = PADDING_BYTE_COUNT(dest_fmt, conv->width);\
+		uint32_t			padding_bytes = ROW_PADDING_BYTE_COUNT(dest_fmt, conv->width, conv->dest_row_bytes);\
 		uint32_t 			lines_remaining = conv->height;\
 		uint32_t			pixels_remaining;\
 		uint8_t*			y_src = (uint8_t *) in;\
@@ -477,20 +395,26 @@ void		convert_yuv422p_to_yuyv_sse2(const struct PixFcSSE* pixfc, void* source_bu
 }
 
 void		convert_yuv422p_to_yuyv_nonsse(const struct PixFcSSE* pixfc, void* source_buffer, void* dest_buffer){
-	uint32_t 	pixel_count = pixfc->pixel_count;
+	uint32_t	padding_bytes = ROW_PADDING_BYTE_COUNT(pixfc->dest_fmt, pixfc->width, pixfc->dest_row_bytes);
+	uint32_t	lines_remaining = pixfc->height;
+	uint32_t 	pixel_count;
 	uint8_t *	y_plane = (uint8_t *) source_buffer;
-	uint8_t *	u_plane = y_plane + pixel_count;
-	uint8_t *	v_plane = u_plane + pixel_count / 2;
+	uint8_t *	u_plane = y_plane + pixfc->pixel_count;
+	uint8_t *	v_plane = u_plane + pixfc->pixel_count / 2;
 	uint8_t *	dst = (uint8_t *) dest_buffer;
 
 	// Do conversion
-	while(pixel_count > 0) {
-		*dst++ = *y_plane++;
-		*dst++ = *u_plane++;
-		*dst++ = *y_plane++;
-		*dst++ = *v_plane++;
-
-		pixel_count -= 2;
+	while(lines_remaining-- > 0) {
+		pixel_count = pixfc->width;
+		while(pixel_count > 0) {
+			*dst++ = *y_plane++;
+			*dst++ = *u_plane++;
+			*dst++ = *y_plane++;
+			*dst++ = *v_plane++;
+
+			pixel_count -= 2;
+		}
+		dst += padding_bytes;
 	}
 }
 
@@ -499,21 +423,72 @@ void		convert_yuv422p_to_uyvy_sse2(const struct PixFcSSE* pixfc, void* source_bu
 }
 
 void		convert_yuv422p_to_uyvy_nonsse(const struct PixFcSSE* pixfc, void* source_buffer, void* dest_buffer){
-	uint32_t 	pixel_count = pixfc->pixel_count;
+	uint32_t	padding_bytes = ROW_PADDING_BYTE_COUNT(pixfc->dest_fmt, pixfc->width, pixfc->dest_row_bytes);
+	uint32_t	lines_remaining = pixfc->height;
+	uint32_t 	pixel_count;
 	uint8_t *	y_plane = (uint8_t *) source_buffer;
-	uint8_t *	u_plane = y_plane + pixel_count;
-	uint8_t *	v_plane = u_plane + pixel_count / 2;
+	uint8_t *	u_plane = y_plane + pixfc->pixel_count;
+	uint8_t *	v_plane = u_plane + pixfc->pixel_count / 2;
 	uint8_t *	dst = (uint8_t *) dest_buffer;
 
 	// Do conversion
-	while(pixel_count > 0) {
-		*dst++ = *u_plane++;
-		*dst++ = *y_plane++;
-		*dst++ = *v_plane++;
-		*dst++ = *y_plane++;
-
-		pixel_count -= 2;
+	while(lines_remaining-- > 0) {
+		pixel_count = pixfc->width;
+		while(pixel_count > 0) {
+			*dst++ = *u_plane++;
+			*dst++ = *y_plane++;
+			*dst++ = *v_plane++;
+			*dst++ = *y_plane++;
+
+			pixel_count -= 2;
+		}
+		dst += padding_bytes;
 	}
 }
 
 
+
+/*
+ * 		Y U V 4 2 2 P  /  Y U V 4 2 0 P
+ *
+ * 		T O
+ *
+ * 		V 2 1 0
+ *
+ */
+// Return the 8-bit sample at 'index' scaled to 10 bits, or 0 past the end of
+// the line, so the last v210 block of a line is padded with zeros.
+#define YUV42XP_SAMPLE(plane, index, count)	(((index) < (count)) ? ((uint32_t)(plane)[(index)] << 2) : 0)
+
+void		convert_yuv42Xp_to_v210_nonsse(const struct PixFcSSE* pixfc, void* source_buffer, void* dest_buffer){
+	uint32_t	chroma_line_shift = (pixfc->source_fmt == PixFcYUV420P) ? 1 : 0;
+	uint32_t	chroma_row_bytes = pixfc->width / 2;
+	uint32_t	line = 0;
+	uint32_t 	pixel;
+	uint32_t 	chroma;
+	uint8_t *	y_plane = (uint8_t *) source_buffer;
+	uint8_t *	u_lines = y_plane + pixfc->pixel_count;
+	uint8_t *	v_lines = u_lines + ((pixfc->pixel_count / 2) >> chroma_line_shift);
+	uint8_t *	u_plane;
+	uint8_t *	v_plane;
+	uint32_t *	dst;
+	uint32_t	w = pixfc->width;
+
+	// This conversion routine only assumes an even number of pixels.
+	while(line < pixfc->height) {
+		u_plane = u_lines + (line >> chroma_line_shift) * chroma_row_bytes;
+		v_plane = v_lines + (line >> chroma_line_shift) * chroma_row_bytes;
+		dst = (uint32_t *) ((uint8_t *) dest_buffer + line * pixfc->dest_row_bytes);
+
+		for(pixel = 0; pixel < w; pixel += 6) {
+			chroma = pixel / 2;
+			*dst++ = YUV42XP_SAMPLE(u_plane, chroma, chroma_row_bytes) | (YUV42XP_SAMPLE(y_plane, pixel, w) << 10) | (YUV42XP_SAMPLE(v_plane, chroma, chroma_row_bytes) << 20);
+			*dst++ = YUV42XP_SAMPLE(y_plane, pixel + 1, w) | (YUV42XP_SAMPLE(u_plane, chroma + 1, chroma_row_bytes) << 10) | (YUV42XP_SAMPLE(y_plane, pixel + 2, w) << 20);
+			*dst++ = YUV42XP_SAMPLE(v_plane, chroma + 1, chroma_row_bytes) | (YUV42XP_SAMPLE(y_plane, pixel + 3, w) << 10) | (YUV42XP_SAMPLE(u_plane, chroma + 2, chroma_row_bytes) << 20);
+			*dst++ = YUV42XP_SAMPLE(y_plane, pixel + 4, w) | (YUV42XP_SAMPLE(v_plane, chroma + 2, chroma_row_bytes) << 10) | (YUV42XP_SAMPLE(y_plane, pixel + 5, w) << 20);
+		}
+
+		y_plane += w;
+		line++;
+	}
+}
@@ -247,4 +247,59 @@ void		convert_yuv422p_to_yuyv_nonsse(const struct PixFcSSE*, void*, void*);
 void		convert_yuv422p_to_uyvy_sse2(const struct PixFcSSE*, void*, void*);
 void		convert_yuv422p_to_uyvy_nonsse(const struct PixFcSSE*, void*, void*);
 
+
+/*
+ * 		Y U V 4 2 2 P  /  Y U V 4 2 0 P
+ *
+ * 		T O
+ *
+ * 		V 2 1 0
+ *
+ */
+void		convert_yuv422p_to_v210_sse2_ssse3_sse41(const struct PixFcSSE*, void*, void*);
+void		convert_yuv422p_to_v210_sse2_ssse3(const struct PixFcSSE*, void*, void*);
+void		convert_yuv42Xp_to_v210_nonsse(const struct PixFcSSE*, void*, void*);
+
+/*
+ *
+ *
+ *	A V X 2
+ *
+ *  C O N V E R S I O N S
+ *
+ *
+ */
+// YUV422P to ARGB		AVX2
+void		upsample_n_convert_yuv422p_to_argb_avx2(const struct PixFcSSE *, void *, void *);
+void		convert_yuv422p_to_argb_avx2(const struct PixFcSSE *, void *, void *);
+void		upsample_n_convert_yuv422p_to_argb_bt601_avx2(const struct PixFcSSE *, void *, void *);
+void		convert_yuv422p_to_argb_bt601_avx2(const struct PixFcSSE *, void *, void *);
+void		upsample_n_convert_yuv422p_to_argb_bt709_avx2(const struct PixFcSSE *, void *, void *);
+void		convert_yuv422p_to_argb_bt709_avx2(const struct PixFcSSE *, void *, void *);
+
+// YUV422P to BGRA		AVX2
+void		upsample_n_convert_yuv422p_to_bgra_avx2(const struct PixFcSSE *, void *, void *);
+void		convert_yuv422p_to_bgra_avx2(const struct PixFcSSE *, void *, void *);
+void		upsample_n_convert_yuv422p_to_bgra_bt601_avx2(const struct PixFcSSE *, void *, void *);
+void		convert_yuv422p_to_bgra_bt601_avx2(const struct PixFcSSE *, void *, void *);
+void		upsample_n_convert_yuv422p_to_bgra_bt709_avx2(const struct PixFcSSE *, void *, void *);
+void		convert_yuv422p_to_bgra_bt709_avx2(const struct PixFcSSE *, void *, void *);
+
+// YUV422P to RGB24		AVX2
+void		upsample_n_convert_yuv422p_to_rgb24_avx2(const struct PixFcSSE *, void *, void *);
+void		convert_yuv422p_to_rgb24_avx2(const struct PixFcSSE *, void *, void *);
+void		upsample_n_convert_yuv422p_to_rgb24_bt601_avx2(const struct PixFcSSE *, void *, void *);
+void		convert_yuv422p_to_rgb24_bt601_avx2(const struct PixFcSSE *, void *, void *);
+void		upsample_n_convert_yuv422p_to_rgb24_bt709_avx2(const struct PixFcSSE *, void *, void *);
+void		convert_yuv422p_to_rgb24_bt709_avx2(const struct PixFcSSE *, void *, void *);
+
+// YUV422P to BGR24		AVX2
+void		upsample_n_convert_yuv422p_to_bgr24_avx2(const struct PixFcSSE *, void *, void *);
+void		convert_yuv422p_to_bgr24_avx2(const struct PixFcSSE *, void *, void *);
+void		upsample_n_convert_yuv422p_to_bgr24_bt601_avx2(const struct PixFcSSE *, void *, void *);
+void		convert_yuv422p_to_bgr24_bt601_avx2(const struct PixFcSSE *, void *, void *);
+void		upsample_n_convert_yuv422p_to_bgr24_bt709_avx2(const struct PixFcSSE *, void *, void *);
+void		convert_yuv422p_to_bgr24_bt709_avx2(const struct PixFcSSE *, void *, void *);
+
+
 #endif /* CONVERSION_ROUTINES_FROM_YUV422_H_ */
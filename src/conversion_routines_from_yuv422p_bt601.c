@@ -72,30 +72,6 @@
 				instr_set\
 		)
 
-#define UPSAMPLE_AND_CONVERT_TO_RGB10(pack_fn, instr_set)\
-		DO_CONVERSION_3U_1P(\
-				UPSAMPLE_YUV422P_TO_RGB_RECIPE,\
-				unpack_yuv42Xp_to_2_y_vectors_sse2,\
-				unpack_low_yuv42Xp_to_uv_vector_sse2,\
-				unpack_high_yuv42Xp_to_uv_vector_sse2,\
-				pack_fn,\
-				convert_8bit_y_uv_vectors_to_10bit_rgb_vectors_bt601_,\
-				4,\
-				instr_set\
-		)
-
-#define CONVERT_TO_RGB10(pack_fn, instr_set)\
-		DO_CONVERSION_3U_1P(\
-				YUV422P_TO_RGB_RECIPE,\
-				unpack_yuv42Xp_to_2_y_vectors_sse2,\
-				unpack_low_yuv42Xp_to_uv_vector_sse2,\
-				unpack_high_yuv42Xp_to_uv_vector_sse2,\
-				pack_fn,\
-				nnb_upsample_n_convert_8bit_y_uv_vectors_to_10bit_rgb_vectors_bt601_,\
-				4,\
-				instr_set\
-		)
-
 /*
  *
  * 		Y U V 4 2 2 P
@@ -104,14 +80,6 @@
  *
  * 		A R G B
  */
-void		upsample_n_convert_yuv422p_to_argb_bt601_sse2_ssse3(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
-	 UPSAMPLE_AND_CONVERT_TO_RGB32(pack_6_rgb_vectors_in_4_argb_vectors_sse2, sse2_ssse3);
-}
-
-void		convert_yuv422p_to_argb_bt601_sse2_ssse3(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
-	CONVERT_TO_RGB32(pack_6_rgb_vectors_in_4_argb_vectors_sse2,	sse2_ssse3);
-}
-
 void		upsample_n_convert_yuv422p_to_argb_bt601_sse2(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
 	UPSAMPLE_AND_CONVERT_TO_RGB32(pack_6_rgb_vectors_in_4_argb_vectors_sse2, sse2);
 }
@@ -128,14 +96,6 @@ void		convert_yuv422p_to_argb_bt601_sse2(const struct PixFcSSE * pixfc, void* so
  * 		B G R A
  *
  */
-void		upsample_n_convert_yuv422p_to_bgra_bt601_sse2_ssse3(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
-	UPSAMPLE_AND_CONVERT_TO_RGB32(pack_6_rgb_vectors_in_4_bgra_vectors_sse2, sse2_ssse3);
-}
-
-void		convert_yuv422p_to_bgra_bt601_sse2_ssse3(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
-	CONVERT_TO_RGB32(pack_6_rgb_vectors_in_4_bgra_vectors_sse2,	sse2_ssse3);
-}
-
 void		upsample_n_convert_yuv422p_to_bgra_bt601_sse2(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
 	UPSAMPLE_AND_CONVERT_TO_RGB32(pack_6_rgb_vectors_in_4_bgra_vectors_sse2, sse2);
 }
@@ -153,14 +113,6 @@ void		convert_yuv422p_to_bgra_bt601_sse2(const struct PixFcSSE * pixfc, void* so
  *
  * 		R G B   2 4
  */
-void		upsample_n_convert_yuv422p_to_rgb24_bt601_sse2_ssse3(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
-	UPSAMPLE_AND_CONVERT_TO_RGB24(pack_6_rgb_vectors_in_3_rgb24_vectors_sse2_ssse3, sse2_ssse3);
-}
-
-void		convert_yuv422p_to_rgb24_bt601_sse2_ssse3(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
-	CONVERT_TO_RGB24(pack_6_rgb_vectors_in_3_rgb24_vectors_sse2_ssse3, sse2_ssse3);
-}
-
 void		upsample_n_convert_yuv422p_to_rgb24_bt601_sse2(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
 	UPSAMPLE_AND_CONVERT_TO_RGB24(pack_6_rgb_vectors_to_3_rgb24_vectors_sse2_slowpacking, sse2);
 }
@@ -178,14 +130,6 @@ void		convert_yuv422p_to_rgb24_bt601_sse2(const struct PixFcSSE * pixfc, void* s
  * 		B G R 2 4
  *
  */
-void		upsample_n_convert_yuv422p_to_bgr24_bt601_sse2_ssse3(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
-	UPSAMPLE_AND_CONVERT_TO_RGB24(pack_6_rgb_vectors_in_3_bgr24_vectors_sse2_ssse3, sse2_ssse3);
-}
-
-void		convert_yuv422p_to_bgr24_bt601_sse2_ssse3(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
-	CONVERT_TO_RGB24(pack_6_rgb_vectors_in_3_bgr24_vectors_sse2_ssse3, sse2_ssse3);
-}
-
 void		upsample_n_convert_yuv422p_to_bgr24_bt601_sse2(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
 	UPSAMPLE_AND_CONVERT_TO_RGB24(pack_6_rgb_vectors_to_3_bgr24_vectors_sse2_slowpacking, sse2);
 }
@@ -193,31 +137,3 @@ void		upsample_n_convert_yuv422p_to_bgr24_bt601_sse2(const struct PixFcSSE * pix
 void		convert_yuv422p_to_bgr24_bt601_sse2(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
 	CONVERT_TO_RGB24(pack_6_rgb_vectors_to_3_bgr24_vectors_sse2_slowpacking, sse2);
 }
-
-
-/*
- *
- * 		Y U V Y
- *
- * 		to
- *
- * 		1 0 B I T   R G B 
- *
- */
-void		upsample_n_convert_yuv422p_to_r210_bt601_sse2_ssse3(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
-	UPSAMPLE_AND_CONVERT_TO_RGB10(pack_6_r_g_b_vectors_to_4_r210_sse2_ssse3, sse2_ssse3);
-}
-
-void		convert_yuv422p_to_r210_bt601_sse2_ssse3(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
-	CONVERT_TO_RGB10(pack_6_r_g_b_vectors_to_4_r210_sse2_ssse3, sse2_ssse3);
-}
-
-void		upsample_n_convert_yuv422p_to_r10k_bt601_sse2_ssse3(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
-	UPSAMPLE_AND_CONVERT_TO_RGB10(pack_6_r_g_b_vectors_to_4_r10k_sse2_ssse3, sse2_ssse3);
-}
-
-void		convert_yuv422p_to_r10k_bt601_sse2_ssse3(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
-	CONVERT_TO_RGB10(pack_6_r_g_b_vectors_to_4_r10k_sse2_ssse3, sse2_ssse3);
-}
-
-
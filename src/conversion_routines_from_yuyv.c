@@ -43,6 +43,29 @@
 				instr_set\
 		)
 
+#define DOWNSCALE_AND_CONVERT_TO_RGB(pack_fn, output_stride, instr_set)\
+		if (PIXFC_DOWNSCALE_FACTOR(pixfc->flags) == 2) {\
+			DO_CONVERSION_1U_1P(\
+					DOWNSCALE_YUV422I_TO_RGB_RECIPE,\
+					unpack_yuyv_to_y_uv_vectors_,\
+					pack_fn,\
+					convert_y_uv_vectors_to_rgb_vectors_,\
+					output_stride,\
+					2,\
+					instr_set\
+			)\
+		} else {\
+			DO_CONVERSION_1U_1P(\
+					DOWNSCALE_YUV422I_TO_RGB_RECIPE,\
+					unpack_yuyv_to_y_uv_vectors_,\
+					pack_fn,\
+					convert_y_uv_vectors_to_rgb_vectors_,\
+					output_stride,\
+					4,\
+					instr_set\
+			)\
+		}
+
 
 
 #define CONVERT_TO_RGB32(pack_fn, instr_set)\
@@ -65,27 +88,6 @@
 				instr_set\
 		)
 
-#define UPSAMPLE_AND_CONVERT_TO_RGB10(pack_fn, instr_set) \
-		DO_CONVERSION_1U_1P(\
-				UPSAMPLE_YUV422I_TO_RGB_RECIPE,\
-				unpack_yuyv_to_y_uv_vectors_,\
-				pack_fn,\
-				convert_8bit_y_uv_vectors_to_10bit_rgb_vectors_,\
-				4,\
-				instr_set\
-		)
-
-#define CONVERT_TO_RGB10(pack_fn, instr_set)\
-		DO_CONVERSION_1U_1P(\
-				YUV422I_TO_RGB_RECIPE,\
-				unpack_yuyv_to_y_uv_vectors_,\
-				pack_fn,\
-				nnb_upsample_n_convert_8bit_y_uv_vectors_to_10bit_rgb_vectors_,\
-				4,\
-				instr_set\
-		)
-
-
 /*
  *
  * 		Y U Y V
@@ -94,14 +96,6 @@
  *
  * 		A R G B
  */
-void		upsample_n_convert_yuyv_to_argb_sse2_ssse3(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
-	 UPSAMPLE_AND_CONVERT_TO_RGB32(pack_6_rgb_vectors_in_4_argb_vectors_sse2, sse2_ssse3);
-}
-
-void		convert_yuyv_to_argb_sse2_ssse3(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
-	CONVERT_TO_RGB32(pack_6_rgb_vectors_in_4_argb_vectors_sse2,	sse2_ssse3);
-}
-
 void		upsample_n_convert_yuyv_to_argb_sse2(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
 	UPSAMPLE_AND_CONVERT_TO_RGB32(pack_6_rgb_vectors_in_4_argb_vectors_sse2, sse2);
 }
@@ -110,6 +104,10 @@ void		convert_yuyv_to_argb_sse2(const struct PixFcSSE * pixfc, void* source_buff
 	CONVERT_TO_RGB32(pack_6_rgb_vectors_in_4_argb_vectors_sse2, sse2);
 }
 
+void		downscale_n_convert_yuyv_to_argb_sse2(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
+	DOWNSCALE_AND_CONVERT_TO_RGB(pack_6_rgb_vectors_in_4_argb_vectors_sse2, 4, sse2);
+}
+
 
 /*
  * 		Y U Y V
@@ -119,14 +117,6 @@ void		convert_yuyv_to_argb_sse2(const struct PixFcSSE * pixfc, void* source_buff
  * 		B G R A
  *
  */
-void		upsample_n_convert_yuyv_to_bgra_sse2_ssse3(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
-	UPSAMPLE_AND_CONVERT_TO_RGB32(pack_6_rgb_vectors_in_4_bgra_vectors_sse2, sse2_ssse3);
-}
-
-void		convert_yuyv_to_bgra_sse2_ssse3(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
-	CONVERT_TO_RGB32(pack_6_rgb_vectors_in_4_bgra_vectors_sse2,	sse2_ssse3);
-}
-
 void		upsample_n_convert_yuyv_to_bgra_sse2(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
 	UPSAMPLE_AND_CONVERT_TO_RGB32(pack_6_rgb_vectors_in_4_bgra_vectors_sse2, sse2);
 }
@@ -135,6 +125,10 @@ void		convert_yuyv_to_bgra_sse2(const struct PixFcSSE * pixfc, void* source_buff
 	CONVERT_TO_RGB32(pack_6_rgb_vectors_in_4_bgra_vectors_sse2, sse2);
 }
 
+void		downscale_n_convert_yuyv_to_bgra_sse2(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
+	DOWNSCALE_AND_CONVERT_TO_RGB(pack_6_rgb_vectors_in_4_bgra_vectors_sse2, 4, sse2);
+}
+
 
 /*
  *
@@ -144,14 +138,6 @@ void		convert_yuyv_to_bgra_sse2(const struct PixFcSSE * pixfc, void* source_buff
  *
  * 		R G B   2 4
  */
-void		upsample_n_convert_yuyv_to_rgb24_sse2_ssse3(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
-	UPSAMPLE_AND_CONVERT_TO_RGB24(pack_6_rgb_vectors_in_3_rgb24_vectors_sse2_ssse3, sse2_ssse3);
-}
-
-void		convert_yuyv_to_rgb24_sse2_ssse3(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
-	CONVERT_TO_RGB24(pack_6_rgb_vectors_in_3_rgb24_vectors_sse2_ssse3, sse2_ssse3);
-}
-
 void		upsample_n_convert_yuyv_to_rgb24_sse2(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
 	UPSAMPLE_AND_CONVERT_TO_RGB24(pack_6_rgb_vectors_to_3_rgb24_vectors_sse2_slowpacking, sse2);
 }
@@ -160,6 +146,10 @@ void		convert_yuyv_to_rgb24_sse2(const struct PixFcSSE * pixfc, void* source_buf
 	CONVERT_TO_RGB24(pack_6_rgb_vectors_to_3_rgb24_vectors_sse2_slowpacking, sse2);
 }
 
+void		downscale_n_convert_yuyv_to_rgb24_sse2(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
+	DOWNSCALE_AND_CONVERT_TO_RGB(pack_6_rgb_vectors_to_3_rgb24_vectors_sse2_slowpacking, 3, sse2);
+}
+
 /*
  *
  * 		Y U V Y
@@ -169,14 +159,6 @@ void		convert_yuyv_to_rgb24_sse2(const struct PixFcSSE * pixfc, void* source_buf
  * 		B G R 2 4
  *
  */
-void		upsample_n_convert_yuyv_to_bgr24_sse2_ssse3(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
-	UPSAMPLE_AND_CONVERT_TO_RGB24(pack_6_rgb_vectors_in_3_bgr24_vectors_sse2_ssse3, sse2_ssse3);
-}
-
-void		convert_yuyv_to_bgr24_sse2_ssse3(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
-	CONVERT_TO_RGB24(pack_6_rgb_vectors_in_3_bgr24_vectors_sse2_ssse3, sse2_ssse3);
-}
-
 void		upsample_n_convert_yuyv_to_bgr24_sse2(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
 	UPSAMPLE_AND_CONVERT_TO_RGB24(pack_6_rgb_vectors_to_3_bgr24_vectors_sse2_slowpacking, sse2);
 }
@@ -185,30 +167,8 @@ void		convert_yuyv_to_bgr24_sse2(const struct PixFcSSE * pixfc, void* source_buf
 	CONVERT_TO_RGB24(pack_6_rgb_vectors_to_3_bgr24_vectors_sse2_slowpacking, sse2);
 }
 
-
-/*
- *
- * 		Y U V Y
- *
- * 		to
- *
- * 		1 0 B I T  R G B
- *
- */
-void		upsample_n_convert_yuyv_to_r210_sse2_ssse3(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
-	UPSAMPLE_AND_CONVERT_TO_RGB10(pack_6_r_g_b_vectors_to_4_r210_sse2_ssse3, sse2_ssse3);
-}
-
-void		convert_yuyv_to_r210_sse2_ssse3(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
-	CONVERT_TO_RGB10(pack_6_r_g_b_vectors_to_4_r210_sse2_ssse3, sse2_ssse3);
-}
-
-void		upsample_n_convert_yuyv_to_r10k_sse2_ssse3(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
-	UPSAMPLE_AND_CONVERT_TO_RGB10(pack_6_r_g_b_vectors_to_4_r10k_sse2_ssse3, sse2_ssse3);
-}
-
-void		convert_yuyv_to_r10k_sse2_ssse3(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
-	CONVERT_TO_RGB10(pack_6_r_g_b_vectors_to_4_r10k_sse2_ssse3, sse2_ssse3);
+void		downscale_n_convert_yuyv_to_bgr24_sse2(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
+	DOWNSCALE_AND_CONVERT_TO_RGB(pack_6_rgb_vectors_to_3_bgr24_vectors_sse2_slowpacking, 3, sse2);
 }
 
 
@@ -221,7 +181,7 @@ void 		convert_yuyv_to_rgb_original(const struct PixFcSSE* conv, void* in, void*
 	__m128i*	rgb_out_buf = (__m128i *) out;
 	uint32_t	pixel_count = conv->pixel_count;
 	__m128i		unpack_out[2];
-	__m128i		convert_out[6];
+	__m128i		convert_out[7];	// the 7th vector is read (but unused) by the slow packing routine
 	while(pixel_count > 0) {
 		unpack_yuyv_to_y_u_v_vectors_sse2(yuyv_8pixels, unpack_out);
 		nnb_upsample_n_convert_y_uv_vectors_to_rgb_vectors_sse2(unpack_out, convert_out);
@@ -247,29 +207,45 @@ void		convert_yuyv_to_yuv422p_sse2(const struct PixFcSSE * pixfc, void* source_b
 	DO_REPACK(YUV422I_TO_YUV422P_RECIPE, repack_yuyv_to_yuv422p_, sse2);
 }
 
-void		convert_yuyv_to_yuv422p_sse2_ssse3(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
-	DO_REPACK(YUV422I_TO_YUV422P_RECIPE, repack_yuyv_to_yuv422p_, sse2_ssse3);
+/*
+ *  	Y U Y V
+ *
+ * 		T O
+ *
+ * 		N V 1 2  /  N V 2 1
+ */
+void		convert_yuyv_to_nv12_sse2(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
+	DO_REPACK(YUV422I_TO_NV12_RECIPE, repack_yuyv_to_nv12_, sse2);
 }
 
-
+void		convert_yuyv_to_nv21_sse2(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
+	DO_REPACK(YUV422I_TO_NV12_RECIPE, repack_yuyv_to_nv21_, sse2);
+}
 
 
 /*
+ *  	Y U Y V
  *
- *	Y U Y V
- *
- *	T O
- *
- *	V 2 1 0
- *
+ * 		T O
  *
+ * 		Y U V 4 2 0 P
  */
-// YUYV to V210
-void		convert_yuyv_to_v210_sse2_ssse3_sse41(const struct PixFcSSE* pixfc, void* source_buffer, void* dest_buffer) {
-	DO_REPACK2(YUV422I_TO_V210_RECIPE, unpack_yuyv_to_y_uv_vectors_sse2_ssse3, pack_6_y_uv_vectors_to_4_v210_vectors_sse2_ssse3_sse41);
+void		convert_yuyv_to_yuv420p_sse2(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
+	DO_REPACK(YUV422I_TO_YUV420P_RECIPE, repack_yuyv_to_yuv420p_, sse2);
 }
 
-void		convert_yuyv_to_v210_sse2_ssse3(const struct PixFcSSE* pixfc, void* source_buffer, void* dest_buffer) {
-	DO_REPACK2(YUV422I_TO_V210_RECIPE, unpack_yuyv_to_y_uv_vectors_sse2_ssse3, pack_6_y_uv_vectors_to_4_v210_vectors_sse2_ssse3);
+void		downsample_n_convert_yuyv_to_yuv420p_sse2(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
+	DO_REPACK(YUV422I_TO_YUV420P_RECIPE, downsample_n_repack_yuyv_to_yuv420p_, sse2);
 }
 
+
+/*
+ *  	Y U Y V
+ *
+ * 		T O
+ *
+ * 		U Y V Y
+ */
+void		convert_yuyv_to_uyvy_sse2(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
+	DO_REPACK(YUV422I_TO_YUV422I_RECIPE, repack_yuv422i_to_yuv422i_, sse2);
+}
@@ -36,33 +36,41 @@
 // YUYV to ARGB			SSE2 SSS3
 void		upsample_n_convert_yuyv_to_argb_sse2_ssse3(const struct PixFcSSE *, void *, void *);
 void		convert_yuyv_to_argb_sse2_ssse3(const struct PixFcSSE *, void *, void *);
+void		downscale_n_convert_yuyv_to_argb_sse2_ssse3(const struct PixFcSSE *, void *, void *);
 // YUYV to ARGB  		SSE2
 void		upsample_n_convert_yuyv_to_argb_sse2(const struct PixFcSSE *, void *, void *);
 void		convert_yuyv_to_argb_sse2(const struct PixFcSSE *, void *, void *);
+void		downscale_n_convert_yuyv_to_argb_sse2(const struct PixFcSSE *, void *, void *);
 
 
 // YUYV to BGRA 		SSE2 SSSE3
 void		upsample_n_convert_yuyv_to_bgra_sse2_ssse3(const struct PixFcSSE *, void* , void*);
 void		convert_yuyv_to_bgra_sse2_ssse3(const struct PixFcSSE *, void *, void *);
+void		downscale_n_convert_yuyv_to_bgra_sse2_ssse3(const struct PixFcSSE *, void *, void *);
 // YUYV to BGRA 		SSE2
 void		upsample_n_convert_yuyv_to_bgra_sse2(const struct PixFcSSE *, void*, void*);
 void		convert_yuyv_to_bgra_sse2(const struct PixFcSSE *, void *, void *);
+void		downscale_n_convert_yuyv_to_bgra_sse2(const struct PixFcSSE *, void *, void *);
 
 
 // YUYV to RGB24		SSE2 SSSE3
 void		upsample_n_convert_yuyv_to_rgb24_sse2_ssse3(const struct PixFcSSE *, void*, void*);
 void		convert_yuyv_to_rgb24_sse2_ssse3(const struct PixFcSSE *, void *, void *);
+void		downscale_n_convert_yuyv_to_rgb24_sse2_ssse3(const struct PixFcSSE *, void *, void *);
 // YUYV to RGB24		SSE2 slow repacking
 void		upsample_n_convert_yuyv_to_rgb24_sse2(const struct PixFcSSE *, void *, void *);
 void		convert_yuyv_to_rgb24_sse2(const struct PixFcSSE *, void *, void *);
+void		downscale_n_convert_yuyv_to_rgb24_sse2(const struct PixFcSSE *, void *, void *);
 
 
 // YUYV to BGR24		SSE2 SSSE3
 void		upsample_n_convert_yuyv_to_bgr24_sse2_ssse3(const struct PixFcSSE *, void *, void *);
 void		convert_yuyv_to_bgr24_sse2_ssse3(const struct PixFcSSE *, void*, void*);
+void		downscale_n_convert_yuyv_to_bgr24_sse2_ssse3(const struct PixFcSSE *, void *, void *);
 // YUYV to BGR24		SSE2 slow repacking
 void		upsample_n_convert_yuyv_to_bgr24_sse2(const struct PixFcSSE *, void *, void *);
 void		convert_yuyv_to_bgr24_sse2(const struct PixFcSSE *, void *, void *);
+void		downscale_n_convert_yuyv_to_bgr24_sse2(const struct PixFcSSE *, void *, void *);
 
 
 // YUYV to r210			SSE2 SSSE3
@@ -78,12 +86,14 @@ void		convert_yuyv_to_r10k_sse2_ssse3(const struct PixFcSSE *, void *, void *);
 // anyYUV422I to anyRGB		NON SSE integer
 void 		convert_yuv422i_to_any_rgb_nonsse(const struct PixFcSSE*, void*, void*);
 void		upsample_n_convert_yuv422i_to_any_rgb_nonsse(const struct PixFcSSE*, void*, void*);
+void		downscale_n_convert_yuv422i_to_any_rgb_nonsse(const struct PixFcSSE*, void*, void*);
 void 		convert_yuv422i_to_any_10bit_rgb_nonsse(const struct PixFcSSE*, void*, void*);
 void		upsample_n_convert_yuv422i_to_any_10bit_rgb_nonsse(const struct PixFcSSE*, void*, void*);
 
 // anyYUV422I to anyRGB		NON SSE float
 void 		convert_yuv422i_to_any_rgb_nonsse_float(const struct PixFcSSE*, void*, void*);
 void		upsample_n_convert_yuv422i_to_any_rgb_nonsse_float(const struct PixFcSSE*, void*, void*);
+void		downscale_n_convert_yuv422i_to_any_rgb_nonsse_float(const struct PixFcSSE*, void*, void*);
 void 		convert_yuv422i_to_any_10bit_rgb_nonsse_float(const struct PixFcSSE*, void*, void*);
 void		upsample_n_convert_yuv422i_to_any_10bit_rgb_nonsse_float(const struct PixFcSSE*, void*, void*);
 
@@ -106,33 +116,41 @@ void		upsample_n_convert_yuv422i_to_any_10bit_rgb_nonsse_float(const struct PixF
 // YUYV to ARGB			SSE2 SSS3
 void		upsample_n_convert_yuyv_to_argb_bt601_sse2_ssse3(const struct PixFcSSE *, void *, void *);
 void		convert_yuyv_to_argb_bt601_sse2_ssse3(const struct PixFcSSE *, void *, void *);
+void		downscale_n_convert_yuyv_to_argb_bt601_sse2_ssse3(const struct PixFcSSE *, void *, void *);
 // YUYV to ARGB  		SSE2
 void		upsample_n_convert_yuyv_to_argb_bt601_sse2(const struct PixFcSSE *, void *, void *);
 void		convert_yuyv_to_argb_bt601_sse2(const struct PixFcSSE *, void *, void *);
+void		downscale_n_convert_yuyv_to_argb_bt601_sse2(const struct PixFcSSE *, void *, void *);
 
 
 // YUYV to BGRA 		SSE2 SSSE3
 void		upsample_n_convert_yuyv_to_bgra_bt601_sse2_ssse3(const struct PixFcSSE *, void* , void*);
 void		convert_yuyv_to_bgra_bt601_sse2_ssse3(const struct PixFcSSE *, void *, void *);
+void		downscale_n_convert_yuyv_to_bgra_bt601_sse2_ssse3(const struct PixFcSSE *, void *, void *);
 // YUYV to BGRA 		SSE2
 void		upsample_n_convert_yuyv_to_bgra_bt601_sse2(const struct PixFcSSE *, void*, void*);
 void		convert_yuyv_to_bgra_bt601_sse2(const struct PixFcSSE *, void *, void *);
+void		downscale_n_convert_yuyv_to_bgra_bt601_sse2(const struct PixFcSSE *, void *, void *);
 
 
 // YUYV to RGB24		SSE2 SSSE3
 void		upsample_n_convert_yuyv_to_rgb24_bt601_sse2_ssse3(const struct PixFcSSE *, void*, void*);
 void		convert_yuyv_to_rgb24_bt601_sse2_ssse3(const struct PixFcSSE *, void *, void *);
+void		downscale_n_convert_yuyv_to_rgb24_bt601_sse2_ssse3(const struct PixFcSSE *, void *, void *);
 // YUYV to RGB24		SSE2 slow repacking
 void		upsample_n_convert_yuyv_to_rgb24_bt601_sse2(const struct PixFcSSE *, void *, void *);
 void		convert_yuyv_to_rgb24_bt601_sse2(const struct PixFcSSE *, void *, void *);
+void		downscale_n_convert_yuyv_to_rgb24_bt601_sse2(const struct PixFcSSE *, void *, void *);
 
 
 // YUYV to BGR24		SSE2 SSSE3
 void		upsample_n_convert_yuyv_to_bgr24_bt601_sse2_ssse3(const struct PixFcSSE *, void *, void *);
 void		convert_yuyv_to_bgr24_bt601_sse2_ssse3(const struct PixFcSSE *, void*, void*);
+void		downscale_n_convert_yuyv_to_bgr24_bt601_sse2_ssse3(const struct PixFcSSE *, void *, void *);
 // YUYV to BGR24		SSE2 slow repacking
 void		upsample_n_convert_yuyv_to_bgr24_bt601_sse2(const struct PixFcSSE *, void *, void *);
 void		convert_yuyv_to_bgr24_bt601_sse2(const struct PixFcSSE *, void *, void *);
+void		downscale_n_convert_yuyv_to_bgr24_bt601_sse2(const struct PixFcSSE *, void *, void *);
 
 
 // YUYV to r210			SSE2 SSSE3
@@ -148,12 +166,14 @@ void		convert_yuyv_to_r10k_bt601_sse2_ssse3(const struct PixFcSSE *, void *, voi
 // anyYUV422I to anyRGB		NON SSE integer
 void 		convert_yuv422i_to_any_rgb_bt601_nonsse(const struct PixFcSSE*, void*, void*);
 void		upsample_n_convert_yuv422i_to_any_rgb_bt601_nonsse(const struct PixFcSSE*, void*, void*);
+void		downscale_n_convert_yuv422i_to_any_rgb_bt601_nonsse(const struct PixFcSSE*, void*, void*);
 void 		convert_yuv422i_to_any_10bit_rgb_bt601_nonsse(const struct PixFcSSE*, void*, void*);
 void		upsample_n_convert_yuv422i_to_any_10bit_rgb_bt601_nonsse(const struct PixFcSSE*, void*, void*);
 
 // anyYUV422I to anyRGB		NON SSE float
 void 		convert_yuv422i_to_any_rgb_bt601_nonsse_float(const struct PixFcSSE*, void*, void*);
 void		upsample_n_convert_yuv422i_to_any_rgb_bt601_nonsse_float(const struct PixFcSSE*, void*, void*);
+void		downscale_n_convert_yuv422i_to_any_rgb_bt601_nonsse_float(const struct PixFcSSE*, void*, void*);
 void 		convert_yuv422i_to_any_10bit_rgb_bt601_nonsse_float(const struct PixFcSSE*, void*, void*);
 void		upsample_n_convert_yuv422i_to_any_10bit_rgb_bt601_nonsse_float(const struct PixFcSSE*, void*, void*);
 
@@ -173,33 +193,41 @@ void		upsample_n_convert_yuv422i_to_any_10bit_rgb_bt601_nonsse_float(const struc
 // YUYV to ARGB			SSE2 SSS3
 void		upsample_n_convert_yuyv_to_argb_bt709_sse2_ssse3(const struct PixFcSSE *, void *, void *);
 void		convert_yuyv_to_argb_bt709_sse2_ssse3(const struct PixFcSSE *, void *, void *);
+void		downscale_n_convert_yuyv_to_argb_bt709_sse2_ssse3(const struct PixFcSSE *, void *, void *);
 // YUYV to ARGB  		SSE2
 void		upsample_n_convert_yuyv_to_argb_bt709_sse2(const struct PixFcSSE *, void *, void *);
 void		convert_yuyv_to_argb_bt709_sse2(const struct PixFcSSE *, void *, void *);
+void		downscale_n_convert_yuyv_to_argb_bt709_sse2(const struct PixFcSSE *, void *, void *);
 
 
 // YUYV to BGRA 		SSE2 SSSE3
 void		upsample_n_convert_yuyv_to_bgra_bt709_sse2_ssse3(const struct PixFcSSE *, void* , void*);
 void		convert_yuyv_to_bgra_bt709_sse2_ssse3(const struct PixFcSSE *, void *, void *);
+void		downscale_n_convert_yuyv_to_bgra_bt709_sse2_ssse3(const struct PixFcSSE *, void *, void *);
 // YUYV to BGRA 		SSE2
 void		upsample_n_convert_yuyv_to_bgra_bt709_sse2(const struct PixFcSSE *, void*, void*);
 void		convert_yuyv_to_bgra_bt709_sse2(const struct PixFcSSE *, void *, void *);
+void		downscale_n_convert_yuyv_to_bgra_bt709_sse2(const struct PixFcSSE *, void *, void *);
 
 
 // YUYV to RGB24		SSE2 SSSE3
 void		upsample_n_convert_yuyv_to_rgb24_bt709_sse2_ssse3(const struct PixFcSSE *, void*, void*);
 void		convert_yuyv_to_rgb24_bt709_sse2_ssse3(const struct PixFcSSE *, void *, void *);
+void		downscale_n_convert_yuyv_to_rgb24_bt709_sse2_ssse3(const struct PixFcSSE *, void *, void *);
 // YUYV to RGB24		SSE2 slow repacking
 void		upsample_n_convert_yuyv_to_rgb24_bt709_sse2(const struct PixFcSSE *, void *, void *);
 void		convert_yuyv_to_rgb24_bt709_sse2(const struct PixFcSSE *, void *, void *);
+void		downscale_n_convert_yuyv_to_rgb24_bt709_sse2(const struct PixFcSSE *, void *, void *);
 
 
 // YUYV to BGR24		SSE2 SSSE3
 void		upsample_n_convert_yuyv_to_bgr24_bt709_sse2_ssse3(const struct PixFcSSE *, void *, void *);
 void		convert_yuyv_to_bgr24_bt709_sse2_ssse3(const struct PixFcSSE *, void*, void*);
+void		downscale_n_convert_yuyv_to_bgr24_bt709_sse2_ssse3(const struct PixFcSSE *, void *, void *);
 // YUYV to BGR24		SSE2 slow repacking
 void		upsample_n_convert_yuyv_to_bgr24_bt709_sse2(const struct PixFcSSE *, void *, void *);
 void		convert_yuyv_to_bgr24_bt709_sse2(const struct PixFcSSE *, void *, void *);
+void		downscale_n_convert_yuyv_to_bgr24_bt709_sse2(const struct PixFcSSE *, void *, void *);
 
 
 // YUYV to r210			SSE2 SSSE3
@@ -215,12 +243,14 @@ void		convert_yuyv_to_r10k_bt709_sse2_ssse3(const struct PixFcSSE *, void *, voi
 // anyYUV422I to anyRGB		NON SSE integer
 void 		convert_yuv422i_to_any_rgb_bt709_nonsse(const struct PixFcSSE* , void* , void* );
 void		upsample_n_convert_yuv422i_to_any_rgb_bt709_nonsse(const struct PixFcSSE*, void*, void*);
+void		downscale_n_convert_yuv422i_to_any_rgb_bt709_nonsse(const struct PixFcSSE*, void*, void*);
 void 		convert_yuv422i_to_any_10bit_rgb_bt709_nonsse(const struct PixFcSSE*, void*, void*);
 void		upsample_n_convert_yuv422i_to_any_10bit_rgb_bt709_nonsse(const struct PixFcSSE*, void*, void*);
 
 // anyYUV422I to anyRGB		NON SSE float
 void 		convert_yuv422i_to_any_rgb_bt709_nonsse_float(const struct PixFcSSE* , void* , void* );
 void		upsample_n_convert_yuv422i_to_any_rgb_bt709_nonsse_float(const struct PixFcSSE*, void*, void*);
+void		downscale_n_convert_yuv422i_to_any_rgb_bt709_nonsse_float(const struct PixFcSSE*, void*, void*);
 void 		convert_yuv422i_to_any_10bit_rgb_bt709_nonsse_float(const struct PixFcSSE*, void*, void*);
 void		upsample_n_convert_yuv422i_to_any_10bit_rgb_bt709_nonsse_float(const struct PixFcSSE*, void*, void*);
 
@@ -237,6 +267,43 @@ void		convert_yuyv_to_yuv422p_sse2_ssse3(const struct PixFcSSE*, void*, void*);
 void		convert_yuv422i_to_yuv422p_nonsse(const struct PixFcSSE*, void*, void*);
 
 
+/*
+ *  	Y U Y V
+ *
+ * 		T O
+ *
+ * 		N V 1 2  /  N V 2 1
+ */
+void		convert_yuyv_to_nv12_sse2(const struct PixFcSSE*, void*, void*);
+void		convert_yuyv_to_nv21_sse2(const struct PixFcSSE*, void*, void*);
+void		convert_yuv422i_to_nv12_nonsse(const struct PixFcSSE*, void*, void*);
+
+
+/*
+ *  	Y U Y V
+ *
+ * 		T O
+ *
+ * 		Y U V 4 2 0 P
+ */
+void		convert_yuyv_to_yuv420p_sse2(const struct PixFcSSE*, void*, void*);
+void		downsample_n_convert_yuyv_to_yuv420p_sse2(const struct PixFcSSE*, void*, void*);
+void		convert_yuv422i_to_yuv420p_nonsse(const struct PixFcSSE*, void*, void*);
+void		downsample_n_convert_yuv422i_to_yuv420p_nonsse(const struct PixFcSSE*, void*, void*);
+
+
+/*
+ *  	Y U Y V
+ *
+ * 		T O
+ *
+ * 		U Y V Y
+ */
+void		convert_yuyv_to_uyvy_sse2(const struct PixFcSSE*, void*, void*);
+void		convert_yuyv_to_uyvy_sse2_ssse3(const struct PixFcSSE*, void*, void*);
+void		convert_yuv422i_to_yuv422i_nonsse(const struct PixFcSSE*, void*, void*);
+
+
 /*
  *
  *	Y U Y V
@@ -254,5 +321,67 @@ void		convert_yuyv_to_v210_sse2_ssse3(const struct PixFcSSE* , void* , void*);
 void		convert_yuv422i_to_v210_nonsse(const struct PixFcSSE* , void* , void*);
 
 
+/*
+ *
+ *
+ *	A V X 2
+ *
+ *  C O N V E R S I O N S
+ *
+ *
+ */
+// YUYV to ARGB		AVX2
+void		upsample_n_convert_yuyv_to_argb_avx2(const struct PixFcSSE *, void *, void *);
+void		convert_yuyv_to_argb_avx2(const struct PixFcSSE *, void *, void *);
+void		upsample_n_convert_yuyv_to_argb_bt601_avx2(const struct PixFcSSE *, void *, void *);
+void		convert_yuyv_to_argb_bt601_avx2(const struct PixFcSSE *, void *, void *);
+void		upsample_n_convert_yuyv_to_argb_bt709_avx2(const struct PixFcSSE *, void *, void *);
+void		convert_yuyv_to_argb_bt709_avx2(const struct PixFcSSE *, void *, void *);
+
+// YUYV to BGRA		AVX2
+void		upsample_n_convert_yuyv_to_bgra_avx2(const struct PixFcSSE *, void *, void *);
+void		convert_yuyv_to_bgra_avx2(const struct PixFcSSE *, void *, void *);
+void		upsample_n_convert_yuyv_to_bgra_bt601_avx2(const struct PixFcSSE *, void *, void *);
+void		convert_yuyv_to_bgra_bt601_avx2(const struct PixFcSSE *, void *, void *);
+void		upsample_n_convert_yuyv_to_bgra_bt709_avx2(const struct PixFcSSE *, void *, void *);
+void		convert_yuyv_to_bgra_bt709_avx2(const struct PixFcSSE *, void *, void *);
+
+// YUYV to RGB24		AVX2
+void		upsample_n_convert_yuyv_to_rgb24_avx2(const struct PixFcSSE *, void *, void *);
+void		convert_yuyv_to_rgb24_avx2(const struct PixFcSSE *, void *, void *);
+void		upsample_n_convert_yuyv_to_rgb24_bt601_avx2(const struct PixFcSSE *, void *, void *);
+void		convert_yuyv_to_rgb24_bt601_avx2(const struct PixFcSSE *, void *, void *);
+void		upsample_n_convert_yuyv_to_rgb24_bt709_avx2(const struct PixFcSSE *, void *, void *);
+void		convert_yuyv_to_rgb24_bt709_avx2(const struct PixFcSSE *, void *, void *);
+
+// YUYV to BGR24		AVX2
+void		upsample_n_convert_yuyv_to_bgr24_avx2(const struct PixFcSSE *, void *, void *);
+void		convert_yuyv_to_bgr24_avx2(const struct PixFcSSE *, void *, void *);
+void		upsample_n_convert_yuyv_to_bgr24_bt601_avx2(const struct PixFcSSE *, void *, void *);
+void		convert_yuyv_to_bgr24_bt601_avx2(const struct PixFcSSE *, void *, void *);
+void		upsample_n_convert_yuyv_to_bgr24_bt709_avx2(const struct PixFcSSE *, void *, void *);
+void		convert_yuyv_to_bgr24_bt709_avx2(const struct PixFcSSE *, void *, void *);
+
+// YUYV to UYVY		AVX2
+void		convert_yuyv_to_uyvy_avx2(const struct PixFcSSE *, void *, void *);
+
+
+/*
+ *
+ *
+ *	A V X - 5 1 2
+ *
+ *  C O N V E R S I O N S
+ *
+ *
+ */
+// YUYV to v210		AVX-512
+void		convert_yuyv_to_v210_avx512(const struct PixFcSSE *, void *, void *);
+
+// YUYV to YUV420P		NEON
+void		downsample_n_convert_yuyv_to_yuv420p_neon(const struct PixFcSSE *, void *, void *);
+void		convert_yuyv_to_yuv420p_neon(const struct PixFcSSE *, void *, void *);
+
+
 #endif 		// CONVERSION_ROUTINES_FROM_YUYV_H_
 
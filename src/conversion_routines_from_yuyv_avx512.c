@@ -0,0 +1,35 @@
+/*
+ * conversion_routines_from_yuyv_avx512.c
+ *
+ * Copyright (C) 2011 PixFC Team (pixelfc@gmail.com)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public  License as published by the
+ * Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "common.h"
+#include "pixfc-sse.h"
+#include "yuv_conversion_recipes_avx512.h"
+
+/*
+ *
+ * 		Y U Y V
+ *
+ * 		to
+ *
+ * 		V 2 1 0
+ */
+void		convert_yuyv_to_v210_avx512(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
+	YUV422I_TO_V210_RECIPE_AVX512(repack_24_yuyv_pixels_to_v210_avx512);
+}
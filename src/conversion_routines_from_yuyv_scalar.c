@@ -53,7 +53,7 @@
 #define PACK_RGB(r, g, b, dst) \
 	if (dest_fmt == PixFcARGB) {\
 		dprint("R: %d G: %d B: %d\n", CLIP_PIXEL(r), CLIP_PIXEL(g), CLIP_PIXEL(b));\
-		*(dst++) = 0;\
+		*(dst++) = conv->alpha;\
 		*(dst++) = CLIP_PIXEL(r);\
 		*(dst++) = CLIP_PIXEL(g);\
 		*(dst++) = CLIP_PIXEL(b);\
@@ -61,7 +61,7 @@
 		*(dst++) = CLIP_PIXEL(b);\
 		*(dst++) = CLIP_PIXEL(g);\
 		*(dst++) = CLIP_PIXEL(r);\
-		*(dst++) = 0;\
+		*(dst++) = conv->alpha;\
 	} else  if (dest_fmt == PixFcRGB24) {\
 		*(dst++) = CLIP_PIXEL(r);\
 		*(dst++) = CLIP_PIXEL(g);\
@@ -100,17 +100,25 @@
 		g = coeffs[1][0] * (y + offsets[0]) + coeffs[1][1] * (u + offsets[1]) + coeffs[1][2] * (v + offsets[2]);\
 		b = coeffs[2][0] * (y + offsets[0]) + coeffs[2][1] * (u + offsets[1]) + coeffs[2][2] * (v + offsets[2]);\
 
+// Define fn_name() to call fn_name##_fmt() (see CALL_FOR_FORMATS) with each
+// YUYV / UYVY source format and each of the given RGB destination formats.
+#define DEFINE_YUV422I_TO_RGB_ENTRY_POINT(fn_name, rgb_dest_formats)\
+	void 		fn_name(const struct PixFcSSE* conv, void* in, void* out){\
+		rgb_dest_formats(fn_name##_fmt, conv, in, out, PixFcYUYV)\
+		rgb_dest_formats(fn_name##_fmt, conv, in, out, PixFcUYVY)\
+		printf("unknown source or destination pixel format\n");\
+	}
+
 
 //
 // NNB float
 //
-#define DEFINE_YUV422I_TO_ANY_RGB_FLOAT(fn_name, coeffs, offsets)\
-	void 		fn_name(const struct PixFcSSE* conv, void* in, void* out){\
-		PixFcPixelFormat 	dest_fmt = conv->dest_fmt;\
-		PixFcPixelFormat 	src_fmt = conv->source_fmt;\
+#define DEFINE_YUV422I_TO_ANY_RGB_FLOAT(fn_name, rgb_dest_formats, coeffs, offsets)\
+	static FORCE_INLINE void fn_name##_fmt(const struct PixFcSSE* conv, void* in, void* out, const PixFcPixelFormat src_fmt, const PixFcPixelFormat dest_fmt){\
 		uint32_t            pixels_remaining;\
 		uint32_t            lines_remaining = conv->height;\
-		uint32_t			padding_bytes = PADDING_BYTE_COUNT(dest_fmt, conv->width);\
+		uint32_t			padding_bytes = ROW_PADDING_BYTE_COUNT(dest_fmt, conv->width, conv->dest_row_bytes);\
+		uint32_t			src_padding_bytes = ROW_PADDING_BYTE_COUNT(src_fmt, conv->width, conv->source_row_bytes);\
 		uint8_t*			src = (uint8_t *) in;\
 		uint8_t*			dst = (uint8_t *) out;\
 		int32_t				r = 0, g = 0, b = 0;\
@@ -125,17 +133,19 @@
 				PACK_RGB(r, g, b, dst);\
 				pixels_remaining -= 2;\
 			}\
+			src += src_padding_bytes;\
 			dst += padding_bytes;\
 		}\
-}
+}\
+	DEFINE_YUV422I_TO_RGB_ENTRY_POINT(fn_name, rgb_dest_formats)
 
 // these functions assume an even number of pixels
-DEFINE_YUV422I_TO_ANY_RGB_FLOAT(convert_yuv422i_to_any_rgb_nonsse_float, yuv_8bit_to_rgb_8bit_coef[0], yuv_8bit_to_rgb_8bit_off[0]);
-DEFINE_YUV422I_TO_ANY_RGB_FLOAT(convert_yuv422i_to_any_rgb_bt601_nonsse_float, yuv_8bit_to_rgb_8bit_coef[1], yuv_8bit_to_rgb_8bit_off[1]);
-DEFINE_YUV422I_TO_ANY_RGB_FLOAT(convert_yuv422i_to_any_rgb_bt709_nonsse_float, yuv_8bit_to_rgb_8bit_coef[2], yuv_8bit_to_rgb_8bit_off[2]);
-DEFINE_YUV422I_TO_ANY_RGB_FLOAT(convert_yuv422i_to_any_10bit_rgb_nonsse_float, yuv_8bit_to_rgb_10bit_coef[0], yuv_8bit_to_rgb_10bit_off[0]);
-DEFINE_YUV422I_TO_ANY_RGB_FLOAT(convert_yuv422i_to_any_10bit_rgb_bt601_nonsse_float, yuv_8bit_to_rgb_10bit_coef[1], yuv_8bit_to_rgb_10bit_off[1]);
-DEFINE_YUV422I_TO_ANY_RGB_FLOAT(convert_yuv422i_to_any_10bit_rgb_bt709_nonsse_float, yuv_8bit_to_rgb_10bit_coef[2], yuv_8bit_to_rgb_10bit_off[2]);
+DEFINE_YUV422I_TO_ANY_RGB_FLOAT(convert_yuv422i_to_any_rgb_nonsse_float, CALL_FOR_8BIT_RGB_DEST_FORMATS, yuv_8bit_to_rgb_8bit_coef[0], yuv_8bit_to_rgb_8bit_off[0]);
+DEFINE_YUV422I_TO_ANY_RGB_FLOAT(convert_yuv422i_to_any_rgb_bt601_nonsse_float, CALL_FOR_8BIT_RGB_DEST_FORMATS, yuv_8bit_to_rgb_8bit_coef[1], yuv_8bit_to_rgb_8bit_off[1]);
+DEFINE_YUV422I_TO_ANY_RGB_FLOAT(convert_yuv422i_to_any_rgb_bt709_nonsse_float, CALL_FOR_8BIT_RGB_DEST_FORMATS, yuv_8bit_to_rgb_8bit_coef[2], yuv_8bit_to_rgb_8bit_off[2]);
+DEFINE_YUV422I_TO_ANY_RGB_FLOAT(convert_yuv422i_to_any_10bit_rgb_nonsse_float, CALL_FOR_10BIT_RGB_DEST_FORMATS, yuv_8bit_to_rgb_10bit_coef[0], yuv_8bit_to_rgb_10bit_off[0]);
+DEFINE_YUV422I_TO_ANY_RGB_FLOAT(convert_yuv422i_to_any_10bit_rgb_bt601_nonsse_float, CALL_FOR_10BIT_RGB_DEST_FORMATS, yuv_8bit_to_rgb_10bit_coef[1], yuv_8bit_to_rgb_10bit_off[1]);
+DEFINE_YUV422I_TO_ANY_RGB_FLOAT(convert_yuv422i_to_any_10bit_rgb_bt709_nonsse_float, CALL_FOR_10BIT_RGB_DEST_FORMATS, yuv_8bit_to_rgb_10bit_coef[2], yuv_8bit_to_rgb_10bit_off[2]);
 
 
 
@@ -147,13 +157,12 @@ DEFINE_YUV422I_TO_ANY_RGB_FLOAT(convert_yuv422i_to_any_10bit_rgb_bt709_nonsse_fl
 		g = ((coeffs[1][0] * (y + offsets[0])) + (coeffs[1][1] * (u + offsets[1])) + (coeffs[1][2] * (v + offsets[2]))) >> coef_shift;\
 		b = ((coeffs[2][0] * (y + offsets[0])) + (coeffs[2][1] * (u + offsets[1])) + (coeffs[2][2] * (v + offsets[2]))) >> coef_shift;\
 
-#define DEFINE_YUV422I_TO_ANY_RGB(fn_name, coeffs, coef_shift, offsets)\
-	void 		fn_name(const struct PixFcSSE* conv, void* in, void* out){\
-		PixFcPixelFormat 	dest_fmt = conv->dest_fmt;\
-		PixFcPixelFormat 	src_fmt = conv->source_fmt;\
+#define DEFINE_YUV422I_TO_ANY_RGB(fn_name, rgb_dest_formats, coeffs, coef_shift, offsets)\
+	static FORCE_INLINE void fn_name##_fmt(const struct PixFcSSE* conv, void* in, void* out, const PixFcPixelFormat src_fmt, const PixFcPixelFormat dest_fmt){\
 		uint32_t            pixels_remaining;\
 		uint32_t            lines_remaining = conv->height;\
-		uint32_t			padding_bytes = PADDING_BYTE_COUNT(dest_fmt, conv->width);\
+		uint32_t			padding_bytes = ROW_PADDING_BYTE_COUNT(dest_fmt, conv->width, conv->dest_row_bytes);\
+		uint32_t			src_padding_bytes = ROW_PADDING_BYTE_COUNT(src_fmt, conv->width, conv->source_row_bytes);\
 		uint8_t*			src = (uint8_t *) in;\
 		uint8_t*			dst = (uint8_t *) out;\
 		int32_t				r = 0, g = 0, b = 0;\
@@ -168,28 +177,29 @@ DEFINE_YUV422I_TO_ANY_RGB_FLOAT(convert_yuv422i_to_any_10bit_rgb_bt709_nonsse_fl
 				PACK_RGB(r, g, b, dst);\
 				pixels_remaining -= 2;\
 			}\
+			src += src_padding_bytes;\
 			dst += padding_bytes;\
 		}\
-}
+}\
+	DEFINE_YUV422I_TO_RGB_ENTRY_POINT(fn_name, rgb_dest_formats)
 
 // these functions assume an even number of pixels
-DEFINE_YUV422I_TO_ANY_RGB(convert_yuv422i_to_any_rgb_nonsse, yuv_8bit_to_rgb_8bit_coef_lhs8[0], 8, yuv_8bit_to_rgb_8bit_off[0]);
-DEFINE_YUV422I_TO_ANY_RGB(convert_yuv422i_to_any_rgb_bt601_nonsse, yuv_8bit_to_rgb_8bit_coef_lhs8[1], 8, yuv_8bit_to_rgb_8bit_off[1]);
-DEFINE_YUV422I_TO_ANY_RGB(convert_yuv422i_to_any_rgb_bt709_nonsse, yuv_8bit_to_rgb_8bit_coef_lhs8[2], 8, yuv_8bit_to_rgb_8bit_off[2]);
-DEFINE_YUV422I_TO_ANY_RGB(convert_yuv422i_to_any_10bit_rgb_nonsse, yuv_8bit_to_rgb_10bit_coef_lhs8[0], 8, yuv_8bit_to_rgb_10bit_off[0]);
-DEFINE_YUV422I_TO_ANY_RGB(convert_yuv422i_to_any_10bit_rgb_bt601_nonsse, yuv_8bit_to_rgb_10bit_coef_lhs8[1], 8, yuv_8bit_to_rgb_10bit_off[1]);
-DEFINE_YUV422I_TO_ANY_RGB(convert_yuv422i_to_any_10bit_rgb_bt709_nonsse, yuv_8bit_to_rgb_10bit_coef_lhs8[2], 8, yuv_8bit_to_rgb_10bit_off[2]);
+DEFINE_YUV422I_TO_ANY_RGB(convert_yuv422i_to_any_rgb_nonsse, CALL_FOR_8BIT_RGB_DEST_FORMATS, yuv_8bit_to_rgb_8bit_coef_lhs8[0], 8, yuv_8bit_to_rgb_8bit_off[0]);
+DEFINE_YUV422I_TO_ANY_RGB(convert_yuv422i_to_any_rgb_bt601_nonsse, CALL_FOR_8BIT_RGB_DEST_FORMATS, yuv_8bit_to_rgb_8bit_coef_lhs8[1], 8, yuv_8bit_to_rgb_8bit_off[1]);
+DEFINE_YUV422I_TO_ANY_RGB(convert_yuv422i_to_any_rgb_bt709_nonsse, CALL_FOR_8BIT_RGB_DEST_FORMATS, yuv_8bit_to_rgb_8bit_coef_lhs8[2], 8, yuv_8bit_to_rgb_8bit_off[2]);
+DEFINE_YUV422I_TO_ANY_RGB(convert_yuv422i_to_any_10bit_rgb_nonsse, CALL_FOR_10BIT_RGB_DEST_FORMATS, yuv_8bit_to_rgb_10bit_coef_lhs8[0], 8, yuv_8bit_to_rgb_10bit_off[0]);
+DEFINE_YUV422I_TO_ANY_RGB(convert_yuv422i_to_any_10bit_rgb_bt601_nonsse, CALL_FOR_10BIT_RGB_DEST_FORMATS, yuv_8bit_to_rgb_10bit_coef_lhs8[1], 8, yuv_8bit_to_rgb_10bit_off[1]);
+DEFINE_YUV422I_TO_ANY_RGB(convert_yuv422i_to_any_10bit_rgb_bt709_nonsse, CALL_FOR_10BIT_RGB_DEST_FORMATS, yuv_8bit_to_rgb_10bit_coef_lhs8[2], 8, yuv_8bit_to_rgb_10bit_off[2]);
 
 
 
 //
 // AVG Float
 //
-#define DEFINE_UPSAMPLE_N_CONVERT_YUV422I_TO_ANY_RGB_FLOAT(fn_name, coeffs, offsets)\
-	void 		fn_name(const struct PixFcSSE* conv, void* in, void* out){\
-		PixFcPixelFormat 	dest_fmt = conv->dest_fmt;\
-		PixFcPixelFormat 	src_fmt = conv->source_fmt;\
-		uint32_t			padding_bytes = PADDING_BYTE_COUNT(dest_fmt, conv->width);\
+#define DEFINE_UPSAMPLE_N_CONVERT_YUV422I_TO_ANY_RGB_FLOAT(fn_name, rgb_dest_formats, coeffs, offsets)\
+	static FORCE_INLINE void fn_name##_fmt(const struct PixFcSSE* conv, void* in, void* out, const PixFcPixelFormat src_fmt, const PixFcPixelFormat dest_fmt){\
+		uint32_t			padding_bytes = ROW_PADDING_BYTE_COUNT(dest_fmt, conv->width, conv->dest_row_bytes);\
+		uint32_t			src_padding_bytes = ROW_PADDING_BYTE_COUNT(src_fmt, conv->width, conv->source_row_bytes);\
 		uint32_t 			lines_remaining = conv->height;\
 		uint32_t			pixel_count;\
 		uint8_t*			src = (uint8_t *) in;\
@@ -219,27 +229,28 @@ DEFINE_YUV422I_TO_ANY_RGB(convert_yuv422i_to_any_10bit_rgb_bt709_nonsse, yuv_8bi
 			PACK_RGB(r, g, b, dst);\
 			CONVERT_YUV444_TO_RGB_FLOAT(y2, u, v, r, g, b, coeffs, offsets);\
 			PACK_RGB(r, g, b, dst);\
+			src += src_padding_bytes;\
 			dst += padding_bytes;\
 		}\
-	}
+	}\
+	DEFINE_YUV422I_TO_RGB_ENTRY_POINT(fn_name, rgb_dest_formats)
 
 // these functions assume an even number of pixels
-DEFINE_UPSAMPLE_N_CONVERT_YUV422I_TO_ANY_RGB_FLOAT(upsample_n_convert_yuv422i_to_any_rgb_nonsse_float, yuv_8bit_to_rgb_8bit_coef[0], yuv_8bit_to_rgb_8bit_off[0]);
-DEFINE_UPSAMPLE_N_CONVERT_YUV422I_TO_ANY_RGB_FLOAT(upsample_n_convert_yuv422i_to_any_rgb_bt601_nonsse_float, yuv_8bit_to_rgb_8bit_coef[1], yuv_8bit_to_rgb_8bit_off[1]);
-DEFINE_UPSAMPLE_N_CONVERT_YUV422I_TO_ANY_RGB_FLOAT(upsample_n_convert_yuv422i_to_any_rgb_bt709_nonsse_float, yuv_8bit_to_rgb_8bit_coef[2], yuv_8bit_to_rgb_8bit_off[2]);
-DEFINE_UPSAMPLE_N_CONVERT_YUV422I_TO_ANY_RGB_FLOAT(upsample_n_convert_yuv422i_to_any_10bit_rgb_nonsse_float, yuv_8bit_to_rgb_10bit_coef[0], yuv_8bit_to_rgb_10bit_off[0]);
-DEFINE_UPSAMPLE_N_CONVERT_YUV422I_TO_ANY_RGB_FLOAT(upsample_n_convert_yuv422i_to_any_10bit_rgb_bt601_nonsse_float, yuv_8bit_to_rgb_10bit_coef[1], yuv_8bit_to_rgb_10bit_off[1]);
-DEFINE_UPSAMPLE_N_CONVERT_YUV422I_TO_ANY_RGB_FLOAT(upsample_n_convert_yuv422i_to_any_10bit_rgb_bt709_nonsse_float, yuv_8bit_to_rgb_10bit_coef[2], yuv_8bit_to_rgb_10bit_off[2]);
+DEFINE_UPSAMPLE_N_CONVERT_YUV422I_TO_ANY_RGB_FLOAT(upsample_n_convert_yuv422i_to_any_rgb_nonsse_float, CALL_FOR_8BIT_RGB_DEST_FORMATS, yuv_8bit_to_rgb_8bit_coef[0], yuv_8bit_to_rgb_8bit_off[0]);
+DEFINE_UPSAMPLE_N_CONVERT_YUV422I_TO_ANY_RGB_FLOAT(upsample_n_convert_yuv422i_to_any_rgb_bt601_nonsse_float, CALL_FOR_8BIT_RGB_DEST_FORMATS, yuv_8bit_to_rgb_8bit_coef[1], yuv_8bit_to_rgb_8bit_off[1]);
+DEFINE_UPSAMPLE_N_CONVERT_YUV422I_TO_ANY_RGB_FLOAT(upsample_n_convert_yuv422i_to_any_rgb_bt709_nonsse_float, CALL_FOR_8BIT_RGB_DEST_FORMATS, yuv_8bit_to_rgb_8bit_coef[2], yuv_8bit_to_rgb_8bit_off[2]);
+DEFINE_UPSAMPLE_N_CONVERT_YUV422I_TO_ANY_RGB_FLOAT(upsample_n_convert_yuv422i_to_any_10bit_rgb_nonsse_float, CALL_FOR_10BIT_RGB_DEST_FORMATS, yuv_8bit_to_rgb_10bit_coef[0], yuv_8bit_to_rgb_10bit_off[0]);
+DEFINE_UPSAMPLE_N_CONVERT_YUV422I_TO_ANY_RGB_FLOAT(upsample_n_convert_yuv422i_to_any_10bit_rgb_bt601_nonsse_float, CALL_FOR_10BIT_RGB_DEST_FORMATS, yuv_8bit_to_rgb_10bit_coef[1], yuv_8bit_to_rgb_10bit_off[1]);
+DEFINE_UPSAMPLE_N_CONVERT_YUV422I_TO_ANY_RGB_FLOAT(upsample_n_convert_yuv422i_to_any_10bit_rgb_bt709_nonsse_float, CALL_FOR_10BIT_RGB_DEST_FORMATS, yuv_8bit_to_rgb_10bit_coef[2], yuv_8bit_to_rgb_10bit_off[2]);
 
 
 
 // AVG Integer
 //
-#define DEFINE_UPSAMPLE_N_CONVERT_YUV422I_TO_ANY_RGB(fn_name, coeffs, coef_shift, offsets)\
-	void 		fn_name(const struct PixFcSSE* conv, void* in, void* out){\
-		PixFcPixelFormat 	dest_fmt = conv->dest_fmt;\
-		PixFcPixelFormat 	src_fmt = conv->source_fmt;\
-		uint32_t			padding_bytes = PADDING_BYTE_COUNT(dest_fmt, conv->width);\
+#define DEFINE_UPSAMPLE_N_CONVERT_YUV422I_TO_ANY_RGB(fn_name, rgb_dest_formats, coeffs, coef_shift, offsets)\
+	static FORCE_INLINE void fn_name##_fmt(const struct PixFcSSE* conv, void* in, void* out, const PixFcPixelFormat src_fmt, const PixFcPixelFormat dest_fmt){\
+		uint32_t			padding_bytes = ROW_PADDING_BYTE_COUNT(dest_fmt, conv->width, conv->dest_row_bytes);\
+		uint32_t			src_padding_bytes = ROW_PADDING_BYTE_COUNT(src_fmt, conv->width, conv->source_row_bytes);\
 		uint32_t 			lines_remaining = conv->height;\
 		uint32_t			pixel_count;\
 		uint8_t*			src = (uint8_t *) in;\
@@ -269,17 +280,107 @@ DEFINE_UPSAMPLE_N_CONVERT_YUV422I_TO_ANY_RGB_FLOAT(upsample_n_convert_yuv422i_to
 			PACK_RGB(r, g, b, dst);\
 			CONVERT_YUV444_TO_RGB(y2, u, v, r, g, b, coef_shift, coeffs, offsets);\
 			PACK_RGB(r, g, b, dst);\
+			src += src_padding_bytes;\
 			dst += padding_bytes;\
 		}\
-	}
+	}\
+	DEFINE_YUV422I_TO_RGB_ENTRY_POINT(fn_name, rgb_dest_formats)
 
 // these functions assume an even number of pixels
-DEFINE_UPSAMPLE_N_CONVERT_YUV422I_TO_ANY_RGB(upsample_n_convert_yuv422i_to_any_rgb_nonsse, yuv_8bit_to_rgb_8bit_coef_lhs8[0], 8, yuv_8bit_to_rgb_8bit_off[0]);
-DEFINE_UPSAMPLE_N_CONVERT_YUV422I_TO_ANY_RGB(upsample_n_convert_yuv422i_to_any_rgb_bt601_nonsse, yuv_8bit_to_rgb_8bit_coef_lhs8[1], 8, yuv_8bit_to_rgb_8bit_off[1]);
-DEFINE_UPSAMPLE_N_CONVERT_YUV422I_TO_ANY_RGB(upsample_n_convert_yuv422i_to_any_rgb_bt709_nonsse, yuv_8bit_to_rgb_8bit_coef_lhs8[2], 8, yuv_8bit_to_rgb_8bit_off[2]);
-DEFINE_UPSAMPLE_N_CONVERT_YUV422I_TO_ANY_RGB(upsample_n_convert_yuv422i_to_any_10bit_rgb_nonsse, yuv_8bit_to_rgb_10bit_coef_lhs8[0], 8, yuv_8bit_to_rgb_10bit_off[0]);
-DEFINE_UPSAMPLE_N_CONVERT_YUV422I_TO_ANY_RGB(upsample_n_convert_yuv422i_to_any_10bit_rgb_bt601_nonsse, yuv_8bit_to_rgb_10bit_coef_lhs8[1], 8, yuv_8bit_to_rgb_10bit_off[1]);
-DEFINE_UPSAMPLE_N_CONVERT_YUV422I_TO_ANY_RGB(upsample_n_convert_yuv422i_to_any_10bit_rgb_bt709_nonsse, yuv_8bit_to_rgb_10bit_coef_lhs8[2], 8, yuv_8bit_to_rgb_10bit_off[2]);
+DEFINE_UPSAMPLE_N_CONVERT_YUV422I_TO_ANY_RGB(upsample_n_convert_yuv422i_to_any_rgb_nonsse, CALL_FOR_8BIT_RGB_DEST_FORMATS, yuv_8bit_to_rgb_8bit_coef_lhs8[0], 8, yuv_8bit_to_rgb_8bit_off[0]);
+DEFINE_UPSAMPLE_N_CONVERT_YUV422I_TO_ANY_RGB(upsample_n_convert_yuv422i_to_any_rgb_bt601_nonsse, CALL_FOR_8BIT_RGB_DEST_FORMATS, yuv_8bit_to_rgb_8bit_coef_lhs8[1], 8, yuv_8bit_to_rgb_8bit_off[1]);
+DEFINE_UPSAMPLE_N_CONVERT_YUV422I_TO_ANY_RGB(upsample_n_convert_yuv422i_to_any_rgb_bt709_nonsse, CALL_FOR_8BIT_RGB_DEST_FORMATS, yuv_8bit_to_rgb_8bit_coef_lhs8[2], 8, yuv_8bit_to_rgb_8bit_off[2]);
+DEFINE_UPSAMPLE_N_CONVERT_YUV422I_TO_ANY_RGB(upsample_n_convert_yuv422i_to_any_10bit_rgb_nonsse, CALL_FOR_10BIT_RGB_DEST_FORMATS, yuv_8bit_to_rgb_10bit_coef_lhs8[0], 8, yuv_8bit_to_rgb_10bit_off[0]);
+DEFINE_UPSAMPLE_N_CONVERT_YUV422I_TO_ANY_RGB(upsample_n_convert_yuv422i_to_any_10bit_rgb_bt601_nonsse, CALL_FOR_10BIT_RGB_DEST_FORMATS, yuv_8bit_to_rgb_10bit_coef_lhs8[1], 8, yuv_8bit_to_rgb_10bit_off[1]);
+DEFINE_UPSAMPLE_N_CONVERT_YUV422I_TO_ANY_RGB(upsample_n_convert_yuv422i_to_any_10bit_rgb_bt709_nonsse, CALL_FOR_10BIT_RGB_DEST_FORMATS, yuv_8bit_to_rgb_10bit_coef_lhs8[2], 8, yuv_8bit_to_rgb_10bit_off[2]);
+
+
+
+//
+// Downscaling
+//
+// Add up the Y values and the (nearest neighbour upsampled) U & V values of
+// the factor x factor block of pixels whose top left pixel is at 'column' on
+// the current line.
+#define SUM_YUV422I_BLOCK(y, u, v, column)\
+		y = u = v = 0;\
+		for(line = 0; line < factor; line++) {\
+			line_src = src + line * conv->source_row_bytes;\
+			for(pixel = (column); pixel < (column) + factor; pixel++) {\
+				y += line_src[pixel * 2 + y_offset];\
+				u += line_src[(pixel & ~1) * 2 + uv_offset];\
+				v += line_src[(pixel & ~1) * 2 + uv_offset + 2];\
+			}\
+		}
+
+#define DEFINE_DOWNSCALE_N_CONVERT_YUV422I_TO_ANY_RGB(fn_name, rgb_dest_formats, coeffs, coef_shift, offsets)\
+	static FORCE_INLINE void fn_name##_fmt(const struct PixFcSSE* conv, void* in, void* out, const PixFcPixelFormat src_fmt, const PixFcPixelFormat dest_fmt){\
+		uint32_t			factor = PIXFC_DOWNSCALE_FACTOR(conv->flags);\
+		int32_t				area = factor * factor;\
+		uint32_t			out_width = conv->width / factor;\
+		uint32_t			padding_bytes = ROW_PADDING_BYTE_COUNT(dest_fmt, out_width, conv->dest_row_bytes);\
+		uint32_t 			lines_remaining = conv->height / factor;\
+		uint32_t			y_offset = (src_fmt == PixFcYUYV) ? 0 : 1;\
+		uint32_t			uv_offset = (src_fmt == PixFcYUYV) ? 1 : 0;\
+		uint32_t			out_pixel;\
+		uint32_t			pixel;\
+		uint32_t			line;\
+		uint8_t*			src = (uint8_t *) in;\
+		uint8_t*			line_src;\
+		uint8_t*			dst = (uint8_t *) out;\
+		int32_t				r = 0, g = 0, b = 0;\
+		int32_t				y = 0, u = 0, v = 0;\
+		while(lines_remaining-- > 0){\
+			for(out_pixel = 0; out_pixel < out_width; out_pixel++) {\
+				SUM_YUV422I_BLOCK(y, u, v, out_pixel * factor);\
+				y = (y + area / 2) / area;\
+				u = (u + area / 2) / area;\
+				v = (v + area / 2) / area;\
+				CONVERT_YUV444_TO_RGB(y, u, v, r, g, b, coef_shift, coeffs, offsets);\
+				PACK_RGB(r, g, b, dst);\
+			}\
+			src += factor * conv->source_row_bytes;\
+			dst += padding_bytes;\
+		}\
+	}\
+	DEFINE_YUV422I_TO_RGB_ENTRY_POINT(fn_name, rgb_dest_formats)
+
+#define DEFINE_DOWNSCALE_N_CONVERT_YUV422I_TO_ANY_RGB_FLOAT(fn_name, rgb_dest_formats, coeffs, offsets)\
+	static FORCE_INLINE void fn_name##_fmt(const struct PixFcSSE* conv, void* in, void* out, const PixFcPixelFormat src_fmt, const PixFcPixelFormat dest_fmt){\
+		uint32_t			factor = PIXFC_DOWNSCALE_FACTOR(conv->flags);\
+		float				area = (float) (factor * factor);\
+		uint32_t			out_width = conv->width / factor;\
+		uint32_t			padding_bytes = ROW_PADDING_BYTE_COUNT(dest_fmt, out_width, conv->dest_row_bytes);\
+		uint32_t 			lines_remaining = conv->height / factor;\
+		uint32_t			y_offset = (src_fmt == PixFcYUYV) ? 0 : 1;\
+		uint32_t			uv_offset = (src_fmt == PixFcYUYV) ? 1 : 0;\
+		uint32_t			out_pixel;\
+		uint32_t			pixel;\
+		uint32_t			line;\
+		uint8_t*			src = (uint8_t *) in;\
+		uint8_t*			line_src;\
+		uint8_t*			dst = (uint8_t *) out;\
+		int32_t				r = 0, g = 0, b = 0;\
+		int32_t				y = 0, u = 0, v = 0;\
+		while(lines_remaining-- > 0){\
+			for(out_pixel = 0; out_pixel < out_width; out_pixel++) {\
+				SUM_YUV422I_BLOCK(y, u, v, out_pixel * factor);\
+				CONVERT_YUV444_TO_RGB_FLOAT(y / area, u / area, v / area, r, g, b, coeffs, offsets);\
+				PACK_RGB(r, g, b, dst);\
+			}\
+			src += factor * conv->source_row_bytes;\
+			dst += padding_bytes;\
+		}\
+	}\
+	DEFINE_YUV422I_TO_RGB_ENTRY_POINT(fn_name, rgb_dest_formats)
+
+// these functions assume the width and height are multiples of the downscaling factor
+DEFINE_DOWNSCALE_N_CONVERT_YUV422I_TO_ANY_RGB(downscale_n_convert_yuv422i_to_any_rgb_nonsse, CALL_FOR_8BIT_RGB_DEST_FORMATS, yuv_8bit_to_rgb_8bit_coef_lhs8[0], 8, yuv_8bit_to_rgb_8bit_off[0]);
+DEFINE_DOWNSCALE_N_CONVERT_YUV422I_TO_ANY_RGB(downscale_n_convert_yuv422i_to_any_rgb_bt601_nonsse, CALL_FOR_8BIT_RGB_DEST_FORMATS, yuv_8bit_to_rgb_8bit_coef_lhs8[1], 8, yuv_8bit_to_rgb_8bit_off[1]);
+DEFINE_DOWNSCALE_N_CONVERT_YUV422I_TO_ANY_RGB(downscale_n_convert_yuv422i_to_any_rgb_bt709_nonsse, CALL_FOR_8BIT_RGB_DEST_FORMATS, yuv_8bit_to_rgb_8bit_coef_lhs8[2], 8, yuv_8bit_to_rgb_8bit_off[2]);
+DEFINE_DOWNSCALE_N_CONVERT_YUV422I_TO_ANY_RGB_FLOAT(downscale_n_convert_yuv422i_to_any_rgb_nonsse_float, CALL_FOR_8BIT_RGB_DEST_FORMATS, yuv_8bit_to_rgb_8bit_coef[0], yuv_8bit_to_rgb_8bit_off[0]);
+DEFINE_DOWNSCALE_N_CONVERT_YUV422I_TO_ANY_RGB_FLOAT(downscale_n_convert_yuv422i_to_any_rgb_bt601_nonsse_float, CALL_FOR_8BIT_RGB_DEST_FORMATS, yuv_8bit_to_rgb_8bit_coef[1], yuv_8bit_to_rgb_8bit_off[1]);
+DEFINE_DOWNSCALE_N_CONVERT_YUV422I_TO_ANY_RGB_FLOAT(downscale_n_convert_yuv422i_to_any_rgb_bt709_nonsse_float, CALL_FOR_8BIT_RGB_DEST_FORMATS, yuv_8bit_to_rgb_8bit_coef[2], yuv_8bit_to_rgb_8bit_off[2]);
 
 
 
@@ -292,33 +393,178 @@ DEFINE_UPSAMPLE_N_CONVERT_YUV422I_TO_ANY_RGB(upsample_n_convert_yuv422i_to_any_1
  */
 
 void		convert_yuv422i_to_yuv422p_nonsse(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
-	uint32_t 	pixel_count = pixfc->pixel_count;
+	uint32_t	src_padding_bytes = ROW_PADDING_BYTE_COUNT(pixfc->source_fmt, pixfc->width, pixfc->source_row_bytes);
+	uint32_t	lines_remaining = pixfc->height;
+	uint32_t 	pixel_count;
 	uint8_t *	src = (uint8_t *)source_buffer;
 	uint8_t *	y_plane = (uint8_t *) dest_buffer;
-	uint8_t *	u_plane = y_plane + pixel_count;
-	uint8_t *	v_plane = u_plane + pixel_count / 2;
+	uint8_t *	u_plane = y_plane + pixfc->pixel_count;
+	uint8_t *	v_plane = u_plane + pixfc->pixel_count / 2;
 
 	// Do conversion
 	if (pixfc->source_fmt == PixFcYUYV)
+		while(lines_remaining-- > 0) {
+			pixel_count = pixfc->width;
+			while(pixel_count > 0) {
+				*y_plane++ = *src++;
+				*u_plane++ = *src++;
+				*y_plane++ = *src++;
+				*v_plane++ = *src++;
+
+				pixel_count -= 2;
+			}
+			src += src_padding_bytes;
+		}
+	else if (pixfc->source_fmt == PixFcUYVY)
+		while(lines_remaining-- > 0) {
+			pixel_count = pixfc->width;
+			while(pixel_count > 0) {
+				*u_plane++ = *src++;
+				*y_plane++ = *src++;
+				*v_plane++ = *src++;
+				*y_plane++ = *src++;
+
+				pixel_count -= 2;
+			}
+			src += src_padding_bytes;
+		}
+	else
+		printf("unknown source pixel format\n");
+}
+
+
+
+/*
+ *
+ *	Y U Y V  /  U Y V Y
+ *
+ *	T O
+ *
+ *	N V 1 2  /  N V 2 1
+ *
+ * Chroma samples from each pair of lines are averaged (rounding up, like
+ * the SSE2 routines).
+ */
+void		convert_yuv422i_to_nv12_nonsse(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
+	uint32_t	lines_remaining = pixfc->height / 2;
+	uint32_t 	pixel_count;
+	uint8_t *	src_line1 = (uint8_t *)source_buffer;
+	uint8_t *	src_line2;
+	uint8_t *	y_line1 = (uint8_t *) dest_buffer;
+	uint8_t *	y_line2;
+	uint8_t *	uv_plane = y_line1 + pixfc->pixel_count;
+	uint32_t	y_index = (pixfc->source_fmt == PixFcYUYV) ? 0 : 1;
+	uint32_t	u_index = (pixfc->source_fmt == PixFcYUYV) ? 1 : 0;
+	uint32_t	uv_swap = (pixfc->dest_fmt == PixFcNV12) ? 0 : 2;
+
+	// Do conversion
+	while(lines_remaining-- > 0) {
+		src_line2 = src_line1 + pixfc->source_row_bytes;
+		y_line2 = y_line1 + pixfc->width;
+		pixel_count = pixfc->width;
 		while(pixel_count > 0) {
-			*y_plane++ = *src++;
-			*u_plane++ = *src++;
-			*y_plane++ = *src++;
-			*v_plane++ = *src++;
+			*y_line1++ = src_line1[y_index];
+			*y_line1++ = src_line1[y_index + 2];
+			*y_line2++ = src_line2[y_index];
+			*y_line2++ = src_line2[y_index + 2];
+			*uv_plane++ = (src_line1[u_index + uv_swap] + src_line2[u_index + uv_swap] + 1) / 2;
+			*uv_plane++ = (src_line1[u_index + 2 - uv_swap] + src_line2[u_index + 2 - uv_swap] + 1) / 2;
+			src_line1 += 4;
+			src_line2 += 4;
 
 			pixel_count -= 2;
 		}
-	else if (pixfc->source_fmt == PixFcUYVY)
+		src_line1 += 2 * pixfc->source_row_bytes - pixfc->width * 2;
+		y_line1 = y_line2;
+	}
+}
+
+
+/*
+ *
+ *	Y U Y V  /  U Y V Y
+ *
+ *	T O
+ *
+ *	Y U V 4 2 0 P
+ *
+ * The downsample_n_ variant averages chroma samples from each pair of lines
+ * (rounding up, like the SSE2 routines), the other one keeps the chroma
+ * samples of the first line.
+ */
+#define NNB_CHROMA(line1, line2)		(line1)
+#define AVG_CHROMA(line1, line2)		(((line1) + (line2) + 1) / 2)
+
+#define DEFINE_YUV422I_TO_YUV420P_FN(fn_name, chroma_resampling) \
+void		fn_name(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {\
+	uint32_t	lines_remaining = pixfc->height / 2;\
+	uint32_t 	pixel_count;\
+	uint8_t *	src_line1 = (uint8_t *)source_buffer;\
+	uint8_t *	src_line2;\
+	uint8_t *	y_line1 = (uint8_t *) dest_buffer;\
+	uint8_t *	y_line2;\
+	uint8_t *	u_plane = y_line1 + pixfc->pixel_count;\
+	uint8_t *	v_plane = u_plane + pixfc->pixel_count / 4;\
+	uint32_t	y_index = (pixfc->source_fmt == PixFcYUYV) ? 0 : 1;\
+	uint32_t	u_index = (pixfc->source_fmt == PixFcYUYV) ? 1 : 0;\
+	while(lines_remaining-- > 0) {\
+		src_line2 = src_line1 + pixfc->source_row_bytes;\
+		y_line2 = y_line1 + pixfc->width;\
+		pixel_count = pixfc->width;\
+		while(pixel_count > 0) {\
+			*y_line1++ = src_line1[y_index];\
+			*y_line1++ = src_line1[y_index + 2];\
+			*y_line2++ = src_line2[y_index];\
+			*y_line2++ = src_line2[y_index + 2];\
+			*u_plane++ = chroma_resampling(src_line1[u_index], src_line2[u_index]);\
+			*v_plane++ = chroma_resampling(src_line1[u_index + 2], src_line2[u_index + 2]);\
+			src_line1 += 4;\
+			src_line2 += 4;\
+			pixel_count -= 2;\
+		}\
+		src_line1 += 2 * pixfc->source_row_bytes - pixfc->width * 2;\
+		y_line1 = y_line2;\
+	}\
+}
+
+DEFINE_YUV422I_TO_YUV420P_FN(convert_yuv422i_to_yuv420p_nonsse, NNB_CHROMA);
+DEFINE_YUV422I_TO_YUV420P_FN(downsample_n_convert_yuv422i_to_yuv420p_nonsse, AVG_CHROMA);
+
+
+
+/*
+ *
+ *	Y U Y V  /  U Y V Y
+ *
+ *	T O
+ *
+ *	U Y V Y  /  Y U Y V
+ *
+ */
+void		convert_yuv422i_to_yuv422i_nonsse(const struct PixFcSSE * pixfc, void* source_buffer, void* dest_buffer) {
+	uint32_t	src_padding_bytes = ROW_PADDING_BYTE_COUNT(pixfc->source_fmt, pixfc->width, pixfc->source_row_bytes);
+	uint32_t	dst_padding_bytes = ROW_PADDING_BYTE_COUNT(pixfc->dest_fmt, pixfc->width, pixfc->dest_row_bytes);
+	uint32_t	lines_remaining = pixfc->height;
+	uint32_t 	pixel_count;
+	uint8_t *	src = (uint8_t *)source_buffer;
+	uint8_t *	dst = (uint8_t *)dest_buffer;
+
+	// Do conversion
+	while(lines_remaining-- > 0) {
+		pixel_count = pixfc->width;
 		while(pixel_count > 0) {
-			*u_plane++ = *src++;
-			*y_plane++ = *src++;
-			*v_plane++ = *src++;
-			*y_plane++ = *src++;
+			dst[0] = src[1];
+			dst[1] = src[0];
+			dst[2] = src[3];
+			dst[3] = src[2];
+			src += 4;
+			dst += 4;
 
 			pixel_count -= 2;
 		}
-	else
-		printf("unknown source pixel format\n");
+		src += src_padding_bytes;
+		dst += dst_padding_bytes;
+	}
 }
 
 
@@ -333,8 +579,7 @@ void		convert_yuv422i_to_yuv422p_nonsse(const struct PixFcSSE * pixfc, void* sou
  *
  */
 
-void		convert_yuv422i_to_v210_nonsse(const struct PixFcSSE* pixfc, void* source_buffer, void* dest_buffer) {
-	PixFcPixelFormat 	src_fmt = pixfc->source_fmt;
+static FORCE_INLINE void convert_yuv422i_to_v210_nonsse_fmt(const struct PixFcSSE* pixfc, void* source_buffer, void* dest_buffer, const PixFcPixelFormat src_fmt, const PixFcPixelFormat dest_fmt) {
 	uint32_t 			line = 0;
 	uint32_t 			pixel = 0;
 	uint8_t*			src = (uint8_t *) source_buffer;
@@ -391,8 +636,14 @@ void		convert_yuv422i_to_v210_nonsse(const struct PixFcSSE* pixfc, void* source_
 			//printf("L4 %d %d %d %d\n", (u<<2), (y1<<2), (v<<2), (y2<<2));
 		}
 
-		dst = (uint32_t*) ((uint8_t*)dest_buffer + line * ROW_SIZE(PixFcV210, pixfc->width));
+		src = (uint8_t*)source_buffer + line * pixfc->source_row_bytes;
+		dst = (uint32_t*) ((uint8_t*)dest_buffer + line * pixfc->dest_row_bytes);
 		pixel = 0;
 	}
 }
 
+void		convert_yuv422i_to_v210_nonsse(const struct PixFcSSE* pixfc, void* source_buffer, void* dest_buffer) {
+	CALL_FOR_FORMATS(convert_yuv422i_to_v210_nonsse_fmt, pixfc, source_buffer, dest_buffer, PixFcYUYV, PixFcV210);
+	CALL_FOR_FORMATS(convert_yuv422i_to_v210_nonsse_fmt, pixfc, source_buffer, dest_buffer, PixFcUYVY, PixFcV210);
+	printf("unknown source pixel format\n");
+}
@@ -46,6 +46,7 @@
 	#define EXTERN_INLINE
 #endif
 	#define INLINE									inline
+	#define FORCE_INLINE							inline __attribute__((always_inline))
 
 #else
 
@@ -55,6 +56,7 @@
 	#define EXTERN_INLINE
 #endif
 	#define INLINE									__inline
+	#define FORCE_INLINE							__forceinline
 
 #endif
 
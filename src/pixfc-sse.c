@@ -17,14 +17,92 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  *
  */
+#include "autotune.h"
 #include "common.h"
 #include "conversion_blocks.h"
 #include "pixfc-sse.h"
 #include "pixfmt_descriptions.h"
+#include "thread_pool.h"
 
 #include <string.h>
 #include <stdlib.h>
 
+/*
+ * Private data attached to a struct PixFcSSE
+ */
+struct PixFcPrivate {
+	// The conversion block selected by create_pixfc()
+	const struct ConversionBlock *	block;
+	// Multithreading data (NULL unless the conversion is multithreaded)
+	struct PixFcMTData *			mt;
+	// Region of interest data (NULL unless created by create_pixfc_roi())
+	struct PixFcROIData *			roi;
+};
+
+/*
+ * Private data attached to a multithreaded struct PixFcSSE
+ */
+struct PixFcMTData {
+	struct ThreadPool *		pool;
+	// One struct PixFcSSE per thread, each describing a horizontal band
+	// of the image. The 'convert' member points to the conversion block.
+	struct PixFcSSE *		bands;
+	uint32_t *				band_first_lines;
+};
+
+/*
+ * Arguments passed to each job in the thread pool
+ */
+struct PixFcMTJob {
+	const struct PixFcMTData *	mt;
+	uint8_t *					in;
+	uint8_t *					out;
+};
+
+/*
+ * Arguments passed to each job in the thread pool by convert_batch()
+ */
+struct PixFcBatchJob {
+	// Converts a whole image with the conversion block
+	struct PixFcSSE				frame;
+	uint32_t					thread_count;
+	uint32_t					source_offset;
+	void **						in;
+	void **						out;
+	uint32_t					count;
+};
+
+/*
+ * Private data attached to a struct PixFcSSE converting a window of the
+ * source image
+ */
+struct PixFcROIData {
+	// Conversion function of the struct PixFcSSE before create_pixfc_roi()
+	// replaced it with convert_roi()
+	ConversionBlockFn		convert;
+	// Offset in bytes of the first pixel of the converted window in the
+	// source image
+	uint32_t				source_offset;
+	// The members below are only used if the window had to be widened to
+	// whole pixel groups ('staging' is NULL otherwise): 'window' converts a
+	// few lines of the widened window at a time to 'staging', and each line
+	// of the requested window is then copied from 'staging_offset' bytes
+	// into the staging line ('copy_bytes' bytes).
+	struct PixFcSSE			window;
+	uint8_t *				staging;
+	uint32_t				staging_offset;
+	uint32_t				copy_bytes;
+};
+
+/*
+ * Return the downscaling factor requested in 'flags' (1 if none).
+ */
+static uint32_t		get_downscale_factor(uint32_t flags) {
+	uint32_t	factor = PIXFC_DOWNSCALE_FACTOR(flags);
+
+	return (factor == 0) ? 1 : factor;
+}
+
 /*
  * Check if the given conversion block:
  * - converts from the given source format to the given destination format, 
@@ -33,6 +111,8 @@
 static uint32_t		block_matches_and_is_supported(struct PixFcSSE* conv, const struct ConversionBlock *block,
 		PixFcPixelFormat src_fmt, PixFcPixelFormat dest_fmt, uint32_t flags) {
 
+	uint32_t	factor = get_downscale_factor(flags);
+
 	// If this block does not handle the requested conversion, error out.
 	if ((block->source_fmt != src_fmt) || (block->dest_fmt != dest_fmt)) {
 		return PixFc_UnsupportedConversionError;
@@ -46,6 +126,18 @@ static uint32_t		block_matches_and_is_supported(struct PixFcSSE* conv, const str
 		dprint("Skipping '%s' - Enforcing NNbResampling flag\n", block->name);
 		return PixFc_UnsupportedConversionError;
 	}
+
+	// If we were told to downscale the image, make sure this block supports
+	// the requested factor. Otherwise, skip downscaling blocks.
+	if ((factor == 1) && (block->attributes & DOWNSCALE_CONVERSION)) {
+		dprint("Skipping '%s' - No downscaling requested\n", block->name);
+		return PixFc_UnsupportedConversionError;
+	}
+	if ((factor != 1) && ! ((block->attributes & DOWNSCALE_NX) || ((factor == 2) && (block->attributes & DOWNSCALE_2X))
+			|| ((factor == 4) && (block->attributes & DOWNSCALE_4X)))) {
+		dprint("Skipping '%s' - Enforcing %ux downscaling\n", block->name, factor);
+		return PixFc_UnsupportedConversionError;
+	}
 	
 	// If we were told to use a non-SSE integer conversion block, enforce it
 	if ((flags & PixFcFlag_NoSSE) && ((block->required_cpu_features != CPUID_FEATURE_NONE) || (block->attributes & NONSSE_FLOAT_CONVERSION))) {
@@ -85,36 +177,78 @@ static uint32_t		block_matches_and_is_supported(struct PixFcSSE* conv, const str
 		return PixFc_UnsupportedConversionError;
 	}
 
+	// If we were told to use an SSE2, SSSE3 and SSE41 routine, make sure that's the case
+	if ((flags & PixFcFlag_SSE2_SSSE3_SSE41Only) && (block->required_cpu_features != (CPUID_FEATURE_SSE2 | CPUID_FEATURE_SSSE3 | CPUID_FEATURE_SSE41))) {
+		dprint("Skipping '%s' - Enforcing FORCE_SSE2_SSSE3_SSE41_ONLY flag\n", block->name);
+		return PixFc_UnsupportedConversionError;
+	}
+
+	// If we were told to use an AVX2 routine, make sure that's the case
+	if ((flags & PixFcFlag_AVX2Only) && (block->required_cpu_features != CPUID_FEATURE_AVX2)) {
+		dprint("Skipping '%s' - Enforcing FORCE_AVX2_ONLY flag\n", block->name);
+		return PixFc_UnsupportedConversionError;
+	}
+
+	// If we were told to use an AVX-512 routine, make sure that's the case
+	if ((flags & PixFcFlag_AVX512Only) && (block->required_cpu_features != CPUID_FEATURE_AVX512)) {
+		dprint("Skipping '%s' - Enforcing FORCE_AVX512_ONLY flag\n", block->name);
+		return PixFc_UnsupportedConversionError;
+	}
+
+	// If we were told to use a NEON routine, make sure that's the case
+	if ((flags & PixFcFlag_NEONOnly) && (block->required_cpu_features != CPUID_FEATURE_NEON)) {
+		dprint("Skipping '%s' - Enforcing FORCE_NEON_ONLY flag\n", block->name);
+		return PixFc_UnsupportedConversionError;
+	}
+
+	// AVX2 & AVX-512 routines do not implement non-temporal stores, skip them
+	// unless we were told to use an AVX2 / AVX-512 routine.
+	if ((flags & PixFcFlag_NonTemporalStores) && ! (flags & (PixFcFlag_AVX2Only | PixFcFlag_AVX512Only))
+			&& ((block->required_cpu_features == CPUID_FEATURE_AVX2) || (block->required_cpu_features == CPUID_FEATURE_AVX512))) {
+		dprint("Skipping '%s' - Non-temporal stores requested\n", block->name);
+		return PixFc_UnsupportedConversionError;
+	}
+
 	// If the cpu does not have the required features, error out.
-	if (does_cpu_support(block->required_cpu_features) != 0) {
+	if (is_conversion_block_supported(block - conversion_blocks) != 0) {
 		dprint("Skipping '%s' - CPU feature mismatch:\n", block->name);
 		dprint("Required CPU features:  %#08llx\n", (long long unsigned int)block->required_cpu_features);
 		dprint("Supported CPU features: %#08llx\n", (long long unsigned int)get_cpu_features());
 
-		// If both 'PixFcFlag_SSE2_SSSE3Only' and 'PixFcFlag_SSE2Only' are not set,
-		// then return PixFc_UnsupportedConversionError, so we keep looking for a potential
-		// conversion block supported by the CPU. However, if either of these 2 flags is present,
-		// return PixFc_NoCPUSupport since the user requested a specific SSE version, but the CPU
-		// does not support it.
-		return ((! (flags & PixFcFlag_SSE2_SSSE3Only)) && (! (flags & PixFcFlag_SSE2Only))) ? PixFc_UnsupportedConversionError : PixFc_NoCPUSupport;
+		// If none of the 'PixFcFlag_SSE2Only', 'PixFcFlag_SSE2_SSSE3Only', 'PixFcFlag_SSE2_SSSE3_SSE41Only'
+		// 'PixFcFlag_AVX2Only', 'PixFcFlag_AVX512Only' and 'PixFcFlag_NEONOnly' flags is set, then return
+		// PixFc_UnsupportedConversionError, so we keep looking for a potential conversion block supported by
+		// the CPU. However, if one of these flags is present, return PixFc_NoCPUSupport since the user requested
+		// a specific SSE / AVX / NEON version, but the CPU does not support it.
+		return ((flags & (PixFcFlag_SSE2Only | PixFcFlag_SSE2_SSSE3Only | PixFcFlag_SSE2_SSSE3_SSE41Only | PixFcFlag_AVX2Only | PixFcFlag_AVX512Only | PixFcFlag_NEONOnly)) == 0) ? PixFc_UnsupportedConversionError : PixFc_NoCPUSupport;
 	}
 
 	
 	//
 	// At this stage, we have found a conversion block which matches the flags given to us.
+
+	// The source image must be made of whole blocks of pixels when downscaling.
+	if ((conv->width % factor != 0) || (conv->height % factor != 0)) {
+		dprint("Skipping '%s' - Dimensions (%ux%u) not multiple of downscaling factor %u\n", block->name, conv->width, conv->height, factor);
+		return PixFc_UnsupportedSourceImageDimension;
+	}
 	
-	// Check the bytes-per-row value
-	if (conv->source_row_bytes != ROW_SIZE(block->source_fmt, conv->width)) {
-		dprint("Skipping '%s' - Invalid source row bytes %u - expected %d\n", block->name, conv->source_row_bytes, ROW_SIZE(block->source_fmt, conv->width));
+	// Check the bytes-per-row value. The destination image is 'factor'
+	// times narrower than the source one when downscaling. Interleaved formats can have padding at
+	// the end of each line, but the planes of planar formats must be packed.
+	if ((conv->source_row_bytes < ROW_SIZE(block->source_fmt, conv->width))
+		|| (pixfmt_descriptions[block->source_fmt].is_planar && (conv->source_row_bytes != ROW_SIZE(block->source_fmt, conv->width)))) {
+		dprint("Skipping '%s' - Invalid source row bytes %u - expected %s%d\n", block->name, conv->source_row_bytes, pixfmt_descriptions[block->source_fmt].is_planar ? "" : "at least ", ROW_SIZE(block->source_fmt, conv->width));
 		return PixFc_InvalidSourceBufferRowSize;
 	}
-	if (conv->dest_row_bytes != ROW_SIZE(block->dest_fmt, conv->width)) {
-		dprint("Skipping '%s' - Invalid dest row bytes %u - expected %d\n", block->name, conv->dest_row_bytes, ROW_SIZE(block->dest_fmt, conv->width));
+	if ((conv->dest_row_bytes < ROW_SIZE(block->dest_fmt, conv->width / factor))
+		|| (pixfmt_descriptions[block->dest_fmt].is_planar && (conv->dest_row_bytes != ROW_SIZE(block->dest_fmt, conv->width / factor)))) {
+		dprint("Skipping '%s' - Invalid dest row bytes %u - expected %s%d\n", block->name, conv->dest_row_bytes, pixfmt_descriptions[block->dest_fmt].is_planar ? "" : "at least ", ROW_SIZE(block->dest_fmt, conv->width / factor));
 		return PixFc_InvalidDestBufferRowSize;
 	}
 
-	// If the width is not multiple of the required value, error out.
-	if (conv->width % block->width_multiple != 0) {
+	// If the (output) width is not multiple of the required value, error out.
+	if ((conv->width / factor) % block->width_multiple != 0) {
 		dprint("Skipping '%s' - Width (%u) not multiple of %u\n", block->name, conv->pixel_count, block->width_multiple);
 		return PixFc_UnsupportedSourceImageDimension;
 	}
@@ -132,19 +266,60 @@ static uint32_t		block_matches_and_is_supported(struct PixFcSSE* conv, const str
 
 
 /*
- * Go through the list of conversion blocks and look for one that matches
- * the requested source and destination formats. Also check that
+ * Set up 'conv' to use the given conversion block, and set the flag
+ * indicating what CPU features it uses in the flags returned in 'conv'.
+ */
+static void		use_conversion_block(struct PixFcSSE* conv, const struct ConversionBlock *block, uint32_t flags) {
+
+	conv->convert = block->convert_fn;
+
+	// TODO: Update here when new flags are added
+	// Make sure there is a flag which indicates what CPU features this conversion uses
+	if ((flags & (PixFcFlag_NoSSE| PixFcFlag_NoSSEFloat | PixFcFlag_SSE2Only | PixFcFlag_SSE2_SSSE3Only | PixFcFlag_SSE2_SSSE3_SSE41Only | PixFcFlag_AVX2Only | PixFcFlag_AVX512Only | PixFcFlag_NEONOnly)) == 0) {
+		// Set the correct flag for this conversion
+		if (block->required_cpu_features == CPUID_FEATURE_NEON)
+			flags |= PixFcFlag_NEONOnly;
+		else if (block->required_cpu_features == CPUID_FEATURE_AVX512)
+			flags |= PixFcFlag_AVX512Only;
+		else if (block->required_cpu_features == CPUID_FEATURE_AVX2)
+			flags |= PixFcFlag_AVX2Only;
+		else if ((block->required_cpu_features & CPUID_FEATURE_SSE41) != 0)
+			flags |= PixFcFlag_SSE2_SSSE3_SSE41Only;
+		else if ((block->required_cpu_features & CPUID_FEATURE_SSSE3) != 0)
+			flags |= PixFcFlag_SSE2_SSSE3Only;
+		else if ((block->required_cpu_features & CPUID_FEATURE_SSE2) != 0)
+			flags |= PixFcFlag_SSE2Only;
+		else if ((block->required_cpu_features & CPUID_FEATURE_NONE) != 0 && (block->attributes & NONSSE_FLOAT_CONVERSION) != 0)
+			flags |= PixFcFlag_NoSSEFloat;
+		else if ((block->required_cpu_features & CPUID_FEATURE_NONE) != 0 && (block->attributes & NONSSE_FLOAT_CONVERSION) == 0)
+			flags |= PixFcFlag_NoSSE;
+	}
+	// Only SSE routines use non-temporal stores
+	if ((block->required_cpu_features == CPUID_FEATURE_NONE) || (block->required_cpu_features == CPUID_FEATURE_AVX2)
+			|| (block->required_cpu_features == CPUID_FEATURE_AVX512) || (block->required_cpu_features == CPUID_FEATURE_NEON))
+		flags &= ~PixFcFlag_NonTemporalStores;
+
+	conv->flags = flags;
+}
+
+/*
+ * Go through the conversion blocks for the requested source and destination
+ * formats and look for one that matches the flags. Also check that
  * the CPU has the features required to run the conversion block.
  */
 static uint32_t	look_for_matching_conversion_block(struct PixFcSSE* conv, 
-		PixFcPixelFormat src_fmt, PixFcPixelFormat dest_fmt, uint32_t flags) {
+		PixFcPixelFormat src_fmt, PixFcPixelFormat dest_fmt, uint32_t flags,
+		const struct ConversionBlock **matching_block) {
 
 	uint32_t						index;
+	uint32_t						first;
+	uint32_t						count;
 	const struct ConversionBlock *	block;
 	uint32_t						result;
 
-	// Go over the array of conversion blocks
-	for(index = 0; index < conversion_blocks_count; index++) {
+	// Go over the conversion blocks for these formats only
+	first = get_conversion_block_range(src_fmt, dest_fmt, &count);
+	for(index = first; index < first + count; index++) {
 
 		// Check if this conversion block matches the source and 
 		// destination formats and if the CPU has the required features.
@@ -156,24 +331,8 @@ static uint32_t	look_for_matching_conversion_block(struct PixFcSSE* conv,
 			if (result == PixFc_OK) {
 
 				// We have a match, finish setting up the struct PixFcSSE
-				conv->convert = block->convert_fn;
-
-				// TODO: Update here when new flags are added
-				// Make sure there is a flag which indicates what CPU features this conversion uses
-				if ((flags & (PixFcFlag_NoSSE| PixFcFlag_NoSSEFloat | PixFcFlag_SSE2Only | PixFcFlag_SSE2_SSSE3Only | PixFcFlag_SSE2_SSSE3_SSE41Only)) == 0) {
-					// Set the correct flag for this conversion
-					if ((block->required_cpu_features & CPUID_FEATURE_SSE41) != 0)
-						flags |= PixFcFlag_SSE2_SSSE3_SSE41Only;
-					else if ((block->required_cpu_features & CPUID_FEATURE_SSSE3) != 0)
-						flags |= PixFcFlag_SSE2_SSSE3Only;
-					else if ((block->required_cpu_features & CPUID_FEATURE_SSE2) != 0)
-						flags |= PixFcFlag_SSE2Only;
-					else if ((block->required_cpu_features & CPUID_FEATURE_NONE) != 0 && (block->attributes & NONSSE_FLOAT_CONVERSION) != 0)
-						flags |= PixFcFlag_NoSSEFloat;
-					else if ((block->required_cpu_features & CPUID_FEATURE_NONE) != 0 && (block->attributes & NONSSE_FLOAT_CONVERSION) == 0)
-						flags |= PixFcFlag_NoSSE;
-				}
-				conv->flags = flags;
+				use_conversion_block(conv, block, flags);
+				*matching_block = block;
 
 				dprint("Found conversion block (flags: 0x%08x)\n", conv->flags);
 			}
@@ -186,13 +345,255 @@ static uint32_t	look_for_matching_conversion_block(struct PixFcSSE* conv,
 	return PixFc_UnsupportedConversionError;
 }
 
+/*
+ * Replace the conversion block found by look_for_matching_conversion_block()
+ * with the fastest conversion block matching the flags on this CPU, as
+ * recorded in the autotuning cache or measured on a synthetic image.
+ * Non-SSE float conversion blocks are only considered if requested.
+ */
+static uint32_t	autotune_conversion_block(struct PixFcSSE* conv, uint32_t flags,
+		const struct ConversionBlock **matching_block) {
 
-uint32_t		create_pixfc(struct PixFcSSE** pc, PixFcPixelFormat src_fmt,
+	const struct ConversionBlock *	candidates[AUTOTUNE_MAX_CANDIDATES];
+	struct PixFcSSE *				candidate_convs;
+	uint32_t						candidate_count = 0;
+	uint32_t						index;
+	uint32_t						first;
+	uint32_t						count;
+	const struct ConversionBlock *	block;
+	char							name[AUTOTUNE_MAX_NAME_LENGTH];
+
+	// List the conversion blocks look_for_matching_conversion_block()
+	// could have returned, starting with the one it did return.
+	first = get_conversion_block_range(conv->source_fmt, conv->dest_fmt, &count);
+	for(index = first; (index < first + count) && (candidate_count < AUTOTUNE_MAX_CANDIDATES); index++) {
+		block = &conversion_blocks[index];
+
+		if ((block != *matching_block) && (((block->attributes & NONSSE_FLOAT_CONVERSION) && ! (flags & PixFcFlag_NoSSEFloat))
+				|| (block_matches_and_is_supported(conv, block, conv->source_fmt, conv->dest_fmt, flags) != PixFc_OK)))
+			continue;
+
+		candidates[candidate_count++] = block;
+	}
+	if (candidate_count < 2)
+		return PixFc_OK;
+
+	// Use the fastest conversion block in the cache if it is still a candidate
+	if (load_autotuned_block_name(conv, flags, name) == 0) {
+		for(index = 0; index < candidate_count; index++) {
+			if (strcmp(candidates[index]->name, name) == 0) {
+				dprint("Using autotuned conversion block '%s' from cache\n", name);
+				use_conversion_block(conv, candidates[index], flags);
+				*matching_block = candidates[index];
+				return PixFc_OK;
+			}
+		}
+	}
+
+	// Otherwise time each candidate on a synthetic image
+	candidate_convs = (struct PixFcSSE *) malloc(candidate_count * sizeof(*candidate_convs));
+	if (! candidate_convs)
+		return PixFc_OOMError;
+
+	for(index = 0; index < candidate_count; index++) {
+		candidate_convs[index] = *conv;
+		use_conversion_block(&candidate_convs[index], candidates[index], flags);
+	}
+	index = find_fastest_conversion(candidate_convs, candidate_count);
+	free(candidate_convs);
+
+	dprint("Autotuned conversion block: '%s'\n", candidates[index]->name);
+	save_autotuned_block_name(conv, flags, candidates[index]->name);
+
+	use_conversion_block(conv, candidates[index], flags);
+	*matching_block = candidates[index];
+
+	return PixFc_OK;
+}
+
+
+/*
+ * Setup 'band' to run the conversion block of 'conv' over 'line_count'
+ * lines only. The conversion block must be given pointers to the first
+ * line of the band in the source and destination buffers.
+ */
+static void		setup_band(const struct PixFcSSE *conv, uint32_t line_count, struct PixFcSSE *band) {
+	memcpy(band, conv, sizeof(*conv));
+	band->convert = ((const struct PixFcPrivate *) conv->private_data)->block->convert_fn;
+	band->height = line_count;
+	band->pixel_count = conv->width * line_count;
+	band->thread_count = 1;
+	band->private_data = NULL;
+}
+
+/*
+ * Convert the band matching the given job index.
+ */
+static void		convert_band(void *arg, uint32_t job_index) {
+	struct PixFcMTJob *			job = (struct PixFcMTJob *) arg;
+	const struct PixFcSSE *		band = &job->mt->bands[job_index];
+	uint32_t					first_line = job->mt->band_first_lines[job_index];
+
+	// Some bands may be empty if the image is not high enough
+	if (band->height == 0)
+		return;
+
+	band->convert(band, job->in + first_line * band->source_row_bytes,
+			job->out + first_line / get_downscale_factor(band->flags) * band->dest_row_bytes);
+}
+
+/*
+ * Conversion function used by multithreaded struct PixFcSSE:
+ * run the conversion block on each band concurrently.
+ */
+static void		convert_mt(const struct PixFcSSE *conv, void *in, void *out) {
+	struct PixFcMTJob	job;
+
+	job.mt = ((const struct PixFcPrivate *) conv->private_data)->mt;
+	job.in = (uint8_t *) in;
+	job.out = (uint8_t *) out;
+
+	run_thread_pool_jobs(job.mt->pool, convert_band, &job);
+}
+
+/*
+ * Conversion function used by struct PixFcSSE created by create_pixfc_roi():
+ * offset the source buffer to the first pixel of the window, and go through
+ * the staging buffer if the window had to be widened.
+ */
+static void		convert_roi(const struct PixFcSSE *conv, void *in, void *out) {
+	const struct PixFcROIData *	roi = ((const struct PixFcPrivate *) conv->private_data)->roi;
+	uint8_t *					src = (uint8_t *) in + roi->source_offset;
+	uint8_t *					dst = (uint8_t *) out;
+	uint32_t					out_lines = roi->window.height / get_downscale_factor(conv->flags);
+	uint32_t					line;
+	uint32_t					index;
+
+	if (! roi->staging) {
+		roi->convert(conv, src, out);
+		return;
+	}
+
+	for(line = 0; line < conv->height; line += roi->window.height) {
+		roi->window.convert(&roi->window, src, roi->staging);
+
+		for(index = 0; index < out_lines; index++) {
+			memcpy(dst, roi->staging + index * roi->window.dest_row_bytes + roi->staging_offset, roi->copy_bytes);
+			dst += conv->dest_row_bytes;
+		}
+
+		src += roi->window.height * conv->source_row_bytes;
+	}
+}
+
+static void		release_roi_data(struct PixFcROIData *roi) {
+	if (! roi)
+		return;
+
+	free(roi->staging);
+	free(roi);
+}
+
+/*
+ * Convert the images of a batch matching the given job index.
+ */
+static void		convert_batch_images(void *arg, uint32_t job_index) {
+	const struct PixFcBatchJob *	job = (const struct PixFcBatchJob *) arg;
+	uint32_t						index = job->count * job_index / job->thread_count;
+	uint32_t						last = job->count * (job_index + 1) / job->thread_count;
+
+	for(; index < last; index++)
+		job->frame.convert(&job->frame, (uint8_t *) job->in[index] + job->source_offset, job->out[index]);
+}
+
+static void		release_mt_data(struct PixFcMTData *mt) {
+	if (! mt)
+		return;
+
+	destroy_thread_pool(mt->pool);
+	free(mt->bands);
+	free(mt->band_first_lines);
+	free(mt);
+}
+
+/*
+ * Split the image in 'thread_count' horizontal bands, each one a multiple
+ * of the conversion block's height multiple (times the downscaling factor,
+ * as the height multiple applies to the output image), and start the
+ * thread pool.
+ * If the image can not be split, the struct PixFcSSE is left untouched and
+ * the conversion will run on the calling thread only.
+ */
+static uint32_t	setup_mt_conversion(struct PixFcSSE *conv, const struct ConversionBlock *block, uint32_t thread_count) {
+	struct PixFcMTData *	mt;
+	uint32_t				band_height;
+	uint32_t				band_multiple = block->height_multiple * get_downscale_factor(conv->flags);
+	uint32_t				line = 0;
+	uint32_t				index;
+
+	// Planar formats have their chroma planes located after the Y plane
+	// and can not be split in bands by simply offsetting buffer pointers.
+	if (pixfmt_descriptions[conv->source_fmt].is_planar || pixfmt_descriptions[conv->dest_fmt].is_planar) {
+		dprint("Planar formats - conversion will not be multithreaded\n");
+		return PixFc_OK;
+	}
+
+	if (thread_count == 0)
+		thread_count = get_cpu_count();
+
+	// Work out band height and do not create more bands than needed
+	band_height = (conv->height + thread_count - 1) / thread_count;
+	band_height = (band_height + band_multiple - 1) / band_multiple * band_multiple;
+	thread_count = (conv->height + band_height - 1) / band_height;
+	if (thread_count <= 1)
+		return PixFc_OK;
+
+	mt = (struct PixFcMTData *) malloc(sizeof(*mt));
+	if (! mt)
+		return PixFc_OOMError;
+	memset(mt, 0x0, sizeof(*mt));
+
+	mt->bands = (struct PixFcSSE *) malloc(thread_count * sizeof(*mt->bands));
+	mt->band_first_lines = (uint32_t *) malloc(thread_count * sizeof(*mt->band_first_lines));
+	if (! mt->bands || ! mt->band_first_lines) {
+		release_mt_data(mt);
+		return PixFc_OOMError;
+	}
+
+	// Setup each band
+	for(index = 0; index < thread_count; index++) {
+		setup_band(conv, ((conv->height - line) < band_height) ? (conv->height - line) : band_height, &mt->bands[index]);
+		mt->band_first_lines[index] = line;
+		line += mt->bands[index].height;
+	}
+
+	mt->pool = create_thread_pool(thread_count);
+	if (! mt->pool) {
+		release_mt_data(mt);
+		return PixFc_Error;
+	}
+
+	dprint("Conversion split in %u bands of %u lines\n", thread_count, band_height);
+
+	conv->convert = convert_mt;
+	conv->thread_count = thread_count;
+	conv->flags |= PixFcFlag_MultiThreaded;
+	((struct PixFcPrivate *) conv->private_data)->mt = mt;
+
+	return PixFc_OK;
+}
+
+/*
+ * Create a struct PixFcSSE, using 'thread_count' threads (0 for one
+ * per CPU) if PixFcFlag_MultiThreaded is present in 'flags'.
+ */
+static uint32_t	create_pixfc_internal(struct PixFcSSE** pc, PixFcPixelFormat src_fmt,
 		PixFcPixelFormat dest_fmt, uint32_t width, uint32_t height, uint32_t src_row_bytes,
-		uint32_t dest_row_bytes, uint32_t flags){
+		uint32_t dest_row_bytes, uint32_t flags, uint32_t thread_count){
 
-	struct PixFcSSE *		conv;
-	uint32_t				result;
+	struct PixFcSSE *				conv;
+	const struct ConversionBlock *	block = NULL;
+	uint32_t						result;
 
 	// Make sure we have a valid pointer.
 	if (! pc)
@@ -212,13 +613,36 @@ uint32_t		create_pixfc(struct PixFcSSE** pc, PixFcPixelFormat src_fmt,
 	conv->source_row_bytes = src_row_bytes;
 	conv->dest_row_bytes = dest_row_bytes;
 	conv->pixel_count = width * height;
+	conv->thread_count = 1;
 
 	dprint("Requested src / dst fmt:\t%s\t%s\n", pixfmt_descriptions[src_fmt].name,
 			pixfmt_descriptions[dest_fmt].name);
 	dprint("Supported CPU features: %#08llx\n", (long long unsigned int)get_cpu_features());
 
+	// A downscaling factor of 1 means no downscaling
+	if (PIXFC_DOWNSCALE_FACTOR(flags) == 1)
+		flags &= ~PixFcFlag_DownscaleMask;
+
 	// Look for a conversion block to do the requested conversion
-	result = look_for_matching_conversion_block(conv, src_fmt, dest_fmt, flags);
+	result = look_for_matching_conversion_block(conv, src_fmt, dest_fmt, flags & ~(PixFcFlag_MultiThreaded | PixFcFlag_Autotune), &block);
+
+	// Replace it with the fastest one on this CPU if requested
+	if ((result == PixFc_OK) && (flags & PixFcFlag_Autotune))
+		result = autotune_conversion_block(conv, flags & ~(PixFcFlag_MultiThreaded | PixFcFlag_Autotune), &block);
+
+	// Keep track of the conversion block
+	if (result == PixFc_OK) {
+		conv->private_data = malloc(sizeof(struct PixFcPrivate));
+		if (conv->private_data) {
+			memset(conv->private_data, 0x0, sizeof(struct PixFcPrivate));
+			((struct PixFcPrivate *) conv->private_data)->block = block;
+		} else
+			result = PixFc_OOMError;
+	}
+
+	// Split the conversion over several threads if requested
+	if ((result == PixFc_OK) && (flags & PixFcFlag_MultiThreaded) && (thread_count != 1))
+		result = setup_mt_conversion(conv, block, thread_count);
 
 	// Return struct PixFcSSE if OK, release it otherwise
 	if (result == PixFc_OK)
@@ -229,8 +653,273 @@ uint32_t		create_pixfc(struct PixFcSSE** pc, PixFcPixelFormat src_fmt,
 	return result;
 }
 
+uint32_t		create_pixfc(struct PixFcSSE** pc, PixFcPixelFormat src_fmt,
+		PixFcPixelFormat dest_fmt, uint32_t width, uint32_t height, uint32_t src_row_bytes,
+		uint32_t dest_row_bytes, uint32_t flags){
+
+	return create_pixfc_internal(pc, src_fmt, dest_fmt, width, height, src_row_bytes, dest_row_bytes, flags, 0);
+}
+
+uint32_t		create_pixfc_mt(struct PixFcSSE** pc, PixFcPixelFormat src_fmt,
+		PixFcPixelFormat dest_fmt, uint32_t width, uint32_t height, uint32_t src_row_bytes,
+		uint32_t dest_row_bytes, uint32_t flags, uint32_t thread_count){
+
+	return create_pixfc_internal(pc, src_fmt, dest_fmt, width, height, src_row_bytes, dest_row_bytes, flags | PixFcFlag_MultiThreaded, thread_count);
+}
+
+uint32_t		create_pixfc_roi(struct PixFcSSE** pc, PixFcPixelFormat src_fmt,
+		PixFcPixelFormat dest_fmt, uint32_t src_width, uint32_t src_height, uint32_t src_row_bytes,
+		uint32_t x, uint32_t y, uint32_t width, uint32_t height, uint32_t dest_row_bytes, uint32_t flags){
+
+	struct PixFcSSE *		conv;
+	struct PixFcROIData *	roi;
+	uint32_t				factor = get_downscale_factor(flags);
+	uint32_t				src_group;
+	uint32_t				dest_group;
+	uint32_t				start;
+	uint32_t				window_width;
+	uint32_t				staging_row_bytes = 0;
+	uint32_t				band_multiple;
+	uint32_t				result;
+
+	if (! pc)
+		return PixFc_Error;
+
+	if ((src_fmt < 0) || (src_fmt >= PixFcFormatCount) || (dest_fmt < 0) || (dest_fmt >= PixFcFormatCount))
+		return PixFc_UnsupportedConversionError;
+
+	// The planes of planar formats are located using the dimensions of the
+	// whole image, so only windows of interleaved images can be converted.
+	if (pixfmt_descriptions[src_fmt].is_planar) {
+		dprint("Windows of planar images can not be converted\n");
+		return PixFc_InvalidRegionOfInterest;
+	}
+
+	// The window must be within the source image
+	if ((width == 0) || (height == 0) || (x >= src_width) || (width > src_width - x)
+			|| (y >= src_height) || (height > src_height - y) || (width % factor != 0) || (height % factor != 0)) {
+		dprint("Invalid window %ux%u at (%u, %u) in %ux%u image\n", width, height, x, y, src_width, src_height);
+		return PixFc_InvalidRegionOfInterest;
+	}
+
+	if (src_row_bytes < ROW_SIZE(src_fmt, src_width)) {
+		dprint("Invalid source row bytes %u - expected at least %d\n", src_row_bytes, ROW_SIZE(src_fmt, src_width));
+		return PixFc_InvalidSourceBufferRowSize;
+	}
+
+	// Find the smallest window starting and ending on whole pixel groups
+	// of the source format which contains the requested one. The pixels
+	// added on the left must make up whole (downscaled) pixel groups of the
+	// destination format, so the requested pixels can be copied out of the
+	// converted lines.
+	src_group = pixfmt_descriptions[src_fmt].pixel_group_width;
+	dest_group = pixfmt_descriptions[dest_fmt].pixel_group_width * factor;
+	for(start = x; (start > 0) && ((start % src_group != 0) || ((x - start) % dest_group != 0)); start--);
+	for(window_width = x - start + width; (window_width % src_group != 0) || (window_width % factor != 0); window_width++);
+
+	if ((start % src_group != 0) || ((x - start) % dest_group != 0) || (start + window_width > ALIGNED_WIDTH(src_fmt, src_width))) {
+		dprint("Window at x = %u can not be widened to whole pixel groups\n", x);
+		return PixFc_InvalidRegionOfInterest;
+	}
+
+	// A widened window is converted in a staging buffer
+	if ((start != x) || (window_width != width)) {
+		if (pixfmt_descriptions[dest_fmt].is_planar || (width % dest_group != 0)) {
+			dprint("Window width %u can not be copied out of the converted lines\n", width);
+			return PixFc_InvalidRegionOfInterest;
+		}
+
+		if (dest_row_bytes < ROW_SIZE(dest_fmt, width / factor)) {
+			dprint("Invalid dest row bytes %u - expected at least %d\n", dest_row_bytes, ROW_SIZE(dest_fmt, width / factor));
+			return PixFc_InvalidDestBufferRowSize;
+		}
+
+		staging_row_bytes = ROW_SIZE(dest_fmt, window_width / factor);
+		flags &= ~PixFcFlag_MultiThreaded;
+	}
+
+	result = create_pixfc_internal(&conv, src_fmt, dest_fmt, window_width, height, src_row_bytes,
+			(staging_row_bytes != 0) ? staging_row_bytes : dest_row_bytes, flags, 0);
+	if (result != PixFc_OK)
+		return result;
+
+	roi = (struct PixFcROIData *) malloc(sizeof(*roi));
+	if (! roi) {
+		destroy_pixfc(conv);
+		return PixFc_OOMError;
+	}
+	memset(roi, 0x0, sizeof(*roi));
+	((struct PixFcPrivate *) conv->private_data)->roi = roi;
+
+	roi->convert = conv->convert;
+	roi->source_offset = y * src_row_bytes + start * pixfmt_descriptions[src_fmt].bytes_per_pix_num / pixfmt_descriptions[src_fmt].bytes_per_pix_denom;
+
+	if (staging_row_bytes != 0) {
+		// Convert as few lines as the conversion block allows at a time,
+		// so the staging buffer stays in the cache.
+		band_multiple = ((struct PixFcPrivate *) conv->private_data)->block->height_multiple * factor;
+		setup_band(conv, band_multiple, &roi->window);
+
+		roi->staging = (uint8_t *) malloc(band_multiple / factor * staging_row_bytes);
+		if (! roi->staging) {
+			destroy_pixfc(conv);
+			return PixFc_OOMError;
+		}
+		roi->staging_offset = (x - start) / factor * pixfmt_descriptions[dest_fmt].bytes_per_pix_num / pixfmt_descriptions[dest_fmt].bytes_per_pix_denom;
+		roi->copy_bytes = width / factor * pixfmt_descriptions[dest_fmt].bytes_per_pix_num / pixfmt_descriptions[dest_fmt].bytes_per_pix_denom;
+
+		// The struct PixFcSSE describes the requested window
+		conv->width = width;
+		conv->pixel_count = width * height;
+		conv->dest_row_bytes = dest_row_bytes;
+
+		dprint("Window widened to %u pixels from x = %u\n", window_width, start);
+	}
+
+	conv->convert = convert_roi;
+	*pc = conv;
+
+	return PixFc_OK;
+}
+
+uint32_t		convert_lines(const struct PixFcSSE* conv, void* in, void* out, uint32_t first_line, uint32_t line_count) {
+	const struct ConversionBlock *	block;
+	const struct PixFcROIData *		roi;
+	struct PixFcSSE					band;
+	uint32_t						band_multiple;
+
+	if (! conv || ! conv->private_data)
+		return PixFc_Error;
+
+	block = ((const struct PixFcPrivate *) conv->private_data)->block;
+	roi = ((const struct PixFcPrivate *) conv->private_data)->roi;
+	band_multiple = block->height_multiple * get_downscale_factor(conv->flags);
+
+	// Windows widened to whole pixel groups are converted through a
+	// single staging buffer, and can not be converted in bands.
+	if (roi && roi->staging) {
+		dprint("Widened windows can not be converted in bands\n");
+		return PixFc_UnsupportedConversionError;
+	}
+
+	// The chroma planes of planar formats are located using the height
+	// of the whole image, so these can not be converted in bands yet.
+	if (pixfmt_descriptions[conv->source_fmt].is_planar || pixfmt_descriptions[conv->dest_fmt].is_planar) {
+		dprint("Planar formats can not be converted in bands\n");
+		return PixFc_UnsupportedConversionError;
+	}
+
+	// The range of lines must be within the image, and each band must be
+	// a multiple of the conversion block's height multiple (in source lines
+	// when downscaling).
+	if ((line_count == 0) || (first_line >= conv->height) || (line_count > conv->height - first_line)
+			|| (first_line % band_multiple != 0) || (line_count % band_multiple != 0)) {
+		dprint("Invalid range of lines (%u - %u)\n", first_line, first_line + line_count);
+		return PixFc_InvalidLineRange;
+	}
+
+	// Lines are relative to the window of ROI conversions
+	if (roi)
+		in = (uint8_t *) in + roi->source_offset;
+
+	setup_band(conv, line_count, &band);
+	band.convert(&band, (uint8_t *) in + first_line * conv->source_row_bytes,
+			(uint8_t *) out + first_line / get_downscale_factor(conv->flags) * conv->dest_row_bytes);
+
+	return PixFc_OK;
+}
+
+uint32_t		convert_batch(const struct PixFcSSE* conv, void** in, void** out, uint32_t count) {
+	const struct PixFcPrivate *	private_data;
+	struct PixFcBatchJob		job;
+	uint32_t					index;
+
+	if (! conv || ! conv->private_data || (count && (! in || ! out)))
+		return PixFc_Error;
+
+	private_data = (const struct PixFcPrivate *) conv->private_data;
+
+	// Widened windows go through a single staging buffer
+	if (private_data->roi && private_data->roi->staging) {
+		for(index = 0; index < count; index++)
+			conv->convert(conv, in[index], out[index]);
+
+		return PixFc_OK;
+	}
+
+	setup_band(conv, conv->height, &job.frame);
+	job.source_offset = private_data->roi ? private_data->roi->source_offset : 0;
+	job.in = in;
+	job.out = out;
+	job.count = count;
+
+	// Give each thread its share of the images, or convert them all here
+	if (private_data->mt) {
+		job.thread_count = conv->thread_count;
+		run_thread_pool_jobs(private_data->mt->pool, convert_batch_images, &job);
+	} else {
+		job.thread_count = 1;
+		convert_batch_images(&job, 0);
+	}
+
+	return PixFc_OK;
+}
+
+uint32_t		set_pixfc_prefetch_distance(struct PixFcSSE* conv, uint32_t distance) {
+	struct PixFcMTData *	mt;
+	struct PixFcROIData *	roi;
+	uint32_t				index;
+
+	if (! conv || ! conv->private_data)
+		return PixFc_Error;
+
+	conv->prefetch_distance = distance;
+
+	// Bands of a multithreaded conversion are copies of 'conv'
+	mt = ((struct PixFcPrivate *) conv->private_data)->mt;
+	if (mt)
+		for(index = 0; index < conv->thread_count; index++)
+			mt->bands[index].prefetch_distance = distance;
+
+	// So is the window converted by widened ROI conversions
+	roi = ((struct PixFcPrivate *) conv->private_data)->roi;
+	if (roi)
+		roi->window.prefetch_distance = distance;
+
+	return PixFc_OK;
+}
+
+uint32_t		set_pixfc_alpha(struct PixFcSSE* conv, uint8_t alpha) {
+	struct PixFcMTData *	mt;
+	struct PixFcROIData *	roi;
+	uint32_t				index;
+
+	if (! conv || ! conv->private_data)
+		return PixFc_Error;
+
+	conv->alpha = alpha;
+
+	// Bands of a multithreaded conversion are copies of 'conv'
+	mt = ((struct PixFcPrivate *) conv->private_data)->mt;
+	if (mt)
+		for(index = 0; index < conv->thread_count; index++)
+			mt->bands[index].alpha = alpha;
+
+	// So is the window converted by widened ROI conversions
+	roi = ((struct PixFcPrivate *) conv->private_data)->roi;
+	if (roi)
+		roi->window.alpha = alpha;
+
+	return PixFc_OK;
+}
+
 void			destroy_pixfc(struct PixFcSSE* conv) {
-	if (conv)
+	if (conv) {
+		if (conv->private_data) {
+			release_mt_data(((struct PixFcPrivate *) conv->private_data)->mt);
+			release_roi_data(((struct PixFcPrivate *) conv->private_data)->roi);
+			free(conv->private_data);
+		}
 		free(conv);
+	}
 }
-
@@ -37,7 +37,7 @@
 const PixelFormatDescription		pixfmt_descriptions[] = {
 	{
 		    PixFcYUYV,
-		    2, 1, 0, /*16*/8, 1, 1,
+		    2, 1, 0, /*16*/8, 1, 1, 2,
 		    {
 				// 2 red pix - 2 green pix - 2 blue pix - 2 white pix
 		    	//_E(0x15942B95FF4B544CLL, 0x80FE80FF6B1CFF1DLL) ,
@@ -68,7 +68,7 @@ const PixelFormatDescription		pixfmt_descriptions[] = {
 
 	{
 		    PixFcUYVY,
-		    2, 1, 0, /*16*/8, 1, 1,
+		    2, 1, 0, /*16*/8, 1, 1, 2,
 		    {
 				// 2 red pix - 2 green pix - 2 blue pix - 2 white pix
 				//_E(0x9415952B4BFF4C54LL, 0xFE80FF801C6B1DFFLL),
@@ -98,7 +98,7 @@ const PixelFormatDescription		pixfmt_descriptions[] = {
 
 	{
 			PixFcYUV422P,
-			2, 1, 1, 32, 1, 1,
+			2, 1, 1, 32, 1, 1, 2,
 			{
 				/* 2 red pix - 2 green pix - 2 blue pix - 2 white pix
 						Decimal values:
@@ -128,7 +128,7 @@ const PixelFormatDescription		pixfmt_descriptions[] = {
 
 	{
 			PixFcYUV420P,
-			3, 2, 1, 32, 2, 1,
+			3, 2, 1, 32, 2, 1, 2,
 			{
 				/* 2 red pix - 2 green pix - 2 blue pix - 2 white pix
 						Decimal values:
@@ -159,9 +159,76 @@ const PixelFormatDescription		pixfmt_descriptions[] = {
 			"YUV420p",
 	},
 
+	{
+			PixFcNV12,
+			3, 2, 1, 32, 2, 1, 2,
+			{
+				/* Same pixels as YUV420P, with U and V interleaved */
+
+				_E(0xFEFF1C1D94954B4CLL, 0x00ADC81D0095FF4CLL), //Y
+				_E(0xFEFF1C1D94954B4CLL, 0x00ADC81D0095FF4CLL),
+				_E(0xFEFF1C1D94954B4CLL, 0x00ADC81D0095FF4CLL), //Y
+				_E(0xFEFF1C1D94954B4CLL, 0x00ADC81D0095FF4CLL),
+				_E(0x80806BFF152BFF54LL, 0xBA1E6BFF1529FF54LL), // UV
+			},
+			5,
+			"NV12",
+	},
+
+	{
+			PixFcNV21,
+			3, 2, 1, 32, 2, 1, 2,
+			{
+				/* Same pixels as YUV420P, with V and U interleaved */
+
+				_E(0xFEFF1C1D94954B4CLL, 0x00ADC81D0095FF4CLL), //Y
+				_E(0xFEFF1C1D94954B4CLL, 0x00ADC81D0095FF4CLL),
+				_E(0xFEFF1C1D94954B4CLL, 0x00ADC81D0095FF4CLL), //Y
+				_E(0xFEFF1C1D94954B4CLL, 0x00ADC81D0095FF4CLL),
+				_E(0x8080FF6B2B1554FFLL, 0x1EBAFF6B291554FFLL), // VU
+			},
+			5,
+			"NV21",
+	},
+
+	{
+			PixFcP010,
+			3, 1, 1, 16, 2, 1, 2,
+			{
+				/* 10-bit values left shifted by 6
+						Decimal values:
+						Y		Y		Y		Y
+						304		304		596		596
+						116		116		1020	1020
+
+						U		V		U		V
+						336		1020	172		84
+						1020	428		512		512
+				*/
+
+				_E(0x950095004C004C00LL, 0xFF00FF001D001D00LL), //Y
+				_E(0x15002B00FF005400LL, 0x800080006B00FF00LL), // UV
+			},
+			2,
+			"P010",
+	},
+
+	{
+			PixFcP210,
+			4, 1, 1, 16, 1, 1, 2,
+			{
+				/* Same pixels as P010 */
+
+				_E(0x950095004C004C00LL, 0xFF00FF001D001D00LL), //Y
+				_E(0x15002B00FF005400LL, 0x800080006B00FF00LL), // UV
+			},
+			2,
+			"P210",
+	},
+
 	{
 		PixFcV210,
-		16, 6, 0, /*16*/8, 1, 48,
+		16, 6, 0, /*16*/8, 1, 48, 6,
 		{
 			/* 2 red pix - 2 green pix - 2 blue pix - 2 white pix
 			 Decimal values:
@@ -202,7 +269,7 @@ const PixelFormatDescription		pixfmt_descriptions[] = {
 	
 	{
 		    PixFcARGB,
-		    4, 1, 0, 8, 1, 1,
+		    4, 1, 0, 8, 1, 1, 1,
 		    {
 		    	// 2 red pix - 2 green pix - 2 blue pix - 2 white pix
 				_E(0x0000FF000000FF00LL, 0x00FF000000FF0000LL),
@@ -225,7 +292,7 @@ const PixelFormatDescription		pixfmt_descriptions[] = {
 
 	{
 		    PixFcBGRA,
-		    4, 1, 0, 8, 1, 1,
+		    4, 1, 0, 8, 1, 1, 1,
 		    {
 				// 2 red pix - 2 green pix - 2 blue pix - 2 white pix
 				_E(0x00FF000000FF0000LL, 0x0000FF000000FF00LL),
@@ -237,7 +304,7 @@ const PixelFormatDescription		pixfmt_descriptions[] = {
 
 	{
 		    PixFcRGB24,
-		    3, 1, 0, 16, 1, 1,
+		    3, 1, 0, 16, 1, 1, 1,
 		    {
 				// 2 groups of: 2 red pix - 2 green pix - 2 blue pix - 2 white pix
 				_E(0xFF000000FF0000FFLL, 0x00FF000000FF0000LL),
@@ -250,7 +317,7 @@ const PixelFormatDescription		pixfmt_descriptions[] = {
 
 	{
 		    PixFcBGR24,
-		    3, 1, 0, 16, 1, 1,
+		    3, 1, 0, 16, 1, 1, 1,
 		    {
 				// 2 groups of: 2 red pix - 2 green pix - 2 blue pix - 2 white pix
 				_E(0xFF00FF0000FF0000LL, 0xFF0000FF00FF0000LL),
@@ -263,7 +330,7 @@ const PixelFormatDescription		pixfmt_descriptions[] = {
 
 	{
 			PixFcR210,
-			4, 1, 0, 1, 1, 64,
+			4, 1, 0, 1, 1, 64, 1,
 			{
 				// FIXME: I am a copy/paste of BGR24 pixels, not true r210 values
 				// 2 groups of: 2 red pix - 2 green pix - 2 blue pix - 2 white pix
@@ -277,7 +344,7 @@ const PixelFormatDescription		pixfmt_descriptions[] = {
 	
 	{
 		PixFcR10k,
-		4, 1, 0, 1, 1, 64,
+		4, 1, 0, 1, 1, 64, 1,
 		{
 			// FIXME: I am a copy/paste of BGR24 pixels, not true r10k values
 			// 2 groups of: 2 red pix - 2 green pix - 2 blue pix - 2 white pix
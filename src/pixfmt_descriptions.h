@@ -59,6 +59,11 @@ typedef struct {
 		// the size in bytes of each line:
 		// (width + (row_pixel_multiple - 1) ) / row_pixel_multiple) * bytes_per_pix_num / bytes_per_pix_den
 		uint8_t					row_pixel_multiple;
+
+		// Number of consecutive pixels sharing bytes in a line (2 for
+		// 4:2:2 and 4:2:0 formats, whose pixels share chroma samples,
+		// 6 for v210). A line can only be split on a multiple of this value.
+		uint8_t					pixel_group_width;
 		
 		/*
 		 * An array of 16-byte vectors containing the fill pattern.
@@ -110,6 +115,12 @@ extern const uint32_t					pixfmt_descriptions_count;
 #define PADDING_BYTE_COUNT(fmt, width) \
 		(ROW_SIZE((fmt), (width)) - (width) * pixfmt_descriptions[(fmt)].bytes_per_pix_num / pixfmt_descriptions[(fmt)].bytes_per_pix_denom)
 
+/*
+ * Same as above for a line 'row_bytes' long, which may be larger than ROW_SIZE().
+ */
+#define ROW_PADDING_BYTE_COUNT(fmt, width, row_bytes) \
+		((row_bytes) - (width) * pixfmt_descriptions[(fmt)].bytes_per_pix_num / pixfmt_descriptions[(fmt)].bytes_per_pix_denom)
+
 /*
  * This macro expands to the size in bytes of an image of the given width and 
  * height in the given pixel format (of type PixFcPixelFormat).
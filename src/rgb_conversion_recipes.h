@@ -25,7 +25,8 @@
 
 #ifndef DEBUG
 /*
- * Include the unpack & pack routines twice to generate both aligned & unaligned versions
+ * Include the unpack & pack routines twice to generate both aligned & unaligned versions,
+ * and the pack routines a third time to generate non-temporal versions
  */
 #undef  GENERATE_UNALIGNED_INLINES
 #define GENERATE_UNALIGNED_INLINES 0
@@ -39,6 +40,13 @@
 #include "rgb_unpack.h"
 #include "yuv_pack.h"
 
+#undef  GENERATE_UNALIGNED_INLINES
+#define GENERATE_UNALIGNED_INLINES 0
+#define GENERATE_NON_TEMPORAL_INLINES 1
+#include "rgb_pack.h"
+#include "yuv_pack.h"
+#undef  GENERATE_NON_TEMPORAL_INLINES
+
 #include "rgb_downsample.h"
 #include "rgb_to_yuv_convert.h"
 #endif
@@ -100,8 +108,8 @@
 	__m128i		*yuv_out;\
 	uint8_t		*next_src = (uint8_t *) source_buffer;\
 	uint8_t		*next_dst = (uint8_t *) dest_buffer;\
-	uint32_t	src_row_byte_count = ROW_SIZE(pixfc->source_fmt, pixfc->width);\
-	uint32_t	dst_row_byte_count = ROW_SIZE(pixfc->dest_fmt, pixfc->width);\
+	uint32_t	src_row_byte_count = pixfc->source_row_bytes;\
+	uint32_t	dst_row_byte_count = pixfc->dest_row_bytes;\
 	__m128i		unpack_out[3];\
 	__m128i		convert_out[4];\
 	while(line-- > 0) {\
@@ -110,6 +118,7 @@
 		rgb_in = (__m128i *) next_src;\
 		yuv_out = (__m128i *) next_dst;\
 		\
+		PREFETCH_LINE_AHEAD(next_src, src_row_byte_count);\
 		next_src += src_row_byte_count;\
 		next_dst += dst_row_byte_count;\
 		\
@@ -131,7 +140,7 @@
 	__m128i		*rgb_in;\
 	__m128i		*y_out, *u_out, *v_out;\
 	uint32_t	line = pixfc->height;\
-	uint32_t	src_row_byte_count = ROW_SIZE(pixfc->source_fmt, width);\
+	uint32_t	src_row_byte_count = pixfc->source_row_bytes;\
 	uint32_t	y_row_byte_count = width;\
 	uint32_t	uv_row_byte_count = y_row_byte_count / 2;\
 	uint8_t		*next_src = (uint8_t *) source_buffer;\
@@ -148,6 +157,7 @@
 		u_out = (__m128i *) next_u_dst;\
 		v_out = (__m128i *) next_v_dst;\
 		\
+		PREFETCH_LINE_AHEAD(next_src, src_row_byte_count);\
 		next_src += src_row_byte_count;\
 		next_y_dst += y_row_byte_count;\
 		next_u_dst += uv_row_byte_count;\
@@ -182,8 +192,8 @@
 	__m128i*	yuv_out = (__m128i *) dest_buffer;\
 	uint8_t		*next_src = (uint8_t *) source_buffer;\
 	uint8_t		*next_dst = (uint8_t *) dest_buffer;\
-	uint32_t	src_row_byte_count = ROW_SIZE(pixfc->source_fmt, width);\
-	uint32_t	dst_row_byte_count = ROW_SIZE(pixfc->dest_fmt, width);\
+	uint32_t	src_row_byte_count = pixfc->source_row_bytes;\
+	uint32_t	dst_row_byte_count = pixfc->dest_row_bytes;\
 	__m128i		unpack_out[4];\
 	__m128i		convert_out[4];\
 	while(line-- > 0) {\
@@ -192,6 +202,7 @@
 		rgb_in = (__m128i *) next_src;\
 		yuv_out = (__m128i *) next_dst;\
 		\
+		PREFETCH_LINE_AHEAD(next_src, src_row_byte_count);\
 		next_src += src_row_byte_count;\
 		next_dst += dst_row_byte_count;\
 		\
@@ -213,7 +224,7 @@
 	__m128i		* y_out, * u_out, * v_out;\
 	uint32_t	line = pixfc->height;\
 	uint32_t	width = pixfc->width;\
-	uint32_t	src_row_byte_count = ROW_SIZE(pixfc->source_fmt, width);\
+	uint32_t	src_row_byte_count = pixfc->source_row_bytes;\
 	uint32_t	y_row_byte_count = width; /* ROW_SIZE doesnt work for planar formats */\
 	uint32_t	uv_row_byte_count = y_row_byte_count / 2;\
 	uint8_t		*next_src = (uint8_t *) source_buffer;\
@@ -230,6 +241,7 @@
 		u_out = (__m128i *) next_u_dst;\
 		v_out = (__m128i *) next_v_dst;\
 		\
+		PREFETCH_LINE_AHEAD(next_src, src_row_byte_count);\
 		next_src += src_row_byte_count;\
 		next_y_dst += y_row_byte_count;\
 		next_u_dst += uv_row_byte_count;\
@@ -290,8 +302,8 @@
 	__m128i		*yuv_out;\
 	uint8_t		*next_src = (uint8_t *) source_buffer;\
 	uint8_t		*next_dst = (uint8_t *) dest_buffer;\
-	uint32_t	src_row_byte_count = ROW_SIZE(pixfc->source_fmt, width);\
-	uint32_t	dst_row_byte_count = ROW_SIZE(pixfc->dest_fmt, width);\
+	uint32_t	src_row_byte_count = pixfc->source_row_bytes;\
+	uint32_t	dst_row_byte_count = pixfc->dest_row_bytes;\
 	__m128i		previous[3];\
 	__m128i		unpack_out[3];\
 	__m128i		convert_out[4];\
@@ -301,6 +313,7 @@
 		rgb_in = (__m128i *) next_src;\
 		yuv_out = (__m128i *) next_dst;\
 		\
+		PREFETCH_LINE_AHEAD(next_src, src_row_byte_count);\
 		next_src += src_row_byte_count;\
 		next_dst += dst_row_byte_count;\
 		\
@@ -331,7 +344,7 @@
 	uint32_t	line = pixfc->height;\
 	uint32_t	width = pixfc->width;\
 	uint32_t	pixel;\
-	uint32_t	src_row_byte_count = ROW_SIZE(pixfc->source_fmt, width);\
+	uint32_t	src_row_byte_count = pixfc->source_row_bytes;\
 	uint32_t	y_row_byte_count = width;\
 	uint32_t	uv_row_byte_count = y_row_byte_count / 2;\
 	uint8_t		*next_src = (uint8_t *) source_buffer;\
@@ -349,6 +362,7 @@
 		u_out = (__m128i *) next_u_dst;\
 		v_out = (__m128i *) next_v_dst;\
 		\
+		PREFETCH_LINE_AHEAD(next_src, src_row_byte_count);\
 		next_src += src_row_byte_count;\
 		next_y_dst += y_row_byte_count;\
 		next_u_dst += uv_row_byte_count;\
@@ -431,8 +445,8 @@
 	__m128i*	yuv_out = (__m128i *) dest_buffer;\
 	uint8_t		*next_src = (uint8_t *) source_buffer;\
 	uint8_t		*next_dst = (uint8_t *) dest_buffer;\
-	uint32_t	src_row_byte_count = ROW_SIZE(pixfc->source_fmt, pixfc->width);\
-	uint32_t	dst_row_byte_count = ROW_SIZE(pixfc->dest_fmt, pixfc->width);\
+	uint32_t	src_row_byte_count = pixfc->source_row_bytes;\
+	uint32_t	dst_row_byte_count = pixfc->dest_row_bytes;\
 	uint32_t	pixel;\
 	uint32_t	line = pixfc->height;\
 	uint32_t	width = pixfc->width;\
@@ -446,6 +460,7 @@
 		rgb_in = (__m128i *) next_src;\
 		yuv_out = (__m128i *) next_dst;\
 		\
+		PREFETCH_LINE_AHEAD(next_src, src_row_byte_count);\
 		next_src += src_row_byte_count;\
 		next_dst += dst_row_byte_count;\
 		\
@@ -476,7 +491,7 @@
 	uint32_t	line = pixfc->height;\
 	uint32_t	width = pixfc->width;\
 	uint32_t	pixel;\
-	uint32_t	src_row_byte_count = ROW_SIZE(pixfc->source_fmt, width);\
+	uint32_t	src_row_byte_count = pixfc->source_row_bytes;\
 	uint32_t	y_row_byte_count = width;\
 	uint32_t	uv_row_byte_count = y_row_byte_count / 2;\
 	uint8_t		*next_src = (uint8_t *) source_buffer;\
@@ -495,6 +510,7 @@
 		u_out = (__m128i *) next_u_dst;\
 		v_out = (__m128i *) next_v_dst;\
 		\
+		PREFETCH_LINE_AHEAD(next_src, src_row_byte_count);\
 		next_src += src_row_byte_count;\
 		next_y_dst += y_row_byte_count;\
 		next_u_dst += uv_row_byte_count;\
@@ -542,6 +558,23 @@
 
 
 
+/*
+ * Chroma output set-up for the 4:2:0 recipes below.
+ * uv_pack_fn writes 2 vectors per call (16 pixels on 2 lines each):
+ * - YUV420P: one to the U plane and one to the V plane,
+ * - NV12 / NV21: two consecutive vectors in the interleaved chroma plane.
+ */
+#define YUV420P_UV_OUTPUT \
+	__m128i*	uplane_out = (__m128i *) ((uint8_t*)dest_buffer + pixfc->pixel_count);\
+	__m128i*	vplane_out = (__m128i *) ((uint8_t*)uplane_out + pixfc->pixel_count / 4);\
+	const uint32_t	uv_out_step = 1;
+
+#define NV12_UV_OUTPUT \
+	__m128i*	uplane_out = (__m128i *) ((uint8_t*)dest_buffer + pixfc->pixel_count);\
+	__m128i*	vplane_out = uplane_out + 1;\
+	const uint32_t	uv_out_step = 2;
+
+
 /*
  * 		R G B 3 2
  *
@@ -661,21 +694,20 @@
 	uv_conv_fn(downsample_out, &convert_out[3]);\
 	print_xmm8u("l12 UV13-16", &convert_out[3]);\
 	uv_pack_fn(convert_out, uplane_out, vplane_out);\
-	uplane_out++;\
-	vplane_out++;
+	uplane_out += uv_out_step;\
+	vplane_out += uv_out_step;
 
 
 
 // NNB planar conversion 1
-#define RGB32_TO_YUV420P_RECIPE(unpack_fn_prefix, y_pack_fn, uv_pack_fn, y_conv_fn, uv_conv_fn, instr_set) \
+#define RGB32_TO_YUV420_RECIPE(uv_output, unpack_fn_prefix, y_pack_fn, uv_pack_fn, y_conv_fn, uv_conv_fn, instr_set) \
 	uint32_t	lines_remaining = pixfc->height;\
 	uint32_t	pixels_remaining_on_line = pixfc->width;\
 	__m128i*	rgb_line1 = (__m128i *) source_buffer;\
-	__m128i*	rgb_line2 = (__m128i *) ((uint8_t*)source_buffer + pixfc->width*4);\
+	__m128i*	rgb_line2 = (__m128i *) ((uint8_t*)source_buffer + pixfc->source_row_bytes);\
 	__m128i*	yplane_line1 = (__m128i *) dest_buffer;\
 	__m128i*	yplane_line2 = (__m128i *) ((uint8_t*)yplane_line1 + pixfc->width);\
-	__m128i*	uplane_out = (__m128i *) ((uint8_t*)yplane_line1 + pixfc->pixel_count);\
-	__m128i*	vplane_out = (__m128i *) ((uint8_t*)uplane_out + pixfc->pixel_count / 4);\
+	uv_output\
 	__m128i		unpack_out[6];\
 	__m128i		downsample_out[3];\
 	/* [0]: l12   	UV 1-4*/\
@@ -686,6 +718,8 @@
 	/* [4]: l2   	Y  1-8*/\
 	__m128i		convert_out[5];\
 	while(lines_remaining > 0){\
+		PREFETCH_LINE_AHEAD(rgb_line1, pixfc->source_row_bytes);\
+		PREFETCH_LINE_AHEAD(rgb_line2, pixfc->source_row_bytes);\
 		while(pixels_remaining_on_line > 0) {\
 			RGB32_TO_YUV420_NNB_CORE_LOOP1(\
 					unpack_fn_prefix##instr_set, y_conv_fn,\
@@ -697,13 +731,18 @@
 		};\
 		/* the inner while loop handles two lines at a time */\
 		lines_remaining -= 2;\
-		rgb_line1 = (__m128i *) ((uint8_t*)rgb_line1 + pixfc->width * 4);\
-		rgb_line2 = (__m128i *) ((uint8_t*)rgb_line2 + pixfc->width * 4);\
+		rgb_line1 = (__m128i *) ((uint8_t*)rgb_line1 + 2 * pixfc->source_row_bytes - pixfc->width * 4);\
+		rgb_line2 = (__m128i *) ((uint8_t*)rgb_line2 + 2 * pixfc->source_row_bytes - pixfc->width * 4);\
 		yplane_line1 = (__m128i *) ((uint8_t*)yplane_line1 + pixfc->width);\
 		yplane_line2 = (__m128i *) ((uint8_t*)yplane_line2 + pixfc->width);\
 		pixels_remaining_on_line = pixfc->width;\
 	};\
 
+#define RGB32_TO_YUV420P_RECIPE(unpack_fn_prefix, y_pack_fn, uv_pack_fn, y_conv_fn, uv_conv_fn, instr_set) \
+	RGB32_TO_YUV420_RECIPE(YUV420P_UV_OUTPUT, unpack_fn_prefix, y_pack_fn, uv_pack_fn, y_conv_fn, uv_conv_fn, instr_set)
+#define RGB32_TO_NV12_RECIPE(unpack_fn_prefix, y_pack_fn, uv_pack_fn, y_conv_fn, uv_conv_fn, instr_set) \
+	RGB32_TO_YUV420_RECIPE(NV12_UV_OUTPUT, unpack_fn_prefix, y_pack_fn, uv_pack_fn, y_conv_fn, uv_conv_fn, instr_set)
+
 
 // NNB Core conversion loop for RGB32 to YUV420 planar NNB conversion 2
 #define RGB32_TO_YUV420_NNB_CORE_LOOP2(unpack_fn, y_conv_fn, downsample_fn, uv_conv_fn, y_pack_fn, uv_pack_fn) \
@@ -812,19 +851,18 @@
 	uv_conv_fn(downsample_out, &convert_out[3]);\
 	print_xmm8u("l12 UV13-16", &convert_out[3]);\
 	uv_pack_fn(convert_out, uplane_out, vplane_out);\
-	uplane_out++;\
-	vplane_out++;
+	uplane_out += uv_out_step;\
+	vplane_out += uv_out_step;
 
 // NNB planar conversion 2
-#define RGB32_TO_YUV420P_RECIPE2(unpack_fn_prefix, y_pack_fn, uv_pack_fn, y_conv_fn, uv_conv_fn, instr_set) \
+#define RGB32_TO_YUV420_RECIPE2(uv_output, unpack_fn_prefix, y_pack_fn, uv_pack_fn, y_conv_fn, uv_conv_fn, instr_set) \
 	uint32_t	lines_remaining = pixfc->height;\
 	uint32_t	pixels_remaining_on_line = pixfc->width;\
 	__m128i*	rgb_line1 = (__m128i *) source_buffer;\
-	__m128i*	rgb_line2 = (__m128i *) ((uint8_t*)source_buffer + pixfc->width*4);\
+	__m128i*	rgb_line2 = (__m128i *) ((uint8_t*)source_buffer + pixfc->source_row_bytes);\
 	__m128i*	yplane_line1 = (__m128i *) dest_buffer;\
 	__m128i*	yplane_line2 = (__m128i *) ((uint8_t*)yplane_line1 + pixfc->width);\
-	__m128i*	uplane_out = (__m128i *) ((uint8_t*)yplane_line1 + pixfc->pixel_count);\
-	__m128i*	vplane_out = (__m128i *) ((uint8_t*)uplane_out + pixfc->pixel_count / 4);\
+	uv_output\
 	__m128i		unpack_out[8];\
 	__m128i		downsample_out[2];\
 	/* [0]: l12   	UV 1-4*/\
@@ -835,6 +873,8 @@
 	/* [4]: l2   	Y  1-8*/\
 	__m128i		convert_out[5];\
 	while(lines_remaining > 0){\
+		PREFETCH_LINE_AHEAD(rgb_line1, pixfc->source_row_bytes);\
+		PREFETCH_LINE_AHEAD(rgb_line2, pixfc->source_row_bytes);\
 		while(pixels_remaining_on_line > 0) {\
 			RGB32_TO_YUV420_NNB_CORE_LOOP2(\
 					unpack_fn_prefix##instr_set, y_conv_fn,\
@@ -846,13 +886,143 @@
 		};\
 		/* the inner while loop handles two lines at a time */\
 		lines_remaining -= 2;\
-		rgb_line1 = (__m128i *) ((uint8_t*)rgb_line1 + pixfc->width * 4);\
-		rgb_line2 = (__m128i *) ((uint8_t*)rgb_line2 + pixfc->width * 4);\
+		rgb_line1 = (__m128i *) ((uint8_t*)rgb_line1 + 2 * pixfc->source_row_bytes - pixfc->width * 4);\
+		rgb_line2 = (__m128i *) ((uint8_t*)rgb_line2 + 2 * pixfc->source_row_bytes - pixfc->width * 4);\
 		yplane_line1 = (__m128i *) ((uint8_t*)yplane_line1 + pixfc->width);\
 		yplane_line2 = (__m128i *) ((uint8_t*)yplane_line2 + pixfc->width);\
 		pixels_remaining_on_line = pixfc->width;\
 	};\
 
+#define RGB32_TO_YUV420P_RECIPE2(unpack_fn_prefix, y_pack_fn, uv_pack_fn, y_conv_fn, uv_conv_fn, instr_set) \
+	RGB32_TO_YUV420_RECIPE2(YUV420P_UV_OUTPUT, unpack_fn_prefix, y_pack_fn, uv_pack_fn, y_conv_fn, uv_conv_fn, instr_set)
+#define RGB32_TO_NV12_RECIPE2(unpack_fn_prefix, y_pack_fn, uv_pack_fn, y_conv_fn, uv_conv_fn, instr_set) \
+	RGB32_TO_YUV420_RECIPE2(NV12_UV_OUTPUT, unpack_fn_prefix, y_pack_fn, uv_pack_fn, y_conv_fn, uv_conv_fn, instr_set)
+
+
+
+// Average R, G & B vectors from 2 lines
+#define AVG_2_LINES_R_G_B_VECTORS(line1, line2, out) \
+	(out)[0] = _mm_avg_epu16((line1)[0], (line2)[0]);\
+	(out)[1] = _mm_avg_epu16((line1)[1], (line2)[1]);\
+	(out)[2] = _mm_avg_epu16((line1)[2], (line2)[2]);
+
+
+// AVG Core conversion loop for RGB32 to YUV420 planar conversion.
+// The two lines are averaged vertically first, and the resulting chroma line
+// is downsampled with the 3-tap 422 filter. downsample1_fn is used for pixels
+// 1-8, downsample2_fn for the others.
+#define RGB32_TO_YUV420_AVG_CORE_LOOP(unpack_fn, y_conv_fn, downsample1_fn, downsample2_fn, uv_conv_fn, y_pack_fn, uv_pack_fn) \
+	unpack_fn(rgb_line1, unpack_out);\
+	rgb_line1 += 2;\
+	y_conv_fn(unpack_out, &convert_out[3]);\
+	unpack_fn(rgb_line2, &unpack_out[3]);\
+	rgb_line2 += 2;\
+	y_conv_fn(&unpack_out[3], &convert_out[4]);\
+	AVG_2_LINES_R_G_B_VECTORS(unpack_out, &unpack_out[3], downsample_out);\
+	downsample1_fn(downsample_out, previous, downsample_out);\
+	uv_conv_fn(downsample_out, convert_out);\
+	print_xmm8u("l12 UV1-4", convert_out);\
+	/* 												 	*/\
+	/* Next set of 8 pixels (9-16) along the same line 	*/\
+	/* 												 	*/\
+	unpack_fn(rgb_line1, unpack_out);\
+	rgb_line1 += 2;\
+	y_conv_fn(unpack_out, downsample_out);\
+	y_pack_fn(&convert_out[3], downsample_out, yplane_line1);\
+	yplane_line1++;\
+	unpack_fn(rgb_line2, &unpack_out[3]);\
+	rgb_line2 += 2;\
+	y_conv_fn(&unpack_out[3], &downsample_out[1]);\
+	y_pack_fn(&convert_out[4], &downsample_out[1], yplane_line2);\
+	yplane_line2++;\
+	AVG_2_LINES_R_G_B_VECTORS(unpack_out, &unpack_out[3], downsample_out);\
+	downsample2_fn(downsample_out, previous, downsample_out);\
+	uv_conv_fn(downsample_out, &convert_out[1]);\
+	print_xmm8u("l12 UV5-8", &convert_out[1]);\
+	/* 												 	*/\
+	/* Next set of 8 pixels (17-24) along the same line */\
+	/* 												 	*/\
+	unpack_fn(rgb_line1, unpack_out);\
+	rgb_line1 += 2;\
+	y_conv_fn(unpack_out, &convert_out[3]);\
+	unpack_fn(rgb_line2, &unpack_out[3]);\
+	rgb_line2 += 2;\
+	y_conv_fn(&unpack_out[3], &convert_out[4]);\
+	AVG_2_LINES_R_G_B_VECTORS(unpack_out, &unpack_out[3], downsample_out);\
+	downsample2_fn(downsample_out, previous, downsample_out);\
+	uv_conv_fn(downsample_out, &convert_out[2]);\
+	print_xmm8u("l12 UV9-12", &convert_out[2]);\
+	/* 											 		*/\
+	/* Next set of 8 pixels (25-32) along the same line */\
+	/* 											 		*/\
+	unpack_fn(rgb_line1, unpack_out);\
+	rgb_line1 += 2;\
+	y_conv_fn(unpack_out, downsample_out);\
+	y_pack_fn(&convert_out[3], downsample_out, yplane_line1);\
+	yplane_line1++;\
+	unpack_fn(rgb_line2, &unpack_out[3]);\
+	rgb_line2 += 2;\
+	y_conv_fn(&unpack_out[3], &downsample_out[1]);\
+	y_pack_fn(&convert_out[4], &downsample_out[1], yplane_line2);\
+	yplane_line2++;\
+	AVG_2_LINES_R_G_B_VECTORS(unpack_out, &unpack_out[3], downsample_out);\
+	downsample2_fn(downsample_out, previous, downsample_out);\
+	uv_conv_fn(downsample_out, &convert_out[3]);\
+	print_xmm8u("l12 UV13-16", &convert_out[3]);\
+	uv_pack_fn(convert_out, uplane_out, vplane_out);\
+	uplane_out += uv_out_step;\
+	vplane_out += uv_out_step;
+
+
+// Average planar conversion
+#define AVG_DOWNSAMPLE_RGB32_TO_YUV420_RECIPE(uv_output, unpack_fn_prefix, y_pack_fn, uv_pack_fn, y_conv_fn, uv_conv_fn, instr_set) \
+	uint32_t	lines_remaining = pixfc->height;\
+	uint32_t	pixels_remaining_on_line;\
+	__m128i*	rgb_line1 = (__m128i *) source_buffer;\
+	__m128i*	rgb_line2 = (__m128i *) ((uint8_t*)source_buffer + pixfc->source_row_bytes);\
+	__m128i*	yplane_line1 = (__m128i *) dest_buffer;\
+	__m128i*	yplane_line2 = (__m128i *) ((uint8_t*)yplane_line1 + pixfc->width);\
+	uv_output\
+	__m128i		unpack_out[6];\
+	__m128i		downsample_out[3];\
+	__m128i		previous[3];\
+	/* [0]: l12   	UV 1-4*/\
+	/* [1]: l12   	UV 5-8*/\
+	/* [2]: l12   	UV 9-12*/\
+	/* [3]: l12   	UV 13-16*/\
+	/*  OR  l1		Y  1-8*/\
+	/* [4]: l2   	Y  1-8*/\
+	__m128i		convert_out[5];\
+	while(lines_remaining > 0){\
+		PREFETCH_LINE_AHEAD(rgb_line1, pixfc->source_row_bytes);\
+		PREFETCH_LINE_AHEAD(rgb_line2, pixfc->source_row_bytes);\
+		RGB32_TO_YUV420_AVG_CORE_LOOP(\
+				unpack_fn_prefix##instr_set, y_conv_fn,\
+				avg_422_downsample_first_r_g_b_vectors_n_save_previous_##instr_set,\
+				avg_422_downsample_r_g_b_vectors_n_save_previous_##instr_set,\
+				uv_conv_fn, y_pack_fn, uv_pack_fn);\
+		pixels_remaining_on_line = pixfc->width - 32;\
+		while(pixels_remaining_on_line > 0) {\
+			RGB32_TO_YUV420_AVG_CORE_LOOP(\
+					unpack_fn_prefix##instr_set, y_conv_fn,\
+					avg_422_downsample_r_g_b_vectors_n_save_previous_##instr_set,\
+					avg_422_downsample_r_g_b_vectors_n_save_previous_##instr_set,\
+					uv_conv_fn, y_pack_fn, uv_pack_fn);\
+			pixels_remaining_on_line -= 32;\
+		};\
+		/* the inner while loop handles two lines at a time */\
+		lines_remaining -= 2;\
+		rgb_line1 = (__m128i *) ((uint8_t*)rgb_line1 + 2 * pixfc->source_row_bytes - pixfc->width * 4);\
+		rgb_line2 = (__m128i *) ((uint8_t*)rgb_line2 + 2 * pixfc->source_row_bytes - pixfc->width * 4);\
+		yplane_line1 = (__m128i *) ((uint8_t*)yplane_line1 + pixfc->width);\
+		yplane_line2 = (__m128i *) ((uint8_t*)yplane_line2 + pixfc->width);\
+	};\
+
+#define AVG_DOWNSAMPLE_RGB32_TO_YUV420P_RECIPE(unpack_fn_prefix, y_pack_fn, uv_pack_fn, y_conv_fn, uv_conv_fn, instr_set) \
+	AVG_DOWNSAMPLE_RGB32_TO_YUV420_RECIPE(YUV420P_UV_OUTPUT, unpack_fn_prefix, y_pack_fn, uv_pack_fn, y_conv_fn, uv_conv_fn, instr_set)
+#define AVG_DOWNSAMPLE_RGB32_TO_NV12_RECIPE(unpack_fn_prefix, y_pack_fn, uv_pack_fn, y_conv_fn, uv_conv_fn, instr_set) \
+	AVG_DOWNSAMPLE_RGB32_TO_YUV420_RECIPE(NV12_UV_OUTPUT, unpack_fn_prefix, y_pack_fn, uv_pack_fn, y_conv_fn, uv_conv_fn, instr_set)
+
 
 
 /*
@@ -868,8 +1038,8 @@
 	uint32_t	line = pixfc->height;\
 	uint8_t		*next_src = (uint8_t *)source_buffer;\
 	uint8_t		*next_dst = (uint8_t *)dest_buffer;\
-	uint32_t	src_row_byte_count = ROW_SIZE(pixfc->source_fmt, width);\
-	uint32_t	dst_row_byte_count = ROW_SIZE(pixfc->dest_fmt, width);\
+	uint32_t	src_row_byte_count = pixfc->source_row_bytes;\
+	uint32_t	dst_row_byte_count = pixfc->dest_row_bytes;\
 	uint32_t	pixel;\
 	__m128i*	rgb_in;\
 	__m128i*	rgb_out;\
@@ -880,6 +1050,7 @@
 		rgb_in = (__m128i *) next_src;\
 		rgb_out = (__m128i *) next_dst;\
 		\
+		PREFETCH_LINE_AHEAD(next_src, src_row_byte_count);\
 		next_src += src_row_byte_count;\
 		next_dst += dst_row_byte_count;\
 		while(pixel > 0) {\
@@ -930,8 +1101,8 @@
 	uint32_t	line = pixfc->height;\
 	uint8_t		*next_src = (uint8_t *)source_buffer;\
 	uint8_t		*next_dst = (uint8_t *)dest_buffer;\
-	uint32_t	src_row_byte_count = ROW_SIZE(pixfc->source_fmt, width);\
-	uint32_t	dst_row_byte_count = ROW_SIZE(pixfc->dest_fmt, width);\
+	uint32_t	src_row_byte_count = pixfc->source_row_bytes;\
+	uint32_t	dst_row_byte_count = pixfc->dest_row_bytes;\
 	__m128i*	rgb_in;\
 	__m128i*	yuv_out;\
 	__m128i		unpack_out[6];\
@@ -942,6 +1113,7 @@
 		rgb_in = (__m128i *) next_src;\
 		yuv_out = (__m128i *) next_dst;\
 		\
+		PREFETCH_LINE_AHEAD(next_src, src_row_byte_count);\
 		next_src += src_row_byte_count;\
 		next_dst += dst_row_byte_count;\
 		\
@@ -961,7 +1133,7 @@
 	uint32_t	line = pixfc->height;\
 	uint32_t	width = pixfc->width;\
 	uint32_t	pixel;\
-	uint32_t	src_row_byte_count = ROW_SIZE(pixfc->source_fmt, width);\
+	uint32_t	src_row_byte_count = pixfc->source_row_bytes;\
 	uint32_t	y_row_byte_count = width;\
 	uint32_t	uv_row_byte_count = y_row_byte_count / 2;\
 	uint8_t		*next_src = (uint8_t *) source_buffer;\
@@ -980,6 +1152,7 @@
 		u_out = (__m128i *) next_u_dst;\
 		v_out = (__m128i *) next_v_dst;\
 		\
+		PREFETCH_LINE_AHEAD(next_src, src_row_byte_count);\
 		next_src += src_row_byte_count;\
 		next_y_dst += y_row_byte_count;\
 		next_u_dst += uv_row_byte_count;\
@@ -1012,8 +1185,8 @@
 	uint32_t	line = pixfc->height;\
 	uint8_t		*next_src = (uint8_t *)source_buffer;\
 	uint8_t		*next_dst = (uint8_t *)dest_buffer;\
-	uint32_t	src_row_byte_count = ROW_SIZE(pixfc->source_fmt, width);\
-	uint32_t	dst_row_byte_count = ROW_SIZE(pixfc->dest_fmt, width);\
+	uint32_t	src_row_byte_count = pixfc->source_row_bytes;\
+	uint32_t	dst_row_byte_count = pixfc->dest_row_bytes;\
 	__m128i*	rgb_in;\
 	__m128i*	yuv_out;\
 	__m128i		unpack_out[8];\
@@ -1024,6 +1197,7 @@
 		rgb_in = (__m128i *) next_src;\
 		yuv_out = (__m128i *) next_dst;\
 		\
+		PREFETCH_LINE_AHEAD(next_src, src_row_byte_count);\
 		next_src += src_row_byte_count;\
 		next_dst += dst_row_byte_count;\
 		\
@@ -1043,7 +1217,7 @@
 	uint32_t	line = pixfc->height;\
 	uint32_t	width = pixfc->width;\
 	uint32_t	pixel;\
-	uint32_t	src_row_byte_count = ROW_SIZE(pixfc->source_fmt, width);\
+	uint32_t	src_row_byte_count = pixfc->source_row_bytes;\
 	uint32_t	y_row_byte_count = width;\
 	uint32_t	uv_row_byte_count = y_row_byte_count / 2;\
 	uint8_t		*next_src = (uint8_t *) source_buffer;\
@@ -1062,6 +1236,7 @@
 		u_out = (__m128i *) next_u_dst;\
 		v_out = (__m128i *) next_v_dst;\
 		\
+		PREFETCH_LINE_AHEAD(next_src, src_row_byte_count);\
 		next_src += src_row_byte_count;\
 		next_y_dst += y_row_byte_count;\
 		next_u_dst += uv_row_byte_count;\
@@ -1108,8 +1283,8 @@
 	uint8_t		*next_dst = (uint8_t *)dest_buffer;\
 	uint32_t	width = pixfc->width;\
 	uint32_t	line = pixfc->height;\
-	uint32_t	src_row_byte_count = ROW_SIZE(pixfc->source_fmt, width);\
-	uint32_t	dst_row_byte_count = ROW_SIZE(pixfc->dest_fmt, width);\
+	uint32_t	src_row_byte_count = pixfc->source_row_bytes;\
+	uint32_t	dst_row_byte_count = pixfc->dest_row_bytes;\
 	uint32_t	pixel;\
 	__m128i*	rgb_in;\
 	__m128i*	yuv_out;\
@@ -1122,6 +1297,7 @@
 		rgb_in = (__m128i *) next_src;\
 		yuv_out = (__m128i *) next_dst;\
 		\
+		PREFETCH_LINE_AHEAD(next_src, src_row_byte_count);\
 		next_src += src_row_byte_count;\
 		next_dst += dst_row_byte_count;\
 		\
@@ -1150,7 +1326,7 @@
 	uint32_t	line = pixfc->height;\
 	uint32_t	width = pixfc->width;\
 	uint32_t	pixel;\
-	uint32_t	src_row_byte_count = ROW_SIZE(pixfc->source_fmt, width);\
+	uint32_t	src_row_byte_count = pixfc->source_row_bytes;\
 	uint32_t	y_row_byte_count = width;\
 	uint32_t	uv_row_byte_count = y_row_byte_count / 2;\
 	uint8_t		*next_src = (uint8_t *) source_buffer;\
@@ -1170,6 +1346,7 @@
 		u_out = (__m128i *) next_u_dst;\
 		v_out = (__m128i *) next_v_dst;\
 		\
+		PREFETCH_LINE_AHEAD(next_src, src_row_byte_count);\
 		next_src += src_row_byte_count;\
 		next_y_dst += y_row_byte_count;\
 		next_u_dst += uv_row_byte_count;\
@@ -1220,8 +1397,8 @@
 	uint8_t		*next_dst = (uint8_t *)dest_buffer;\
 	uint32_t	width = pixfc->width;\
 	uint32_t	line = pixfc->height;\
-	uint32_t	src_row_byte_count = ROW_SIZE(pixfc->source_fmt, width);\
-	uint32_t	dst_row_byte_count = ROW_SIZE(pixfc->dest_fmt, width);\
+	uint32_t	src_row_byte_count = pixfc->source_row_bytes;\
+	uint32_t	dst_row_byte_count = pixfc->dest_row_bytes;\
 	uint32_t	pixel;\
 	__m128i*	rgb_in;\
 	__m128i*	yuv_out;\
@@ -1235,6 +1412,7 @@
 		rgb_in = (__m128i *) next_src;\
 		yuv_out = (__m128i *) next_dst;\
 		\
+		PREFETCH_LINE_AHEAD(next_src, src_row_byte_count);\
 		next_src += src_row_byte_count;\
 		next_dst += dst_row_byte_count;\
 		\
@@ -1263,7 +1441,7 @@
 	uint32_t	line = pixfc->height;\
 	uint32_t	width = pixfc->width;\
 	uint32_t	pixel;\
-	uint32_t	src_row_byte_count = ROW_SIZE(pixfc->source_fmt, width);\
+	uint32_t	src_row_byte_count = pixfc->source_row_bytes;\
 	uint32_t	y_row_byte_count = width;\
 	uint32_t	uv_row_byte_count = y_row_byte_count / 2;\
 	uint8_t		*next_src = (uint8_t *) source_buffer;\
@@ -1284,6 +1462,7 @@
 		u_out = (__m128i *) next_u_dst;\
 		v_out = (__m128i *) next_v_dst;\
 		\
+		PREFETCH_LINE_AHEAD(next_src, src_row_byte_count);\
 		next_src += src_row_byte_count;\
 		next_y_dst += y_row_byte_count;\
 		next_u_dst += uv_row_byte_count;\
@@ -1442,21 +1621,20 @@
 	uv_conv_fn(downsample_out, &convert_out[3]);\
 	print_xmm8u("l12 UV13-16", &convert_out[3]);\
 	uv_pack_fn(convert_out, uplane_out, vplane_out);\
-	uplane_out++;\
-	vplane_out++;
+	uplane_out += uv_out_step;\
+	vplane_out += uv_out_step;
 
 
 
 // NNB planar conversion 1
-#define RGB24_TO_YUV420P_RECIPE(unpack_fn_prefix, y_pack_fn, uv_pack_fn, y_conv_fn, uv_conv_fn, instr_set) \
+#define RGB24_TO_YUV420_RECIPE(uv_output, unpack_fn_prefix, y_pack_fn, uv_pack_fn, y_conv_fn, uv_conv_fn, instr_set) \
 	uint32_t	lines_remaining = pixfc->height;\
 	uint32_t	pixels_remaining_on_line = pixfc->width;\
 	__m128i*	rgb_line1 = (__m128i *) source_buffer;\
-	__m128i*	rgb_line2 = (__m128i *) ((uint8_t*)source_buffer + pixfc->width*3);\
+	__m128i*	rgb_line2 = (__m128i *) ((uint8_t*)source_buffer + pixfc->source_row_bytes);\
 	__m128i*	yplane_line1 = (__m128i *) dest_buffer;\
 	__m128i*	yplane_line2 = (__m128i *) ((uint8_t*)yplane_line1 + pixfc->width);\
-	__m128i*	uplane_out = (__m128i *) ((uint8_t*)yplane_line1 + pixfc->pixel_count);\
-	__m128i*	vplane_out = (__m128i *) ((uint8_t*)uplane_out + pixfc->pixel_count / 4);\
+	uv_output\
 	__m128i		unpack_out[12];\
 	/* [0]: l1	R 1-8		[6]:  l2	R 1-8*/\
 	/* [1]: l1	G 1-8		[7]:  l2	G 1-8*/\
@@ -1473,6 +1651,8 @@
 	/* [4]: l2   	Y  1-8*/\
 	__m128i		convert_out[5];\
 	while(lines_remaining > 0){\
+		PREFETCH_LINE_AHEAD(rgb_line1, pixfc->source_row_bytes);\
+		PREFETCH_LINE_AHEAD(rgb_line2, pixfc->source_row_bytes);\
 		while(pixels_remaining_on_line > 0) {\
 			RGB24_TO_YUV420_NNB_CORE_LOOP1(\
 					unpack_fn_prefix##instr_set, y_conv_fn,\
@@ -1484,13 +1664,18 @@
 		};\
 		/* the inner while loop handles two lines at a time */\
 		lines_remaining -= 2;\
-		rgb_line1 = (__m128i *) ((uint8_t*)rgb_line1 + pixfc->width * 3);\
-		rgb_line2 = (__m128i *) ((uint8_t*)rgb_line2 + pixfc->width * 3);\
+		rgb_line1 = (__m128i *) ((uint8_t*)rgb_line1 + 2 * pixfc->source_row_bytes - pixfc->width * 3);\
+		rgb_line2 = (__m128i *) ((uint8_t*)rgb_line2 + 2 * pixfc->source_row_bytes - pixfc->width * 3);\
 		yplane_line1 = (__m128i *) ((uint8_t*)yplane_line1 + pixfc->width);\
 		yplane_line2 = (__m128i *) ((uint8_t*)yplane_line2 + pixfc->width);\
 		pixels_remaining_on_line = pixfc->width;\
 	};\
 
+#define RGB24_TO_YUV420P_RECIPE(unpack_fn_prefix, y_pack_fn, uv_pack_fn, y_conv_fn, uv_conv_fn, instr_set) \
+	RGB24_TO_YUV420_RECIPE(YUV420P_UV_OUTPUT, unpack_fn_prefix, y_pack_fn, uv_pack_fn, y_conv_fn, uv_conv_fn, instr_set)
+#define RGB24_TO_NV12_RECIPE(unpack_fn_prefix, y_pack_fn, uv_pack_fn, y_conv_fn, uv_conv_fn, instr_set) \
+	RGB24_TO_YUV420_RECIPE(NV12_UV_OUTPUT, unpack_fn_prefix, y_pack_fn, uv_pack_fn, y_conv_fn, uv_conv_fn, instr_set)
+
 
 // NNB Core conversion loop for RGB24 to YUV420 planar NNB conversion 2
 #define RGB24_TO_YUV420_NNB_CORE_LOOP2(unpack_fn, y_conv_fn, downsample_fn, uv_conv_fn, y_pack_fn, uv_pack_fn) \
@@ -1591,19 +1776,18 @@
 	uv_conv_fn(downsample_out, &convert_out[3]);\
 	print_xmm8u("l12 UV13-16", &convert_out[3]);\
 	uv_pack_fn(convert_out, uplane_out, vplane_out);\
-	uplane_out++;\
-	vplane_out++;
+	uplane_out += uv_out_step;\
+	vplane_out += uv_out_step;
 
 // NNB planar conversion 2
-#define RGB24_TO_YUV420P_RECIPE2(unpack_fn_prefix, y_pack_fn, uv_pack_fn, y_conv_fn, uv_conv_fn, instr_set) \
+#define RGB24_TO_YUV420_RECIPE2(uv_output, unpack_fn_prefix, y_pack_fn, uv_pack_fn, y_conv_fn, uv_conv_fn, instr_set) \
 	uint32_t	lines_remaining = pixfc->height;\
 	uint32_t	pixels_remaining_on_line = pixfc->width;\
 	__m128i*	rgb_line1 = (__m128i *) source_buffer;\
-	__m128i*	rgb_line2 = (__m128i *) ((uint8_t*)source_buffer + pixfc->width*3);\
+	__m128i*	rgb_line2 = (__m128i *) ((uint8_t*)source_buffer + pixfc->source_row_bytes);\
 	__m128i*	yplane_line1 = (__m128i *) dest_buffer;\
 	__m128i*	yplane_line2 = (__m128i *) ((uint8_t*)yplane_line1 + pixfc->width);\
-	__m128i*	uplane_out = (__m128i *) ((uint8_t*)yplane_line1 + pixfc->pixel_count);\
-	__m128i*	vplane_out = (__m128i *) ((uint8_t*)uplane_out + pixfc->pixel_count / 4);\
+	uv_output\
 	__m128i		unpack_out[16];\
 	__m128i		downsample_out[2];\
 	/* [0]: l12   	UV 1-4*/\
@@ -1614,6 +1798,8 @@
 	/* [4]: l2   	Y  1-8*/\
 	__m128i		convert_out[5];\
 	while(lines_remaining > 0){\
+		PREFETCH_LINE_AHEAD(rgb_line1, pixfc->source_row_bytes);\
+		PREFETCH_LINE_AHEAD(rgb_line2, pixfc->source_row_bytes);\
 		while(pixels_remaining_on_line > 0) {\
 			RGB24_TO_YUV420_NNB_CORE_LOOP2(\
 					unpack_fn_prefix##instr_set, y_conv_fn,\
@@ -1625,13 +1811,133 @@
 		};\
 		/* the inner while loop handles two lines at a time */\
 		lines_remaining -= 2;\
-		rgb_line1 = (__m128i *) ((uint8_t*)rgb_line1 + pixfc->width * 3);\
-		rgb_line2 = (__m128i *) ((uint8_t*)rgb_line2 + pixfc->width * 3);\
+		rgb_line1 = (__m128i *) ((uint8_t*)rgb_line1 + 2 * pixfc->source_row_bytes - pixfc->width * 3);\
+		rgb_line2 = (__m128i *) ((uint8_t*)rgb_line2 + 2 * pixfc->source_row_bytes - pixfc->width * 3);\
 		yplane_line1 = (__m128i *) ((uint8_t*)yplane_line1 + pixfc->width);\
 		yplane_line2 = (__m128i *) ((uint8_t*)yplane_line2 + pixfc->width);\
 		pixels_remaining_on_line = pixfc->width;\
 	};\
 
+#define RGB24_TO_YUV420P_RECIPE2(unpack_fn_prefix, y_pack_fn, uv_pack_fn, y_conv_fn, uv_conv_fn, instr_set) \
+	RGB24_TO_YUV420_RECIPE2(YUV420P_UV_OUTPUT, unpack_fn_prefix, y_pack_fn, uv_pack_fn, y_conv_fn, uv_conv_fn, instr_set)
+#define RGB24_TO_NV12_RECIPE2(unpack_fn_prefix, y_pack_fn, uv_pack_fn, y_conv_fn, uv_conv_fn, instr_set) \
+	RGB24_TO_YUV420_RECIPE2(NV12_UV_OUTPUT, unpack_fn_prefix, y_pack_fn, uv_pack_fn, y_conv_fn, uv_conv_fn, instr_set)
+
+
+
+// AVG Core conversion loop for RGB24 to YUV420 planar conversion.
+// Same as RGB32_TO_YUV420_AVG_CORE_LOOP, except that each call to unpack_fn
+// returns 16 pixels.
+#define RGB24_TO_YUV420_AVG_CORE_LOOP(unpack_fn, y_conv_fn, downsample1_fn, downsample2_fn, uv_conv_fn, y_pack_fn, uv_pack_fn) \
+	unpack_fn(rgb_line1, unpack_out);\
+	rgb_line1 += 3;\
+	y_conv_fn(unpack_out, &convert_out[3]);\
+	unpack_fn(rgb_line2, &unpack_out[6]);\
+	rgb_line2 += 3;\
+	y_conv_fn(&unpack_out[6], &convert_out[4]);\
+	AVG_2_LINES_R_G_B_VECTORS(unpack_out, &unpack_out[6], downsample_out);\
+	downsample1_fn(downsample_out, previous, downsample_out);\
+	uv_conv_fn(downsample_out, convert_out);\
+	print_xmm8u("l12 UV1-4", convert_out);\
+	/* 												 	*/\
+	/* Next set of 8 pixels (9-16) along the same line 	*/\
+	/* 												 	*/\
+	y_conv_fn(&unpack_out[3], downsample_out);\
+	y_pack_fn(&convert_out[3], downsample_out, yplane_line1);\
+	yplane_line1++;\
+	y_conv_fn(&unpack_out[9], &downsample_out[1]);\
+	y_pack_fn(&convert_out[4], &downsample_out[1], yplane_line2);\
+	yplane_line2++;\
+	AVG_2_LINES_R_G_B_VECTORS(&unpack_out[3], &unpack_out[9], downsample_out);\
+	downsample2_fn(downsample_out, previous, downsample_out);\
+	uv_conv_fn(downsample_out, &convert_out[1]);\
+	print_xmm8u("l12 UV5-8", &convert_out[1]);\
+	/* 												 	*/\
+	/* Next set of 8 pixels (17-24) along the same line */\
+	/* 												 	*/\
+	unpack_fn(rgb_line1, unpack_out);\
+	rgb_line1 += 3;\
+	y_conv_fn(unpack_out, &convert_out[3]);\
+	unpack_fn(rgb_line2, &unpack_out[6]);\
+	rgb_line2 += 3;\
+	y_conv_fn(&unpack_out[6], &convert_out[4]);\
+	AVG_2_LINES_R_G_B_VECTORS(unpack_out, &unpack_out[6], downsample_out);\
+	downsample2_fn(downsample_out, previous, downsample_out);\
+	uv_conv_fn(downsample_out, &convert_out[2]);\
+	print_xmm8u("l12 UV9-12", &convert_out[2]);\
+	/* 											 		*/\
+	/* Next set of 8 pixels (25-32) along the same line */\
+	/* 											 		*/\
+	y_conv_fn(&unpack_out[3], downsample_out);\
+	y_pack_fn(&convert_out[3], downsample_out, yplane_line1);\
+	yplane_line1++;\
+	y_conv_fn(&unpack_out[9], &downsample_out[1]);\
+	y_pack_fn(&convert_out[4], &downsample_out[1], yplane_line2);\
+	yplane_line2++;\
+	AVG_2_LINES_R_G_B_VECTORS(&unpack_out[3], &unpack_out[9], downsample_out);\
+	downsample2_fn(downsample_out, previous, downsample_out);\
+	uv_conv_fn(downsample_out, &convert_out[3]);\
+	print_xmm8u("l12 UV13-16", &convert_out[3]);\
+	uv_pack_fn(convert_out, uplane_out, vplane_out);\
+	uplane_out += uv_out_step;\
+	vplane_out += uv_out_step;
+
+
+// Average planar conversion
+#define AVG_DOWNSAMPLE_RGB24_TO_YUV420_RECIPE(uv_output, unpack_fn_prefix, y_pack_fn, uv_pack_fn, y_conv_fn, uv_conv_fn, instr_set) \
+	uint32_t	lines_remaining = pixfc->height;\
+	uint32_t	pixels_remaining_on_line;\
+	__m128i*	rgb_line1 = (__m128i *) source_buffer;\
+	__m128i*	rgb_line2 = (__m128i *) ((uint8_t*)source_buffer + pixfc->source_row_bytes);\
+	__m128i*	yplane_line1 = (__m128i *) dest_buffer;\
+	__m128i*	yplane_line2 = (__m128i *) ((uint8_t*)yplane_line1 + pixfc->width);\
+	uv_output\
+	__m128i		unpack_out[12];\
+	/* [0]: l1	R 1-8		[6]:  l2	R 1-8*/\
+	/* [1]: l1	G 1-8		[7]:  l2	G 1-8*/\
+	/* [2]: l1	B 1-8		[8]:  l2	B 1-8*/\
+	/* [3]: l1	R 9-16		[9]:  l2	R 9-16*/\
+	/* [4]: l1	G 9-16		[10]: l2	G 9-16*/\
+	/* [5]: l1	B 9-16		[11]: l2	B 9-16*/\
+	__m128i		downsample_out[3];\
+	__m128i		previous[3];\
+	/* [0]: l12   	UV 1-4*/\
+	/* [1]: l12   	UV 5-8*/\
+	/* [2]: l12   	UV 9-12*/\
+	/* [3]: l12   	UV 13-16*/\
+	/*  OR  l1		Y  1-8*/\
+	/* [4]: l2   	Y  1-8*/\
+	__m128i		convert_out[5];\
+	while(lines_remaining > 0){\
+		PREFETCH_LINE_AHEAD(rgb_line1, pixfc->source_row_bytes);\
+		PREFETCH_LINE_AHEAD(rgb_line2, pixfc->source_row_bytes);\
+		RGB24_TO_YUV420_AVG_CORE_LOOP(\
+				unpack_fn_prefix##instr_set, y_conv_fn,\
+				avg_422_downsample_first_r_g_b_vectors_n_save_previous_##instr_set,\
+				avg_422_downsample_r_g_b_vectors_n_save_previous_##instr_set,\
+				uv_conv_fn, y_pack_fn, uv_pack_fn);\
+		pixels_remaining_on_line = pixfc->width - 32;\
+		while(pixels_remaining_on_line > 0) {\
+			RGB24_TO_YUV420_AVG_CORE_LOOP(\
+					unpack_fn_prefix##instr_set, y_conv_fn,\
+					avg_422_downsample_r_g_b_vectors_n_save_previous_##instr_set,\
+					avg_422_downsample_r_g_b_vectors_n_save_previous_##instr_set,\
+					uv_conv_fn, y_pack_fn, uv_pack_fn);\
+			pixels_remaining_on_line -= 32;\
+		};\
+		/* the inner while loop handles two lines at a time */\
+		lines_remaining -= 2;\
+		rgb_line1 = (__m128i *) ((uint8_t*)rgb_line1 + 2 * pixfc->source_row_bytes - pixfc->width * 3);\
+		rgb_line2 = (__m128i *) ((uint8_t*)rgb_line2 + 2 * pixfc->source_row_bytes - pixfc->width * 3);\
+		yplane_line1 = (__m128i *) ((uint8_t*)yplane_line1 + pixfc->width);\
+		yplane_line2 = (__m128i *) ((uint8_t*)yplane_line2 + pixfc->width);\
+	};\
+
+#define AVG_DOWNSAMPLE_RGB24_TO_YUV420P_RECIPE(unpack_fn_prefix, y_pack_fn, uv_pack_fn, y_conv_fn, uv_conv_fn, instr_set) \
+	AVG_DOWNSAMPLE_RGB24_TO_YUV420_RECIPE(YUV420P_UV_OUTPUT, unpack_fn_prefix, y_pack_fn, uv_pack_fn, y_conv_fn, uv_conv_fn, instr_set)
+#define AVG_DOWNSAMPLE_RGB24_TO_NV12_RECIPE(unpack_fn_prefix, y_pack_fn, uv_pack_fn, y_conv_fn, uv_conv_fn, instr_set) \
+	AVG_DOWNSAMPLE_RGB24_TO_YUV420_RECIPE(NV12_UV_OUTPUT, unpack_fn_prefix, y_pack_fn, uv_pack_fn, y_conv_fn, uv_conv_fn, instr_set)
+
 
 
 
@@ -1907,6 +2213,7 @@
 	__m128i		unpack_out[6];\
 	__m128i		convert_out[6];\
 	TO_V120_48_PIX_OUTER_CONVERSION_LOOP(\
+			rgb_in, yuv_out,\
 			RGB24_TO_V210_NNB_LOOP_CORE,\
 			RGB24_TO_V210_NNB_LOOP_CORE,\
 			RGB24_TO_V210_NNB_LOOP_CORE_LEFTOVER16,\
@@ -2044,6 +2351,7 @@
 	__m128i		unpack_out[6];\
 	__m128i		convert_out[6];\
 	TO_V120_48_PIX_OUTER_CONVERSION_LOOP(\
+			rgb_in, yuv_out,\
 			RGB24_TO_V210_AVG_LOOP_CORE_FIRST48,\
 			RGB24_TO_V210_AVG_LOOP_CORE,\
 			RGB24_TO_V210_AVG_LOOP_CORE_FIRST_LEFTOVER16,\
@@ -2066,8 +2374,8 @@
 	uint32_t	line = pixfc->height;\
 	uint8_t		*next_src = (uint8_t *)source_buffer;\
 	uint8_t		*next_dst = (uint8_t *)dest_buffer;\
-	uint32_t	src_row_byte_count = ROW_SIZE(pixfc->source_fmt, width);\
-	uint32_t	dst_row_byte_count = ROW_SIZE(pixfc->dest_fmt, width);\
+	uint32_t	src_row_byte_count = pixfc->source_row_bytes;\
+	uint32_t	dst_row_byte_count = pixfc->dest_row_bytes;\
 	uint32_t	pixel;\
 	__m128i*	rgb_in;\
 	__m128i*	rgb_out;\
@@ -2078,6 +2386,7 @@
 		rgb_in = (__m128i *) next_src;\
 		rgb_out = (__m128i *) next_dst;\
 		\
+		PREFETCH_LINE_AHEAD(next_src, src_row_byte_count);\
 		next_src += src_row_byte_count;\
 		next_dst += dst_row_byte_count;\
 		\
@@ -2109,18 +2418,20 @@
 	uint32_t	line = pixfc->height;\
 	uint8_t		*next_src = (uint8_t *)source_buffer;\
 	uint8_t		*next_dst = (uint8_t *)dest_buffer;\
-	uint32_t	src_row_byte_count = ROW_SIZE(pixfc->source_fmt, width);\
-	uint32_t	dst_row_byte_count = ROW_SIZE(pixfc->dest_fmt, width);\
+	uint32_t	src_row_byte_count = pixfc->source_row_bytes;\
+	uint32_t	dst_row_byte_count = pixfc->dest_row_bytes;\
 	uint32_t	pixel;\
 	__m128i*	rgb_in;\
 	__m128i*	rgb_out;\
-	__m128i		unpack_out[6];\
+	__m128i		unpack_out[7];\
+	unpack_out[6] = _mm_set1_epi8((char) pixfc->alpha);\
 	while(line-- > 0) {\
 		pixel = width;\
 		\
 		rgb_in = (__m128i *) next_src;\
 		rgb_out = (__m128i *) next_dst;\
 		\
+		PREFETCH_LINE_AHEAD(next_src, src_row_byte_count);\
 		next_src += src_row_byte_count;\
 		next_dst += dst_row_byte_count;\
 		\
@@ -2139,4 +2450,94 @@
 		}\
 	}
 
+
+/*
+ * 		R G B
+ *
+ * 		T O
+ *
+ * 		R G B
+ *
+ * 8-bit RGB repacking: 16 pixels are unpacked in 6 R, G & B vectors which are
+ * then packed in the destination format. RGB32 unpack routines handle 8 pixels
+ * so they are called twice, RGB24 unpack routines handle 16 pixels. The 7th
+ * vector holds the alpha values of the ARGB & BGRA pack routines.
+ *
+ * input_stride & output_stride:	number of 128-bit vectors per 16 pixels
+ */
+#define UNPACK_16_RGB32_PIXELS(unpack_fn, input, output) \
+	unpack_fn(input, output);\
+	unpack_fn(&input[2], &output[3]);
+
+#define UNPACK_16_RGB24_PIXELS(unpack_fn, input, output) \
+	unpack_fn(input, output);
+
+#define RGB_TO_RGB_RECIPE(unpack_fn, pack_fn, unpack_16_pixels, input_stride, output_stride) \
+	uint32_t	width = pixfc->width;\
+	uint32_t	line = pixfc->height;\
+	uint8_t		*next_src = (uint8_t *)source_buffer;\
+	uint8_t		*next_dst = (uint8_t *)dest_buffer;\
+	uint32_t	src_row_byte_count = pixfc->source_row_bytes;\
+	uint32_t	dst_row_byte_count = pixfc->dest_row_bytes;\
+	uint32_t	pixel;\
+	__m128i*	rgb_in;\
+	__m128i*	rgb_out;\
+	__m128i		unpack_out[7];\
+	unpack_out[6] = _mm_set1_epi8((char) pixfc->alpha);\
+	while(line-- > 0) {\
+		pixel = width;\
+		\
+		rgb_in = (__m128i *) next_src;\
+		rgb_out = (__m128i *) next_dst;\
+		\
+		PREFETCH_LINE_AHEAD(next_src, src_row_byte_count);\
+		next_src += src_row_byte_count;\
+		next_dst += dst_row_byte_count;\
+		\
+		while(pixel > 0) {\
+			unpack_16_pixels(unpack_fn, rgb_in, unpack_out);\
+			pack_fn(unpack_out, rgb_out);\
+			rgb_in += input_stride;\
+			rgb_out += output_stride;\
+			pixel -= 16;\
+		}\
+	}
+
+/*
+ * ARGB <-> BGRA: the byte order of each 32-bit pixel is reversed, which
+ * keeps the source alpha values. 16 pixels are handled per iteration.
+ *
+ * stride:	number of 128-bit vectors per 16 pixels
+ */
+#define RGB32_TO_RGB32_RECIPE(swap_fn, store_fn, stride) \
+	uint32_t	width = pixfc->width;\
+	uint32_t	line = pixfc->height;\
+	uint8_t		*next_src = (uint8_t *)source_buffer;\
+	uint8_t		*next_dst = (uint8_t *)dest_buffer;\
+	uint32_t	src_row_byte_count = pixfc->source_row_bytes;\
+	uint32_t	dst_row_byte_count = pixfc->dest_row_bytes;\
+	uint32_t	pixel;\
+	__m128i*	rgb_in;\
+	__m128i*	rgb_out;\
+	__m128i		swap_out[4];\
+	while(line-- > 0) {\
+		pixel = width;\
+		\
+		rgb_in = (__m128i *) next_src;\
+		rgb_out = (__m128i *) next_dst;\
+		\
+		PREFETCH_LINE_AHEAD(next_src, src_row_byte_count);\
+		next_src += src_row_byte_count;\
+		next_dst += dst_row_byte_count;\
+		\
+		while(pixel > 0) {\
+			swap_fn(rgb_in, swap_out);\
+			swap_fn(&rgb_in[2], &swap_out[2]);\
+			store_fn(swap_out, rgb_out);\
+			rgb_in += stride;\
+			rgb_out += stride;\
+			pixel -= 16;\
+		}\
+	}
+
 #endif /* RGB_CONVERSION_RECIPES_H_ */
@@ -0,0 +1,283 @@
+/*
+ * rgb_conversion_recipes_avx2.h
+ *
+ * Copyright (C) 2011 PixFC Team (pixelfc@gmail.com)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public  License as published by the
+ * Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef RGB_CONVERSION_RECIPES_AVX2_H_
+#define RGB_CONVERSION_RECIPES_AVX2_H_
+
+#include "common.h"
+
+#ifndef DEBUG
+#include "rgb_unpack_avx2.h"
+#include "rgb_pack_avx2.h"
+#include "rgb_downsample_avx2.h"
+#include "rgb_to_yuv_convert_avx2.h"
+#include "yuv_pack_avx2.h"
+#endif
+
+#ifdef __INTEL_CPU__
+
+/*
+ * The AVX2 recipes below handle 16 pixels per iteration and honour the
+ * source and destination row bytes (planar destinations must be packed).
+ * They use unaligned loads & stores only.
+ *
+ * They expect the following variables to be in scope:
+ * pixfc, source_buffer and dest_buffer.
+ *
+ * Parameters common to all recipes:
+ * unpack_fn:				unpack_{argb,bgra,rgb24,bgr24}_to_rgb_pixel_vectors_avx2
+ * downsample_first_fn:		NNB_422_DOWNSAMPLE_AVX2 or AVG_422_DOWNSAMPLE_FIRST_AVX2
+ * downsample_fn:			NNB_422_DOWNSAMPLE_AVX2 or AVG_422_DOWNSAMPLE_AVX2
+ * y_conv_fn:				convert_rgb_pixel_vectors_to_(10bit_)y_vector(_bt601|_bt709)_avx2
+ * uv_conv_fn:				convert_downsampled_422_rgb_pixel_vectors_to_(10bit_)uv_vector(_bt601|_bt709)_avx2
+ * input_stride:			bytes per input pixel
+ */
+
+/*
+ * Downsampling wrappers giving the NNB & AVG inlines the same signature.
+ * downsample_first_fn is used for the first 16 pixels in a line, downsample_fn
+ * for the others.
+ */
+#define NNB_422_DOWNSAMPLE_AVX2(rgb_in, previous, rgb_out) \
+	(void) (previous);\
+	nnb_422_downsample_rgb_pixel_vectors_avx2(rgb_in, rgb_out)
+
+#define AVG_422_DOWNSAMPLE_FIRST_AVX2(rgb_in, previous, rgb_out) \
+	avg_422_downsample_first_rgb_pixel_vectors_n_save_previous_avx2(rgb_in, previous, rgb_out)
+
+#define AVG_422_DOWNSAMPLE_AVX2(rgb_in, previous, rgb_out) \
+	avg_422_downsample_rgb_pixel_vectors_n_save_previous_avx2(rgb_in, previous, rgb_out)
+
+
+/*
+ * Convert 16 RGB pixels at 'src' to 1 Y and 1 UV vector, and move 'src'
+ * to the next 16 pixels.
+ */
+#define RGB_TO_Y_UV_16_PIXELS_AVX2(unpack_fn, downsample_fn, y_conv_fn, uv_conv_fn, input_stride, y_out, uv_out) \
+	unpack_fn(src, rgb);\
+	y_conv_fn(rgb, y_out);\
+	downsample_fn(rgb, &previous, downsampled);\
+	uv_conv_fn(downsampled, uv_out);\
+	src += 16 * (input_stride);
+
+
+/*
+ * Convert RGB to YUV422 interleaved
+ *
+ * pack_fn:				pack_y_uv_vectors_to_{yuyv,uyvy}_avx2
+ */
+#define RGB_TO_YUV422I_RECIPE_AVX2(unpack_fn, downsample_first_fn, downsample_fn, y_conv_fn, uv_conv_fn, pack_fn, input_stride) \
+	uint32_t	line;\
+	uint32_t	pixels_remaining;\
+	uint8_t*	src;\
+	uint8_t*	dst;\
+	__m256i		rgb[4];\
+	__m256i		downsampled[2];\
+	__m256i		previous = _mm256_setzero_si256();\
+	__m256i		y;\
+	__m256i		uv;\
+	for(line = 0; line < pixfc->height; line++) {\
+		src = (uint8_t *) source_buffer + line * pixfc->source_row_bytes;\
+		PREFETCH_LINE_AHEAD(src, pixfc->source_row_bytes);\
+		dst = (uint8_t *) dest_buffer + line * pixfc->dest_row_bytes;\
+		RGB_TO_Y_UV_16_PIXELS_AVX2(unpack_fn, downsample_first_fn, y_conv_fn, uv_conv_fn, input_stride, &y, &uv);\
+		pack_fn(&y, &uv, dst);\
+		dst += 32;\
+		pixels_remaining = pixfc->width - 16;\
+		while(pixels_remaining > 0) {\
+			RGB_TO_Y_UV_16_PIXELS_AVX2(unpack_fn, downsample_fn, y_conv_fn, uv_conv_fn, input_stride, &y, &uv);\
+			pack_fn(&y, &uv, dst);\
+			dst += 32;\
+			pixels_remaining -= 16;\
+		}\
+	}
+
+
+/*
+ * Convert RGB to YUV422 planar
+ */
+#define RGB_TO_YUV422P_RECIPE_AVX2(unpack_fn, downsample_first_fn, downsample_fn, y_conv_fn, uv_conv_fn, input_stride) \
+	uint32_t	line;\
+	uint32_t	pixels_remaining;\
+	uint32_t	chroma_width = pixfc->width / 2;\
+	uint8_t*	src;\
+	uint8_t*	y_dst;\
+	uint8_t*	u_dst;\
+	uint8_t*	v_dst;\
+	uint8_t*	u_plane = (uint8_t *) dest_buffer + pixfc->pixel_count;\
+	uint8_t*	v_plane = u_plane + pixfc->pixel_count / 2;\
+	__m256i		rgb[4];\
+	__m256i		downsampled[2];\
+	__m256i		previous = _mm256_setzero_si256();\
+	__m256i		y;\
+	__m256i		uv;\
+	for(line = 0; line < pixfc->height; line++) {\
+		src = (uint8_t *) source_buffer + line * pixfc->source_row_bytes;\
+		PREFETCH_LINE_AHEAD(src, pixfc->source_row_bytes);\
+		y_dst = (uint8_t *) dest_buffer + line * pixfc->width;\
+		u_dst = u_plane + line * chroma_width;\
+		v_dst = v_plane + line * chroma_width;\
+		RGB_TO_Y_UV_16_PIXELS_AVX2(unpack_fn, downsample_first_fn, y_conv_fn, uv_conv_fn, input_stride, &y, &uv);\
+		pack_y_uv_vectors_to_yuv422p_avx2(&y, &uv, y_dst, u_dst, v_dst);\
+		y_dst += 16;\
+		u_dst += 8;\
+		v_dst += 8;\
+		pixels_remaining = pixfc->width - 16;\
+		while(pixels_remaining > 0) {\
+			RGB_TO_Y_UV_16_PIXELS_AVX2(unpack_fn, downsample_fn, y_conv_fn, uv_conv_fn, input_stride, &y, &uv);\
+			pack_y_uv_vectors_to_yuv422p_avx2(&y, &uv, y_dst, u_dst, v_dst);\
+			y_dst += 16;\
+			u_dst += 8;\
+			v_dst += 8;\
+			pixels_remaining -= 16;\
+		}\
+	}
+
+
+/*
+ * Convert RGB to v210
+ *
+ * Pixels are packed 48 at a time (128 bytes of v210). If the width is not
+ * a multiple of 48, the last 16 or 32 pixels in a line are padded with
+ * zeros, which fits in the line since v210 lines are 128-byte aligned.
+ */
+#define RGB_TO_V210_RECIPE_AVX2(unpack_fn, downsample_first_fn, downsample_fn, y_conv_fn, uv_conv_fn, input_stride) \
+	uint32_t	line;\
+	uint32_t	pixels_remaining;\
+	uint32_t	index;\
+	uint8_t*	src;\
+	uint8_t*	dst;\
+	__m256i		rgb[4];\
+	__m256i		downsampled[2];\
+	__m256i		previous = _mm256_setzero_si256();\
+	__m256i		y_uv[6];\
+	for(line = 0; line < pixfc->height; line++) {\
+		src = (uint8_t *) source_buffer + line * pixfc->source_row_bytes;\
+		PREFETCH_LINE_AHEAD(src, pixfc->source_row_bytes);\
+		dst = (uint8_t *) dest_buffer + line * pixfc->dest_row_bytes;\
+		RGB_TO_Y_UV_16_PIXELS_AVX2(unpack_fn, downsample_first_fn, y_conv_fn, uv_conv_fn, input_stride, &y_uv[0], &y_uv[1]);\
+		index = 2;\
+		pixels_remaining = pixfc->width - 16;\
+		while(pixels_remaining > 0) {\
+			if (index == 6) {\
+				pack_6_y_uv_vectors_to_4_v210_vectors_avx2(y_uv, dst);\
+				dst += 128;\
+				index = 0;\
+			}\
+			RGB_TO_Y_UV_16_PIXELS_AVX2(unpack_fn, downsample_fn, y_conv_fn, uv_conv_fn, input_stride, &y_uv[index], &y_uv[index + 1]);\
+			index += 2;\
+			pixels_remaining -= 16;\
+		}\
+		while(index < 6)\
+			y_uv[index++] = _mm256_setzero_si256();\
+		pack_6_y_uv_vectors_to_4_v210_vectors_avx2(y_uv, dst);\
+	}
+
+
+/*
+ * Repack 8-bit RGB to 8-bit RGB
+ *
+ * 16 pixels are loaded with load_fn (4 pixels per lane), reordered with
+ * a single PSHUFB per vector into 32-bit pixels in the destination
+ * component order, and stored with store_fn.
+ *
+ * load_fn:				load_16_rgb{32,24}_pixels_avx2
+ * store_fn:			store_16_32bit_pixels(_as_24bit_pixels)_avx2
+ * input_stride:		bytes per input pixel
+ * output_stride:		bytes per output pixel
+ * byte0 - byte3:		offset in the source pixel of each destination byte
+ * 						(-1 for a 0 byte)
+ * alpha:				vector OR'ed with the reordered pixels, to set the
+ * 						alpha byte of 32-bit pixels built from 24-bit ones
+ */
+#define RGB_SHUFFLE_BYTE_AVX2(first, stride, pixel, offset) \
+	(((offset) < 0) ? -1 : (first) + (pixel) * (stride) + (offset))
+
+#define RGB_SHUFFLE_LANE_AVX2(first, stride, byte0, byte1, byte2, byte3) \
+	RGB_SHUFFLE_BYTE_AVX2(first, stride, 0, byte0), RGB_SHUFFLE_BYTE_AVX2(first, stride, 0, byte1), RGB_SHUFFLE_BYTE_AVX2(first, stride, 0, byte2), RGB_SHUFFLE_BYTE_AVX2(first, stride, 0, byte3),\
+	RGB_SHUFFLE_BYTE_AVX2(first, stride, 1, byte0), RGB_SHUFFLE_BYTE_AVX2(first, stride, 1, byte1), RGB_SHUFFLE_BYTE_AVX2(first, stride, 1, byte2), RGB_SHUFFLE_BYTE_AVX2(first, stride, 1, byte3),\
+	RGB_SHUFFLE_BYTE_AVX2(first, stride, 2, byte0), RGB_SHUFFLE_BYTE_AVX2(first, stride, 2, byte1), RGB_SHUFFLE_BYTE_AVX2(first, stride, 2, byte2), RGB_SHUFFLE_BYTE_AVX2(first, stride, 2, byte3),\
+	RGB_SHUFFLE_BYTE_AVX2(first, stride, 3, byte0), RGB_SHUFFLE_BYTE_AVX2(first, stride, 3, byte1), RGB_SHUFFLE_BYTE_AVX2(first, stride, 3, byte2), RGB_SHUFFLE_BYTE_AVX2(first, stride, 3, byte3)
+
+// load_16_rgb24_pixels_avx2() places the first pixel of the high lanes at byte 4
+#define RGB_SHUFFLE_MASK_AVX2(stride, byte0, byte1, byte2, byte3) \
+	_mm256_setr_epi8(\
+		RGB_SHUFFLE_LANE_AVX2(0, stride, byte0, byte1, byte2, byte3),\
+		RGB_SHUFFLE_LANE_AVX2(16 - 4 * (stride), stride, byte0, byte1, byte2, byte3))
+
+#define RGB_TO_RGB_RECIPE_AVX2(load_fn, store_fn, input_stride, output_stride, byte0, byte1, byte2, byte3, alpha) \
+	uint32_t	line;\
+	uint32_t	pixels_remaining;\
+	uint8_t*	src;\
+	uint8_t*	dst;\
+	__m256i		shuffle = RGB_SHUFFLE_MASK_AVX2(input_stride, byte0, byte1, byte2, byte3);\
+	__m256i		alpha_fill = alpha;\
+	__m256i		pixels[2];\
+	for(line = 0; line < pixfc->height; line++) {\
+		src = (uint8_t *) source_buffer + line * pixfc->source_row_bytes;\
+		PREFETCH_LINE_AHEAD(src, pixfc->source_row_bytes);\
+		dst = (uint8_t *) dest_buffer + line * pixfc->dest_row_bytes;\
+		pixels_remaining = pixfc->width;\
+		while(pixels_remaining > 0) {\
+			load_fn(src, pixels);\
+			pixels[0] = _mm256_or_si256(_mm256_shuffle_epi8(pixels[0], shuffle), alpha_fill);\
+			pixels[1] = _mm256_or_si256(_mm256_shuffle_epi8(pixels[1], shuffle), alpha_fill);\
+			store_fn(pixels, dst);\
+			src += 16 * (input_stride);\
+			dst += 16 * (output_stride);\
+			pixels_remaining -= 16;\
+		}\
+	}
+
+/*
+ * Destination specific wrappers. r_offset, g_offset & b_offset are the
+ * offsets of the R, G & B components in a source pixel. a_offset is the
+ * offset of the alpha component in 32-bit source pixels, which is copied
+ * to the destination, or -1 for 24-bit source pixels, in which case
+ * pixfc->alpha is used.
+ */
+#define RGB_TO_ARGB_RECIPE_AVX2(load_fn, input_stride, a_offset, r_offset, g_offset, b_offset) \
+	RGB_TO_RGB_RECIPE_AVX2(load_fn, store_16_32bit_pixels_avx2, input_stride, 4, a_offset, r_offset, g_offset, b_offset,\
+		(((a_offset) < 0) ? _mm256_set1_epi32(pixfc->alpha) : _mm256_setzero_si256()))
+
+#define RGB_TO_BGRA_RECIPE_AVX2(load_fn, input_stride, a_offset, r_offset, g_offset, b_offset) \
+	RGB_TO_RGB_RECIPE_AVX2(load_fn, store_16_32bit_pixels_avx2, input_stride, 4, b_offset, g_offset, r_offset, a_offset,\
+		(((a_offset) < 0) ? _mm256_set1_epi32((int32_t) ((uint32_t) pixfc->alpha << 24)) : _mm256_setzero_si256()))
+
+#define RGB_TO_RGB24_RECIPE_AVX2(load_fn, input_stride, r_offset, g_offset, b_offset) \
+	RGB_TO_RGB_RECIPE_AVX2(load_fn, store_16_32bit_pixels_as_24bit_pixels_avx2, input_stride, 3, r_offset, g_offset, b_offset, -1, _mm256_setzero_si256())
+
+#define RGB_TO_BGR24_RECIPE_AVX2(load_fn, input_stride, r_offset, g_offset, b_offset) \
+	RGB_TO_RGB_RECIPE_AVX2(load_fn, store_16_32bit_pixels_as_24bit_pixels_avx2, input_stride, 3, b_offset, g_offset, r_offset, -1, _mm256_setzero_si256())
+
+
+#else	// __INTEL_CPU__
+
+#define RGB_TO_YUV422I_RECIPE_AVX2(...)
+#define RGB_TO_YUV422P_RECIPE_AVX2(...)
+#define RGB_TO_V210_RECIPE_AVX2(...)
+#define RGB_TO_ARGB_RECIPE_AVX2(...)
+#define RGB_TO_BGRA_RECIPE_AVX2(...)
+#define RGB_TO_RGB24_RECIPE_AVX2(...)
+#define RGB_TO_BGR24_RECIPE_AVX2(...)
+
+#endif	// __INTEL_CPU__
+
+#endif /* RGB_CONVERSION_RECIPES_AVX2_H_ */
@@ -0,0 +1,244 @@
+/*
+ * rgb_conversion_recipes_neon.h
+ *
+ * Copyright (C) 2011 PixFC Team (pixelfc@gmail.com)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public  License as published by the
+ * Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef RGB_CONVERSION_RECIPES_NEON_H_
+#define RGB_CONVERSION_RECIPES_NEON_H_
+
+#include "common.h"
+
+#ifndef DEBUG
+#include "rgb_unpack_neon.h"
+#include "rgb_downsample_neon.h"
+#include "rgb_to_yuv_convert_neon.h"
+#include "yuv_pack_neon.h"
+#endif
+
+#ifdef __NEON_CPU__
+
+/*
+ * The NEON recipes below handle 16 pixels per iteration and honour the
+ * source and destination row bytes (planar destinations must be packed).
+ *
+ * They expect the following variables to be in scope:
+ * pixfc, source_buffer and dest_buffer.
+ *
+ * Parameters common to all recipes:
+ * unpack_fn:				unpack_{argb,bgra,rgb24,bgr24}_to_rgb_vectors_neon
+ * downsample_first_fn:		NNB_422_DOWNSAMPLE_NEON or AVG_422_DOWNSAMPLE_FIRST_NEON (YUV422)
+ * 							NNB_420_DOWNSAMPLE_NEON or AVG_420_DOWNSAMPLE_FIRST_NEON (YUV420)
+ * downsample_fn:			NNB_422_DOWNSAMPLE_NEON or AVG_422_DOWNSAMPLE_NEON (YUV422)
+ * 							NNB_420_DOWNSAMPLE_NEON or AVG_420_DOWNSAMPLE_NEON (YUV420)
+ * y_conv_fn:				convert_rgb_vectors_to_y_vector(_bt601|_bt709)_neon
+ * uv_conv_fn:				convert_downsampled_rgb_vectors_to_uv_vectors(_bt601|_bt709)_neon
+ * input_stride:			bytes per input pixel
+ */
+
+/*
+ * Downsampling wrappers giving the NNB & AVG inlines the same signature.
+ * downsample_first_fn is used for the first 16 pixels in a line, downsample_fn
+ * for the others.
+ */
+#define NNB_422_DOWNSAMPLE_NEON(rgb_in, previous, rgb_out) \
+	(void) (previous);\
+	nnb_422_downsample_rgb_vectors_neon(rgb_in, rgb_out)
+
+#define AVG_422_DOWNSAMPLE_FIRST_NEON(rgb_in, previous, rgb_out) \
+	avg_422_downsample_first_rgb_vectors_n_save_previous_neon(rgb_in, previous, rgb_out)
+
+#define AVG_422_DOWNSAMPLE_NEON(rgb_in, previous, rgb_out) \
+	avg_422_downsample_rgb_vectors_n_save_previous_neon(rgb_in, previous, rgb_out)
+
+// The YUV420 versions take the pixels of 2 lines. The AVG ones average
+// both lines, then apply the same horizontal filter as the YUV422 ones.
+#define NNB_420_DOWNSAMPLE_NEON(rgb_line1_in, rgb_line2_in, previous, rgb_out) \
+	(void) (previous);\
+	nnb_420_downsample_rgb_vectors_neon(rgb_line1_in, rgb_line2_in, rgb_out)
+
+#define AVG_420_DOWNSAMPLE_FIRST_NEON(rgb_line1_in, rgb_line2_in, previous, rgb_out) \
+	average_2_lines_rgb_vectors_neon(rgb_line1_in, rgb_line2_in, averaged_rgb);\
+	avg_422_downsample_first_rgb_vectors_n_save_previous_neon(averaged_rgb, previous, rgb_out)
+
+#define AVG_420_DOWNSAMPLE_NEON(rgb_line1_in, rgb_line2_in, previous, rgb_out) \
+	average_2_lines_rgb_vectors_neon(rgb_line1_in, rgb_line2_in, averaged_rgb);\
+	avg_422_downsample_rgb_vectors_n_save_previous_neon(averaged_rgb, previous, rgb_out)
+
+
+/*
+ * Convert 16 RGB pixels at 'src' to 1 Y and 1 U & V vector, and move 'src'
+ * to the next 16 pixels.
+ */
+#define RGB_TO_Y_UV_16_PIXELS_NEON(unpack_fn, downsample_fn, y_conv_fn, uv_conv_fn, input_stride) \
+	unpack_fn(src, rgb);\
+	y_conv_fn(rgb, &y);\
+	downsample_fn(rgb, previous, downsampled);\
+	uv_conv_fn(downsampled, uv);\
+	src += 16 * (input_stride);
+
+
+/*
+ * Convert RGB to YUV422 interleaved
+ *
+ * pack_fn:				pack_y_uv_vectors_to_{yuyv,uyvy}_neon
+ */
+#define RGB_TO_YUV422I_RECIPE_NEON(unpack_fn, downsample_first_fn, downsample_fn, y_conv_fn, uv_conv_fn, pack_fn, input_stride) \
+	uint32_t	line;\
+	uint32_t	pixels_remaining;\
+	uint8_t*	src;\
+	uint8_t*	dst;\
+	uint8x16_t	rgb[3];\
+	int16x8_t	downsampled[3];\
+	uint8x8_t	previous[3];\
+	uint8x16_t	y;\
+	uint8x8_t	uv[2];\
+	for(line = 0; line < pixfc->height; line++) {\
+		src = (uint8_t *) source_buffer + line * pixfc->source_row_bytes;\
+		dst = (uint8_t *) dest_buffer + line * pixfc->dest_row_bytes;\
+		RGB_TO_Y_UV_16_PIXELS_NEON(unpack_fn, downsample_first_fn, y_conv_fn, uv_conv_fn, input_stride);\
+		pack_fn(&y, uv, dst);\
+		dst += 32;\
+		pixels_remaining = pixfc->width - 16;\
+		while(pixels_remaining > 0) {\
+			RGB_TO_Y_UV_16_PIXELS_NEON(unpack_fn, downsample_fn, y_conv_fn, uv_conv_fn, input_stride);\
+			pack_fn(&y, uv, dst);\
+			dst += 32;\
+			pixels_remaining -= 16;\
+		}\
+	}
+
+
+/*
+ * Convert RGB to YUV422 planar
+ */
+#define RGB_TO_YUV422P_RECIPE_NEON(unpack_fn, downsample_first_fn, downsample_fn, y_conv_fn, uv_conv_fn, input_stride) \
+	uint32_t	line;\
+	uint32_t	pixels_remaining;\
+	uint8_t*	src;\
+	uint8_t*	y_dst = (uint8_t *) dest_buffer;\
+	uint8_t*	u_dst = y_dst + pixfc->pixel_count;\
+	uint8_t*	v_dst = u_dst + pixfc->pixel_count / 2;\
+	uint8x16_t	rgb[3];\
+	int16x8_t	downsampled[3];\
+	uint8x8_t	previous[3];\
+	uint8x16_t	y;\
+	uint8x8_t	uv[2];\
+	for(line = 0; line < pixfc->height; line++) {\
+		src = (uint8_t *) source_buffer + line * pixfc->source_row_bytes;\
+		RGB_TO_Y_UV_16_PIXELS_NEON(unpack_fn, downsample_first_fn, y_conv_fn, uv_conv_fn, input_stride);\
+		pack_y_uv_vectors_to_yuv422p_neon(&y, uv, y_dst, u_dst, v_dst);\
+		y_dst += 16;\
+		u_dst += 8;\
+		v_dst += 8;\
+		pixels_remaining = pixfc->width - 16;\
+		while(pixels_remaining > 0) {\
+			RGB_TO_Y_UV_16_PIXELS_NEON(unpack_fn, downsample_fn, y_conv_fn, uv_conv_fn, input_stride);\
+			pack_y_uv_vectors_to_yuv422p_neon(&y, uv, y_dst, u_dst, v_dst);\
+			y_dst += 16;\
+			u_dst += 8;\
+			v_dst += 8;\
+			pixels_remaining -= 16;\
+		}\
+	}
+
+
+/*
+ * Convert 16 RGB pixels on each of 2 lines at 'src1' & 'src2' to 2 Y
+ * vectors stored at 'y_dst1' & 'y_dst2', and 1 U & V vector, and move
+ * 'src1', 'src2', 'y_dst1' & 'y_dst2' to the next 16 pixels.
+ */
+#define RGB_TO_Y_UV_2_LINES_16_PIXELS_NEON(unpack_fn, downsample_fn, y_conv_fn, uv_conv_fn, input_stride) \
+	unpack_fn(src1, rgb_line1);\
+	unpack_fn(src2, rgb_line2);\
+	y_conv_fn(rgb_line1, &y);\
+	vst1q_u8(y_dst1, y);\
+	y_conv_fn(rgb_line2, &y);\
+	vst1q_u8(y_dst2, y);\
+	downsample_fn(rgb_line1, rgb_line2, previous, downsampled);\
+	uv_conv_fn(downsampled, uv);\
+	src1 += 16 * (input_stride);\
+	src2 += 16 * (input_stride);\
+	y_dst1 += 16;\
+	y_dst2 += 16;
+
+
+/*
+ * Store 1 U & V vector to the chroma plane(s) of a YUV420 image at 'u_dst'
+ * (and 'v_dst'), and move them to the next 8 chroma samples.
+ */
+#define PACK_UV_VECTORS_TO_YUV420P_NEON()\
+	pack_uv_vectors_to_yuv420p_neon(uv, u_dst, v_dst);\
+	u_dst += 8;\
+	v_dst += 8;
+
+#define PACK_UV_VECTORS_TO_NV12_NEON()\
+	pack_uv_vectors_to_nv12_neon(uv, u_dst);\
+	u_dst += 16;
+
+#define PACK_UV_VECTORS_TO_NV21_NEON()\
+	pack_uv_vectors_to_nv21_neon(uv, u_dst);\
+	u_dst += 16;
+
+
+/*
+ * Convert RGB to YUV420 (planar or semi-planar)
+ *
+ * pack_uv_fn:			PACK_UV_VECTORS_TO_{YUV420P,NV12,NV21}_NEON
+ */
+#define RGB_TO_YUV420_RECIPE_NEON(unpack_fn, downsample_first_fn, downsample_fn, y_conv_fn, uv_conv_fn, pack_uv_fn, input_stride) \
+	uint32_t	line;\
+	uint32_t	pixels_remaining;\
+	uint8_t*	src1;\
+	uint8_t*	src2;\
+	uint8_t*	y_dst1 = (uint8_t *) dest_buffer;\
+	uint8_t*	y_dst2;\
+	uint8_t*	u_dst = y_dst1 + pixfc->pixel_count;\
+	uint8_t*	v_dst = u_dst + pixfc->pixel_count / 4;\
+	uint8x16_t	rgb_line1[3];\
+	uint8x16_t	rgb_line2[3];\
+	uint8x16_t	averaged_rgb[3];\
+	int16x8_t	downsampled[3];\
+	uint8x8_t	previous[3];\
+	uint8x16_t	y;\
+	uint8x8_t	uv[2];\
+	(void) v_dst;\
+	(void) averaged_rgb;\
+	for(line = 0; line < pixfc->height; line += 2) {\
+		src1 = (uint8_t *) source_buffer + line * pixfc->source_row_bytes;\
+		src2 = src1 + pixfc->source_row_bytes;\
+		y_dst2 = y_dst1 + pixfc->width;\
+		RGB_TO_Y_UV_2_LINES_16_PIXELS_NEON(unpack_fn, downsample_first_fn, y_conv_fn, uv_conv_fn, input_stride);\
+		pack_uv_fn();\
+		pixels_remaining = pixfc->width - 16;\
+		while(pixels_remaining > 0) {\
+			RGB_TO_Y_UV_2_LINES_16_PIXELS_NEON(unpack_fn, downsample_fn, y_conv_fn, uv_conv_fn, input_stride);\
+			pack_uv_fn();\
+			pixels_remaining -= 16;\
+		}\
+		y_dst1 = y_dst2;\
+	}
+
+#else	// __NEON_CPU__
+
+#define RGB_TO_YUV422I_RECIPE_NEON(...)
+#define RGB_TO_YUV422P_RECIPE_NEON(...)
+#define RGB_TO_YUV420_RECIPE_NEON(...)
+
+#endif	// __NEON_CPU__
+
+#endif /* RGB_CONVERSION_RECIPES_NEON_H_ */
@@ -0,0 +1,89 @@
+/*
+ * rgb_downsample_avx2.h
+ *
+ * Copyright (C) 2011 PixFC Team (pixelfc@gmail.com)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public  License as published by the
+ * Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef RGB_DOWNSAMPLE_AVX2_H_
+#define RGB_DOWNSAMPLE_AVX2_H_
+
+#include "debug_support.h"
+#include "platform_util.h"
+
+#ifdef __INTEL_CPU__
+
+#include <immintrin.h>
+
+/*
+ * The inlines below take the 4 vectors of RGB pixels produced by the
+ * rgb_unpack_avx2.h inlines and output 2 vectors of 4 chroma pixels
+ * (R, G, B, 0) each, one per pair of input pixels.
+ *
+ * OUTPUT:
+ * R1 G1 B1 0		R3 G3 B3 0		|	R5 G5 B5 0		R7 G7 B7 0
+ * R9 G9 B9 0		R11 G11 B11 0	|	R13 G13 B13 0	R15 G15 B15 0
+ */
+
+
+/*
+ * Nearest neighbour downsampling: keep the first pixel of each pair.
+ *
+ * Number of pixels handled:	16
+ */
+EXTERN_INLINE void	nnb_422_downsample_rgb_pixel_vectors_avx2(__m256i* in_4_v16i_rgb_pixel_vectors, __m256i* out_2_v16i_nnb_422_rgb_pixel_vectors) {
+	out_2_v16i_nnb_422_rgb_pixel_vectors[0] = _mm256_unpacklo_epi64(in_4_v16i_rgb_pixel_vectors[0], in_4_v16i_rgb_pixel_vectors[1]);
+	out_2_v16i_nnb_422_rgb_pixel_vectors[1] = _mm256_unpacklo_epi64(in_4_v16i_rgb_pixel_vectors[2], in_4_v16i_rgb_pixel_vectors[3]);
+}
+
+/*
+ * Average downsampling: the chroma pixel of a pair (P1, P2) preceded by
+ * P0 is ((P0 + P2) / 2 + P1) / 2, as in the non-SSE integer routines.
+ * 'previous' holds the last pixel of the previous 16 pixels, and is updated
+ * with the last pixel of the current ones.
+ *
+ * Number of pixels handled:	16
+ */
+EXTERN_INLINE void	avg_422_downsample_rgb_pixel_vectors_n_save_previous_avx2(__m256i* in_4_v16i_rgb_pixel_vectors, __m256i* previous, __m256i* out_2_v16i_avg_422_rgb_pixel_vectors) {
+	// P1 P3 | P5 P7 - P9 P11 | P13 P15
+	__m256i		first_1 = _mm256_unpacklo_epi64(in_4_v16i_rgb_pixel_vectors[0], in_4_v16i_rgb_pixel_vectors[1]);
+	__m256i		first_2 = _mm256_unpacklo_epi64(in_4_v16i_rgb_pixel_vectors[2], in_4_v16i_rgb_pixel_vectors[3]);
+	// P2 P4 | P6 P8 - P10 P12 | P14 P16
+	__m256i		second_1 = _mm256_unpackhi_epi64(in_4_v16i_rgb_pixel_vectors[0], in_4_v16i_rgb_pixel_vectors[1]);
+	__m256i		second_2 = _mm256_unpackhi_epi64(in_4_v16i_rgb_pixel_vectors[2], in_4_v16i_rgb_pixel_vectors[3]);
+	// P0 P2 | P4 P6 - P8 P10 | P12 P14
+	__m256i		prev_1 = _mm256_blend_epi32(_mm256_permute4x64_epi64(second_1, 0x90), *previous, 0x03);
+	__m256i		prev_2 = _mm256_blend_epi32(_mm256_permute4x64_epi64(second_2, 0x90), _mm256_permute4x64_epi64(second_1, 0xFF), 0x03);
+
+	*previous = _mm256_permute4x64_epi64(second_2, 0xFF);
+
+	out_2_v16i_avg_422_rgb_pixel_vectors[0] = _mm256_srli_epi16(_mm256_add_epi16(_mm256_srli_epi16(_mm256_add_epi16(prev_1, second_1), 1), first_1), 1);
+	out_2_v16i_avg_422_rgb_pixel_vectors[1] = _mm256_srli_epi16(_mm256_add_epi16(_mm256_srli_epi16(_mm256_add_epi16(prev_2, second_2), 1), first_2), 1);
+}
+
+/*
+ * Same as above for the first 16 pixels in a line: the first pixel
+ * is used as its own previous pixel.
+ */
+EXTERN_INLINE void	avg_422_downsample_first_rgb_pixel_vectors_n_save_previous_avx2(__m256i* in_4_v16i_rgb_pixel_vectors, __m256i* previous, __m256i* out_2_v16i_avg_422_rgb_pixel_vectors) {
+	*previous = _mm256_permute4x64_epi64(in_4_v16i_rgb_pixel_vectors[0], 0x00);
+
+	avg_422_downsample_rgb_pixel_vectors_n_save_previous_avx2(in_4_v16i_rgb_pixel_vectors, previous, out_2_v16i_avg_422_rgb_pixel_vectors);
+}
+
+#endif	// __INTEL_CPU__
+
+#endif /* RGB_DOWNSAMPLE_AVX2_H_ */
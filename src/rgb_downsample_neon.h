@@ -0,0 +1,118 @@
+/*
+ * rgb_downsample_neon.h
+ *
+ * Copyright (C) 2011 PixFC Team (pixelfc@gmail.com)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public  License as published by the
+ * Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef RGB_DOWNSAMPLE_NEON_H_
+#define RGB_DOWNSAMPLE_NEON_H_
+
+#include "debug_support.h"
+#include "platform_util.h"
+
+#ifdef __NEON_CPU__
+
+#include <arm_neon.h>
+
+/*
+ * The NEON inlines below downsample 3 vectors of 16 R, G & B values
+ * (as returned by the rgb_unpack_neon.h inlines) to 3 vectors of 8 short
+ * R, G & B values, one per pair of pixels. Results match those of the
+ * non-SSE integer conversion routines.
+ *
+ * OUTPUT:
+ * R12	R34	R56	...	R1516
+ * G12	G34	G56	...	G1516
+ * B12	B34	B56	...	B1516
+ */
+
+/*
+ * Nearest neighbour: keep the first pixel of each pair.
+ *
+ * TOTAL LATENCY:				3
+ */
+EXTERN_INLINE void	nnb_422_downsample_rgb_vectors_neon(uint8x16_t* in_3_v8u_rgb_vectors, int16x8_t* out_3_v16i_rgb_vectors) {
+	// On little endian CPUs, the low byte of each short is the first pixel of a pair
+	uint16x8_t	mask = vdupq_n_u16(0x00FF);
+
+	out_3_v16i_rgb_vectors[0] = vreinterpretq_s16_u16(vandq_u16(vreinterpretq_u16_u8(in_3_v8u_rgb_vectors[0]), mask));
+	out_3_v16i_rgb_vectors[1] = vreinterpretq_s16_u16(vandq_u16(vreinterpretq_u16_u8(in_3_v8u_rgb_vectors[1]), mask));
+	out_3_v16i_rgb_vectors[2] = vreinterpretq_s16_u16(vandq_u16(vreinterpretq_u16_u8(in_3_v8u_rgb_vectors[2]), mask));
+}
+
+/*
+ * Average: apply a [1 2 1] filter centred on the first pixel of each pair:
+ * C12 = ((C0 + C2) / 2 + C1) / 2, where C0 is the second pixel of the
+ * previous pair.
+ * 'previous' holds the second pixel of the last pair of the previous
+ * 16 pixels (in its last lane), and is updated for the next 16 pixels.
+ *
+ * TOTAL LATENCY:				5
+ */
+EXTERN_INLINE void	avg_422_downsample_rgb_vectors_n_save_previous_neon(uint8x16_t* in_3_v8u_rgb_vectors, uint8x8_t* previous_3_v8u_rgb_vectors, int16x8_t* out_3_v16i_rgb_vectors) {
+	uint8x8x2_t	pixels;		// first & second pixel of each pair
+	uint8x8_t	before;		// pixel before the first one of each pair
+	uint32_t	index;
+
+	for(index = 0; index < 3; index++) {
+		pixels = vuzp_u8(vget_low_u8(in_3_v8u_rgb_vectors[index]), vget_high_u8(in_3_v8u_rgb_vectors[index]));
+		before = vext_u8(previous_3_v8u_rgb_vectors[index], pixels.val[1], 7);
+		out_3_v16i_rgb_vectors[index] = vreinterpretq_s16_u16(vmovl_u8(vhadd_u8(vhadd_u8(before, pixels.val[1]), pixels.val[0])));
+		previous_3_v8u_rgb_vectors[index] = pixels.val[1];
+	}
+}
+
+/*
+ * Same as above for the first 16 pixels in a line: the first pixel is
+ * used in place of the missing previous one.
+ */
+EXTERN_INLINE void	avg_422_downsample_first_rgb_vectors_n_save_previous_neon(uint8x16_t* in_3_v8u_rgb_vectors, uint8x8_t* previous_3_v8u_rgb_vectors, int16x8_t* out_3_v16i_rgb_vectors) {
+	previous_3_v8u_rgb_vectors[0] = vdup_lane_u8(vget_low_u8(in_3_v8u_rgb_vectors[0]), 0);
+	previous_3_v8u_rgb_vectors[1] = vdup_lane_u8(vget_low_u8(in_3_v8u_rgb_vectors[1]), 0);
+	previous_3_v8u_rgb_vectors[2] = vdup_lane_u8(vget_low_u8(in_3_v8u_rgb_vectors[2]), 0);
+
+	avg_422_downsample_rgb_vectors_n_save_previous_neon(in_3_v8u_rgb_vectors, previous_3_v8u_rgb_vectors, out_3_v16i_rgb_vectors);
+}
+
+/*
+ * Nearest neighbour 420: average the 4 pixels of each 2x2 block made of
+ * a pair of pixels in each of 2 lines:
+ * C12 = (C1L1 + C2L1 + C1L2 + C2L2) / 4
+ *
+ * TOTAL LATENCY:				6
+ */
+EXTERN_INLINE void	nnb_420_downsample_rgb_vectors_neon(uint8x16_t* in_3_v8u_rgb_line1_vectors, uint8x16_t* in_3_v8u_rgb_line2_vectors, int16x8_t* out_3_v16i_rgb_vectors) {
+	uint32_t	index;
+
+	for(index = 0; index < 3; index++)
+		out_3_v16i_rgb_vectors[index] = vreinterpretq_s16_u16(vshrq_n_u16(vaddq_u16(vpaddlq_u8(in_3_v8u_rgb_line1_vectors[index]), vpaddlq_u8(in_3_v8u_rgb_line2_vectors[index])), 2));
+}
+
+/*
+ * Average 2 lines of 16 R, G & B values: C = (CL1 + CL2) / 2
+ *
+ * TOTAL LATENCY:				3
+ */
+EXTERN_INLINE void	average_2_lines_rgb_vectors_neon(uint8x16_t* in_3_v8u_rgb_line1_vectors, uint8x16_t* in_3_v8u_rgb_line2_vectors, uint8x16_t* out_3_v8u_rgb_vectors) {
+	out_3_v8u_rgb_vectors[0] = vhaddq_u8(in_3_v8u_rgb_line1_vectors[0], in_3_v8u_rgb_line2_vectors[0]);
+	out_3_v8u_rgb_vectors[1] = vhaddq_u8(in_3_v8u_rgb_line1_vectors[1], in_3_v8u_rgb_line2_vectors[1]);
+	out_3_v8u_rgb_vectors[2] = vhaddq_u8(in_3_v8u_rgb_line1_vectors[2], in_3_v8u_rgb_line2_vectors[2]);
+}
+
+#endif	// __NEON_CPU__
+
+#endif /* RGB_DOWNSAMPLE_NEON_H_ */
@@ -43,16 +43,26 @@
  * This is done so this header file CAN be included multiple times, once with
  * GENERATE_UNALIGNED_INLINES set to 0 to generate inlines for aligned input buffers
  * and once with GENERATE_UNALIGNED_INLINES set to 1 to generate inlines for
- * unaligned input buffers
+ * unaligned input buffers.
+ * It can be included a third time with GENERATE_UNALIGNED_INLINES set to 0 and
+ * GENERATE_NON_TEMPORAL_INLINES set to 1 to generate nt_ inlines for aligned
+ * output buffers, which use streaming stores bypassing the cache.
  */
 
 #undef INLINE_NAME
 #undef M128_STORE
+#undef CALL_INLINE
 
 #if GENERATE_UNALIGNED_INLINES == 1
+	#define CALL_INLINE(fn, ...)					unaligned_ ## fn(__VA_ARGS__)
 	#define INLINE_NAME(fn_suffix, ...)				EXTERN_INLINE void unaligned_ ## fn_suffix(__VA_ARGS__)
 	#define M128_STORE(src, dst)					_mm_storeu_si128(&(dst), (src))
+#elif defined(GENERATE_NON_TEMPORAL_INLINES) && (GENERATE_NON_TEMPORAL_INLINES == 1)
+	#define CALL_INLINE(fn, ...)					nt_ ## fn(__VA_ARGS__)
+	#define INLINE_NAME(fn_suffix, ...)				EXTERN_INLINE void nt_ ## fn_suffix(__VA_ARGS__)
+	#define M128_STORE(src, dst)					_mm_stream_si128(&(dst), (src))
 #else
+	#define CALL_INLINE(fn, ...)					fn(__VA_ARGS__)
 	#define INLINE_NAME(fn_suffix, ...)				EXTERN_INLINE void fn_suffix(__VA_ARGS__)
 	#define M128_STORE(src, dst)					(dst) = (src)
 #endif
@@ -76,6 +86,9 @@
  * G9 0		G10 0	G11 0	G12 0	G13 0	G14 0	G15 0	G16 0
  * B9 0		B10 0	B11 0	B12 0	B13 0	B14 0	B15 0	B16 0
  *
+ * followed by 1 vector of 16 char alpha values:
+ * A1 A2	A3 A4	A5 A6	A7 A8	A9 A10	A11 A12	A13 A14	A15 A16
+ *
  * OUTPUT:
  *
  * B1 G1	R1 A1	B2 G2	R2 A2	B3 G3	R3 A3	B4 G4	R4 A4
@@ -90,7 +103,7 @@ INLINE_NAME(pack_6_rgb_vectors_in_4_bgra_vectors_sse2, __m128i* in_6_r_g_b_vecto
 	__m128i* r2 = &in_6_r_g_b_vectors[3];
 	__m128i* g2 = &in_6_r_g_b_vectors[4];
 	__m128i* b2 = &in_6_r_g_b_vectors[5];
-	__m128i zero = _mm_setzero_si128();
+	__m128i* a = &in_6_r_g_b_vectors[6];
 
 	__m128i rPacked = _mm_packus_epi16(*r1, *r2);						// PACKUSWB		1	0.5
 	// R1 R2	R3 R4	R5 R6	R7 R8	R9 R10	R11 R12	R13 R14	R15 R16
@@ -106,7 +119,7 @@ INLINE_NAME(pack_6_rgb_vectors_in_4_bgra_vectors_sse2, __m128i* in_6_r_g_b_vecto
 	__m128i bg = _mm_unpacklo_epi8(bPacked, gPacked);					// PUNPCKLBW	1	0.5
 	// B1 G1	B2 G2	B3 G3	B4 G4	B5 G5	B6 G6	B7 G7	B8 G8
 
-	__m128i ra = _mm_unpacklo_epi8(rPacked, zero);						// PUNPCKLBW	1	0.5
+	__m128i ra = _mm_unpacklo_epi8(rPacked, *a);						// PUNPCKLBW	1	0.5
 	// R1 A1	R2 A2	R3 A3	R4 A4	R5 A5	R6 A6	R7 A7	R8 A8
 
 	M128_STORE(_mm_unpacklo_epi16(bg, ra), out_4_bgra_vectors[0]);		// PUNPCKLWD	1	0.5
@@ -119,7 +132,7 @@ INLINE_NAME(pack_6_rgb_vectors_in_4_bgra_vectors_sse2, __m128i* in_6_r_g_b_vecto
 	bg = _mm_unpackhi_epi8(bPacked, gPacked);							// PUNPCKHBW	1	0.5
 	// B9 G9	B10 G10	B11 G11	B12 G12 B13 G13	B14 G14	B15 G15	B16 G16
 
-	ra = _mm_unpackhi_epi8(rPacked, zero);								// PUNPCKHBW	1	0.5
+	ra = _mm_unpackhi_epi8(rPacked, *a);								// PUNPCKHBW	1	0.5
 	// R9 A9	R10 A10	R11 A11	R12 A12	R13 A13	R14 A14	R15 A15	R16 A16
 
 	M128_STORE(_mm_unpacklo_epi16(bg, ra), out_4_bgra_vectors[2]);		// PUNPCKLWD	1	0.5
@@ -148,6 +161,9 @@ INLINE_NAME(pack_6_rgb_vectors_in_4_bgra_vectors_sse2, __m128i* in_6_r_g_b_vecto
  * G9 0		G10 0	G11 0	G12 0	G13 0	G14 0	G15 0	G16 0
  * B9 0		B10 0	B11 0	B12 0	B13 0	B14 0	B15 0	B16 0
  *
+ * followed by 1 vector of 16 char alpha values:
+ * A1 A2	A3 A4	A5 A6	A7 A8	A9 A10	A11 A12	A13 A14	A15 A16
+ *
  *
  * OUTPUT
  *
@@ -164,7 +180,7 @@ INLINE_NAME(pack_6_rgb_vectors_in_4_argb_vectors_sse2, __m128i* in_6_r_g_b_vecto
 	__m128i* r2 = &in_6_r_g_b_vectors[3];
 	__m128i* g2 = &in_6_r_g_b_vectors[4];
 	__m128i* b2 = &in_6_r_g_b_vectors[5];
-	__m128i zero = _mm_setzero_si128();
+	__m128i* a = &in_6_r_g_b_vectors[6];
 
 	__m128i rPacked = _mm_packus_epi16(*r1, *r2);						// PACKUSWB		1	0.5
 	// R1 R2	R3 R4	R5 R6	R7 R8	R9 R10	R11 R12	R13 R14	R15 R16
@@ -176,7 +192,7 @@ INLINE_NAME(pack_6_rgb_vectors_in_4_argb_vectors_sse2, __m128i* in_6_r_g_b_vecto
 	// B1 B2	B3 B4	B5 B6	B7 B8	B9 B10	B11 B12	B13 B14	B15 B16
 
 	// unpacking lows
-	__m128i ar = _mm_unpacklo_epi8(zero, rPacked);						// PUNPCKLBW	1	0.5
+	__m128i ar = _mm_unpacklo_epi8(*a, rPacked);						// PUNPCKLBW	1	0.5
 	// A1 R1	A2 R2	A3 R3	A4 R4	A5 R5	A6 R6	A7 R7	A8 R8
 
 	__m128i gb = _mm_unpacklo_epi8(gPacked, bPacked);					// PUNPCKLBW	1	0.5
@@ -189,7 +205,7 @@ INLINE_NAME(pack_6_rgb_vectors_in_4_argb_vectors_sse2, __m128i* in_6_r_g_b_vecto
 	// A5 R5	G5 B5	A6 R6	G6 B6	A7 R7	G7 B7	A8 R8	G8 B8
 
 	// unpacking highs
-	ar = _mm_unpackhi_epi8(zero, rPacked);								// PUNPCKHBW	1	0.5
+	ar = _mm_unpackhi_epi8(*a, rPacked);								// PUNPCKHBW	1	0.5
 	// A9 R9	A10 R10	A11 R11	A12 R12	A13 R13	A14 R14	A15 R15	A16 R16
 
 	gb = _mm_unpackhi_epi8(gPacked, bPacked);							// PUNPCKHBW	1	0.5
@@ -204,6 +220,20 @@ INLINE_NAME(pack_6_rgb_vectors_in_4_argb_vectors_sse2, __m128i* in_6_r_g_b_vecto
 
 
 
+/*
+ * Store 4 vectors of 32-bit pixels (ARGB or BGRA).
+ *
+ * Num of pixel handled:	16
+ */
+INLINE_NAME(store_4_rgb32_vectors_sse2, __m128i* in_4_rgb32_vectors, __m128i* out_4_rgb32_vectors) {
+	M128_STORE(in_4_rgb32_vectors[0], out_4_rgb32_vectors[0]);
+	M128_STORE(in_4_rgb32_vectors[1], out_4_rgb32_vectors[1]);
+	M128_STORE(in_4_rgb32_vectors[2], out_4_rgb32_vectors[2]);
+	M128_STORE(in_4_rgb32_vectors[3], out_4_rgb32_vectors[3]);
+};
+
+
+
 /*
  * Pack R1, G1, B1 and R2, G2, B2 vectors of signed short
  * in 3 RGB24 vectors of 16 char
@@ -609,8 +639,8 @@ INLINE_NAME(pack_3_r_g_b_vectors_to_2_r210_sse2_ssse3, __m128i* input, __m128i*
  *
  */
 INLINE_NAME(pack_6_r_g_b_vectors_to_4_r210_sse2_ssse3, __m128i* input, __m128i* output) {
-	pack_3_r_g_b_vectors_to_2_r210_sse2_ssse3(&input[0], &output[0]);
-	pack_3_r_g_b_vectors_to_2_r210_sse2_ssse3(&input[3], &output[2]);
+	CALL_INLINE(pack_3_r_g_b_vectors_to_2_r210_sse2_ssse3, &input[0], &output[0]);
+	CALL_INLINE(pack_3_r_g_b_vectors_to_2_r210_sse2_ssse3, &input[3], &output[2]);
 }
 
 
@@ -719,8 +749,8 @@ INLINE_NAME(pack_3_r_g_b_vectors_to_2_r10k_sse2_ssse3, __m128i* input, __m128i*
  *
  */
 INLINE_NAME(pack_6_r_g_b_vectors_to_4_r10k_sse2_ssse3, __m128i* input, __m128i* output) {
-	pack_3_r_g_b_vectors_to_2_r10k_sse2_ssse3(&input[0], &output[0]);
-	pack_3_r_g_b_vectors_to_2_r10k_sse2_ssse3(&input[3], &output[2]);
+	CALL_INLINE(pack_3_r_g_b_vectors_to_2_r10k_sse2_ssse3, &input[0], &output[0]);
+	CALL_INLINE(pack_3_r_g_b_vectors_to_2_r10k_sse2_ssse3, &input[3], &output[2]);
 }
 
 #endif 	// __INTEL_CPU__
@@ -0,0 +1,191 @@
+/*
+ * rgb_pack_avx2.h
+ *
+ * Copyright (C) 2011 PixFC Team (pixelfc@gmail.com)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public  License as published by the
+ * Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef RGB_PACK_AVX2_H_
+#define RGB_PACK_AVX2_H_
+
+#include "debug_support.h"
+#include "platform_util.h"
+
+#ifdef __INTEL_CPU__
+
+#include <immintrin.h>
+
+/*
+ * All pack routines below take 3 vectors of 16 short R, G & B (pixels 1 to
+ * 8 in the low lane, 9 to 16 in the high lane), saturate them to 8 bits and
+ * store 16 pixels at 'output' using unaligned stores. The ARGB and BGRA
+ * routines take the alpha values from a 4th vector of 32 char, as the SSE
+ * routines do (only the low 8 bytes of each lane are used).
+ */
+
+
+/*
+ * Interleave 2 vectors of 16 pixel halves (first and last 2 bytes of each
+ * 32-bit pixel) and store the resulting 16 32-bit pixels.
+ *
+ * INPUT:
+ * 2 vectors of 16 short
+ * P1a	P2a	...	P8a		|	P9a	...	P16a
+ * P1b	P2b	...	P8b		|	P9b	...	P16b
+ */
+EXTERN_INLINE void	pack_2_pixel_halves_to_32bit_pixels_avx2(__m256i* first_halves, __m256i* second_halves, uint8_t* output) {
+	// pixels 1-4 | pixels 9-12
+	__m256i		lo = _mm256_unpacklo_epi16(*first_halves, *second_halves);
+	// pixels 5-8 | pixels 13-16
+	__m256i		hi = _mm256_unpackhi_epi16(*first_halves, *second_halves);
+
+	_mm256_storeu_si256((__m256i *) output, _mm256_permute2x128_si256(lo, hi, 0x20));
+	_mm256_storeu_si256((__m256i *) (output + 32), _mm256_permute2x128_si256(lo, hi, 0x31));
+}
+
+/*
+ * Pack 3 vectors of 16 short R, G & B into 64 bytes of ARGB
+ *
+ * Number of pixels handled:	16
+ *
+ * OUTPUT:
+ * A1 R1 G1 B1	A2 R2 G2 B2		...		A16 R16 G16 B16
+ */
+EXTERN_INLINE void	pack_3_rgb_vectors_to_argb_avx2(__m256i* in_3_v16i_rgb_vectors, uint8_t* output) {
+	__m256i		zero = _mm256_setzero_si256();
+	// R1-8 G1-8 | R9-16 G9-16
+	__m256i		rg = _mm256_packus_epi16(in_3_v16i_rgb_vectors[0], in_3_v16i_rgb_vectors[1]);
+	// B1-8 0 | B9-16 0
+	__m256i		b = _mm256_packus_epi16(in_3_v16i_rgb_vectors[2], zero);
+	__m256i		ar = _mm256_unpacklo_epi8(in_3_v16i_rgb_vectors[3], rg);
+	__m256i		gb = _mm256_unpacklo_epi8(_mm256_srli_si256(rg, 8), b);
+
+	pack_2_pixel_halves_to_32bit_pixels_avx2(&ar, &gb, output);
+}
+
+/*
+ * Pack 3 vectors of 16 short R, G & B into 64 bytes of BGRA
+ *
+ * Number of pixels handled:	16
+ *
+ * OUTPUT:
+ * B1 G1 R1 A1	B2 G2 R2 A2		...		B16 G16 R16 A16
+ */
+EXTERN_INLINE void	pack_3_rgb_vectors_to_bgra_avx2(__m256i* in_3_v16i_rgb_vectors, uint8_t* output) {
+	__m256i		zero = _mm256_setzero_si256();
+	__m256i		rg = _mm256_packus_epi16(in_3_v16i_rgb_vectors[0], in_3_v16i_rgb_vectors[1]);
+	__m256i		b = _mm256_packus_epi16(in_3_v16i_rgb_vectors[2], zero);
+	__m256i		bg = _mm256_unpacklo_epi8(b, _mm256_srli_si256(rg, 8));
+	__m256i		ra = _mm256_unpacklo_epi8(rg, in_3_v16i_rgb_vectors[3]);
+
+	pack_2_pixel_halves_to_32bit_pixels_avx2(&bg, &ra, output);
+}
+
+/*
+ * Drop the 4th byte of each 32-bit pixel in 2 vectors of 8 pixels per lane
+ * and store the resulting 16 24-bit pixels (48 bytes).
+ *
+ * INPUT:
+ * 2 vectors of 32-bit pixels
+ * P1 P2 P3 P4		|	P9 P10 P11 P12
+ * P5 P6 P7 P8		|	P13 P14 P15 P16
+ */
+EXTERN_INLINE void	pack_2_32bit_pixel_vectors_to_24bit_pixels_avx2(__m256i* first_pixels, __m256i* second_pixels, uint8_t* output) {
+	__m256i		drop_4th_byte = _mm256_setr_epi8(
+			0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1,
+			0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1);
+	__m256i		lo = _mm256_shuffle_epi8(*first_pixels, drop_4th_byte);
+	__m256i		hi = _mm256_shuffle_epi8(*second_pixels, drop_4th_byte);
+	// 12 bytes each: pixels 1-4, 5-8, 9-12 & 13-16
+	__m128i		p1 = _mm256_castsi256_si128(lo);
+	__m128i		p2 = _mm256_castsi256_si128(hi);
+	__m128i		p3 = _mm256_extracti128_si256(lo, 1);
+	__m128i		p4 = _mm256_extracti128_si256(hi, 1);
+
+	_mm_storeu_si128((__m128i *) output, _mm_or_si128(p1, _mm_slli_si128(p2, 12)));
+	_mm_storeu_si128((__m128i *) (output + 16), _mm_or_si128(_mm_srli_si128(p2, 4), _mm_slli_si128(p3, 8)));
+	_mm_storeu_si128((__m128i *) (output + 32), _mm_or_si128(_mm_srli_si128(p3, 8), _mm_slli_si128(p4, 4)));
+}
+
+/*
+ * Pack 3 vectors of 16 short R, G & B into 48 bytes of RGB24
+ *
+ * Number of pixels handled:	16
+ *
+ * OUTPUT:
+ * R1 G1 B1	R2 G2 B2	...		R16 G16 B16
+ */
+EXTERN_INLINE void	pack_3_rgb_vectors_to_rgb24_avx2(__m256i* in_3_v16i_rgb_vectors, uint8_t* output) {
+	__m256i		zero = _mm256_setzero_si256();
+	__m256i		rg = _mm256_packus_epi16(in_3_v16i_rgb_vectors[0], in_3_v16i_rgb_vectors[1]);
+	__m256i		b = _mm256_packus_epi16(in_3_v16i_rgb_vectors[2], zero);
+	__m256i		rg_pairs = _mm256_unpacklo_epi8(rg, _mm256_srli_si256(rg, 8));
+	__m256i		b0_pairs = _mm256_unpacklo_epi8(b, zero);
+	__m256i		lo = _mm256_unpacklo_epi16(rg_pairs, b0_pairs);
+	__m256i		hi = _mm256_unpackhi_epi16(rg_pairs, b0_pairs);
+
+	pack_2_32bit_pixel_vectors_to_24bit_pixels_avx2(&lo, &hi, output);
+}
+
+/*
+ * Pack 3 vectors of 16 short R, G & B into 48 bytes of BGR24
+ *
+ * Number of pixels handled:	16
+ *
+ * OUTPUT:
+ * B1 G1 R1	B2 G2 R2	...		B16 G16 R16
+ */
+EXTERN_INLINE void	pack_3_rgb_vectors_to_bgr24_avx2(__m256i* in_3_v16i_rgb_vectors, uint8_t* output) {
+	__m256i		zero = _mm256_setzero_si256();
+	__m256i		rg = _mm256_packus_epi16(in_3_v16i_rgb_vectors[0], in_3_v16i_rgb_vectors[1]);
+	__m256i		b = _mm256_packus_epi16(in_3_v16i_rgb_vectors[2], zero);
+	__m256i		bg_pairs = _mm256_unpacklo_epi8(b, _mm256_srli_si256(rg, 8));
+	__m256i		r0_pairs = _mm256_unpacklo_epi8(rg, zero);
+	__m256i		lo = _mm256_unpacklo_epi16(bg_pairs, r0_pairs);
+	__m256i		hi = _mm256_unpackhi_epi16(bg_pairs, r0_pairs);
+
+	pack_2_32bit_pixel_vectors_to_24bit_pixels_avx2(&lo, &hi, output);
+}
+
+/*
+ * Store 2 vectors of 8 32-bit pixels as 16 32-bit pixels (64 bytes).
+ *
+ * INPUT:
+ * 2 vectors of 32-bit pixels
+ * P1 P2 P3 P4		|	P5 P6 P7 P8
+ * P9 P10 P11 P12	|	P13 P14 P15 P16
+ */
+EXTERN_INLINE void	store_16_32bit_pixels_avx2(__m256i* in_2_pixel_vectors, uint8_t* output) {
+	_mm256_storeu_si256((__m256i *) output, in_2_pixel_vectors[0]);
+	_mm256_storeu_si256((__m256i *) (output + 32), in_2_pixel_vectors[1]);
+}
+
+/*
+ * Same as above, dropping the 4th byte of each pixel to store 16 24-bit
+ * pixels (48 bytes).
+ */
+EXTERN_INLINE void	store_16_32bit_pixels_as_24bit_pixels_avx2(__m256i* in_2_pixel_vectors, uint8_t* output) {
+	// P1 - P4 | P9 - P12
+	__m256i		first_pixels = _mm256_permute2x128_si256(in_2_pixel_vectors[0], in_2_pixel_vectors[1], 0x20);
+	// P5 - P8 | P13 - P16
+	__m256i		second_pixels = _mm256_permute2x128_si256(in_2_pixel_vectors[0], in_2_pixel_vectors[1], 0x31);
+
+	pack_2_32bit_pixel_vectors_to_24bit_pixels_avx2(&first_pixels, &second_pixels, output);
+}
+
+#endif	// __INTEL_CPU__
+
+#endif /* RGB_PACK_AVX2_H_ */
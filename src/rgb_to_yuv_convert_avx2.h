@@ -0,0 +1,182 @@
+/*
+ * rgb_to_yuv_convert_avx2.h
+ *
+ * Copyright (C) 2011 PixFC Team (pixelfc@gmail.com)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public  License as published by the
+ * Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef RGB_TO_YUV_CONVERT_AVX2_H_
+#define RGB_TO_YUV_CONVERT_AVX2_H_
+
+#include "debug_support.h"
+#include "platform_util.h"
+
+#ifdef __INTEL_CPU__
+
+#include <immintrin.h>
+
+/*
+ * The inlines below compute
+ *
+ * C = ( ( R * coef_r  +  G * coef_g  +  B * coef_b ) >> 8 )  +  offset
+ *
+ * from vectors of RGB pixels (R, G, B, 0 short) using PMADDWD and PHADDD.
+ * Intermediate results are exact, so the output matches that of the non-SSE
+ * integer conversion routines. Coefficients and offsets are the same as
+ * rgb_8bit_to_yuv_8bit_coef_lhs8 / rgb_8bit_to_yuv_10bit_coef_lhs8 and their
+ * offset arrays in common.c. Callers pass literal values so all coefficient
+ * vectors are built at compile time.
+ */
+
+/*
+ * Build a vector of (coef_r, coef_g, coef_b, 0) short.
+ */
+EXTERN_INLINE __m256i	rgb_pixel_coeffs_avx2(int32_t coef_r, int32_t coef_g, int32_t coef_b) {
+	return _mm256_set1_epi64x((int64_t)(
+			((uint64_t)(coef_b & 0xFFFF) << 32) | ((uint64_t)(coef_g & 0xFFFF) << 16) | (uint64_t)(coef_r & 0xFFFF)));
+}
+
+/*
+ * Convert 4 vectors of RGB pixels to 1 vector of 16 short Y
+ *
+ * Number of pixels handled:	16
+ *
+ * OUTPUT:
+ * Y1 	Y2 	Y3 	Y4 	...	Y16
+ */
+EXTERN_INLINE void	convert_rgb_pixel_vectors_to_y_vector_with_coeffs_avx2(__m256i* in_4_v16i_rgb_pixel_vectors,
+		int32_t coef_r, int32_t coef_g, int32_t coef_b, int32_t offset, __m256i* out_1_v16i_y_vector) {
+	__m256i		coeffs = rgb_pixel_coeffs_avx2(coef_r, coef_g, coef_b);
+	// Y1 Y2 Y3 Y4 | Y5 Y6 Y7 Y8
+	__m256i		y_1 = _mm256_hadd_epi32(_mm256_madd_epi16(in_4_v16i_rgb_pixel_vectors[0], coeffs), _mm256_madd_epi16(in_4_v16i_rgb_pixel_vectors[1], coeffs));
+	// Y9 Y10 Y11 Y12 | Y13 Y14 Y15 Y16
+	__m256i		y_2 = _mm256_hadd_epi32(_mm256_madd_epi16(in_4_v16i_rgb_pixel_vectors[2], coeffs), _mm256_madd_epi16(in_4_v16i_rgb_pixel_vectors[3], coeffs));
+	// Y1-4 Y9-12 | Y5-8 Y13-16
+	__m256i		y = _mm256_packs_epi32(_mm256_srai_epi32(y_1, 8), _mm256_srai_epi32(y_2, 8));
+
+	*out_1_v16i_y_vector = _mm256_permute4x64_epi64(_mm256_add_epi16(y, _mm256_set1_epi16((int16_t)offset)), 0xD8);
+}
+
+/*
+ * Convert 2 vectors of downsampled RGB pixels to 1 vector of 8 U & V pairs
+ *
+ * Number of pixels handled:	16
+ *
+ * OUTPUT:
+ * U12 	V12		U34 V34		...		U1516	V1516
+ */
+EXTERN_INLINE void	convert_downsampled_422_rgb_pixel_vectors_to_uv_vector_with_coeffs_avx2(__m256i* in_2_v16i_rgb_pixel_vectors,
+		int32_t u_coef_r, int32_t u_coef_g, int32_t u_coef_b,
+		int32_t v_coef_r, int32_t v_coef_g, int32_t v_coef_b,
+		int32_t u_offset, int32_t v_offset, __m256i* out_1_v16i_uv_vector) {
+	__m256i		u_coeffs = rgb_pixel_coeffs_avx2(u_coef_r, u_coef_g, u_coef_b);
+	__m256i		v_coeffs = rgb_pixel_coeffs_avx2(v_coef_r, v_coef_g, v_coef_b);
+	// U12 U34 V12 V34 | U56 U78 V56 V78
+	__m256i		uv_1 = _mm256_hadd_epi32(_mm256_madd_epi16(in_2_v16i_rgb_pixel_vectors[0], u_coeffs), _mm256_madd_epi16(in_2_v16i_rgb_pixel_vectors[0], v_coeffs));
+	__m256i		uv_2 = _mm256_hadd_epi32(_mm256_madd_epi16(in_2_v16i_rgb_pixel_vectors[1], u_coeffs), _mm256_madd_epi16(in_2_v16i_rgb_pixel_vectors[1], v_coeffs));
+	__m256i		uv;
+
+	// U12 V12 U34 V34 | U56 V56 U78 V78
+	uv_1 = _mm256_shuffle_epi32(_mm256_srai_epi32(uv_1, 8), 0xD8);
+	uv_2 = _mm256_shuffle_epi32(_mm256_srai_epi32(uv_2, 8), 0xD8);
+	uv = _mm256_packs_epi32(uv_1, uv_2);
+	uv = _mm256_add_epi16(uv, _mm256_set1_epi32((int32_t)(((uint32_t)v_offset << 16) | (uint32_t)(u_offset & 0xFFFF))));
+
+	*out_1_v16i_uv_vector = _mm256_permute4x64_epi64(uv, 0xD8);
+}
+
+
+/*
+ * 8-bit RGB to 8-bit Y
+ */
+EXTERN_INLINE void	convert_rgb_pixel_vectors_to_y_vector_avx2(__m256i* in_4_v16i_rgb_pixel_vectors, __m256i* out_1_v16i_y_vector) {
+	convert_rgb_pixel_vectors_to_y_vector_with_coeffs_avx2(in_4_v16i_rgb_pixel_vectors, 77, 150, 29, 0, out_1_v16i_y_vector);
+}
+
+EXTERN_INLINE void	convert_rgb_pixel_vectors_to_y_vector_bt601_avx2(__m256i* in_4_v16i_rgb_pixel_vectors, __m256i* out_1_v16i_y_vector) {
+	convert_rgb_pixel_vectors_to_y_vector_with_coeffs_avx2(in_4_v16i_rgb_pixel_vectors, 66, 129, 25, 16, out_1_v16i_y_vector);
+}
+
+EXTERN_INLINE void	convert_rgb_pixel_vectors_to_y_vector_bt709_avx2(__m256i* in_4_v16i_rgb_pixel_vectors, __m256i* out_1_v16i_y_vector) {
+	convert_rgb_pixel_vectors_to_y_vector_with_coeffs_avx2(in_4_v16i_rgb_pixel_vectors, 47, 157, 16, 16, out_1_v16i_y_vector);
+}
+
+/*
+ * 8-bit RGB to 8-bit UV
+ */
+EXTERN_INLINE void	convert_downsampled_422_rgb_pixel_vectors_to_uv_vector_avx2(__m256i* in_2_v16i_rgb_pixel_vectors, __m256i* out_1_v16i_uv_vector) {
+	convert_downsampled_422_rgb_pixel_vectors_to_uv_vector_with_coeffs_avx2(in_2_v16i_rgb_pixel_vectors,
+			-43, -85, 128,
+			128, -107, -21,
+			128, 128, out_1_v16i_uv_vector);
+}
+
+EXTERN_INLINE void	convert_downsampled_422_rgb_pixel_vectors_to_uv_vector_bt601_avx2(__m256i* in_2_v16i_rgb_pixel_vectors, __m256i* out_1_v16i_uv_vector) {
+	convert_downsampled_422_rgb_pixel_vectors_to_uv_vector_with_coeffs_avx2(in_2_v16i_rgb_pixel_vectors,
+			-38, -74, 112,
+			112, -94, -18,
+			128, 128, out_1_v16i_uv_vector);
+}
+
+EXTERN_INLINE void	convert_downsampled_422_rgb_pixel_vectors_to_uv_vector_bt709_avx2(__m256i* in_2_v16i_rgb_pixel_vectors, __m256i* out_1_v16i_uv_vector) {
+	convert_downsampled_422_rgb_pixel_vectors_to_uv_vector_with_coeffs_avx2(in_2_v16i_rgb_pixel_vectors,
+			-26, -87, 112,
+			112, -102, -10,
+			128, 128, out_1_v16i_uv_vector);
+}
+
+/*
+ * 8-bit RGB to 10-bit Y
+ */
+EXTERN_INLINE void	convert_rgb_pixel_vectors_to_10bit_y_vector_avx2(__m256i* in_4_v16i_rgb_pixel_vectors, __m256i* out_1_v16i_y_vector) {
+	convert_rgb_pixel_vectors_to_y_vector_with_coeffs_avx2(in_4_v16i_rgb_pixel_vectors, 306, 601, 117, 0, out_1_v16i_y_vector);
+}
+
+EXTERN_INLINE void	convert_rgb_pixel_vectors_to_10bit_y_vector_bt601_avx2(__m256i* in_4_v16i_rgb_pixel_vectors, __m256i* out_1_v16i_y_vector) {
+	convert_rgb_pixel_vectors_to_y_vector_with_coeffs_avx2(in_4_v16i_rgb_pixel_vectors, 263, 516, 100, 64, out_1_v16i_y_vector);
+}
+
+EXTERN_INLINE void	convert_rgb_pixel_vectors_to_10bit_y_vector_bt709_avx2(__m256i* in_4_v16i_rgb_pixel_vectors, __m256i* out_1_v16i_y_vector) {
+	convert_rgb_pixel_vectors_to_y_vector_with_coeffs_avx2(in_4_v16i_rgb_pixel_vectors, 187, 629, 63, 64, out_1_v16i_y_vector);
+}
+
+/*
+ * 8-bit RGB to 10-bit UV
+ */
+EXTERN_INLINE void	convert_downsampled_422_rgb_pixel_vectors_to_10bit_uv_vector_avx2(__m256i* in_2_v16i_rgb_pixel_vectors, __m256i* out_1_v16i_uv_vector) {
+	convert_downsampled_422_rgb_pixel_vectors_to_uv_vector_with_coeffs_avx2(in_2_v16i_rgb_pixel_vectors,
+			-173, -339, 512,
+			512, -429, -83,
+			512, 512, out_1_v16i_uv_vector);
+}
+
+EXTERN_INLINE void	convert_downsampled_422_rgb_pixel_vectors_to_10bit_uv_vector_bt601_avx2(__m256i* in_2_v16i_rgb_pixel_vectors, __m256i* out_1_v16i_uv_vector) {
+	convert_downsampled_422_rgb_pixel_vectors_to_uv_vector_with_coeffs_avx2(in_2_v16i_rgb_pixel_vectors,
+			-152, -298, 450,
+			450, -377, -73,
+			512, 512, out_1_v16i_uv_vector);
+}
+
+EXTERN_INLINE void	convert_downsampled_422_rgb_pixel_vectors_to_10bit_uv_vector_bt709_avx2(__m256i* in_2_v16i_rgb_pixel_vectors, __m256i* out_1_v16i_uv_vector) {
+	convert_downsampled_422_rgb_pixel_vectors_to_uv_vector_with_coeffs_avx2(in_2_v16i_rgb_pixel_vectors,
+			-103, -347, 450,
+			450, -409, -41,
+			512, 512, out_1_v16i_uv_vector);
+}
+
+#endif	// __INTEL_CPU__
+
+#endif /* RGB_TO_YUV_CONVERT_AVX2_H_ */
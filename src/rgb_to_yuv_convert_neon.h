@@ -0,0 +1,146 @@
+/*
+ * rgb_to_yuv_convert_neon.h
+ *
+ * Copyright (C) 2011 PixFC Team (pixelfc@gmail.com)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public  License as published by the
+ * Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef RGB_TO_YUV_CONVERT_NEON_H_
+#define RGB_TO_YUV_CONVERT_NEON_H_
+
+#include "debug_support.h"
+#include "platform_util.h"
+
+#ifdef __NEON_CPU__
+
+#include <arm_neon.h>
+
+/*
+ * The inlines below compute
+ *
+ * C = ( ( R * coef_r  +  G * coef_g  +  B * coef_b ) >> 8 )  +  offset
+ *
+ * from vectors of short R, G & B values, with 32-bit multiply-accumulates
+ * (VMULL / VMLAL) and a saturating narrowing to unsigned char. Intermediate
+ * results are exact, so the output matches that of the non-SSE integer
+ * conversion routines. Coefficients and offsets are the same as
+ * rgb_8bit_to_yuv_8bit_coef_lhs8 and rgb_8bit_to_yuv_8bit_off in common.c.
+ */
+
+/*
+ * Convert 8 R, G & B values to 8 unsigned char components
+ *
+ * TOTAL LATENCY:				~12
+ */
+EXTERN_INLINE uint8x8_t	convert_rgb_vectors_to_component_with_coeffs_neon(int16x8_t r, int16x8_t g, int16x8_t b,
+		int16_t coef_r, int16_t coef_g, int16_t coef_b, int16_t offset) {
+	int32x4_t	low = vmull_n_s16(vget_low_s16(r), coef_r);
+	int32x4_t	high = vmull_n_s16(vget_high_s16(r), coef_r);
+
+	low = vmlal_n_s16(low, vget_low_s16(g), coef_g);
+	high = vmlal_n_s16(high, vget_high_s16(g), coef_g);
+	low = vmlal_n_s16(low, vget_low_s16(b), coef_b);
+	high = vmlal_n_s16(high, vget_high_s16(b), coef_b);
+
+	return vqmovun_s16(vaddq_s16(vcombine_s16(vshrn_n_s32(low, 8), vshrn_n_s32(high, 8)), vdupq_n_s16(offset)));
+}
+
+/*
+ * Convert 3 vectors of 16 R, G & B values to 1 vector of 16 Y
+ *
+ * Number of pixels handled:	16
+ *
+ * OUTPUT:
+ * Y1 	Y2 	Y3 	Y4 	...	Y16
+ */
+EXTERN_INLINE void	convert_rgb_vectors_to_y_vector_with_coeffs_neon(uint8x16_t* in_3_v8u_rgb_vectors,
+		int16_t coef_r, int16_t coef_g, int16_t coef_b, int16_t offset, uint8x16_t* out_1_v8u_y_vector) {
+	uint8x8_t	y_low = convert_rgb_vectors_to_component_with_coeffs_neon(
+			vreinterpretq_s16_u16(vmovl_u8(vget_low_u8(in_3_v8u_rgb_vectors[0]))),
+			vreinterpretq_s16_u16(vmovl_u8(vget_low_u8(in_3_v8u_rgb_vectors[1]))),
+			vreinterpretq_s16_u16(vmovl_u8(vget_low_u8(in_3_v8u_rgb_vectors[2]))),
+			coef_r, coef_g, coef_b, offset);
+	uint8x8_t	y_high = convert_rgb_vectors_to_component_with_coeffs_neon(
+			vreinterpretq_s16_u16(vmovl_u8(vget_high_u8(in_3_v8u_rgb_vectors[0]))),
+			vreinterpretq_s16_u16(vmovl_u8(vget_high_u8(in_3_v8u_rgb_vectors[1]))),
+			vreinterpretq_s16_u16(vmovl_u8(vget_high_u8(in_3_v8u_rgb_vectors[2]))),
+			coef_r, coef_g, coef_b, offset);
+
+	*out_1_v8u_y_vector = vcombine_u8(y_low, y_high);
+}
+
+/*
+ * Convert 3 vectors of 8 downsampled R, G & B values to 2 vectors of 8 U & V
+ *
+ * Number of pixels handled:	16
+ *
+ * OUTPUT:
+ * U12 	U34 	U56 	...	U1516
+ * V12 	V34 	V56 	...	V1516
+ */
+EXTERN_INLINE void	convert_downsampled_rgb_vectors_to_uv_vectors_with_coeffs_neon(int16x8_t* in_3_v16i_rgb_vectors,
+		int16_t coef_u_r, int16_t coef_u_g, int16_t coef_u_b,
+		int16_t coef_v_r, int16_t coef_v_g, int16_t coef_v_b,
+		int16_t offset_u, int16_t offset_v, uint8x8_t* out_2_v8u_uv_vectors) {
+	out_2_v8u_uv_vectors[0] = convert_rgb_vectors_to_component_with_coeffs_neon(in_3_v16i_rgb_vectors[0], in_3_v16i_rgb_vectors[1], in_3_v16i_rgb_vectors[2],
+			coef_u_r, coef_u_g, coef_u_b, offset_u);
+	out_2_v8u_uv_vectors[1] = convert_rgb_vectors_to_component_with_coeffs_neon(in_3_v16i_rgb_vectors[0], in_3_v16i_rgb_vectors[1], in_3_v16i_rgb_vectors[2],
+			coef_v_r, coef_v_g, coef_v_b, offset_v);
+}
+
+
+/*
+ * 8-bit RGB to 8-bit Y
+ */
+EXTERN_INLINE void	convert_rgb_vectors_to_y_vector_neon(uint8x16_t* in_3_v8u_rgb_vectors, uint8x16_t* out_1_v8u_y_vector) {
+	convert_rgb_vectors_to_y_vector_with_coeffs_neon(in_3_v8u_rgb_vectors, 77, 150, 29, 0, out_1_v8u_y_vector);
+}
+
+EXTERN_INLINE void	convert_rgb_vectors_to_y_vector_bt601_neon(uint8x16_t* in_3_v8u_rgb_vectors, uint8x16_t* out_1_v8u_y_vector) {
+	convert_rgb_vectors_to_y_vector_with_coeffs_neon(in_3_v8u_rgb_vectors, 66, 129, 25, 16, out_1_v8u_y_vector);
+}
+
+EXTERN_INLINE void	convert_rgb_vectors_to_y_vector_bt709_neon(uint8x16_t* in_3_v8u_rgb_vectors, uint8x16_t* out_1_v8u_y_vector) {
+	convert_rgb_vectors_to_y_vector_with_coeffs_neon(in_3_v8u_rgb_vectors, 47, 157, 16, 16, out_1_v8u_y_vector);
+}
+
+/*
+ * 8-bit RGB to 8-bit UV
+ */
+EXTERN_INLINE void	convert_downsampled_rgb_vectors_to_uv_vectors_neon(int16x8_t* in_3_v16i_rgb_vectors, uint8x8_t* out_2_v8u_uv_vectors) {
+	convert_downsampled_rgb_vectors_to_uv_vectors_with_coeffs_neon(in_3_v16i_rgb_vectors,
+			-43, -85, 128,
+			128, -107, -21,
+			128, 128, out_2_v8u_uv_vectors);
+}
+
+EXTERN_INLINE void	convert_downsampled_rgb_vectors_to_uv_vectors_bt601_neon(int16x8_t* in_3_v16i_rgb_vectors, uint8x8_t* out_2_v8u_uv_vectors) {
+	convert_downsampled_rgb_vectors_to_uv_vectors_with_coeffs_neon(in_3_v16i_rgb_vectors,
+			-38, -74, 112,
+			112, -94, -18,
+			128, 128, out_2_v8u_uv_vectors);
+}
+
+EXTERN_INLINE void	convert_downsampled_rgb_vectors_to_uv_vectors_bt709_neon(int16x8_t* in_3_v16i_rgb_vectors, uint8x8_t* out_2_v8u_uv_vectors) {
+	convert_downsampled_rgb_vectors_to_uv_vectors_with_coeffs_neon(in_3_v16i_rgb_vectors,
+			-26, -87, 112,
+			112, -102, -10,
+			128, 128, out_2_v8u_uv_vectors);
+}
+
+#endif	// __NEON_CPU__
+
+#endif /* RGB_TO_YUV_CONVERT_NEON_H_ */
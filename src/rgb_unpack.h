@@ -47,18 +47,21 @@
  */
 
 #undef INLINE_NAME
+#undef CALL_INLINE
 #undef UNALIGNED_RGB32_INPUT_PREAMBLE
 #undef UNALIGNED_RGB24_INPUT_PREAMBLE
 #undef UNALIGNED_R210_INPUT_PREAMBLE
 #undef INPUT_VECT
 
 #if GENERATE_UNALIGNED_INLINES == 1
+	#define CALL_INLINE(fn, ...)					unaligned_ ## fn(__VA_ARGS__)
 	#define INLINE_NAME(fn_suffix, ...)				EXTERN_INLINE void unaligned_ ## fn_suffix(__VA_ARGS__)
 	#define UNALIGNED_RGB32_INPUT_PREAMBLE			DECLARE_VECT_ARRAY2_N_UNALIGN_LOAD(aligned_vector, input);
 	#define UNALIGNED_RGB24_INPUT_PREAMBLE			DECLARE_VECT_ARRAY3_N_UNALIGN_LOAD(aligned_vector, input);
 	#define UNALIGNED_R210_INPUT_PREAMBLE			DECLARE_VECT_ARRAY2_N_UNALIGN_LOAD(aligned_vector, input);
 	#define INPUT_VECT								aligned_vector
 #else
+	#define CALL_INLINE(fn, ...)					fn(__VA_ARGS__)
 	#define INLINE_NAME(fn_suffix, ...)				EXTERN_INLINE void fn_suffix(__VA_ARGS__)
 	#define UNALIGNED_RGB32_INPUT_PREAMBLE
 	#define UNALIGNED_RGB24_INPUT_PREAMBLE
@@ -317,6 +320,73 @@ INLINE_NAME(unpack_argb_to_r_g_b_vectors_sse2_ssse3, __m128i* input, __m128i* ou
 
 
 
+/*
+ * Reverse the byte order of 8 32-bit pixels in 2 vectors, turning ARGB
+ * pixels into BGRA ones and vice versa. The alpha values are kept.
+ *
+ * Total latency:				3
+ * Number of pixels handled:	8
+ *
+ * INPUT
+ * 2 vectors of 16 char
+ * A1  R1	G1  B1	A2  R2	G2  B2	A3  R3	G3  B3	A4  R4	G4  B4
+ *
+ * A5  R5	G5  B5	A6  R6	G6  B6	A7  R7	G7  B7	A8  R8	G8  B8
+ *
+ * OUTPUT:
+ *
+ * 2 vectors of 16 char
+ * B1  G1	R1  A1	B2  G2	R2  A2	B3  G3	R3  A3	B4  G4	R4  A4
+ *
+ * B5  G5	R5  A5	B6  G6	R6  A6	B7  G7	R7  A7	B8  G8	R8  A8
+ */
+INLINE_NAME(reverse_rgb32_byte_order_sse2, __m128i* input, __m128i* out_2_v8i_rgb32_vectors)
+{
+	M128I(scratch1, 0x0LL, 0x0LL);
+	UNALIGNED_RGB32_INPUT_PREAMBLE;
+
+	_M(scratch1) = _mm_or_si128(_mm_slli_epi16(INPUT_VECT[0], 8), _mm_srli_epi16(INPUT_VECT[0], 8));	// PSLLW PSRLW POR	2	1
+	// R1  A1	B1  G1	R2  A2	B2  G2	...
+
+	_M(scratch1) = _mm_shufflelo_epi16(_M(scratch1), 0xB1);								// PSHUFLW	1	0.5
+	out_2_v8i_rgb32_vectors[0] = _mm_shufflehi_epi16(_M(scratch1), 0xB1);				// PSHUFHW	1	0.5
+	// B1  G1	R1  A1	B2  G2	R2  A2	B3  G3	R3  A3	B4  G4	R4  A4
+
+	_M(scratch1) = _mm_or_si128(_mm_slli_epi16(INPUT_VECT[1], 8), _mm_srli_epi16(INPUT_VECT[1], 8));	// PSLLW PSRLW POR	2	1
+	_M(scratch1) = _mm_shufflelo_epi16(_M(scratch1), 0xB1);								// PSHUFLW	1	0.5
+	out_2_v8i_rgb32_vectors[1] = _mm_shufflehi_epi16(_M(scratch1), 0xB1);				// PSHUFHW	1	0.5
+	// B5  G5	R5  A5	B6  G6	R6  A6	B7  G7	R7  A7	B8  G8	R8  A8
+};
+
+/*
+ * Reverse the byte order of 8 32-bit pixels in 2 vectors, turning ARGB
+ * pixels into BGRA ones and vice versa. The alpha values are kept.
+ *
+ * Total latency:				1
+ * Number of pixels handled:	8
+ *
+ * INPUT / OUTPUT: see reverse_rgb32_byte_order_sse2()
+ */
+INLINE_NAME(reverse_rgb32_byte_order_sse2_ssse3, __m128i* input, __m128i* out_2_v8i_rgb32_vectors)
+{
+	CONST_M128I(shuf_reverse, 0x0405060700010203LL, 0x0C0D0E0F08090A0BLL);
+	UNALIGNED_RGB32_INPUT_PREAMBLE;
+
+	out_2_v8i_rgb32_vectors[0] = _mm_shuffle_epi8(INPUT_VECT[0], _M(shuf_reverse));		// PSHUFB	1	0.5
+	// B1  G1	R1  A1	B2  G2	R2  A2	B3  G3	R3  A3	B4  G4	R4  A4
+
+	out_2_v8i_rgb32_vectors[1] = _mm_shuffle_epi8(INPUT_VECT[1], _M(shuf_reverse));		// PSHUFB	1	0.5
+	// B5  G5	R5  A5	B6  G6	R6  A6	B7  G7	R7  A7	B8  G8	R8  A8
+};
+
+
+
+
+
+
+
+
+
 /*
  * Convert 2 vectors of 16 char BGRA to 4 vectors of 8 short GA1, BR1, GA2 & BR2
  *
@@ -1248,8 +1318,8 @@ INLINE_NAME(unpack_2_r210_to_r_g_b_vectors_sse2_ssse3, __m128i* input, __m128i*
  * B9 0		B10 0	B11 0	B12 0	B13 0	B14 0	B15 0	B16 0
  */
 INLINE_NAME(unpack_4_r210_to_r_g_b_vectors_sse2_ssse3, __m128i* input, __m128i* output) {
-	unpack_2_r210_to_r_g_b_vectors_sse2_ssse3(&input[0], &output[0]);
-	unpack_2_r210_to_r_g_b_vectors_sse2_ssse3(&input[2], &output[3]);
+	CALL_INLINE(unpack_2_r210_to_r_g_b_vectors_sse2_ssse3, &input[0], &output[0]);
+	CALL_INLINE(unpack_2_r210_to_r_g_b_vectors_sse2_ssse3, &input[2], &output[3]);
 }
 
 /*
@@ -1368,8 +1438,8 @@ INLINE_NAME(unpack_2_r10k_to_r_g_b_vectors_sse2_ssse3, __m128i* input, __m128i*
  * B9 0		B10 0	B11 0	B12 0	B13 0	B14 0	B15 0	B16 0
  */
 INLINE_NAME(unpack_4_r10k_to_r_g_b_vectors_sse2_ssse3, __m128i* input, __m128i* output) {
-	unpack_2_r10k_to_r_g_b_vectors_sse2_ssse3(&input[0], &output[0]);
-	unpack_2_r10k_to_r_g_b_vectors_sse2_ssse3(&input[2], &output[3]);
+	CALL_INLINE(unpack_2_r10k_to_r_g_b_vectors_sse2_ssse3, &input[0], &output[0]);
+	CALL_INLINE(unpack_2_r10k_to_r_g_b_vectors_sse2_ssse3, &input[2], &output[3]);
 }
 
 #endif	// __INTEL_CPU__
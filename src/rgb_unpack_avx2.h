@@ -0,0 +1,159 @@
+/*
+ * rgb_unpack_avx2.h
+ *
+ * Copyright (C) 2011 PixFC Team (pixelfc@gmail.com)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public  License as published by the
+ * Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef RGB_UNPACK_AVX2_H_
+#define RGB_UNPACK_AVX2_H_
+
+#include "debug_support.h"
+#include "platform_util.h"
+
+#ifdef __INTEL_CPU__
+
+#include <immintrin.h>
+
+/*
+ * The AVX2 inlines below unpack 16 8-bit RGB pixels to 4 vectors of
+ * 4 pixels each. Each pixel is made of 4 short (R, G, B, 0) so that
+ * a single PMADDWD + PHADDD pair computes Y, U or V for every pixel,
+ * whatever the source component order is.
+ *
+ * OUTPUT:
+ * 4 vectors of 4 pixels
+ * R1 G1 B1 0	R2 G2 B2 0		|	R5 G5 B5 0		R6 G6 B6 0
+ * R3 G3 B3 0	R4 G4 B4 0		|	R7 G7 B7 0		R8 G8 B8 0
+ * R9 G9 B9 0	R10 G10 B10 0	|	R13 G13 B13 0	R14 G14 B14 0
+ * R11 G11 B11 0	R12 G12 B12 0	|	R15 G15 B15 0	R16 G16 B16 0
+ *
+ * Only unaligned loads are used (see yuv_unpack_avx2.h).
+ */
+
+
+/*
+ * Split 2 vectors of 8 pixels (4 per lane) in 4 vectors of 4 pixels
+ * using the given shuffle masks.
+ */
+EXTERN_INLINE void	unpack_2_rgb_vectors_to_4_rgb_pixel_vectors_avx2(__m256i* in_2_rgb_vectors, __m256i* shuffle_lo, __m256i* shuffle_hi, __m256i* out_4_v16i_rgb_pixel_vectors) {
+	out_4_v16i_rgb_pixel_vectors[0] = _mm256_shuffle_epi8(in_2_rgb_vectors[0], *shuffle_lo);
+	out_4_v16i_rgb_pixel_vectors[1] = _mm256_shuffle_epi8(in_2_rgb_vectors[0], *shuffle_hi);
+	out_4_v16i_rgb_pixel_vectors[2] = _mm256_shuffle_epi8(in_2_rgb_vectors[1], *shuffle_lo);
+	out_4_v16i_rgb_pixel_vectors[3] = _mm256_shuffle_epi8(in_2_rgb_vectors[1], *shuffle_hi);
+}
+
+/*
+ * Load 16 32-bit pixels (64 bytes).
+ */
+EXTERN_INLINE void	load_16_rgb32_pixels_avx2(uint8_t* input, __m256i* out_2_rgb_vectors) {
+	out_2_rgb_vectors[0] = _mm256_loadu_si256((__m256i *) input);
+	out_2_rgb_vectors[1] = _mm256_loadu_si256((__m256i *) (input + 32));
+}
+
+/*
+ * Load 16 24-bit pixels (48 bytes), 4 pixels per lane. Pixels 5 - 8 and
+ * 13 - 16 start at byte 4 of the high lanes so we never read past the
+ * 48 input bytes.
+ */
+EXTERN_INLINE void	load_16_rgb24_pixels_avx2(uint8_t* input, __m256i* out_2_rgb_vectors) {
+	out_2_rgb_vectors[0] = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128((__m128i *) input)), _mm_loadu_si128((__m128i *) (input + 8)), 1);
+	out_2_rgb_vectors[1] = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128((__m128i *) (input + 24))), _mm_loadu_si128((__m128i *) (input + 32)), 1);
+}
+
+/*
+ * Unpack 16 ARGB pixels
+ *
+ * INPUT:
+ * 64 bytes
+ * A1 R1 G1 B1		A2 R2 G2 B2		...		A16 R16 G16 B16
+ */
+EXTERN_INLINE void	unpack_argb_to_rgb_pixel_vectors_avx2(uint8_t* input, __m256i* out_4_v16i_rgb_pixel_vectors) {
+	__m256i		shuffle_lo = _mm256_setr_epi8(
+			1, -1, 2, -1, 3, -1, -1, -1, 5, -1, 6, -1, 7, -1, -1, -1,
+			1, -1, 2, -1, 3, -1, -1, -1, 5, -1, 6, -1, 7, -1, -1, -1);
+	__m256i		shuffle_hi = _mm256_setr_epi8(
+			9, -1, 10, -1, 11, -1, -1, -1, 13, -1, 14, -1, 15, -1, -1, -1,
+			9, -1, 10, -1, 11, -1, -1, -1, 13, -1, 14, -1, 15, -1, -1, -1);
+	__m256i		in[2];
+
+	load_16_rgb32_pixels_avx2(input, in);
+	unpack_2_rgb_vectors_to_4_rgb_pixel_vectors_avx2(in, &shuffle_lo, &shuffle_hi, out_4_v16i_rgb_pixel_vectors);
+}
+
+/*
+ * Unpack 16 BGRA pixels
+ *
+ * INPUT:
+ * 64 bytes
+ * B1 G1 R1 A1		B2 G2 R2 A2		...		B16 G16 R16 A16
+ */
+EXTERN_INLINE void	unpack_bgra_to_rgb_pixel_vectors_avx2(uint8_t* input, __m256i* out_4_v16i_rgb_pixel_vectors) {
+	__m256i		shuffle_lo = _mm256_setr_epi8(
+			2, -1, 1, -1, 0, -1, -1, -1, 6, -1, 5, -1, 4, -1, -1, -1,
+			2, -1, 1, -1, 0, -1, -1, -1, 6, -1, 5, -1, 4, -1, -1, -1);
+	__m256i		shuffle_hi = _mm256_setr_epi8(
+			10, -1, 9, -1, 8, -1, -1, -1, 14, -1, 13, -1, 12, -1, -1, -1,
+			10, -1, 9, -1, 8, -1, -1, -1, 14, -1, 13, -1, 12, -1, -1, -1);
+	__m256i		in[2];
+
+	load_16_rgb32_pixels_avx2(input, in);
+	unpack_2_rgb_vectors_to_4_rgb_pixel_vectors_avx2(in, &shuffle_lo, &shuffle_hi, out_4_v16i_rgb_pixel_vectors);
+}
+
+/*
+ * Unpack 16 RGB24 pixels
+ *
+ * INPUT:
+ * 48 bytes
+ * R1 G1 B1		R2 G2 B2		...		R16 G16 B16
+ */
+EXTERN_INLINE void	unpack_rgb24_to_rgb_pixel_vectors_avx2(uint8_t* input, __m256i* out_4_v16i_rgb_pixel_vectors) {
+	__m256i		shuffle_lo = _mm256_setr_epi8(
+			0, -1, 1, -1, 2, -1, -1, -1, 3, -1, 4, -1, 5, -1, -1, -1,
+			4, -1, 5, -1, 6, -1, -1, -1, 7, -1, 8, -1, 9, -1, -1, -1);
+	__m256i		shuffle_hi = _mm256_setr_epi8(
+			6, -1, 7, -1, 8, -1, -1, -1, 9, -1, 10, -1, 11, -1, -1, -1,
+			10, -1, 11, -1, 12, -1, -1, -1, 13, -1, 14, -1, 15, -1, -1, -1);
+	__m256i		in[2];
+
+	load_16_rgb24_pixels_avx2(input, in);
+	unpack_2_rgb_vectors_to_4_rgb_pixel_vectors_avx2(in, &shuffle_lo, &shuffle_hi, out_4_v16i_rgb_pixel_vectors);
+}
+
+/*
+ * Unpack 16 BGR24 pixels
+ *
+ * INPUT:
+ * 48 bytes
+ * B1 G1 R1		B2 G2 R2		...		B16 G16 R16
+ */
+EXTERN_INLINE void	unpack_bgr24_to_rgb_pixel_vectors_avx2(uint8_t* input, __m256i* out_4_v16i_rgb_pixel_vectors) {
+	__m256i		shuffle_lo = _mm256_setr_epi8(
+			2, -1, 1, -1, 0, -1, -1, -1, 5, -1, 4, -1, 3, -1, -1, -1,
+			6, -1, 5, -1, 4, -1, -1, -1, 9, -1, 8, -1, 7, -1, -1, -1);
+	__m256i		shuffle_hi = _mm256_setr_epi8(
+			8, -1, 7, -1, 6, -1, -1, -1, 11, -1, 10, -1, 9, -1, -1, -1,
+			12, -1, 11, -1, 10, -1, -1, -1, 15, -1, 14, -1, 13, -1, -1, -1);
+	__m256i		in[2];
+
+	load_16_rgb24_pixels_avx2(input, in);
+	unpack_2_rgb_vectors_to_4_rgb_pixel_vectors_avx2(in, &shuffle_lo, &shuffle_hi, out_4_v16i_rgb_pixel_vectors);
+}
+
+#endif	// __INTEL_CPU__
+
+#endif /* RGB_UNPACK_AVX2_H_ */
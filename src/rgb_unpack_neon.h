@@ -0,0 +1,92 @@
+/*
+ * rgb_unpack_neon.h
+ *
+ * Copyright (C) 2011 PixFC Team (pixelfc@gmail.com)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public  License as published by the
+ * Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef RGB_UNPACK_NEON_H_
+#define RGB_UNPACK_NEON_H_
+
+#include "debug_support.h"
+#include "platform_util.h"
+
+#ifdef __NEON_CPU__
+
+#include <arm_neon.h>
+
+/*
+ * The NEON inlines below load 16 pixels and split them into 3 vectors of
+ * 16 unsigned char R, G & B values with a single de-interleaving load
+ * (VLD3 / VLD4), which has no alignment requirement.
+ *
+ * OUTPUT:
+ * R1	R2	R3	...	R16
+ * G1	G2	G3	...	G16
+ * B1	B2	B3	...	B16
+ */
+
+/*
+ * INPUT:
+ * 64 bytes: A1 R1 G1 B1	A2 R2 G2 B2	...	A16 R16 G16 B16
+ */
+EXTERN_INLINE void	unpack_argb_to_rgb_vectors_neon(uint8_t* in, uint8x16_t* out_3_v8u_rgb_vectors) {
+	uint8x16x4_t	argb = vld4q_u8(in);
+
+	out_3_v8u_rgb_vectors[0] = argb.val[1];
+	out_3_v8u_rgb_vectors[1] = argb.val[2];
+	out_3_v8u_rgb_vectors[2] = argb.val[3];
+}
+
+/*
+ * INPUT:
+ * 64 bytes: B1 G1 R1 A1	B2 G2 R2 A2	...	B16 G16 R16 A16
+ */
+EXTERN_INLINE void	unpack_bgra_to_rgb_vectors_neon(uint8_t* in, uint8x16_t* out_3_v8u_rgb_vectors) {
+	uint8x16x4_t	bgra = vld4q_u8(in);
+
+	out_3_v8u_rgb_vectors[0] = bgra.val[2];
+	out_3_v8u_rgb_vectors[1] = bgra.val[1];
+	out_3_v8u_rgb_vectors[2] = bgra.val[0];
+}
+
+/*
+ * INPUT:
+ * 48 bytes: R1 G1 B1	R2 G2 B2	...	R16 G16 B16
+ */
+EXTERN_INLINE void	unpack_rgb24_to_rgb_vectors_neon(uint8_t* in, uint8x16_t* out_3_v8u_rgb_vectors) {
+	uint8x16x3_t	rgb = vld3q_u8(in);
+
+	out_3_v8u_rgb_vectors[0] = rgb.val[0];
+	out_3_v8u_rgb_vectors[1] = rgb.val[1];
+	out_3_v8u_rgb_vectors[2] = rgb.val[2];
+}
+
+/*
+ * INPUT:
+ * 48 bytes: B1 G1 R1	B2 G2 R2	...	B16 G16 R16
+ */
+EXTERN_INLINE void	unpack_bgr24_to_rgb_vectors_neon(uint8_t* in, uint8x16_t* out_3_v8u_rgb_vectors) {
+	uint8x16x3_t	bgr = vld3q_u8(in);
+
+	out_3_v8u_rgb_vectors[0] = bgr.val[2];
+	out_3_v8u_rgb_vectors[1] = bgr.val[1];
+	out_3_v8u_rgb_vectors[2] = bgr.val[0];
+}
+
+#endif	// __NEON_CPU__
+
+#endif /* RGB_UNPACK_NEON_H_ */
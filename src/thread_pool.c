@@ -0,0 +1,219 @@
+/*
+ * thread_pool.c
+ *
+ * Copyright (C) 2011 PixFC Team (pixelfc@gmail.com)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public  License as published by the
+ * Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#include "debug_support.h"
+#include "thread_pool.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef WIN32
+
+#include <pthread.h>
+#include <unistd.h>
+
+struct ThreadPoolWorker {
+	struct ThreadPool *		pool;
+	uint32_t				index;
+	pthread_t				thread;
+};
+
+struct ThreadPool {
+	uint32_t				thread_count;
+	struct ThreadPoolWorker*workers;		// thread_count - 1 workers
+	uint32_t				started_workers;
+
+	// Serialises calls to run_thread_pool_jobs()
+	pthread_mutex_t			run_mutex;
+
+	// Protects all members below
+	pthread_mutex_t			mutex;
+	pthread_cond_t			start_cond;
+	pthread_cond_t			done_cond;
+	uint32_t				generation;		// incremented every time jobs are started
+	uint32_t				pending_jobs;
+	uint32_t				exit;
+	ThreadPoolJobFn			job_fn;
+	void *					job_arg;
+};
+
+
+uint32_t			get_cpu_count() {
+	long	count = sysconf(_SC_NPROCESSORS_ONLN);
+
+	return (count > 0) ? (uint32_t) count : 1;
+}
+
+static void*		thread_pool_worker(void *arg) {
+	struct ThreadPoolWorker *	worker = (struct ThreadPoolWorker *) arg;
+	struct ThreadPool *			pool = worker->pool;
+	uint32_t					seen_generation = 0;
+	ThreadPoolJobFn				job_fn;
+	void *						job_arg;
+
+	pthread_mutex_lock(&pool->mutex);
+	while (1) {
+		// Wait for new jobs
+		while ((pool->generation == seen_generation) && (! pool->exit))
+			pthread_cond_wait(&pool->start_cond, &pool->mutex);
+
+		if (pool->exit)
+			break;
+
+		seen_generation = pool->generation;
+		job_fn = pool->job_fn;
+		job_arg = pool->job_arg;
+		pthread_mutex_unlock(&pool->mutex);
+
+		job_fn(job_arg, worker->index);
+
+		pthread_mutex_lock(&pool->mutex);
+		if (--pool->pending_jobs == 0)
+			pthread_cond_signal(&pool->done_cond);
+	}
+	pthread_mutex_unlock(&pool->mutex);
+
+	return NULL;
+}
+
+struct ThreadPool*	create_thread_pool(uint32_t thread_count) {
+	struct ThreadPool *	pool;
+	uint32_t			index;
+
+	if (thread_count == 0)
+		return NULL;
+
+	pool = (struct ThreadPool *) malloc(sizeof(*pool));
+	if (! pool)
+		return NULL;
+	memset(pool, 0x0, sizeof(*pool));
+
+	pool->thread_count = thread_count;
+	pool->workers = (struct ThreadPoolWorker *) malloc(thread_count * sizeof(*pool->workers));
+	if (! pool->workers) {
+		free(pool);
+		return NULL;
+	}
+
+	pthread_mutex_init(&pool->run_mutex, NULL);
+	pthread_mutex_init(&pool->mutex, NULL);
+	pthread_cond_init(&pool->start_cond, NULL);
+	pthread_cond_init(&pool->done_cond, NULL);
+
+	// Start the worker threads. Job 0 is run by the calling thread.
+	for(index = 1; index < thread_count; index++) {
+		pool->workers[index].pool = pool;
+		pool->workers[index].index = index;
+		if (pthread_create(&pool->workers[index].thread, NULL, thread_pool_worker, &pool->workers[index]) != 0) {
+			dprint("Error starting worker thread %u\n", index);
+			destroy_thread_pool(pool);
+			return NULL;
+		}
+		pool->started_workers++;
+	}
+
+	return pool;
+}
+
+void				run_thread_pool_jobs(struct ThreadPool *pool, ThreadPoolJobFn job_fn, void *arg) {
+
+	pthread_mutex_lock(&pool->run_mutex);
+
+	// Wake up workers
+	pthread_mutex_lock(&pool->mutex);
+	pool->job_fn = job_fn;
+	pool->job_arg = arg;
+	pool->pending_jobs = pool->thread_count - 1;
+	pool->generation++;
+	pthread_cond_broadcast(&pool->start_cond);
+	pthread_mutex_unlock(&pool->mutex);
+
+	// Run our own job
+	job_fn(arg, 0);
+
+	// Wait for the workers to complete theirs
+	pthread_mutex_lock(&pool->mutex);
+	while (pool->pending_jobs != 0)
+		pthread_cond_wait(&pool->done_cond, &pool->mutex);
+	pthread_mutex_unlock(&pool->mutex);
+
+	pthread_mutex_unlock(&pool->run_mutex);
+}
+
+void				destroy_thread_pool(struct ThreadPool *pool) {
+	uint32_t	index;
+
+	if (! pool)
+		return;
+
+	pthread_mutex_lock(&pool->mutex);
+	pool->exit = 1;
+	pthread_cond_broadcast(&pool->start_cond);
+	pthread_mutex_unlock(&pool->mutex);
+
+	for(index = 1; index <= pool->started_workers; index++)
+		pthread_join(pool->workers[index].thread, NULL);
+
+	pthread_cond_destroy(&pool->done_cond);
+	pthread_cond_destroy(&pool->start_cond);
+	pthread_mutex_destroy(&pool->mutex);
+	pthread_mutex_destroy(&pool->run_mutex);
+
+	free(pool->workers);
+	free(pool);
+}
+
+#else
+
+//
+// No worker threads on Windows yet: jobs are run one after the
+// other on the calling thread.
+struct ThreadPool {
+	uint32_t				thread_count;
+};
+
+uint32_t			get_cpu_count() {
+	return 1;
+}
+
+struct ThreadPool*	create_thread_pool(uint32_t thread_count) {
+	struct ThreadPool *	pool;
+
+	if (thread_count == 0)
+		return NULL;
+
+	pool = (struct ThreadPool *) malloc(sizeof(*pool));
+	if (pool)
+		pool->thread_count = thread_count;
+
+	return pool;
+}
+
+void				run_thread_pool_jobs(struct ThreadPool *pool, ThreadPoolJobFn job_fn, void *arg) {
+	uint32_t	index;
+
+	for(index = 0; index < pool->thread_count; index++)
+		job_fn(arg, index);
+}
+
+void				destroy_thread_pool(struct ThreadPool *pool) {
+	free(pool);
+}
+
+#endif
@@ -0,0 +1,59 @@
+/*
+ * thread_pool.h
+ *
+ * Copyright (C) 2011 PixFC Team (pixelfc@gmail.com)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public  License as published by the
+ * Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef THREAD_POOL_H_
+#define THREAD_POOL_H_
+
+#include <stdint.h>
+
+// Forward declaration
+struct ThreadPool;
+
+/*
+ * Prototype for jobs run by a thread pool. 'job_index' ranges from 0 to
+ * the pool's thread count - 1.
+ */
+typedef void	(*ThreadPoolJobFn)(void *arg, uint32_t job_index);
+
+/*
+ * Return the number of online CPUs, or 1 if it cannot be determined.
+ */
+uint32_t			get_cpu_count();
+
+/*
+ * Create a pool of 'thread_count' persistent threads, including the calling
+ * thread (so only 'thread_count' - 1 worker threads are actually started).
+ * Return NULL if error.
+ */
+struct ThreadPool*	create_thread_pool(uint32_t thread_count);
+
+/*
+ * Run job_fn(arg, i) for i in [0, thread_count) concurrently, job 0 being
+ * run on the calling thread. Return when all jobs have completed.
+ * Calls from different threads on the same pool are serialised.
+ */
+void				run_thread_pool_jobs(struct ThreadPool *pool, ThreadPoolJobFn job_fn, void *arg);
+
+/*
+ * Stop the worker threads and release the pool.
+ */
+void				destroy_thread_pool(struct ThreadPool *pool);
+
+#endif /* THREAD_POOL_H_ */
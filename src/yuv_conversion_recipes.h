@@ -25,7 +25,8 @@
 
 #ifndef DEBUG
 /*
- * Include the unpack & pack routines twice to generate both aligned & unaligned versions
+ * Include the unpack & pack routines twice to generate both aligned & unaligned versions,
+ * and the pack routines a third time to generate non-temporal versions
  */
 #undef  GENERATE_UNALIGNED_INLINES
 #define GENERATE_UNALIGNED_INLINES 0
@@ -39,13 +40,28 @@
 #include "yuv_unpack.h"
 #include "yuv_pack.h"	// Used in v210 to yuv422i
 
+#undef  GENERATE_UNALIGNED_INLINES
+#define GENERATE_UNALIGNED_INLINES 0
+#define GENERATE_NON_TEMPORAL_INLINES 1
+#include "rgb_pack.h"
+#include "yuv_pack.h"	// Used in v210 to yuv422i
+#undef  GENERATE_NON_TEMPORAL_INLINES
+
 #include "yuv_repack.h"
 #include "yuv_upsample.h"
+#include "yuv_downscale.h"
 #include "yuv_to_rgb_convert.h"
 #endif
 
 #include "pixfmt_descriptions.h"
 
+/*
+ * The RGB recipes below store the output of the conversion routines in a
+ * convert_out array of 6 R, G & B vectors followed by a vector of alpha
+ * values, which the ARGB & BGRA pack routines interleave with the R, G & B
+ * values. It is set once to pixfc->alpha.
+ */
+
 /*
  * Convert YUV422 interleaved to RGB with upsampling
  *
@@ -53,7 +69,7 @@
  * Example of the expansion for a conversion to ARGB :
  *
  * 	__m128i		unpack_out[8];	// contents: 0: Y - 1: UV odd - 2: UV even - 3: Y - 4: UV odd - 5: UV even - 6: Y - 7 UV odd
- *	__m128i		convert_out[6];
+ *	__m128i		convert_out[7];
  *	__m128i*    yuyv_8pixels = (__m128i *) source_buffer;
  *	__m128i*	argb_4pixels = (__m128i *) dest_buffer;
  *	uint32_t	pixel_count = pixfc->pixel_count - 16; // handle the last 16 pixels outside the while loop
@@ -117,21 +133,23 @@
  */
 #define UPSAMPLE_YUV422I_TO_RGB_RECIPE(unpack_fn_prefix, pack_fn, conv_fn_prefix, output_stride, instr_set) \
 	__m128i		unpack_out[8];\
-	__m128i		convert_out[6];\
+	__m128i		convert_out[7];\
 	__m128i*    yuyv_8pixels;\
 	__m128i*	rgb_out_buf;\
 	uint32_t	pixel_count;\
 	uint32_t 	lines_remaining = pixfc->height;\
 	uint8_t		*next_src = (uint8_t *) source_buffer;\
 	uint8_t		*next_dst = (uint8_t *) dest_buffer;\
-	uint32_t	src_row_byte_count = ROW_SIZE(pixfc->source_fmt, pixfc->width);\
-	uint32_t	dst_row_byte_count = ROW_SIZE(pixfc->dest_fmt, pixfc->width);\
+	uint32_t	src_row_byte_count = pixfc->source_row_bytes;\
+	uint32_t	dst_row_byte_count = pixfc->dest_row_bytes;\
+	convert_out[6] = _mm_set1_epi8((char) pixfc->alpha);\
 	while(lines_remaining-- > 0) {\
 		pixel_count = pixfc->width - 16;\
 		\
 		yuyv_8pixels = (__m128i *) next_src;\
 		rgb_out_buf = (__m128i *) next_dst;\
 		\
+		PREFETCH_LINE_AHEAD(next_src, src_row_byte_count);\
 		next_src += src_row_byte_count;\
 		next_dst += dst_row_byte_count;\
 		\
@@ -175,6 +193,59 @@
 	}
 
 
+/*
+ * Convert YUV422 interleaved to RGB, downscaling the image by 'factor'
+ * (2 or 4). Each iteration unpacks 16 * factor pixels on 'factor' lines and
+ * adds them up, then averages the factor x factor blocks of pixels and
+ * converts the resulting 16 pixels.
+ */
+#define DOWNSCALE_YUV422I_TO_RGB_RECIPE(unpack_fn_prefix, pack_fn, conv_fn_prefix, output_stride, factor, instr_set) \
+	__m128i		unpack_out[2];\
+	__m128i		sums[4 * (factor)];	/* Y and UV sums of 16 * factor pixels */\
+	__m128i		downscale_out[3];\
+	__m128i		convert_out[7];\
+	__m128i*    yuyv_8pixels;\
+	__m128i*	rgb_out_buf;\
+	uint32_t	pixel_count;\
+	uint32_t	group;\
+	uint32_t	line;\
+	uint32_t 	lines_remaining = pixfc->height / (factor);\
+	uint8_t		*next_src = (uint8_t *) source_buffer;\
+	uint8_t		*next_dst = (uint8_t *) dest_buffer;\
+	uint32_t	src_row_byte_count = pixfc->source_row_bytes;\
+	uint32_t	dst_row_byte_count = pixfc->dest_row_bytes;\
+	convert_out[6] = _mm_set1_epi8((char) pixfc->alpha);\
+	while(lines_remaining-- > 0) {\
+		pixel_count = pixfc->width;\
+		\
+		yuyv_8pixels = (__m128i *) next_src;\
+		rgb_out_buf = (__m128i *) next_dst;\
+		\
+		PREFETCH_LINE_AHEAD(next_src, (factor) * src_row_byte_count);\
+		next_src += (factor) * src_row_byte_count;\
+		next_dst += dst_row_byte_count;\
+		\
+		while(pixel_count > 0) {\
+			for(group = 0; group < 2 * (factor); group++) {\
+				unpack_fn_prefix##instr_set(&yuyv_8pixels[group], &sums[2 * group]);\
+				for(line = 1; line < (factor); line++) {\
+					unpack_fn_prefix##instr_set((__m128i *) ((uint8_t *) &yuyv_8pixels[group] + line * src_row_byte_count), unpack_out);\
+					sums[2 * group] = _mm_add_epi16(sums[2 * group], unpack_out[0]);\
+					sums[2 * group + 1] = _mm_add_epi16(sums[2 * group + 1], unpack_out[1]);\
+				}\
+			}\
+			downscale_##factor##x_y_uv_sums_to_y_uv_vectors_sse2(sums, downscale_out);\
+			conv_fn_prefix##instr_set(downscale_out, convert_out);\
+			downscale_##factor##x_y_uv_sums_to_y_uv_vectors_sse2(&sums[2 * (factor)], downscale_out);\
+			conv_fn_prefix##instr_set(downscale_out, &convert_out[3]);\
+			pack_fn(convert_out, rgb_out_buf);\
+			yuyv_8pixels += 2 * (factor);\
+			rgb_out_buf += output_stride;\
+			pixel_count -= 16 * (factor);\
+		}\
+	}
+
+
 /*
  *
  * AVG upsampling V210 to RGB
@@ -399,9 +470,10 @@
 	/*	9:	Y  25 - 32					*/\
 	/*	10:	UVodd 25 - 32				*/\
 	/*	11:	UVeven 25 - 32				*/\
-	__m128i		convert_out[6];\
+	__m128i		convert_out[7];\
 	__m128i*    v210_in;\
 	__m128i*	rgb_out_buf;\
+	convert_out[6] = _mm_set1_epi8((char) pixfc->alpha);\
 	FROM_V120_48_PIX_OUTER_CONVERSION_LOOP(\
 			v210_in, rgb_out_buf,\
 			AVG_UPSAMPLE_V210_TO_RGB_PREAMBLE,\
@@ -416,6 +488,64 @@
 	)
 
 
+/*
+ * Convert v210 to RGB, downscaling the image by 'factor' (2 or 4).
+ * Each iteration unpacks 48 * factor pixels on 'factor' lines and adds
+ * them up, then averages the factor x factor blocks of pixels and
+ * converts the resulting 48 pixels. The downscaled width must be a
+ * multiple of 48 so there are no partial groups of v210 pixels.
+ */
+#define DOWNSCALE_V210_TO_RGB_RECIPE(unpack_fn_prefix, pack_fn, conv_fn_prefix, output_stride, factor, instr_set) \
+	__m128i		unpack_out[6];\
+	__m128i		sums[12 * (factor)];	/* Y and UV sums of 48 * factor pixels */\
+	__m128i		downscale_out[3];\
+	__m128i		convert_out[7];\
+	__m128i*    v210_in;\
+	__m128i*	rgb_out_buf;\
+	uint32_t	pixel_count;\
+	uint32_t	group;\
+	uint32_t	line;\
+	uint32_t	index;\
+	uint32_t 	lines_remaining = pixfc->height / (factor);\
+	uint8_t		*next_src = (uint8_t *) source_buffer;\
+	uint8_t		*next_dst = (uint8_t *) dest_buffer;\
+	uint32_t	src_row_byte_count = pixfc->source_row_bytes;\
+	uint32_t	dst_row_byte_count = pixfc->dest_row_bytes;\
+	convert_out[6] = _mm_set1_epi8((char) pixfc->alpha);\
+	while(lines_remaining-- > 0) {\
+		pixel_count = pixfc->width;\
+		\
+		v210_in = (__m128i *) next_src;\
+		rgb_out_buf = (__m128i *) next_dst;\
+		\
+		PREFETCH_LINE_AHEAD(next_src, (factor) * src_row_byte_count);\
+		next_src += (factor) * src_row_byte_count;\
+		next_dst += dst_row_byte_count;\
+		\
+		while(pixel_count > 0) {\
+			/* Each group of 4 vectors holds 24 pixels */\
+			for(group = 0; group < 2 * (factor); group++) {\
+				unpack_fn_prefix##instr_set(&v210_in[4 * group], &sums[6 * group], &sums[6 * group + 2], &sums[6 * group + 4]);\
+				for(line = 1; line < (factor); line++) {\
+					unpack_fn_prefix##instr_set((__m128i *) ((uint8_t *) &v210_in[4 * group] + line * src_row_byte_count), &unpack_out[0], &unpack_out[2], &unpack_out[4]);\
+					for(index = 0; index < 6; index++)\
+						sums[6 * group + index] = _mm_add_epi16(sums[6 * group + index], unpack_out[index]);\
+				}\
+			}\
+			for(group = 0; group < 6; group += 2) {\
+				downscale_##factor##x_y_uv_sums_to_y_uv_vectors_sse2(&sums[group * 2 * (factor)], downscale_out);\
+				conv_fn_prefix##instr_set(downscale_out, convert_out);\
+				downscale_##factor##x_y_uv_sums_to_y_uv_vectors_sse2(&sums[(group + 1) * 2 * (factor)], downscale_out);\
+				conv_fn_prefix##instr_set(downscale_out, &convert_out[3]);\
+				pack_fn(convert_out, rgb_out_buf);\
+				rgb_out_buf += output_stride;\
+			}\
+			v210_in += 8 * (factor);\
+			pixel_count -= 48 * (factor);\
+		}\
+	}
+
+
 
 /*
  *
@@ -588,7 +718,7 @@
  *   // 6: UV17-24 odd
  *   // 7: UV25-32 odd
  * 	__m128i		unpack_out[8];
- *	__m128i		convert_out[6];
+ *	__m128i		convert_out[7];
  *	__m128i*    y_plane = (__m128i *) source_buffer;
  *	__m128i*    u_plane = (uint8_t *) source_buffer + pixfc->pixel_count;
  *	__m128i*    v_plane = (uint8_t *) u_plane  + pixfc->pixel_count / 2;
@@ -743,7 +873,7 @@
 #define UPSAMPLE_YUV422P_TO_RGB_RECIPE(unpack_y_fn, unpack_lo_uv_fn, unpack_hi_uv_fn, pack_fn, conv_fn_prefix, output_stride, instr_set) \
 	uint32_t	y_row_byte_count = pixfc->width;\
 	uint32_t	uv_row_byte_count = y_row_byte_count / 2;\
-	uint32_t	dst_row_byte_count = ROW_SIZE(pixfc->dest_fmt, pixfc->width);\
+	uint32_t	dst_row_byte_count = pixfc->dest_row_bytes;\
 	uint8_t		*next_y_src = (uint8_t *) source_buffer;\
 	uint8_t		*next_u_src = next_y_src + pixfc->pixel_count;\
 	uint8_t		*next_v_src = next_u_src + pixfc->pixel_count / 2;\
@@ -751,11 +881,12 @@
 	uint32_t	pixel_count;\
 	uint32_t 	lines_remaining = pixfc->height;\
 	__m128i		unpack_out[8];\
-	__m128i		convert_out[6];\
+	__m128i		convert_out[7];\
 	__m128i*    y_plane;\
 	__m128i*    u_plane;\
 	__m128i*    v_plane;\
 	__m128i*	rgb_out;\
+	convert_out[6] = _mm_set1_epi8((char) pixfc->alpha);\
 	\
 	while(lines_remaining-- > 0) {\
 		pixel_count = pixfc->width - 32;\
@@ -765,6 +896,9 @@
 		v_plane = (__m128i *) next_v_src;\
 		rgb_out = (__m128i *) next_dst;\
 		\
+		PREFETCH_LINE_AHEAD(next_y_src, y_row_byte_count);\
+		PREFETCH_LINE_AHEAD(next_u_src, uv_row_byte_count);\
+		PREFETCH_LINE_AHEAD(next_v_src, uv_row_byte_count);\
 		next_y_src += y_row_byte_count;\
 		next_u_src += uv_row_byte_count;\
 		next_v_src += uv_row_byte_count;\
@@ -832,17 +966,19 @@
 	uint32_t	pixel_count;\
 	uint32_t 	lines_remaining = pixfc->height;\
 	__m128i		unpack_out[2];\
-	__m128i		convert_out[6];\
+	__m128i		convert_out[7];\
 	uint8_t		*next_src = (uint8_t *) source_buffer;\
 	uint8_t		*next_dst = (uint8_t *) dest_buffer;\
-	uint32_t	src_row_byte_count = ROW_SIZE(pixfc->source_fmt, pixfc->width);\
-	uint32_t	dst_row_byte_count = ROW_SIZE(pixfc->dest_fmt, pixfc->width);\
+	uint32_t	src_row_byte_count = pixfc->source_row_bytes;\
+	uint32_t	dst_row_byte_count = pixfc->dest_row_bytes;\
+	convert_out[6] = _mm_set1_epi8((char) pixfc->alpha);\
 	while(lines_remaining-- > 0) {\
 		pixel_count = pixfc->width;\
 		\
 		yuyv_8pixels = (__m128i *) next_src;\
 		rgb_out_buf = (__m128i *) next_dst;\
 		\
+		PREFETCH_LINE_AHEAD(next_src, src_row_byte_count);\
 		next_src += src_row_byte_count;\
 		next_dst += dst_row_byte_count;\
 		\
@@ -984,7 +1120,8 @@
 	__m128i*	v210_in;\
 	__m128i*	rgb_out_buf;\
 	__m128i		unpack_out[6];\
-	__m128i		convert_out[6];\
+	__m128i		convert_out[7];\
+	convert_out[6] = _mm_set1_epi8((char) pixfc->alpha);\
 	FROM_V120_48_PIX_OUTER_CONVERSION_LOOP(\
 			v210_in, rgb_out_buf,\
 			EMPTY, 							/* no preamble */\
@@ -1160,6 +1297,77 @@
 		)
 
 
+/*
+ * Convert V210 to YUV422P
+ * The outer loop points yuv_out to the current line as if the destination
+ * was an interleaved format: it is only used to find the current line index
+ * and set the Y, U and V plane pointers.
+ */
+#define V210_TO_YUV422P_LINE_START(unpack_fn_prefix, pack_fn, instr_set) \
+	line_index = (uint32_t) (((uint8_t *) yuv_out - (uint8_t *) dest_buffer) / pixfc->dest_row_bytes);\
+	y_out = (__m128i *) (y_plane + line_index * pixfc->width);\
+	u_out = u_plane + line_index * chroma_row_bytes;\
+	v_out = v_plane + line_index * chroma_row_bytes;\
+
+#define V210_TO_YUV422P_PACK_16PIX(pack_fn, in_4_y_uv_vectors) \
+	pack_fn(in_4_y_uv_vectors, y_out, u_out, v_out);\
+	y_out++;\
+	u_out += 8;\
+	v_out += 8;\
+
+#define V210_TO_YUV422P_CORE(unpack_fn_prefix, pack_fn, instr_set) \
+	unpack_fn_prefix##instr_set(v210_in, &unpack_out[0], &unpack_out[2], &unpack_out[4]);\
+	unpack_fn_prefix##instr_set(&v210_in[4], &unpack_out[6], &unpack_out[8], &unpack_out[10]);\
+	v210_in += 8;\
+	for(vector_index = 0; vector_index < 12; vector_index++)\
+		unpack_out[vector_index] = _mm_srai_epi16(unpack_out[vector_index], 2);\
+	V210_TO_YUV422P_PACK_16PIX(pack_fn, &unpack_out[0]);\
+	V210_TO_YUV422P_PACK_16PIX(pack_fn, &unpack_out[4]);\
+	V210_TO_YUV422P_PACK_16PIX(pack_fn, &unpack_out[8]);\
+
+#define V210_TO_YUV422P_CORE_LEFTOVER16(unpack_fn_prefix, pack_fn, instr_set) \
+	/* Only 16 of the 24 unpacked pixels are used */\
+	unpack_fn_prefix##instr_set(v210_in, &unpack_out[0], &unpack_out[2], &unpack_out[4]);\
+	for(vector_index = 0; vector_index < 4; vector_index++)\
+		unpack_out[vector_index] = _mm_srai_epi16(unpack_out[vector_index], 2);\
+	V210_TO_YUV422P_PACK_16PIX(pack_fn, &unpack_out[0]);\
+
+#define V210_TO_YUV422P_CORE_LEFTOVER32(unpack_fn_prefix, pack_fn, instr_set) \
+	/* Only 32 of the 48 unpacked pixels are used */\
+	unpack_fn_prefix##instr_set(v210_in, &unpack_out[0], &unpack_out[2], &unpack_out[4]);\
+	unpack_fn_prefix##instr_set(&v210_in[4], &unpack_out[6], &unpack_out[8], &unpack_out[10]);\
+	for(vector_index = 0; vector_index < 8; vector_index++)\
+		unpack_out[vector_index] = _mm_srai_epi16(unpack_out[vector_index], 2);\
+	V210_TO_YUV422P_PACK_16PIX(pack_fn, &unpack_out[0]);\
+	V210_TO_YUV422P_PACK_16PIX(pack_fn, &unpack_out[4]);\
+
+#define V210_TO_YUV422P_RECIPE(unpack_fn_prefix, pack_fn, instr_set) \
+	uint8_t*	y_plane = (uint8_t *) dest_buffer;\
+	uint8_t*	u_plane = y_plane + pixfc->pixel_count;\
+	uint8_t*	v_plane = u_plane + pixfc->pixel_count / 2;\
+	uint32_t	chroma_row_bytes = pixfc->width / 2;\
+	uint32_t	line_index;\
+	uint32_t	vector_index;\
+	__m128i*	v210_in;\
+	__m128i*	yuv_out;\
+	__m128i*	y_out;\
+	uint8_t*	u_out;\
+	uint8_t*	v_out;\
+	__m128i		unpack_out[12];\
+	FROM_V120_48_PIX_OUTER_CONVERSION_LOOP(\
+			v210_in, yuv_out, \
+			V210_TO_YUV422P_LINE_START,				/* Set the plane pointers */\
+			V210_TO_YUV422P_CORE,					/* 48 pixel core loop */\
+			V210_TO_YUV422P_CORE,					/* Last 48 pixels */\
+			EMPTY, /* There is a multiple of 16 pixels, so no leftover_8 */\
+			V210_TO_YUV422P_CORE_LEFTOVER16,		/* Last 16 pixels */\
+			EMPTY, /* There is a multiple of 16 pixels, so no leftover_24 */\
+			V210_TO_YUV422P_CORE_LEFTOVER32,		/* Last 32 pixels */\
+			EMPTY, /* There is a multiple of 16 pixels, so no leftover_40 */\
+			unpack_fn_prefix, pack_fn, instr_set\
+		)
+
+
 /*
  *
  * Convert YUV422 planar to RGB using Nearest Neighbour upsampling
@@ -1199,7 +1407,7 @@
  *	__m128i*	rgb_out = (__m128i *) dest_buffer;
  *	uint32_t	pixel_count = pixfc->pixel_count;
  *	__m128i		unpack_out[4];
- *	__m128i		convert_out[6];
+ *	__m128i		convert_out[7];
  *
  *
  *	while(pixel_count > 32) {	//
@@ -1289,7 +1497,7 @@
 #define YUV422P_TO_RGB_RECIPE(unpack_y_fn, unpack_lo_uv_fn, unpack_hi_uv_fn, pack_fn, conv_fn_prefix, output_stride, instr_set) \
 	uint32_t	y_row_byte_count = pixfc->width;\
 	uint32_t	uv_row_byte_count = y_row_byte_count / 2;\
-	uint32_t	dst_row_byte_count = ROW_SIZE(pixfc->dest_fmt, pixfc->width);\
+	uint32_t	dst_row_byte_count = pixfc->dest_row_bytes;\
 	uint8_t		*next_y_src = (uint8_t *) source_buffer;\
 	uint8_t		*next_u_src = next_y_src + pixfc->pixel_count;\
 	uint8_t		*next_v_src = next_u_src + pixfc->pixel_count / 2;\
@@ -1301,7 +1509,8 @@
 	__m128i*    v_plane;\
 	__m128i*	rgb_out;\
 	__m128i		unpack_out[4];\
-	__m128i		convert_out[6];\
+	__m128i		convert_out[7];\
+	convert_out[6] = _mm_set1_epi8((char) pixfc->alpha);\
 	while(lines_remaining-- > 0) {\
 		pixel_count = pixfc->width - 32;\
 		\
@@ -1310,6 +1519,9 @@
 		v_plane = (__m128i *) next_v_src;\
 		rgb_out = (__m128i *) next_dst;\
 		\
+		PREFETCH_LINE_AHEAD(next_y_src, y_row_byte_count);\
+		PREFETCH_LINE_AHEAD(next_u_src, uv_row_byte_count);\
+		PREFETCH_LINE_AHEAD(next_v_src, uv_row_byte_count);\
 		next_y_src += y_row_byte_count;\
 		next_u_src += uv_row_byte_count;\
 		next_v_src += uv_row_byte_count;\
@@ -1356,15 +1568,25 @@
 		__m128i*    y_plane = (__m128i *) source_buffer;\
 		__m128i*    u_plane = (__m128i*)((uint8_t *) source_buffer + pixfc->pixel_count);\
 		__m128i*    v_plane = (__m128i*)((uint8_t *) u_plane + pixfc->pixel_count / 2);\
-		__m128i*	yuv422i_out = (__m128i *) dest_buffer;\
-		uint32_t	pixel_count = pixfc->pixel_count;\
-		while(pixel_count > 0) {\
-			repack_fn##instr_set(y_plane, u_plane, v_plane, yuv422i_out);\
-			y_plane += 2;\
-			u_plane++;\
-			v_plane++;\
-			yuv422i_out += 4;\
-			pixel_count -= 32;\
+		__m128i*	yuv422i_out;\
+		uint8_t*	next_dst = (uint8_t *) dest_buffer;\
+		uint32_t	line = pixfc->height;\
+		uint32_t	pixel_count;\
+		while(line-- > 0) {\
+			PREFETCH_LINE_AHEAD(y_plane, pixfc->width);\
+			PREFETCH_LINE_AHEAD(u_plane, pixfc->width / 2);\
+			PREFETCH_LINE_AHEAD(v_plane, pixfc->width / 2);\
+			yuv422i_out = (__m128i *) next_dst;\
+			next_dst += pixfc->dest_row_bytes;\
+			pixel_count = pixfc->width;\
+			while(pixel_count > 0) {\
+				repack_fn##instr_set(y_plane, u_plane, v_plane, yuv422i_out);\
+				y_plane += 2;\
+				u_plane++;\
+				v_plane++;\
+				yuv422i_out += 4;\
+				pixel_count -= 32;\
+			}\
 		}
 
 /*
@@ -1374,19 +1596,54 @@
 		__m128i*    y_plane = (__m128i *) dest_buffer;\
 		__m128i*    u_plane = (__m128i*)((uint8_t *) dest_buffer + pixfc->pixel_count);\
 		__m128i*    v_plane = (__m128i*)((uint8_t *) u_plane + pixfc->pixel_count / 2);\
-		__m128i*	yuv422i_in = (__m128i *) source_buffer;\
-		uint32_t	pixel_count = pixfc->pixel_count;\
-		while(pixel_count > 0) {\
-			repack_fn##instr_set(yuv422i_in, y_plane, u_plane, v_plane);\
-			y_plane += 2;\
-			u_plane++;\
-			v_plane++;\
-			yuv422i_in += 4;\
-			pixel_count -= 32;\
+		__m128i*	yuv422i_in;\
+		uint8_t*	next_src = (uint8_t *) source_buffer;\
+		uint32_t	line = pixfc->height;\
+		uint32_t	pixel_count;\
+		while(line-- > 0) {\
+			yuv422i_in = (__m128i *) next_src;\
+			PREFETCH_LINE_AHEAD(next_src, pixfc->source_row_bytes);\
+			next_src += pixfc->source_row_bytes;\
+			pixel_count = pixfc->width;\
+			while(pixel_count > 0) {\
+				repack_fn##instr_set(yuv422i_in, y_plane, u_plane, v_plane);\
+				y_plane += 2;\
+				u_plane++;\
+				v_plane++;\
+				yuv422i_in += 4;\
+				pixel_count -= 32;\
+			}\
 		}
 
 
 
+/*
+ * Convert a YUV422 interleaved buffer to the other YUV422 interleaved format
+ * (YUYV to UYVY or UYVY to YUYV).
+ */
+#define YUV422I_TO_YUV422I_RECIPE(repack_fn, instr_set)	\
+		__m128i*	yuv422i_in;\
+		__m128i*	yuv422i_out;\
+		uint8_t*	next_src = (uint8_t *) source_buffer;\
+		uint8_t*	next_dst = (uint8_t *) dest_buffer;\
+		uint32_t	line = pixfc->height;\
+		uint32_t	pixel_count;\
+		while(line-- > 0) {\
+			yuv422i_in = (__m128i *) next_src;\
+			yuv422i_out = (__m128i *) next_dst;\
+			PREFETCH_LINE_AHEAD(next_src, pixfc->source_row_bytes);\
+			next_src += pixfc->source_row_bytes;\
+			next_dst += pixfc->dest_row_bytes;\
+			pixel_count = pixfc->width;\
+			while(pixel_count > 0) {\
+				repack_fn##instr_set(yuv422i_in, yuv422i_out);\
+				yuv422i_in += 4;\
+				yuv422i_out += 4;\
+				pixel_count -= 32;\
+			}\
+		}
+
+
 /*
  * Convert YUV422I to V210
  */
@@ -1477,6 +1734,97 @@
 			unpack_fn, pack_fn);
 
 
+/*
+ * Convert YUV422P / YUV420P to V210
+ * The outer loop points yuv_in to the current line as if the source was an
+ * interleaved format: it is only used to find the current line index and set
+ * the Y, U and V plane pointers at the start of each line.
+ * chroma_line_shift is 1 for YUV420P (each chroma line is used for 2 output
+ * lines) and 0 for YUV422P.
+ */
+#define YUV42XP_TO_V210_LINE_START(chroma_line_shift) \
+	line_index = (uint32_t) (((uint8_t *) yuv_in - (uint8_t *) source_buffer) / pixfc->source_row_bytes);\
+	y_in = y_plane + line_index * pixfc->width;\
+	u_in = u_plane + (line_index >> chroma_line_shift) * chroma_row_bytes;\
+	v_in = v_plane + (line_index >> chroma_line_shift) * chroma_row_bytes;\
+
+#define YUV42XP_TO_V210_UNPACK_8PIX(unpack_fn, out_2_y_uv_vectors) \
+	unpack_fn(y_in, u_in, v_in, out_2_y_uv_vectors);\
+	y_in += 8;\
+	u_in += 4;\
+	v_in += 4;\
+
+#define YUV42XP_TO_V210_CORE(unpack_fn, pack_fn, chroma_line_shift) \
+	YUV42XP_TO_V210_UNPACK_8PIX(unpack_fn, &unpack_out[0]);\
+	YUV42XP_TO_V210_UNPACK_8PIX(unpack_fn, &unpack_out[2]);\
+	YUV42XP_TO_V210_UNPACK_8PIX(unpack_fn, &unpack_out[4]);\
+	unpack_out[0] = _mm_slli_epi16(unpack_out[0], 2);\
+	unpack_out[1] = _mm_slli_epi16(unpack_out[1], 2);\
+	unpack_out[2] = _mm_slli_epi16(unpack_out[2], 2);\
+	unpack_out[3] = _mm_slli_epi16(unpack_out[3], 2);\
+	unpack_out[4] = _mm_slli_epi16(unpack_out[4], 2);\
+	unpack_out[5] = _mm_slli_epi16(unpack_out[5], 2);\
+	pack_fn(unpack_out, v210_out);\
+	v210_out += 4;\
+
+#define YUV42XP_TO_V210_8PIX_LEFTOVER(unpack_fn, pack_fn, chroma_line_shift) \
+	YUV42XP_TO_V210_UNPACK_8PIX(unpack_fn, &unpack_out[0]);\
+	unpack_out[0] = _mm_slli_epi16(unpack_out[0], 2);\
+	unpack_out[1] = _mm_slli_epi16(unpack_out[1], 2);\
+	unpack_out[2] = _mm_setzero_si128();\
+	unpack_out[3] = _mm_setzero_si128();\
+	unpack_out[4] = _mm_setzero_si128();\
+	unpack_out[5] = _mm_setzero_si128();\
+	pack_fn(unpack_out, v210_out);\
+	v210_out += 4;\
+
+#define YUV42XP_TO_V210_16PIX_LEFTOVER(unpack_fn, pack_fn, chroma_line_shift) \
+	YUV42XP_TO_V210_UNPACK_8PIX(unpack_fn, &unpack_out[0]);\
+	YUV42XP_TO_V210_UNPACK_8PIX(unpack_fn, &unpack_out[2]);\
+	unpack_out[0] = _mm_slli_epi16(unpack_out[0], 2);\
+	unpack_out[1] = _mm_slli_epi16(unpack_out[1], 2);\
+	unpack_out[2] = _mm_slli_epi16(unpack_out[2], 2);\
+	unpack_out[3] = _mm_slli_epi16(unpack_out[3], 2);\
+	unpack_out[4] = _mm_setzero_si128();\
+	unpack_out[5] = _mm_setzero_si128();\
+	pack_fn(unpack_out, v210_out);\
+	v210_out += 4;\
+
+#define YUV42XP_TO_V210_FIRST_CORE(unpack_fn, pack_fn, chroma_line_shift) \
+	YUV42XP_TO_V210_LINE_START(chroma_line_shift)\
+	YUV42XP_TO_V210_CORE(unpack_fn, pack_fn, chroma_line_shift)
+
+#define YUV42XP_TO_V210_FIRST_8PIX_LEFTOVER(unpack_fn, pack_fn, chroma_line_shift) \
+	YUV42XP_TO_V210_LINE_START(chroma_line_shift)\
+	YUV42XP_TO_V210_8PIX_LEFTOVER(unpack_fn, pack_fn, chroma_line_shift)
+
+#define YUV42XP_TO_V210_FIRST_16PIX_LEFTOVER(unpack_fn, pack_fn, chroma_line_shift) \
+	YUV42XP_TO_V210_LINE_START(chroma_line_shift)\
+	YUV42XP_TO_V210_16PIX_LEFTOVER(unpack_fn, pack_fn, chroma_line_shift)
+
+#define YUV42XP_TO_V210_RECIPE(unpack_fn, pack_fn, chroma_line_shift) \
+	uint8_t*	y_plane = (uint8_t *) source_buffer;\
+	uint8_t*	u_plane = y_plane + pixfc->pixel_count;\
+	uint8_t*	v_plane = u_plane + (pixfc->pixel_count / 2 >> (chroma_line_shift));\
+	uint32_t	chroma_row_bytes = pixfc->width / 2;\
+	uint32_t	line_index;\
+	uint8_t*	y_in;\
+	uint8_t*	u_in;\
+	uint8_t*	v_in;\
+	__m128i*	yuv_in;\
+	__m128i*	v210_out;\
+	__m128i		unpack_out[6];\
+	TO_V120_24_PIX_OUTER_CONVERSION_LOOP(\
+			yuv_in, v210_out,\
+			YUV42XP_TO_V210_FIRST_CORE,				/* loop core for first 24 pixels */\
+			YUV42XP_TO_V210_CORE,					/* loop core for remainder groups of 24 pixels */\
+			YUV42XP_TO_V210_FIRST_8PIX_LEFTOVER,	/* loop core for width = 8 pixels */\
+			YUV42XP_TO_V210_8PIX_LEFTOVER,			/* loop core for last 8 pixels */\
+			YUV42XP_TO_V210_FIRST_16PIX_LEFTOVER,	/* loop core if width = 16 pixels */\
+			YUV42XP_TO_V210_16PIX_LEFTOVER,			/* loop core for last 16 pixels */\
+			unpack_fn, pack_fn, chroma_line_shift);
+
+
 
 
 /*
@@ -1486,17 +1834,22 @@
  */
 #define YUV420P_TO_RGB_RECIPE(unpack_y_fn, unpack_lo_uv_fn, unpack_hi_uv_fn, pack_fn, conv_fn_prefix, output_stride, instr_set) \
  	__m128i		unpack_out[4];\
-	__m128i		convert_out[6];\
+	__m128i		convert_out[7];\
 	__m128i*    y_line1 = (__m128i *) source_buffer;\
 	__m128i*    y_line2 = (__m128i*)((uint8_t *) y_line1 + pixfc->width);\
 	__m128i*    u_plane = (__m128i*)((uint8_t *) source_buffer + pixfc->pixel_count);\
 	__m128i*    v_plane = (__m128i*)((uint8_t *) u_plane  + pixfc->pixel_count / 4);\
 	__m128i*	rgb_out_line1 = (__m128i *) dest_buffer;\
-	__m128i*	rgb_out_line2 = (__m128i *) ((uint8_t *)rgb_out_line1 + output_stride * pixfc->width);\
+	__m128i*	rgb_out_line2 = (__m128i *) ((uint8_t *)rgb_out_line1 + pixfc->dest_row_bytes);\
 	uint32_t	pixels_remaining_on_line = pixfc->width;\
 	uint32_t	lines_remaining = pixfc->height;\
 	int i;\
+	convert_out[6] = _mm_set1_epi8((char) pixfc->alpha);\
 	while(lines_remaining > 0) {\
+		PREFETCH_LINE_AHEAD(y_line1, pixfc->width);\
+		PREFETCH_LINE_AHEAD(y_line2, pixfc->width);\
+		PREFETCH_LINE_AHEAD(u_plane, pixfc->width / 2);\
+		PREFETCH_LINE_AHEAD(v_plane, pixfc->width / 2);\
 		while(pixels_remaining_on_line > 0) {\
 			unpack_y_fn(y_line1, unpack_out, &unpack_out[2]);\
 			print_xmm8u("l1 Y 1 - 8:", unpack_out);\
@@ -1574,10 +1927,514 @@
 		}\
 		y_line1 = (__m128i*)((uint8_t *) y_line1 + pixfc->width);\
 		y_line2 = (__m128i*)((uint8_t *) y_line2 + pixfc->width);\
-		rgb_out_line1 = (__m128i *) ((uint8_t *)rgb_out_line1 + output_stride * pixfc->width);\
-		rgb_out_line2 = (__m128i *) ((uint8_t *)rgb_out_line2 + output_stride * pixfc->width);\
+		rgb_out_line1 = (__m128i *) ((uint8_t *)rgb_out_line1 + 2 * pixfc->dest_row_bytes - output_stride * pixfc->width);\
+		rgb_out_line2 = (__m128i *) ((uint8_t *)rgb_out_line2 + 2 * pixfc->dest_row_bytes - output_stride * pixfc->width);\
 		lines_remaining -=2;\
 		pixels_remaining_on_line = pixfc->width;\
 	}\
 
+
+/*
+ *
+ * YUV420 to RGB with chroma interpolation
+ *
+ * Same as UPSAMPLE_YUV422P_TO_RGB_RECIPE, except that the 16 U and V samples
+ * are first averaged with the ones in the next chroma line on odd lines (the
+ * last line reuses the last chroma line). The missing chroma values are then
+ * reconstructed horizontally from the averaged samples.
+ */
+#define AVERAGE_YUV420P_CHROMA_LINES(u_plane, v_plane, chroma_line_offset, u_avg, v_avg) \
+	u_avg = _mm_avg_epu8(_mm_loadu_si128(u_plane), _mm_loadu_si128((__m128i *) ((uint8_t *) (u_plane) + (chroma_line_offset))));\
+	v_avg = _mm_avg_epu8(_mm_loadu_si128(v_plane), _mm_loadu_si128((__m128i *) ((uint8_t *) (v_plane) + (chroma_line_offset))));
+
+#define UPSAMPLE_YUV420P_TO_RGB_RECIPE(unpack_y_fn, unpack_lo_uv_fn, unpack_hi_uv_fn, pack_fn, conv_fn_prefix, output_stride, instr_set) \
+	uint32_t	y_row_byte_count = pixfc->width;\
+	uint32_t	uv_row_byte_count = y_row_byte_count / 2;\
+	uint32_t	dst_row_byte_count = pixfc->dest_row_bytes;\
+	uint8_t		*next_y_src = (uint8_t *) source_buffer;\
+	uint8_t		*u_lines = next_y_src + pixfc->pixel_count;\
+	uint8_t		*v_lines = u_lines + pixfc->pixel_count / 4;\
+	uint8_t		*next_dst = (uint8_t *) dest_buffer;\
+	uint32_t	chroma_line_offset;\
+	uint32_t	pixel_count;\
+	uint32_t 	line;\
+	__m128i		unpack_out[8];\
+	__m128i		convert_out[7];\
+	__m128i		u_avg;\
+	__m128i		v_avg;\
+	__m128i*    y_plane;\
+	__m128i*    u_plane;\
+	__m128i*    v_plane;\
+	__m128i*	rgb_out;\
+	convert_out[6] = _mm_set1_epi8((char) pixfc->alpha);\
+	\
+	for(line = 0; line < pixfc->height; line++) {\
+		pixel_count = pixfc->width - 32;\
+		\
+		y_plane = (__m128i *) next_y_src;\
+		u_plane = (__m128i *) (u_lines + (line / 2) * uv_row_byte_count);\
+		v_plane = (__m128i *) (v_lines + (line / 2) * uv_row_byte_count);\
+		chroma_line_offset = (((line & 1) != 0) && (line + 1 < pixfc->height)) ? uv_row_byte_count : 0;\
+		rgb_out = (__m128i *) next_dst;\
+		\
+		PREFETCH_LINE_AHEAD(next_y_src, y_row_byte_count);\
+		PREFETCH_LINE_AHEAD(u_plane, uv_row_byte_count);\
+		PREFETCH_LINE_AHEAD(v_plane, uv_row_byte_count);\
+		next_y_src += y_row_byte_count;\
+		next_dst += dst_row_byte_count;\
+		\
+		AVERAGE_YUV420P_CHROMA_LINES(u_plane, v_plane, chroma_line_offset, u_avg, v_avg);\
+		unpack_lo_uv_fn(&u_avg, &v_avg, &unpack_out[1], &unpack_out[4]);\
+		while(pixel_count > 0) {\
+			unpack_y_fn(y_plane, unpack_out, &unpack_out[3]);\
+			unpack_hi_uv_fn(&u_avg, &v_avg, &unpack_out[6], &unpack_out[7]);\
+			reconstruct_missing_uv_##instr_set(&unpack_out[1], &unpack_out[4], &unpack_out[2]);\
+			conv_fn_prefix##instr_set(unpack_out, convert_out);\
+			reconstruct_missing_uv_##instr_set(&unpack_out[4], &unpack_out[6], &unpack_out[5]);\
+			conv_fn_prefix##instr_set(&unpack_out[3], &convert_out[3]);\
+			pack_fn(convert_out, rgb_out);\
+			y_plane++;\
+			rgb_out += output_stride;\
+			unpack_y_fn(y_plane, unpack_out, &unpack_out[3]);\
+			unpack_out[1] = _mm_load_si128(&unpack_out[6]);\
+			unpack_out[4] = _mm_load_si128(&unpack_out[7]);\
+			AVERAGE_YUV420P_CHROMA_LINES(&u_plane[1], &v_plane[1], chroma_line_offset, u_avg, v_avg);\
+			unpack_lo_uv_fn(&u_avg, &v_avg, &unpack_out[6], &unpack_out[7]);\
+			reconstruct_missing_uv_##instr_set(&unpack_out[1], &unpack_out[4], &unpack_out[2]);\
+			conv_fn_prefix##instr_set(unpack_out, convert_out);\
+			reconstruct_missing_uv_##instr_set(&unpack_out[4], &unpack_out[6], &unpack_out[5]);\
+			conv_fn_prefix##instr_set(&unpack_out[3], &convert_out[3]);\
+			pack_fn(convert_out, rgb_out);\
+			y_plane++;\
+			u_plane++;\
+			v_plane++;\
+			rgb_out += output_stride;\
+			pixel_count -= 32;\
+			unpack_out[1] = _mm_load_si128(&unpack_out[6]);\
+			unpack_out[4] = _mm_load_si128(&unpack_out[7]);\
+		}\
+		unpack_y_fn(y_plane, unpack_out, &unpack_out[3]);\
+		unpack_hi_uv_fn(&u_avg, &v_avg, &unpack_out[6], &unpack_out[7]);\
+		reconstruct_missing_uv_##instr_set(&unpack_out[1], &unpack_out[4], &unpack_out[2]);\
+		conv_fn_prefix##instr_set(unpack_out, convert_out);\
+		reconstruct_missing_uv_##instr_set(&unpack_out[4], &unpack_out[6], &unpack_out[5]);\
+		conv_fn_prefix##instr_set(&unpack_out[3], &convert_out[3]);\
+		pack_fn(convert_out, rgb_out);\
+		y_plane++;\
+		rgb_out += output_stride;\
+		unpack_y_fn(y_plane, unpack_out, &unpack_out[3]);\
+		unpack_out[1] = _mm_load_si128(&unpack_out[6]);\
+		unpack_out[4] = _mm_load_si128(&unpack_out[7]);\
+		reconstruct_missing_uv_##instr_set(&unpack_out[1], &unpack_out[4], &unpack_out[2]);\
+		conv_fn_prefix##instr_set(unpack_out, convert_out);\
+		reconstruct_last_missing_uv_##instr_set(&unpack_out[4], &unpack_out[5]);\
+		conv_fn_prefix##instr_set(&unpack_out[3], &convert_out[3]);\
+		pack_fn(convert_out, rgb_out);\
+	}
+
+
+/*
+ *
+ * NV12 / NV21 to RGB
+ *
+ * The chroma plane holds interleaved UV (or VU) pairs, each shared by 2x2 pixels.
+ * unpack_uv_fn turns one 16-byte chroma vector (16 pixels) into 2 UV vectors.
+ */
+#define NV12_TO_RGB_RECIPE(unpack_y_fn, unpack_uv_fn, pack_fn, conv_fn_prefix, output_stride, instr_set) \
+ 	__m128i		unpack_out[4];\
+	__m128i		convert_out[7];\
+	__m128i*    y_line1 = (__m128i *) source_buffer;\
+	__m128i*    y_line2 = (__m128i*)((uint8_t *) y_line1 + pixfc->width);\
+	__m128i*    uv_plane = (__m128i*)((uint8_t *) source_buffer + pixfc->pixel_count);\
+	__m128i*	rgb_out_line1 = (__m128i *) dest_buffer;\
+	__m128i*	rgb_out_line2 = (__m128i *) ((uint8_t *)rgb_out_line1 + pixfc->dest_row_bytes);\
+	uint32_t	pixels_remaining_on_line = pixfc->width;\
+	uint32_t	lines_remaining = pixfc->height;\
+	convert_out[6] = _mm_set1_epi8((char) pixfc->alpha);\
+	while(lines_remaining > 0) {\
+		PREFETCH_LINE_AHEAD(y_line1, pixfc->width);\
+		PREFETCH_LINE_AHEAD(y_line2, pixfc->width);\
+		PREFETCH_LINE_AHEAD(uv_plane, pixfc->width);\
+		while(pixels_remaining_on_line > 0) {\
+			unpack_y_fn(y_line1, unpack_out, &unpack_out[2]);\
+			y_line1++;\
+			unpack_uv_fn(uv_plane, &unpack_out[1], &unpack_out[3]);\
+			uv_plane++;\
+			conv_fn_prefix##instr_set(unpack_out, convert_out);\
+			conv_fn_prefix##instr_set(&unpack_out[2], &convert_out[3]);\
+			pack_fn(convert_out, rgb_out_line1);\
+			rgb_out_line1 += output_stride;\
+			unpack_y_fn(y_line2, unpack_out, &unpack_out[2]);\
+			y_line2++;\
+			conv_fn_prefix##instr_set(unpack_out, convert_out);\
+			conv_fn_prefix##instr_set(&unpack_out[2], &convert_out[3]);\
+			pack_fn(convert_out, rgb_out_line2);\
+			rgb_out_line2 += output_stride;\
+			pixels_remaining_on_line -= 16;\
+		}\
+		y_line1 = (__m128i*)((uint8_t *) y_line1 + pixfc->width);\
+		y_line2 = (__m128i*)((uint8_t *) y_line2 + pixfc->width);\
+		rgb_out_line1 = (__m128i *) ((uint8_t *)rgb_out_line1 + 2 * pixfc->dest_row_bytes - output_stride * pixfc->width);\
+		rgb_out_line2 = (__m128i *) ((uint8_t *)rgb_out_line2 + 2 * pixfc->dest_row_bytes - output_stride * pixfc->width);\
+		lines_remaining -=2;\
+		pixels_remaining_on_line = pixfc->width;\
+	}\
+
+
+/*
+ * Convert an NV12 / NV21 buffer to YUV422 interleaved.
+ * Each chroma line is used for 2 output lines.
+ */
+#define NV12_TO_YUV422I_RECIPE(repack_fn, instr_set)	\
+		__m128i*    y_plane = (__m128i *) source_buffer;\
+		__m128i*    uv_line = (__m128i*)((uint8_t *) source_buffer + pixfc->pixel_count);\
+		__m128i*    uv_plane;\
+		__m128i*	yuv422i_out;\
+		uint8_t*	next_dst = (uint8_t *) dest_buffer;\
+		uint32_t	line = pixfc->height;\
+		uint32_t	pixel_count;\
+		while(line-- > 0) {\
+			PREFETCH_LINE_AHEAD(y_plane, pixfc->width);\
+			uv_plane = uv_line;\
+			yuv422i_out = (__m128i *) next_dst;\
+			next_dst += pixfc->dest_row_bytes;\
+			pixel_count = pixfc->width;\
+			while(pixel_count > 0) {\
+				repack_fn##instr_set(y_plane, uv_plane, yuv422i_out);\
+				y_plane += 2;\
+				uv_plane += 2;\
+				yuv422i_out += 4;\
+				pixel_count -= 32;\
+			}\
+			if ((line & 1) == 0)\
+				uv_line = uv_plane;\
+		}
+
+/*
+ * Convert a YUV422 interleaved buffer to NV12 / NV21.
+ * Chroma samples from each pair of lines are averaged.
+ */
+#define YUV422I_TO_NV12_RECIPE(repack_fn, instr_set)	\
+		__m128i*    y_line1 = (__m128i *) dest_buffer;\
+		__m128i*    y_line2;\
+		__m128i*    uv_plane = (__m128i*)((uint8_t *) dest_buffer + pixfc->pixel_count);\
+		__m128i*	yuv422i_line1;\
+		__m128i*	yuv422i_line2;\
+		uint8_t*	next_src = (uint8_t *) source_buffer;\
+		uint32_t	line = pixfc->height / 2;\
+		uint32_t	pixel_count;\
+		while(line-- > 0) {\
+			yuv422i_line1 = (__m128i *) next_src;\
+			yuv422i_line2 = (__m128i *) (next_src + pixfc->source_row_bytes);\
+			y_line2 = (__m128i *) ((uint8_t *) y_line1 + pixfc->width);\
+			PREFETCH_LINE_AHEAD(next_src, 2 * pixfc->source_row_bytes);\
+			next_src += 2 * pixfc->source_row_bytes;\
+			pixel_count = pixfc->width;\
+			while(pixel_count > 0) {\
+				repack_fn##instr_set(yuv422i_line1, yuv422i_line2, y_line1, y_line2, uv_plane);\
+				y_line1 += 2;\
+				y_line2 += 2;\
+				uv_plane += 2;\
+				yuv422i_line1 += 4;\
+				yuv422i_line2 += 4;\
+				pixel_count -= 32;\
+			}\
+			y_line1 = y_line2;\
+		}
+
+
+/*
+ * Convert a YUV422 interleaved buffer to YUV420 planar, 2 lines at a time.
+ * Whether chroma samples from each pair of lines are averaged or taken from
+ * the first line is up to repack_fn.
+ */
+#define YUV422I_TO_YUV420P_RECIPE(repack_fn, instr_set)	\
+		__m128i*    y_line1 = (__m128i *) dest_buffer;\
+		__m128i*    y_line2;\
+		__m128i*    u_plane = (__m128i*)((uint8_t *) dest_buffer + pixfc->pixel_count);\
+		__m128i*    v_plane = (__m128i*)((uint8_t *) u_plane + pixfc->pixel_count / 4);\
+		__m128i*	yuv422i_line1;\
+		__m128i*	yuv422i_line2;\
+		uint8_t*	next_src = (uint8_t *) source_buffer;\
+		uint32_t	line = pixfc->height / 2;\
+		uint32_t	pixel_count;\
+		while(line-- > 0) {\
+			yuv422i_line1 = (__m128i *) next_src;\
+			yuv422i_line2 = (__m128i *) (next_src + pixfc->source_row_bytes);\
+			y_line2 = (__m128i *) ((uint8_t *) y_line1 + pixfc->width);\
+			PREFETCH_LINE_AHEAD(next_src, 2 * pixfc->source_row_bytes);\
+			next_src += 2 * pixfc->source_row_bytes;\
+			pixel_count = pixfc->width;\
+			while(pixel_count > 0) {\
+				repack_fn##instr_set(yuv422i_line1, yuv422i_line2, y_line1, y_line2, u_plane, v_plane);\
+				y_line1 += 2;\
+				y_line2 += 2;\
+				u_plane++;\
+				v_plane++;\
+				yuv422i_line1 += 4;\
+				yuv422i_line2 += 4;\
+				pixel_count -= 32;\
+			}\
+			y_line1 = y_line2;\
+		}
+
+/*
+ * Convert a YUV420 planar buffer to YUV422 interleaved, using a YUV422P to
+ * YUV422I repack_fn. Each chroma line is used for 2 output lines. If
+ * interpolate is set, chroma samples on odd lines are the average of the
+ * chroma lines above and below (the last line reuses the last chroma line).
+ */
+#define YUV420P_TO_YUV422I_RECIPE(repack_fn, interpolate, instr_set)	\
+		__m128i*    y_plane = (__m128i *) source_buffer;\
+		uint8_t*    u_lines = (uint8_t *) source_buffer + pixfc->pixel_count;\
+		uint8_t*    v_lines = u_lines + pixfc->pixel_count / 4;\
+		__m128i*    u_plane;\
+		__m128i*    v_plane;\
+		__m128i*    next_u_plane;\
+		__m128i*    next_v_plane;\
+		__m128i		u_avg;\
+		__m128i		v_avg;\
+		__m128i*	yuv422i_out;\
+		uint8_t*	next_dst = (uint8_t *) dest_buffer;\
+		uint32_t	chroma_row_bytes = pixfc->width / 2;\
+		uint32_t	line = 0;\
+		uint32_t	pixel_count;\
+		while(line < pixfc->height) {\
+			PREFETCH_LINE_AHEAD(y_plane, pixfc->width);\
+			u_plane = (__m128i *) (u_lines + (line / 2) * chroma_row_bytes);\
+			v_plane = (__m128i *) (v_lines + (line / 2) * chroma_row_bytes);\
+			yuv422i_out = (__m128i *) next_dst;\
+			next_dst += pixfc->dest_row_bytes;\
+			pixel_count = pixfc->width;\
+			if ((interpolate) && ((line & 1) != 0) && (line + 1 < pixfc->height)) {\
+				next_u_plane = (__m128i *) ((uint8_t *) u_plane + chroma_row_bytes);\
+				next_v_plane = (__m128i *) ((uint8_t *) v_plane + chroma_row_bytes);\
+				while(pixel_count > 0) {\
+					u_avg = _mm_avg_epu8(_mm_loadu_si128(u_plane), _mm_loadu_si128(next_u_plane));\
+					v_avg = _mm_avg_epu8(_mm_loadu_si128(v_plane), _mm_loadu_si128(next_v_plane));\
+					repack_fn##instr_set(y_plane, &u_avg, &v_avg, yuv422i_out);\
+					y_plane += 2;\
+					u_plane++;\
+					v_plane++;\
+					next_u_plane++;\
+					next_v_plane++;\
+					yuv422i_out += 4;\
+					pixel_count -= 32;\
+				}\
+			} else {\
+				while(pixel_count > 0) {\
+					repack_fn##instr_set(y_plane, u_plane, v_plane, yuv422i_out);\
+					y_plane += 2;\
+					u_plane++;\
+					v_plane++;\
+					yuv422i_out += 4;\
+					pixel_count -= 32;\
+				}\
+			}\
+			line++;\
+		}
+
+
+/*
+ * Convert a YUV420 planar buffer to NV12 / NV21.
+ * The Y plane is copied as is, the U and V planes are interleaved into the
+ * chroma plane in the order given by first_plane and second_plane.
+ */
+#define YUV420P_TO_NV12_RECIPE(repack_fn, first_plane, second_plane, instr_set)	\
+		__m128i*    u_plane = (__m128i*)((uint8_t *) source_buffer + pixfc->pixel_count);\
+		__m128i*    v_plane = (__m128i*)((uint8_t *) u_plane + pixfc->pixel_count / 4);\
+		__m128i*	uv_out = (__m128i*)((uint8_t *) dest_buffer + pixfc->pixel_count);\
+		uint32_t	chroma_count = pixfc->pixel_count / 4;\
+		memcpy(dest_buffer, source_buffer, pixfc->pixel_count);\
+		while(chroma_count > 0) {\
+			repack_fn##instr_set(first_plane, second_plane, uv_out);\
+			u_plane++;\
+			v_plane++;\
+			uv_out += 2;\
+			chroma_count -= 16;\
+		}
+
+/*
+ * Convert an NV12 / NV21 buffer to YUV420 planar.
+ * The Y plane is copied as is, the chroma plane is split into the planes given
+ * by first_plane and second_plane.
+ */
+#define NV12_TO_YUV420P_RECIPE(repack_fn, first_plane, second_plane, instr_set)	\
+		__m128i*    u_plane = (__m128i*)((uint8_t *) dest_buffer + pixfc->pixel_count);\
+		__m128i*    v_plane = (__m128i*)((uint8_t *) u_plane + pixfc->pixel_count / 4);\
+		__m128i*	uv_in = (__m128i*)((uint8_t *) source_buffer + pixfc->pixel_count);\
+		uint32_t	chroma_count = pixfc->pixel_count / 4;\
+		memcpy(dest_buffer, source_buffer, pixfc->pixel_count);\
+		while(chroma_count > 0) {\
+			repack_fn##instr_set(uv_in, first_plane, second_plane);\
+			u_plane++;\
+			v_plane++;\
+			uv_in += 2;\
+			chroma_count -= 16;\
+		}
+
+
+/*
+ *
+ * P010 / P210
+ *
+ */
+/*
+ * Convert a P010 / P210 buffer to RGB, 16 pixels at a time.
+ * chroma_line_shift is 1 for P010 (each chroma line is used for 2 output
+ * lines) and 0 for P210.
+ */
+#define P210_TO_RGB_RECIPE(unpack_fn, pack_fn, conv_fn_prefix, output_stride, chroma_line_shift, instr_set) \
+	__m128i		unpack_out[4];\
+	__m128i		convert_out[7];\
+	__m128i*    y_plane = (__m128i *) source_buffer;\
+	uint8_t*    uv_plane = (uint8_t *) source_buffer + pixfc->pixel_count * 2;\
+	__m128i*    uv_line;\
+	__m128i*	rgb_out;\
+	uint8_t*	next_dst = (uint8_t *) dest_buffer;\
+	uint32_t	line = 0;\
+	uint32_t	pixel_count;\
+	convert_out[6] = _mm_set1_epi8((char) pixfc->alpha);\
+	while(line < pixfc->height) {\
+		PREFETCH_LINE_AHEAD(y_plane, pixfc->width * 2);\
+		uv_line = (__m128i *) (uv_plane + (line >> chroma_line_shift) * pixfc->width * 2);\
+		rgb_out = (__m128i *) next_dst;\
+		next_dst += pixfc->dest_row_bytes;\
+		pixel_count = pixfc->width;\
+		while(pixel_count > 0) {\
+			unpack_fn(y_plane, uv_line, unpack_out);\
+			unpack_fn(&y_plane[1], &uv_line[1], &unpack_out[2]);\
+			y_plane += 2;\
+			uv_line += 2;\
+			conv_fn_prefix##instr_set(unpack_out, convert_out);\
+			conv_fn_prefix##instr_set(&unpack_out[2], &convert_out[3]);\
+			pack_fn(convert_out, rgb_out);\
+			rgb_out += output_stride;\
+			pixel_count -= 16;\
+		}\
+		line++;\
+	}
+
+/*
+ * Convert a P010 / P210 buffer to v210, 24 pixels at a time.
+ * The last 8 or 16 pixels of a line are padded with zeros up to 24 pixels,
+ * which is fine since v210 lines are a multiple of 48 pixels long.
+ */
+#define P210_TO_V210_RECIPE(unpack_fn, pack_fn, chroma_line_shift) \
+	__m128i		unpack_out[6];\
+	__m128i*    y_plane = (__m128i *) source_buffer;\
+	uint8_t*    uv_plane = (uint8_t *) source_buffer + pixfc->pixel_count * 2;\
+	__m128i*    uv_line;\
+	__m128i*	v210_out;\
+	uint8_t*	next_dst = (uint8_t *) dest_buffer;\
+	uint32_t	line = 0;\
+	uint32_t	pixel_count;\
+	while(line < pixfc->height) {\
+		PREFETCH_LINE_AHEAD(y_plane, pixfc->width * 2);\
+		uv_line = (__m128i *) (uv_plane + (line >> chroma_line_shift) * pixfc->width * 2);\
+		v210_out = (__m128i *) next_dst;\
+		next_dst += pixfc->dest_row_bytes;\
+		pixel_count = pixfc->width;\
+		while(pixel_count >= 24) {\
+			unpack_fn(y_plane, uv_line, unpack_out);\
+			unpack_fn(&y_plane[1], &uv_line[1], &unpack_out[2]);\
+			unpack_fn(&y_plane[2], &uv_line[2], &unpack_out[4]);\
+			y_plane += 3;\
+			uv_line += 3;\
+			pack_fn(unpack_out, v210_out);\
+			v210_out += 4;\
+			pixel_count -= 24;\
+		}\
+		if (pixel_count > 0) {\
+			unpack_fn(y_plane, uv_line, unpack_out);\
+			if (pixel_count == 16) {\
+				unpack_fn(&y_plane[1], &uv_line[1], &unpack_out[2]);\
+			} else {\
+				unpack_out[2] = _mm_setzero_si128();\
+				unpack_out[3] = _mm_setzero_si128();\
+			}\
+			unpack_out[4] = _mm_setzero_si128();\
+			unpack_out[5] = _mm_setzero_si128();\
+			y_plane += pixel_count / 8;\
+			pack_fn(unpack_out, v210_out);\
+		}\
+		line++;\
+	}
+
+/*
+ * Convert a v210 buffer to P210, 24 pixels at a time.
+ */
+#define V210_TO_P210_RECIPE(unpack_fn_prefix, pack_fn, instr_set) \
+	__m128i		unpack_out[6];\
+	__m128i*	v210_in;\
+	__m128i*    y_out = (__m128i *) dest_buffer;\
+	__m128i*    uv_out = (__m128i *) ((uint8_t *) dest_buffer + pixfc->pixel_count * 2);\
+	uint8_t*	next_src = (uint8_t *) source_buffer;\
+	uint32_t	line = pixfc->height;\
+	uint32_t	pixel_count;\
+	while(line-- > 0) {\
+		v210_in = (__m128i *) next_src;\
+		PREFETCH_LINE_AHEAD(next_src, pixfc->source_row_bytes);\
+		next_src += pixfc->source_row_bytes;\
+		pixel_count = pixfc->width;\
+		while(pixel_count >= 24) {\
+			unpack_fn_prefix##instr_set(v210_in, &unpack_out[0], &unpack_out[2], &unpack_out[4]);\
+			v210_in += 4;\
+			pack_fn(&unpack_out[0], y_out++, uv_out++);\
+			pack_fn(&unpack_out[2], y_out++, uv_out++);\
+			pack_fn(&unpack_out[4], y_out++, uv_out++);\
+			pixel_count -= 24;\
+		}\
+		if (pixel_count > 0) {\
+			unpack_fn_prefix##instr_set(v210_in, &unpack_out[0], &unpack_out[2], &unpack_out[4]);\
+			pack_fn(&unpack_out[0], y_out++, uv_out++);\
+			if (pixel_count == 16)\
+				pack_fn(&unpack_out[2], y_out++, uv_out++);\
+		}\
+	}
+
+/*
+ * Convert a v210 buffer to P010, 2 lines and 24 pixels at a time.
+ * Chroma samples from each pair of lines are averaged.
+ */
+#define V210_TO_P010_RECIPE(unpack_fn_prefix, pack_fn, instr_set) \
+	__m128i		line1_out[6];\
+	__m128i		line2_out[6];\
+	__m128i*	v210_line1;\
+	__m128i*	v210_line2;\
+	__m128i*    y_line1 = (__m128i *) dest_buffer;\
+	__m128i*    y_line2 = (__m128i *) ((uint8_t *) y_line1 + pixfc->width * 2);\
+	__m128i*    uv_out = (__m128i *) ((uint8_t *) dest_buffer + pixfc->pixel_count * 2);\
+	uint8_t*	next_src = (uint8_t *) source_buffer;\
+	uint32_t	line = pixfc->height;\
+	uint32_t	pixel_count;\
+	while(line > 0) {\
+		v210_line1 = (__m128i *) next_src;\
+		v210_line2 = (__m128i *) (next_src + pixfc->source_row_bytes);\
+		PREFETCH_LINE_AHEAD(next_src, 2 * pixfc->source_row_bytes);\
+		next_src += 2 * pixfc->source_row_bytes;\
+		pixel_count = pixfc->width;\
+		while(pixel_count >= 24) {\
+			unpack_fn_prefix##instr_set(v210_line1, &line1_out[0], &line1_out[2], &line1_out[4]);\
+			unpack_fn_prefix##instr_set(v210_line2, &line2_out[0], &line2_out[2], &line2_out[4]);\
+			v210_line1 += 4;\
+			v210_line2 += 4;\
+			pack_fn(&line1_out[0], &line2_out[0], y_line1++, y_line2++, uv_out++);\
+			pack_fn(&line1_out[2], &line2_out[2], y_line1++, y_line2++, uv_out++);\
+			pack_fn(&line1_out[4], &line2_out[4], y_line1++, y_line2++, uv_out++);\
+			pixel_count -= 24;\
+		}\
+		if (pixel_count > 0) {\
+			unpack_fn_prefix##instr_set(v210_line1, &line1_out[0], &line1_out[2], &line1_out[4]);\
+			unpack_fn_prefix##instr_set(v210_line2, &line2_out[0], &line2_out[2], &line2_out[4]);\
+			pack_fn(&line1_out[0], &line2_out[0], y_line1++, y_line2++, uv_out++);\
+			if (pixel_count == 16)\
+				pack_fn(&line1_out[2], &line2_out[2], y_line1++, y_line2++, uv_out++);\
+		}\
+		y_line1 += pixfc->width / 8;\
+		y_line2 += pixfc->width / 8;\
+		line -= 2;\
+	}
+
+
 #endif /* YUV_CONVERSION_RECIPES_H_ */
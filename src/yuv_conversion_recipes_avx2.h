@@ -0,0 +1,259 @@
+/*
+ * yuv_conversion_recipes_avx2.h
+ *
+ * Copyright (C) 2011 PixFC Team (pixelfc@gmail.com)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public  License as published by the
+ * Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef YUV_CONVERSION_RECIPES_AVX2_H_
+#define YUV_CONVERSION_RECIPES_AVX2_H_
+
+#include "common.h"
+
+#ifndef DEBUG
+#include "yuv_unpack_avx2.h"
+#include "yuv_upsample_avx2.h"
+#include "yuv_to_rgb_convert_avx2.h"
+#include "rgb_pack_avx2.h"
+#include "yuv_pack_avx2.h"
+#endif
+
+#ifdef __INTEL_CPU__
+
+/*
+ * The AVX2 recipes below handle 16 pixels per iteration and honour the
+ * source and destination row bytes. They use unaligned loads & stores only,
+ * so they do not need separate aligned & unaligned versions.
+ *
+ * They expect the following variables to be in scope:
+ * pixfc, source_buffer and dest_buffer.
+ *
+ * The RGB recipes store the R, G & B vectors in the first 3 elements of the
+ * rgb array and the alpha values used by the ARGB & BGRA pack routines in
+ * the 4th one.
+ */
+
+
+/*
+ * Convert YUV422 interleaved to RGB with nearest neighbour upsampling
+ *
+ * unpack_fn_prefix:	unpack_yuyv_to_y_u_v_vectors_ or unpack_uyvy_to_y_u_v_vectors_
+ * convert_fn_prefix:	convert_y_u_v_vectors_to_rgb_vectors_ (or its bt601 / bt709 variant)
+ * pack_fn:				pack_3_rgb_vectors_to_{argb,bgra,rgb24,bgr24}_avx2
+ * output_stride:		bytes per output pixel
+ */
+#define YUV422I_TO_RGB_RECIPE_AVX2(unpack_fn_prefix, convert_fn_prefix, pack_fn, output_stride) \
+	uint32_t	line;\
+	uint32_t	pixels_remaining;\
+	uint8_t*	src;\
+	uint8_t*	dst;\
+	__m256i		y_u_v[3];\
+	__m256i		rgb[4];\
+	rgb[3] = _mm256_set1_epi8((char) pixfc->alpha);\
+	for(line = 0; line < pixfc->height; line++) {\
+		src = (uint8_t *) source_buffer + line * pixfc->source_row_bytes;\
+		PREFETCH_LINE_AHEAD(src, pixfc->source_row_bytes);\
+		dst = (uint8_t *) dest_buffer + line * pixfc->dest_row_bytes;\
+		pixels_remaining = pixfc->width;\
+		while(pixels_remaining > 0) {\
+			unpack_fn_prefix##avx2(src, y_u_v);\
+			convert_fn_prefix##avx2(y_u_v, rgb);\
+			pack_fn(rgb, dst);\
+			src += 32;\
+			dst += 16 * output_stride;\
+			pixels_remaining -= 16;\
+		}\
+	}
+
+
+/*
+ * Convert YUV422 interleaved to RGB with chroma averaging
+ *
+ * unpack_fn_prefix:	unpack_yuyv_to_y_uv_vectors_ or unpack_uyvy_to_y_uv_vectors_
+ * convert_fn_prefix:	convert_y_u_v_vectors_to_rgb_vectors_ (or its bt601 / bt709 variant)
+ * pack_fn:				pack_3_rgb_vectors_to_{argb,bgra,rgb24,bgr24}_avx2
+ * output_stride:		bytes per output pixel
+ */
+#define UPSAMPLE_YUV422I_TO_RGB_RECIPE_AVX2(unpack_fn_prefix, convert_fn_prefix, pack_fn, output_stride) \
+	uint32_t	line;\
+	uint32_t	pixels_remaining;\
+	uint8_t*	src;\
+	uint8_t*	dst;\
+	__m256i		y_uv[2];\
+	__m256i		next_y_uv[2];\
+	__m256i		y_u_v[3];\
+	__m256i		rgb[4];\
+	rgb[3] = _mm256_set1_epi8((char) pixfc->alpha);\
+	for(line = 0; line < pixfc->height; line++) {\
+		src = (uint8_t *) source_buffer + line * pixfc->source_row_bytes;\
+		PREFETCH_LINE_AHEAD(src, pixfc->source_row_bytes);\
+		dst = (uint8_t *) dest_buffer + line * pixfc->dest_row_bytes;\
+		pixels_remaining = pixfc->width;\
+		unpack_fn_prefix##avx2(src, y_uv);\
+		while(pixels_remaining > 16) {\
+			src += 32;\
+			unpack_fn_prefix##avx2(src, next_y_uv);\
+			y_u_v[0] = y_uv[0];\
+			reconstruct_missing_uv_avx2(&y_uv[1], &next_y_uv[1], &y_u_v[1]);\
+			convert_fn_prefix##avx2(y_u_v, rgb);\
+			pack_fn(rgb, dst);\
+			y_uv[0] = next_y_uv[0];\
+			y_uv[1] = next_y_uv[1];\
+			dst += 16 * output_stride;\
+			pixels_remaining -= 16;\
+		}\
+		y_u_v[0] = y_uv[0];\
+		reconstruct_last_missing_uv_avx2(&y_uv[1], &y_u_v[1]);\
+		convert_fn_prefix##avx2(y_u_v, rgb);\
+		pack_fn(rgb, dst);\
+	}
+
+
+/*
+ * Convert YUV422 / YUV420 planar to RGB
+ *
+ * unpack_fn:			unpack_yuv42Xp_to_y_u_v_vectors_avx2 (nearest neighbour upsampling)
+ * 						or unpack_n_upsample_yuv42Xp_to_y_u_v_vectors_avx2 (chroma averaging)
+ * unpack_last_fn:		same as unpack_fn for the last 16 pixels in a line
+ * convert_fn_prefix:	convert_y_u_v_vectors_to_rgb_vectors_ (or its bt601 / bt709 variant)
+ * pack_fn:				pack_3_rgb_vectors_to_{argb,bgra,rgb24,bgr24}_avx2
+ * output_stride:		bytes per output pixel
+ * chroma_line_shift:	0 for YUV422P (one chroma line per line), 1 for YUV420P
+ * 						(one chroma line per 2 lines)
+ */
+#define YUV42XP_TO_RGB_RECIPE_AVX2(unpack_fn, unpack_last_fn, convert_fn_prefix, pack_fn, output_stride, chroma_line_shift) \
+	uint32_t	line;\
+	uint32_t	pixels_remaining;\
+	uint32_t	chroma_width = pixfc->width / 2;\
+	uint8_t*	y_src;\
+	uint8_t*	u_src;\
+	uint8_t*	v_src;\
+	uint8_t*	u_plane = (uint8_t *) source_buffer + pixfc->pixel_count;\
+	uint8_t*	v_plane = u_plane + ((pixfc->pixel_count / 2) >> (chroma_line_shift));\
+	uint8_t*	dst;\
+	__m256i		y_u_v[3];\
+	__m256i		rgb[4];\
+	rgb[3] = _mm256_set1_epi8((char) pixfc->alpha);\
+	for(line = 0; line < pixfc->height; line++) {\
+		y_src = (uint8_t *) source_buffer + line * pixfc->width;\
+		u_src = u_plane + (line >> (chroma_line_shift)) * chroma_width;\
+		v_src = v_plane + (line >> (chroma_line_shift)) * chroma_width;\
+		PREFETCH_LINE_AHEAD(y_src, pixfc->width);\
+		PREFETCH_LINE_AHEAD(u_src, chroma_width);\
+		PREFETCH_LINE_AHEAD(v_src, chroma_width);\
+		dst = (uint8_t *) dest_buffer + line * pixfc->dest_row_bytes;\
+		pixels_remaining = pixfc->width;\
+		while(pixels_remaining > 16) {\
+			unpack_fn(y_src, u_src, v_src, y_u_v);\
+			convert_fn_prefix##avx2(y_u_v, rgb);\
+			pack_fn(rgb, dst);\
+			y_src += 16;\
+			u_src += 8;\
+			v_src += 8;\
+			dst += 16 * output_stride;\
+			pixels_remaining -= 16;\
+		}\
+		unpack_last_fn(y_src, u_src, v_src, y_u_v);\
+		convert_fn_prefix##avx2(y_u_v, rgb);\
+		pack_fn(rgb, dst);\
+	}
+
+
+/*
+ * Convert YUV420 planar to RGB with chroma averaging: chroma values on odd
+ * lines are the average of the chroma lines above and below (the last line
+ * reuses the last chroma line), missing chroma values are then reconstructed
+ * horizontally.
+ *
+ * unpack_fn:			unpack_n_upsample_yuv420p_to_y_u_v_vectors_avx2
+ * unpack_last_fn:		unpack_n_upsample_last_yuv420p_to_y_u_v_vectors_avx2
+ * convert_fn_prefix:	convert_y_u_v_vectors_to_rgb_vectors_ (or its bt601 / bt709 variant)
+ * pack_fn:				pack_3_rgb_vectors_to_{argb,bgra,rgb24,bgr24}_avx2
+ * output_stride:		bytes per output pixel
+ */
+#define UPSAMPLE_YUV420P_TO_RGB_RECIPE_AVX2(unpack_fn, unpack_last_fn, convert_fn_prefix, pack_fn, output_stride) \
+	uint32_t	line;\
+	uint32_t	pixels_remaining;\
+	uint32_t	chroma_width = pixfc->width / 2;\
+	uint32_t	chroma_line_offset;\
+	uint8_t*	y_src;\
+	uint8_t*	u_src;\
+	uint8_t*	v_src;\
+	uint8_t*	u_plane = (uint8_t *) source_buffer + pixfc->pixel_count;\
+	uint8_t*	v_plane = u_plane + pixfc->pixel_count / 4;\
+	uint8_t*	dst;\
+	__m256i		y_u_v[3];\
+	__m256i		rgb[4];\
+	rgb[3] = _mm256_set1_epi8((char) pixfc->alpha);\
+	for(line = 0; line < pixfc->height; line++) {\
+		y_src = (uint8_t *) source_buffer + line * pixfc->width;\
+		u_src = u_plane + (line >> 1) * chroma_width;\
+		v_src = v_plane + (line >> 1) * chroma_width;\
+		chroma_line_offset = (((line & 1) != 0) && (line + 1 < pixfc->height)) ? chroma_width : 0;\
+		PREFETCH_LINE_AHEAD(y_src, pixfc->width);\
+		PREFETCH_LINE_AHEAD(u_src, chroma_width);\
+		PREFETCH_LINE_AHEAD(v_src, chroma_width);\
+		dst = (uint8_t *) dest_buffer + line * pixfc->dest_row_bytes;\
+		pixels_remaining = pixfc->width;\
+		while(pixels_remaining > 16) {\
+			unpack_fn(y_src, u_src, v_src, chroma_line_offset, y_u_v);\
+			convert_fn_prefix##avx2(y_u_v, rgb);\
+			pack_fn(rgb, dst);\
+			y_src += 16;\
+			u_src += 8;\
+			v_src += 8;\
+			dst += 16 * output_stride;\
+			pixels_remaining -= 16;\
+		}\
+		unpack_last_fn(y_src, u_src, v_src, chroma_line_offset, y_u_v);\
+		convert_fn_prefix##avx2(y_u_v, rgb);\
+		pack_fn(rgb, dst);\
+	}
+
+
+/*
+ * Convert YUV422 interleaved to the other YUV422 interleaved format
+ * (YUYV to UYVY or UYVY to YUYV)
+ */
+#define YUV422I_TO_YUV422I_RECIPE_AVX2(repack_fn) \
+	uint32_t	line;\
+	uint32_t	pixels_remaining;\
+	uint8_t*	src;\
+	uint8_t*	dst;\
+	for(line = 0; line < pixfc->height; line++) {\
+		src = (uint8_t *) source_buffer + line * pixfc->source_row_bytes;\
+		PREFETCH_LINE_AHEAD(src, pixfc->source_row_bytes);\
+		dst = (uint8_t *) dest_buffer + line * pixfc->dest_row_bytes;\
+		pixels_remaining = pixfc->width;\
+		while(pixels_remaining > 0) {\
+			repack_fn(src, dst);\
+			src += 32;\
+			dst += 32;\
+			pixels_remaining -= 16;\
+		}\
+	}
+
+#else	// __INTEL_CPU__
+
+#define YUV422I_TO_RGB_RECIPE_AVX2(...)
+#define UPSAMPLE_YUV422I_TO_RGB_RECIPE_AVX2(...)
+#define YUV42XP_TO_RGB_RECIPE_AVX2(...)
+#define UPSAMPLE_YUV420P_TO_RGB_RECIPE_AVX2(...)
+#define YUV422I_TO_YUV422I_RECIPE_AVX2(...)
+
+#endif	// __INTEL_CPU__
+
+#endif /* YUV_CONVERSION_RECIPES_AVX2_H_ */
@@ -0,0 +1,106 @@
+/*
+ * yuv_conversion_recipes_avx512.h
+ *
+ * Copyright (C) 2011 PixFC Team (pixelfc@gmail.com)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public  License as published by the
+ * Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef YUV_CONVERSION_RECIPES_AVX512_H_
+#define YUV_CONVERSION_RECIPES_AVX512_H_
+
+#include "common.h"
+
+#ifndef DEBUG
+#include "yuv_unpack_avx512.h"
+#include "yuv_repack_avx512.h"
+#endif
+
+#ifdef __INTEL_CPU__
+
+/*
+ * The AVX-512 recipes below handle 24 pixels (one 64-byte block of v210)
+ * per iteration and honour the source and destination row bytes. The last
+ * pixels of a line are handled with masked loads / stores, so the width
+ * only has to be a multiple of 2, and nothing is written past the last
+ * pixel (or the last group of 6 pixels in v210).
+ *
+ * They expect the following variables to be in scope:
+ * pixfc, source_buffer and dest_buffer.
+ */
+
+// Mask of the first 'count' bytes of a 64-byte vector (count < 64)
+#define FIRST_BYTES_MASK_AVX512(count)		((((__mmask64) 1) << (count)) - 1)
+
+
+/*
+ * Convert v210 to YUV422 interleaved
+ *
+ * repack_fn:	repack_24_v210_pixels_to_{yuyv,uyvy}_avx512
+ */
+#define V210_TO_YUV422I_RECIPE_AVX512(repack_fn) \
+	uint32_t	line;\
+	uint32_t	pixels_remaining;\
+	uint8_t*	src;\
+	uint8_t*	dst;\
+	for(line = 0; line < pixfc->height; line++) {\
+		src = (uint8_t *) source_buffer + line * pixfc->source_row_bytes;\
+		PREFETCH_LINE_AHEAD(src, pixfc->source_row_bytes);\
+		dst = (uint8_t *) dest_buffer + line * pixfc->dest_row_bytes;\
+		pixels_remaining = pixfc->width;\
+		while(pixels_remaining >= 24) {\
+			repack_fn(src, dst, FIRST_BYTES_MASK_AVX512(48));\
+			src += 64;\
+			dst += 48;\
+			pixels_remaining -= 24;\
+		}\
+		if (pixels_remaining > 0)\
+			repack_fn(src, dst, FIRST_BYTES_MASK_AVX512(pixels_remaining * 2));\
+	}
+
+/*
+ * Convert YUV422 interleaved to v210
+ *
+ * repack_fn:	repack_24_{yuyv,uyvy}_pixels_to_v210_avx512
+ */
+#define YUV422I_TO_V210_RECIPE_AVX512(repack_fn) \
+	uint32_t	line;\
+	uint32_t	pixels_remaining;\
+	uint8_t*	src;\
+	uint8_t*	dst;\
+	for(line = 0; line < pixfc->height; line++) {\
+		src = (uint8_t *) source_buffer + line * pixfc->source_row_bytes;\
+		PREFETCH_LINE_AHEAD(src, pixfc->source_row_bytes);\
+		dst = (uint8_t *) dest_buffer + line * pixfc->dest_row_bytes;\
+		pixels_remaining = pixfc->width;\
+		while(pixels_remaining >= 24) {\
+			repack_fn(src, dst, FIRST_BYTES_MASK_AVX512(48), 0xFFFF);\
+			src += 48;\
+			dst += 64;\
+			pixels_remaining -= 24;\
+		}\
+		/* Only write the 4-word groups of 6 pixels covering the last pixels */\
+		if (pixels_remaining > 0)\
+			repack_fn(src, dst, FIRST_BYTES_MASK_AVX512(pixels_remaining * 2), (__mmask16) ((1 << (4 * ((pixels_remaining + 5) / 6))) - 1));\
+	}
+
+#else	// __INTEL_CPU__
+
+#define V210_TO_YUV422I_RECIPE_AVX512(...)
+#define YUV422I_TO_V210_RECIPE_AVX512(...)
+
+#endif	// __INTEL_CPU__
+
+#endif /* YUV_CONVERSION_RECIPES_AVX512_H_ */
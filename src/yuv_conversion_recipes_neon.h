@@ -0,0 +1,89 @@
+/*
+ * yuv_conversion_recipes_neon.h
+ *
+ * Copyright (C) 2011 PixFC Team (pixelfc@gmail.com)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public  License as published by the
+ * Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef YUV_CONVERSION_RECIPES_NEON_H_
+#define YUV_CONVERSION_RECIPES_NEON_H_
+
+#include "common.h"
+
+#ifndef DEBUG
+#include "yuv_repack_neon.h"
+#endif
+
+#ifdef __NEON_CPU__
+
+/*
+ * The NEON recipes below handle 32 pixels on each of 2 lines per iteration
+ * and honour the source row bytes (planar destinations must be packed).
+ *
+ * They expect the following variables to be in scope:
+ * pixfc, source_buffer and dest_buffer.
+ */
+
+/*
+ * Convert YUV422 interleaved to YUV420 planar
+ *
+ * unpack_fn:			unpack_{yuyv,uyvy}_to_y_uv_vectors_neon
+ * downsample_fn:		{nnb,avg}_downsample_uv_vectors_neon
+ */
+#define YUV422I_TO_YUV420P_RECIPE_NEON(unpack_fn, downsample_fn) \
+	uint32_t	line;\
+	uint32_t	pixels_remaining;\
+	uint8_t*	src1;\
+	uint8_t*	src2;\
+	uint8_t*	y_dst1 = (uint8_t *) dest_buffer;\
+	uint8_t*	y_dst2;\
+	uint8_t*	u_dst = y_dst1 + pixfc->pixel_count;\
+	uint8_t*	v_dst = u_dst + pixfc->pixel_count / 4;\
+	uint8x16_t	y[2];\
+	uint8x16_t	uv_line1[2];\
+	uint8x16_t	uv_line2[2];\
+	uint8x16_t	uv[2];\
+	for(line = 0; line < pixfc->height; line += 2) {\
+		src1 = (uint8_t *) source_buffer + line * pixfc->source_row_bytes;\
+		src2 = src1 + pixfc->source_row_bytes;\
+		y_dst2 = y_dst1 + pixfc->width;\
+		pixels_remaining = pixfc->width;\
+		while(pixels_remaining > 0) {\
+			unpack_fn(src1, y, uv_line1);\
+			pack_y_vectors_to_y_plane_neon(y, y_dst1);\
+			unpack_fn(src2, y, uv_line2);\
+			pack_y_vectors_to_y_plane_neon(y, y_dst2);\
+			downsample_fn(uv_line1, uv_line2, uv);\
+			vst1q_u8(u_dst, uv[0]);\
+			vst1q_u8(v_dst, uv[1]);\
+			src1 += 64;\
+			src2 += 64;\
+			y_dst1 += 32;\
+			y_dst2 += 32;\
+			u_dst += 16;\
+			v_dst += 16;\
+			pixels_remaining -= 32;\
+		}\
+		y_dst1 = y_dst2;\
+	}
+
+#else	// __NEON_CPU__
+
+#define YUV422I_TO_YUV420P_RECIPE_NEON(...)
+
+#endif	// __NEON_CPU__
+
+#endif /* YUV_CONVERSION_RECIPES_NEON_H_ */
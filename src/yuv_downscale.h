@@ -0,0 +1,187 @@
+/*
+ * yuv_downscale.h
+ *
+ * Copyright (C) 2011 PixFC Team (pixelfc@gmail.com)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public  License as published by the
+ * Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef YUV_DOWNSCALE_H_
+#define YUV_DOWNSCALE_H_
+
+#include "debug_support.h"
+#include "platform_util.h"
+
+#ifdef __INTEL_CPU__
+
+#include <emmintrin.h>
+
+/*
+ * The routines below average blocks of 2x2 or 4x4 YUV422 pixels. Their input
+ * is the sum (_mm_add_epi16) of the Y and UV vectors returned by the YUYV,
+ * UYVY or v210 unpack routines for the same pixels on 2 or 4 consecutive
+ * lines. The sums of 8- and 10-bit values fit in 16-bit words for both
+ * factors. Each downscaled pixel gets the rounded average of the chroma
+ * values covering its block, and the output is laid out as expected by the
+ * YUV to RGB conversion routines (Y, UV odd, UV even).
+ */
+
+
+/*
+ * Split 8 U & V pairs (one per pixel) in a vector of odd pixels'
+ * chroma values and a vector of even pixels' chroma values.
+ *
+ * TOTAL LATENCY:			2
+ *
+ * INPUT:
+ * U1 0		V1 0	U2 0	V2 0	U3 0	V3 0	U4 0	V4 0
+ * U5 0		V5 0	U6 0	V6 0	U7 0	V7 0	U8 0	V8 0
+ *
+ * OUTPUT:
+ * U1 0		V1 0	U3 0	V3 0	U5 0	V5 0	U7 0	V7 0
+ * U2 0		V2 0	U4 0	V4 0	U6 0	V6 0	U8 0	V8 0
+ */
+EXTERN_INLINE void	split_uv_vectors_in_odd_even_uv_vectors_sse2(__m128i* in_2_v16i_uv_vectors, __m128i* out_2_v16i_uvodd_uveven_vectors) {
+	M128I(tmp1, 0x0LL, 0x0LL);
+	M128I(tmp2, 0x0LL, 0x0LL);
+
+	_M(tmp1) = _mm_shuffle_epi32(in_2_v16i_uv_vectors[0], 0xD8);		// PSHUFD		1	0.5
+	// U1 0		V1 0	U3 0	V3 0	U2 0	V2 0	U4 0	V4 0
+
+	_M(tmp2) = _mm_shuffle_epi32(in_2_v16i_uv_vectors[1], 0xD8);		// PSHUFD		1	0.5
+	// U5 0		V5 0	U7 0	V7 0	U6 0	V6 0	U8 0	V8 0
+
+	out_2_v16i_uvodd_uveven_vectors[0] = _mm_unpacklo_epi64(_M(tmp1), _M(tmp2));	// PUNPCKLQDQ	1	0.5
+	// U1 0		V1 0	U3 0	V3 0	U5 0	V5 0	U7 0	V7 0
+
+	out_2_v16i_uvodd_uveven_vectors[1] = _mm_unpackhi_epi64(_M(tmp1), _M(tmp2));	// PUNPCKHQDQ	1	0.5
+	// U2 0		V2 0	U4 0	V4 0	U6 0	V6 0	U8 0	V8 0
+}
+
+/*
+ * Average 2x2 blocks of pixels.
+ *
+ * Number of output pixels:	8
+ *
+ * TOTAL LATENCY:			8
+ *
+ * INPUT:
+ * 4 vectors of sums of 16 pixels on 2 lines (Sxx is the sum of both lines):
+ * SY1 0	SY2 0	SY3 0	SY4 0	...		SY8 0
+ * SU1 0	SV1 0	SU3 0	SV3 0	...		SV7 0
+ * SY9 0	SY10 0	SY11 0	SY12 0	...		SY16 0
+ * SU9 0	SV9 0	SU11 0	SV11 0	...		SV15 0
+ *
+ * OUTPUT:
+ * Y1 0		Y2 0	Y3 0	Y4 0	...		Y8 0
+ * U1 0		V1 0	U3 0	V3 0	...		V7 0
+ * U2 0		V2 0	U4 0	V4 0	...		V8 0
+ */
+EXTERN_INLINE void	downscale_2x_y_uv_sums_to_y_uv_vectors_sse2(__m128i* in_4_v16i_y_uv_sums, __m128i* out_3_v16i_y_uvodd_uveven_vectors) {
+	CONST_M128I(ones, 0x0001000100010001LL, 0x0001000100010001LL);
+	CONST_M128I(twos, 0x0002000200020002LL, 0x0002000200020002LL);
+	M128I(tmp1, 0x0LL, 0x0LL);
+	M128I(tmp2, 0x0LL, 0x0LL);
+	__m128i		uv[2];
+
+	_M(tmp1) = _mm_madd_epi16(in_4_v16i_y_uv_sums[0], _M(ones));		// PMADDWD		3	1
+	// SY1+SY2		SY3+SY4		SY5+SY6		SY7+SY8		(32-bit)
+
+	_M(tmp2) = _mm_madd_epi16(in_4_v16i_y_uv_sums[2], _M(ones));		// PMADDWD		3	1
+	// SY9+SY10		SY11+SY12	SY13+SY14	SY15+SY16	(32-bit)
+
+	_M(tmp1) = _mm_packs_epi32(_M(tmp1), _M(tmp2));						// PACKSSDW		1	0.5
+	_M(tmp1) = _mm_add_epi16(_M(tmp1), _M(twos));						// PADDW		1	0.5
+	out_3_v16i_y_uvodd_uveven_vectors[0] = _mm_srli_epi16(_M(tmp1), 2);	// PSRLW		1	1
+	// Y1 0		Y2 0	Y3 0	Y4 0	Y5 0	Y6 0	Y7 0	Y8 0
+
+	// Each chroma sum covers a 2x2 block
+	uv[0] = _mm_avg_epu16(in_4_v16i_y_uv_sums[1], _mm_setzero_si128());	// PAVGW		1	0.5
+	// U1 0		V1 0	U2 0	V2 0	U3 0	V3 0	U4 0	V4 0
+
+	uv[1] = _mm_avg_epu16(in_4_v16i_y_uv_sums[3], _mm_setzero_si128());	// PAVGW		1	0.5
+	// U5 0		V5 0	U6 0	V6 0	U7 0	V7 0	U8 0	V8 0
+
+	split_uv_vectors_in_odd_even_uv_vectors_sse2(uv, &out_3_v16i_y_uvodd_uveven_vectors[1]);
+}
+
+/*
+ * Average 4x4 blocks of pixels.
+ *
+ * Number of output pixels:	8
+ *
+ * TOTAL LATENCY:			14
+ *
+ * INPUT:
+ * 8 vectors of sums of 32 pixels on 4 lines (Sxx is the sum of all 4 lines):
+ * SY1 0	SY2 0	SY3 0	SY4 0	...		SY8 0
+ * SU1 0	SV1 0	SU3 0	SV3 0	...		SV7 0
+ * ...
+ * SY25 0	SY26 0	SY27 0	SY28 0	...		SY32 0
+ * SU25 0	SV25 0	SU27 0	SV27 0	...		SV31 0
+ *
+ * OUTPUT:
+ * Y1 0		Y2 0	Y3 0	Y4 0	...		Y8 0
+ * U1 0		V1 0	U3 0	V3 0	...		V7 0
+ * U2 0		V2 0	U4 0	V4 0	...		V8 0
+ */
+EXTERN_INLINE void	downscale_4x_y_uv_sums_to_y_uv_vectors_sse2(__m128i* in_8_v16i_y_uv_sums, __m128i* out_3_v16i_y_uvodd_uveven_vectors) {
+	CONST_M128I(ones, 0x0001000100010001LL, 0x0001000100010001LL);
+	CONST_M128I(eights, 0x0008000800080008LL, 0x0008000800080008LL);
+	CONST_M128I(fours, 0x0004000400040004LL, 0x0004000400040004LL);
+	M128I(tmp1, 0x0LL, 0x0LL);
+	M128I(tmp2, 0x0LL, 0x0LL);
+	M128I(tmp3, 0x0LL, 0x0LL);
+	__m128i		uv[4];
+
+	_M(tmp1) = _mm_packs_epi32(_mm_madd_epi16(in_8_v16i_y_uv_sums[0], _M(ones)), _mm_madd_epi16(in_8_v16i_y_uv_sums[2], _M(ones)));	// PMADDWD / PACKSSDW
+	// SY1+SY2		SY3+SY4		...		SY15+SY16
+
+	_M(tmp2) = _mm_packs_epi32(_mm_madd_epi16(in_8_v16i_y_uv_sums[4], _M(ones)), _mm_madd_epi16(in_8_v16i_y_uv_sums[6], _M(ones)));	// PMADDWD / PACKSSDW
+	// SY17+SY18	SY19+SY20	...		SY31+SY32
+
+	_M(tmp3) = _mm_packs_epi32(_mm_madd_epi16(_M(tmp1), _M(ones)), _mm_madd_epi16(_M(tmp2), _M(ones)));	// PMADDWD / PACKSSDW
+	// SY1+..+SY4	SY5+..+SY8	...		SY29+..+SY32
+
+	_M(tmp3) = _mm_add_epi16(_M(tmp3), _M(eights));						// PADDW		1	0.5
+	out_3_v16i_y_uvodd_uveven_vectors[0] = _mm_srli_epi16(_M(tmp3), 4);	// PSRLW		1	1
+	// Y1 0		Y2 0	Y3 0	Y4 0	Y5 0	Y6 0	Y7 0	Y8 0
+
+	// Each output pixel covers 2 chroma sums
+	uv[0] = in_8_v16i_y_uv_sums[1];
+	uv[1] = in_8_v16i_y_uv_sums[3];
+	split_uv_vectors_in_odd_even_uv_vectors_sse2(uv, uv);
+	uv[0] = _mm_add_epi16(uv[0], uv[1]);								// PADDW		1	0.5
+	// SU1+SU3	SV1+SV3		SU5+SU7		SV5+SV7		...		SV13+SV15
+
+	uv[2] = in_8_v16i_y_uv_sums[5];
+	uv[3] = in_8_v16i_y_uv_sums[7];
+	split_uv_vectors_in_odd_even_uv_vectors_sse2(&uv[2], &uv[2]);
+	uv[1] = _mm_add_epi16(uv[2], uv[3]);								// PADDW		1	0.5
+	// SU17+SU19	SV17+SV19	...		SV29+SV31
+
+	uv[0] = _mm_srli_epi16(_mm_add_epi16(uv[0], _M(fours)), 3);			// PADDW / PSRLW
+	// U1 0		V1 0	U2 0	V2 0	U3 0	V3 0	U4 0	V4 0
+
+	uv[1] = _mm_srli_epi16(_mm_add_epi16(uv[1], _M(fours)), 3);			// PADDW / PSRLW
+	// U5 0		V5 0	U6 0	V6 0	U7 0	V7 0	U8 0	V8 0
+
+	split_uv_vectors_in_odd_even_uv_vectors_sse2(uv, &out_3_v16i_y_uvodd_uveven_vectors[1]);
+}
+
+
+#endif	// __INTEL_CPU__
+
+#endif /* YUV_DOWNSCALE_H_ */
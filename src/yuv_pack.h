@@ -40,7 +40,10 @@
  * This is done so this header file CAN be included multiple times, once with
  * GENERATE_UNALIGNED_INLINES set to 0 to generate inlines for aligned input buffers
  * and once with GENERATE_UNALIGNED_INLINES set to 1 to generate inlines for
- * unaligned input buffers
+ * unaligned input buffers.
+ * It can be included a third time with GENERATE_UNALIGNED_INLINES set to 0 and
+ * GENERATE_NON_TEMPORAL_INLINES set to 1 to generate nt_ inlines for aligned
+ * output buffers, which use streaming stores bypassing the cache.
  */
 
 #undef INLINE_NAME
@@ -53,6 +56,11 @@
 	#define INLINE_NAME(fn_suffix, ...)				EXTERN_INLINE void unaligned_ ## fn_suffix(__VA_ARGS__)
 	#define M128_STORE(src, dst)					_mm_storeu_si128(&(dst), (src))
 	#define M128_LOAD(src)							_mm_loadu_si128(&(src))
+#elif defined(GENERATE_NON_TEMPORAL_INLINES) && (GENERATE_NON_TEMPORAL_INLINES == 1)
+	#define CALL_INLINE(fn, ...)					nt_ ## fn(__VA_ARGS__)
+	#define INLINE_NAME(fn_suffix, ...)				EXTERN_INLINE void nt_ ## fn_suffix(__VA_ARGS__)
+	#define M128_STORE(src, dst)					_mm_stream_si128(&(dst), (src))
+	#define M128_LOAD(src)							(src)
 #else
 	#define CALL_INLINE(fn, ...)					fn(__VA_ARGS__)
 	#define INLINE_NAME(fn_suffix, ...)				EXTERN_INLINE void fn_suffix(__VA_ARGS__)
@@ -279,6 +287,59 @@ INLINE_NAME(pack_4_y_uv_422_vectors_to_yuvp_hi_vectors_sse2, __m128i* in_4_y_uv_
 	// x x		x x		x x		x x		V1 V2	V3 V4	V5 V6	V7 V8			// POR			1	0.33
 }
 
+/*
+ * Pack 2 pairs of 422 downsampled Y, UV vectors to YUV422p - a whole vector
+ * is stored in the Y plane, but only 8 bytes are stored in each of the U and
+ * V planes, which do not need to be aligned.
+ *
+ *
+ * Total latency:			6 cycles
+ * Num of pixel handled:	16
+ *
+ * INPUT:
+ *
+ * 4 vectors of 8 short
+ *
+ * yVect1
+ * Y1 0		Y2 0	Y3 0	Y4 0	Y5 0	Y6 0	Y7 0	Y8 0
+ *
+ * uvVect1
+ * U12 0	V12 0	U34 0	V34 0	U56 0	V56 0	U78 0	V78 0
+ *
+ * yVect2
+ * Y9 0		Y10 0	Y11 0	Y12 0	Y13 0	Y14 0	Y15 0	Y16 0
+ *
+ * uvVect2
+ * U910 0	V910 0	U1112 0	V1112 0	U1314 0	V1314 0	U1516 0	V1516 0
+ *
+ *
+ * OUTPUT:
+ *
+ * 1 vector of 16 char and 2 x 8 char
+ *
+ * Y1 Y2	Y3 Y4	Y5 Y6	Y7 Y8	Y9 Y10	Y11 Y12 Y13 Y14	Y15 Y16
+ *
+ * U1 U2	U3 U4	U5 U6	U7 U8
+ *
+ * V1 V2	V3 V4	V5 V6	V7 V8
+ */
+INLINE_NAME(pack_4_y_uv_422_vectors_to_yuvp_sse2, __m128i* in_4_y_uv_422_vectors, __m128i* out_y_plane, uint8_t* out_u_plane, uint8_t* out_v_plane) {
+	CONST_M128I(mask_cr, 0x00FF00FF00FF00FFLL, 0x00FF00FF00FF00FFLL);
+	M128I(scratch, 0x0LL, 0x0LL);
+
+	M128_STORE(_mm_packus_epi16(in_4_y_uv_422_vectors[0], in_4_y_uv_422_vectors[2]), *out_y_plane);
+	// Y1 Y2	Y3 Y4	Y5 Y6	Y7 Y8	Y9 Y10	Y11 Y12	Y13 Y14	Y15 Y16			// PACKUSWB		1	0.5
+
+	_M(scratch) = _mm_packus_epi16(in_4_y_uv_422_vectors[1], in_4_y_uv_422_vectors[3]);
+	// U1 V1 	U2 V2	U3 V3	U4 V4	U5 V5 	U6 V6	U7 V7	U8 V8			// PACKUSWB		1	0.5
+
+	_mm_storel_epi64((__m128i *) out_u_plane, _mm_packus_epi16(_mm_and_si128(_M(scratch), _M(mask_cr)), _M(scratch)));
+	// U1 U2	U3 U4 	U5 U6	U7 U8											// PAND + PACKUSWB	2	0.83
+
+	_mm_storel_epi64((__m128i *) out_v_plane, _mm_packus_epi16(_mm_srli_epi16(_M(scratch), 8), _M(scratch)));
+	// V1 V2	V3 V4 	V5 V6	V7 V8											// PSRLW + PACKUSWB	2	1.5
+}
+
 
 
 /*
@@ -378,6 +439,170 @@ INLINE_NAME(pack_4_uv_vectors_to_yup_vectors_sse2, __m128i* in_4_uv_vectors, __m
 	// V1 V2	V3 V4 	V5 V6	V7 V8	V9 V10	V11 V12	V13 V14 V15 V16
 }
 
+
+/*
+ * Pack 4 UV vectors to 2 interleaved UV vectors (NV12 chroma plane)
+ *
+ * Total latency:			2 cycles
+ * Num of pixel handled:	16
+ *
+ * INPUT:
+ *
+ * 4 vectors of 8 short
+ *
+ * uvVect1
+ * U1 0		V1 0	U2 0	V2 0	U3 0	V3 0	U4 0	V4 0
+ *
+ * uvVect2
+ * U5 0		V5 0	U6 0	V6 0	U7 0	V7 0	U8 0	V8 0
+ *
+ * uvVect3
+ * U9 0		V9 0	U10 0	V10 0	U11 0	V11 0	U12 0	V12 0
+ *
+ * uvVect4
+ * U13 0	V13 0	U14 0	V14 0	U15 0	V15 0	U16 0	V16 0
+ *
+ *
+ * OUTPUT:
+ *
+ * 2 vectors of 16 char
+ *
+ * U1 V1 	U2 V2	U3 V3	U4 V4	U5 V5 	U6 V6	U7 V7	U8 V8
+ *
+ * U9 V9 	U10 V10	U11 V11	U12 V12	U13 V13 U14 V14	U15 V15	U16 V16
+ *
+ */
+INLINE_NAME(pack_4_uv_vectors_to_nv12_vectors_sse2, __m128i* in_4_uv_vectors, __m128i* out_uv_plane1, __m128i* out_uv_plane2) {
+	M128_STORE(_mm_packus_epi16(in_4_uv_vectors[0], in_4_uv_vectors[1]), *out_uv_plane1);
+	// U1 V1 	U2 V2	U3 V3	U4 V4	U5 V5 	U6 V6	U7 V7	U8 V8			// PACKUSWB		1	0.5
+
+	M128_STORE(_mm_packus_epi16(in_4_uv_vectors[2], in_4_uv_vectors[3]), *out_uv_plane2);
+	// U9 V9 	U10 V10	U11 V11	U12 V12	U13 V13 U14 V14	U15 V15	U16 V16			// PACKUSWB		1	0.5
+}
+
+
+/*
+ * Pack 4 UV vectors to 2 interleaved VU vectors (NV21 chroma plane)
+ *
+ * Total latency:			8 cycles
+ * Num of pixel handled:	16
+ *
+ * INPUT:
+ *
+ * 4 vectors of 8 short
+ *
+ * uvVect1
+ * U1 0		V1 0	U2 0	V2 0	U3 0	V3 0	U4 0	V4 0
+ *
+ * uvVect2
+ * U5 0		V5 0	U6 0	V6 0	U7 0	V7 0	U8 0	V8 0
+ *
+ * uvVect3
+ * U9 0		V9 0	U10 0	V10 0	U11 0	V11 0	U12 0	V12 0
+ *
+ * uvVect4
+ * U13 0	V13 0	U14 0	V14 0	U15 0	V15 0	U16 0	V16 0
+ *
+ *
+ * OUTPUT:
+ *
+ * 2 vectors of 16 char
+ *
+ * V1 U1 	V2 U2	V3 U3	V4 U4	V5 U5 	V6 U6	V7 U7	V8 U8
+ *
+ * V9 U9 	V10 U10	V11 U11	V12 U12	V13 U13 V14 U14	V15 U15	V16 U16
+ *
+ */
+INLINE_NAME(pack_4_uv_vectors_to_nv21_vectors_sse2, __m128i* in_4_uv_vectors, __m128i* out_vu_plane1, __m128i* out_vu_plane2) {
+	M128I(scratch1, 0x0LL, 0x0LL);
+	M128I(scratch2, 0x0LL, 0x0LL);
+
+	_M(scratch1) = _mm_packus_epi16(in_4_uv_vectors[0], in_4_uv_vectors[1]);
+	// U1 V1 	U2 V2	U3 V3	U4 V4	U5 V5 	U6 V6	U7 V7	U8 V8			// PACKUSWB		1	0.5
+
+	_M(scratch2) = _mm_packus_epi16(in_4_uv_vectors[2], in_4_uv_vectors[3]);
+	// U9 V9 	U10 V10	U11 V11	U12 V12	U13 V13 U14 V14	U15 V15	U16 V16			// PACKUSWB		1	0.5
+
+	M128_STORE(_mm_or_si128(_mm_slli_epi16(_M(scratch1), 8), _mm_srli_epi16(_M(scratch1), 8)), *out_vu_plane1);
+	// V1 U1 	V2 U2	V3 U3	V4 U4	V5 U5 	V6 U6	V7 U7	V8 U8			// PSLLW PSRLW POR	3	1
+
+	M128_STORE(_mm_or_si128(_mm_slli_epi16(_M(scratch2), 8), _mm_srli_epi16(_M(scratch2), 8)), *out_vu_plane2);
+	// V9 U9 	V10 U10	V11 U11	V12 U12	V13 U13 V14 U14	V15 U15	V16 U16			// PSLLW PSRLW POR	3	1
+}
+
+
+/*
+ * Pack 1 pair of 10-bit Y, UV vectors to 1 P210 Y vector and 1 P210 UV vector
+ *
+ * Total latency:			2 cycles
+ * Num of pixel handled:	8
+ *
+ * INPUT:
+ *
+ * 2 vectors of 8 short
+ * yVect
+ * Y1		Y2		Y3		Y4		Y5		Y6		Y7		Y8
+ *
+ * uvVect
+ * U12		V12		U34		V34		U56		V56		U78		V78
+ *
+ * OUTPUT:
+ *
+ * 2 vectors of 8 short, with the 10-bit values in the most significant bits
+ * out_y_plane
+ * Y1		Y2		Y3		Y4		Y5		Y6		Y7		Y8
+ *
+ * out_uv_plane
+ * U12		V12		U34		V34		U56		V56		U78		V78
+ */
+INLINE_NAME(pack_y_uv_vectors_to_p210_vectors_sse2, __m128i* in_2_v16i_y_uv_vectors, __m128i* out_y_plane, __m128i* out_uv_plane) {
+	M128_STORE(_mm_slli_epi16(in_2_v16i_y_uv_vectors[0], 6), *out_y_plane);		// PSLLW		1	1
+	M128_STORE(_mm_slli_epi16(in_2_v16i_y_uv_vectors[1], 6), *out_uv_plane);		// PSLLW		1	1
+}
+
+
+/*
+ * Pack 2 pairs of 10-bit Y, UV vectors from 2 consecutive lines to 2 P010
+ * Y vectors and 1 P010 UV vector. The chroma samples of both lines are averaged.
+ *
+ * Total latency:			4 cycles
+ * Num of pixel handled:	16
+ *
+ * INPUT:
+ *
+ * 2 vectors of 8 short (line 1)
+ * yVect
+ * Y1		Y2		Y3		Y4		Y5		Y6		Y7		Y8
+ *
+ * uvVect
+ * U12		V12		U34		V34		U56		V56		U78		V78
+ *
+ * 2 vectors of 8 short (line 2)
+ * yVect
+ * Y1'		Y2'		Y3'		Y4'		Y5'		Y6'		Y7'		Y8'
+ *
+ * uvVect
+ * U12'		V12'	U34'	V34'	U56'	V56'	U78'	V78'
+ *
+ * OUTPUT:
+ *
+ * 3 vectors of 8 short, with the 10-bit values in the most significant bits
+ * out_y_plane1
+ * Y1		Y2		Y3		Y4		Y5		Y6		Y7		Y8
+ *
+ * out_y_plane2
+ * Y1'		Y2'		Y3'		Y4'		Y5'		Y6'		Y7'		Y8'
+ *
+ * out_uv_plane
+ * U12"		V12"	U34"	V34"	U56"	V56"	U78"	V78"
+ */
+INLINE_NAME(pack_2_y_uv_vectors_to_p010_vectors_sse2, __m128i* in_line1_y_uv_vectors, __m128i* in_line2_y_uv_vectors, __m128i* out_y_plane1, __m128i* out_y_plane2, __m128i* out_uv_plane) {
+	M128_STORE(_mm_slli_epi16(in_line1_y_uv_vectors[0], 6), *out_y_plane1);		// PSLLW		1	1
+	M128_STORE(_mm_slli_epi16(in_line2_y_uv_vectors[0], 6), *out_y_plane2);		// PSLLW		1	1
+	M128_STORE(_mm_slli_epi16(_mm_avg_epu16(in_line1_y_uv_vectors[1], in_line2_y_uv_vectors[1]), 6), *out_uv_plane);
+	// PAVGW PSLLW	2	1
+}
+
 #ifdef FAKE_SSE41_BLENDV
 #define _mm_blendv_epi8 _fake_mm_blendv_epi8
 __m128i     _fake_mm_blendv_epi8(__m128i v1, __m128i v2, __m128i mask);
@@ -0,0 +1,210 @@
+/*
+ * yuv_pack_avx2.h
+ *
+ * Copyright (C) 2011 PixFC Team (pixelfc@gmail.com)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public  License as published by the
+ * Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef YUV_PACK_AVX2_H_
+#define YUV_PACK_AVX2_H_
+
+#include "debug_support.h"
+#include "platform_util.h"
+
+#ifdef __INTEL_CPU__
+
+#include <immintrin.h>
+
+/*
+ * The pack routines below take a vector of 16 short Y and a vector of
+ * 8 U & V short pairs (as produced by rgb_to_yuv_convert_avx2.h), saturate
+ * them and store them at 'output' using unaligned stores.
+ *
+ * INPUT:
+ * yVect
+ * Y1		Y2		Y3		...		Y16
+ *
+ * uvVect
+ * U12		V12		U34		V34		...		U1516	V1516
+ */
+
+
+/*
+ * Pack 1 Y and 1 UV vector to 16 YUYV pixels (32 bytes)
+ */
+EXTERN_INLINE void	pack_y_uv_vectors_to_yuyv_avx2(__m256i* in_y_vector, __m256i* in_uv_vector, uint8_t* output) {
+	// Y1 - Y8		U12 V12 ... U78 V78		|	Y9 - Y16	U910 V910 ... U1516 V1516
+	__m256i		packed = _mm256_packus_epi16(*in_y_vector, *in_uv_vector);
+
+	_mm256_storeu_si256((__m256i *) output, _mm256_unpacklo_epi8(packed, _mm256_srli_si256(packed, 8)));
+}
+
+/*
+ * Pack 1 Y and 1 UV vector to 16 UYVY pixels (32 bytes)
+ */
+EXTERN_INLINE void	pack_y_uv_vectors_to_uyvy_avx2(__m256i* in_y_vector, __m256i* in_uv_vector, uint8_t* output) {
+	// Y1 - Y8		U12 V12 ... U78 V78		|	Y9 - Y16	U910 V910 ... U1516 V1516
+	__m256i		packed = _mm256_packus_epi16(*in_y_vector, *in_uv_vector);
+
+	_mm256_storeu_si256((__m256i *) output, _mm256_unpacklo_epi8(_mm256_srli_si256(packed, 8), packed));
+}
+
+/*
+ * Pack 1 Y and 1 UV vector to 16 Y, 8 U and 8 V planar samples
+ */
+EXTERN_INLINE void	pack_y_uv_vectors_to_yuv422p_avx2(__m256i* in_y_vector, __m256i* in_uv_vector, uint8_t* y_output, uint8_t* u_output, uint8_t* v_output) {
+	__m256i		shuffle_uv = _mm256_setr_epi8(
+			8, 10, 12, 14, 9, 11, 13, 15, -1, -1, -1, -1, -1, -1, -1, -1,
+			8, 10, 12, 14, 9, 11, 13, 15, -1, -1, -1, -1, -1, -1, -1, -1);
+	__m256i		permute_uv = _mm256_setr_epi32(0, 4, 1, 5, 2, 3, 6, 7);
+	// Y1 - Y8		U12 V12 ... U78 V78		|	Y9 - Y16	U910 V910 ... U1516 V1516
+	__m256i		packed = _mm256_packus_epi16(*in_y_vector, *in_uv_vector);
+	__m128i		uv;
+
+	_mm_storeu_si128((__m128i *) y_output, _mm256_castsi256_si128(_mm256_permute4x64_epi64(packed, 0x08)));
+
+	// U12 U34 ... U1516	V12 V34 ... V1516
+	uv = _mm256_castsi256_si128(_mm256_permutevar8x32_epi32(_mm256_shuffle_epi8(packed, shuffle_uv), permute_uv));
+	_mm_storel_epi64((__m128i *) u_output, uv);
+	_mm_storel_epi64((__m128i *) v_output, _mm_srli_si128(uv, 8));
+}
+
+/*
+ * Pack 2 Y, UV vectors holding 2 groups of 6 pixels each (one per lane)
+ * into 2 groups of 6 v210 pixels. This is the AVX2 version of
+ * pack_2_y_uv_vectors_to_1_v210_vector_sse2_ssse3_sse41() in yuv_pack.h.
+ *
+ * INPUT (per lane):
+ * yVect
+ * Y0		Y1		Y2		Y3		Y4		Y5		x		x
+ *
+ * uvVect
+ * U01		V01		U23		V23		U45		V45		x		x
+ *
+ * OUTPUT (per lane):
+ * U01	Y0	V01		Y1	U23	Y2		V23	Y3	U45		Y4	V45	Y5
+ */
+EXTERN_INLINE __m256i	pack_2_y_uv_vectors_to_2_v210_groups_avx2(__m256i y_vector, __m256i uv_vector) {
+	__m256i		max_value = _mm256_set1_epi16(0x03FF);
+	__m256i		zero = _mm256_setzero_si256();
+	__m256i		shuffle_y = _mm256_setr_epi8(
+			-1, -1, 0, 1, 2, 3, 4, 5, -1, -1, 6, 7, 8, 9, 10, 11,
+			-1, -1, 0, 1, 2, 3, 4, 5, -1, -1, 6, 7, 8, 9, 10, 11);
+	__m256i		shuffle_uv = _mm256_setr_epi8(
+			0, 1, 2, 3, -1, -1, 4, 5, 6, 7, 8, 9, -1, -1, 10, 11,
+			0, 1, 2, 3, -1, -1, 4, 5, 6, 7, 8, 9, -1, -1, 10, 11);
+	__m256i		y;
+	__m256i		uv;
+	__m256i		scratch;
+	__m256i		scratch2;
+
+	// Clamp to 0 - 1023
+	y = _mm256_max_epi16(_mm256_min_epi16(y_vector, max_value), zero);
+	uv = _mm256_max_epi16(_mm256_min_epi16(uv_vector, max_value), zero);
+
+	//	0		Y0		Y1		Y2		0		Y3		Y4		Y5
+	y = _mm256_shuffle_epi8(y, shuffle_y);
+	//	U01		V01		0		U23		V23		U45		0		V45
+	uv = _mm256_shuffle_epi8(uv, shuffle_uv);
+
+	// U01		V01		Y1		Y2		V23		U45		Y4		Y5
+	scratch = _mm256_blend_epi32(y, uv, 0x55);
+	// 0		Y0		0		U23		0		Y3		0		V45
+	scratch2 = _mm256_blend_epi32(uv, y, 0x55);
+
+	// (10-bit words)
+	// U01	0	V01		Y1	0	Y2		V23	0	U45		Y4	0	Y5
+	scratch = _mm256_blend_epi16(scratch, _mm256_slli_epi16(scratch, 4), 0xAA);
+
+	// (10-bit words)
+	// U01	Y0	V01		Y1	U23	Y2		V23	Y3	U45		Y4	V45	Y5
+	return _mm256_or_si256(scratch, _mm256_srli_epi32(scratch2, 6));
+}
+
+/*
+ * Pack 6 vectors (Y, UV) into 128 bytes of v210 (48 pixels)
+ *
+ * INPUT
+ * 6 vectors of 16 short
+ * yVect1
+ * Y0		Y1		...		Y15
+ *
+ * uvVect1
+ * U01		V01		...		U1415	V1415
+ *
+ * yVect2
+ * Y16		Y17		...		Y31
+ *
+ * uvVect2
+ * U1617	V1617	...		U3031	V3031
+ *
+ * yVect3
+ * Y32		Y33		...		Y47
+ *
+ * uvVect3
+ * U3233	V3233	...		U4647	V4647
+ *
+ * Each group of 6 pixels uses 3 consecutive dwords of Y and 3 consecutive
+ * dwords of UV, so both are spread to 2 groups per output vector with the
+ * same cross-lane permutations.
+ */
+EXTERN_INLINE void	pack_6_y_uv_vectors_to_4_v210_vectors_avx2(__m256i* in_6_y_uv_vectors, uint8_t* output) {
+	__m256i		groups_0_1 = _mm256_setr_epi32(0, 1, 2, 2, 3, 4, 5, 5);
+	__m256i		groups_2_3_lo = _mm256_setr_epi32(6, 7, 7, 7, 7, 7, 7, 7);
+	__m256i		groups_2_3_hi = _mm256_setr_epi32(0, 0, 0, 0, 1, 2, 3, 3);
+	__m256i		groups_4_5_lo = _mm256_setr_epi32(4, 5, 6, 6, 7, 7, 7, 7);
+	__m256i		groups_4_5_hi = _mm256_setr_epi32(0, 0, 0, 0, 0, 0, 1, 1);
+	__m256i		groups_6_7 = _mm256_setr_epi32(2, 3, 4, 4, 5, 6, 7, 7);
+	__m256i		y;
+	__m256i		uv;
+
+	// Groups 0 & 1: pixels 0 - 11
+	y = _mm256_permutevar8x32_epi32(in_6_y_uv_vectors[0], groups_0_1);
+	uv = _mm256_permutevar8x32_epi32(in_6_y_uv_vectors[1], groups_0_1);
+	_mm256_storeu_si256((__m256i *) output, pack_2_y_uv_vectors_to_2_v210_groups_avx2(y, uv));
+
+	// Groups 2 & 3: pixels 12 - 23
+	y = _mm256_blend_epi32(_mm256_permutevar8x32_epi32(in_6_y_uv_vectors[2], groups_2_3_hi), _mm256_permutevar8x32_epi32(in_6_y_uv_vectors[0], groups_2_3_lo), 0x03);
+	uv = _mm256_blend_epi32(_mm256_permutevar8x32_epi32(in_6_y_uv_vectors[3], groups_2_3_hi), _mm256_permutevar8x32_epi32(in_6_y_uv_vectors[1], groups_2_3_lo), 0x03);
+	_mm256_storeu_si256((__m256i *) (output + 32), pack_2_y_uv_vectors_to_2_v210_groups_avx2(y, uv));
+
+	// Groups 4 & 5: pixels 24 - 35
+	y = _mm256_blend_epi32(_mm256_permutevar8x32_epi32(in_6_y_uv_vectors[2], groups_4_5_lo), _mm256_permutevar8x32_epi32(in_6_y_uv_vectors[4], groups_4_5_hi), 0x60);
+	uv = _mm256_blend_epi32(_mm256_permutevar8x32_epi32(in_6_y_uv_vectors[3], groups_4_5_lo), _mm256_permutevar8x32_epi32(in_6_y_uv_vectors[5], groups_4_5_hi), 0x60);
+	_mm256_storeu_si256((__m256i *) (output + 64), pack_2_y_uv_vectors_to_2_v210_groups_avx2(y, uv));
+
+	// Groups 6 & 7: pixels 36 - 47
+	y = _mm256_permutevar8x32_epi32(in_6_y_uv_vectors[4], groups_6_7);
+	uv = _mm256_permutevar8x32_epi32(in_6_y_uv_vectors[5], groups_6_7);
+	_mm256_storeu_si256((__m256i *) (output + 96), pack_2_y_uv_vectors_to_2_v210_groups_avx2(y, uv));
+}
+
+
+/*
+ * Repack 16 YUYV pixels (32 bytes) to UYVY or 16 UYVY pixels to YUYV, by
+ * swapping the 2 bytes of each 16-bit word.
+ */
+EXTERN_INLINE void	repack_yuv422i_to_yuv422i_avx2(uint8_t* input, uint8_t* output) {
+	__m256i		shuffle_swap_bytes = _mm256_setr_epi8(
+			1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14,
+			1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
+
+	_mm256_storeu_si256((__m256i *) output, _mm256_shuffle_epi8(_mm256_loadu_si256((__m256i *) input), shuffle_swap_bytes));
+}
+
+#endif	// __INTEL_CPU__
+
+#endif /* YUV_PACK_AVX2_H_ */
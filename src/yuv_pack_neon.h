@@ -0,0 +1,122 @@
+/*
+ * yuv_pack_neon.h
+ *
+ * Copyright (C) 2011 PixFC Team (pixelfc@gmail.com)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public  License as published by the
+ * Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef YUV_PACK_NEON_H_
+#define YUV_PACK_NEON_H_
+
+#include "debug_support.h"
+#include "platform_util.h"
+
+#ifdef __NEON_CPU__
+
+#include <arm_neon.h>
+
+/*
+ * The NEON inlines below store 1 vector of 16 Y and 2 vectors of 8 U & V
+ * (as returned by the rgb_to_yuv_convert_neon.h inlines) with interleaving
+ * stores (VST2 / VST4), which have no alignment requirement.
+ *
+ * INPUT:
+ * Y1	Y2	Y3	...	Y16
+ * U12	U34	U56	...	U1516
+ * V12	V34	V56	...	V1516
+ */
+
+/*
+ * OUTPUT:
+ * 32 bytes: Y1 U12 Y2 V12	Y3 U34 Y4 V34	...	Y15 U1516 Y16 V1516
+ */
+EXTERN_INLINE void	pack_y_uv_vectors_to_yuyv_neon(uint8x16_t* in_1_v8u_y_vector, uint8x8_t* in_2_v8u_uv_vectors, uint8_t* out) {
+	uint8x8x2_t		y = vuzp_u8(vget_low_u8(*in_1_v8u_y_vector), vget_high_u8(*in_1_v8u_y_vector));
+	uint8x8x4_t		yuyv;
+
+	yuyv.val[0] = y.val[0];
+	yuyv.val[1] = in_2_v8u_uv_vectors[0];
+	yuyv.val[2] = y.val[1];
+	yuyv.val[3] = in_2_v8u_uv_vectors[1];
+	vst4_u8(out, yuyv);
+}
+
+/*
+ * OUTPUT:
+ * 32 bytes: U12 Y1 V12 Y2	U34 Y3 V34 Y4	...	U1516 Y15 V1516 Y16
+ */
+EXTERN_INLINE void	pack_y_uv_vectors_to_uyvy_neon(uint8x16_t* in_1_v8u_y_vector, uint8x8_t* in_2_v8u_uv_vectors, uint8_t* out) {
+	uint8x8x2_t		y = vuzp_u8(vget_low_u8(*in_1_v8u_y_vector), vget_high_u8(*in_1_v8u_y_vector));
+	uint8x8x4_t		uyvy;
+
+	uyvy.val[0] = in_2_v8u_uv_vectors[0];
+	uyvy.val[1] = y.val[0];
+	uyvy.val[2] = in_2_v8u_uv_vectors[1];
+	uyvy.val[3] = y.val[1];
+	vst4_u8(out, uyvy);
+}
+
+/*
+ * OUTPUT:
+ * 16 bytes of Y at 'y_out', 8 bytes of U at 'u_out' and 8 bytes of V at 'v_out'
+ */
+EXTERN_INLINE void	pack_y_uv_vectors_to_yuv422p_neon(uint8x16_t* in_1_v8u_y_vector, uint8x8_t* in_2_v8u_uv_vectors, uint8_t* y_out, uint8_t* u_out, uint8_t* v_out) {
+	vst1q_u8(y_out, *in_1_v8u_y_vector);
+	vst1_u8(u_out, in_2_v8u_uv_vectors[0]);
+	vst1_u8(v_out, in_2_v8u_uv_vectors[1]);
+}
+
+/*
+ * Store the chroma samples of 2 lines of 16 pixels (the Y samples of
+ * YUV420 formats are stored with vst1q_u8()).
+ */
+
+/*
+ * OUTPUT:
+ * 8 bytes of U at 'u_out' and 8 bytes of V at 'v_out'
+ */
+EXTERN_INLINE void	pack_uv_vectors_to_yuv420p_neon(uint8x8_t* in_2_v8u_uv_vectors, uint8_t* u_out, uint8_t* v_out) {
+	vst1_u8(u_out, in_2_v8u_uv_vectors[0]);
+	vst1_u8(v_out, in_2_v8u_uv_vectors[1]);
+}
+
+/*
+ * OUTPUT:
+ * 16 bytes: U12 V12	U34 V34		...		U1516 V1516
+ */
+EXTERN_INLINE void	pack_uv_vectors_to_nv12_neon(uint8x8_t* in_2_v8u_uv_vectors, uint8_t* out) {
+	uint8x8x2_t		uv;
+
+	uv.val[0] = in_2_v8u_uv_vectors[0];
+	uv.val[1] = in_2_v8u_uv_vectors[1];
+	vst2_u8(out, uv);
+}
+
+/*
+ * OUTPUT:
+ * 16 bytes: V12 U12	V34 U34		...		V1516 U1516
+ */
+EXTERN_INLINE void	pack_uv_vectors_to_nv21_neon(uint8x8_t* in_2_v8u_uv_vectors, uint8_t* out) {
+	uint8x8x2_t		vu;
+
+	vu.val[0] = in_2_v8u_uv_vectors[1];
+	vu.val[1] = in_2_v8u_uv_vectors[0];
+	vst2_u8(out, vu);
+}
+
+#endif	// __NEON_CPU__
+
+#endif /* YUV_PACK_NEON_H_ */
@@ -45,6 +45,23 @@
 #undef YUVP_Y_INPUT_VECT
 #undef YUVP_U_INPUT_VECT
 #undef YUVP_V_INPUT_VECT
+#undef UNALIGNED_YUVSP_INPUT_PREAMBLE
+#undef UNALIGNED_YUVSP_UV_INPUT_PREAMBLE
+#undef UNALIGNED_YUVSP_Y_INPUT_VECT
+#undef UNALIGNED_YUVSP_UV_INPUT_VECT
+#undef UNALIGNED_YUVI_2_LINES_INPUT_PREAMBLE
+#undef UNALIGNED_YUVI_LINE1_INPUT_VECT
+#undef UNALIGNED_YUVI_LINE2_INPUT_VECT
+#undef YUVSP_Y_INPUT_VECT
+#undef YUVSP_UV_INPUT_VECT
+#undef YUVI_LINE1_INPUT_VECT
+#undef YUVI_LINE2_INPUT_VECT
+#undef KEEP_CHROMA_ORDER
+#undef SWAP_CHROMA_ORDER
+#undef AVERAGE_LINES
+#undef FIRST_LINE
+#undef EVEN_BYTES
+#undef ODD_BYTES
 #undef NOOP
 
 
@@ -65,6 +82,17 @@
 #define UNALIGNED_YUVP_U_INPUT_VECT				&aligned_u_vector
 #define UNALIGNED_YUVP_V_INPUT_VECT				&aligned_v_vector
 
+// Semi-planar YUV
+#define UNALIGNED_YUVSP_INPUT_PREAMBLE			DECLARE_VECT_ARRAY2_N_UNALIGN_LOAD(aligned_y_vector, y_input); DECLARE_VECT_ARRAY2_N_UNALIGN_LOAD(aligned_uv_vector, uv_input)
+#define UNALIGNED_YUVSP_UV_INPUT_PREAMBLE		DECLARE_VECT_ARRAY2_N_UNALIGN_LOAD(aligned_uv_vector, uv_input)
+#define UNALIGNED_YUVSP_Y_INPUT_VECT			aligned_y_vector
+#define UNALIGNED_YUVSP_UV_INPUT_VECT			aligned_uv_vector
+
+// Two lines of interleaved YUV
+#define UNALIGNED_YUVI_2_LINES_INPUT_PREAMBLE	DECLARE_VECT_ARRAY4_N_UNALIGN_LOAD(aligned_line1_vector, line1_input); DECLARE_VECT_ARRAY4_N_UNALIGN_LOAD(aligned_line2_vector, line2_input)
+#define UNALIGNED_YUVI_LINE1_INPUT_VECT			aligned_line1_vector
+#define UNALIGNED_YUVI_LINE2_INPUT_VECT			aligned_line2_vector
+
 #define UNALIGNED_STORE(src, dst)				_mm_storeu_si128(&(dst), (src))
 #define ALIGNED_STORE(src, dst)					(dst) = (src)
 
@@ -75,8 +103,34 @@
 #define YUVP_Y_INPUT_VECT						y_input
 #define YUVP_U_INPUT_VECT						u_input
 #define YUVP_V_INPUT_VECT						v_input
+#define YUVSP_Y_INPUT_VECT						y_input
+#define YUVSP_UV_INPUT_VECT						uv_input
+#define YUVI_LINE1_INPUT_VECT					line1_input
+#define YUVI_LINE2_INPUT_VECT					line2_input
 #define NOOP
 
+/*
+ * Chroma byte order in semi-planar formats: NV12 stores U first, NV21 V first.
+ * Swapping is done by exchanging the 2 bytes of each 16-bit chroma pair.
+ */
+#define KEEP_CHROMA_ORDER(vect)					(vect)
+#define SWAP_CHROMA_ORDER(vect)					_mm_or_si128(_mm_slli_epi16((vect), 8), _mm_srli_epi16((vect), 8))
+
+/*
+ * Luma / chroma byte selection in interleaved formats: YUYV stores luma in
+ * even bytes and chroma in odd bytes, UYVY the other way around.
+ * Both leave the selected bytes in the low half of each 16-bit word.
+ */
+#define EVEN_BYTES(vect)						_mm_and_si128((vect), _M(mask_even_bytes))
+#define ODD_BYTES(vect)							_mm_srli_epi16((vect), 8)
+
+/*
+ * Vertical chroma resampling when going from 2 lines of YUV 4:2:2 to 1 line of
+ * 4:2:0 chroma: either average both lines or keep the first one (NNB).
+ */
+#define AVERAGE_LINES(line1, line2)				_mm_avg_epu8((line1), (line2))
+#define FIRST_LINE(line1, line2)				(line1)
+
 
 
 /*
@@ -564,6 +618,466 @@ DEFINE_SSE2_SSSE3_YUV422I_TO_YUV422P_REPACK_INLINE(unaligned_src_repack_uyvy_to_
 DEFINE_SSE2_SSSE3_YUV422I_TO_YUV422P_REPACK_INLINE(unaligned_dst_repack_uyvy_to_yuv422p_, 0x0F0D0B0907050301LL, 0xFFFFFFFF0C080400LL, 0x0C080400FFFFFFFFLL, 0xFFFFFFFF0E0A0602LL, 0x0E0A0602FFFFFFFFLL, NOOP, ALIGNED_YUVI_INPUT_VECT, UNALIGNED_STORE)
 DEFINE_SSE2_SSSE3_YUV422I_TO_YUV422P_REPACK_INLINE(unaligned_src_unaligned_dst_repack_uyvy_to_yuv422p_, 0x0F0D0B0907050301LL, 0xFFFFFFFF0C080400LL, 0x0C080400FFFFFFFFLL, 0xFFFFFFFF0E0A0602LL, 0x0E0A0602FFFFFFFFLL, UNALIGNED_YUVI_INPUT_PREAMBLE, UNALIGNED_YUVI_INPUT_VECT, UNALIGNED_STORE)
 
+
+/*
+ *
+ * 		Y U Y V  /  U Y V Y
+ *
+ * 		T O
+ *
+ * 		U Y V Y  /  Y U Y V
+ *
+ *
+ */
+#define DEFINE_SSE2_YUV422I_TO_YUV422I_REPACK_INLINE(inline_fn_prefix, preamble, yuv422i_input, store_op)\
+EXTERN_INLINE void inline_fn_prefix##sse2(__m128i* input, __m128i* output)\
+{\
+	preamble;\
+	store_op(_mm_or_si128(_mm_slli_epi16((yuv422i_input)[0], 8), _mm_srli_epi16((yuv422i_input)[0], 8)), output[0]);\
+	store_op(_mm_or_si128(_mm_slli_epi16((yuv422i_input)[1], 8), _mm_srli_epi16((yuv422i_input)[1], 8)), output[1]);\
+	store_op(_mm_or_si128(_mm_slli_epi16((yuv422i_input)[2], 8), _mm_srli_epi16((yuv422i_input)[2], 8)), output[2]);\
+	store_op(_mm_or_si128(_mm_slli_epi16((yuv422i_input)[3], 8), _mm_srli_epi16((yuv422i_input)[3], 8)), output[3]);\
+}
+
+#define DEFINE_SSE2_SSSE3_YUV422I_TO_YUV422I_REPACK_INLINE(inline_fn_prefix, preamble, yuv422i_input, store_op)\
+EXTERN_INLINE void inline_fn_prefix##sse2_ssse3(__m128i* input, __m128i* output)\
+{\
+	CONST_M128I(shuf_swap_bytes, 0x0607040502030001LL, 0x0E0F0C0D0A0B0809LL);\
+	preamble;\
+	store_op(_mm_shuffle_epi8((yuv422i_input)[0], _M(shuf_swap_bytes)), output[0]);\
+	store_op(_mm_shuffle_epi8((yuv422i_input)[1], _M(shuf_swap_bytes)), output[1]);\
+	store_op(_mm_shuffle_epi8((yuv422i_input)[2], _M(shuf_swap_bytes)), output[2]);\
+	store_op(_mm_shuffle_epi8((yuv422i_input)[3], _M(shuf_swap_bytes)), output[3]);\
+}
+
+
+/*
+ * Convert YUYV to UYVY, or UYVY to YUYV:
+ * 4 vectors of 16 char YUYV to 4 vectors of 16 char UYVY (or the other way
+ * around) by swapping the 2 bytes of each 16-bit word.
+ *
+ * Total latency:				12 (SSE2) - 4 (SSSE3)
+ * Number of pixels handled:	32
+ *
+ * INPUT
+ * 4 vectors of 16 char
+ * Y1 U1	Y2 V1	Y3 U2	Y4 V2	Y5 U3	Y6 V3	Y7 U4	Y8 V4
+ * Y9 U5	Y10 V5	Y11 U6	Y12 V6	Y13 U7	Y14 V7	Y15 U8	Y16 V8
+ * Y17 U9	Y18 V9	Y19 U10	Y20 V10	Y21 U11	Y22 V11	Y23 U12	Y24 V12
+ * Y25 U13	Y26 V13	Y27 U14	Y28 V14	Y29 U15	Y30 V15	Y31 U16	Y32 V16
+ *
+ *
+ * OUTPUT:
+ * 4 vectors of 16 char
+ * U1 Y1	V1 Y2	U2 Y3	V2 Y4	U3 Y5	V3 Y6	U4 Y7	V4 Y8
+ * U5 Y9	V5 Y10	U6 Y11	V6 Y12	U7 Y13	V7 Y14	U8 Y15	V8 Y16
+ * U9 Y17	V9 Y18	U10 Y19	V10 Y20	U11 Y21	V11 Y22	U12 Y23	V12 Y24
+ * U13 Y25	V13 Y26	U14 Y27	V14 Y28	U15 Y29	V15 Y30	U16 Y31	V16 Y32
+ *
+ */
+DEFINE_SSE2_YUV422I_TO_YUV422I_REPACK_INLINE(repack_yuv422i_to_yuv422i_, NOOP, ALIGNED_YUVI_INPUT_VECT, ALIGNED_STORE)
+DEFINE_SSE2_YUV422I_TO_YUV422I_REPACK_INLINE(unaligned_src_repack_yuv422i_to_yuv422i_, UNALIGNED_YUVI_INPUT_PREAMBLE, UNALIGNED_YUVI_INPUT_VECT, ALIGNED_STORE)
+DEFINE_SSE2_YUV422I_TO_YUV422I_REPACK_INLINE(unaligned_dst_repack_yuv422i_to_yuv422i_, NOOP, ALIGNED_YUVI_INPUT_VECT, UNALIGNED_STORE)
+DEFINE_SSE2_YUV422I_TO_YUV422I_REPACK_INLINE(unaligned_src_unaligned_dst_repack_yuv422i_to_yuv422i_, UNALIGNED_YUVI_INPUT_PREAMBLE, UNALIGNED_YUVI_INPUT_VECT, UNALIGNED_STORE)
+
+DEFINE_SSE2_SSSE3_YUV422I_TO_YUV422I_REPACK_INLINE(repack_yuv422i_to_yuv422i_, NOOP, ALIGNED_YUVI_INPUT_VECT, ALIGNED_STORE)
+DEFINE_SSE2_SSSE3_YUV422I_TO_YUV422I_REPACK_INLINE(unaligned_src_repack_yuv422i_to_yuv422i_, UNALIGNED_YUVI_INPUT_PREAMBLE, UNALIGNED_YUVI_INPUT_VECT, ALIGNED_STORE)
+DEFINE_SSE2_SSSE3_YUV422I_TO_YUV422I_REPACK_INLINE(unaligned_dst_repack_yuv422i_to_yuv422i_, NOOP, ALIGNED_YUVI_INPUT_VECT, UNALIGNED_STORE)
+DEFINE_SSE2_SSSE3_YUV422I_TO_YUV422I_REPACK_INLINE(unaligned_src_unaligned_dst_repack_yuv422i_to_yuv422i_, UNALIGNED_YUVI_INPUT_PREAMBLE, UNALIGNED_YUVI_INPUT_VECT, UNALIGNED_STORE)
+
+
+
+/*
+ *
+ * 		N V 1 2  /  N V 2 1
+ *
+ * 		T O
+ *
+ * 		Y U Y V
+ *
+ *
+ */
+#define DEFINE_SSE2_NV12_TO_YUYV_REPACK_INLINE(inline_fn_prefix, chroma_order, preamble, y_vect, uv_vect, store_op)\
+EXTERN_INLINE void inline_fn_prefix##sse2( __m128i* y_input, __m128i* uv_input, __m128i* yuyv_out)\
+{\
+	M128I(scratch, 0x0LL, 0x0LL);\
+	preamble;\
+	_M(scratch) = chroma_order((uv_vect)[0]);\
+	store_op(_mm_unpacklo_epi8((y_vect)[0], _M(scratch)), yuyv_out[0]);\
+	store_op(_mm_unpackhi_epi8((y_vect)[0], _M(scratch)), yuyv_out[1]);\
+	_M(scratch) = chroma_order((uv_vect)[1]);\
+	store_op(_mm_unpacklo_epi8((y_vect)[1], _M(scratch)), yuyv_out[2]);\
+	store_op(_mm_unpackhi_epi8((y_vect)[1], _M(scratch)), yuyv_out[3]);\
+}
+
+
+/*
+ * Convert one line of NV12 to YUYV:
+ * 4 vectors of 16 char: 2xY, 2xUV to 4 vectors of 16 char YUYV
+ * (the NV21 variants swap the VU pairs first)
+ *
+ * Total latency:				4 (NV12) - 10 (NV21)
+ * Number of pixels handled:	32
+ *
+ * INPUT
+ * 4 vectors of 16 char
+ * y_input
+ * Y1 Y2	Y3 Y4	Y5 Y6	Y7 Y8	Y9 Y10	Y11 Y12 Y13 Y14	Y15 Y16
+ * Y17 Y18	Y19 Y20	Y21 Y22	Y23 Y24	Y25 Y26	Y27 Y28 Y29 Y30	Y31 Y32
+ *
+ * uv_input
+ * U1 V1	U2 V2	U3 V3	U4 V4	U5 V5	U6 V6	U7 V7	U8 V8
+ * U9 V9	U10 V10	U11 V11	U12 V12	U13 V13	U14 V14	U15 V15	U16 V16
+ *
+ *
+ * OUTPUT:
+ *
+ * 4 vectors of 16 char
+ * Y1 U1	Y2 V1	Y3 U2	Y4 V2	Y5 U3	Y6 V3	Y7 U4	Y8 V4
+ * Y9 U5	Y10 V5	Y11 U6	Y12 V6	Y13 U7	Y14 V7	Y15 U8	Y16 V8
+ * Y17 U9	Y18 V9	Y19 U10	Y20 V10	Y21 U11	Y22 V11	Y23 U12	Y24 V12
+ * Y25 U13	Y26 V13	Y27 U14	Y28 V14	Y29 U15	Y30 V15	Y31 U16	Y32 V16
+ *
+ */
+DEFINE_SSE2_NV12_TO_YUYV_REPACK_INLINE(repack_nv12_to_yuyv_, KEEP_CHROMA_ORDER, NOOP, YUVSP_Y_INPUT_VECT, YUVSP_UV_INPUT_VECT, ALIGNED_STORE)
+DEFINE_SSE2_NV12_TO_YUYV_REPACK_INLINE(unaligned_src_repack_nv12_to_yuyv_, KEEP_CHROMA_ORDER, UNALIGNED_YUVSP_INPUT_PREAMBLE, UNALIGNED_YUVSP_Y_INPUT_VECT, UNALIGNED_YUVSP_UV_INPUT_VECT, ALIGNED_STORE)
+DEFINE_SSE2_NV12_TO_YUYV_REPACK_INLINE(unaligned_dst_repack_nv12_to_yuyv_, KEEP_CHROMA_ORDER, NOOP, YUVSP_Y_INPUT_VECT, YUVSP_UV_INPUT_VECT, UNALIGNED_STORE)
+DEFINE_SSE2_NV12_TO_YUYV_REPACK_INLINE(unaligned_src_unaligned_dst_repack_nv12_to_yuyv_, KEEP_CHROMA_ORDER, UNALIGNED_YUVSP_INPUT_PREAMBLE, UNALIGNED_YUVSP_Y_INPUT_VECT, UNALIGNED_YUVSP_UV_INPUT_VECT, UNALIGNED_STORE)
+
+DEFINE_SSE2_NV12_TO_YUYV_REPACK_INLINE(repack_nv21_to_yuyv_, SWAP_CHROMA_ORDER, NOOP, YUVSP_Y_INPUT_VECT, YUVSP_UV_INPUT_VECT, ALIGNED_STORE)
+DEFINE_SSE2_NV12_TO_YUYV_REPACK_INLINE(unaligned_src_repack_nv21_to_yuyv_, SWAP_CHROMA_ORDER, UNALIGNED_YUVSP_INPUT_PREAMBLE, UNALIGNED_YUVSP_Y_INPUT_VECT, UNALIGNED_YUVSP_UV_INPUT_VECT, ALIGNED_STORE)
+DEFINE_SSE2_NV12_TO_YUYV_REPACK_INLINE(unaligned_dst_repack_nv21_to_yuyv_, SWAP_CHROMA_ORDER, NOOP, YUVSP_Y_INPUT_VECT, YUVSP_UV_INPUT_VECT, UNALIGNED_STORE)
+DEFINE_SSE2_NV12_TO_YUYV_REPACK_INLINE(unaligned_src_unaligned_dst_repack_nv21_to_yuyv_, SWAP_CHROMA_ORDER, UNALIGNED_YUVSP_INPUT_PREAMBLE, UNALIGNED_YUVSP_Y_INPUT_VECT, UNALIGNED_YUVSP_UV_INPUT_VECT, UNALIGNED_STORE)
+
+
+
+/*
+ *
+ * 		N V 1 2  /  N V 2 1
+ *
+ * 		T O
+ *
+ * 		U Y V Y
+ *
+ *
+ */
+#define DEFINE_SSE2_NV12_TO_UYVY_REPACK_INLINE(inline_fn_prefix, chroma_order, preamble, y_vect, uv_vect, store_op)\
+EXTERN_INLINE void inline_fn_prefix##sse2( __m128i* y_input, __m128i* uv_input, __m128i* uyvy_out)\
+{\
+	M128I(scratch, 0x0LL, 0x0LL);\
+	preamble;\
+	_M(scratch) = chroma_order((uv_vect)[0]);\
+	store_op(_mm_unpacklo_epi8(_M(scratch), (y_vect)[0]), uyvy_out[0]);\
+	store_op(_mm_unpackhi_epi8(_M(scratch), (y_vect)[0]), uyvy_out[1]);\
+	_M(scratch) = chroma_order((uv_vect)[1]);\
+	store_op(_mm_unpacklo_epi8(_M(scratch), (y_vect)[1]), uyvy_out[2]);\
+	store_op(_mm_unpackhi_epi8(_M(scratch), (y_vect)[1]), uyvy_out[3]);\
+}
+
+
+/*
+ * Convert one line of NV12 to UYVY:
+ * 4 vectors of 16 char: 2xY, 2xUV to 4 vectors of 16 char UYVY
+ * (the NV21 variants swap the VU pairs first)
+ *
+ * Total latency:				4 (NV12) - 10 (NV21)
+ * Number of pixels handled:	32
+ *
+ * INPUT
+ * 4 vectors of 16 char
+ * y_input
+ * Y1 Y2	Y3 Y4	Y5 Y6	Y7 Y8	Y9 Y10	Y11 Y12 Y13 Y14	Y15 Y16
+ * Y17 Y18	Y19 Y20	Y21 Y22	Y23 Y24	Y25 Y26	Y27 Y28 Y29 Y30	Y31 Y32
+ *
+ * uv_input
+ * U1 V1	U2 V2	U3 V3	U4 V4	U5 V5	U6 V6	U7 V7	U8 V8
+ * U9 V9	U10 V10	U11 V11	U12 V12	U13 V13	U14 V14	U15 V15	U16 V16
+ *
+ *
+ * OUTPUT:
+ *
+ * 4 vectors of 16 char
+ * U1 Y1	V1 Y2	U2 Y3	V2 Y4	U3 Y5	V3 Y6	U4 Y7	V4 Y8
+ * U5 Y9	V5 Y10	U6 Y11	V6 Y12	U7 Y13	V7 Y14	U8 Y15	V8 Y16
+ * U9 Y17	V9 Y18	U10 Y19	V10 Y20	U11 Y21	V11 Y22	U12 Y23	V12 Y24
+ * U13 Y25	V13 Y26	U14 Y27	V14 Y28	U15 Y29	V15 Y30	U16 Y31	V16 Y32
+ *
+ */
+DEFINE_SSE2_NV12_TO_UYVY_REPACK_INLINE(repack_nv12_to_uyvy_, KEEP_CHROMA_ORDER, NOOP, YUVSP_Y_INPUT_VECT, YUVSP_UV_INPUT_VECT, ALIGNED_STORE)
+DEFINE_SSE2_NV12_TO_UYVY_REPACK_INLINE(unaligned_src_repack_nv12_to_uyvy_, KEEP_CHROMA_ORDER, UNALIGNED_YUVSP_INPUT_PREAMBLE, UNALIGNED_YUVSP_Y_INPUT_VECT, UNALIGNED_YUVSP_UV_INPUT_VECT, ALIGNED_STORE)
+DEFINE_SSE2_NV12_TO_UYVY_REPACK_INLINE(unaligned_dst_repack_nv12_to_uyvy_, KEEP_CHROMA_ORDER, NOOP, YUVSP_Y_INPUT_VECT, YUVSP_UV_INPUT_VECT, UNALIGNED_STORE)
+DEFINE_SSE2_NV12_TO_UYVY_REPACK_INLINE(unaligned_src_unaligned_dst_repack_nv12_to_uyvy_, KEEP_CHROMA_ORDER, UNALIGNED_YUVSP_INPUT_PREAMBLE, UNALIGNED_YUVSP_Y_INPUT_VECT, UNALIGNED_YUVSP_UV_INPUT_VECT, UNALIGNED_STORE)
+
+DEFINE_SSE2_NV12_TO_UYVY_REPACK_INLINE(repack_nv21_to_uyvy_, SWAP_CHROMA_ORDER, NOOP, YUVSP_Y_INPUT_VECT, YUVSP_UV_INPUT_VECT, ALIGNED_STORE)
+DEFINE_SSE2_NV12_TO_UYVY_REPACK_INLINE(unaligned_src_repack_nv21_to_uyvy_, SWAP_CHROMA_ORDER, UNALIGNED_YUVSP_INPUT_PREAMBLE, UNALIGNED_YUVSP_Y_INPUT_VECT, UNALIGNED_YUVSP_UV_INPUT_VECT, ALIGNED_STORE)
+DEFINE_SSE2_NV12_TO_UYVY_REPACK_INLINE(unaligned_dst_repack_nv21_to_uyvy_, SWAP_CHROMA_ORDER, NOOP, YUVSP_Y_INPUT_VECT, YUVSP_UV_INPUT_VECT, UNALIGNED_STORE)
+DEFINE_SSE2_NV12_TO_UYVY_REPACK_INLINE(unaligned_src_unaligned_dst_repack_nv21_to_uyvy_, SWAP_CHROMA_ORDER, UNALIGNED_YUVSP_INPUT_PREAMBLE, UNALIGNED_YUVSP_Y_INPUT_VECT, UNALIGNED_YUVSP_UV_INPUT_VECT, UNALIGNED_STORE)
+
+
+
+/*
+ *
+ * 		Y U Y V  /  U Y V Y
+ *
+ * 		T O
+ *
+ * 		N V 1 2  /  N V 2 1
+ *
+ *
+ */
+#define DEFINE_SSE2_YUV422I_TO_NV12_REPACK_INLINE(inline_fn_prefix, luma_bytes, chroma_bytes, chroma_order, preamble, line1_vect, line2_vect, store_op)\
+EXTERN_INLINE void inline_fn_prefix##sse2(__m128i* line1_input, __m128i* line2_input, __m128i* y_line1_output, __m128i* y_line2_output, __m128i* uv_output)\
+{\
+	CONST_M128I(mask_even_bytes, 0x00FF00FF00FF00FFLL, 0x00FF00FF00FF00FFLL);\
+	M128I(scratch, 0x0LL, 0x0LL);\
+	M128I(scratch2, 0x0LL, 0x0LL);\
+	preamble;\
+	store_op(_mm_packus_epi16(luma_bytes((line1_vect)[0]), luma_bytes((line1_vect)[1])), y_line1_output[0]);\
+	store_op(_mm_packus_epi16(luma_bytes((line1_vect)[2]), luma_bytes((line1_vect)[3])), y_line1_output[1]);\
+	store_op(_mm_packus_epi16(luma_bytes((line2_vect)[0]), luma_bytes((line2_vect)[1])), y_line2_output[0]);\
+	store_op(_mm_packus_epi16(luma_bytes((line2_vect)[2]), luma_bytes((line2_vect)[3])), y_line2_output[1]);\
+	_M(scratch) = chroma_bytes(_mm_avg_epu8((line1_vect)[0], (line2_vect)[0]));\
+	_M(scratch2) = chroma_bytes(_mm_avg_epu8((line1_vect)[1], (line2_vect)[1]));\
+	store_op(chroma_order(_mm_packus_epi16(_M(scratch), _M(scratch2))), uv_output[0]);\
+	_M(scratch) = chroma_bytes(_mm_avg_epu8((line1_vect)[2], (line2_vect)[2]));\
+	_M(scratch2) = chroma_bytes(_mm_avg_epu8((line1_vect)[3], (line2_vect)[3]));\
+	store_op(chroma_order(_mm_packus_epi16(_M(scratch), _M(scratch2))), uv_output[1]);\
+}
+
+
+/*
+ * Convert 2 lines of YUYV to NV12:
+ * 8 vectors of 16 char YUYV (4 per line) to 6 vectors of 16 char: 4xY, 2xUV
+ * The chroma samples of both lines are averaged.
+ * (the UYVY variants swap the luma / chroma bytes, the NV21 variants swap the
+ *  UV pairs on output)
+ *
+ * Total latency:				20 (NV12) - 26 (NV21)
+ * Number of pixels handled:	32 x 2 lines
+ *
+ * INPUT
+ * 2 x 4 vectors of 16 char
+ * line1_input / line2_input
+ * Y1 U1	Y2 V1	Y3 U2	Y4 V2	Y5 U3	Y6 V3	Y7 U4	Y8 V4
+ * Y9 U5	Y10 V5	Y11 U6	Y12 V6	Y13 U7	Y14 V7	Y15 U8	Y16 V8
+ * Y17 U9	Y18 V9	Y19 U10	Y20 V10	Y21 U11	Y22 V11	Y23 U12	Y24 V12
+ * Y25 U13	Y26 V13	Y27 U14	Y28 V14	Y29 U15	Y30 V15	Y31 U16	Y32 V16
+ *
+ *
+ * OUTPUT:
+ * 2 x 2 vectors of 16 char
+ * y_line1_output / y_line2_output
+ * Y1 Y2	Y3 Y4	Y5 Y6	Y7 Y8	Y9 Y10	Y11 Y12 Y13 Y14	Y15 Y16
+ * Y17 Y18	Y19 Y20	Y21 Y22	Y23 Y24	Y25 Y26	Y27 Y28 Y29 Y30	Y31 Y32
+ *
+ * 2 vectors of 16 char
+ * uv_output
+ * U1 V1	U2 V2	U3 V3	U4 V4	U5 V5	U6 V6	U7 V7	U8 V8
+ * U9 V9	U10 V10	U11 V11	U12 V12	U13 V13	U14 V14	U15 V15	U16 V16
+ *
+ */
+DEFINE_SSE2_YUV422I_TO_NV12_REPACK_INLINE(repack_yuyv_to_nv12_, EVEN_BYTES, ODD_BYTES, KEEP_CHROMA_ORDER, NOOP, YUVI_LINE1_INPUT_VECT, YUVI_LINE2_INPUT_VECT, ALIGNED_STORE)
+DEFINE_SSE2_YUV422I_TO_NV12_REPACK_INLINE(unaligned_src_repack_yuyv_to_nv12_, EVEN_BYTES, ODD_BYTES, KEEP_CHROMA_ORDER, UNALIGNED_YUVI_2_LINES_INPUT_PREAMBLE, UNALIGNED_YUVI_LINE1_INPUT_VECT, UNALIGNED_YUVI_LINE2_INPUT_VECT, ALIGNED_STORE)
+DEFINE_SSE2_YUV422I_TO_NV12_REPACK_INLINE(unaligned_dst_repack_yuyv_to_nv12_, EVEN_BYTES, ODD_BYTES, KEEP_CHROMA_ORDER, NOOP, YUVI_LINE1_INPUT_VECT, YUVI_LINE2_INPUT_VECT, UNALIGNED_STORE)
+DEFINE_SSE2_YUV422I_TO_NV12_REPACK_INLINE(unaligned_src_unaligned_dst_repack_yuyv_to_nv12_, EVEN_BYTES, ODD_BYTES, KEEP_CHROMA_ORDER, UNALIGNED_YUVI_2_LINES_INPUT_PREAMBLE, UNALIGNED_YUVI_LINE1_INPUT_VECT, UNALIGNED_YUVI_LINE2_INPUT_VECT, UNALIGNED_STORE)
+
+DEFINE_SSE2_YUV422I_TO_NV12_REPACK_INLINE(repack_yuyv_to_nv21_, EVEN_BYTES, ODD_BYTES, SWAP_CHROMA_ORDER, NOOP, YUVI_LINE1_INPUT_VECT, YUVI_LINE2_INPUT_VECT, ALIGNED_STORE)
+DEFINE_SSE2_YUV422I_TO_NV12_REPACK_INLINE(unaligned_src_repack_yuyv_to_nv21_, EVEN_BYTES, ODD_BYTES, SWAP_CHROMA_ORDER, UNALIGNED_YUVI_2_LINES_INPUT_PREAMBLE, UNALIGNED_YUVI_LINE1_INPUT_VECT, UNALIGNED_YUVI_LINE2_INPUT_VECT, ALIGNED_STORE)
+DEFINE_SSE2_YUV422I_TO_NV12_REPACK_INLINE(unaligned_dst_repack_yuyv_to_nv21_, EVEN_BYTES, ODD_BYTES, SWAP_CHROMA_ORDER, NOOP, YUVI_LINE1_INPUT_VECT, YUVI_LINE2_INPUT_VECT, UNALIGNED_STORE)
+DEFINE_SSE2_YUV422I_TO_NV12_REPACK_INLINE(unaligned_src_unaligned_dst_repack_yuyv_to_nv21_, EVEN_BYTES, ODD_BYTES, SWAP_CHROMA_ORDER, UNALIGNED_YUVI_2_LINES_INPUT_PREAMBLE, UNALIGNED_YUVI_LINE1_INPUT_VECT, UNALIGNED_YUVI_LINE2_INPUT_VECT, UNALIGNED_STORE)
+
+DEFINE_SSE2_YUV422I_TO_NV12_REPACK_INLINE(repack_uyvy_to_nv12_, ODD_BYTES, EVEN_BYTES, KEEP_CHROMA_ORDER, NOOP, YUVI_LINE1_INPUT_VECT, YUVI_LINE2_INPUT_VECT, ALIGNED_STORE)
+DEFINE_SSE2_YUV422I_TO_NV12_REPACK_INLINE(unaligned_src_repack_uyvy_to_nv12_, ODD_BYTES, EVEN_BYTES, KEEP_CHROMA_ORDER, UNALIGNED_YUVI_2_LINES_INPUT_PREAMBLE, UNALIGNED_YUVI_LINE1_INPUT_VECT, UNALIGNED_YUVI_LINE2_INPUT_VECT, ALIGNED_STORE)
+DEFINE_SSE2_YUV422I_TO_NV12_REPACK_INLINE(unaligned_dst_repack_uyvy_to_nv12_, ODD_BYTES, EVEN_BYTES, KEEP_CHROMA_ORDER, NOOP, YUVI_LINE1_INPUT_VECT, YUVI_LINE2_INPUT_VECT, UNALIGNED_STORE)
+DEFINE_SSE2_YUV422I_TO_NV12_REPACK_INLINE(unaligned_src_unaligned_dst_repack_uyvy_to_nv12_, ODD_BYTES, EVEN_BYTES, KEEP_CHROMA_ORDER, UNALIGNED_YUVI_2_LINES_INPUT_PREAMBLE, UNALIGNED_YUVI_LINE1_INPUT_VECT, UNALIGNED_YUVI_LINE2_INPUT_VECT, UNALIGNED_STORE)
+
+DEFINE_SSE2_YUV422I_TO_NV12_REPACK_INLINE(repack_uyvy_to_nv21_, ODD_BYTES, EVEN_BYTES, SWAP_CHROMA_ORDER, NOOP, YUVI_LINE1_INPUT_VECT, YUVI_LINE2_INPUT_VECT, ALIGNED_STORE)
+DEFINE_SSE2_YUV422I_TO_NV12_REPACK_INLINE(unaligned_src_repack_uyvy_to_nv21_, ODD_BYTES, EVEN_BYTES, SWAP_CHROMA_ORDER, UNALIGNED_YUVI_2_LINES_INPUT_PREAMBLE, UNALIGNED_YUVI_LINE1_INPUT_VECT, UNALIGNED_YUVI_LINE2_INPUT_VECT, ALIGNED_STORE)
+DEFINE_SSE2_YUV422I_TO_NV12_REPACK_INLINE(unaligned_dst_repack_uyvy_to_nv21_, ODD_BYTES, EVEN_BYTES, SWAP_CHROMA_ORDER, NOOP, YUVI_LINE1_INPUT_VECT, YUVI_LINE2_INPUT_VECT, UNALIGNED_STORE)
+DEFINE_SSE2_YUV422I_TO_NV12_REPACK_INLINE(unaligned_src_unaligned_dst_repack_uyvy_to_nv21_, ODD_BYTES, EVEN_BYTES, SWAP_CHROMA_ORDER, UNALIGNED_YUVI_2_LINES_INPUT_PREAMBLE, UNALIGNED_YUVI_LINE1_INPUT_VECT, UNALIGNED_YUVI_LINE2_INPUT_VECT, UNALIGNED_STORE)
+
+
+
+/*
+ *
+ * 		Y U Y V  /  U Y V Y
+ *
+ * 		T O
+ *
+ * 		Y U V 4 2 0 P
+ *
+ *
+ */
+#define DEFINE_SSE2_YUV422I_TO_YUV420P_REPACK_INLINE(inline_fn_prefix, luma_bytes, chroma_bytes, chroma_resampling, preamble, line1_vect, line2_vect, store_op)\
+EXTERN_INLINE void inline_fn_prefix##sse2(__m128i* line1_input, __m128i* line2_input, __m128i* y_line1_output, __m128i* y_line2_output, __m128i* u_output, __m128i* v_output)\
+{\
+	CONST_M128I(mask_even_bytes, 0x00FF00FF00FF00FFLL, 0x00FF00FF00FF00FFLL);\
+	M128I(scratch, 0x0LL, 0x0LL);\
+	M128I(scratch2, 0x0LL, 0x0LL);\
+	preamble;\
+	store_op(_mm_packus_epi16(luma_bytes((line1_vect)[0]), luma_bytes((line1_vect)[1])), y_line1_output[0]);\
+	store_op(_mm_packus_epi16(luma_bytes((line1_vect)[2]), luma_bytes((line1_vect)[3])), y_line1_output[1]);\
+	store_op(_mm_packus_epi16(luma_bytes((line2_vect)[0]), luma_bytes((line2_vect)[1])), y_line2_output[0]);\
+	store_op(_mm_packus_epi16(luma_bytes((line2_vect)[2]), luma_bytes((line2_vect)[3])), y_line2_output[1]);\
+	_M(scratch) = _mm_packus_epi16(chroma_bytes(chroma_resampling((line1_vect)[0], (line2_vect)[0])), chroma_bytes(chroma_resampling((line1_vect)[1], (line2_vect)[1])));\
+	_M(scratch2) = _mm_packus_epi16(chroma_bytes(chroma_resampling((line1_vect)[2], (line2_vect)[2])), chroma_bytes(chroma_resampling((line1_vect)[3], (line2_vect)[3])));\
+	store_op(_mm_packus_epi16(EVEN_BYTES(_M(scratch)), EVEN_BYTES(_M(scratch2))), u_output[0]);\
+	store_op(_mm_packus_epi16(ODD_BYTES(_M(scratch)), ODD_BYTES(_M(scratch2))), v_output[0]);\
+}
+
+
+/*
+ * Convert 2 lines of YUYV to YUV420P:
+ * 8 vectors of 16 char YUYV (4 per line) to 6 vectors of 16 char: 4xY, 1xU, 1xV
+ * The downsample_n_ variants average the chroma samples of both lines, the
+ * others keep the chroma samples of the first line.
+ * (the UYVY variants swap the luma / chroma bytes)
+ *
+ * Total latency:				22
+ * Number of pixels handled:	32 x 2 lines
+ *
+ * INPUT
+ * 2 x 4 vectors of 16 char
+ * line1_input / line2_input
+ * Y1 U1	Y2 V1	Y3 U2	Y4 V2	Y5 U3	Y6 V3	Y7 U4	Y8 V4
+ * Y9 U5	Y10 V5	Y11 U6	Y12 V6	Y13 U7	Y14 V7	Y15 U8	Y16 V8
+ * Y17 U9	Y18 V9	Y19 U10	Y20 V10	Y21 U11	Y22 V11	Y23 U12	Y24 V12
+ * Y25 U13	Y26 V13	Y27 U14	Y28 V14	Y29 U15	Y30 V15	Y31 U16	Y32 V16
+ *
+ *
+ * OUTPUT:
+ * 2 x 2 vectors of 16 char
+ * y_line1_output / y_line2_output
+ * Y1 Y2	Y3 Y4	Y5 Y6	Y7 Y8	Y9 Y10	Y11 Y12 Y13 Y14	Y15 Y16
+ * Y17 Y18	Y19 Y20	Y21 Y22	Y23 Y24	Y25 Y26	Y27 Y28 Y29 Y30	Y31 Y32
+ *
+ * u_output
+ * U1 U2	U3 U4 	U5 U6	U7 U8	U9 U10	U11 U12	U13 U14	U15 U16
+ *
+ * v_output
+ * V1 V2	V3 V4 	V5 V6	V7 V8	V9 V10	V11 V12	V13 V14	V15 V16
+ *
+ */
+DEFINE_SSE2_YUV422I_TO_YUV420P_REPACK_INLINE(repack_yuyv_to_yuv420p_, EVEN_BYTES, ODD_BYTES, FIRST_LINE, NOOP, YUVI_LINE1_INPUT_VECT, YUVI_LINE2_INPUT_VECT, ALIGNED_STORE)
+DEFINE_SSE2_YUV422I_TO_YUV420P_REPACK_INLINE(unaligned_src_repack_yuyv_to_yuv420p_, EVEN_BYTES, ODD_BYTES, FIRST_LINE, UNALIGNED_YUVI_2_LINES_INPUT_PREAMBLE, UNALIGNED_YUVI_LINE1_INPUT_VECT, UNALIGNED_YUVI_LINE2_INPUT_VECT, ALIGNED_STORE)
+DEFINE_SSE2_YUV422I_TO_YUV420P_REPACK_INLINE(unaligned_dst_repack_yuyv_to_yuv420p_, EVEN_BYTES, ODD_BYTES, FIRST_LINE, NOOP, YUVI_LINE1_INPUT_VECT, YUVI_LINE2_INPUT_VECT, UNALIGNED_STORE)
+DEFINE_SSE2_YUV422I_TO_YUV420P_REPACK_INLINE(unaligned_src_unaligned_dst_repack_yuyv_to_yuv420p_, EVEN_BYTES, ODD_BYTES, FIRST_LINE, UNALIGNED_YUVI_2_LINES_INPUT_PREAMBLE, UNALIGNED_YUVI_LINE1_INPUT_VECT, UNALIGNED_YUVI_LINE2_INPUT_VECT, UNALIGNED_STORE)
+
+DEFINE_SSE2_YUV422I_TO_YUV420P_REPACK_INLINE(downsample_n_repack_yuyv_to_yuv420p_, EVEN_BYTES, ODD_BYTES, AVERAGE_LINES, NOOP, YUVI_LINE1_INPUT_VECT, YUVI_LINE2_INPUT_VECT, ALIGNED_STORE)
+DEFINE_SSE2_YUV422I_TO_YUV420P_REPACK_INLINE(unaligned_src_downsample_n_repack_yuyv_to_yuv420p_, EVEN_BYTES, ODD_BYTES, AVERAGE_LINES, UNALIGNED_YUVI_2_LINES_INPUT_PREAMBLE, UNALIGNED_YUVI_LINE1_INPUT_VECT, UNALIGNED_YUVI_LINE2_INPUT_VECT, ALIGNED_STORE)
+DEFINE_SSE2_YUV422I_TO_YUV420P_REPACK_INLINE(unaligned_dst_downsample_n_repack_yuyv_to_yuv420p_, EVEN_BYTES, ODD_BYTES, AVERAGE_LINES, NOOP, YUVI_LINE1_INPUT_VECT, YUVI_LINE2_INPUT_VECT, UNALIGNED_STORE)
+DEFINE_SSE2_YUV422I_TO_YUV420P_REPACK_INLINE(unaligned_src_unaligned_dst_downsample_n_repack_yuyv_to_yuv420p_, EVEN_BYTES, ODD_BYTES, AVERAGE_LINES, UNALIGNED_YUVI_2_LINES_INPUT_PREAMBLE, UNALIGNED_YUVI_LINE1_INPUT_VECT, UNALIGNED_YUVI_LINE2_INPUT_VECT, UNALIGNED_STORE)
+
+DEFINE_SSE2_YUV422I_TO_YUV420P_REPACK_INLINE(repack_uyvy_to_yuv420p_, ODD_BYTES, EVEN_BYTES, FIRST_LINE, NOOP, YUVI_LINE1_INPUT_VECT, YUVI_LINE2_INPUT_VECT, ALIGNED_STORE)
+DEFINE_SSE2_YUV422I_TO_YUV420P_REPACK_INLINE(unaligned_src_repack_uyvy_to_yuv420p_, ODD_BYTES, EVEN_BYTES, FIRST_LINE, UNALIGNED_YUVI_2_LINES_INPUT_PREAMBLE, UNALIGNED_YUVI_LINE1_INPUT_VECT, UNALIGNED_YUVI_LINE2_INPUT_VECT, ALIGNED_STORE)
+DEFINE_SSE2_YUV422I_TO_YUV420P_REPACK_INLINE(unaligned_dst_repack_uyvy_to_yuv420p_, ODD_BYTES, EVEN_BYTES, FIRST_LINE, NOOP, YUVI_LINE1_INPUT_VECT, YUVI_LINE2_INPUT_VECT, UNALIGNED_STORE)
+DEFINE_SSE2_YUV422I_TO_YUV420P_REPACK_INLINE(unaligned_src_unaligned_dst_repack_uyvy_to_yuv420p_, ODD_BYTES, EVEN_BYTES, FIRST_LINE, UNALIGNED_YUVI_2_LINES_INPUT_PREAMBLE, UNALIGNED_YUVI_LINE1_INPUT_VECT, UNALIGNED_YUVI_LINE2_INPUT_VECT, UNALIGNED_STORE)
+
+DEFINE_SSE2_YUV422I_TO_YUV420P_REPACK_INLINE(downsample_n_repack_uyvy_to_yuv420p_, ODD_BYTES, EVEN_BYTES, AVERAGE_LINES, NOOP, YUVI_LINE1_INPUT_VECT, YUVI_LINE2_INPUT_VECT, ALIGNED_STORE)
+DEFINE_SSE2_YUV422I_TO_YUV420P_REPACK_INLINE(unaligned_src_downsample_n_repack_uyvy_to_yuv420p_, ODD_BYTES, EVEN_BYTES, AVERAGE_LINES, UNALIGNED_YUVI_2_LINES_INPUT_PREAMBLE, UNALIGNED_YUVI_LINE1_INPUT_VECT, UNALIGNED_YUVI_LINE2_INPUT_VECT, ALIGNED_STORE)
+DEFINE_SSE2_YUV422I_TO_YUV420P_REPACK_INLINE(unaligned_dst_downsample_n_repack_uyvy_to_yuv420p_, ODD_BYTES, EVEN_BYTES, AVERAGE_LINES, NOOP, YUVI_LINE1_INPUT_VECT, YUVI_LINE2_INPUT_VECT, UNALIGNED_STORE)
+DEFINE_SSE2_YUV422I_TO_YUV420P_REPACK_INLINE(unaligned_src_unaligned_dst_downsample_n_repack_uyvy_to_yuv420p_, ODD_BYTES, EVEN_BYTES, AVERAGE_LINES, UNALIGNED_YUVI_2_LINES_INPUT_PREAMBLE, UNALIGNED_YUVI_LINE1_INPUT_VECT, UNALIGNED_YUVI_LINE2_INPUT_VECT, UNALIGNED_STORE)
+
+
+
+/*
+ *
+ * 		Y U V 4 2 0 P
+ *
+ * 		T O
+ *
+ * 		N V 1 2
+ *
+ *
+ */
+#define DEFINE_SSE2_YUV420P_TO_NV12_REPACK_INLINE(inline_fn_prefix, preamble, u_vect, v_vect, store_op)\
+EXTERN_INLINE void inline_fn_prefix##sse2(__m128i* u_input, __m128i* v_input, __m128i* uv_output)\
+{\
+	preamble;\
+	store_op(_mm_unpacklo_epi8(*(u_vect), *(v_vect)), uv_output[0]);\
+	store_op(_mm_unpackhi_epi8(*(u_vect), *(v_vect)), uv_output[1]);\
+}
+
+
+/*
+ * Interleave 1 vector of U and 1 vector of V into 2 vectors of UV
+ * (NV21 is obtained by swapping the U and V inputs)
+ *
+ * Total latency:				2
+ * Number of pixels handled:	32 x 2 lines
+ *
+ * INPUT
+ * 2 vectors of 16 char
+ * u_input
+ * U1 U2	U3 U4 	U5 U6	U7 U8	U9 U10	U11 U12	U13 U14	U15 U16
+ *
+ * v_input
+ * V1 V2	V3 V4 	V5 V6	V7 V8	V9 V10	V11 V12	V13 V14	V15 V16
+ *
+ *
+ * OUTPUT:
+ * 2 vectors of 16 char
+ * uv_output
+ * U1 V1	U2 V2	U3 V3	U4 V4	U5 V5	U6 V6	U7 V7	U8 V8
+ * U9 V9	U10 V10	U11 V11	U12 V12	U13 V13	U14 V14	U15 V15	U16 V16
+ *
+ */
+DEFINE_SSE2_YUV420P_TO_NV12_REPACK_INLINE(repack_yuv420p_to_nv12_, NOOP, YUVP_U_INPUT_VECT, YUVP_V_INPUT_VECT, ALIGNED_STORE)
+DEFINE_SSE2_YUV420P_TO_NV12_REPACK_INLINE(unaligned_src_repack_yuv420p_to_nv12_, UNALIGNED_YUVP_UV_INPUT_PREAMBLE, UNALIGNED_YUVP_U_INPUT_VECT, UNALIGNED_YUVP_V_INPUT_VECT, ALIGNED_STORE)
+DEFINE_SSE2_YUV420P_TO_NV12_REPACK_INLINE(unaligned_dst_repack_yuv420p_to_nv12_, NOOP, YUVP_U_INPUT_VECT, YUVP_V_INPUT_VECT, UNALIGNED_STORE)
+DEFINE_SSE2_YUV420P_TO_NV12_REPACK_INLINE(unaligned_src_unaligned_dst_repack_yuv420p_to_nv12_, UNALIGNED_YUVP_UV_INPUT_PREAMBLE, UNALIGNED_YUVP_U_INPUT_VECT, UNALIGNED_YUVP_V_INPUT_VECT, UNALIGNED_STORE)
+
+
+
+/*
+ *
+ * 		N V 1 2
+ *
+ * 		T O
+ *
+ * 		Y U V 4 2 0 P
+ *
+ *
+ */
+#define DEFINE_SSE2_NV12_TO_YUV420P_REPACK_INLINE(inline_fn_prefix, preamble, uv_vect, store_op)\
+EXTERN_INLINE void inline_fn_prefix##sse2(__m128i* uv_input, __m128i* u_output, __m128i* v_output)\
+{\
+	CONST_M128I(mask_even_bytes, 0x00FF00FF00FF00FFLL, 0x00FF00FF00FF00FFLL);\
+	preamble;\
+	store_op(_mm_packus_epi16(EVEN_BYTES((uv_vect)[0]), EVEN_BYTES((uv_vect)[1])), *u_output);\
+	store_op(_mm_packus_epi16(ODD_BYTES((uv_vect)[0]), ODD_BYTES((uv_vect)[1])), *v_output);\
+}
+
+
+/*
+ * De-interleave 2 vectors of UV into 1 vector of U and 1 vector of V
+ * (NV21 is handled by swapping the U and V outputs)
+ *
+ * Total latency:				8
+ * Number of pixels handled:	32 x 2 lines
+ *
+ * INPUT
+ * 2 vectors of 16 char
+ * uv_input
+ * U1 V1	U2 V2	U3 V3	U4 V4	U5 V5	U6 V6	U7 V7	U8 V8
+ * U9 V9	U10 V10	U11 V11	U12 V12	U13 V13	U14 V14	U15 V15	U16 V16
+ *
+ *
+ * OUTPUT:
+ * 2 vectors of 16 char
+ * u_output
+ * U1 U2	U3 U4 	U5 U6	U7 U8	U9 U10	U11 U12	U13 U14	U15 U16
+ *
+ * v_output
+ * V1 V2	V3 V4 	V5 V6	V7 V8	V9 V10	V11 V12	V13 V14	V15 V16
+ *
+ */
+DEFINE_SSE2_NV12_TO_YUV420P_REPACK_INLINE(repack_nv12_to_yuv420p_, NOOP, YUVSP_UV_INPUT_VECT, ALIGNED_STORE)
+DEFINE_SSE2_NV12_TO_YUV420P_REPACK_INLINE(unaligned_src_repack_nv12_to_yuv420p_, UNALIGNED_YUVSP_UV_INPUT_PREAMBLE, UNALIGNED_YUVSP_UV_INPUT_VECT, ALIGNED_STORE)
+DEFINE_SSE2_NV12_TO_YUV420P_REPACK_INLINE(unaligned_dst_repack_nv12_to_yuv420p_, NOOP, YUVSP_UV_INPUT_VECT, UNALIGNED_STORE)
+DEFINE_SSE2_NV12_TO_YUV420P_REPACK_INLINE(unaligned_src_unaligned_dst_repack_nv12_to_yuv420p_, UNALIGNED_YUVSP_UV_INPUT_PREAMBLE, UNALIGNED_YUVSP_UV_INPUT_VECT, UNALIGNED_STORE)
+
+
 #endif	// __INTEL_CPU__
 
 #endif // YUV_REPACK_H_
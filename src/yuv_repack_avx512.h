@@ -0,0 +1,198 @@
+/*
+ * yuv_repack_avx512.h
+ *
+ * Copyright (C) 2011 PixFC Team (pixelfc@gmail.com)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public  License as published by the
+ * Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef YUV_REPACK_AVX512_H_
+#define YUV_REPACK_AVX512_H_
+
+#include "debug_support.h"
+#include "platform_util.h"
+
+#ifdef __INTEL_CPU__
+
+#include <immintrin.h>
+
+/*
+ * The AVX-512 inlines below repack 24 pixels between v210 (64 bytes) and
+ * YUYV / UYVY (48 bytes). They require AVX512F, AVX512BW and AVX512VBMI.
+ *
+ * Loads & stores are masked so the same inlines handle the last, partial
+ * group of pixels in a line: 'mask' has one bit per YUYV / UYVY byte to
+ * load or store (the first 48 bits for a full group), and 'v210_mask' one
+ * bit per v210 32-bit word to store (all 16 for a full group). v210 input
+ * is always read in full: v210 lines are padded to a multiple of 48 pixels
+ * (128 bytes).
+ *
+ * In a v210 line, the samples of a YUV422 line are stored in the order
+ * U0 Y0 V0 Y1 U2 Y2 ..., 3 per 32-bit word. UYVY stores them in the same
+ * order, one per byte, and YUYV swaps each pair of bytes. Conversions
+ * truncate 10-bit values to 8 bits, or shift 8-bit values left by 2.
+ */
+
+
+/*
+ * Convert 24 v210 pixels to 8-bit samples, using the given permutations
+ * and shifts (see the YUYV & UYVY versions below).
+ *
+ * TOTAL LATENCY:				~15
+ *
+ * INPUT:
+ * 64 bytes of v210
+ *
+ * OUTPUT:
+ * 48 bytes of YUYV or UYVY (or fewer, depending on 'mask')
+ */
+EXTERN_INLINE void	repack_24_v210_pixels_to_yuv422i_avx512(uint8_t* input, uint8_t* output, __mmask64 mask, __m512i gather_1_32, __m512i shift_1_32, __m512i gather_33_48, __m512i shift_33_48) {
+	// Index of the low byte of each 16-bit word in both vectors
+	__m512i		low_bytes = _mm512_setr_epi64(0x0E0C0A0806040200LL, 0x1E1C1A1816141210LL, 0x2E2C2A2826242220LL, 0x3E3C3A3836343230LL,
+												0x4E4C4A4846444240LL, 0x5E5C5A5856545250LL, 0x0LL, 0x0LL);
+	__m512i		v210 = _mm512_loadu_si512(input);								// VMOVDQU64	5	0.5
+	__m512i		samples_1_32;
+	__m512i		samples_33_48;
+
+	samples_1_32 = _mm512_permutexvar_epi8(gather_1_32, v210);					// VPERMB		3	1
+	samples_1_32 = _mm512_srlv_epi16(samples_1_32, shift_1_32);				// VPSRLVW		1	1
+	// 8-bit samples 1 - 32 in the low byte of each word
+
+	samples_33_48 = _mm512_permutexvar_epi8(gather_33_48, v210);				// VPERMB		3	1
+	samples_33_48 = _mm512_srlv_epi16(samples_33_48, shift_33_48);				// VPSRLVW		1	1
+	// 8-bit samples 33 - 48 in the low byte of the first 16 words
+
+	samples_1_32 = _mm512_permutex2var_epi8(samples_1_32, low_bytes, samples_33_48);// VPERMT2B	5	2
+	_mm512_mask_storeu_epi8(output, mask, samples_1_32);						// VMOVDQU8		1	1
+}
+
+/*
+ * Convert 24 v210 pixels to YUYV
+ *
+ * INPUT:
+ * 64 bytes of v210
+ *
+ * OUTPUT:
+ * 48 bytes of YUYV (or fewer, depending on 'mask')
+ */
+EXTERN_INLINE void	repack_24_v210_pixels_to_yuyv_avx512(uint8_t* input, uint8_t* output, __mmask64 mask) {
+	repack_24_v210_pixels_to_yuv422i_avx512(input, output, mask,
+		_mm512_setr_epi64(0x0302050401000201LL, 0x09080A0906050706LL, 0x0E0D0F0E0B0A0D0CLL, 0x1312151411101211LL,
+							0x19181A1916151716LL, 0x1E1D1F1E1B1A1D1CLL, 0x2322252421202221LL, 0x29282A2926252726LL),
+		_mm512_setr_epi64(0x0006000200020004LL, 0x0002000400040006LL, 0x0004000600060002LL, 0x0006000200020004LL,
+							0x0002000400040006LL, 0x0004000600060002LL, 0x0006000200020004LL, 0x0002000400040006LL),
+		_mm512_setr_epi64(0x2E2D2F2E2B2A2D2CLL, 0x3332353431303231LL, 0x39383A3936353736LL, 0x3E3D3F3E3B3A3D3CLL,
+							0x0LL, 0x0LL, 0x0LL, 0x0LL),
+		_mm512_setr_epi64(0x0004000600060002LL, 0x0006000200020004LL, 0x0002000400040006LL, 0x0004000600060002LL,
+							0x0LL, 0x0LL, 0x0LL, 0x0LL)
+	);
+}
+
+/*
+ * Convert 24 v210 pixels to UYVY
+ *
+ * INPUT:
+ * 64 bytes of v210
+ *
+ * OUTPUT:
+ * 48 bytes of UYVY (or fewer, depending on 'mask')
+ */
+EXTERN_INLINE void	repack_24_v210_pixels_to_uyvy_avx512(uint8_t* input, uint8_t* output, __mmask64 mask) {
+	repack_24_v210_pixels_to_yuv422i_avx512(input, output, mask,
+		_mm512_setr_epi64(0x0504030202010100LL, 0x0A09090807060605LL, 0x0F0E0E0D0D0C0B0ALL, 0x1514131212111110LL,
+							0x1A19191817161615LL, 0x1F1E1E1D1D1C1B1ALL, 0x2524232222212120LL, 0x2A29292827262625LL),
+		_mm512_setr_epi64(0x0002000600040002LL, 0x0004000200060004LL, 0x0006000400020006LL, 0x0002000600040002LL,
+							0x0004000200060004LL, 0x0006000400020006LL, 0x0002000600040002LL, 0x0004000200060004LL),
+		_mm512_setr_epi64(0x2F2E2E2D2D2C2B2ALL, 0x3534333232313130LL, 0x3A39393837363635LL, 0x3F3E3E3D3D3C3B3ALL,
+							0x0LL, 0x0LL, 0x0LL, 0x0LL),
+		_mm512_setr_epi64(0x0006000400020006LL, 0x0002000600040002LL, 0x0004000200060004LL, 0x0006000400020006LL,
+							0x0LL, 0x0LL, 0x0LL, 0x0LL)
+	);
+}
+
+
+/*
+ * Convert 8-bit samples to 24 v210 pixels, using the given permutations
+ * (see the YUYV & UYVY versions below).
+ *
+ * The first permutation places the first and last samples of each
+ * 32-bit word in bytes 0 and 2, the second one places the middle sample
+ * in byte 1. Both are then shifted to their final position.
+ *
+ * TOTAL LATENCY:				~11
+ *
+ * INPUT:
+ * 48 bytes of YUYV or UYVY (or fewer, depending on 'mask')
+ *
+ * OUTPUT:
+ * 64 bytes of v210 (or fewer, depending on 'v210_mask')
+ */
+EXTERN_INLINE void	repack_24_yuv422i_pixels_to_v210_avx512(uint8_t* input, uint8_t* output, __mmask64 mask, __mmask16 v210_mask, __m512i gather_first_last, __m512i gather_middle) {
+	// Shift the first sample by 2 and the last one by 6 within their word
+	__m512i		shift_first_last = _mm512_set1_epi32(0x00060002);
+	__m512i		yuv = _mm512_maskz_loadu_epi8(mask, input);					// VMOVDQU8		5	0.5
+	__m512i		first_last;
+	__m512i		middle;
+
+	first_last = _mm512_maskz_permutexvar_epi8(0x5555555555555555LL, gather_first_last, yuv);	// VPERMB	3	1
+	first_last = _mm512_sllv_epi16(first_last, shift_first_last);				// VPSLLVW		1	1
+	// U01 << 2 | V01 << 22		...
+
+	middle = _mm512_maskz_permutexvar_epi8(0x2222222222222222LL, gather_middle, yuv);	// VPERMB	3	1
+	middle = _mm512_slli_epi32(middle, 4);										// VPSLLD		1	1
+	// Y0 << 12		...
+
+	_mm512_mask_storeu_epi32(output, v210_mask, _mm512_or_si512(first_last, middle));	// VPORD / VMOVDQU32
+}
+
+/*
+ * Convert 24 YUYV pixels to v210
+ *
+ * INPUT:
+ * 48 bytes of YUYV (or fewer, depending on 'mask')
+ *
+ * OUTPUT:
+ * 64 bytes of v210 (or fewer, depending on 'v210_mask')
+ */
+EXTERN_INLINE void	repack_24_yuyv_pixels_to_v210_avx512(uint8_t* input, uint8_t* output, __mmask64 mask, __mmask16 v210_mask) {
+	repack_24_yuv422i_pixels_to_v210_avx512(input, output, mask, v210_mask,
+		_mm512_setr_epi64(0x0004000200030001LL, 0x000A000800090007LL, 0x0010000E000F000DLL, 0x0016001400150013LL,
+							0x001C001A001B0019LL, 0x002200200021001FLL, 0x0028002600270025LL, 0x002E002C002D002BLL),
+		_mm512_setr_epi64(0x0000050000000000LL, 0x00000B0000000600LL, 0x0000110000000C00LL, 0x0000170000001200LL,
+							0x00001D0000001800LL, 0x0000230000001E00LL, 0x0000290000002400LL, 0x00002F0000002A00LL)
+	);
+}
+
+/*
+ * Convert 24 UYVY pixels to v210
+ *
+ * INPUT:
+ * 48 bytes of UYVY (or fewer, depending on 'mask')
+ *
+ * OUTPUT:
+ * 64 bytes of v210 (or fewer, depending on 'v210_mask')
+ */
+EXTERN_INLINE void	repack_24_uyvy_pixels_to_v210_avx512(uint8_t* input, uint8_t* output, __mmask64 mask, __mmask16 v210_mask) {
+	repack_24_yuv422i_pixels_to_v210_avx512(input, output, mask, v210_mask,
+		_mm512_setr_epi64(0x0005000300020000LL, 0x000B000900080006LL, 0x0011000F000E000CLL, 0x0017001500140012LL,
+							0x001D001B001A0018LL, 0x002300210020001ELL, 0x0029002700260024LL, 0x002F002D002C002ALL),
+		_mm512_setr_epi64(0x0000040000000100LL, 0x00000A0000000700LL, 0x0000100000000D00LL, 0x0000160000001300LL,
+							0x00001C0000001900LL, 0x0000220000001F00LL, 0x0000280000002500LL, 0x00002E0000002B00LL)
+	);
+}
+
+#endif	// __INTEL_CPU__
+
+#endif /* YUV_REPACK_AVX512_H_ */
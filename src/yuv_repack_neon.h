@@ -0,0 +1,112 @@
+/*
+ * yuv_repack_neon.h
+ *
+ * Copyright (C) 2011 PixFC Team (pixelfc@gmail.com)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public  License as published by the
+ * Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef YUV_REPACK_NEON_H_
+#define YUV_REPACK_NEON_H_
+
+#include "debug_support.h"
+#include "platform_util.h"
+
+#ifdef __NEON_CPU__
+
+#include <arm_neon.h>
+
+/*
+ * The NEON inlines below repack 32 YUYV / UYVY pixels (64 bytes) to
+ * planar Y, U & V, with de-interleaving loads and interleaving stores
+ * (VLD4 / VST2), which have no alignment requirement.
+ */
+
+/*
+ * Split 32 YUYV pixels into 2 vectors of Y and 2 vectors of U & V.
+ *
+ * INPUT:
+ * 64 bytes: Y1 U12 Y2 V12	Y3 U34 Y4 V34	...	Y31 U3132 Y32 V3132
+ *
+ * OUTPUT:
+ * Y1	Y3	Y5	...	Y31
+ * Y2	Y4	Y6	...	Y32
+ *
+ * U12	U34	U56	...	U3132
+ * V12	V34	V56	...	V3132
+ */
+EXTERN_INLINE void	unpack_yuyv_to_y_uv_vectors_neon(uint8_t* in, uint8x16_t* out_2_v8u_y_vectors, uint8x16_t* out_2_v8u_uv_vectors) {
+	uint8x16x4_t	yuyv = vld4q_u8(in);
+
+	out_2_v8u_y_vectors[0] = yuyv.val[0];
+	out_2_v8u_y_vectors[1] = yuyv.val[2];
+	out_2_v8u_uv_vectors[0] = yuyv.val[1];
+	out_2_v8u_uv_vectors[1] = yuyv.val[3];
+}
+
+/*
+ * Same as above for UYVY.
+ *
+ * INPUT:
+ * 64 bytes: U12 Y1 V12 Y2	U34 Y3 V34 Y4	...	U3132 Y31 V3132 Y32
+ */
+EXTERN_INLINE void	unpack_uyvy_to_y_uv_vectors_neon(uint8_t* in, uint8x16_t* out_2_v8u_y_vectors, uint8x16_t* out_2_v8u_uv_vectors) {
+	uint8x16x4_t	uyvy = vld4q_u8(in);
+
+	out_2_v8u_y_vectors[0] = uyvy.val[1];
+	out_2_v8u_y_vectors[1] = uyvy.val[3];
+	out_2_v8u_uv_vectors[0] = uyvy.val[0];
+	out_2_v8u_uv_vectors[1] = uyvy.val[2];
+}
+
+/*
+ * Store 2 vectors of Y (as returned by the above inlines) as 32 Y.
+ *
+ * OUTPUT:
+ * 32 bytes: Y1 Y2 Y3 ... Y32
+ */
+EXTERN_INLINE void	pack_y_vectors_to_y_plane_neon(uint8x16_t* in_2_v8u_y_vectors, uint8_t* out) {
+	uint8x16x2_t	y;
+
+	y.val[0] = in_2_v8u_y_vectors[0];
+	y.val[1] = in_2_v8u_y_vectors[1];
+	vst2q_u8(out, y);
+}
+
+/*
+ * Vertical chroma downsampling of 2 lines of U & V (as returned by the
+ * above inlines). Results match those of the non-SSE routines.
+ */
+
+/*
+ * Nearest neighbour: keep the chroma samples of the first line.
+ */
+EXTERN_INLINE void	nnb_downsample_uv_vectors_neon(uint8x16_t* in_2_v8u_uv_line1_vectors, uint8x16_t* in_2_v8u_uv_line2_vectors, uint8x16_t* out_2_v8u_uv_vectors) {
+	(void) in_2_v8u_uv_line2_vectors;
+	out_2_v8u_uv_vectors[0] = in_2_v8u_uv_line1_vectors[0];
+	out_2_v8u_uv_vectors[1] = in_2_v8u_uv_line1_vectors[1];
+}
+
+/*
+ * Average: C = (CL1 + CL2 + 1) / 2
+ */
+EXTERN_INLINE void	avg_downsample_uv_vectors_neon(uint8x16_t* in_2_v8u_uv_line1_vectors, uint8x16_t* in_2_v8u_uv_line2_vectors, uint8x16_t* out_2_v8u_uv_vectors) {
+	out_2_v8u_uv_vectors[0] = vrhaddq_u8(in_2_v8u_uv_line1_vectors[0], in_2_v8u_uv_line2_vectors[0]);
+	out_2_v8u_uv_vectors[1] = vrhaddq_u8(in_2_v8u_uv_line1_vectors[1], in_2_v8u_uv_line2_vectors[1]);
+}
+
+#endif	// __NEON_CPU__
+
+#endif /* YUV_REPACK_NEON_H_ */
@@ -0,0 +1,153 @@
+/*
+ * yuv_to_rgb_convert_avx2.h
+ *
+ * Copyright (C) 2011 PixFC Team (pixelfc@gmail.com)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public  License as published by the
+ * Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef YUV_TO_RGB_CONVERT_AVX2_H_
+#define YUV_TO_RGB_CONVERT_AVX2_H_
+
+#include "debug_support.h"
+#include "platform_util.h"
+
+#ifdef __INTEL_CPU__
+
+#include <immintrin.h>
+
+
+/*
+ * Calculate one of the R, G or B channels from 16 (Y + Y offset, U + U offset)
+ * pairs and 16 (V + V offset, 0) pairs:
+ *
+ * C = ( Y * coef_y  +  U * coef_u  +  V * coef_v ) >> 8
+ *
+ * The 32-bit intermediate results are calculated with PMADDWD and are exact,
+ * so the output matches that of the non-SSE integer conversion routines.
+ *
+ * INPUT:
+ * 4 vectors of 8 (int16, int16) pairs
+ * Y1 U1	Y2 U2	Y3 U3	Y4 U4	|	Y9 U9	Y10 U10	Y11 U11	Y12 U12
+ * Y5 U5	Y6 U6	Y7 U7	Y8 U8	|	Y13 U13	Y14 U14	Y15 U15	Y16 U16
+ * V1 0		V2 0	V3 0	V4 0	|	V9 0	V10 0	V11 0	V12 0
+ * V5 0		V6 0	V7 0	V8 0	|	V13 0	V14 0	V15 0	V16 0
+ *
+ * OUTPUT:
+ * 1 vector of 16 short
+ * C1 0		C2 0	C3 0	C4 0	...		C16 0
+ */
+EXTERN_INLINE void	convert_y_u_v_pairs_to_channel_avx2(__m256i* in_4_v16i_yu_yu_v_v_pairs, int32_t coef_y, int32_t coef_u, int32_t coef_v, __m256i* out_1_v16i_channel) {
+	__m256i		yu_coeffs = _mm256_set1_epi32((int32_t)((uint32_t)(coef_u & 0xFFFF) << 16 | (uint32_t)(coef_y & 0xFFFF)));
+	__m256i		v_coeffs = _mm256_set1_epi32(coef_v & 0xFFFF);
+	__m256i		lo = _mm256_add_epi32(_mm256_madd_epi16(in_4_v16i_yu_yu_v_v_pairs[0], yu_coeffs), _mm256_madd_epi16(in_4_v16i_yu_yu_v_v_pairs[2], v_coeffs));
+	__m256i		hi = _mm256_add_epi32(_mm256_madd_epi16(in_4_v16i_yu_yu_v_v_pairs[1], yu_coeffs), _mm256_madd_epi16(in_4_v16i_yu_yu_v_v_pairs[3], v_coeffs));
+
+	*out_1_v16i_channel = _mm256_packs_epi32(_mm256_srai_epi32(lo, 8), _mm256_srai_epi32(hi, 8));
+}
+
+/*
+ * Convert 3 vectors of 16 short Y, U & V into 3 vectors of 16 short R, G & B
+ * using the given offsets and left-shifted-by-8 conversion matrix (same
+ * values as yuv_8bit_to_rgb_8bit_off & yuv_8bit_to_rgb_8bit_coef_lhs8 in
+ * common.c). Callers pass literal values so all coefficient vectors are
+ * built at compile time.
+ *
+ * Number of pixels handled:	16
+ *
+ * INPUT:
+ * 3 vectors of 16 short
+ * Y1 0		Y2 0	Y3 0	...		Y16 0
+ * U1 0		U2 0	U3 0	...		U16 0
+ * V1 0		V2 0	V3 0	...		V16 0
+ *
+ * OUTPUT:
+ * 3 vectors of 16 short
+ * R1 0		R2 0	R3 0	...		R16 0
+ * G1 0		G2 0	G3 0	...		G16 0
+ * B1 0		B2 0	B3 0	...		B16 0
+ */
+EXTERN_INLINE void	convert_y_u_v_vectors_to_rgb_vectors_with_coeffs_avx2(__m256i* in_3_v16i_y_u_v_vectors,
+		int32_t y_off, int32_t u_off, int32_t v_off,
+		int32_t r_y, int32_t r_u, int32_t r_v,
+		int32_t g_y, int32_t g_u, int32_t g_v,
+		int32_t b_y, int32_t b_u, int32_t b_v,
+		__m256i* out_3_v16i_rgb_vectors) {
+	__m256i		y = _mm256_add_epi16(in_3_v16i_y_u_v_vectors[0], _mm256_set1_epi16((int16_t)y_off));
+	__m256i		u = _mm256_add_epi16(in_3_v16i_y_u_v_vectors[1], _mm256_set1_epi16((int16_t)u_off));
+	__m256i		v = _mm256_add_epi16(in_3_v16i_y_u_v_vectors[2], _mm256_set1_epi16((int16_t)v_off));
+	__m256i		pairs[4];
+
+	pairs[0] = _mm256_unpacklo_epi16(y, u);
+	pairs[1] = _mm256_unpackhi_epi16(y, u);
+	pairs[2] = _mm256_unpacklo_epi16(v, _mm256_setzero_si256());
+	pairs[3] = _mm256_unpackhi_epi16(v, _mm256_setzero_si256());
+
+	convert_y_u_v_pairs_to_channel_avx2(pairs, r_y, r_u, r_v, &out_3_v16i_rgb_vectors[0]);
+	convert_y_u_v_pairs_to_channel_avx2(pairs, g_y, g_u, g_v, &out_3_v16i_rgb_vectors[1]);
+	convert_y_u_v_pairs_to_channel_avx2(pairs, b_y, b_u, b_v, &out_3_v16i_rgb_vectors[2]);
+}
+
+/*
+ * Full range
+ *
+ * 		[ 256	0		358		]	( Y )
+ * 		[ 256	-88		-182	]	( U - 128 )
+ * 		[ 256	452		0		]	( V - 128 )
+ */
+EXTERN_INLINE void	convert_y_u_v_vectors_to_rgb_vectors_avx2(__m256i* in_3_v16i_y_u_v_vectors, __m256i* out_3_v16i_rgb_vectors) {
+	convert_y_u_v_vectors_to_rgb_vectors_with_coeffs_avx2(in_3_v16i_y_u_v_vectors,
+			0, -128, -128,
+			256, 0, 358,
+			256, -88, -182,
+			256, 452, 0,
+			out_3_v16i_rgb_vectors);
+}
+
+/*
+ * bt.601
+ *
+ * 		[ 298	0		409		]	( Y - 16 )
+ * 		[ 298	-100	-208	]	( U - 128 )
+ * 		[ 298	516		0		]	( V - 128 )
+ */
+EXTERN_INLINE void	convert_y_u_v_vectors_to_rgb_vectors_bt601_avx2(__m256i* in_3_v16i_y_u_v_vectors, __m256i* out_3_v16i_rgb_vectors) {
+	convert_y_u_v_vectors_to_rgb_vectors_with_coeffs_avx2(in_3_v16i_y_u_v_vectors,
+			-16, -128, -128,
+			298, 0, 409,
+			298, -100, -208,
+			298, 516, 0,
+			out_3_v16i_rgb_vectors);
+}
+
+/*
+ * bt.709
+ *
+ * 		[ 298	0		459		]	( Y - 16 )
+ * 		[ 298	-55		-136	]	( U - 128 )
+ * 		[ 298	541		0		]	( V - 128 )
+ */
+EXTERN_INLINE void	convert_y_u_v_vectors_to_rgb_vectors_bt709_avx2(__m256i* in_3_v16i_y_u_v_vectors, __m256i* out_3_v16i_rgb_vectors) {
+	convert_y_u_v_vectors_to_rgb_vectors_with_coeffs_avx2(in_3_v16i_y_u_v_vectors,
+			-16, -128, -128,
+			298, 0, 459,
+			298, -55, -136,
+			298, 541, 0,
+			out_3_v16i_rgb_vectors);
+}
+
+#endif	// __INTEL_CPU__
+
+#endif /* YUV_TO_RGB_CONVERT_AVX2_H_ */
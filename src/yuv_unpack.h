@@ -53,6 +53,8 @@
 #undef YUVP_Y_INPUT_VECT
 #undef YUVP_U_INPUT_VECT
 #undef YUVP_V_INPUT_VECT
+#undef UNALIGNED_YUVSP_UV_INPUT_PREAMBLE
+#undef YUVSP_UV_INPUT_VECT
 
 
 //#define GENERATE_UNALIGNED_INLINES 1
@@ -71,6 +73,10 @@
 	#define YUVP_U_INPUT_VECT						(&aligned_u_vector)
 	#define YUVP_V_INPUT_VECT						(&aligned_v_vector)
 
+	// Semi-planar YUV
+	#define UNALIGNED_YUVSP_UV_INPUT_PREAMBLE		DECLARE_VECT_N_UNALIGN_LOAD(aligned_uv_vector, uv_input)
+	#define YUVSP_UV_INPUT_VECT						(&aligned_uv_vector)
+
 #else
 	#define INLINE_NAME(fn_suffix, ...)				EXTERN_INLINE void fn_suffix(__VA_ARGS__)
 	#define CALL_INLINE(fn, ...)					fn(__VA_ARGS__)
@@ -85,6 +91,10 @@
 	#define YUVP_Y_INPUT_VECT						(y_input)
 	#define YUVP_U_INPUT_VECT						(u_input)
 	#define YUVP_V_INPUT_VECT						(v_input)
+
+	// Semi-planar YUV
+	#define UNALIGNED_YUVSP_UV_INPUT_PREAMBLE
+	#define YUVSP_UV_INPUT_VECT						(uv_input)
 #endif
 
 
@@ -404,6 +414,148 @@ INLINE_NAME(unpack_high_yuv42Xp_to_uv_vector_sse2, __m128i* u_input, __m128i* v_
 };
 
 
+/*
+ * Convert 8 pixels from the Y, U and V planes (as found in YUV422P / YUV420P)
+ * to 1 Y vector and 1 interleaved UV vector.
+ * Only 8 Y, 4 U and 4 V bytes are loaded (whatever the alignment), so this
+ * inline never reads past the end of a line or plane.
+ *
+ * Total latency:				4
+ *
+ * INPUT
+ * 8 Y, 4 U and 4 V char
+ *
+ * OUTPUT:
+ *
+ * 2 vectors of 8 short
+ * yVect
+ * Y1 0		Y2 0	Y3 0	Y4 0	Y5 0	Y6 0	Y7 0	Y8 0
+ *
+ * uvVect
+ * U12 0	V12 0	U34 0	V34 0	U56 0	V56 0	U78 0	V78 0
+ */
+INLINE_NAME(unpack_8_yuv42Xp_pixels_to_y_uv_vectors_sse2, uint8_t* y_input, uint8_t* u_input, uint8_t* v_input, __m128i* out_2_v16i_y_uv_vectors)
+{
+	CONST_M128I(zero_vect, 0x0LL, 0x0LL);
+	M128I(scratch, 0x0LL, 0x0LL);
+
+	out_2_v16i_y_uv_vectors[0] = _mm_unpacklo_epi8(_mm_loadl_epi64((__m128i *) y_input), _M(zero_vect));
+	// Y1 0		Y2 0	Y3 0	Y4 0	Y5 0	Y6 0	Y7 0	Y8 0		// MOVQ + PUNPCKLBW	1	0.5
+
+	_M(scratch) = _mm_unpacklo_epi8(_mm_cvtsi32_si128(*(int32_t *) u_input), _mm_cvtsi32_si128(*(int32_t *) v_input));
+	// U12 V12	U34 V34	U56 V56	U78 V78	0 0		0 0		0 0		0 0			// MOVD + PUNPCKLBW	1	0.5
+
+	out_2_v16i_y_uv_vectors[1] = _mm_unpacklo_epi8(_M(scratch), _M(zero_vect));
+	// U12 0	V12 0	U34 0	V34 0	U56 0	V56 0	U78 0	V78 0		// PUNPCKLBW       1	0.5
+};
+
+
+/*
+ * Convert 8 interleaved chroma pairs in 1 vector of 16 char UV
+ * (as found in NV12) to 2 vectors of 8 interleaved short UV
+ *
+ * Total latency:				2
+ *
+ * INPUT
+ * 1 vector of 16 char
+ * uv_input
+ * U1 V1	U2 V2	U3 V3	U4 V4	U5 V5	U6 V6	U7 V7	U8 V8
+ *
+ * OUTPUT:
+ *
+ * 2 vectors of 16 char
+ * uvVect1
+ * U1 0		V1 0	U2 0	V2 0	U3 0	V3 0	U4 0	V4	0
+ *
+ * uvVect2
+ * U5 0		V5 0	U6 0	V6 0	U7 0	V7 0	U8 0	V8	0
+ */
+INLINE_NAME(unpack_nv12_uv_to_2_uv_vectors_sse2, __m128i* uv_input, __m128i* out_1_v16i_uv_vector1, __m128i* out_1_v16i_uv_vector2)
+{
+	CONST_M128I(zero_vect, 0x0LL, 0x0LL);
+	UNALIGNED_YUVSP_UV_INPUT_PREAMBLE;
+
+	*out_1_v16i_uv_vector1 = _mm_unpacklo_epi8(*YUVSP_UV_INPUT_VECT, _M(zero_vect));
+	// U1 0		V1 0	U2 0	V2 0	U3 0	V3 0	U4 0	V4	0		// PUNPCKLBW       1	0.5
+
+	*out_1_v16i_uv_vector2 = _mm_unpackhi_epi8(*YUVSP_UV_INPUT_VECT, _M(zero_vect));
+	// U5 0		V5 0	U6 0	V6 0	U7 0	V7 0	U8 0	V8	0		// PUNPCKHBW       1	0.5
+};
+
+
+/*
+ * Convert 8 interleaved chroma pairs in 1 vector of 16 char VU
+ * (as found in NV21) to 2 vectors of 8 interleaved short UV
+ *
+ * Total latency:				5
+ *
+ * INPUT
+ * 1 vector of 16 char
+ * uv_input
+ * V1 U1	V2 U2	V3 U3	V4 U4	V5 U5	V6 U6	V7 U7	V8 U8
+ *
+ * OUTPUT:
+ *
+ * 2 vectors of 16 char
+ * uvVect1
+ * U1 0		V1 0	U2 0	V2 0	U3 0	V3 0	U4 0	V4	0
+ *
+ * uvVect2
+ * U5 0		V5 0	U6 0	V6 0	U7 0	V7 0	U8 0	V8	0
+ */
+INLINE_NAME(unpack_nv21_vu_to_2_uv_vectors_sse2, __m128i* uv_input, __m128i* out_1_v16i_uv_vector1, __m128i* out_1_v16i_uv_vector2)
+{
+	CONST_M128I(zero_vect, 0x0LL, 0x0LL);
+	M128I(scratch, 0x0LL, 0x0LL);
+	UNALIGNED_YUVSP_UV_INPUT_PREAMBLE;
+
+	_M(scratch) = _mm_or_si128(_mm_slli_epi16(*YUVSP_UV_INPUT_VECT, 8), _mm_srli_epi16(*YUVSP_UV_INPUT_VECT, 8));
+	// U1 V1	U2 V2	U3 V3	U4 V4	U5 V5	U6 V6	U7 V7	U8 V8		// PSLLW PSRLW POR	3	1
+
+	*out_1_v16i_uv_vector1 = _mm_unpacklo_epi8(_M(scratch), _M(zero_vect));
+	// U1 0		V1 0	U2 0	V2 0	U3 0	V3 0	U4 0	V4	0		// PUNPCKLBW       1	0.5
+
+	*out_1_v16i_uv_vector2 = _mm_unpackhi_epi8(_M(scratch), _M(zero_vect));
+	// U5 0		V5 0	U6 0	V6 0	U7 0	V7 0	U8 0	V8	0		// PUNPCKHBW       1	0.5
+};
+
+
+/*
+ * Convert 1 vector of 8 short Y and 1 vector of 8 short interleaved UV
+ * (as found in P010 / P210, with 10-bit values in the most significant bits)
+ * to 2 vectors of 8 short 10-bit Y & UV
+ *
+ * Total latency:				2
+ * Number of pixels handled:	8
+ *
+ * INPUT
+ * 1 vector of 8 short
+ * y_input
+ * Y1		Y2		Y3		Y4		Y5		Y6		Y7		Y8
+ *
+ * 1 vector of 8 short
+ * uv_input
+ * U12		V12		U34		V34		U56		V56		U78		V78
+ *
+ * OUTPUT:
+ *
+ * 2 vectors of 8 short
+ * yVect
+ * Y1		Y2		Y3		Y4		Y5		Y6		Y7		Y8
+ *
+ * uvVect
+ * U12		V12		U34		V34		U56		V56		U78		V78
+ */
+INLINE_NAME(unpack_p210_to_y_uv_vectors_sse2, __m128i* y_input, __m128i* uv_input, __m128i* out_2_v16i_y_uv_vectors)
+{
+	UNALIGNED_YUVP_Y_INPUT_PREAMBLE;
+	UNALIGNED_YUVSP_UV_INPUT_PREAMBLE;
+
+	out_2_v16i_y_uv_vectors[0] = _mm_srli_epi16(*YUVP_Y_INPUT_VECT, 6);			// PSRLW		1	1
+	out_2_v16i_y_uv_vectors[1] = _mm_srli_epi16(*YUVSP_UV_INPUT_VECT, 6);		// PSRLW		1	1
+};
+
+
 #ifdef FAKE_SSE41_BLENDV
 #define _mm_blendv_epi8 _fake_mm_blendv_epi8
 __m128i     _fake_mm_blendv_epi8(__m128i v1, __m128i v2, __m128i mask);
@@ -0,0 +1,172 @@
+/*
+ * yuv_unpack_avx2.h
+ *
+ * Copyright (C) 2011 PixFC Team (pixelfc@gmail.com)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public  License as published by the
+ * Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef YUV_UNPACK_AVX2_H_
+#define YUV_UNPACK_AVX2_H_
+
+#include "debug_support.h"
+#include "platform_util.h"
+
+#ifdef __INTEL_CPU__
+
+#include <immintrin.h>
+
+/*
+ * The AVX2 inlines below work on 16 pixels at a time. Unlike their SSE
+ * counterparts, they use unaligned loads only: on CPUs with AVX2, unaligned
+ * loads from aligned addresses are as fast as aligned ones, so there is no
+ * need to generate aligned & unaligned versions.
+ *
+ * 256-bit vectors are made of two 128-bit lanes. Unless stated otherwise,
+ * vectors of 16 short hold pixels 1 to 8 in the low lane and pixels 9 to 16
+ * in the high lane.
+ */
+
+
+/*
+ * Convert 32 bytes of YUYV to 3 vectors of 16 short Y, U & V,
+ * duplicating each chroma sample (nearest neighbour upsampling).
+ *
+ * Number of pixels handled:	16
+ *
+ * INPUT
+ * 32 bytes
+ * Y1 U12	Y2 V12	Y3 U34	Y4 V34	...		Y15 U1516	Y16 V1516
+ *
+ * OUTPUT:
+ * 3 vectors of 16 short
+ * Y1 	0	Y2 	 0	Y3 	 0	Y4 	 0	...	Y16  	0
+ * U12  0	U12  0	U34  0	U34  0	...	U1516	0
+ * V12  0	V12  0	V34  0	V34  0	...	V1516	0
+ */
+EXTERN_INLINE void	unpack_yuyv_to_y_u_v_vectors_avx2(uint8_t* input, __m256i* out_3_v16i_y_u_v_vectors) {
+	__m256i		in = _mm256_loadu_si256((__m256i *) input);
+	__m256i		u_shuffle = _mm256_setr_epi8(
+			1, -1, 1, -1, 5, -1, 5, -1, 9, -1, 9, -1, 13, -1, 13, -1,
+			1, -1, 1, -1, 5, -1, 5, -1, 9, -1, 9, -1, 13, -1, 13, -1);
+	__m256i		v_shuffle = _mm256_setr_epi8(
+			3, -1, 3, -1, 7, -1, 7, -1, 11, -1, 11, -1, 15, -1, 15, -1,
+			3, -1, 3, -1, 7, -1, 7, -1, 11, -1, 11, -1, 15, -1, 15, -1);
+
+	out_3_v16i_y_u_v_vectors[0] = _mm256_and_si256(in, _mm256_set1_epi16(0x00FF));
+	out_3_v16i_y_u_v_vectors[1] = _mm256_shuffle_epi8(in, u_shuffle);
+	out_3_v16i_y_u_v_vectors[2] = _mm256_shuffle_epi8(in, v_shuffle);
+}
+
+/*
+ * Convert 32 bytes of UYVY to 3 vectors of 16 short Y, U & V,
+ * duplicating each chroma sample (nearest neighbour upsampling).
+ *
+ * Number of pixels handled:	16
+ *
+ * INPUT
+ * 32 bytes
+ * U12 Y1	V12 Y2	U34 Y3	V34 Y4	...		U1516 Y15	V1516 Y16
+ *
+ * OUTPUT:
+ * 3 vectors of 16 short
+ * Y1 	0	Y2 	 0	Y3 	 0	Y4 	 0	...	Y16  	0
+ * U12  0	U12  0	U34  0	U34  0	...	U1516	0
+ * V12  0	V12  0	V34  0	V34  0	...	V1516	0
+ */
+EXTERN_INLINE void	unpack_uyvy_to_y_u_v_vectors_avx2(uint8_t* input, __m256i* out_3_v16i_y_u_v_vectors) {
+	__m256i		in = _mm256_loadu_si256((__m256i *) input);
+	__m256i		u_shuffle = _mm256_setr_epi8(
+			0, -1, 0, -1, 4, -1, 4, -1, 8, -1, 8, -1, 12, -1, 12, -1,
+			0, -1, 0, -1, 4, -1, 4, -1, 8, -1, 8, -1, 12, -1, 12, -1);
+	__m256i		v_shuffle = _mm256_setr_epi8(
+			2, -1, 2, -1, 6, -1, 6, -1, 10, -1, 10, -1, 14, -1, 14, -1,
+			2, -1, 2, -1, 6, -1, 6, -1, 10, -1, 10, -1, 14, -1, 14, -1);
+
+	out_3_v16i_y_u_v_vectors[0] = _mm256_srli_epi16(in, 8);
+	out_3_v16i_y_u_v_vectors[1] = _mm256_shuffle_epi8(in, u_shuffle);
+	out_3_v16i_y_u_v_vectors[2] = _mm256_shuffle_epi8(in, v_shuffle);
+}
+
+/*
+ * Convert 32 bytes of YUYV to 2 vectors of 16 short Y & UV
+ *
+ * Number of pixels handled:	16
+ *
+ * INPUT
+ * 32 bytes
+ * Y1 U12	Y2 V12	Y3 U34	Y4 V34	...		Y15 U1516	Y16 V1516
+ *
+ * OUTPUT:
+ * 2 vectors of 16 short
+ * Y1 	0	Y2 	 0	Y3 	 0	Y4 	 0	...	Y16  	0
+ * U12  0	V12  0	U34  0	V34  0	...	V1516	0
+ */
+EXTERN_INLINE void	unpack_yuyv_to_y_uv_vectors_avx2(uint8_t* input, __m256i* out_2_v16i_y_uv_vectors) {
+	__m256i		in = _mm256_loadu_si256((__m256i *) input);
+
+	out_2_v16i_y_uv_vectors[0] = _mm256_and_si256(in, _mm256_set1_epi16(0x00FF));
+	out_2_v16i_y_uv_vectors[1] = _mm256_srli_epi16(in, 8);
+}
+
+/*
+ * Convert 32 bytes of UYVY to 2 vectors of 16 short Y & UV
+ *
+ * Number of pixels handled:	16
+ *
+ * INPUT
+ * 32 bytes
+ * U12 Y1	V12 Y2	U34 Y3	V34 Y4	...		U1516 Y15	V1516 Y16
+ *
+ * OUTPUT:
+ * 2 vectors of 16 short
+ * Y1 	0	Y2 	 0	Y3 	 0	Y4 	 0	...	Y16  	0
+ * U12  0	V12  0	U34  0	V34  0	...	V1516	0
+ */
+EXTERN_INLINE void	unpack_uyvy_to_y_uv_vectors_avx2(uint8_t* input, __m256i* out_2_v16i_y_uv_vectors) {
+	__m256i		in = _mm256_loadu_si256((__m256i *) input);
+
+	out_2_v16i_y_uv_vectors[0] = _mm256_srli_epi16(in, 8);
+	out_2_v16i_y_uv_vectors[1] = _mm256_and_si256(in, _mm256_set1_epi16(0x00FF));
+}
+
+/*
+ * Unpack 16 Y values and 8 U & V values from a planar YUV image to 3 vectors
+ * of 16 short Y, U & V, duplicating each chroma sample (nearest neighbour
+ * upsampling).
+ *
+ * Number of pixels handled:	16
+ *
+ * INPUT
+ * 16 bytes Y, 8 bytes U, 8 bytes V
+ *
+ * OUTPUT:
+ * 3 vectors of 16 short
+ * Y1 	0	Y2 	 0	Y3 	 0	Y4 	 0	...	Y16  	0
+ * U12  0	U12  0	U34  0	U34  0	...	U1516	0
+ * V12  0	V12  0	V34  0	V34  0	...	V1516	0
+ */
+EXTERN_INLINE void	unpack_yuv42Xp_to_y_u_v_vectors_avx2(uint8_t* y_input, uint8_t* u_input, uint8_t* v_input, __m256i* out_3_v16i_y_u_v_vectors) {
+	__m128i		u = _mm_loadl_epi64((__m128i *) u_input);
+	__m128i		v = _mm_loadl_epi64((__m128i *) v_input);
+
+	out_3_v16i_y_u_v_vectors[0] = _mm256_cvtepu8_epi16(_mm_loadu_si128((__m128i *) y_input));
+	out_3_v16i_y_u_v_vectors[1] = _mm256_cvtepu8_epi16(_mm_unpacklo_epi8(u, u));
+	out_3_v16i_y_u_v_vectors[2] = _mm256_cvtepu8_epi16(_mm_unpacklo_epi8(v, v));
+}
+
+#endif	// __INTEL_CPU__
+
+#endif /* YUV_UNPACK_AVX2_H_ */
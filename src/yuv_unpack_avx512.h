@@ -0,0 +1,110 @@
+/*
+ * yuv_unpack_avx512.h
+ *
+ * Copyright (C) 2011 PixFC Team (pixelfc@gmail.com)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public  License as published by the
+ * Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef YUV_UNPACK_AVX512_H_
+#define YUV_UNPACK_AVX512_H_
+
+#include "debug_support.h"
+#include "platform_util.h"
+
+#ifdef __INTEL_CPU__
+
+#include <immintrin.h>
+
+/*
+ * The AVX-512 inlines below require AVX512F, AVX512BW and AVX512VBMI.
+ * Like the AVX2 inlines, they use unaligned loads only.
+ */
+
+
+/*
+ * Unpack 4 v210 vectors (24 pixels) into 6 vectors (Y, UV), like
+ * unpack_4v_v210_to_y_uv_vectors_sse2_ssse3_sse41(), so it can be used
+ * with the SSE v210 to RGB recipes.
+ *
+ * Each 10-bit sample starts 10 bits after the previous one in its 32-bit
+ * word, so it always spans 2 bytes of the input, at a bit offset of 0, 2
+ * or 4. VPERMB gathers these 2 bytes in a 16-bit word for each output
+ * sample, in output order, and VPSRLVW shifts each word by its own offset.
+ *
+ * Total latency:				17
+ * Number of pixels handled:	24
+ *
+ * INPUT
+ * 4 vectors of 24 v210 pixels
+ * U01		Y0		V01		Y1	... U45	  Y4	V45	    Y5
+ * U67		Y6		V67		Y7	... U1011 Y10	V1011	Y11
+ * U1213	Y12		V1213	Y13	... U1617 Y16	V1617	Y17
+ * U1819	Y18		V1819	Y19	... U2223 Y22	V2223	Y23
+ *
+ * OUTPUT:
+ * 3 pairs of vectors of 8 short (Y, UV)
+ * Y0		Y1		Y2		Y3		Y4		Y5		Y6		Y7
+ * U01		V01		U23		V23		U45		V45		U67		V67
+ * Y8		Y9		Y10		Y11		Y12		Y13		Y14		Y15
+ * U89		V89		U1011	V1011	U1213	V1213	U1415	V1415
+ * Y16		Y17		Y18		Y19		Y20		Y21		Y22		Y23
+ * U1617	V1617	U1819	V1819	U2021	V2021	U2223	V2223
+ */
+EXTERN_INLINE void	unpack_4v_v210_to_y_uv_vectors_avx512(__m128i* input, __m128i* yuv1_8_out, __m128i* yuv9_16_out, __m128i* yuv17_24_out) {
+	// Input bytes holding the samples of pixels 0 - 15, then 16 - 23
+	__m512i		gather_1_16 = _mm512_setr_epi64(0x0A09070605040201LL, 0x151412110F0E0D0CLL, 0x0908060503020100LL, 0x131211100E0D0B0ALL,
+												0x1F1E1D1C1A191716LL, 0x2A29272625242221LL, 0x1E1D1B1A19181615LL, 0x2928262523222120LL);
+	__m512i		gather_17_24 = _mm512_setr_epi64(0x353432312F2E2D2CLL, 0x3F3E3D3C3A393736LL, 0x333231302E2D2B2ALL, 0x3E3D3B3A39383635LL,
+												0x0LL, 0x0LL, 0x0LL, 0x0LL);
+	// Bit offset of each sample in the above pairs of bytes
+	__m512i		shift_1_16 = _mm512_setr_epi64(0x0002000400000002LL, 0x0000000200040000LL, 0x0000000200040000LL, 0x0004000000020004LL,
+												0x0004000000020004LL, 0x0002000400000002LL, 0x0002000400000002LL, 0x0000000200040000LL);
+	__m512i		shift_17_24 = _mm512_setr_epi64(0x0000000200040000LL, 0x0004000000020004LL, 0x0004000000020004LL, 0x0002000400000002LL,
+												0x0LL, 0x0LL, 0x0LL, 0x0LL);
+	__m512i		keep_10_bits = _mm512_set1_epi16(0x03FF);
+	__m512i		v210 = _mm512_loadu_si512(input);								// VMOVDQU64	5	0.5
+	__m512i		y_uv_1_16;
+	__m512i		y_uv_17_24;
+
+	y_uv_1_16 = _mm512_permutexvar_epi8(gather_1_16, v210);						// VPERMB		3	1
+	y_uv_1_16 = _mm512_srlv_epi16(y_uv_1_16, shift_1_16);						// VPSRLVW		1	1
+	y_uv_1_16 = _mm512_and_si512(y_uv_1_16, keep_10_bits);						// VPANDQ		1	0.5
+	// Y0 - 7	|	U01 - V67	|	Y8 - 15	|	U89 - V1415
+
+	y_uv_17_24 = _mm512_permutexvar_epi8(gather_17_24, v210);					// VPERMB		3	1
+	y_uv_17_24 = _mm512_srlv_epi16(y_uv_17_24, shift_17_24);					// VPSRLVW		1	1
+	y_uv_17_24 = _mm512_and_si512(y_uv_17_24, keep_10_bits);					// VPANDQ		1	0.5
+	// Y16 - 23	|	U1617 - V2223	|	0	|	0
+
+	yuv1_8_out[0] = _mm512_castsi512_si128(y_uv_1_16);
+	yuv1_8_out[1] = _mm512_extracti32x4_epi32(y_uv_1_16, 1);					// VEXTRACTI32X4	3	1
+	yuv9_16_out[0] = _mm512_extracti32x4_epi32(y_uv_1_16, 2);					// VEXTRACTI32X4	3	1
+	yuv9_16_out[1] = _mm512_extracti32x4_epi32(y_uv_1_16, 3);					// VEXTRACTI32X4	3	1
+	yuv17_24_out[0] = _mm512_castsi512_si128(y_uv_17_24);
+	yuv17_24_out[1] = _mm512_extracti32x4_epi32(y_uv_17_24, 1);				// VEXTRACTI32X4	3	1
+}
+
+/*
+ * The SSE recipes use a different inline for unaligned input buffers.
+ * The above one already uses an unaligned load.
+ */
+EXTERN_INLINE void	unaligned_unpack_4v_v210_to_y_uv_vectors_avx512(__m128i* input, __m128i* yuv1_8_out, __m128i* yuv9_16_out, __m128i* yuv17_24_out) {
+	unpack_4v_v210_to_y_uv_vectors_avx512(input, yuv1_8_out, yuv9_16_out, yuv17_24_out);
+}
+
+#endif	// __INTEL_CPU__
+
+#endif /* YUV_UNPACK_AVX512_H_ */
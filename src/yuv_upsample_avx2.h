@@ -0,0 +1,162 @@
+/*
+ * yuv_upsample_avx2.h
+ *
+ * Copyright (C) 2011 PixFC Team (pixelfc@gmail.com)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public  License as published by the
+ * Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef YUV_UPSAMPLE_AVX2_H_
+#define YUV_UPSAMPLE_AVX2_H_
+
+#include "debug_support.h"
+#include "platform_util.h"
+
+#ifdef __INTEL_CPU__
+
+#include <immintrin.h>
+
+/*
+ * The missing chroma values are the truncated average of the previous and
+ * next chroma values, as in the non-SSE integer conversion routines. The
+ * last pixel of a line reuses the chroma values of the before-last pixel.
+ */
+
+
+/*
+ * Split interleaved chroma values in 2 vectors of U & V and calculate
+ * the missing chroma values.
+ *
+ * Number of pixels handled:	16
+ *
+ * INPUT:
+ * U1 0		V1 0	U3 0	V3 0	...		U15 0	V15 0
+ * U17 0	V17 0	U19 0	V19 0	...		U31 0	V31 0
+ *
+ * OUTPUT:
+ * U1 0		U2 0	U3 0	U4 0	...		U15 0	U16 0
+ * V1 0		V2 0	V3 0	V4 0	...		V15 0	V16 0
+ */
+EXTERN_INLINE void	reconstruct_missing_uv_avx2(__m256i* current_uv, __m256i* next_uv, __m256i* out_2_v16i_u_v_vectors) {
+	// U9 V9 .. U15 V15 | U17 V17 .. U23 V23
+	__m256i		following_uv = _mm256_permute2x128_si256(*current_uv, *next_uv, 0x21);
+	// U3 V3 .. U9 V9 | U11 V11 .. U17 V17
+	__m256i		shifted_uv = _mm256_alignr_epi8(following_uv, *current_uv, 4);
+	// U2 V2 .. U8 V8 | U10 V10 .. U16 V16
+	__m256i		avg_uv = _mm256_srli_epi16(_mm256_add_epi16(*current_uv, shifted_uv), 1);
+
+	out_2_v16i_u_v_vectors[0] = _mm256_blend_epi16(*current_uv, _mm256_slli_epi32(avg_uv, 16), 0xAA);
+	out_2_v16i_u_v_vectors[1] = _mm256_blend_epi16(_mm256_srli_epi32(*current_uv, 16), avg_uv, 0xAA);
+}
+
+/*
+ * Same as above for the last 16 pixels in a line.
+ *
+ * INPUT:
+ * U1 0		V1 0	U3 0	V3 0	...		U15 0	V15 0
+ *
+ * OUTPUT:
+ * U1 0		U2 0	U3 0	U4 0	...		U15 0	U15 0
+ * V1 0		V2 0	V3 0	V4 0	...		V15 0	V15 0
+ */
+EXTERN_INLINE void	reconstruct_last_missing_uv_avx2(__m256i* current_uv, __m256i* out_2_v16i_u_v_vectors) {
+	// U15 V15 U15 V15 U15 V15 U15 V15 | ...
+	__m256i		last_uv = _mm256_shuffle_epi32(_mm256_permute2x128_si256(*current_uv, *current_uv, 0x11), 0xFF);
+
+	reconstruct_missing_uv_avx2(current_uv, &last_uv, out_2_v16i_u_v_vectors);
+}
+
+/*
+ * Unpack 16 Y values and 8 U & V values from a planar YUV image to 3 vectors
+ * of 16 short Y, U & V and calculate the missing chroma values. 'next_u' and
+ * 'next_v' point to the 8 chroma values following the first one (they are
+ * equal to 'u_input + 1' and 'v_input + 1' except for the last 16 pixels in
+ * a line).
+ *
+ * Number of pixels handled:	16
+ *
+ * OUTPUT:
+ * Y1 	0	Y2 	0	Y3 	0	Y4 	0	...		Y16 0
+ * U1 	0	U2 	0	U3 	0	U4 	0	...		U16 0
+ * V1 	0	V2 	0	V3 	0	V4 	0	...		V16 0
+ */
+EXTERN_INLINE void	unpack_n_reconstruct_missing_uv_yuv42Xp_avx2(uint8_t* y_input, __m128i* current_u, __m128i* current_v, __m128i* next_u, __m128i* next_v, __m256i* out_3_v16i_y_u_v_vectors) {
+	__m128i		avg_u = _mm_srli_epi16(_mm_add_epi16(*current_u, *next_u), 1);
+	__m128i		avg_v = _mm_srli_epi16(_mm_add_epi16(*current_v, *next_v), 1);
+
+	out_3_v16i_y_u_v_vectors[0] = _mm256_cvtepu8_epi16(_mm_loadu_si128((__m128i *) y_input));
+	out_3_v16i_y_u_v_vectors[1] = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_unpacklo_epi16(*current_u, avg_u)), _mm_unpackhi_epi16(*current_u, avg_u), 1);
+	out_3_v16i_y_u_v_vectors[2] = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_unpacklo_epi16(*current_v, avg_v)), _mm_unpackhi_epi16(*current_v, avg_v), 1);
+}
+
+/*
+ * Unpack 16 Y values and 8 U & V values from a planar YUV image and
+ * calculate the missing chroma values.
+ */
+EXTERN_INLINE void	unpack_n_upsample_yuv42Xp_to_y_u_v_vectors_avx2(uint8_t* y_input, uint8_t* u_input, uint8_t* v_input, __m256i* out_3_v16i_y_u_v_vectors) {
+	__m128i		current_u = _mm_cvtepu8_epi16(_mm_loadl_epi64((__m128i *) u_input));
+	__m128i		current_v = _mm_cvtepu8_epi16(_mm_loadl_epi64((__m128i *) v_input));
+	__m128i		next_u = _mm_cvtepu8_epi16(_mm_loadl_epi64((__m128i *) (u_input + 1)));
+	__m128i		next_v = _mm_cvtepu8_epi16(_mm_loadl_epi64((__m128i *) (v_input + 1)));
+
+	unpack_n_reconstruct_missing_uv_yuv42Xp_avx2(y_input, &current_u, &current_v, &next_u, &next_v, out_3_v16i_y_u_v_vectors);
+}
+
+/*
+ * Same as above for the last 16 pixels in a line.
+ */
+EXTERN_INLINE void	unpack_n_upsample_last_yuv42Xp_to_y_u_v_vectors_avx2(uint8_t* y_input, uint8_t* u_input, uint8_t* v_input, __m256i* out_3_v16i_y_u_v_vectors) {
+	__m128i		current_u = _mm_cvtepu8_epi16(_mm_loadl_epi64((__m128i *) u_input));
+	__m128i		current_v = _mm_cvtepu8_epi16(_mm_loadl_epi64((__m128i *) v_input));
+	__m128i		next_u = _mm_alignr_epi8(_mm_srli_si128(current_u, 14), current_u, 2);
+	__m128i		next_v = _mm_alignr_epi8(_mm_srli_si128(current_v, 14), current_v, 2);
+
+	unpack_n_reconstruct_missing_uv_yuv42Xp_avx2(y_input, &current_u, &current_v, &next_u, &next_v, out_3_v16i_y_u_v_vectors);
+}
+
+/*
+ * Unpack 16 Y values and 8 U & V values from a YUV420P image, average the
+ * chroma values with the ones 'chroma_line_offset' bytes further (next chroma
+ * line, or 0 to use the current line only) and calculate the missing chroma
+ * values.
+ */
+EXTERN_INLINE void	unpack_n_upsample_yuv420p_to_y_u_v_vectors_avx2(uint8_t* y_input, uint8_t* u_input, uint8_t* v_input, uint32_t chroma_line_offset, __m256i* out_3_v16i_y_u_v_vectors) {
+	__m128i		avg_u = _mm_avg_epu8(_mm_loadu_si128((__m128i *) u_input), _mm_loadu_si128((__m128i *) (u_input + chroma_line_offset)));
+	__m128i		avg_v = _mm_avg_epu8(_mm_loadu_si128((__m128i *) v_input), _mm_loadu_si128((__m128i *) (v_input + chroma_line_offset)));
+	__m128i		current_u = _mm_cvtepu8_epi16(avg_u);
+	__m128i		current_v = _mm_cvtepu8_epi16(avg_v);
+	__m128i		next_u = _mm_cvtepu8_epi16(_mm_srli_si128(avg_u, 1));
+	__m128i		next_v = _mm_cvtepu8_epi16(_mm_srli_si128(avg_v, 1));
+
+	unpack_n_reconstruct_missing_uv_yuv42Xp_avx2(y_input, &current_u, &current_v, &next_u, &next_v, out_3_v16i_y_u_v_vectors);
+}
+
+/*
+ * Same as above for the last 16 pixels in a line.
+ */
+EXTERN_INLINE void	unpack_n_upsample_last_yuv420p_to_y_u_v_vectors_avx2(uint8_t* y_input, uint8_t* u_input, uint8_t* v_input, uint32_t chroma_line_offset, __m256i* out_3_v16i_y_u_v_vectors) {
+	__m128i		avg_u = _mm_avg_epu8(_mm_loadl_epi64((__m128i *) u_input), _mm_loadl_epi64((__m128i *) (u_input + chroma_line_offset)));
+	__m128i		avg_v = _mm_avg_epu8(_mm_loadl_epi64((__m128i *) v_input), _mm_loadl_epi64((__m128i *) (v_input + chroma_line_offset)));
+	__m128i		current_u = _mm_cvtepu8_epi16(avg_u);
+	__m128i		current_v = _mm_cvtepu8_epi16(avg_v);
+	__m128i		next_u = _mm_alignr_epi8(_mm_srli_si128(current_u, 14), current_u, 2);
+	__m128i		next_v = _mm_alignr_epi8(_mm_srli_si128(current_v, 14), current_v, 2);
+
+	unpack_n_reconstruct_missing_uv_yuv42Xp_avx2(y_input, &current_u, &current_v, &next_u, &next_v, out_3_v16i_y_u_v_vectors);
+}
+
+#endif	// __INTEL_CPU__
+
+#endif /* YUV_UPSAMPLE_AVX2_H_ */
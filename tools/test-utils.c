@@ -112,6 +112,18 @@ const InputFile		input_files[] = {
 	{	PixFcYUV420P,	1280, 	1024,		"1280x1024.yuv420p",},
 	{	PixFcYUV420P,	32, 	2,			NULL,				},
 
+	{	PixFcNV12,		1280, 	1024,		NULL,				},
+	{	PixFcNV12,		32, 	2,			NULL,				},
+
+	{	PixFcNV21,		1280, 	1024,		NULL,				},
+	{	PixFcNV21,		32, 	2,			NULL,				},
+
+	{	PixFcP010,		1280, 	1024,		NULL,				},
+	{	PixFcP010,		32, 	2,			NULL,				},
+
+	{	PixFcP210,		1280, 	1024,		NULL,				},
+	{	PixFcP210,		32, 	1,			NULL,				},
+
 	{	PixFcV210,		1920, 	1080,		"1920x1080.v210",	},
 	{	PixFcV210,		1280, 	720,		NULL,				},
 	{	PixFcV210,		112, 	2,			NULL,				},
@@ -244,9 +256,15 @@ void 				print_known_flags() {
 	printf("  PixFcFlag_SSE2Only               = %d\n", PixFcFlag_SSE2Only);
 	printf("  PixFcFlag_SSE2_SSSE3Only         = %d\n", PixFcFlag_SSE2_SSSE3Only);
 	printf("  PixFcFlag_SSE2_SSSE3_SSE41Only   = %d\n", PixFcFlag_SSE2_SSSE3_SSE41Only);
+	printf("  PixFcFlag_AVX2Only               = %d\n", PixFcFlag_AVX2Only);
+	printf("  PixFcFlag_AVX512Only             = %d\n", PixFcFlag_AVX512Only);
+	printf("  PixFcFlag_NEONOnly               = %d\n", PixFcFlag_NEONOnly);
 	printf("  PixFcFlag_BT601Conversion        = %d\n", PixFcFlag_BT601Conversion);
 	printf("  PixFcFlag_BT709Conversion        = %d\n", PixFcFlag_BT709Conversion);
 	printf("  PixFcFlag_NNbResamplingOnly      = %d\n", PixFcFlag_NNbResamplingOnly);
+	printf("  PixFcFlag_MultiThreaded          = %d\n", PixFcFlag_MultiThreaded);
+	printf("  PixFcFlag_Downscale2x            = %d\n", PixFcFlag_Downscale2x);
+	printf("  PixFcFlag_Downscale4x            = %d\n", PixFcFlag_Downscale4x);
 }
 
 void				print_flags(PixFcFlag flags) {
@@ -268,6 +286,15 @@ void				print_flags(PixFcFlag flags) {
 	if ((flags & PixFcFlag_SSE2_SSSE3_SSE41Only) != 0)
 			printf("  SSE2_SSSE3_SSE41Only");
 
+	if ((flags & PixFcFlag_AVX2Only) != 0)
+			printf("  AVX2Only");
+
+	if ((flags & PixFcFlag_AVX512Only) != 0)
+			printf("  AVX512Only");
+
+	if ((flags & PixFcFlag_NEONOnly) != 0)
+			printf("  NEONOnly");
+
 	if ((flags & PixFcFlag_BT601Conversion) != 0)
 		printf("  BT601Conversion");
 
@@ -277,6 +304,12 @@ void				print_flags(PixFcFlag flags) {
 	if ((flags & PixFcFlag_NNbResamplingOnly) != 0)
 		printf("  NNbResamplingOnly");
 
+	if ((flags & PixFcFlag_MultiThreaded) != 0)
+		printf("  MultiThreaded");
+
+	if (PIXFC_DOWNSCALE_FACTOR(flags) != 0)
+		printf("  Downscale%ux", PIXFC_DOWNSCALE_FACTOR(flags));
+
 	if (flags == PixFcFlag_Default)
 		printf("  Default");
 
@@ -304,6 +337,15 @@ PixFcFlag	get_matching_flags(char *flag_string) {
 	if ((flag_value & PixFcFlag_SSE2_SSSE3_SSE41Only) != 0)
 			flags |= PixFcFlag_SSE2_SSSE3_SSE41Only;
 
+	if ((flag_value & PixFcFlag_AVX2Only) != 0)
+			flags |= PixFcFlag_AVX2Only;
+
+	if ((flag_value & PixFcFlag_AVX512Only) != 0)
+			flags |= PixFcFlag_AVX512Only;
+
+	if ((flag_value & PixFcFlag_NEONOnly) != 0)
+			flags |= PixFcFlag_NEONOnly;
+
 	if ((flag_value & PixFcFlag_BT601Conversion) != 0)
 			flags |= PixFcFlag_BT601Conversion;
 
@@ -313,6 +355,11 @@ PixFcFlag	get_matching_flags(char *flag_string) {
 	if ((flag_value & PixFcFlag_NNbResamplingOnly) != 0)
 			flags |= PixFcFlag_NNbResamplingOnly;
 
+	if ((flag_value & PixFcFlag_MultiThreaded) != 0)
+			flags |= PixFcFlag_MultiThreaded;
+
+	flags |= (flag_value & PixFcFlag_DownscaleMask);
+
 	return flags;
 }
 
@@ -408,7 +455,7 @@ void		fill_image(PixFcPixelFormat fmt, uint32_t buffer_size, void * buf) {
 		// Planar format
 		__m128i* y_plane, *u_plane, *v_plane;
 
-		// Only supports YUV422P & YUV420P for now - back out if any other format, as we
+		// Only supports YUV422P, YUV420P, NV12, NV21, P010 & P210 for now - back out if any other format, as we
 		// dont know how to handle them yet.
 		if (fmt == PixFcYUV422P){
 			uint32_t pixel_count = buffer_size * desc->bytes_per_pix_denom / desc->bytes_per_pix_num;
@@ -492,6 +539,86 @@ void		fill_image(PixFcPixelFormat fmt, uint32_t buffer_size, void * buf) {
 					pixel_count -= 64;
 				}
 			}
+		} else if ((fmt == PixFcNV12) || (fmt == PixFcNV21)){
+			uint32_t pixel_count = buffer_size * desc->bytes_per_pix_denom / desc->bytes_per_pix_num;
+			__m128i* uv_plane;
+
+			y_plane = buffer;
+			uv_plane = (__m128i*) (((uint8_t*) y_plane) + pixel_count);
+
+			// Assume 5 fill vectors: 4 for Y plane, 1 for UV plane
+			if (desc->fill_patterns_count != 5) {
+				pixfc_log("FIXME !!!! Dont know how to fill '%s' buffer with %u fill pattern vectors\n",
+						desc->name, desc->fill_patterns_count);
+				return;
+			}
+
+			if (((uintptr_t) buffer & 0x0F) == 0) {
+				while (pixel_count > 0) {
+					_mm_store_si128(y_plane++, _M(desc->fill_patterns[0]));
+					_mm_store_si128(y_plane++, _M(desc->fill_patterns[1]));
+					_mm_store_si128(y_plane++, _M(desc->fill_patterns[2]));
+					_mm_store_si128(y_plane++, _M(desc->fill_patterns[3]));
+
+					_mm_store_si128(uv_plane++, _M(desc->fill_patterns[4]));
+					_mm_store_si128(uv_plane++, _M(desc->fill_patterns[4]));
+
+					// copy 64 pixels at a time
+					pixel_count -= 64;
+				}
+			} else {
+				while (pixel_count > 0) {
+					_mm_storeu_si128(y_plane++, _M(desc->fill_patterns[0]));
+					_mm_storeu_si128(y_plane++, _M(desc->fill_patterns[1]));
+					_mm_storeu_si128(y_plane++, _M(desc->fill_patterns[2]));
+					_mm_storeu_si128(y_plane++, _M(desc->fill_patterns[3]));
+
+					_mm_storeu_si128(uv_plane++, _M(desc->fill_patterns[4]));
+					_mm_storeu_si128(uv_plane++, _M(desc->fill_patterns[4]));
+
+					// copy 64 pixels at a time
+					pixel_count -= 64;
+				}
+			}
+		} else if ((fmt == PixFcP010) || (fmt == PixFcP210)){
+			uint32_t pixel_count = buffer_size * desc->bytes_per_pix_denom / desc->bytes_per_pix_num;
+			uint32_t uv_vector_count = (fmt == PixFcP010) ? 1 : 2;
+			uint32_t i;
+			__m128i* uv_plane;
+
+			y_plane = buffer;
+			uv_plane = (__m128i*) (((uint8_t*) y_plane) + pixel_count * 2);
+
+			// Assume 2 fill vectors: 1 for Y plane, 1 for UV plane
+			if (desc->fill_patterns_count != 2) {
+				pixfc_log("FIXME !!!! Dont know how to fill '%s' buffer with %u fill pattern vectors\n",
+						desc->name, desc->fill_patterns_count);
+				return;
+			}
+
+			if (((uintptr_t) buffer & 0x0F) == 0) {
+				while (pixel_count > 0) {
+					_mm_store_si128(y_plane++, _M(desc->fill_patterns[0]));
+					_mm_store_si128(y_plane++, _M(desc->fill_patterns[0]));
+
+					for(i = 0; i < uv_vector_count; i++)
+						_mm_store_si128(uv_plane++, _M(desc->fill_patterns[1]));
+
+					// copy 16 pixels at a time
+					pixel_count -= 16;
+				}
+			} else {
+				while (pixel_count > 0) {
+					_mm_storeu_si128(y_plane++, _M(desc->fill_patterns[0]));
+					_mm_storeu_si128(y_plane++, _M(desc->fill_patterns[0]));
+
+					for(i = 0; i < uv_vector_count; i++)
+						_mm_storeu_si128(uv_plane++, _M(desc->fill_patterns[1]));
+
+					// copy 16 pixels at a time
+					pixel_count -= 16;
+				}
+			}
 		} else {
 			pixfc_log("FIXME !!!! Dont know how to fill a buffer in '%s' planar image format\n", desc->name);
 			return;
@@ -805,6 +932,14 @@ PixFcFlag	synthesize_pixfc_flags(uint32_t index) {
 		flags |= PixFcFlag_SSE2Only;
 	else if (conversion_blocks[index].required_cpu_features == (CPUID_FEATURE_SSE2 | CPUID_FEATURE_SSSE3))
 		flags |= PixFcFlag_SSE2_SSSE3Only;
+	else if (conversion_blocks[index].required_cpu_features == (CPUID_FEATURE_SSE2 | CPUID_FEATURE_SSSE3 | CPUID_FEATURE_SSE41))
+		flags |= PixFcFlag_SSE2_SSSE3_SSE41Only;
+	else if (conversion_blocks[index].required_cpu_features == CPUID_FEATURE_AVX2)
+		flags |= PixFcFlag_AVX2Only;
+	else if (conversion_blocks[index].required_cpu_features == CPUID_FEATURE_AVX512)
+		flags |= PixFcFlag_AVX512Only;
+	else if (conversion_blocks[index].required_cpu_features == CPUID_FEATURE_NEON)
+		flags |= PixFcFlag_NEONOnly;
 	
 	if (conversion_blocks[index].attributes & BT601_CONVERSION)
 		flags |= PixFcFlag_BT601Conversion;
@@ -812,9 +947,17 @@ PixFcFlag	synthesize_pixfc_flags(uint32_t index) {
 	if (conversion_blocks[index].attributes & BT709_CONVERSION)
 		flags |= PixFcFlag_BT709Conversion;
 	
+	// Downscaling blocks are exercised with the smallest factor they support
+	if (conversion_blocks[index].attributes & DOWNSCALE_CONVERSION)
+		flags |= PixFcFlag_Downscale2x;
+	
 	return flags;
 }
 
+uint32_t	get_downscale_factor(PixFcFlag flags) {
+	return (PIXFC_DOWNSCALE_FACTOR(flags) == 0) ? 1 : PIXFC_DOWNSCALE_FACTOR(flags);
+}
+
 uint32_t	create_pixfc_for_conversion_block(uint32_t index, struct PixFcSSE** pixfc, uint32_t width, uint32_t height) {
 	uint32_t	flags = PixFcFlag_Default;
 	uint32_t	result;
@@ -840,7 +983,7 @@ uint32_t	create_pixfc_for_conversion_block(uint32_t index, struct PixFcSSE** pix
 			conversion_blocks[index].dest_fmt,
 			width, height,
 			ROW_SIZE(conversion_blocks[index].source_fmt, width),
-			ROW_SIZE(conversion_blocks[index].dest_fmt, width),
+			ROW_SIZE(conversion_blocks[index].dest_fmt, width / get_downscale_factor(flags)),
 			flags);
 	if (result != 0)
 		pixfc_log("Error (%d) creating struct pixfc for conversion '%s' %ux%u\n", result, conversion_blocks[index].name, width, height);
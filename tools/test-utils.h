@@ -175,6 +175,11 @@ void				do_timing(struct timings *timings);
  */
 PixFcFlag			synthesize_pixfc_flags(uint32_t index);
 
+/*
+ * Return the downscaling factor in the given flags (1 if none)
+ */
+uint32_t			get_downscale_factor(PixFcFlag flags);
+
 /*
  * Create a struct PicFcSSE struct  for the conversion block at the provided index
  * if the CPU has the required features. Caller must release struct when done
@@ -214,6 +219,9 @@ int32_t				make_conv_block_name_csv_friendly(uint32_t index, char **csv_name);
 #define SSCANF									sscanf
 #define CLOSE									close
 
+// Environment
+#define SETENV(name, value)						setenv((name), (value), 1)
+
 // Aligned allocation
 #define ALIGN_MALLOC(var, size, alignment)		do { int ret = posix_memalign((void **) &(var), (alignment), (size)); if (ret != 0) var = NULL; }while(0)
 #define ALIGN_FREE(var)							do { if (var) { free(var); (var) = NULL; } } while(0)
@@ -238,6 +246,9 @@ int32_t				make_conv_block_name_csv_friendly(uint32_t index, char **csv_name);
 #define SSCANF									_sscanf
 #define CLOSE									_close
 
+// Environment
+#define SETENV(name, value)						_putenv_s((name), (value))
+
 // Aligned allocation
 #define ALIGN_MALLOC(var, size, alignment)		(var) = _aligned_malloc((size), (alignment))
 #define ALIGN_FREE(var)							_aligned_free(var)
@@ -34,6 +34,19 @@
 #define		NUM_RUNS			100
 #define		NUM_INPUT_BUFFERS	5
 
+// Batch mode: number of images per batch, and of batches per measurement
+#define		BATCH_SIZE			256
+#define		NUM_BATCH_RUNS		10
+
+// Batch mode: image sizes
+static const uint32_t	batch_image_sizes[][2] = {
+	{ 64, 64 },
+	{ 128, 72 },
+	{ 160, 90 },
+	{ 256, 144 },
+	{ 320, 180 },
+};
+
 
 
 static int		time_conversion_block(struct PixFcSSE *pixfc, struct timings *timings) {
@@ -88,8 +101,14 @@ done:
 	return result;
 }
 
-static uint32_t		time_conversion_blocks(PixFcPixelFormat source_fmt, PixFcPixelFormat dest_fmt) {
+/*
+ * Time the conversion blocks matching the given source and destination formats
+ * (PixFcFormatCount matches all formats). Each block is timed with a prefetch
+ * distance of 0, then 1, 2, 4, ... lines up to 'max_prefetch_distance'.
+ */
+static uint32_t		time_conversion_blocks(PixFcPixelFormat source_fmt, PixFcPixelFormat dest_fmt, uint32_t max_prefetch_distance) {
 	uint32_t			index = 0;
+	uint32_t			prefetch_distance;
 	struct PixFcSSE		*pixfc;
 	struct timings		timings;
 	FILE				*file;
@@ -105,9 +124,9 @@ static uint32_t		time_conversion_blocks(PixFcPixelFormat source_fmt, PixFcPixelF
 	}
 	
 	pixfc_log("Input size: %d x %d - %d run(s) per conversion routine.\n", WIDTH, HEIGHT, NUM_RUNS);
-	printf("%-80s\t%10s\t%10s\t%10s\t%10s\n","Conversion Block Name", "Avg Time(ms)", "Avg User(ms)",
+	printf("%-80s\t%10s\t%10s\t%10s\t%10s\t%10s\n","Conversion Block Name", "Prefetch", "Avg Time(ms)", "Avg User(ms)",
 			"Avg Sys(ms)", "Total Ctx Sw");
-	fprintf(file, "Source,Destination,Standard,SSE,Resampling,Avg Time(ms),Avg User Time(ms),Avg Sys Time(ms),Total Ctx Sw\n");
+	fprintf(file, "Source,Destination,Standard,SSE,Resampling,Prefetch Distance,Avg Time(ms),Avg User Time(ms),Avg Sys Time(ms),Total Ctx Sw\n");
 
 	// Loop over all conversion blocks
 	for(index = 0; index < conversion_blocks_count; index++) {
@@ -122,30 +141,178 @@ static uint32_t		time_conversion_blocks(PixFcPixelFormat source_fmt, PixFcPixelF
 			continue;
 		}
 
-		// Reset timing info
-		memset((void *)&timings, 0, sizeof(timings));
+		make_conv_block_name_csv_friendly(index, &csv_conv_name);
 
-		// Time this conversion block
-		if (time_conversion_block(pixfc, &timings) != 0)
-			return -1;
+		// Time this conversion block with each prefetch distance
+		prefetch_distance = 0;
+		while(prefetch_distance <= max_prefetch_distance) {
+			// Reset timing info
+			memset((void *)&timings, 0, sizeof(timings));
+
+			set_pixfc_prefetch_distance(pixfc, prefetch_distance);
+			if (time_conversion_block(pixfc, &timings) != 0)
+				return -1;
+
+			printf("%-80s\t%10u\t%10f\t%10f\t%10f\t%10llu\n",
+					conversion_blocks[index].name,
+					prefetch_distance,
+					(double)((double)timings.total_time_ns / (double) (NUM_RUNS * 1000000)),
+					(double)((double)timings.user_time_ns / (double) (NUM_RUNS * 1000000)),
+					(double)((double)timings.sys_time_ns / (double) (NUM_RUNS * 1000000)),
+					(unsigned long long)timings.vcs + timings.ivcs
+			);
+			fprintf(file, "%s,%u,%.3f,%.3f,%.3f,%llu\n",
+					csv_conv_name,
+					prefetch_distance,
+					(double)((double)timings.total_time_ns / (double) (NUM_RUNS * 1000000)),
+					(double)((double)timings.user_time_ns / (double) (NUM_RUNS * 1000000)),
+					(double)((double)timings.sys_time_ns / (double) (NUM_RUNS * 1000000)),
+					(unsigned long long)timings.vcs + timings.ivcs);
+
+			prefetch_distance = (prefetch_distance == 0) ? 1 : prefetch_distance * 2;
+		}
 
+		free(csv_conv_name);
 		destroy_pixfc(pixfc);
 
-		printf("%-80s\t%10f\t%10f\t%10f\t%10llu\n",
-				conversion_blocks[index].name,
-				(double)((double)timings.total_time_ns / (double) (NUM_RUNS * 1000000)),
-				(double)((double)timings.user_time_ns / (double) (NUM_RUNS * 1000000)),
-				(double)((double)timings.sys_time_ns / (double) (NUM_RUNS * 1000000)),
-				(unsigned long long)timings.vcs + timings.ivcs
-		);
+		// Add a blank line if the next conversion block uses different
+		// source or destinaton format
+		if (((index + 1) < conversion_blocks_count)
+				&& ((conversion_blocks[(index + 1)].source_fmt !=
+						conversion_blocks[index].source_fmt)
+						|| (conversion_blocks[(index + 1)].dest_fmt !=
+								conversion_blocks[index].dest_fmt)))
+			printf("\n");
+	}
+	
+	fclose(file);
+
+	return 0;
+}
+
+/*
+ * Time the conversion of NUM_BATCH_RUNS batches of BATCH_SIZE images, with
+ * convert_batch() if 'use_batch' is set, or by calling convert() for each
+ * image otherwise.
+ */
+static void		time_batch_conversion(struct PixFcSSE *pixfc, uint32_t use_batch, void **input, void **output, struct timings *timings) {
+	uint32_t				run_count;
+	uint32_t				i;
+
+	for(run_count = 0; run_count < NUM_BATCH_RUNS; run_count++) {
+		do_timing(NULL);
+		if (use_batch)
+			convert_batch(pixfc, input, output, BATCH_SIZE);
+		else
+			for(i = 0; i < BATCH_SIZE; i++)
+				pixfc->convert(pixfc, input[i], output[i]);
+		do_timing(timings);
+
+		// Force context switch to invalidate caches
+		MSSLEEP(15);
+	}
+}
+
+#define FRAMES_PER_SECOND(timings)	((double) (NUM_BATCH_RUNS * BATCH_SIZE) * 1000000000.0 / (double) (timings).total_time_ns)
+
+/*
+ * Measure how many small images per second the conversion blocks matching
+ * the given source and destination formats convert: one at a time with
+ * convert(), in batches with convert_batch(), and in batches spread over
+ * all CPUs with a multithreaded struct PixFcSSE.
+ */
+static uint32_t		time_batch_conversions(PixFcPixelFormat source_fmt, PixFcPixelFormat dest_fmt) {
+	uint32_t			index = 0;
+	uint32_t			size;
+	uint32_t			i;
+	uint32_t			w, h;
+	struct PixFcSSE		*pixfc;
+	struct PixFcSSE		*pixfc_mt;
+	struct timings		timings[3];	// convert(), convert_batch(), multithreaded convert_batch()
+	void *				input[BATCH_SIZE];
+	void *				output[BATCH_SIZE];
+	FILE				*file;
+	char				filename[255] = {0};
+	char				*csv_conv_name = NULL;
+	uint32_t			result = 0;
+
+	SNPRINTF(filename, sizeof(filename), "batch_timings_%d_images_%d_runs_per_conversion.csv", BATCH_SIZE, NUM_BATCH_RUNS);
+
+	file = fopen(filename, "w");
+	if (file == NULL) {
+		pixfc_log("Error opening the CSV file for writing\n");
+		return -1;
+	}
+
+	pixfc_log("Batches of %d images - %d run(s) per conversion routine.\n", BATCH_SIZE, NUM_BATCH_RUNS);
+	printf("%-80s\t%10s\t%12s\t%12s\t%12s\n","Conversion Block Name", "Size", "convert()", "Batch", "Batch MT");
+	fprintf(file, "Source,Destination,Standard,SSE,Resampling,Width,Height,Frames per second,Batch frames per second,Multithreaded batch frames per second\n");
+
+	// Loop over all conversion blocks
+	for(index = 0; (index < conversion_blocks_count) && (result == 0); index++) {
+		if ((source_fmt != PixFcFormatCount) && (conversion_blocks[index].source_fmt != source_fmt))
+			continue;
+
+		if ((dest_fmt != PixFcFormatCount) && (conversion_blocks[index].dest_fmt != dest_fmt))
+			continue;
+
 		make_conv_block_name_csv_friendly(index, &csv_conv_name);
-		fprintf(file, "%s,%.3f,%.3f,%.3f,%llu\n",
-				csv_conv_name,
-				(double)((double)timings.total_time_ns / (double) (NUM_RUNS * 1000000)),
-				(double)((double)timings.user_time_ns / (double) (NUM_RUNS * 1000000)),
-				(double)((double)timings.sys_time_ns / (double) (NUM_RUNS * 1000000)),
-				(unsigned long long)timings.vcs + timings.ivcs);
+
+		for(size = 0; size < sizeof(batch_image_sizes) / sizeof(batch_image_sizes[0]); size++) {
+			w = batch_image_sizes[size][0];
+			h = batch_image_sizes[size][1];
+
+			if (create_pixfc_for_conversion_block(index, &pixfc, w, h) != 0) {
+				printf("Unable to test conversion block '%s' at %ux%u\n", conversion_blocks[index].name, w, h);
+				continue;
+			}
+
+			if (create_pixfc_mt(&pixfc_mt, pixfc->source_fmt, pixfc->dest_fmt, w, h, pixfc->source_row_bytes,
+					pixfc->dest_row_bytes, synthesize_pixfc_flags(index), 0) != PixFc_OK) {
+				printf("Unable to create multithreaded conversion for '%s' at %ux%u\n", conversion_blocks[index].name, w, h);
+				destroy_pixfc(pixfc);
+				continue;
+			}
+
+			// Allocate and fill the source images, and allocate the destination ones
+			memset(input, 0, sizeof(input));
+			memset(output, 0, sizeof(output));
+			for(i = 0; i < BATCH_SIZE; i++) {
+				if ((allocate_aligned_buffer(pixfc->source_fmt, w, h, &input[i]) != 0)
+						|| (allocate_aligned_buffer(pixfc->dest_fmt, w, h, &output[i]) != 0)) {
+					pixfc_log("Error allocating buffers\n");
+					result = -1;
+					break;
+				}
+
+				fill_image(pixfc->source_fmt, IMG_SIZE(pixfc->source_fmt, w, h), input[i]);
+			}
+
+			if (result == 0) {
+				memset((void *)timings, 0, sizeof(timings));
+				time_batch_conversion(pixfc, 0, input, output, &timings[0]);
+				time_batch_conversion(pixfc, 1, input, output, &timings[1]);
+				time_batch_conversion(pixfc_mt, 1, input, output, &timings[2]);
+
+				printf("%-80s\t%4ux%-5u\t%12.1f\t%12.1f\t%12.1f\n",
+						conversion_blocks[index].name, w, h,
+						FRAMES_PER_SECOND(timings[0]), FRAMES_PER_SECOND(timings[1]), FRAMES_PER_SECOND(timings[2]));
+				fprintf(file, "%s,%u,%u,%.1f,%.1f,%.1f\n",
+						csv_conv_name, w, h,
+						FRAMES_PER_SECOND(timings[0]), FRAMES_PER_SECOND(timings[1]), FRAMES_PER_SECOND(timings[2]));
+			}
+
+			// Free resources
+			for(i = 0; i < BATCH_SIZE; i++) {
+				ALIGN_FREE(input[i]);
+				ALIGN_FREE(output[i]);
+			}
+			destroy_pixfc(pixfc);
+			destroy_pixfc(pixfc_mt);
+		}
+
 		free(csv_conv_name);
+		csv_conv_name = NULL;
 
 		// Add a blank line if the next conversion block uses different
 		// source or destinaton format
@@ -156,23 +323,49 @@ static uint32_t		time_conversion_blocks(PixFcPixelFormat source_fmt, PixFcPixelF
 								conversion_blocks[index].dest_fmt)))
 			printf("\n");
 	}
-	
+
 	fclose(file);
 
-	return 0;
+	return result;
 }
 
 int 				main(int argc, char **argv) {
 	PixFcPixelFormat	source_fmt = PixFcFormatCount;
 	PixFcPixelFormat	dest_fmt = PixFcFormatCount;
+	uint32_t			max_prefetch_distance = 0;
+
+	// Usage: time_conversions [source_fmt [dest_fmt [max_prefetch_distance]]]
+	//        time_conversions batch [source_fmt [dest_fmt]]
+	// Unknown format names (such as "all") match all formats.
+	if ((argc >= 2) && (strcmp(argv[1], "batch") == 0)) {
+		if (argc >= 3)
+			source_fmt = find_matching_pixel_format(argv[2]);
+
+		if (argc >= 4)
+			dest_fmt = find_matching_pixel_format(argv[3]);
+
+		if (time_batch_conversions(source_fmt, dest_fmt) != 0) {
+			pixfc_log("FAILED\n");
+			return -1;
+		}
+
+		pixfc_log("\n");
+		return 0;
+	}
 
 	if (argc >= 2)
 		source_fmt = find_matching_pixel_format(argv[1]);
 
-	if (argc == 3)
+	if (argc >= 3)
 		dest_fmt = find_matching_pixel_format(argv[2]);
 
-	if (time_conversion_blocks(source_fmt, dest_fmt) != 0) {
+	// Prefetching lines past the end of the image is pointless
+	if (argc == 4)
+		max_prefetch_distance = (uint32_t) atoi(argv[3]);
+	if (max_prefetch_distance > HEIGHT)
+		max_prefetch_distance = HEIGHT;
+
+	if (time_conversion_blocks(source_fmt, dest_fmt, max_prefetch_distance) != 0) {
 		pixfc_log("FAILED\n");
 		return -1;
 	}
@@ -26,11 +26,15 @@
 #include "conversion_blocks.h"
 #include "conversion_routines_from_v210.h"
 #include "conversion_routines_from_argb.h"
+#include "conversion_routines_from_bgra.h"
 #include "conversion_routines_from_bgr24.h"
 #include "conversion_routines_from_rgb24.h"
 #include "conversion_routines_from_yuyv.h"
+#include "conversion_routines_from_uyvy.h"
 #include "conversion_routines_from_yuv422p.h"
 #include "conversion_routines_from_yuv420p.h"
+#include "conversion_routines_from_nv12.h"
+#include "conversion_routines_from_p210.h"
 #include "pixfc-sse.h"
 #include "pixfmt_descriptions.h"
 #include "platform_util.h"
@@ -171,6 +175,40 @@ static uint32_t		check_conversion_enumeration() {
 	return 0;
 }
 
+/*
+ * Make sure the conversion block index used by create_pixfc() covers
+ * every conversion block, which requires blocks for the same pair of
+ * formats to be declared next to each other in conversion_blocks[].
+ */
+static uint32_t		check_conversion_block_index() {
+	uint32_t 			index;
+	uint32_t			first;
+	uint32_t			count;
+
+	for(index = 0; index < conversion_blocks_count; index++) {
+		first = get_conversion_block_range(conversion_blocks[index].source_fmt, conversion_blocks[index].dest_fmt, &count);
+		if ((index < first) || (index >= first + count)) {
+			pixfc_log("Conversion block '%s' (index %u) not in range %u - %u: blocks for the same formats must be contiguous\n",
+					conversion_blocks[index].name, index, first, first + count);
+			return -1;
+		}
+
+		if (is_conversion_block_supported(index) != does_cpu_support(conversion_blocks[index].required_cpu_features)) {
+			pixfc_log("Wrong cached CPU support for conversion block '%s'\n", conversion_blocks[index].name);
+			return -1;
+		}
+	}
+
+	// Out of range formats have no conversion blocks
+	get_conversion_block_range(PixFcFormatCount, PixFcYUYV, &count);
+	if (count != 0) {
+		pixfc_log("Conversion blocks returned for invalid source format\n");
+		return -1;
+	}
+
+	return 0;
+}
+
 static uint32_t 	do_flag_check(PixFcPixelFormat source_fmt, PixFcPixelFormat dest_fmt, PixFcFlag flag, PixFcFlag expected_flags, ConversionBlockFn expected_conv_fn) {
 	struct PixFcSSE *	pixfc;
 	uint32_t			result = -1;
@@ -193,6 +231,9 @@ static uint32_t 	do_flag_check(PixFcPixelFormat source_fmt, PixFcPixelFormat des
 // Run various checks on conversion routines' flags
 static uint32_t	check_pixfc_flags() {
 	uint32_t index;
+	// v210 to RGB picks AVX-512 routines over SSE4.1 ones when available
+	uint32_t avx512 = (does_cpu_support(CPUID_FEATURE_AVX512) == 0) ? 1 : 0;
+	PixFcFlag v210_flag = avx512 ? PixFcFlag_AVX512Only : PixFcFlag_SSE2_SSSE3_SSE41Only;
 
 	// TODO: Update here when new flags are added
 
@@ -235,8 +276,8 @@ static uint32_t	check_pixfc_flags() {
 
 	// Default flag
 	CHECK_FLAGS("default", PixFcV210, PixFcARGB,
-			PixFcFlag_Default, PixFcFlag_SSE2_SSSE3_SSE41Only,
-			upsample_n_convert_v210_to_argb_sse2_ssse3_sse41);
+			PixFcFlag_Default, v210_flag,
+			avx512 ? upsample_n_convert_v210_to_argb_avx512 : upsample_n_convert_v210_to_argb_sse2_ssse3_sse41);
 
 
 
@@ -272,12 +313,23 @@ static uint32_t	check_pixfc_flags() {
 			PixFcFlag_NoSSE  | PixFcFlag_BT601Conversion | PixFcFlag_NNbResamplingOnly,
 			convert_yuv420p_to_any_rgb_bt601_nonsse);
 
+	// NoSSE | BT709 (YUV420P to RGB)
+	CHECK_FLAGS("NoSSE | BT709 (YUV420P to RGB)", PixFcYUV420P, PixFcBGR24,
+			PixFcFlag_NoSSE  | PixFcFlag_BT709Conversion,
+			PixFcFlag_NoSSE  | PixFcFlag_BT709Conversion,
+			upsample_n_convert_yuv420p_to_any_rgb_bt709_nonsse);
+
 	// NoSSE | BT709 | NNB
 	CHECK_FLAGS("NoSSE | BT709 | NNB", PixFcYUYV, PixFcBGRA,
 			PixFcFlag_NoSSE  | PixFcFlag_BT709Conversion | PixFcFlag_NNbResamplingOnly,
 			PixFcFlag_NoSSE  | PixFcFlag_BT709Conversion | PixFcFlag_NNbResamplingOnly,
 			convert_yuv422i_to_any_rgb_bt709_nonsse);
 
+	// NoSSE (RGB to YUV420P)
+	CHECK_FLAGS("NoSSE (RGB to YUV420P)", PixFcRGB24, PixFcYUV420P,
+			PixFcFlag_NoSSE, PixFcFlag_NoSSE,
+			downsample_n_convert_rgb_to_yuv420_nonsse);
+
 
 
 
@@ -285,14 +337,14 @@ static uint32_t	check_pixfc_flags() {
 	// NNB flag
 	CHECK_FLAGS("NNB", PixFcV210, PixFcARGB,
 			PixFcFlag_NNbResamplingOnly,
-			PixFcFlag_NNbResamplingOnly| PixFcFlag_SSE2_SSSE3_SSE41Only,
-			convert_v210_to_argb_sse2_ssse3_sse41);
+			PixFcFlag_NNbResamplingOnly | v210_flag,
+			avx512 ? convert_v210_to_argb_avx512 : convert_v210_to_argb_sse2_ssse3_sse41);
 
 	// BT601
 	CHECK_FLAGS("BT601", PixFcV210, PixFcARGB,
 			PixFcFlag_BT601Conversion,
-			PixFcFlag_BT601Conversion | PixFcFlag_SSE2_SSSE3_SSE41Only,
-			upsample_n_convert_v210_to_argb_bt601_sse2_ssse3_sse41);
+			PixFcFlag_BT601Conversion | v210_flag,
+			avx512 ? upsample_n_convert_v210_to_argb_bt601_avx512 : upsample_n_convert_v210_to_argb_bt601_sse2_ssse3_sse41);
 
 	// BT709
 	CHECK_FLAGS("BT709", PixFcYUYV, PixFcR210,
@@ -304,8 +356,8 @@ static uint32_t	check_pixfc_flags() {
 	// BT601 | NNB
 	CHECK_FLAGS("BT601 | NNB", PixFcV210, PixFcARGB,
 			PixFcFlag_BT601Conversion | PixFcFlag_NNbResamplingOnly,
-			PixFcFlag_BT601Conversion | PixFcFlag_NNbResamplingOnly | PixFcFlag_SSE2_SSSE3_SSE41Only,
-			convert_v210_to_argb_bt601_sse2_ssse3_sse41);
+			PixFcFlag_BT601Conversion | PixFcFlag_NNbResamplingOnly | v210_flag,
+			avx512 ? convert_v210_to_argb_bt601_avx512 : convert_v210_to_argb_bt601_sse2_ssse3_sse41);
 
 	// BT709 | NNB
 	CHECK_FLAGS("BT709 | NNB", PixFcYUYV, PixFcR210,
@@ -313,6 +365,83 @@ static uint32_t	check_pixfc_flags() {
 			PixFcFlag_BT709Conversion | PixFcFlag_NNbResamplingOnly | PixFcFlag_SSE2_SSSE3Only,
 			convert_yuyv_to_r210_bt709_sse2_ssse3);
 
+	// BT709 (RGB to YUV420P)
+	CHECK_FLAGS("BT709 (RGB to YUV420P)", PixFcBGR24, PixFcYUV420P,
+			PixFcFlag_BT709Conversion,
+			PixFcFlag_BT709Conversion | PixFcFlag_SSE2_SSSE3Only,
+			downsample_n_convert_bgr24_to_yuv420p_bt709_sse2_ssse3);
+
+	// NNB (RGB to YUV420P)
+	CHECK_FLAGS("NNB (RGB to YUV420P)", PixFcBGR24, PixFcYUV420P,
+			PixFcFlag_NNbResamplingOnly,
+			PixFcFlag_NNbResamplingOnly | PixFcFlag_SSE2_SSSE3Only,
+			convert_bgr24_to_yuv420p_sse2_ssse3);
+
+	// BT601 (RGB to NV12)
+	CHECK_FLAGS("BT601 (RGB to NV12)", PixFcARGB, PixFcNV12,
+			PixFcFlag_BT601Conversion,
+			PixFcFlag_BT601Conversion | PixFcFlag_SSE2_SSSE3Only,
+			downsample_n_convert_argb_to_nv12_bt601_sse2_ssse3);
+
+	// NNB (NV21 to RGB)
+	CHECK_FLAGS("NNB (NV21 to RGB)", PixFcNV21, PixFcRGB24,
+			PixFcFlag_NNbResamplingOnly,
+			PixFcFlag_NNbResamplingOnly | PixFcFlag_SSE2_SSSE3Only,
+			convert_nv21_to_rgb24_sse2_ssse3);
+
+	// NV12 to YUYV
+	CHECK_FLAGS("NV12 to YUYV", PixFcNV12, PixFcYUYV,
+			0, PixFcFlag_SSE2Only,
+			convert_nv12_to_yuyv_sse2);
+
+	// BT709 | NNB (P010 to RGB)
+	CHECK_FLAGS("BT709 | NNB (P010 to RGB)", PixFcP010, PixFcR210,
+			PixFcFlag_BT709Conversion | PixFcFlag_NNbResamplingOnly,
+			PixFcFlag_BT709Conversion | PixFcFlag_NNbResamplingOnly | PixFcFlag_SSE2_SSSE3Only,
+			convert_p010_to_r210_bt709_sse2_ssse3);
+
+	// P210 to v210
+	CHECK_FLAGS("P210 to v210", PixFcP210, PixFcV210,
+			0, PixFcFlag_SSE2_SSSE3_SSE41Only,
+			convert_p210_to_v210_sse2_ssse3_sse41);
+
+	// v210 to P010
+	CHECK_FLAGS("v210 to P010", PixFcV210, PixFcP010,
+			0, PixFcFlag_SSE2_SSSE3_SSE41Only,
+			convert_v210_to_p010_sse2_ssse3_sse41);
+
+	// YUYV to YUV420P
+	CHECK_FLAGS("YUYV to YUV420P", PixFcYUYV, PixFcYUV420P,
+			0, PixFcFlag_SSE2Only,
+			downsample_n_convert_yuyv_to_yuv420p_sse2);
+
+	// NNB (YUV420P to YUYV)
+	CHECK_FLAGS("NNB (YUV420P to YUYV)", PixFcYUV420P, PixFcYUYV,
+			PixFcFlag_NNbResamplingOnly,
+			PixFcFlag_NNbResamplingOnly | PixFcFlag_SSE2Only,
+			convert_yuv420p_to_yuyv_sse2);
+
+	// SSE2_SSSE3Only (YUYV to UYVY)
+	CHECK_FLAGS("SSE2_SSSE3Only (YUYV to UYVY)", PixFcYUYV, PixFcUYVY,
+			PixFcFlag_SSE2_SSSE3Only, PixFcFlag_SSE2_SSSE3Only,
+			convert_yuyv_to_uyvy_sse2_ssse3);
+
+	// SSE2Only (RGB24 to BGRA)
+	CHECK_FLAGS("SSE2Only (RGB24 to BGRA)", PixFcRGB24, PixFcBGRA,
+			PixFcFlag_SSE2Only, PixFcFlag_SSE2Only,
+			convert_rgb24_to_bgra_sse2);
+
+	// YUV420P to v210
+	CHECK_FLAGS("YUV420P to v210", PixFcYUV420P, PixFcV210,
+			0, PixFcFlag_SSE2_SSSE3_SSE41Only,
+			convert_yuv420p_to_v210_sse2_ssse3_sse41);
+
+	// SSE2_SSSE3Only | BT601 (YUV420P to RGB)
+	CHECK_FLAGS("SSE2_SSSE3Only | BT601 (YUV420P to RGB)", PixFcYUV420P, PixFcARGB,
+			PixFcFlag_SSE2_SSSE3Only | PixFcFlag_BT601Conversion,
+			PixFcFlag_SSE2_SSSE3Only | PixFcFlag_BT601Conversion,
+			upsample_n_convert_yuv420p_to_argb_bt601_sse2_ssse3);
+
 
 
 
@@ -377,6 +506,11 @@ static uint32_t	check_pixfc_flags() {
 			PixFcFlag_SSE2Only, PixFcFlag_SSE2Only,
 			downsample_n_convert_argb_to_yuyv_sse2);
 
+	// SSE2Only (RGB to YUV420P)
+	CHECK_FLAGS("SSE2Only (RGB to YUV420P)", PixFcARGB, PixFcYUV420P,
+			PixFcFlag_SSE2Only, PixFcFlag_SSE2Only,
+			downsample_n_convert_argb_to_yuv420p_sse2);
+
 	// SSE2Only | NNB flag
 	CHECK_FLAGS("SSE2Only | NNB ", PixFcARGB, PixFcYUYV,
 			PixFcFlag_SSE2Only | PixFcFlag_NNbResamplingOnly,
@@ -421,6 +555,101 @@ static uint32_t	check_pixfc_flags() {
 			upsample_n_convert_v210_to_argb_sse2_ssse3_sse41);
 
 
+	//
+	// AVX2Only flag
+	if (does_cpu_support(CPUID_FEATURE_AVX2) == 0) {
+		// Default flag picks AVX2 routines when available
+		CHECK_FLAGS("default w/ AVX2", PixFcYUYV, PixFcARGB,
+				PixFcFlag_Default, PixFcFlag_AVX2Only,
+				upsample_n_convert_yuyv_to_argb_avx2);
+
+		CHECK_FLAGS("AVX2Only | BT709 | NNB", PixFcYUV420P, PixFcBGR24,
+				PixFcFlag_AVX2Only | PixFcFlag_BT709Conversion | PixFcFlag_NNbResamplingOnly,
+				PixFcFlag_AVX2Only | PixFcFlag_BT709Conversion | PixFcFlag_NNbResamplingOnly,
+				convert_yuv420p_to_bgr24_bt709_avx2);
+
+		CHECK_FLAGS("AVX2Only | BT709", PixFcYUV420P, PixFcBGR24,
+				PixFcFlag_AVX2Only | PixFcFlag_BT709Conversion,
+				PixFcFlag_AVX2Only | PixFcFlag_BT709Conversion,
+				upsample_n_convert_yuv420p_to_bgr24_bt709_avx2);
+
+		CHECK_FLAGS("default w/ AVX2", PixFcARGB, PixFcV210,
+				PixFcFlag_Default, PixFcFlag_AVX2Only,
+				downsample_n_convert_argb_to_v210_avx2);
+
+		CHECK_FLAGS("default w/ AVX2", PixFcUYVY, PixFcYUYV,
+				PixFcFlag_Default, PixFcFlag_AVX2Only,
+				convert_uyvy_to_yuyv_avx2);
+
+		CHECK_FLAGS("default w/ AVX2", PixFcARGB, PixFcBGRA,
+				PixFcFlag_Default, PixFcFlag_AVX2Only,
+				convert_argb_to_bgra_avx2);
+
+		CHECK_FLAGS("AVX2Only | BT601 | NNB", PixFcBGRA, PixFcUYVY,
+				PixFcFlag_AVX2Only | PixFcFlag_BT601Conversion | PixFcFlag_NNbResamplingOnly,
+				PixFcFlag_AVX2Only | PixFcFlag_BT601Conversion | PixFcFlag_NNbResamplingOnly,
+				convert_bgra_to_uyvy_bt601_avx2);
+
+		// SSE flags must still select SSE routines
+		CHECK_FLAGS("SSE2_SSSE3Only w/ AVX2", PixFcYUYV, PixFcARGB,
+				PixFcFlag_SSE2_SSSE3Only, PixFcFlag_SSE2_SSSE3Only,
+				upsample_n_convert_yuyv_to_argb_sse2_ssse3);
+
+		// No AVX2 routine for this conversion
+		CHECK_FLAGS_FAIL("AVX2Only", PixFcV210, PixFcARGB,
+				PixFcFlag_AVX2Only, PixFcFlag_AVX2Only,
+				NULL);
+	} else {
+		CHECK_FLAGS_FAIL("AVX2Only w/o AVX2", PixFcYUYV, PixFcARGB,
+				PixFcFlag_AVX2Only, PixFcFlag_AVX2Only,
+				NULL);
+	}
+
+
+	//
+	// AVX512Only flag
+	if (avx512) {
+		CHECK_FLAGS("AVX512Only | BT709", PixFcV210, PixFcBGR24,
+				PixFcFlag_AVX512Only | PixFcFlag_BT709Conversion,
+				PixFcFlag_AVX512Only | PixFcFlag_BT709Conversion,
+				upsample_n_convert_v210_to_bgr24_bt709_avx512);
+
+		CHECK_FLAGS("default w/ AVX512", PixFcV210, PixFcUYVY,
+				PixFcFlag_Default, PixFcFlag_AVX512Only,
+				convert_v210_to_uyvy_avx512);
+
+		CHECK_FLAGS("default w/ AVX512", PixFcYUYV, PixFcV210,
+				PixFcFlag_Default, PixFcFlag_AVX512Only,
+				convert_yuyv_to_v210_avx512);
+
+		// SSE flags must still select SSE routines
+		CHECK_FLAGS("SSE2_SSSE3_SSE41Only w/ AVX512", PixFcV210, PixFcARGB,
+				PixFcFlag_SSE2_SSSE3_SSE41Only, PixFcFlag_SSE2_SSSE3_SSE41Only,
+				upsample_n_convert_v210_to_argb_sse2_ssse3_sse41);
+
+		// No AVX-512 routine for this conversion
+		CHECK_FLAGS_FAIL("AVX512Only", PixFcYUYV, PixFcARGB,
+				PixFcFlag_AVX512Only, PixFcFlag_AVX512Only,
+				NULL);
+	} else {
+		CHECK_FLAGS_FAIL("AVX512Only w/o AVX512", PixFcV210, PixFcARGB,
+				PixFcFlag_AVX512Only, PixFcFlag_AVX512Only,
+				NULL);
+	}
+
+
+	//
+	// NonTemporalStores flag
+	CHECK_FLAGS("NonTemporalStores", PixFcYUYV, PixFcARGB,
+			PixFcFlag_NonTemporalStores, PixFcFlag_SSE2_SSSE3Only | PixFcFlag_NonTemporalStores,
+			upsample_n_convert_yuyv_to_argb_sse2_ssse3);
+
+	// Non-SSE routines do not use non-temporal stores
+	CHECK_FLAGS("NoSSE | NonTemporalStores", PixFcYUYV, PixFcARGB,
+			PixFcFlag_NoSSE | PixFcFlag_NonTemporalStores, PixFcFlag_NoSSE,
+			upsample_n_convert_yuv422i_to_any_rgb_nonsse);
+
+
 	return 0;
 }
 
@@ -477,6 +706,10 @@ static uint32_t check_conversion_buffer_sizes() {
 	static const uint32_t	w_32_2[] = {32, 32*2, 32*3, 32*4, 32*5, 32*6, 736, 736, 960, 1280, 1920};
 	static const uint32_t	h_32_2[] = {2,  2,    2,    2,    2,    2,    480, 576, 720, 1024, 1080};
 	static const uint32_t 	size_count_32_2 = sizeof(w_32_2)/sizeof(w_32_2[0]);
+	// Source sizes for 2x downscaling blocks (the output width is a multiple of 48)
+	static const uint32_t	w_ds[] = {96, 96*2, 96*3, 96*4, 96, 96*2, 96*3, 96*4, 1152, 1440, 1920};
+	static const uint32_t	h_ds[] = {2,  2,    2,    2,    4,  4,    4,    4,    720,  1080, 1080};
+	static const uint32_t 	size_count_ds = sizeof(w_ds)/sizeof(w_ds[0]);
 	uint32_t				size_index = 0;
 
 	//
@@ -487,7 +720,11 @@ static uint32_t check_conversion_buffer_sizes() {
 
 	// Loop over all conversion blocks
 	for(conv_index = 0; conv_index < conversion_blocks_count; conv_index++) {
-		if ((conversion_blocks[conv_index].width_multiple == 8) && (conversion_blocks[conv_index].height_multiple == 1)) {
+		if (conversion_blocks[conv_index].attributes & DOWNSCALE_CONVERSION) {
+			width_array = w_ds;
+			height_array = h_ds;
+			array_size = size_count_ds;
+		} else if ((conversion_blocks[conv_index].width_multiple == 8) && (conversion_blocks[conv_index].height_multiple == 1)) {
 			width_array = w_8_1;
 			height_array = h_8_1;
 			array_size = size_count_8_1;
@@ -544,60 +781,1231 @@ static uint32_t check_conversion_buffer_sizes() {
 }
 
 /*
- * Here we run a few tests to make sure things are sound internally
+ * Make sure conversions honour row bytes larger than ROW_SIZE(), with
+ * both 16-byte aligned and unaligned amounts of padding at the end of
+ * each line. Planar formats must be tightly packed so they are left alone.
  */
-int 				main(int argc, char **argv) {
+#define PADDING_FILL_BYTE		0xA5
+static uint32_t check_row_bytes_conversions() {
+	struct PixFcSSE *	pixfc;
+	struct PixFcSSE *	pixfc_padded;
+	uint8_t *			input = NULL;
+	uint8_t *			padded_input = NULL;
+	uint8_t *			output = NULL;
+	uint8_t *			padded_output = NULL;
+	uint32_t			paddings[] = { 64, 4 };
+	uint32_t			w = 192, h = 18, index = 0, p, line;
+	uint32_t			out_h;
+	uint32_t			src_row_size, dst_row_size, src_row_bytes, dst_row_bytes;
+	uint32_t			result = 0;
 
-	// SSE2 / SSSE3 and SSE41 are required to run this app.
-	if (does_cpu_support(CPUID_FEATURE_SSE41 | CPUID_FEATURE_SSSE3 | CPUID_FEATURE_SSE2) != 0) {
-		pixfc_log("CPU does not support required SSE features - exiting\n");
-		return 1;
+	// Loop over all conversion blocks
+	for(index = 0; (index < conversion_blocks_count) && (result == 0); index++) {
+		if (create_pixfc_for_conversion_block(index, &pixfc, w, h) != 0) {
+			pixfc_log("Unable to test conversion block '%s'\n", conversion_blocks[index].name);
+			continue;
+		}
+
+		// Downscaling blocks output w / factor x h / factor images
+		src_row_size = ROW_SIZE(pixfc->source_fmt, w);
+		dst_row_size = ROW_SIZE(pixfc->dest_fmt, w / get_downscale_factor(pixfc->flags));
+		out_h = h / get_downscale_factor(pixfc->flags);
+
+		// Do a reference conversion with tightly packed buffers
+		if ((allocate_aligned_buffer(pixfc->source_fmt, w, h, (void **)&input) != 0)
+				|| (allocate_aligned_buffer(pixfc->dest_fmt, w, h, (void **)&output) != 0)) {
+			pixfc_log("Error allocating buffers\n");
+			return -1;
+		}
+		fill_image(pixfc->source_fmt, IMG_SIZE(pixfc->source_fmt, w, h), input);
+		pixfc->convert(pixfc, input, output);
+
+		for(p = 0; (p < sizeof(paddings) / sizeof(paddings[0])) && (result == 0); p++) {
+			src_row_bytes = src_row_size + (pixfmt_descriptions[pixfc->source_fmt].is_planar ? 0 : paddings[p]);
+			dst_row_bytes = dst_row_size + (pixfmt_descriptions[pixfc->dest_fmt].is_planar ? 0 : paddings[p]);
+
+			if (create_pixfc(&pixfc_padded, pixfc->source_fmt, pixfc->dest_fmt, w, h, src_row_bytes,
+					dst_row_bytes, synthesize_pixfc_flags(index)) != PixFc_OK) {
+				pixfc_log("Error creating struct pixfc with row bytes %u / %u for '%s'\n",
+						src_row_bytes, dst_row_bytes, conversion_blocks[index].name);
+				return -1;
+			}
+
+			ALIGN_MALLOC(padded_input, src_row_bytes * h, 16);
+			ALIGN_MALLOC(padded_output, dst_row_bytes * out_h, 16);
+			if (! padded_input || ! padded_output) {
+				pixfc_log("Error allocating buffers\n");
+				return -1;
+			}
+
+			// Copy the input image line by line and fill the padding bytes
+			// so we can check they are not touched.
+			memset(padded_input, PADDING_FILL_BYTE, src_row_bytes * h);
+			memset(padded_output, PADDING_FILL_BYTE, dst_row_bytes * out_h);
+			for(line = 0; line < h; line++)
+				memcpy(padded_input + line * src_row_bytes, input + line * src_row_size, src_row_size);
+
+			pixfc_padded->convert(pixfc_padded, padded_input, padded_output);
+
+			for(line = 0; (line < out_h) && (result == 0); line++) {
+				if (memcmp(padded_output + line * dst_row_bytes, output + line * dst_row_size, dst_row_size) != 0) {
+					pixfc_log("Output line %u differs with row bytes %u / %u for '%s'\n",
+							line, src_row_bytes, dst_row_bytes, conversion_blocks[index].name);
+					result = -1;
+				} else if ((dst_row_bytes > dst_row_size)
+						&& ((padded_output[line * dst_row_bytes + dst_row_size] != PADDING_FILL_BYTE)
+						|| (padded_output[(line + 1) * dst_row_bytes - 1] != PADDING_FILL_BYTE))) {
+					pixfc_log("Padding bytes overwritten on line %u with row bytes %u / %u for '%s'\n",
+							line, src_row_bytes, dst_row_bytes, conversion_blocks[index].name);
+					result = -1;
+				}
+			}
+
+			destroy_pixfc(pixfc_padded);
+			ALIGN_FREE(padded_input);
+			ALIGN_FREE(padded_output);
+		}
+
+		// Free resources
+		destroy_pixfc(pixfc);
+		ALIGN_FREE(input);
+		ALIGN_FREE(output);
 	}
 
-	pixfc_log("\n");
-	pixfc_log("\t\tU N I T   T E S T I N G\n");
+	return result;
+}
 
-	pixfc_log("\n");
-	pixfc_log("Running internal checks ...\n");
-	if (check_conversion_enumeration() != 0) {
-		pixfc_log("FAILED\n");
-		return -1;
+/*
+ * Make sure multithreaded conversions produce the same output
+ * as single-threaded ones.
+ */
+static uint32_t check_multithreaded_conversions() {
+	struct PixFcSSE *	pixfc;
+	struct PixFcSSE *	pixfc_mt;
+	void *				input = NULL;
+	void *				output[2] = { NULL };	// 1 single-threaded & 1 multithreaded output buffer
+	uint32_t			w = 192, h = 18, index = 0;
+	uint32_t			result = 0;
+
+	// Loop over all conversion blocks
+	for(index = 0; (index < conversion_blocks_count) && (result == 0); index++) {
+		if (create_pixfc_for_conversion_block(index, &pixfc, w, h) != 0) {
+			pixfc_log("Unable to test conversion block '%s'\n", conversion_blocks[index].name);
+			continue;
+		}
+
+		if (create_pixfc_mt(&pixfc_mt, pixfc->source_fmt, pixfc->dest_fmt, w, h, pixfc->source_row_bytes,
+				pixfc->dest_row_bytes, synthesize_pixfc_flags(index), 4) != PixFc_OK) {
+			pixfc_log("Error creating multithreaded struct pixfc for '%s'\n", conversion_blocks[index].name);
+			return -1;
+		}
+
+		pixfc_log("%-80s%u thread(s)\n", conversion_blocks[index].name, pixfc_mt->thread_count);
+
+		// Allocate the input & output buffers
+		if ((allocate_aligned_buffer(pixfc->source_fmt, w, h, &input) != 0)
+				|| (allocate_aligned_buffer(pixfc->dest_fmt, w, h, &output[0]) != 0)
+				|| (allocate_aligned_buffer(pixfc->dest_fmt, w, h, &output[1]) != 0)) {
+			pixfc_log("Error allocating buffers\n");
+			return -1;
+		}
+
+		// Fill input buffer and clear output buffers (some formats have padding bytes)
+		fill_image(pixfc->source_fmt, IMG_SIZE(pixfc->source_fmt, w, h), input);
+		memset(output[0], 0, IMG_SIZE(pixfc->dest_fmt, w, h));
+		memset(output[1], 0, IMG_SIZE(pixfc->dest_fmt, w, h));
+
+		pixfc->convert(pixfc, input, output[0]);
+		pixfc_mt->convert(pixfc_mt, input, output[1]);
+
+		if (memcmp(output[0], output[1], IMG_SIZE(pixfc->dest_fmt, w, h)) != 0) {
+			pixfc_log("Multithreaded conversion output differs for '%s'\n", conversion_blocks[index].name);
+			result = -1;
+		}
+
+		// Free resources
+		destroy_pixfc(pixfc);
+		destroy_pixfc(pixfc_mt);
+		ALIGN_FREE(input);
+		ALIGN_FREE(output[0]);
+		ALIGN_FREE(output[1]);
 	}
-	pixfc_log("PASSED\n");
 
+	return result;
+}
 
-	pixfc_log("\n");
-	pixfc_log("\n");
-	pixfc_log("Running PixFcFlags checks ...\n");
-	if (check_pixfc_flags()!= 0) {
-		pixfc_log("FAILED\n");
-		return -1;
-	} else
-		pixfc_log("PASSED\n");
+/*
+ * Make sure AVX2 conversions produce the exact same output as their
+ * non-SSE integer counterparts.
+ */
+static uint32_t check_avx2_conversions() {
+	struct PixFcSSE *	pixfc;
+	struct PixFcSSE *	pixfc_ref;
+	void *				input = NULL;
+	void *				output[2] = { NULL };	// 1 AVX2 & 1 non-SSE output buffer
+	// The width is not a multiple of 48 so the last v210 group in a line is partial
+	uint32_t			w = 224, h = 18, index = 0, ref_index;
+	uint32_t			result = 0;
+
+	if (does_cpu_support(CPUID_FEATURE_AVX2) != 0) {
+		pixfc_log("CPU does not support AVX2 - skipping\n");
+		return 0;
+	}
+
+	// Loop over all AVX2 conversion blocks
+	for(index = 0; (index < conversion_blocks_count) && (result == 0); index++) {
+		if (conversion_blocks[index].required_cpu_features != CPUID_FEATURE_AVX2)
+			continue;
 
+		// Find the matching non-SSE integer conversion block
+		for(ref_index = 0; ref_index < conversion_blocks_count; ref_index++) {
+			if ((conversion_blocks[ref_index].source_fmt == conversion_blocks[index].source_fmt)
+					&& (conversion_blocks[ref_index].dest_fmt == conversion_blocks[index].dest_fmt)
+					&& (conversion_blocks[ref_index].required_cpu_features == CPUID_FEATURE_NONE)
+					&& (conversion_blocks[ref_index].attributes == conversion_blocks[index].attributes))
+				break;
+		}
+		if (ref_index == conversion_blocks_count) {
+			pixfc_log("No non-SSE conversion block matching '%s'\n", conversion_blocks[index].name);
+			return -1;
+		}
 
-	pixfc_log("\n");
-	pixfc_log("\n");
-	pixfc_log("Checking PixFcPixelFormat enum and description arrays...\n");
-	if (check_formats_enum() != 0) {
-		pixfc_log("FAILED\n");
+		if ((create_pixfc_for_conversion_block(index, &pixfc, w, h) != 0)
+				|| (create_pixfc_for_conversion_block(ref_index, &pixfc_ref, w, h) != 0)) {
+			pixfc_log("Error creating struct pixfc for '%s'\n", conversion_blocks[index].name);
+			return -1;
+		}
+
+		pixfc_log("%-80s\n", conversion_blocks[index].name);
+
+		// Allocate the input & output buffers
+		if ((allocate_aligned_buffer(pixfc->source_fmt, w, h, &input) != 0)
+				|| (allocate_aligned_buffer(pixfc->dest_fmt, w, h, &output[0]) != 0)
+				|| (allocate_aligned_buffer(pixfc->dest_fmt, w, h, &output[1]) != 0)) {
+			pixfc_log("Error allocating buffers\n");
+			return -1;
+		}
+
+		// Fill input buffer and clear output buffers
+		fill_image(pixfc->source_fmt, IMG_SIZE(pixfc->source_fmt, w, h), input);
+		memset(output[0], 0, IMG_SIZE(pixfc->dest_fmt, w, h));
+		memset(output[1], 0, IMG_SIZE(pixfc->dest_fmt, w, h));
+
+		pixfc->convert(pixfc, input, output[0]);
+		pixfc_ref->convert(pixfc_ref, input, output[1]);
+
+		if (memcmp(output[0], output[1], IMG_SIZE(pixfc->dest_fmt, w, h)) != 0) {
+			pixfc_log("AVX2 conversion output differs from '%s'\n", conversion_blocks[ref_index].name);
+			result = -1;
+		}
+
+		// Free resources
+		destroy_pixfc(pixfc);
+		destroy_pixfc(pixfc_ref);
+		ALIGN_FREE(input);
+		ALIGN_FREE(output[0]);
+		ALIGN_FREE(output[1]);
+	}
+
+	return result;
+}
+
+/*
+ * Return the index of the first conversion block with the same formats and
+ * attributes as 'index' and matching the given CPU features test, or
+ * conversion_blocks_count if there is none.
+ */
+static uint32_t find_reference_block(uint32_t index, uint32_t sse) {
+	uint32_t	ref_index;
+	uint64_t	features;
+
+	for(ref_index = 0; ref_index < conversion_blocks_count; ref_index++) {
+		features = conversion_blocks[ref_index].required_cpu_features;
+		if ((conversion_blocks[ref_index].source_fmt == conversion_blocks[index].source_fmt)
+				&& (conversion_blocks[ref_index].dest_fmt == conversion_blocks[index].dest_fmt)
+				&& (conversion_blocks[ref_index].attributes == conversion_blocks[index].attributes)
+				&& (sse ? ((features != CPUID_FEATURE_NONE) && (features != CPUID_FEATURE_AVX2) && (features != CPUID_FEATURE_AVX512)
+								&& (features != CPUID_FEATURE_NEON))
+						: (features == CPUID_FEATURE_NONE)))
+			break;
+	}
+
+	return ref_index;
+}
+
+/*
+ * Convert the same image with conversion blocks 'index' and 'ref_index'
+ * and make sure the outputs are identical.
+ */
+static uint32_t compare_conversion_blocks(uint32_t index, uint32_t ref_index, uint32_t w, uint32_t h) {
+	struct PixFcSSE *	pixfc;
+	struct PixFcSSE *	pixfc_ref;
+	void *				input = NULL;
+	void *				output[2] = { NULL };
+	uint32_t			result = 0;
+
+	if ((create_pixfc_for_conversion_block(index, &pixfc, w, h) != 0)
+			|| (create_pixfc_for_conversion_block(ref_index, &pixfc_ref, w, h) != 0)) {
+		pixfc_log("Error creating struct pixfc for '%s'\n", conversion_blocks[index].name);
 		return -1;
 	}
-	pixfc_log("PASSED\n");
 
-	pixfc_log("\n");
-	pixfc_log("\n");
-	pixfc_log("Testing conversion from aligned / unaligned buffers...\n");
-	if (check_unaligned_conversions() != 0) {
-		pixfc_log("FAILED\n");
+	// Allocate the input & output buffers
+	if ((allocate_aligned_buffer(pixfc->source_fmt, w, h, &input) != 0)
+			|| (allocate_aligned_buffer(pixfc->dest_fmt, w, h, &output[0]) != 0)
+			|| (allocate_aligned_buffer(pixfc->dest_fmt, w, h, &output[1]) != 0)) {
+		pixfc_log("Error allocating buffers\n");
 		return -1;
 	}
-	pixfc_log("PASSED\n");
 
-	pixfc_log("\n");
-	pixfc_log("\n");
-	pixfc_log("Testing conversions with multiple buffer sizes\n");
-	if (check_conversion_buffer_sizes() != 0) {
+	// Fill input buffer and clear output buffers
+	fill_image(pixfc->source_fmt, IMG_SIZE(pixfc->source_fmt, w, h), input);
+	memset(output[0], 0, IMG_SIZE(pixfc->dest_fmt, w, h));
+	memset(output[1], 0, IMG_SIZE(pixfc->dest_fmt, w, h));
+
+	pixfc->convert(pixfc, input, output[0]);
+	pixfc_ref->convert(pixfc_ref, input, output[1]);
+
+	if (memcmp(output[0], output[1], IMG_SIZE(pixfc->dest_fmt, w, h)) != 0) {
+		pixfc_log("Output differs from '%s' (width %u)\n", conversion_blocks[ref_index].name, w);
+		result = -1;
+	}
+
+	// Free resources
+	destroy_pixfc(pixfc);
+	destroy_pixfc(pixfc_ref);
+	ALIGN_FREE(input);
+	ALIGN_FREE(output[0]);
+	ALIGN_FREE(output[1]);
+
+	return result;
+}
+
+/*
+ * Make sure AVX-512 conversions produce the exact same output as their
+ * SSE counterparts and, for widths which are not a multiple of the SSE
+ * block's (exercising the masked tails), as their non-SSE integer ones.
+ */
+static uint32_t check_avx512_conversions() {
+	uint32_t			w = 192, h = 18, index = 0, ref_index;
+	// 200 pixels: the last group of 24 pixels and of 6 v210 pixels are partial
+	uint32_t			tail_w = 200;
+	uint32_t			result = 0;
+
+	if (does_cpu_support(CPUID_FEATURE_AVX512) != 0) {
+		pixfc_log("CPU does not support AVX-512 - skipping\n");
+		return 0;
+	}
+
+	// Loop over all AVX-512 conversion blocks
+	for(index = 0; (index < conversion_blocks_count) && (result == 0); index++) {
+		if (conversion_blocks[index].required_cpu_features != CPUID_FEATURE_AVX512)
+			continue;
+
+		pixfc_log("%-80s\n", conversion_blocks[index].name);
+
+		ref_index = find_reference_block(index, 1);
+		if (ref_index == conversion_blocks_count) {
+			pixfc_log("No SSE conversion block matching '%s'\n", conversion_blocks[index].name);
+			return -1;
+		}
+		result = compare_conversion_blocks(index, ref_index, w, h);
+
+		if ((result == 0) && ((tail_w % conversion_blocks[index].width_multiple) == 0)) {
+			ref_index = find_reference_block(index, 0);
+			if (ref_index == conversion_blocks_count) {
+				pixfc_log("No non-SSE conversion block matching '%s'\n", conversion_blocks[index].name);
+				return -1;
+			}
+			if ((tail_w % conversion_blocks[ref_index].width_multiple) == 0)
+				result = compare_conversion_blocks(index, ref_index, tail_w, h);
+		}
+	}
+
+	return result;
+}
+
+/*
+ * Make sure NEON conversions produce the exact same output as their non-SSE
+ * integer counterparts.
+ */
+static uint32_t check_neon_conversions() {
+	uint32_t			w = 224, h = 18, index = 0, ref_index;
+	uint32_t			result = 0;
+
+	if (does_cpu_support(CPUID_FEATURE_NEON) != 0) {
+		pixfc_log("CPU does not support NEON - skipping\n");
+		return 0;
+	}
+
+	// Loop over all NEON conversion blocks
+	for(index = 0; (index < conversion_blocks_count) && (result == 0); index++) {
+		if (conversion_blocks[index].required_cpu_features != CPUID_FEATURE_NEON)
+			continue;
+
+		pixfc_log("%-80s\n", conversion_blocks[index].name);
+
+		ref_index = find_reference_block(index, 0);
+		if (ref_index == conversion_blocks_count) {
+			pixfc_log("No non-SSE conversion block matching '%s'\n", conversion_blocks[index].name);
+			return -1;
+		}
+		result = compare_conversion_blocks(index, ref_index, w, h);
+	}
+
+	return result;
+}
+
+/*
+ * Make sure SSE conversions using non-temporal stores produce the same
+ * output as those using regular stores.
+ */
+static uint32_t check_non_temporal_conversions() {
+	struct PixFcSSE *	pixfc;
+	struct PixFcSSE *	pixfc_nt;
+	void *				input = NULL;
+	void *				output[2] = { NULL };	// 1 regular & 1 non-temporal output buffer
+	uint32_t			w = 192, h = 4, index = 0;
+	uint32_t			result = 0;
+
+	// Loop over all SSE conversion blocks
+	for(index = 0; (index < conversion_blocks_count) && (result == 0); index++) {
+		if ((conversion_blocks[index].required_cpu_features == CPUID_FEATURE_NONE)
+				|| (conversion_blocks[index].required_cpu_features == CPUID_FEATURE_AVX2)
+				|| (conversion_blocks[index].required_cpu_features == CPUID_FEATURE_AVX512)
+				|| (conversion_blocks[index].required_cpu_features == CPUID_FEATURE_NEON))
+			continue;
+
+		if (create_pixfc_for_conversion_block(index, &pixfc, w, h) != 0) {
+			pixfc_log("Unable to test conversion block '%s'\n", conversion_blocks[index].name);
+			continue;
+		}
+
+		if (create_pixfc(&pixfc_nt, pixfc->source_fmt, pixfc->dest_fmt, w, h, pixfc->source_row_bytes,
+				pixfc->dest_row_bytes, synthesize_pixfc_flags(index) | PixFcFlag_NonTemporalStores) != PixFc_OK) {
+			pixfc_log("Error creating non-temporal struct pixfc for '%s'\n", conversion_blocks[index].name);
+			return -1;
+		}
+
+		pixfc_log("%-80s\n", conversion_blocks[index].name);
+
+		if ((pixfc_nt->convert != pixfc->convert) || ! (pixfc_nt->flags & PixFcFlag_NonTemporalStores)) {
+			pixfc_log("Wrong conversion function or flags returned\n");
+			result = -1;
+		}
+
+		// Allocate the input & output buffers
+		if ((allocate_aligned_buffer(pixfc->source_fmt, w, h, &input) != 0)
+				|| (allocate_aligned_buffer(pixfc->dest_fmt, w, h, &output[0]) != 0)
+				|| (allocate_aligned_buffer(pixfc->dest_fmt, w, h, &output[1]) != 0)) {
+			pixfc_log("Error allocating buffers\n");
+			return -1;
+		}
+
+		// Fill input buffer and clear output buffers (some formats have padding bytes)
+		fill_image(pixfc->source_fmt, IMG_SIZE(pixfc->source_fmt, w, h), input);
+		memset(output[0], 0, IMG_SIZE(pixfc->dest_fmt, w, h));
+		memset(output[1], 0, IMG_SIZE(pixfc->dest_fmt, w, h));
+
+		pixfc->convert(pixfc, input, output[0]);
+		pixfc_nt->convert(pixfc_nt, input, output[1]);
+
+		if (memcmp(output[0], output[1], IMG_SIZE(pixfc->dest_fmt, w, h)) != 0) {
+			pixfc_log("Non-temporal conversion output differs for '%s'\n", conversion_blocks[index].name);
+			result = -1;
+		}
+
+		// Free resources
+		destroy_pixfc(pixfc);
+		destroy_pixfc(pixfc_nt);
+		ALIGN_FREE(input);
+		ALIGN_FREE(output[0]);
+		ALIGN_FREE(output[1]);
+	}
+
+	return result;
+}
+
+/*
+ * Make sure conversions prefetching source lines produce the same output
+ * as those that do not.
+ */
+static uint32_t check_prefetch_conversions() {
+	struct PixFcSSE *	pixfc;
+	void *				input = NULL;
+	void *				output[2] = { NULL };	// 1 output buffer without & 1 with prefetching
+	uint32_t			w = 192, h = 8, index = 0;
+	uint32_t			result = 0;
+
+	// Loop over all conversion blocks
+	for(index = 0; (index < conversion_blocks_count) && (result == 0); index++) {
+		if (create_pixfc_for_conversion_block(index, &pixfc, w, h) != 0) {
+			pixfc_log("Unable to test conversion block '%s'\n", conversion_blocks[index].name);
+			continue;
+		}
+
+		pixfc_log("%-80s\n", conversion_blocks[index].name);
+
+		// Allocate the input & output buffers
+		if ((allocate_aligned_buffer(pixfc->source_fmt, w, h, &input) != 0)
+				|| (allocate_aligned_buffer(pixfc->dest_fmt, w, h, &output[0]) != 0)
+				|| (allocate_aligned_buffer(pixfc->dest_fmt, w, h, &output[1]) != 0)) {
+			pixfc_log("Error allocating buffers\n");
+			return -1;
+		}
+
+		// Fill input buffer and clear output buffers (some formats have padding bytes)
+		fill_image(pixfc->source_fmt, IMG_SIZE(pixfc->source_fmt, w, h), input);
+		memset(output[0], 0, IMG_SIZE(pixfc->dest_fmt, w, h));
+		memset(output[1], 0, IMG_SIZE(pixfc->dest_fmt, w, h));
+
+		pixfc->convert(pixfc, input, output[0]);
+
+		// Use a distance which makes the last lines prefetch past the end of the buffer
+		if ((set_pixfc_prefetch_distance(pixfc, 3) != PixFc_OK) || (pixfc->prefetch_distance != 3)) {
+			pixfc_log("Error setting the prefetch distance\n");
+			result = -1;
+		}
+		pixfc->convert(pixfc, input, output[1]);
+
+		if (memcmp(output[0], output[1], IMG_SIZE(pixfc->dest_fmt, w, h)) != 0) {
+			pixfc_log("Conversion output with prefetching differs for '%s'\n", conversion_blocks[index].name);
+			result = -1;
+		}
+
+		// Free resources
+		destroy_pixfc(pixfc);
+		ALIGN_FREE(input);
+		ALIGN_FREE(output[0]);
+		ALIGN_FREE(output[1]);
+	}
+
+	return result;
+}
+
+/*
+ * Make sure conversions to ARGB & BGRA set the alpha channel to the value
+ * given to set_pixfc_alpha(), except conversions between ARGB & BGRA which
+ * must keep the source alpha values.
+ */
+static uint32_t check_alpha_conversions() {
+	struct PixFcSSE *	pixfc;
+	void *				input = NULL;
+	void *				output = NULL;
+	uint32_t			w = 192, h = 8, index = 0;
+	uint32_t			pixel;
+	uint8_t				alpha = 0xA5;
+	uint8_t				expected;
+	uint32_t			src_alpha_offset;
+	uint32_t			dst_alpha_offset;
+	uint32_t			result = 0;
+
+	// Loop over all conversion blocks
+	for(index = 0; (index < conversion_blocks_count) && (result == 0); index++) {
+		if ((conversion_blocks[index].dest_fmt != PixFcARGB) && (conversion_blocks[index].dest_fmt != PixFcBGRA))
+			continue;
+
+		if (create_pixfc_for_conversion_block(index, &pixfc, w, h) != 0) {
+			pixfc_log("Unable to test conversion block '%s'\n", conversion_blocks[index].name);
+			continue;
+		}
+
+		pixfc_log("%-80s\n", conversion_blocks[index].name);
+
+		// Allocate the input & output buffers
+		if ((allocate_aligned_buffer(pixfc->source_fmt, w, h, &input) != 0)
+				|| (allocate_aligned_buffer(pixfc->dest_fmt, w, h, &output) != 0)) {
+			pixfc_log("Error allocating buffers\n");
+			return -1;
+		}
+
+		fill_image(pixfc->source_fmt, IMG_SIZE(pixfc->source_fmt, w, h), input);
+		memset(output, 0, IMG_SIZE(pixfc->dest_fmt, w, h));
+
+		if ((set_pixfc_alpha(pixfc, alpha) != PixFc_OK) || (pixfc->alpha != alpha)) {
+			pixfc_log("Error setting the alpha value\n");
+			result = -1;
+		}
+		pixfc->convert(pixfc, input, output);
+
+		src_alpha_offset = (pixfc->source_fmt == PixFcARGB) ? 0 : 3;
+		dst_alpha_offset = (pixfc->dest_fmt == PixFcARGB) ? 0 : 3;
+		for(pixel = 0; pixel < w * h / (get_downscale_factor(pixfc->flags) * get_downscale_factor(pixfc->flags)); pixel++) {
+			if ((pixfc->source_fmt == PixFcARGB) || (pixfc->source_fmt == PixFcBGRA))
+				expected = ((uint8_t *) input)[pixel * 4 + src_alpha_offset];
+			else
+				expected = alpha;
+
+			if (((uint8_t *) output)[pixel * 4 + dst_alpha_offset] != expected) {
+				pixfc_log("Wrong alpha value for pixel %u with '%s'\n", pixel, conversion_blocks[index].name);
+				result = -1;
+				break;
+			}
+		}
+
+		// Free resources
+		destroy_pixfc(pixfc);
+		ALIGN_FREE(input);
+		ALIGN_FREE(output);
+	}
+
+	return result;
+}
+
+/*
+ * Make sure converting an image in bands with convert_lines() produces
+ * the same output as converting it in one go.
+ */
+static uint32_t check_line_range_conversions() {
+	struct PixFcSSE *	pixfc;
+	void *				input = NULL;
+	void *				output[2] = { NULL };	// 1 whole-image & 1 banded output buffer
+	uint32_t			w = 192, h = 18, index = 0;
+	uint32_t			bands[] = { 0, 4, 10, 12, 18 };	// first line of each band
+	uint32_t			band;
+	uint32_t			planar;
+	uint32_t			result = 0;
+
+	// Loop over all conversion blocks
+	for(index = 0; (index < conversion_blocks_count) && (result == 0); index++) {
+		if (create_pixfc_for_conversion_block(index, &pixfc, w, h) != 0) {
+			pixfc_log("Unable to test conversion block '%s'\n", conversion_blocks[index].name);
+			continue;
+		}
+
+		pixfc_log("%-80s\n", conversion_blocks[index].name);
+		planar = pixfmt_descriptions[pixfc->source_fmt].is_planar || pixfmt_descriptions[pixfc->dest_fmt].is_planar;
+
+		// Allocate the input & output buffers
+		if ((allocate_aligned_buffer(pixfc->source_fmt, w, h, &input) != 0)
+				|| (allocate_aligned_buffer(pixfc->dest_fmt, w, h, &output[0]) != 0)
+				|| (allocate_aligned_buffer(pixfc->dest_fmt, w, h, &output[1]) != 0)) {
+			pixfc_log("Error allocating buffers\n");
+			return -1;
+		}
+
+		// Fill input buffer and clear output buffers (some formats have padding bytes)
+		fill_image(pixfc->source_fmt, IMG_SIZE(pixfc->source_fmt, w, h), input);
+		memset(output[0], 0, IMG_SIZE(pixfc->dest_fmt, w, h));
+		memset(output[1], 0, IMG_SIZE(pixfc->dest_fmt, w, h));
+
+		pixfc->convert(pixfc, input, output[0]);
+
+		// Convert bands out of order
+		for(band = sizeof(bands) / sizeof(bands[0]) - 1; band > 0; band--) {
+			if (convert_lines(pixfc, input, output[1], bands[band - 1], bands[band] - bands[band - 1]) != (planar ? PixFc_UnsupportedConversionError : PixFc_OK)) {
+				pixfc_log("Unexpected convert_lines() return code for lines %u - %u\n", bands[band - 1], bands[band]);
+				result = -1;
+			}
+		}
+
+		if (! planar && (memcmp(output[0], output[1], IMG_SIZE(pixfc->dest_fmt, w, h)) != 0)) {
+			pixfc_log("Banded conversion output differs for '%s'\n", conversion_blocks[index].name);
+			result = -1;
+		}
+
+		// Lines outside the image must be rejected
+		if (! planar && ((convert_lines(pixfc, input, output[1], h - 2, 4) != PixFc_InvalidLineRange)
+				|| (convert_lines(pixfc, input, output[1], 0, 0) != PixFc_InvalidLineRange))) {
+			pixfc_log("Invalid range of lines accepted for '%s'\n", conversion_blocks[index].name);
+			result = -1;
+		}
+
+		// Free resources
+		destroy_pixfc(pixfc);
+		ALIGN_FREE(input);
+		ALIGN_FREE(output[0]);
+		ALIGN_FREE(output[1]);
+	}
+
+	return result;
+}
+
+/*
+ * Make sure SSE downscaling conversions produce the same output as their
+ * non-SSE integer counterparts (within a small margin as the SSE and non-SSE
+ * YUV to RGB equations round differently), for both factors they support.
+ */
+#define MAX_DOWNSCALE_DIFF		5
+static uint32_t check_downscale_conversions() {
+	struct PixFcSSE *	pixfc;
+	struct PixFcSSE *	pixfc_ref;
+	void *				input = NULL;
+	void *				output[2] = { NULL };	// 1 SSE & 1 non-SSE output buffer
+	uint32_t			factors[] = { 2, 4 };
+	uint32_t			w = 192, h = 8, index = 0, ref_index, f, byte;
+	uint32_t			attributes;
+	PixFcFlag			flags;
+	uint32_t			result = 0;
+
+	// Loop over all SSE downscaling conversion blocks
+	for(index = 0; (index < conversion_blocks_count) && (result == 0); index++) {
+		if (! (conversion_blocks[index].attributes & DOWNSCALE_CONVERSION)
+				|| (conversion_blocks[index].required_cpu_features == CPUID_FEATURE_NONE))
+			continue;
+
+		if (does_cpu_support(conversion_blocks[index].required_cpu_features) != 0) {
+			pixfc_log("Unable to test conversion block '%s'\n", conversion_blocks[index].name);
+			continue;
+		}
+
+		// Find the matching non-SSE integer conversion block
+		attributes = (conversion_blocks[index].attributes & (BT601_CONVERSION | BT709_CONVERSION)) | DOWNSCALE_NX;
+		for(ref_index = 0; ref_index < conversion_blocks_count; ref_index++) {
+			if ((conversion_blocks[ref_index].source_fmt == conversion_blocks[index].source_fmt)
+					&& (conversion_blocks[ref_index].dest_fmt == conversion_blocks[index].dest_fmt)
+					&& (conversion_blocks[ref_index].required_cpu_features == CPUID_FEATURE_NONE)
+					&& (conversion_blocks[ref_index].attributes == attributes))
+				break;
+		}
+		if (ref_index == conversion_blocks_count) {
+			pixfc_log("No non-SSE conversion block matching '%s'\n", conversion_blocks[index].name);
+			return -1;
+		}
+
+		pixfc_log("%-80s\n", conversion_blocks[index].name);
+
+		// Allocate the input & output buffers
+		if ((allocate_aligned_buffer(conversion_blocks[index].source_fmt, w, h, &input) != 0)
+				|| (allocate_aligned_buffer(conversion_blocks[index].dest_fmt, w, h, &output[0]) != 0)
+				|| (allocate_aligned_buffer(conversion_blocks[index].dest_fmt, w, h, &output[1]) != 0)) {
+			pixfc_log("Error allocating buffers\n");
+			return -1;
+		}
+		fill_image(conversion_blocks[index].source_fmt, IMG_SIZE(conversion_blocks[index].source_fmt, w, h), input);
+
+		for(f = 0; (f < sizeof(factors) / sizeof(factors[0])) && (result == 0); f++) {
+			flags = synthesize_pixfc_flags(index) & ~PixFcFlag_DownscaleMask;
+			if ((create_pixfc(&pixfc, conversion_blocks[index].source_fmt, conversion_blocks[index].dest_fmt, w, h,
+						ROW_SIZE(conversion_blocks[index].source_fmt, w), ROW_SIZE(conversion_blocks[index].dest_fmt, w / factors[f]),
+						flags | PIXFC_DOWNSCALE_FLAG(factors[f])) != PixFc_OK)
+					|| (create_pixfc(&pixfc_ref, conversion_blocks[index].source_fmt, conversion_blocks[index].dest_fmt, w, h,
+						ROW_SIZE(conversion_blocks[index].source_fmt, w), ROW_SIZE(conversion_blocks[index].dest_fmt, w / factors[f]),
+						(synthesize_pixfc_flags(ref_index) & ~PixFcFlag_DownscaleMask) | PIXFC_DOWNSCALE_FLAG(factors[f])) != PixFc_OK)) {
+				pixfc_log("Error creating struct pixfc for %ux downscaling\n", factors[f]);
+				return -1;
+			}
+
+			if ((pixfc->convert != conversion_blocks[index].convert_fn) || (pixfc_ref->convert != conversion_blocks[ref_index].convert_fn)) {
+				pixfc_log("Wrong conversion function returned for %ux downscaling\n", factors[f]);
+				result = -1;
+			}
+
+			memset(output[0], 0, IMG_SIZE(pixfc->dest_fmt, w, h));
+			memset(output[1], 0, IMG_SIZE(pixfc->dest_fmt, w, h));
+			pixfc->convert(pixfc, input, output[0]);
+			pixfc_ref->convert(pixfc_ref, input, output[1]);
+
+			for(byte = 0; byte < IMG_SIZE(pixfc->dest_fmt, w / factors[f], h / factors[f]); byte++) {
+				if (abs(((uint8_t *) output[0])[byte] - ((uint8_t *) output[1])[byte]) > MAX_DOWNSCALE_DIFF) {
+					pixfc_log("%ux downscaled output differs from '%s' at byte %u (%u - %u)\n", factors[f],
+							conversion_blocks[ref_index].name, byte, ((uint8_t *) output[0])[byte], ((uint8_t *) output[1])[byte]);
+					result = -1;
+					break;
+				}
+			}
+
+			destroy_pixfc(pixfc);
+			destroy_pixfc(pixfc_ref);
+		}
+
+		// Free resources
+		ALIGN_FREE(input);
+		ALIGN_FREE(output[0]);
+		ALIGN_FREE(output[1]);
+	}
+
+	return result;
+}
+
+/*
+ * Make sure converting a window of a larger image with create_pixfc_roi()
+ * produces the same output as converting a copy of the window, both for a
+ * window starting and ending on whole pixel groups (converted in place) and
+ * for one that does not (converted through a staging buffer).
+ */
+static uint32_t check_roi_conversions() {
+	struct PixFcSSE *	pixfc;
+	struct PixFcSSE *	pixfc_roi;
+	void *				frame = NULL;
+	void *				input = NULL;
+	void *				output[2] = { NULL };	// 1 reference & 1 ROI output buffer
+	uint32_t			frame_w = 288, frame_h = 12;
+	uint32_t			w = 192, h = 8, x = 48, y = 2;	// Copy of the window & in-place window
+	uint32_t			odd_x = 49, odd_w = 191;		// Widened window (48 - 240)
+	uint32_t			src_fmt, dest_fmt;
+	uint32_t			index, line, ret;
+	uint32_t			result = 0;
+
+	// Loop over all conversion blocks
+	for(index = 0; (index < conversion_blocks_count) && (result == 0); index++) {
+		// Downscaling is checked elsewhere
+		if (conversion_blocks[index].attributes & DOWNSCALE_CONVERSION)
+			continue;
+
+		if (create_pixfc_for_conversion_block(index, &pixfc, w, h) != 0) {
+			pixfc_log("Unable to test conversion block '%s'\n", conversion_blocks[index].name);
+			continue;
+		}
+
+		pixfc_log("%-80s\n", conversion_blocks[index].name);
+		src_fmt = pixfc->source_fmt;
+		dest_fmt = pixfc->dest_fmt;
+
+		// Windows of planar images can not be converted
+		if (pixfmt_descriptions[src_fmt].is_planar) {
+			if (create_pixfc_roi(&pixfc_roi, src_fmt, dest_fmt, frame_w, frame_h, ROW_SIZE(src_fmt, frame_w),
+					x, y, w, h, ROW_SIZE(dest_fmt, w), synthesize_pixfc_flags(index)) != PixFc_InvalidRegionOfInterest) {
+				pixfc_log("Window of planar image accepted for '%s'\n", conversion_blocks[index].name);
+				result = -1;
+			}
+			destroy_pixfc(pixfc);
+			continue;
+		}
+
+		// Allocate the buffers, fill the frame and copy the window
+		if ((allocate_aligned_buffer(src_fmt, frame_w, frame_h, &frame) != 0)
+				|| (allocate_aligned_buffer(src_fmt, w, h, &input) != 0)
+				|| (allocate_aligned_buffer(dest_fmt, w, h, &output[0]) != 0)
+				|| (allocate_aligned_buffer(dest_fmt, w, h, &output[1]) != 0)) {
+			pixfc_log("Error allocating buffers\n");
+			return -1;
+		}
+		fill_image(src_fmt, IMG_SIZE(src_fmt, frame_w, frame_h), frame);
+		for(line = 0; line < h; line++)
+			memcpy((uint8_t *) input + line * ROW_SIZE(src_fmt, w),
+					(uint8_t *) frame + (y + line) * ROW_SIZE(src_fmt, frame_w) + x * pixfmt_descriptions[src_fmt].bytes_per_pix_num / pixfmt_descriptions[src_fmt].bytes_per_pix_denom,
+					ROW_SIZE(src_fmt, w));
+
+		memset(output[0], 0, IMG_SIZE(dest_fmt, w, h));
+		pixfc->convert(pixfc, input, output[0]);
+
+		// Convert the window in place
+		if (create_pixfc_roi(&pixfc_roi, src_fmt, dest_fmt, frame_w, frame_h, ROW_SIZE(src_fmt, frame_w),
+				x, y, w, h, ROW_SIZE(dest_fmt, w), synthesize_pixfc_flags(index)) != PixFc_OK) {
+			pixfc_log("Error creating struct pixfc for window of '%s'\n", conversion_blocks[index].name);
+			return -1;
+		}
+
+		memset(output[1], 0, IMG_SIZE(dest_fmt, w, h));
+		pixfc_roi->convert(pixfc_roi, frame, output[1]);
+		destroy_pixfc(pixfc_roi);
+
+		if (memcmp(output[0], output[1], IMG_SIZE(dest_fmt, w, h)) != 0) {
+			pixfc_log("Window conversion output differs for '%s'\n", conversion_blocks[index].name);
+			result = -1;
+		}
+
+		// Convert a window that does not start and end on whole pixel groups.
+		// The pixels left of it can only be dropped if the destination format
+		// has no pixel groups.
+		ret = create_pixfc_roi(&pixfc_roi, src_fmt, dest_fmt, frame_w, frame_h, ROW_SIZE(src_fmt, frame_w),
+				odd_x, y, odd_w, h, ROW_SIZE(dest_fmt, w), synthesize_pixfc_flags(index));
+		if ((pixfmt_descriptions[src_fmt].pixel_group_width == 1) || (pixfmt_descriptions[dest_fmt].pixel_group_width != 1)) {
+			if ((pixfmt_descriptions[src_fmt].pixel_group_width != 1) && (ret != PixFc_InvalidRegionOfInterest)) {
+				pixfc_log("Window not made of whole pixel groups accepted for '%s'\n", conversion_blocks[index].name);
+				result = -1;
+			}
+			if (ret == PixFc_OK)
+				destroy_pixfc(pixfc_roi);
+		} else if (ret != PixFc_OK) {
+			pixfc_log("Error (%d) creating struct pixfc for widened window of '%s'\n", ret, conversion_blocks[index].name);
+			result = -1;
+		} else {
+			memset(output[1], 0, IMG_SIZE(dest_fmt, w, h));
+			pixfc_roi->convert(pixfc_roi, frame, output[1]);
+			destroy_pixfc(pixfc_roi);
+
+			// The widened window is the one copied earlier
+			for(line = 0; line < h; line++) {
+				if (memcmp((uint8_t *) output[0] + line * ROW_SIZE(dest_fmt, w) + (odd_x - x) * pixfmt_descriptions[dest_fmt].bytes_per_pix_num,
+						(uint8_t *) output[1] + line * ROW_SIZE(dest_fmt, w), odd_w * pixfmt_descriptions[dest_fmt].bytes_per_pix_num) != 0) {
+					pixfc_log("Widened window conversion output differs for '%s' at line %u\n", conversion_blocks[index].name, line);
+					result = -1;
+					break;
+				}
+			}
+		}
+
+		// Windows outside the image must be rejected
+		if (create_pixfc_roi(&pixfc_roi, src_fmt, dest_fmt, frame_w, frame_h, ROW_SIZE(src_fmt, frame_w),
+				frame_w - w + 2, y, w, h, ROW_SIZE(dest_fmt, w), synthesize_pixfc_flags(index)) != PixFc_InvalidRegionOfInterest) {
+			pixfc_log("Window outside the image accepted for '%s'\n", conversion_blocks[index].name);
+			result = -1;
+		}
+
+		// Free resources
+		destroy_pixfc(pixfc);
+		ALIGN_FREE(frame);
+		ALIGN_FREE(input);
+		ALIGN_FREE(output[0]);
+		ALIGN_FREE(output[1]);
+	}
+
+	return result;
+}
+
+/*
+ * Make sure converting a batch of images with convert_batch(), with single-
+ * and multithreaded conversions, produces the same output as converting
+ * each image with convert().
+ */
+#define BATCH_IMAGE_COUNT		5
+static uint32_t check_batch_conversions() {
+	struct PixFcSSE *	pixfc;
+	struct PixFcSSE *	pixfc_mt;
+	void *				input[BATCH_IMAGE_COUNT] = { NULL };
+	void *				output[3][BATCH_IMAGE_COUNT] = { { NULL } };	// convert(), convert_batch() & multithreaded convert_batch() outputs
+	uint32_t			w = 192, h = 18, index = 0, image, conv;
+	uint32_t			result = 0;
+
+	// Loop over all conversion blocks
+	for(index = 0; (index < conversion_blocks_count) && (result == 0); index++) {
+		if (create_pixfc_for_conversion_block(index, &pixfc, w, h) != 0) {
+			pixfc_log("Unable to test conversion block '%s'\n", conversion_blocks[index].name);
+			continue;
+		}
+
+		if (create_pixfc_mt(&pixfc_mt, pixfc->source_fmt, pixfc->dest_fmt, w, h, pixfc->source_row_bytes,
+				pixfc->dest_row_bytes, synthesize_pixfc_flags(index), 3) != PixFc_OK) {
+			pixfc_log("Error creating multithreaded struct pixfc for '%s'\n", conversion_blocks[index].name);
+			return -1;
+		}
+
+		pixfc_log("%-80s%u thread(s)\n", conversion_blocks[index].name, pixfc_mt->thread_count);
+
+		// Allocate the input & output buffers. Make each input image
+		// slightly different from the others.
+		for(image = 0; image < BATCH_IMAGE_COUNT; image++) {
+			if (allocate_aligned_buffer(pixfc->source_fmt, w, h, &input[image]) != 0) {
+				pixfc_log("Error allocating buffers\n");
+				return -1;
+			}
+			fill_image(pixfc->source_fmt, IMG_SIZE(pixfc->source_fmt, w, h), input[image]);
+			((uint8_t *) input[image])[0] += image;
+
+			for(conv = 0; conv < 3; conv++) {
+				if (allocate_aligned_buffer(pixfc->dest_fmt, w, h, &output[conv][image]) != 0) {
+					pixfc_log("Error allocating buffers\n");
+					return -1;
+				}
+				memset(output[conv][image], 0, IMG_SIZE(pixfc->dest_fmt, w, h));
+			}
+
+			pixfc->convert(pixfc, input[image], output[0][image]);
+		}
+
+		if ((convert_batch(pixfc, input, output[1], BATCH_IMAGE_COUNT) != PixFc_OK)
+				|| (convert_batch(pixfc_mt, input, output[2], BATCH_IMAGE_COUNT) != PixFc_OK)) {
+			pixfc_log("Error converting batch for '%s'\n", conversion_blocks[index].name);
+			result = -1;
+		}
+
+		for(image = 0; image < BATCH_IMAGE_COUNT; image++) {
+			if ((memcmp(output[0][image], output[1][image], IMG_SIZE(pixfc->dest_fmt, w, h)) != 0)
+					|| (memcmp(output[0][image], output[2][image], IMG_SIZE(pixfc->dest_fmt, w, h)) != 0)) {
+				pixfc_log("Batch conversion output differs for image %u of '%s'\n", image, conversion_blocks[index].name);
+				result = -1;
+			}
+		}
+
+		// Free resources
+		destroy_pixfc(pixfc);
+		destroy_pixfc(pixfc_mt);
+		for(image = 0; image < BATCH_IMAGE_COUNT; image++) {
+			ALIGN_FREE(input[image]);
+			for(conv = 0; conv < 3; conv++)
+				ALIGN_FREE(output[conv][image]);
+		}
+	}
+
+	return result;
+}
+
+/*
+ * Return the conversion block used by the given struct PixFcSSE
+ */
+static const struct ConversionBlock *	find_conversion_block(const struct PixFcSSE *pixfc) {
+	uint32_t	index;
+
+	for(index = 0; index < conversion_blocks_count; index++)
+		if ((conversion_blocks[index].convert_fn == pixfc->convert)
+				&& (conversion_blocks[index].source_fmt == pixfc->source_fmt)
+				&& (conversion_blocks[index].dest_fmt == pixfc->dest_fmt))
+			return &conversion_blocks[index];
+
+	return NULL;
+}
+
+#define AUTOTUNE_TEST_CACHE		"pixfc-sse-autotune-test"
+static uint32_t check_autotuned_conversions() {
+	struct {
+		PixFcPixelFormat	source_fmt;
+		PixFcPixelFormat	dest_fmt;
+		uint32_t			flags;
+	}								conversions[] = {
+		{ PixFcYUYV, PixFcARGB, PixFcFlag_Default },
+		{ PixFcUYVY, PixFcRGB24, PixFcFlag_BT709Conversion | PixFcFlag_NNbResamplingOnly },
+		{ PixFcBGRA, PixFcYUV420P, PixFcFlag_BT601Conversion },
+		{ PixFcV210, PixFcYUYV, PixFcFlag_Default },
+	};
+	struct PixFcSSE *				pixfc;
+	const struct ConversionBlock *	tuned_block;
+	const struct ConversionBlock *	nonsse_block;
+	char							line[512];
+	FILE *							file;
+	uint32_t						w = 192, h = 18, index, src_row_bytes, dst_row_bytes;
+
+	SETENV("PIXFC_AUTOTUNE_CACHE", AUTOTUNE_TEST_CACHE);
+
+	for(index = 0; index < sizeof(conversions) / sizeof(conversions[0]); index++) {
+		remove(AUTOTUNE_TEST_CACHE);
+		src_row_bytes = ROW_SIZE(conversions[index].source_fmt, w);
+		dst_row_bytes = ROW_SIZE(conversions[index].dest_fmt, w);
+
+		// Find the non-SSE conversion block, which the autotuner should never pick
+		if (create_pixfc(&pixfc, conversions[index].source_fmt, conversions[index].dest_fmt, w, h,
+				src_row_bytes, dst_row_bytes, conversions[index].flags | PixFcFlag_NoSSE) != PixFc_OK) {
+			pixfc_log("Error creating non-SSE struct pixfc\n");
+			return -1;
+		}
+		nonsse_block = find_conversion_block(pixfc);
+		destroy_pixfc(pixfc);
+
+		// Autotune the conversion
+		if (create_pixfc(&pixfc, conversions[index].source_fmt, conversions[index].dest_fmt, w, h,
+				src_row_bytes, dst_row_bytes, conversions[index].flags | PixFcFlag_Autotune) != PixFc_OK) {
+			pixfc_log("Error creating autotuned struct pixfc\n");
+			return -1;
+		}
+		tuned_block = find_conversion_block(pixfc);
+		destroy_pixfc(pixfc);
+
+		if (! nonsse_block || ! tuned_block || (tuned_block == nonsse_block)) {
+			pixfc_log("Unexpected autotuned conversion block '%s'\n", tuned_block ? tuned_block->name : "(none)");
+			return -1;
+		}
+		pixfc_log("%-80s\n", tuned_block->name);
+
+		// The result must have been saved to the cache
+		file = fopen(AUTOTUNE_TEST_CACHE, "r");
+		if (! file || ! fgets(line, sizeof(line), file) || (strlen(line) <= strlen(tuned_block->name) + 1)
+				|| (strncmp(line + strlen(line) - strlen(tuned_block->name) - 1, tuned_block->name, strlen(tuned_block->name)) != 0)) {
+			pixfc_log("Autotuned conversion block not saved to cache\n");
+			if (file)
+				fclose(file);
+			return -1;
+		}
+		fclose(file);
+
+		// Record the non-SSE conversion block as the fastest one in the cache
+		// and make sure create_pixfc() uses it.
+		file = fopen(AUTOTUNE_TEST_CACHE, "a");
+		if (! file) {
+			pixfc_log("Error opening autotuning cache\n");
+			return -1;
+		}
+		line[strlen(line) - strlen(tuned_block->name) - 1] = '\0';
+		fprintf(file, "%s%s\n", line, nonsse_block->name);
+		fclose(file);
+
+		if (create_pixfc(&pixfc, conversions[index].source_fmt, conversions[index].dest_fmt, w, h,
+				src_row_bytes, dst_row_bytes, conversions[index].flags | PixFcFlag_Autotune) != PixFc_OK) {
+			pixfc_log("Error creating autotuned struct pixfc\n");
+			return -1;
+		}
+		tuned_block = find_conversion_block(pixfc);
+		destroy_pixfc(pixfc);
+
+		if (tuned_block != nonsse_block) {
+			pixfc_log("Autotuning cache not used\n");
+			return -1;
+		}
+	}
+
+	remove(AUTOTUNE_TEST_CACHE);
+
+	return 0;
+}
+
+/*
+ * Here we run a few tests to make sure things are sound internally
+ */
+int 				main(int argc, char **argv) {
+
+#ifdef __INTEL_CPU__
+	// SSE2 / SSSE3 and SSE41 are required to run this app on Intel CPUs.
+	if (does_cpu_support(CPUID_FEATURE_SSE41 | CPUID_FEATURE_SSSE3 | CPUID_FEATURE_SSE2) != 0) {
+		pixfc_log("CPU does not support required SSE features - exiting\n");
+		return 1;
+	}
+#endif
+
+	pixfc_log("\n");
+	pixfc_log("\t\tU N I T   T E S T I N G\n");
+
+	pixfc_log("\n");
+	pixfc_log("Running internal checks ...\n");
+	if (check_conversion_enumeration() != 0) {
+		pixfc_log("FAILED\n");
+		return -1;
+	}
+	if (check_conversion_block_index() != 0) {
+		pixfc_log("FAILED\n");
+		return -1;
+	}
+	pixfc_log("PASSED\n");
+
+
+	pixfc_log("\n");
+	pixfc_log("\n");
+	pixfc_log("Running PixFcFlags checks ...\n");
+	if (check_pixfc_flags()!= 0) {
+		pixfc_log("FAILED\n");
+		return -1;
+	} else
+		pixfc_log("PASSED\n");
+
+
+	pixfc_log("\n");
+	pixfc_log("\n");
+	pixfc_log("Checking PixFcPixelFormat enum and description arrays...\n");
+	if (check_formats_enum() != 0) {
+		pixfc_log("FAILED\n");
+		return -1;
+	}
+	pixfc_log("PASSED\n");
+
+	pixfc_log("\n");
+	pixfc_log("\n");
+	pixfc_log("Testing conversion from aligned / unaligned buffers...\n");
+	if (check_unaligned_conversions() != 0) {
+		pixfc_log("FAILED\n");
+		return -1;
+	}
+	pixfc_log("PASSED\n");
+
+	pixfc_log("\n");
+	pixfc_log("\n");
+	pixfc_log("Testing conversions with multiple buffer sizes\n");
+	if (check_conversion_buffer_sizes() != 0) {
+		pixfc_log("FAILED\n");
+		return -1;
+	}
+	pixfc_log("PASSED\n");
+
+	pixfc_log("\n");
+	pixfc_log("\n");
+	pixfc_log("Testing conversions with padded row bytes\n");
+	if (check_row_bytes_conversions() != 0) {
+		pixfc_log("FAILED\n");
+		return -1;
+	}
+	pixfc_log("PASSED\n");
+
+	pixfc_log("\n");
+	pixfc_log("\n");
+	pixfc_log("Testing multithreaded conversions\n");
+	if (check_multithreaded_conversions() != 0) {
+		pixfc_log("FAILED\n");
+		return -1;
+	}
+	pixfc_log("PASSED\n");
+
+	pixfc_log("\n");
+	pixfc_log("\n");
+	pixfc_log("Testing line range conversions\n");
+	if (check_line_range_conversions() != 0) {
+		pixfc_log("FAILED\n");
+		return -1;
+	}
+	pixfc_log("PASSED\n");
+
+	pixfc_log("\n");
+	pixfc_log("\n");
+	pixfc_log("Testing non-temporal store conversions\n");
+	if (check_non_temporal_conversions() != 0) {
+		pixfc_log("FAILED\n");
+		return -1;
+	}
+	pixfc_log("PASSED\n");
+
+	pixfc_log("\n");
+	pixfc_log("\n");
+	pixfc_log("Testing conversions with prefetching\n");
+	if (check_prefetch_conversions() != 0) {
+		pixfc_log("FAILED\n");
+		return -1;
+	}
+	pixfc_log("PASSED\n");
+
+	pixfc_log("\n");
+	pixfc_log("\n");
+	pixfc_log("Testing alpha values of conversions to ARGB & BGRA\n");
+	if (check_alpha_conversions() != 0) {
+		pixfc_log("FAILED\n");
+		return -1;
+	}
+	pixfc_log("PASSED\n");
+
+	pixfc_log("\n");
+	pixfc_log("\n");
+	pixfc_log("Comparing AVX2 & non-SSE conversions\n");
+	if (check_avx2_conversions() != 0) {
+		pixfc_log("FAILED\n");
+		return -1;
+	}
+	pixfc_log("PASSED\n");
+
+	pixfc_log("\n");
+	pixfc_log("\n");
+	pixfc_log("Comparing AVX-512, SSE & non-SSE conversions\n");
+	if (check_avx512_conversions() != 0) {
+		pixfc_log("FAILED\n");
+		return -1;
+	}
+	pixfc_log("PASSED\n");
+
+	pixfc_log("\n");
+	pixfc_log("\n");
+	pixfc_log("Comparing NEON & non-SSE conversions\n");
+	if (check_neon_conversions() != 0) {
+		pixfc_log("FAILED\n");
+		return -1;
+	}
+	pixfc_log("PASSED\n");
+
+	pixfc_log("\n");
+	pixfc_log("\n");
+	pixfc_log("Comparing SSE & non-SSE downscaling conversions\n");
+	if (check_downscale_conversions() != 0) {
+		pixfc_log("FAILED\n");
+		return -1;
+	}
+	pixfc_log("PASSED\n");
+
+	pixfc_log("\n");
+	pixfc_log("\n");
+	pixfc_log("Testing conversions of a window of the source image\n");
+	if (check_roi_conversions() != 0) {
+		pixfc_log("FAILED\n");
+		return -1;
+	}
+	pixfc_log("PASSED\n");
+
+	pixfc_log("\n");
+	pixfc_log("\n");
+	pixfc_log("Testing batch conversions\n");
+	if (check_batch_conversions() != 0) {
+		pixfc_log("FAILED\n");
+		return -1;
+	}
+	pixfc_log("PASSED\n");
+
+	pixfc_log("\n");
+	pixfc_log("\n");
+	pixfc_log("Testing autotuned conversions\n");
+	if (check_autotuned_conversions() != 0) {
 		pixfc_log("FAILED\n");
 		return -1;
 	}
@@ -406,7 +406,7 @@ static int		check_sse_conversion_block(uint32_t sse_conv_index) {
 
 		// Synthetise scalar conversion flags from the SSE conversion flags:
 		// Turn off SSE-related flags and add NoSSEFLoat
-		scalar_flags = (sse_flags & (~(PixFcFlag_NoSSE | PixFcFlag_SSE2Only | PixFcFlag_SSE2_SSSE3Only | PixFcFlag_SSE2_SSSE3_SSE41Only))) | PixFcFlag_NoSSEFloat;
+		scalar_flags = (sse_flags & (~(PixFcFlag_NoSSE | PixFcFlag_SSE2Only | PixFcFlag_SSE2_SSSE3Only | PixFcFlag_SSE2_SSSE3_SSE41Only | PixFcFlag_AVX2Only | PixFcFlag_AVX512Only | PixFcFlag_NEONOnly))) | PixFcFlag_NoSSEFloat;
 
 		// prepare input buffers
 		if (setup_input_buffer(in_file) != 0) {